@@ -51,6 +51,15 @@ DSL_PAD_PROBE_HANDLED = 4
 DSL_SINK_APP_DATA_TYPE_SAMPLE = 0
 DSL_SINK_APP_DATA_TYPE_BUFFER = 1
 
+DSL_SINK_APP_QUEUE_POLICY_DROP_OLDEST = 0
+DSL_SINK_APP_QUEUE_POLICY_DROP_NEWEST = 1
+DSL_SINK_APP_QUEUE_POLICY_BLOCK = 2
+
+DSL_MAILER_QUEUE_POLICY_DROP_OLDEST = 0
+DSL_MAILER_QUEUE_POLICY_DROP_NEWEST = 1
+
+DSL_HANDLE_INVALID = 0
+
 DSL_FLOW_OK    = 0
 DSL_FLOW_EOS   = 1
 DSL_FLOW_ERROR = 2
@@ -70,6 +79,10 @@ DSL_NVBUF_MEM_TYPE_UNIFIED = 3
 DSL_STREAM_FORMAT_BYTE = 2
 DSL_STREAM_FORMAT_TIME = 3
 
+# DSL App Source data-states
+DSL_SOURCE_APP_DATA_STATE_NEED_DATA = 0
+DSL_SOURCE_APP_DATA_STATE_ENOUGH_DATA = 1
+
 # DSL Media Types - Used by all Source Components
 DSL_MEDIA_TYPE_VIDEO_XRAW = "video/x-raw"
 DSL_MEDIA_TYPE_AUDIO_XRAW = "audio/x-raw"
@@ -225,6 +238,7 @@ DSL_RECORDING_EVENT_END   = 1
 DSL_EVENT_FILE_FORMAT_TEXT   = 0
 DSL_EVENT_FILE_FORMAT_CSV    = 1
 DSL_EVENT_FILE_FORMAT_MOTC   = 2
+DSL_EVENT_FILE_FORMAT_BINARY = 3
 
 DSL_WRITE_MODE_APPEND   = 0
 DSL_WRITE_MODE_TRUNCATE = 1
@@ -305,6 +319,31 @@ class dsl_webrtc_connection_data(Structure):
     _fields_ = [
         ('current_state', c_uint)]
 
+class dsl_latency_stats(Structure):
+    _fields_ = [
+        ('count', c_uint),
+        ('min', c_uint),
+        ('mean', c_uint),
+        ('max', c_uint),
+        ('p50', c_uint),
+        ('p90', c_uint),
+        ('p99', c_uint)]
+
+class dsl_meter_source_stats(Structure):
+    _fields_ = [
+        ('source_id', c_uint),
+        ('session_fps_avg', c_double),
+        ('interval_fps_avg', c_double),
+        ('frame_count', c_uint),
+        ('frame_interval_mean', c_uint),
+        ('frame_interval_p50', c_uint),
+        ('frame_interval_p90', c_uint),
+        ('frame_interval_p99', c_uint),
+        ('frame_interval_max', c_uint),
+        ('jitter', c_uint),
+        ('dropped_frames', c_uint),
+        ('stalls', c_uint)]
+
 class dsl_ode_occurrence_source_info(Structure):
     _fields_ = [
         ('source_id', c_uint),
@@ -373,6 +412,8 @@ DSL_LONG_P = POINTER(c_long)
 DSL_DOUBLE_P = POINTER(c_double)
 DSL_FLOAT_P = POINTER(c_float)
 DSL_RTSP_CONNECTION_DATA_P = POINTER(dsl_rtsp_connection_data)
+DSL_LATENCY_STATS_P = POINTER(dsl_latency_stats)
+DSL_METER_SOURCE_STATS_P = POINTER(dsl_meter_source_stats)
 
 ##
 ## Callback Typedefs
@@ -406,6 +447,10 @@ DSL_ODE_TRIGGER_LIMIT_STATE_CHANGE_LISTENER = \
 DSL_PPH_METER_CLIENT_HANDLER = \
     CFUNCTYPE(c_bool, DSL_DOUBLE_P, DSL_DOUBLE_P, c_uint, c_void_p)
 
+# dsl_pph_meter_stats_handler_cb
+DSL_PPH_METER_STATS_HANDLER = \
+    CFUNCTYPE(c_bool, DSL_METER_SOURCE_STATS_P, c_uint, c_void_p)
+
 # dsl_pph_custom_client_handler_cb
 DSL_PPH_CUSTOM_CLIENT_HANDLER = \
     CFUNCTYPE(c_uint, c_void_p, c_void_p)
@@ -486,6 +531,10 @@ DSL_SOURCE_APP_NEED_DATA_HANDLER = \
 DSL_SOURCE_APP_ENOUGH_DATA_HANDLER = \
     CFUNCTYPE(None, c_void_p)
 
+# dsl_source_app_memory_release_cb
+DSL_SOURCE_APP_MEMORY_RELEASE_HANDLER = \
+    CFUNCTYPE(None, c_void_p, c_void_p)
+
 # dsl_sink_app_new_data_handler_cb
 DSL_SINK_APP_NEW_DATA_HANDLER = \
     CFUNCTYPE(c_uint, c_uint, c_void_p, c_void_p)
@@ -1001,6 +1050,30 @@ def dsl_ode_action_file_new(name, file_path, mode, format, force_flush):
     result =_dsl.dsl_ode_action_file_new(name, file_path, mode, format, force_flush)
     return int(result)
 
+##
+## dsl_ode_action_file_rotation_get()
+##
+_dsl.dsl_ode_action_file_rotation_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_ode_action_file_rotation_get.restype = c_uint
+def dsl_ode_action_file_rotation_get(name):
+    global _dsl
+    max_size = c_uint(0)
+    max_duration = c_uint(0)
+    result = _dsl.dsl_ode_action_file_rotation_get(name, 
+        DSL_UINT_P(max_size), DSL_UINT_P(max_duration))
+    return int(result), max_size.value, max_duration.value 
+
+##
+## dsl_ode_action_file_rotation_set()
+##
+_dsl.dsl_ode_action_file_rotation_set.argtypes = [c_wchar_p, c_uint, c_uint]
+_dsl.dsl_ode_action_file_rotation_set.restype = c_uint
+def dsl_ode_action_file_rotation_set(name, max_size, max_duration):
+    global _dsl
+    result = _dsl.dsl_ode_action_file_rotation_set(name, max_size, max_duration)
+    return int(result)
+
 ##
 ## dsl_ode_action_fill_frame_new()
 ##
@@ -1978,6 +2051,48 @@ def dsl_ode_trigger_source_set(name, source):
     result =_dsl.dsl_ode_trigger_source_set(name, source)
     return int(result)
 
+##
+## dsl_ode_trigger_sources_add()
+##
+_dsl.dsl_ode_trigger_sources_add.argtypes = [c_wchar_p, c_wchar_p]
+_dsl.dsl_ode_trigger_sources_add.restype = c_uint
+def dsl_ode_trigger_sources_add(name, source):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_sources_add(name, source)
+    return int(result)
+
+##
+## dsl_ode_trigger_sources_add_many()
+##
+#_dsl.dsl_ode_trigger_sources_add_many.argtypes = [??]
+_dsl.dsl_ode_trigger_sources_add_many.restype = c_uint
+def dsl_ode_trigger_sources_add_many(name, sources):
+    global _dsl
+    arr = (c_wchar_p * len(sources))()
+    arr[:] = sources
+    result =_dsl.dsl_ode_trigger_sources_add_many(name, arr)
+    return int(result)
+
+##
+## dsl_ode_trigger_sources_remove()
+##
+_dsl.dsl_ode_trigger_sources_remove.argtypes = [c_wchar_p, c_wchar_p]
+_dsl.dsl_ode_trigger_sources_remove.restype = c_uint
+def dsl_ode_trigger_sources_remove(name, source):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_sources_remove(name, source)
+    return int(result)
+
+##
+## dsl_ode_trigger_sources_remove_all()
+##
+_dsl.dsl_ode_trigger_sources_remove_all.argtypes = [c_wchar_p]
+_dsl.dsl_ode_trigger_sources_remove_all.restype = c_uint
+def dsl_ode_trigger_sources_remove_all(name):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_sources_remove_all(name)
+    return int(result)
+
 ##
 ## dsl_ode_trigger_infer_get()
 ##
@@ -2020,6 +2135,38 @@ def dsl_ode_trigger_class_id_set(name, class_id):
     result =_dsl.dsl_ode_trigger_class_id_set(name, class_id)
     return int(result)
 
+##
+## dsl_ode_trigger_class_ids_get()
+##
+#_dsl.dsl_ode_trigger_class_ids_get.argtypes = [c_wchar_p, 
+#    c_uint_p, POINTER(c_uint)]
+_dsl.dsl_ode_trigger_class_ids_get.restype = c_uint
+def dsl_ode_trigger_class_ids_get(name):
+    global _dsl
+    size = c_uint(1024)
+    arr = (c_uint * size.value)()
+    result =_dsl.dsl_ode_trigger_class_ids_get(name, 
+        arr, DSL_UINT_P(size))
+    return int(result), arr[:size.value]
+
+##
+## dsl_ode_trigger_class_ids_set()
+##
+#_dsl.dsl_ode_trigger_class_ids_set.argtypes = [c_wchar_p, 
+#    c_uint_p, c_uint]
+_dsl.dsl_ode_trigger_class_ids_set.restype = c_uint
+def dsl_ode_trigger_class_ids_set(name, class_ids):
+    global _dsl
+    if class_ids is None:
+        arr = None
+        size = 0
+    else:
+        size = len(class_ids)
+        arr = (c_uint * size)()
+        arr[:] = class_ids
+    result =_dsl.dsl_ode_trigger_class_ids_set(name, arr, size)
+    return int(result)
+
 ##
 ## dsl_ode_trigger_class_id_ab_get()
 ##
@@ -2543,6 +2690,27 @@ def dsl_ode_heat_mapper_legend_settings_set(name, enabled, location, width, heig
         enabled, location, width, height)
     return int(result)
 
+##
+## dsl_ode_heat_mapper_decay_half_life_get()
+##
+_dsl.dsl_ode_heat_mapper_decay_half_life_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_ode_heat_mapper_decay_half_life_get.restype = c_uint
+def dsl_ode_heat_mapper_decay_half_life_get(name):
+    global _dsl 
+    half_life = c_uint(0)
+    result = _dsl.dsl_ode_heat_mapper_decay_half_life_get(name, DSL_UINT_P(half_life))
+    return int(result), half_life.value 
+
+##
+## dsl_ode_heat_mapper_decay_half_life_set()
+##
+_dsl.dsl_ode_heat_mapper_decay_half_life_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_ode_heat_mapper_decay_half_life_set.restype = c_uint
+def dsl_ode_heat_mapper_decay_half_life_set(name, half_life):
+    global _dsl
+    result = _dsl.dsl_ode_heat_mapper_decay_half_life_set(name, half_life)
+    return int(result)
+
 ##
 ## dsl_ode_heat_mapper_color_palette_get()
 ##
@@ -2748,6 +2916,38 @@ def dsl_pph_ode_display_meta_alloc_size_set(name, size):
     result =_dsl.dsl_pph_ode_display_meta_alloc_size_set(name, size)
     return int(result)
 
+##
+## dsl_pph_ode_parallel_frames_get()
+##
+_dsl.dsl_pph_ode_parallel_frames_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_pph_ode_parallel_frames_get.restype = c_uint
+def dsl_pph_ode_parallel_frames_get(name):
+    global _dsl
+    workers = c_uint(0)
+    result =_dsl.dsl_pph_ode_parallel_frames_get(name, DSL_UINT_P(workers))
+    return int(result), workers.value
+
+##
+## dsl_pph_ode_parallel_frames_set()
+##
+_dsl.dsl_pph_ode_parallel_frames_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_pph_ode_parallel_frames_set.restype = c_uint
+def dsl_pph_ode_parallel_frames_set(name, workers):
+    global _dsl
+    result =_dsl.dsl_pph_ode_parallel_frames_set(name, workers)
+    return int(result)
+
+##
+## dsl_pph_ode_meta_replay()
+##
+_dsl.dsl_pph_ode_meta_replay.argtypes = [c_wchar_p, c_wchar_p, POINTER(c_uint64)]
+_dsl.dsl_pph_ode_meta_replay.restype = c_uint
+def dsl_pph_ode_meta_replay(name, file_path):
+    global _dsl
+    frames = c_uint64(0)
+    result = _dsl.dsl_pph_ode_meta_replay(name, file_path, DSL_UINT64_P(frames))
+    return int(result), frames.value
+
 ##
 ## dsl_pph_custom_new()
 ##
@@ -2797,6 +2997,144 @@ def dsl_pph_meter_interval_set(name, interval):
     result =_dsl.dsl_pph_meter_interval_set(name, interval)
     return int(result)
 
+##
+## dsl_pph_meter_stats_new()
+##
+_dsl.dsl_pph_meter_stats_new.argtypes = [c_wchar_p, c_uint, DSL_PPH_METER_STATS_HANDLER, c_void_p]
+_dsl.dsl_pph_meter_stats_new.restype = c_uint
+def dsl_pph_meter_stats_new(name, interval, stats_handler, client_data):
+    global _dsl
+    stats_handler_cb = DSL_PPH_METER_STATS_HANDLER(stats_handler)
+    callbacks.append(stats_handler_cb)
+    c_client_data=cast(pointer(py_object(client_data)), c_void_p)
+    clientdata.append(c_client_data)
+    result =_dsl.dsl_pph_meter_stats_new(name, interval, stats_handler_cb, c_client_data)
+    return int(result)
+
+##
+## dsl_pph_meter_stall_threshold_get()
+##
+_dsl.dsl_pph_meter_stall_threshold_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_pph_meter_stall_threshold_get.restype = c_uint
+def dsl_pph_meter_stall_threshold_get(name):
+    global _dsl
+    threshold = c_uint(0)
+    result =_dsl.dsl_pph_meter_stall_threshold_get(name, DSL_UINT_P(threshold))
+    return int(result), threshold.value
+
+##
+## dsl_pph_meter_stall_threshold_set()
+##
+_dsl.dsl_pph_meter_stall_threshold_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_pph_meter_stall_threshold_set.restype = c_uint
+def dsl_pph_meter_stall_threshold_set(name, threshold):
+    global _dsl
+    result =_dsl.dsl_pph_meter_stall_threshold_set(name, threshold)
+    return int(result)
+
+##
+## dsl_pph_latency_new()
+##
+_dsl.dsl_pph_latency_new.argtypes = [c_wchar_p]
+_dsl.dsl_pph_latency_new.restype = c_uint
+def dsl_pph_latency_new(name):
+    global _dsl
+    result =_dsl.dsl_pph_latency_new(name)
+    return int(result)
+
+##
+## dsl_pph_latency_segment_count_get()
+##
+_dsl.dsl_pph_latency_segment_count_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_pph_latency_segment_count_get.restype = c_uint
+def dsl_pph_latency_segment_count_get(name):
+    global _dsl
+    count = c_uint(0)
+    result = _dsl.dsl_pph_latency_segment_count_get(name, DSL_UINT_P(count))
+    return int(result), count.value 
+
+##
+## dsl_pph_latency_segment_name_get()
+##
+_dsl.dsl_pph_latency_segment_name_get.argtypes = [c_wchar_p, c_uint, POINTER(c_wchar_p)]
+_dsl.dsl_pph_latency_segment_name_get.restype = c_uint
+def dsl_pph_latency_segment_name_get(name, segment):
+    global _dsl
+    segment_name = c_wchar_p(0)
+    result = _dsl.dsl_pph_latency_segment_name_get(name, 
+        segment, DSL_WCHAR_PP(segment_name))
+    return int(result), segment_name.value 
+
+##
+## dsl_pph_latency_segment_stats_get()
+##
+_dsl.dsl_pph_latency_segment_stats_get.argtypes = [c_wchar_p, c_uint, DSL_LATENCY_STATS_P]
+_dsl.dsl_pph_latency_segment_stats_get.restype = c_uint
+def dsl_pph_latency_segment_stats_get(name, segment):
+    global _dsl
+    stats = dsl_latency_stats()
+    result = _dsl.dsl_pph_latency_segment_stats_get(name, 
+        segment, DSL_LATENCY_STATS_P(stats))
+    return int(result), stats
+
+##
+## dsl_pph_latency_stats_clear()
+##
+_dsl.dsl_pph_latency_stats_clear.argtypes = [c_wchar_p]
+_dsl.dsl_pph_latency_stats_clear.restype = c_uint
+def dsl_pph_latency_stats_clear(name):
+    global _dsl
+    result =_dsl.dsl_pph_latency_stats_clear(name)
+    return int(result)
+
+##
+## dsl_pph_shm_export_new()
+##
+_dsl.dsl_pph_shm_export_new.argtypes = [c_wchar_p, c_wchar_p, c_uint]
+_dsl.dsl_pph_shm_export_new.restype = c_uint
+def dsl_pph_shm_export_new(name, shm_name, capacity):
+    global _dsl
+    result =_dsl.dsl_pph_shm_export_new(name, shm_name, capacity)
+    return int(result)
+
+##
+## dsl_pph_shm_export_stats_get()
+##
+_dsl.dsl_pph_shm_export_stats_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint64), POINTER(c_uint64)]
+_dsl.dsl_pph_shm_export_stats_get.restype = c_uint
+def dsl_pph_shm_export_stats_get(name):
+    global _dsl
+    frames = c_uint64(0)
+    records = c_uint64(0)
+    result = _dsl.dsl_pph_shm_export_stats_get(name, 
+        DSL_UINT64_P(frames), DSL_UINT64_P(records))
+    return int(result), frames.value, records.value 
+
+##
+## dsl_pph_meta_recorder_new()
+##
+_dsl.dsl_pph_meta_recorder_new.argtypes = [c_wchar_p, c_wchar_p]
+_dsl.dsl_pph_meta_recorder_new.restype = c_uint
+def dsl_pph_meta_recorder_new(name, file_path):
+    global _dsl
+    result =_dsl.dsl_pph_meta_recorder_new(name, file_path)
+    return int(result)
+
+##
+## dsl_pph_meta_recorder_stats_get()
+##
+_dsl.dsl_pph_meta_recorder_stats_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint64), POINTER(c_uint64)]
+_dsl.dsl_pph_meta_recorder_stats_get.restype = c_uint
+def dsl_pph_meta_recorder_stats_get(name):
+    global _dsl
+    batches = c_uint64(0)
+    dropped = c_uint64(0)
+    result = _dsl.dsl_pph_meta_recorder_stats_get(name, 
+        DSL_UINT64_P(batches), DSL_UINT64_P(dropped))
+    return int(result), batches.value, dropped.value 
+
 ##
 ## dsl_pph_nmp_new()
 ##
@@ -3007,6 +3345,68 @@ def dsl_source_app_sample_push(name, sample):
     result =_dsl.dsl_source_app_sample_push(name, sample)
     return int(result)
 
+##
+## dsl_source_app_memory_push()
+##
+_dsl.dsl_source_app_memory_push.argtypes = [c_wchar_p, c_void_p, c_uint,
+    DSL_SOURCE_APP_MEMORY_RELEASE_HANDLER, c_void_p]
+_dsl.dsl_source_app_memory_push.restype = c_uint
+def dsl_source_app_memory_push(name, data, size, release_handler, client_data):
+    global _dsl
+    c_release_handler = DSL_SOURCE_APP_MEMORY_RELEASE_HANDLER(release_handler)
+    callbacks.append(c_release_handler)
+    c_client_data=cast(pointer(py_object(client_data)), c_void_p)
+    clientdata.append(c_client_data)
+    result =_dsl.dsl_source_app_memory_push(name, data, size, 
+        c_release_handler, c_client_data)
+    return int(result)
+
+##
+## dsl_source_app_buffer_pool_size_get()
+##
+_dsl.dsl_source_app_buffer_pool_size_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_source_app_buffer_pool_size_get.restype = c_uint
+def dsl_source_app_buffer_pool_size_get(name):
+    global _dsl
+    size = c_uint(0)
+    result =_dsl.dsl_source_app_buffer_pool_size_get(name, DSL_UINT_P(size))
+    return int(result), size.value
+
+##
+## dsl_source_app_buffer_pool_size_set()
+##
+_dsl.dsl_source_app_buffer_pool_size_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_source_app_buffer_pool_size_set.restype = c_uint
+def dsl_source_app_buffer_pool_size_set(name, size):
+    global _dsl
+    result =_dsl.dsl_source_app_buffer_pool_size_set(name, size)
+    return int(result)
+
+##
+## dsl_source_app_buffer_acquire()
+##
+_dsl.dsl_source_app_buffer_acquire.argtypes = [c_wchar_p, 
+    POINTER(c_void_p), POINTER(c_void_p), POINTER(c_uint)]
+_dsl.dsl_source_app_buffer_acquire.restype = c_uint
+def dsl_source_app_buffer_acquire(name):
+    global _dsl
+    buffer = c_void_p(0)
+    data = c_void_p(0)
+    size = c_uint(0)
+    result =_dsl.dsl_source_app_buffer_acquire(name, 
+        pointer(buffer), pointer(data), DSL_UINT_P(size))
+    return int(result), buffer.value, data.value, size.value
+
+##
+## dsl_source_app_buffer_release()
+##
+_dsl.dsl_source_app_buffer_release.argtypes = [c_wchar_p, c_void_p]
+_dsl.dsl_source_app_buffer_release.restype = c_uint
+def dsl_source_app_buffer_release(name, buffer):
+    global _dsl
+    result =_dsl.dsl_source_app_buffer_release(name, buffer)
+    return int(result)
+
 ##
 ## dsl_source_app_eos()
 ##
@@ -3120,6 +3520,40 @@ def dsl_source_app_max_level_bytes_set(name, level):
     result = _dsl.dsl_source_app_max_level_bytes_set(name, level)
     return int(result)
 
+##
+## dsl_source_app_min_level_percent_get()
+##
+_dsl.dsl_source_app_min_level_percent_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint)]
+_dsl.dsl_source_app_min_level_percent_get.restype = c_uint
+def dsl_source_app_min_level_percent_get(name):
+    global _dsl
+    percent = c_uint(0)
+    result = _dsl.dsl_source_app_min_level_percent_get(name, 
+        DSL_UINT_P(percent))
+    return int(result), percent.value 
+
+##
+## dsl_source_app_min_level_percent_set()
+##
+_dsl.dsl_source_app_min_level_percent_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_source_app_min_level_percent_set.restype = c_uint
+def dsl_source_app_min_level_percent_set(name, percent):
+    global _dsl
+    result = _dsl.dsl_source_app_min_level_percent_set(name, percent)
+    return int(result)
+
+##
+## dsl_source_app_data_state_get()
+##
+_dsl.dsl_source_app_data_state_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_source_app_data_state_get.restype = c_uint
+def dsl_source_app_data_state_get(name):
+    global _dsl
+    state = c_uint(0)
+    result = _dsl.dsl_source_app_data_state_get(name, DSL_UINT_P(state))
+    return int(result), state.value 
+
 ##
 ## dsl_source_csi_new()
 ##
@@ -4844,6 +5278,90 @@ def dsl_sink_app_data_type_set(name, data_type):
     result =_dsl.dsl_sink_app_data_type_set(name, data_type)
     return int(result)
 
+##
+## dsl_sink_app_queued_new()
+##
+_dsl.dsl_sink_app_queued_new.argtypes = [c_wchar_p, c_uint, c_uint, c_uint]
+_dsl.dsl_sink_app_queued_new.restype = c_uint
+def dsl_sink_app_queued_new(name, data_type, max_size, policy):
+    global _dsl
+    result = _dsl.dsl_sink_app_queued_new(name, data_type, max_size, policy)
+    return int(result)
+
+##
+## dsl_sink_app_queue_settings_get()
+##
+_dsl.dsl_sink_app_queue_settings_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_sink_app_queue_settings_get.restype = c_uint
+def dsl_sink_app_queue_settings_get(name):
+    global _dsl
+    max_size = c_uint(0)
+    policy = c_uint(0)
+    result =_dsl.dsl_sink_app_queue_settings_get(name, 
+        DSL_UINT_P(max_size), DSL_UINT_P(policy))
+    return int(result), max_size.value, policy.value
+
+##
+## dsl_sink_app_queue_settings_set()
+##
+_dsl.dsl_sink_app_queue_settings_set.argtypes = [c_wchar_p, c_uint, c_uint]
+_dsl.dsl_sink_app_queue_settings_set.restype = c_uint
+def dsl_sink_app_queue_settings_set(name, max_size, policy):
+    global _dsl
+    result =_dsl.dsl_sink_app_queue_settings_set(name, max_size, policy)
+    return int(result)
+
+##
+## dsl_sink_app_pull_batch()
+##
+_dsl.dsl_sink_app_pull_batch.argtypes = [c_wchar_p, 
+    POINTER(c_void_p), c_uint, POINTER(c_uint)]
+_dsl.dsl_sink_app_pull_batch.restype = c_uint
+def dsl_sink_app_pull_batch(name, max_count):
+    global _dsl
+    data = (c_void_p * max_count)()
+    count = c_uint(0)
+    result =_dsl.dsl_sink_app_pull_batch(name, 
+        data, max_count, DSL_UINT_P(count))
+    return int(result), list(data[:count.value])
+
+##
+## dsl_sink_app_batch_release()
+##
+_dsl.dsl_sink_app_batch_release.argtypes = [POINTER(c_void_p), c_uint]
+_dsl.dsl_sink_app_batch_release.restype = c_uint
+def dsl_sink_app_batch_release(data):
+    global _dsl
+    c_data = (c_void_p * len(data))(*data)
+    result =_dsl.dsl_sink_app_batch_release(c_data, len(data))
+    return int(result)
+
+##
+## dsl_sink_app_queue_stats_get()
+##
+_dsl.dsl_sink_app_queue_stats_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint), POINTER(c_uint64)]
+_dsl.dsl_sink_app_queue_stats_get.restype = c_uint
+def dsl_sink_app_queue_stats_get(name):
+    global _dsl
+    depth = c_uint(0)
+    high_water = c_uint(0)
+    dropped = c_uint64(0)
+    result =_dsl.dsl_sink_app_queue_stats_get(name, DSL_UINT_P(depth), 
+        DSL_UINT_P(high_water), DSL_UINT64_P(dropped))
+    return int(result), depth.value, high_water.value, dropped.value
+
+##
+## dsl_sink_app_queue_stats_clear()
+##
+_dsl.dsl_sink_app_queue_stats_clear.argtypes = [c_wchar_p]
+_dsl.dsl_sink_app_queue_stats_clear.restype = c_uint
+def dsl_sink_app_queue_stats_clear(name):
+    global _dsl
+    result =_dsl.dsl_sink_app_queue_stats_clear(name)
+    return int(result)
+
 ##
 ## dsl_sink_fake_new()
 ##
@@ -5211,6 +5729,34 @@ def dsl_sink_webrtc_client_listener_remove(name, client_listener):
     result = _dsl.dsl_sink_webrtc_client_listener_remove(name, c_client_listener)
     return int(result)
 
+##
+## dsl_sink_webrtc_fanout_new()
+##
+_dsl.dsl_sink_webrtc_fanout_new.argtypes = [c_wchar_p, c_wchar_p, c_wchar_p, 
+    c_uint, c_uint, c_uint, c_uint]
+_dsl.dsl_sink_webrtc_fanout_new.restype = c_uint
+def dsl_sink_webrtc_fanout_new(name, 
+    stun_server, turn_server, codec, bitrate, interval, max_peers):
+    global _dsl
+    result =_dsl.dsl_sink_webrtc_fanout_new(name, 
+        stun_server, turn_server, codec, bitrate, interval, max_peers)
+    return int(result)
+
+##
+## dsl_sink_webrtc_fanout_stats_get()
+##
+_dsl.dsl_sink_webrtc_fanout_stats_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint64), POINTER(c_uint64)]
+_dsl.dsl_sink_webrtc_fanout_stats_get.restype = c_uint
+def dsl_sink_webrtc_fanout_stats_get(name):
+    global _dsl
+    peers = c_uint(0)
+    dropped_buffers = c_uint64(0)
+    key_frame_requests = c_uint64(0)
+    result = _dsl.dsl_sink_webrtc_fanout_stats_get(name, DSL_UINT_P(peers), 
+        DSL_UINT64_P(dropped_buffers), DSL_UINT64_P(key_frame_requests))
+    return int(result), peers.value, dropped_buffers.value, key_frame_requests.value 
+
 ##
 ## dsl_sink_message_new()
 ##
@@ -6616,6 +7162,90 @@ def dsl_mailer_test_message_send(name):
     result = _dsl.dsl_mailer_test_message_send(name)
     return int(result)
 
+##
+## dsl_mailer_queue_settings_get()
+##
+_dsl.dsl_mailer_queue_settings_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_mailer_queue_settings_get.restype = c_uint
+def dsl_mailer_queue_settings_get(name):
+    global _dsl
+    max_size = c_uint(0)
+    policy = c_uint(0)
+    result = _dsl.dsl_mailer_queue_settings_get(name, 
+        DSL_UINT_P(max_size), DSL_UINT_P(policy))
+    return int(result), max_size.value, policy.value
+
+##
+## dsl_mailer_queue_settings_set()
+##
+_dsl.dsl_mailer_queue_settings_set.argtypes = [c_wchar_p, c_uint, c_uint]
+_dsl.dsl_mailer_queue_settings_set.restype = c_uint
+def dsl_mailer_queue_settings_set(name, max_size, policy):
+    global _dsl
+    result = _dsl.dsl_mailer_queue_settings_set(name, max_size, policy)
+    return int(result)
+
+##
+## dsl_mailer_rate_limit_get()
+##
+_dsl.dsl_mailer_rate_limit_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_mailer_rate_limit_get.restype = c_uint
+def dsl_mailer_rate_limit_get(name):
+    global _dsl
+    max_per_minute = c_uint(0)
+    result = _dsl.dsl_mailer_rate_limit_get(name, DSL_UINT_P(max_per_minute))
+    return int(result), max_per_minute.value
+
+##
+## dsl_mailer_rate_limit_set()
+##
+_dsl.dsl_mailer_rate_limit_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_mailer_rate_limit_set.restype = c_uint
+def dsl_mailer_rate_limit_set(name, max_per_minute):
+    global _dsl
+    result = _dsl.dsl_mailer_rate_limit_set(name, max_per_minute)
+    return int(result)
+
+##
+## dsl_mailer_digest_settings_get()
+##
+_dsl.dsl_mailer_digest_settings_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_mailer_digest_settings_get.restype = c_uint
+def dsl_mailer_digest_settings_get(name):
+    global _dsl
+    window = c_uint(0)
+    max_messages = c_uint(0)
+    result = _dsl.dsl_mailer_digest_settings_get(name, 
+        DSL_UINT_P(window), DSL_UINT_P(max_messages))
+    return int(result), window.value, max_messages.value
+
+##
+## dsl_mailer_digest_settings_set()
+##
+_dsl.dsl_mailer_digest_settings_set.argtypes = [c_wchar_p, c_uint, c_uint]
+_dsl.dsl_mailer_digest_settings_set.restype = c_uint
+def dsl_mailer_digest_settings_set(name, window, max_messages):
+    global _dsl
+    result = _dsl.dsl_mailer_digest_settings_set(name, window, max_messages)
+    return int(result)
+
+##
+## dsl_mailer_stats_get()
+##
+_dsl.dsl_mailer_stats_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint64), POINTER(c_uint64), POINTER(c_uint64)]
+_dsl.dsl_mailer_stats_get.restype = c_uint
+def dsl_mailer_stats_get(name):
+    global _dsl
+    sent = c_uint64(0)
+    failed = c_uint64(0)
+    dropped = c_uint64(0)
+    result = _dsl.dsl_mailer_stats_get(name, DSL_UINT64_P(sent), 
+        DSL_UINT64_P(failed), DSL_UINT64_P(dropped))
+    return int(result), sent.value, failed.value, dropped.value
+
 ##
 ## dsl_mailer_delete()
 ##
@@ -6754,14 +7384,556 @@ def dsl_message_broker_message_send_async(name, topic, message,
     return int(result)
 
 ##
-## dsl_main_loop_run()
+## dsl_ode_trigger_handle_get()
 ##
-def dsl_main_loop_run():
+_dsl.dsl_ode_trigger_handle_get.argtypes = [c_wchar_p, POINTER(c_uint64)]
+_dsl.dsl_ode_trigger_handle_get.restype = c_uint
+def dsl_ode_trigger_handle_get(name):
     global _dsl
-    _dsl.dsl_main_loop_run()
+    handle = c_uint64(0)
+    result = _dsl.dsl_ode_trigger_handle_get(name, DSL_UINT64_P(handle))
+    return int(result), handle.value
 
 ##
-## dsl_main_loop_quit()
+## dsl_ode_action_handle_get()
+##
+_dsl.dsl_ode_action_handle_get.argtypes = [c_wchar_p, POINTER(c_uint64)]
+_dsl.dsl_ode_action_handle_get.restype = c_uint
+def dsl_ode_action_handle_get(name):
+    global _dsl
+    handle = c_uint64(0)
+    result = _dsl.dsl_ode_action_handle_get(name, DSL_UINT64_P(handle))
+    return int(result), handle.value
+
+##
+## dsl_pph_handle_get()
+##
+_dsl.dsl_pph_handle_get.argtypes = [c_wchar_p, POINTER(c_uint64)]
+_dsl.dsl_pph_handle_get.restype = c_uint
+def dsl_pph_handle_get(name):
+    global _dsl
+    handle = c_uint64(0)
+    result = _dsl.dsl_pph_handle_get(name, DSL_UINT64_P(handle))
+    return int(result), handle.value
+
+##
+## dsl_source_handle_get()
+##
+_dsl.dsl_source_handle_get.argtypes = [c_wchar_p, POINTER(c_uint64)]
+_dsl.dsl_source_handle_get.restype = c_uint
+def dsl_source_handle_get(name):
+    global _dsl
+    handle = c_uint64(0)
+    result = _dsl.dsl_source_handle_get(name, DSL_UINT64_P(handle))
+    return int(result), handle.value
+
+##
+## dsl_sink_handle_get()
+##
+_dsl.dsl_sink_handle_get.argtypes = [c_wchar_p, POINTER(c_uint64)]
+_dsl.dsl_sink_handle_get.restype = c_uint
+def dsl_sink_handle_get(name):
+    global _dsl
+    handle = c_uint64(0)
+    result = _dsl.dsl_sink_handle_get(name, DSL_UINT64_P(handle))
+    return int(result), handle.value
+
+##
+## dsl_handle_release()
+##
+_dsl.dsl_handle_release.argtypes = [c_uint64]
+_dsl.dsl_handle_release.restype = c_uint
+def dsl_handle_release(handle):
+    global _dsl
+    result = _dsl.dsl_handle_release(handle)
+    return int(result)
+
+##
+## dsl_handle_list_size()
+##
+_dsl.dsl_handle_list_size.restype = c_uint
+def dsl_handle_list_size():
+    global _dsl
+    return _dsl.dsl_handle_list_size()
+
+##
+## dsl_ode_trigger_enabled_get_h()
+##
+_dsl.dsl_ode_trigger_enabled_get_h.argtypes = [c_uint64, POINTER(c_bool)]
+_dsl.dsl_ode_trigger_enabled_get_h.restype = c_uint
+def dsl_ode_trigger_enabled_get_h(handle):
+    global _dsl
+    enabled = c_bool(0)
+    result = _dsl.dsl_ode_trigger_enabled_get_h(handle, DSL_BOOL_P(enabled))
+    return int(result), enabled.value
+
+##
+## dsl_ode_trigger_enabled_set_h()
+##
+_dsl.dsl_ode_trigger_enabled_set_h.argtypes = [c_uint64, c_bool]
+_dsl.dsl_ode_trigger_enabled_set_h.restype = c_uint
+def dsl_ode_trigger_enabled_set_h(handle, enabled):
+    global _dsl
+    result = _dsl.dsl_ode_trigger_enabled_set_h(handle, enabled)
+    return int(result)
+
+##
+## dsl_ode_trigger_limit_event_get_h()
+##
+_dsl.dsl_ode_trigger_limit_event_get_h.argtypes = [c_uint64, POINTER(c_uint)]
+_dsl.dsl_ode_trigger_limit_event_get_h.restype = c_uint
+def dsl_ode_trigger_limit_event_get_h(handle):
+    global _dsl
+    limit = c_uint(0)
+    result = _dsl.dsl_ode_trigger_limit_event_get_h(handle, DSL_UINT_P(limit))
+    return int(result), limit.value
+
+##
+## dsl_ode_trigger_limit_event_set_h()
+##
+_dsl.dsl_ode_trigger_limit_event_set_h.argtypes = [c_uint64, c_uint]
+_dsl.dsl_ode_trigger_limit_event_set_h.restype = c_uint
+def dsl_ode_trigger_limit_event_set_h(handle, limit):
+    global _dsl
+    result = _dsl.dsl_ode_trigger_limit_event_set_h(handle, limit)
+    return int(result)
+
+##
+## dsl_ode_trigger_interval_get_h()
+##
+_dsl.dsl_ode_trigger_interval_get_h.argtypes = [c_uint64, POINTER(c_uint)]
+_dsl.dsl_ode_trigger_interval_get_h.restype = c_uint
+def dsl_ode_trigger_interval_get_h(handle):
+    global _dsl
+    interval = c_uint(0)
+    result = _dsl.dsl_ode_trigger_interval_get_h(handle, DSL_UINT_P(interval))
+    return int(result), interval.value
+
+##
+## dsl_ode_trigger_interval_set_h()
+##
+_dsl.dsl_ode_trigger_interval_set_h.argtypes = [c_uint64, c_uint]
+_dsl.dsl_ode_trigger_interval_set_h.restype = c_uint
+def dsl_ode_trigger_interval_set_h(handle, interval):
+    global _dsl
+    result = _dsl.dsl_ode_trigger_interval_set_h(handle, interval)
+    return int(result)
+
+##
+## dsl_ode_trigger_reset_h()
+##
+_dsl.dsl_ode_trigger_reset_h.argtypes = [c_uint64]
+_dsl.dsl_ode_trigger_reset_h.restype = c_uint
+def dsl_ode_trigger_reset_h(handle):
+    global _dsl
+    result = _dsl.dsl_ode_trigger_reset_h(handle)
+    return int(result)
+
+##
+## dsl_ode_action_enabled_get_h()
+##
+_dsl.dsl_ode_action_enabled_get_h.argtypes = [c_uint64, POINTER(c_bool)]
+_dsl.dsl_ode_action_enabled_get_h.restype = c_uint
+def dsl_ode_action_enabled_get_h(handle):
+    global _dsl
+    enabled = c_bool(0)
+    result = _dsl.dsl_ode_action_enabled_get_h(handle, DSL_BOOL_P(enabled))
+    return int(result), enabled.value
+
+##
+## dsl_ode_action_enabled_set_h()
+##
+_dsl.dsl_ode_action_enabled_set_h.argtypes = [c_uint64, c_bool]
+_dsl.dsl_ode_action_enabled_set_h.restype = c_uint
+def dsl_ode_action_enabled_set_h(handle, enabled):
+    global _dsl
+    result = _dsl.dsl_ode_action_enabled_set_h(handle, enabled)
+    return int(result)
+
+##
+## dsl_pph_enabled_get_h()
+##
+_dsl.dsl_pph_enabled_get_h.argtypes = [c_uint64, POINTER(c_bool)]
+_dsl.dsl_pph_enabled_get_h.restype = c_uint
+def dsl_pph_enabled_get_h(handle):
+    global _dsl
+    enabled = c_bool(0)
+    result = _dsl.dsl_pph_enabled_get_h(handle, DSL_BOOL_P(enabled))
+    return int(result), enabled.value
+
+##
+## dsl_pph_enabled_set_h()
+##
+_dsl.dsl_pph_enabled_set_h.argtypes = [c_uint64, c_bool]
+_dsl.dsl_pph_enabled_set_h.restype = c_uint
+def dsl_pph_enabled_set_h(handle, enabled):
+    global _dsl
+    result = _dsl.dsl_pph_enabled_set_h(handle, enabled)
+    return int(result)
+
+##
+## dsl_source_video_dimensions_get_h()
+##
+_dsl.dsl_source_video_dimensions_get_h.argtypes = [c_uint64, POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_source_video_dimensions_get_h.restype = c_uint
+def dsl_source_video_dimensions_get_h(handle):
+    global _dsl
+    width = c_uint(0)
+    height = c_uint(0)
+    result = _dsl.dsl_source_video_dimensions_get_h(handle, DSL_UINT_P(width), DSL_UINT_P(height))
+    return int(result), width.value, height.value
+
+##
+## dsl_source_frame_rate_get_h()
+##
+_dsl.dsl_source_frame_rate_get_h.argtypes = [c_uint64, POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_source_frame_rate_get_h.restype = c_uint
+def dsl_source_frame_rate_get_h(handle):
+    global _dsl
+    fps_n = c_uint(0)
+    fps_d = c_uint(0)
+    result = _dsl.dsl_source_frame_rate_get_h(handle, DSL_UINT_P(fps_n), DSL_UINT_P(fps_d))
+    return int(result), fps_n.value, fps_d.value
+
+##
+## dsl_sink_sync_enabled_get_h()
+##
+_dsl.dsl_sink_sync_enabled_get_h.argtypes = [c_uint64, POINTER(c_bool)]
+_dsl.dsl_sink_sync_enabled_get_h.restype = c_uint
+def dsl_sink_sync_enabled_get_h(handle):
+    global _dsl
+    enabled = c_bool(0)
+    result = _dsl.dsl_sink_sync_enabled_get_h(handle, DSL_BOOL_P(enabled))
+    return int(result), enabled.value
+
+##
+## dsl_sink_sync_enabled_set_h()
+##
+_dsl.dsl_sink_sync_enabled_set_h.argtypes = [c_uint64, c_bool]
+_dsl.dsl_sink_sync_enabled_set_h.restype = c_uint
+def dsl_sink_sync_enabled_set_h(handle, enabled):
+    global _dsl
+    result = _dsl.dsl_sink_sync_enabled_set_h(handle, enabled)
+    return int(result)
+
+##
+## dsl_ode_trigger_source_get_h()
+##
+_dsl.dsl_ode_trigger_source_get_h.argtypes = [c_uint64, POINTER(c_wchar_p)]
+_dsl.dsl_ode_trigger_source_get_h.restype = c_uint
+def dsl_ode_trigger_source_get_h(handle):
+    global _dsl
+    source = c_wchar_p(0)
+    result = _dsl.dsl_ode_trigger_source_get_h(handle, DSL_WCHAR_PP(source))
+    return int(result), source.value
+
+##
+## dsl_ode_trigger_source_set_h()
+##
+_dsl.dsl_ode_trigger_source_set_h.argtypes = [c_uint64, c_wchar_p]
+_dsl.dsl_ode_trigger_source_set_h.restype = c_uint
+def dsl_ode_trigger_source_set_h(handle, source):
+    global _dsl
+    result = _dsl.dsl_ode_trigger_source_set_h(handle, source)
+    return int(result)
+
+##
+## dsl_ode_trigger_infer_get_h()
+##
+_dsl.dsl_ode_trigger_infer_get_h.argtypes = [c_uint64, POINTER(c_wchar_p)]
+_dsl.dsl_ode_trigger_infer_get_h.restype = c_uint
+def dsl_ode_trigger_infer_get_h(handle):
+    global _dsl
+    infer = c_wchar_p(0)
+    result = _dsl.dsl_ode_trigger_infer_get_h(handle, DSL_WCHAR_PP(infer))
+    return int(result), infer.value
+
+##
+## dsl_ode_trigger_infer_set_h()
+##
+_dsl.dsl_ode_trigger_infer_set_h.argtypes = [c_uint64, c_wchar_p]
+_dsl.dsl_ode_trigger_infer_set_h.restype = c_uint
+def dsl_ode_trigger_infer_set_h(handle, infer):
+    global _dsl
+    result = _dsl.dsl_ode_trigger_infer_set_h(handle, infer)
+    return int(result)
+
+##
+## dsl_ode_trigger_class_id_get_h()
+##
+_dsl.dsl_ode_trigger_class_id_get_h.argtypes = [c_uint64, POINTER(c_uint)]
+_dsl.dsl_ode_trigger_class_id_get_h.restype = c_uint
+def dsl_ode_trigger_class_id_get_h(handle):
+    global _dsl
+    class_id = c_uint(0)
+    result = _dsl.dsl_ode_trigger_class_id_get_h(handle, DSL_UINT_P(class_id))
+    return int(result), class_id.value
+
+##
+## dsl_ode_trigger_class_id_set_h()
+##
+_dsl.dsl_ode_trigger_class_id_set_h.argtypes = [c_uint64, c_uint]
+_dsl.dsl_ode_trigger_class_id_set_h.restype = c_uint
+def dsl_ode_trigger_class_id_set_h(handle, class_id):
+    global _dsl
+    result = _dsl.dsl_ode_trigger_class_id_set_h(handle, class_id)
+    return int(result)
+
+##
+## dsl_ode_trigger_limit_frame_get_h()
+##
+_dsl.dsl_ode_trigger_limit_frame_get_h.argtypes = [c_uint64, POINTER(c_uint)]
+_dsl.dsl_ode_trigger_limit_frame_get_h.restype = c_uint
+def dsl_ode_trigger_limit_frame_get_h(handle):
+    global _dsl
+    limit = c_uint(0)
+    result = _dsl.dsl_ode_trigger_limit_frame_get_h(handle, DSL_UINT_P(limit))
+    return int(result), limit.value
+
+##
+## dsl_ode_trigger_limit_frame_set_h()
+##
+_dsl.dsl_ode_trigger_limit_frame_set_h.argtypes = [c_uint64, c_uint]
+_dsl.dsl_ode_trigger_limit_frame_set_h.restype = c_uint
+def dsl_ode_trigger_limit_frame_set_h(handle, limit):
+    global _dsl
+    result = _dsl.dsl_ode_trigger_limit_frame_set_h(handle, limit)
+    return int(result)
+
+##
+## dsl_ode_trigger_reset_timeout_get_h()
+##
+_dsl.dsl_ode_trigger_reset_timeout_get_h.argtypes = [c_uint64, POINTER(c_uint)]
+_dsl.dsl_ode_trigger_reset_timeout_get_h.restype = c_uint
+def dsl_ode_trigger_reset_timeout_get_h(handle):
+    global _dsl
+    timeout = c_uint(0)
+    result = _dsl.dsl_ode_trigger_reset_timeout_get_h(handle, DSL_UINT_P(timeout))
+    return int(result), timeout.value
+
+##
+## dsl_ode_trigger_reset_timeout_set_h()
+##
+_dsl.dsl_ode_trigger_reset_timeout_set_h.argtypes = [c_uint64, c_uint]
+_dsl.dsl_ode_trigger_reset_timeout_set_h.restype = c_uint
+def dsl_ode_trigger_reset_timeout_set_h(handle, timeout):
+    global _dsl
+    result = _dsl.dsl_ode_trigger_reset_timeout_set_h(handle, timeout)
+    return int(result)
+
+##
+## dsl_ode_trigger_infer_confidence_min_get_h()
+##
+_dsl.dsl_ode_trigger_infer_confidence_min_get_h.argtypes = [c_uint64, POINTER(c_float)]
+_dsl.dsl_ode_trigger_infer_confidence_min_get_h.restype = c_uint
+def dsl_ode_trigger_infer_confidence_min_get_h(handle):
+    global _dsl
+    min_confidence = c_float(0)
+    result = _dsl.dsl_ode_trigger_infer_confidence_min_get_h(handle, DSL_FLOAT_P(min_confidence))
+    return int(result), min_confidence.value
+
+##
+## dsl_ode_trigger_infer_confidence_min_set_h()
+##
+_dsl.dsl_ode_trigger_infer_confidence_min_set_h.argtypes = [c_uint64, c_float]
+_dsl.dsl_ode_trigger_infer_confidence_min_set_h.restype = c_uint
+def dsl_ode_trigger_infer_confidence_min_set_h(handle, min_confidence):
+    global _dsl
+    result = _dsl.dsl_ode_trigger_infer_confidence_min_set_h(handle, min_confidence)
+    return int(result)
+
+##
+## dsl_ode_trigger_infer_confidence_max_get_h()
+##
+_dsl.dsl_ode_trigger_infer_confidence_max_get_h.argtypes = [c_uint64, POINTER(c_float)]
+_dsl.dsl_ode_trigger_infer_confidence_max_get_h.restype = c_uint
+def dsl_ode_trigger_infer_confidence_max_get_h(handle):
+    global _dsl
+    max_confidence = c_float(0)
+    result = _dsl.dsl_ode_trigger_infer_confidence_max_get_h(handle, DSL_FLOAT_P(max_confidence))
+    return int(result), max_confidence.value
+
+##
+## dsl_ode_trigger_infer_confidence_max_set_h()
+##
+_dsl.dsl_ode_trigger_infer_confidence_max_set_h.argtypes = [c_uint64, c_float]
+_dsl.dsl_ode_trigger_infer_confidence_max_set_h.restype = c_uint
+def dsl_ode_trigger_infer_confidence_max_set_h(handle, max_confidence):
+    global _dsl
+    result = _dsl.dsl_ode_trigger_infer_confidence_max_set_h(handle, max_confidence)
+    return int(result)
+
+##
+## dsl_ode_trigger_tracker_confidence_min_get_h()
+##
+_dsl.dsl_ode_trigger_tracker_confidence_min_get_h.argtypes = [c_uint64, POINTER(c_float)]
+_dsl.dsl_ode_trigger_tracker_confidence_min_get_h.restype = c_uint
+def dsl_ode_trigger_tracker_confidence_min_get_h(handle):
+    global _dsl
+    min_confidence = c_float(0)
+    result = _dsl.dsl_ode_trigger_tracker_confidence_min_get_h(handle, DSL_FLOAT_P(min_confidence))
+    return int(result), min_confidence.value
+
+##
+## dsl_ode_trigger_tracker_confidence_min_set_h()
+##
+_dsl.dsl_ode_trigger_tracker_confidence_min_set_h.argtypes = [c_uint64, c_float]
+_dsl.dsl_ode_trigger_tracker_confidence_min_set_h.restype = c_uint
+def dsl_ode_trigger_tracker_confidence_min_set_h(handle, min_confidence):
+    global _dsl
+    result = _dsl.dsl_ode_trigger_tracker_confidence_min_set_h(handle, min_confidence)
+    return int(result)
+
+##
+## dsl_ode_trigger_tracker_confidence_max_get_h()
+##
+_dsl.dsl_ode_trigger_tracker_confidence_max_get_h.argtypes = [c_uint64, POINTER(c_float)]
+_dsl.dsl_ode_trigger_tracker_confidence_max_get_h.restype = c_uint
+def dsl_ode_trigger_tracker_confidence_max_get_h(handle):
+    global _dsl
+    max_confidence = c_float(0)
+    result = _dsl.dsl_ode_trigger_tracker_confidence_max_get_h(handle, DSL_FLOAT_P(max_confidence))
+    return int(result), max_confidence.value
+
+##
+## dsl_ode_trigger_tracker_confidence_max_set_h()
+##
+_dsl.dsl_ode_trigger_tracker_confidence_max_set_h.argtypes = [c_uint64, c_float]
+_dsl.dsl_ode_trigger_tracker_confidence_max_set_h.restype = c_uint
+def dsl_ode_trigger_tracker_confidence_max_set_h(handle, max_confidence):
+    global _dsl
+    result = _dsl.dsl_ode_trigger_tracker_confidence_max_set_h(handle, max_confidence)
+    return int(result)
+
+##
+## dsl_ode_trigger_dimensions_min_get_h()
+##
+_dsl.dsl_ode_trigger_dimensions_min_get_h.argtypes = [c_uint64, POINTER(c_float), POINTER(c_float)]
+_dsl.dsl_ode_trigger_dimensions_min_get_h.restype = c_uint
+def dsl_ode_trigger_dimensions_min_get_h(handle):
+    global _dsl
+    min_width = c_float(0)
+    min_height = c_float(0)
+    result = _dsl.dsl_ode_trigger_dimensions_min_get_h(handle, DSL_FLOAT_P(min_width), DSL_FLOAT_P(min_height))
+    return int(result), min_width.value, min_height.value
+
+##
+## dsl_ode_trigger_dimensions_min_set_h()
+##
+_dsl.dsl_ode_trigger_dimensions_min_set_h.argtypes = [c_uint64, c_float, c_float]
+_dsl.dsl_ode_trigger_dimensions_min_set_h.restype = c_uint
+def dsl_ode_trigger_dimensions_min_set_h(handle, min_width, min_height):
+    global _dsl
+    result = _dsl.dsl_ode_trigger_dimensions_min_set_h(handle, min_width, min_height)
+    return int(result)
+
+##
+## dsl_ode_trigger_dimensions_max_get_h()
+##
+_dsl.dsl_ode_trigger_dimensions_max_get_h.argtypes = [c_uint64, POINTER(c_float), POINTER(c_float)]
+_dsl.dsl_ode_trigger_dimensions_max_get_h.restype = c_uint
+def dsl_ode_trigger_dimensions_max_get_h(handle):
+    global _dsl
+    max_width = c_float(0)
+    max_height = c_float(0)
+    result = _dsl.dsl_ode_trigger_dimensions_max_get_h(handle, DSL_FLOAT_P(max_width), DSL_FLOAT_P(max_height))
+    return int(result), max_width.value, max_height.value
+
+##
+## dsl_ode_trigger_dimensions_max_set_h()
+##
+_dsl.dsl_ode_trigger_dimensions_max_set_h.argtypes = [c_uint64, c_float, c_float]
+_dsl.dsl_ode_trigger_dimensions_max_set_h.restype = c_uint
+def dsl_ode_trigger_dimensions_max_set_h(handle, max_width, max_height):
+    global _dsl
+    result = _dsl.dsl_ode_trigger_dimensions_max_set_h(handle, max_width, max_height)
+    return int(result)
+
+##
+## dsl_pph_meter_interval_get_h()
+##
+_dsl.dsl_pph_meter_interval_get_h.argtypes = [c_uint64, POINTER(c_uint)]
+_dsl.dsl_pph_meter_interval_get_h.restype = c_uint
+def dsl_pph_meter_interval_get_h(handle):
+    global _dsl
+    interval = c_uint(0)
+    result = _dsl.dsl_pph_meter_interval_get_h(handle, DSL_UINT_P(interval))
+    return int(result), interval.value
+
+##
+## dsl_pph_meter_interval_set_h()
+##
+_dsl.dsl_pph_meter_interval_set_h.argtypes = [c_uint64, c_uint]
+_dsl.dsl_pph_meter_interval_set_h.restype = c_uint
+def dsl_pph_meter_interval_set_h(handle, interval):
+    global _dsl
+    result = _dsl.dsl_pph_meter_interval_set_h(handle, interval)
+    return int(result)
+
+##
+## dsl_pph_latency_segment_stats_get_h()
+##
+_dsl.dsl_pph_latency_segment_stats_get_h.argtypes = [c_uint64, c_uint, DSL_LATENCY_STATS_P]
+_dsl.dsl_pph_latency_segment_stats_get_h.restype = c_uint
+def dsl_pph_latency_segment_stats_get_h(handle, segment):
+    global _dsl
+    stats = dsl_latency_stats()
+    result = _dsl.dsl_pph_latency_segment_stats_get_h(handle, segment, DSL_LATENCY_STATS_P(stats))
+    return int(result), stats
+
+##
+## dsl_source_is_live_h()
+##
+_dsl.dsl_source_is_live_h.argtypes = [c_uint64, POINTER(c_bool)]
+_dsl.dsl_source_is_live_h.restype = c_uint
+def dsl_source_is_live_h(handle):
+    global _dsl
+    is_live = c_bool(0)
+    result = _dsl.dsl_source_is_live_h(handle, DSL_BOOL_P(is_live))
+    return int(result), is_live.value
+
+##
+## dsl_sink_app_queue_stats_get_h()
+##
+_dsl.dsl_sink_app_queue_stats_get_h.argtypes = [c_uint64, POINTER(c_uint), POINTER(c_uint), POINTER(c_uint64)]
+_dsl.dsl_sink_app_queue_stats_get_h.restype = c_uint
+def dsl_sink_app_queue_stats_get_h(handle):
+    global _dsl
+    depth = c_uint(0)
+    high_water = c_uint(0)
+    dropped = c_uint64(0)
+    result = _dsl.dsl_sink_app_queue_stats_get_h(handle, DSL_UINT_P(depth), DSL_UINT_P(high_water), DSL_UINT64_P(dropped))
+    return int(result), depth.value, high_water.value, dropped.value
+
+##
+## dsl_config_file_load()
+##
+_dsl.dsl_config_file_load.argtypes = [c_wchar_p]
+_dsl.dsl_config_file_load.restype = c_uint
+def dsl_config_file_load(file_path):
+    global _dsl
+    result = _dsl.dsl_config_file_load(file_path)
+    return int(result)
+
+##
+## dsl_config_string_load()
+##
+_dsl.dsl_config_string_load.argtypes = [c_wchar_p]
+_dsl.dsl_config_string_load.restype = c_uint
+def dsl_config_string_load(config):
+    global _dsl
+    result = _dsl.dsl_config_string_load(config)
+    return int(result)
+
+##
+## dsl_main_loop_run()
+##
+def dsl_main_loop_run():
+    global _dsl
+    _dsl.dsl_main_loop_run()
+
+##
+## dsl_main_loop_quit()
 ##
 def dsl_main_loop_quit():
     global _dsl
@@ -6901,3 +8073,24 @@ def dsl_info_log_function_restore():
     global _dsl
     result = _dsl.dsl_info_log_function_restore()
     return int(result)
+
+##
+## dsl_info_log_async_enabled_get()
+##
+_dsl.dsl_info_log_async_enabled_get.argtypes = [POINTER(c_bool)]
+_dsl.dsl_info_log_async_enabled_get.restype = c_uint
+def dsl_info_log_async_enabled_get():
+    global _dsl
+    enabled = c_bool(0)
+    result = _dsl.dsl_info_log_async_enabled_get(DSL_BOOL_P(enabled))
+    return int(result), enabled.value
+
+##
+## dsl_info_log_async_enabled_set()
+##
+_dsl.dsl_info_log_async_enabled_set.argtypes = [c_bool]
+_dsl.dsl_info_log_async_enabled_set.restype = c_uint
+def dsl_info_log_async_enabled_set(enabled):
+    global _dsl
+    result = _dsl.dsl_info_log_async_enabled_set(enabled)
+    return int(result)
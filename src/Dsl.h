@@ -38,12 +38,14 @@ THE SOFTWARE.
 #include <iostream> 
 #include <sstream>
 #include <vector>
+#include <numeric>
 #include <map>
 #include <list> 
 #include <memory> 
 #include <math.h>
 #include <fstream>
 #include <thread>
+#include <atomic>
 #include <chrono>
 #include <unordered_map>
 #include <typeinfo>
@@ -930,6 +930,32 @@ DslReturnType dsl_ode_action_file_new(const wchar_t* name,
         cstrFilePath.c_str(), mode, format, force_flush);
 }
 
+DslReturnType dsl_ode_action_file_rotation_get(const wchar_t* name, 
+    uint* max_size, uint* max_duration)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(max_size);
+    RETURN_IF_PARAM_IS_NULL(max_duration);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionFileRotationGet(cstrName.c_str(),
+        max_size, max_duration);
+}
+
+DslReturnType dsl_ode_action_file_rotation_set(const wchar_t* name, 
+    uint max_size, uint max_duration)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionFileRotationSet(cstrName.c_str(),
+        max_size, max_duration);
+}
+
 DslReturnType dsl_ode_action_monitor_new(const wchar_t* name, 
     dsl_ode_monitor_occurrence_cb client_monitor, void* client_data)
 {
@@ -2046,6 +2072,36 @@ DslReturnType dsl_ode_trigger_class_id_set(const wchar_t* name, uint class_id)
     return DSL::Services::GetServices()->OdeTriggerClassIdSet(cstrName.c_str(), class_id);
 }
 
+DslReturnType dsl_ode_trigger_class_ids_get(const wchar_t* name, 
+    uint* class_ids, uint* size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(class_ids);
+    RETURN_IF_PARAM_IS_NULL(size);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerClassIdsGet(cstrName.c_str(), 
+        class_ids, size);
+}
+
+DslReturnType dsl_ode_trigger_class_ids_set(const wchar_t* name, 
+    const uint* class_ids, uint size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    if (size)
+    {
+        RETURN_IF_PARAM_IS_NULL(class_ids);
+    }
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerClassIdsSet(cstrName.c_str(), 
+        class_ids, size);
+}
+
 DslReturnType dsl_ode_trigger_class_id_ab_get(const wchar_t* name, 
     uint* class_id_a, uint* class_id_b)
 {
@@ -2159,6 +2215,67 @@ DslReturnType dsl_ode_trigger_source_set(const wchar_t* name, const wchar_t* sou
     return DSL::Services::GetServices()->OdeTriggerSourceSet(cstrName.c_str(), cstrSource.c_str());
 }
 
+DslReturnType dsl_ode_trigger_sources_add(const wchar_t* name, const wchar_t* source)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(source);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrSource(source);
+    std::string cstrSource(wstrSource.begin(), wstrSource.end());
+
+    return DSL::Services::GetServices()->OdeTriggerSourcesAdd(cstrName.c_str(), 
+        cstrSource.c_str());
+}
+
+DslReturnType dsl_ode_trigger_sources_add_many(const wchar_t* name, const wchar_t** sources)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(sources);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    for (const wchar_t** source = sources; *source; source++)
+    {
+        std::wstring wstrSource(*source);
+        std::string cstrSource(wstrSource.begin(), wstrSource.end());
+        
+        DslReturnType retval = DSL::Services::GetServices()->
+            OdeTriggerSourcesAdd(cstrName.c_str(), cstrSource.c_str());
+        if (retval != DSL_RESULT_SUCCESS)
+        {
+            return retval;
+        }
+    }
+    return DSL_RESULT_SUCCESS;
+}
+
+DslReturnType dsl_ode_trigger_sources_remove(const wchar_t* name, const wchar_t* source)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(source);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrSource(source);
+    std::string cstrSource(wstrSource.begin(), wstrSource.end());
+
+    return DSL::Services::GetServices()->OdeTriggerSourcesRemove(cstrName.c_str(), 
+        cstrSource.c_str());
+}
+
+DslReturnType dsl_ode_trigger_sources_remove_all(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerSourcesRemoveAll(cstrName.c_str());
+}
+
 DslReturnType dsl_ode_trigger_infer_get(const wchar_t* name, const wchar_t** infer)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -2878,6 +2995,31 @@ DslReturnType dsl_ode_heat_mapper_legend_settings_set(const wchar_t* name,
         cstrName.c_str(), enabled, location, width, height);
 }
 
+DslReturnType dsl_ode_heat_mapper_decay_half_life_get(const wchar_t* name, 
+    uint* half_life)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(half_life);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeHeatMapperDecayHalfLifeGet(
+        cstrName.c_str(), half_life);
+}
+    
+DslReturnType dsl_ode_heat_mapper_decay_half_life_set(const wchar_t* name, 
+    uint half_life)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeHeatMapperDecayHalfLifeSet(
+        cstrName.c_str(), half_life);
+}
+
 DslReturnType dsl_ode_heat_mapper_metrics_clear(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -3022,6 +3164,171 @@ DslReturnType dsl_pph_meter_interval_set(const wchar_t* name, uint interval)
     return DSL::Services::GetServices()->PphMeterIntervalSet(cstrName.c_str(), interval);
 }
 
+DslReturnType dsl_pph_meter_stats_new(const wchar_t* name, uint interval,
+    dsl_pph_meter_stats_handler_cb stats_handler, void* client_data)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(stats_handler);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphMeterStatsNew(cstrName.c_str(),
+        interval, stats_handler, client_data);
+}
+
+DslReturnType dsl_pph_meter_stall_threshold_get(const wchar_t* name, 
+    uint* threshold)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(threshold);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphMeterStallThresholdGet(cstrName.c_str(), 
+        threshold);
+}
+
+DslReturnType dsl_pph_meter_stall_threshold_set(const wchar_t* name, 
+    uint threshold)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphMeterStallThresholdSet(cstrName.c_str(), 
+        threshold);
+}
+
+DslReturnType dsl_pph_latency_new(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphLatencyNew(cstrName.c_str());
+}
+
+DslReturnType dsl_pph_latency_segment_count_get(const wchar_t* name, uint* count)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(count);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphLatencySegmentCountGet(
+        cstrName.c_str(), count);
+}
+
+DslReturnType dsl_pph_latency_segment_name_get(const wchar_t* name, 
+    uint segment, const wchar_t** segment_name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(segment_name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    const char* cSegmentName;
+    static std::string cstrSegmentName;
+    static std::wstring wcstrSegmentName;
+    
+    uint retval = DSL::Services::GetServices()->PphLatencySegmentNameGet(
+        cstrName.c_str(), segment, &cSegmentName);
+    if (retval ==  DSL_RESULT_SUCCESS)
+    {
+        cstrSegmentName.assign(cSegmentName);
+        wcstrSegmentName.assign(cstrSegmentName.begin(), cstrSegmentName.end());
+        *segment_name = wcstrSegmentName.c_str();
+    }
+    return retval;
+}
+
+DslReturnType dsl_pph_latency_segment_stats_get(const wchar_t* name, 
+    uint segment, dsl_latency_stats* stats)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(stats);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphLatencySegmentStatsGet(
+        cstrName.c_str(), segment, stats);
+}
+
+DslReturnType dsl_pph_latency_stats_clear(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphLatencyStatsClear(cstrName.c_str());
+}
+
+DslReturnType dsl_pph_shm_export_new(const wchar_t* name, 
+    const wchar_t* shm_name, uint capacity)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(shm_name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrShmName(shm_name);
+    std::string cstrShmName(wstrShmName.begin(), wstrShmName.end());
+
+    return DSL::Services::GetServices()->PphShmExportNew(cstrName.c_str(),
+        cstrShmName.c_str(), capacity);
+}
+
+DslReturnType dsl_pph_shm_export_stats_get(const wchar_t* name, 
+    uint64_t* frames, uint64_t* records)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(frames);
+    RETURN_IF_PARAM_IS_NULL(records);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphShmExportStatsGet(
+        cstrName.c_str(), frames, records);
+}
+
+DslReturnType dsl_pph_meta_recorder_new(const wchar_t* name, 
+    const wchar_t* file_path)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(file_path);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrFilePath(file_path);
+    std::string cstrFilePath(wstrFilePath.begin(), wstrFilePath.end());
+
+    return DSL::Services::GetServices()->PphMetaRecorderNew(cstrName.c_str(),
+        cstrFilePath.c_str());
+}
+
+DslReturnType dsl_pph_meta_recorder_stats_get(const wchar_t* name, 
+    uint64_t* batches, uint64_t* dropped)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(batches);
+    RETURN_IF_PARAM_IS_NULL(dropped);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphMetaRecorderStatsGet(
+        cstrName.c_str(), batches, dropped);
+}
+
 DslReturnType dsl_pph_ode_new(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -3133,6 +3440,45 @@ DslReturnType dsl_pph_ode_display_meta_alloc_size_set(const wchar_t* name, uint
         cstrName.c_str(), size);
 }
 
+DslReturnType dsl_pph_ode_parallel_frames_get(const wchar_t* name, uint* workers)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(workers);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeParallelFramesGet(
+        cstrName.c_str(), workers);
+}
+
+DslReturnType dsl_pph_ode_parallel_frames_set(const wchar_t* name, uint workers)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeParallelFramesSet(
+        cstrName.c_str(), workers);
+}
+
+DslReturnType dsl_pph_ode_meta_replay(const wchar_t* name, 
+    const wchar_t* file_path, uint64_t* frames)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(file_path);
+    RETURN_IF_PARAM_IS_NULL(frames);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrFilePath(file_path);
+    std::string cstrFilePath(wstrFilePath.begin(), wstrFilePath.end());
+
+    return DSL::Services::GetServices()->PphOdeMetaReplay(cstrName.c_str(),
+        cstrFilePath.c_str(), frames);
+}
+
 DslReturnType dsl_pph_nmp_new(const wchar_t* name, const wchar_t* label_file,
     uint process_method, uint match_method, float match_threshold)
 {
@@ -3450,51 +3796,118 @@ DslReturnType dsl_source_app_sample_push(const wchar_t* name, void* sample)
         sample);
 }
 
-DslReturnType dsl_source_app_eos(const wchar_t* name)
+DslReturnType dsl_source_app_memory_push(const wchar_t* name, 
+    void* data, uint size, dsl_source_app_memory_release_cb release_handler, 
+    void* client_data)
 {
     RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(data);
+    RETURN_IF_PARAM_IS_NULL(release_handler);
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
 
-    return DSL::Services::GetServices()->SourceAppEos(cstrName.c_str());
+    return DSL::Services::GetServices()->SourceAppMemoryPush(cstrName.c_str(),
+        data, size, release_handler, client_data);
 }
 
-DslReturnType dsl_source_app_stream_format_get(const wchar_t* name, 
-    uint* stream_format)
+DslReturnType dsl_source_app_buffer_pool_size_get(const wchar_t* name, 
+    uint* size)
 {
     RETURN_IF_PARAM_IS_NULL(name);
-    RETURN_IF_PARAM_IS_NULL(stream_format);
+    RETURN_IF_PARAM_IS_NULL(size);
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
 
-    return DSL::Services::GetServices()->SourceAppStreamFormatGet(
-        cstrName.c_str(), stream_format);
+    return DSL::Services::GetServices()->SourceAppBufferPoolSizeGet(
+        cstrName.c_str(), size);
 }
-    
-DslReturnType dsl_source_app_stream_format_set(const wchar_t* name, 
-    uint stream_format)
+
+DslReturnType dsl_source_app_buffer_pool_size_set(const wchar_t* name, 
+    uint size)
 {
     RETURN_IF_PARAM_IS_NULL(name);
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
 
-    return DSL::Services::GetServices()->SourceAppStreamFormatSet(
-        cstrName.c_str(), stream_format);
+    return DSL::Services::GetServices()->SourceAppBufferPoolSizeSet(
+        cstrName.c_str(), size);
 }
-    
-DslReturnType dsl_source_app_block_enabled_get(const wchar_t* name, 
-    boolean* enabled)
+
+DslReturnType dsl_source_app_buffer_acquire(const wchar_t* name, 
+    void** buffer, void** data, uint* size)
 {
     RETURN_IF_PARAM_IS_NULL(name);
-    RETURN_IF_PARAM_IS_NULL(enabled);
+    RETURN_IF_PARAM_IS_NULL(buffer);
+    RETURN_IF_PARAM_IS_NULL(data);
+    RETURN_IF_PARAM_IS_NULL(size);
 
     std::wstring wstrName(name);
     std::string cstrName(wstrName.begin(), wstrName.end());
 
-    return DSL::Services::GetServices()->SourceAppBlockEnabledGet(
+    return DSL::Services::GetServices()->SourceAppBufferAcquire(
+        cstrName.c_str(), buffer, data, size);
+}
+
+DslReturnType dsl_source_app_buffer_release(const wchar_t* name, void* buffer)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(buffer);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppBufferRelease(
+        cstrName.c_str(), buffer);
+}
+
+DslReturnType dsl_source_app_eos(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppEos(cstrName.c_str());
+}
+
+DslReturnType dsl_source_app_stream_format_get(const wchar_t* name, 
+    uint* stream_format)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(stream_format);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppStreamFormatGet(
+        cstrName.c_str(), stream_format);
+}
+    
+DslReturnType dsl_source_app_stream_format_set(const wchar_t* name, 
+    uint stream_format)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppStreamFormatSet(
+        cstrName.c_str(), stream_format);
+}
+    
+DslReturnType dsl_source_app_block_enabled_get(const wchar_t* name, 
+    boolean* enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppBlockEnabledGet(
         cstrName.c_str(), enabled);
 }
    
@@ -3547,6 +3960,44 @@ DslReturnType dsl_source_app_max_level_bytes_set(const wchar_t* name,
     return DSL::Services::GetServices()->SourceAppMaxLevelBytesSet(
         cstrName.c_str(), level);
 }
+
+DslReturnType dsl_source_app_min_level_percent_get(const wchar_t* name,
+    uint* percent)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(percent);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppMinLevelPercentGet(
+        cstrName.c_str(), percent);
+}
+
+DslReturnType dsl_source_app_min_level_percent_set(const wchar_t* name,
+    uint percent)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppMinLevelPercentSet(
+        cstrName.c_str(), percent);
+}
+
+DslReturnType dsl_source_app_data_state_get(const wchar_t* name,
+    uint* state)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(state);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceAppDataStateGet(
+        cstrName.c_str(), state);
+}
  
 //DslReturnType dsl_source_app_leaky_type_get(const wchar_t* name,
 //    uint* leaky_type)
@@ -6100,6 +6551,91 @@ DslReturnType dsl_sink_app_data_type_set(const wchar_t* name, uint data_type)
         data_type);
 }
     
+DslReturnType dsl_sink_app_queued_new(const wchar_t* name, uint data_type,
+    uint max_size, uint policy)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkAppQueuedNew(cstrName.c_str(),
+        data_type, max_size, policy);
+}
+
+DslReturnType dsl_sink_app_queue_settings_get(const wchar_t* name, 
+    uint* max_size, uint* policy)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(max_size);
+    RETURN_IF_PARAM_IS_NULL(policy);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkAppQueueSettingsGet(
+        cstrName.c_str(), max_size, policy);
+}
+
+DslReturnType dsl_sink_app_queue_settings_set(const wchar_t* name, 
+    uint max_size, uint policy)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkAppQueueSettingsSet(
+        cstrName.c_str(), max_size, policy);
+}
+
+DslReturnType dsl_sink_app_pull_batch(const wchar_t* name, 
+    void** data, uint max_count, uint* count)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(data);
+    RETURN_IF_PARAM_IS_NULL(count);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkAppPullBatch(
+        cstrName.c_str(), data, max_count, count);
+}
+
+DslReturnType dsl_sink_app_batch_release(void** data, uint count)
+{
+    RETURN_IF_PARAM_IS_NULL(data);
+
+    return DSL::Services::GetServices()->SinkAppBatchRelease(data, count);
+}
+
+DslReturnType dsl_sink_app_queue_stats_get(const wchar_t* name, 
+    uint* depth, uint* high_water, uint64_t* dropped)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(depth);
+    RETURN_IF_PARAM_IS_NULL(high_water);
+    RETURN_IF_PARAM_IS_NULL(dropped);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkAppQueueStatsGet(
+        cstrName.c_str(), depth, high_water, dropped);
+}
+
+DslReturnType dsl_sink_app_queue_stats_clear(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkAppQueueStatsClear(
+        cstrName.c_str());
+}
+
 DslReturnType dsl_sink_fake_new(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -6727,6 +7263,62 @@ DslReturnType dsl_sink_webrtc_client_listener_remove(const wchar_t* name,
 #endif    
 }
 
+DslReturnType dsl_sink_webrtc_fanout_new(const wchar_t* name, 
+    const wchar_t* stun_server, const wchar_t* turn_server, 
+    uint codec, uint bitrate, uint interval, uint max_peers)
+{
+#if !defined(GSTREAMER_SUB_VERSION)
+    #error "GSTREAMER_SUB_VERSION must be defined"
+#elif GSTREAMER_SUB_VERSION < 18
+    LOG_ERROR("WebRTC & WebSocket services require GStreamer 1.18 or later");
+    return DSL_RESULT_API_NOT_SUPPORTED;
+#else
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    std::string cstrStunServer;
+    std::string cstrTurnServer;
+    if (stun_server != NULL)
+    {
+        std::wstring wstrStunServer(stun_server);
+        cstrStunServer.assign(wstrStunServer.begin(), wstrStunServer.end());
+    }
+    if (turn_server != NULL)
+    {
+        std::wstring wstrTurnServer(turn_server);
+        cstrTurnServer.assign(wstrTurnServer.begin(), wstrTurnServer.end());
+    }
+
+    return DSL::Services::GetServices()->SinkWebRtcFanoutNew(cstrName.c_str(),
+        cstrStunServer.c_str(), cstrTurnServer.c_str(), codec, bitrate, 
+        interval, max_peers);
+#endif    
+}
+
+DslReturnType dsl_sink_webrtc_fanout_stats_get(const wchar_t* name, 
+    uint* peers, uint64_t* dropped_buffers, uint64_t* key_frame_requests)
+{
+#if !defined(GSTREAMER_SUB_VERSION)
+    #error "GSTREAMER_SUB_VERSION must be defined"
+#elif GSTREAMER_SUB_VERSION < 18
+    LOG_ERROR("WebRTC & WebSocket services require GStreamer 1.18 or later");
+    return DSL_RESULT_API_NOT_SUPPORTED;
+#else
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(peers);
+    RETURN_IF_PARAM_IS_NULL(dropped_buffers);
+    RETURN_IF_PARAM_IS_NULL(key_frame_requests);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkWebRtcFanoutStatsGet(cstrName.c_str(),
+        peers, dropped_buffers, key_frame_requests);
+#endif    
+}
+
 DslReturnType dsl_websocket_server_path_add(const wchar_t* path)
 {
 #if !defined(GSTREAMER_SUB_VERSION)
@@ -8595,6 +9187,98 @@ DslReturnType dsl_mailer_test_message_send(const wchar_t* name)
     return DSL::Services::GetServices()->MailerSendTestMessage(cstrName.c_str());
 }    
 
+DslReturnType dsl_mailer_queue_settings_get(const wchar_t* name,
+    uint* max_size, uint* policy)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(max_size);
+    RETURN_IF_PARAM_IS_NULL(policy);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->MailerQueueSettingsGet(
+        cstrName.c_str(), max_size, policy);
+}
+
+DslReturnType dsl_mailer_queue_settings_set(const wchar_t* name,
+    uint max_size, uint policy)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->MailerQueueSettingsSet(
+        cstrName.c_str(), max_size, policy);
+}
+
+DslReturnType dsl_mailer_rate_limit_get(const wchar_t* name,
+    uint* max_per_minute)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(max_per_minute);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->MailerRateLimitGet(
+        cstrName.c_str(), max_per_minute);
+}
+
+DslReturnType dsl_mailer_rate_limit_set(const wchar_t* name,
+    uint max_per_minute)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->MailerRateLimitSet(
+        cstrName.c_str(), max_per_minute);
+}
+
+DslReturnType dsl_mailer_digest_settings_get(const wchar_t* name,
+    uint* window, uint* max_messages)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(window);
+    RETURN_IF_PARAM_IS_NULL(max_messages);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->MailerDigestSettingsGet(
+        cstrName.c_str(), window, max_messages);
+}
+
+DslReturnType dsl_mailer_digest_settings_set(const wchar_t* name,
+    uint window, uint max_messages)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->MailerDigestSettingsSet(
+        cstrName.c_str(), window, max_messages);
+}
+
+DslReturnType dsl_mailer_stats_get(const wchar_t* name,
+    uint64_t* sent, uint64_t* failed, uint64_t* dropped)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(sent);
+    RETURN_IF_PARAM_IS_NULL(failed);
+    RETURN_IF_PARAM_IS_NULL(dropped);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->MailerStatsGet(
+        cstrName.c_str(), sent, failed, dropped);
+}
+
 boolean dsl_mailer_exists(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -8861,32 +9545,455 @@ uint dsl_message_broker_list_size()
 {
     return DSL::Services::GetServices()->MessageBrokerListSize();
 }
-    
-void dsl_delete_all()
-{
-    DSL::Services::GetServices()->DeleteAll();
-}
 
-const wchar_t* dsl_info_version_get()
+DslReturnType dsl_ode_trigger_handle_get(const wchar_t* name, DslHandle* handle)
 {
-    return DSL_VERSION;
-}
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(handle);
 
-uint dsl_info_gpu_type_get(uint gpu_id)
-{
-        // Get the Device properties
-        cudaDeviceProp deviceProp;
-        cudaGetDeviceProperties(&deviceProp, gpu_id);
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
 
-        // if aarch64 build, set memorytype to default
-        return (deviceProp.integrated) 
-            ? DSL_GPU_TYPE_INTEGRATED
-            : DSL_GPU_TYPE_DISCRETE;
+    return DSL::Services::GetServices()->OdeTriggerHandleGet(cstrName.c_str(), handle);
 }
 
-DslReturnType dsl_info_stdout_get(const wchar_t** file_path)
+DslReturnType dsl_ode_action_handle_get(const wchar_t* name, DslHandle* handle)
 {
-    RETURN_IF_PARAM_IS_NULL(file_path);
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(handle);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionHandleGet(cstrName.c_str(), handle);
+}
+
+DslReturnType dsl_pph_handle_get(const wchar_t* name, DslHandle* handle)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(handle);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphHandleGet(cstrName.c_str(), handle);
+}
+
+DslReturnType dsl_source_handle_get(const wchar_t* name, DslHandle* handle)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(handle);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceHandleGet(cstrName.c_str(), handle);
+}
+
+DslReturnType dsl_sink_handle_get(const wchar_t* name, DslHandle* handle)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(handle);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SinkHandleGet(cstrName.c_str(), handle);
+}
+
+DslReturnType dsl_handle_release(DslHandle handle)
+{
+    return DSL::Services::GetServices()->HandleRelease(handle);
+}
+
+uint dsl_handle_list_size()
+{
+    return DSL::Services::GetServices()->HandleListSize();
+}
+
+DslReturnType dsl_ode_trigger_enabled_get_h(DslHandle handle, boolean* enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(enabled);
+
+    return DSL::Services::GetServices()->OdeTriggerEnabledGetH(handle, enabled);
+}
+
+DslReturnType dsl_ode_trigger_enabled_set_h(DslHandle handle, boolean enabled)
+{
+    return DSL::Services::GetServices()->OdeTriggerEnabledSetH(handle, enabled);
+}
+
+DslReturnType dsl_ode_trigger_limit_event_get_h(DslHandle handle, uint* limit)
+{
+    RETURN_IF_PARAM_IS_NULL(limit);
+
+    return DSL::Services::GetServices()->OdeTriggerLimitEventGetH(handle, limit);
+}
+
+DslReturnType dsl_ode_trigger_limit_event_set_h(DslHandle handle, uint limit)
+{
+    return DSL::Services::GetServices()->OdeTriggerLimitEventSetH(handle, limit);
+}
+
+DslReturnType dsl_ode_trigger_interval_get_h(DslHandle handle, uint* interval)
+{
+    RETURN_IF_PARAM_IS_NULL(interval);
+
+    return DSL::Services::GetServices()->OdeTriggerIntervalGetH(handle, interval);
+}
+
+DslReturnType dsl_ode_trigger_interval_set_h(DslHandle handle, uint interval)
+{
+    return DSL::Services::GetServices()->OdeTriggerIntervalSetH(handle, interval);
+}
+
+DslReturnType dsl_ode_trigger_reset_h(DslHandle handle)
+{
+    return DSL::Services::GetServices()->OdeTriggerResetH(handle);
+}
+
+DslReturnType dsl_ode_action_enabled_get_h(DslHandle handle, boolean* enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(enabled);
+
+    return DSL::Services::GetServices()->OdeActionEnabledGetH(handle, enabled);
+}
+
+DslReturnType dsl_ode_action_enabled_set_h(DslHandle handle, boolean enabled)
+{
+    return DSL::Services::GetServices()->OdeActionEnabledSetH(handle, enabled);
+}
+
+DslReturnType dsl_pph_enabled_get_h(DslHandle handle, boolean* enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(enabled);
+
+    return DSL::Services::GetServices()->PphEnabledGetH(handle, enabled);
+}
+
+DslReturnType dsl_pph_enabled_set_h(DslHandle handle, boolean enabled)
+{
+    return DSL::Services::GetServices()->PphEnabledSetH(handle, enabled);
+}
+
+DslReturnType dsl_source_video_dimensions_get_h(DslHandle handle, uint* width, uint* height)
+{
+    RETURN_IF_PARAM_IS_NULL(width);
+    RETURN_IF_PARAM_IS_NULL(height);
+
+    return DSL::Services::GetServices()->SourceVideoDimensionsGetH(handle, width, height);
+}
+
+DslReturnType dsl_source_frame_rate_get_h(DslHandle handle, uint* fps_n, uint* fps_d)
+{
+    RETURN_IF_PARAM_IS_NULL(fps_n);
+    RETURN_IF_PARAM_IS_NULL(fps_d);
+
+    return DSL::Services::GetServices()->SourceFrameRateGetH(handle, fps_n, fps_d);
+}
+
+DslReturnType dsl_sink_sync_enabled_get_h(DslHandle handle, boolean* enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(enabled);
+
+    return DSL::Services::GetServices()->SinkSyncEnabledGetH(handle, enabled);
+}
+
+DslReturnType dsl_sink_sync_enabled_set_h(DslHandle handle, boolean enabled)
+{
+    return DSL::Services::GetServices()->SinkSyncEnabledSetH(handle, enabled);
+}
+
+DslReturnType dsl_ode_trigger_source_get_h(DslHandle handle, 
+    const wchar_t** source)
+{
+    RETURN_IF_PARAM_IS_NULL(source);
+
+    const char* cSource(NULL);
+    static std::string cstrSource;
+    static std::wstring wcstrSource;
+
+    uint retval = DSL::Services::GetServices()->OdeTriggerSourceGetH(handle, &cSource);
+    if (retval ==  DSL_RESULT_SUCCESS)
+    {
+        *source = NULL;
+        if (cSource)
+        {
+            cstrSource.assign(cSource);
+            wcstrSource.assign(cstrSource.begin(), cstrSource.end());
+            *source = wcstrSource.c_str();
+        }
+    }
+    return retval;
+}
+
+DslReturnType dsl_ode_trigger_source_set_h(DslHandle handle, 
+    const wchar_t* source)
+{
+    std::string cstrSource;
+    if (source)
+    {
+        std::wstring wstrSource(source);
+        cstrSource.assign(wstrSource.begin(), wstrSource.end());
+    }
+    return DSL::Services::GetServices()->OdeTriggerSourceSetH(handle, cstrSource.c_str());
+}
+
+DslReturnType dsl_ode_trigger_infer_get_h(DslHandle handle, 
+    const wchar_t** infer)
+{
+    RETURN_IF_PARAM_IS_NULL(infer);
+
+    const char* cInfer(NULL);
+    static std::string cstrInfer;
+    static std::wstring wcstrInfer;
+
+    uint retval = DSL::Services::GetServices()->OdeTriggerInferGetH(handle, &cInfer);
+    if (retval ==  DSL_RESULT_SUCCESS)
+    {
+        *infer = NULL;
+        if (cInfer)
+        {
+            cstrInfer.assign(cInfer);
+            wcstrInfer.assign(cstrInfer.begin(), cstrInfer.end());
+            *infer = wcstrInfer.c_str();
+        }
+    }
+    return retval;
+}
+
+DslReturnType dsl_ode_trigger_infer_set_h(DslHandle handle, 
+    const wchar_t* infer)
+{
+    std::string cstrInfer;
+    if (infer)
+    {
+        std::wstring wstrInfer(infer);
+        cstrInfer.assign(wstrInfer.begin(), wstrInfer.end());
+    }
+    return DSL::Services::GetServices()->OdeTriggerInferSetH(handle, cstrInfer.c_str());
+}
+
+DslReturnType dsl_ode_trigger_class_id_get_h(DslHandle handle, uint* class_id)
+{
+    RETURN_IF_PARAM_IS_NULL(class_id);
+
+    return DSL::Services::GetServices()->OdeTriggerClassIdGetH(handle, class_id);
+}
+
+DslReturnType dsl_ode_trigger_class_id_set_h(DslHandle handle, uint class_id)
+{
+    return DSL::Services::GetServices()->OdeTriggerClassIdSetH(handle, class_id);
+}
+
+DslReturnType dsl_ode_trigger_limit_frame_get_h(DslHandle handle, uint* limit)
+{
+    RETURN_IF_PARAM_IS_NULL(limit);
+
+    return DSL::Services::GetServices()->OdeTriggerLimitFrameGetH(handle, limit);
+}
+
+DslReturnType dsl_ode_trigger_limit_frame_set_h(DslHandle handle, uint limit)
+{
+    return DSL::Services::GetServices()->OdeTriggerLimitFrameSetH(handle, limit);
+}
+
+DslReturnType dsl_ode_trigger_reset_timeout_get_h(DslHandle handle, 
+    uint* timeout)
+{
+    RETURN_IF_PARAM_IS_NULL(timeout);
+
+    return DSL::Services::GetServices()->OdeTriggerResetTimeoutGetH(handle, timeout);
+}
+
+DslReturnType dsl_ode_trigger_reset_timeout_set_h(DslHandle handle, 
+    uint timeout)
+{
+    return DSL::Services::GetServices()->OdeTriggerResetTimeoutSetH(handle, timeout);
+}
+
+DslReturnType dsl_ode_trigger_infer_confidence_min_get_h(DslHandle handle, 
+    float* min_confidence)
+{
+    RETURN_IF_PARAM_IS_NULL(min_confidence);
+
+    return DSL::Services::GetServices()->OdeTriggerConfidenceMinGetH(handle, 
+        min_confidence);
+}
+
+DslReturnType dsl_ode_trigger_infer_confidence_min_set_h(DslHandle handle, 
+    float min_confidence)
+{
+    return DSL::Services::GetServices()->OdeTriggerConfidenceMinSetH(handle, 
+        min_confidence);
+}
+
+DslReturnType dsl_ode_trigger_infer_confidence_max_get_h(DslHandle handle, 
+    float* max_confidence)
+{
+    RETURN_IF_PARAM_IS_NULL(max_confidence);
+
+    return DSL::Services::GetServices()->OdeTriggerConfidenceMaxGetH(handle, 
+        max_confidence);
+}
+
+DslReturnType dsl_ode_trigger_infer_confidence_max_set_h(DslHandle handle, 
+    float max_confidence)
+{
+    return DSL::Services::GetServices()->OdeTriggerConfidenceMaxSetH(handle, 
+        max_confidence);
+}
+
+DslReturnType dsl_ode_trigger_tracker_confidence_min_get_h(DslHandle handle, 
+    float* min_confidence)
+{
+    RETURN_IF_PARAM_IS_NULL(min_confidence);
+
+    return DSL::Services::GetServices()->OdeTriggerTrackerConfidenceMinGetH(handle, 
+        min_confidence);
+}
+
+DslReturnType dsl_ode_trigger_tracker_confidence_min_set_h(DslHandle handle, 
+    float min_confidence)
+{
+    return DSL::Services::GetServices()->OdeTriggerTrackerConfidenceMinSetH(handle, 
+        min_confidence);
+}
+
+DslReturnType dsl_ode_trigger_tracker_confidence_max_get_h(DslHandle handle, 
+    float* max_confidence)
+{
+    RETURN_IF_PARAM_IS_NULL(max_confidence);
+
+    return DSL::Services::GetServices()->OdeTriggerTrackerConfidenceMaxGetH(handle, 
+        max_confidence);
+}
+
+DslReturnType dsl_ode_trigger_tracker_confidence_max_set_h(DslHandle handle, 
+    float max_confidence)
+{
+    return DSL::Services::GetServices()->OdeTriggerTrackerConfidenceMaxSetH(handle, 
+        max_confidence);
+}
+
+DslReturnType dsl_ode_trigger_dimensions_min_get_h(DslHandle handle, 
+    float* min_width, float* min_height)
+{
+    RETURN_IF_PARAM_IS_NULL(min_width);
+    RETURN_IF_PARAM_IS_NULL(min_height);
+
+    return DSL::Services::GetServices()->OdeTriggerDimensionsMinGetH(handle, 
+        min_width, min_height);
+}
+
+DslReturnType dsl_ode_trigger_dimensions_min_set_h(DslHandle handle, 
+    float min_width, float min_height)
+{
+    return DSL::Services::GetServices()->OdeTriggerDimensionsMinSetH(handle, 
+        min_width, min_height);
+}
+
+DslReturnType dsl_ode_trigger_dimensions_max_get_h(DslHandle handle, 
+    float* max_width, float* max_height)
+{
+    RETURN_IF_PARAM_IS_NULL(max_width);
+    RETURN_IF_PARAM_IS_NULL(max_height);
+
+    return DSL::Services::GetServices()->OdeTriggerDimensionsMaxGetH(handle, 
+        max_width, max_height);
+}
+
+DslReturnType dsl_ode_trigger_dimensions_max_set_h(DslHandle handle, 
+    float max_width, float max_height)
+{
+    return DSL::Services::GetServices()->OdeTriggerDimensionsMaxSetH(handle, 
+        max_width, max_height);
+}
+
+DslReturnType dsl_pph_meter_interval_get_h(DslHandle handle, uint* interval)
+{
+    RETURN_IF_PARAM_IS_NULL(interval);
+
+    return DSL::Services::GetServices()->PphMeterIntervalGetH(handle, interval);
+}
+
+DslReturnType dsl_pph_meter_interval_set_h(DslHandle handle, uint interval)
+{
+    return DSL::Services::GetServices()->PphMeterIntervalSetH(handle, interval);
+}
+
+DslReturnType dsl_pph_latency_segment_stats_get_h(DslHandle handle, 
+    uint segment, dsl_latency_stats* stats)
+{
+    RETURN_IF_PARAM_IS_NULL(stats);
+
+    return DSL::Services::GetServices()->PphLatencySegmentStatsGetH(handle, 
+        segment, stats);
+}
+
+DslReturnType dsl_source_is_live_h(DslHandle handle, boolean* is_live)
+{
+    RETURN_IF_PARAM_IS_NULL(is_live);
+
+    return DSL::Services::GetServices()->SourceIsLiveH(handle, is_live);
+}
+
+DslReturnType dsl_sink_app_queue_stats_get_h(DslHandle handle, 
+    uint* depth, uint* high_water, uint64_t* dropped)
+{
+    RETURN_IF_PARAM_IS_NULL(depth);
+    RETURN_IF_PARAM_IS_NULL(high_water);
+    RETURN_IF_PARAM_IS_NULL(dropped);
+
+    return DSL::Services::GetServices()->SinkAppQueueStatsGetH(handle, 
+        depth, high_water, dropped);
+}
+
+DslReturnType dsl_config_file_load(const wchar_t* file_path)
+{
+    RETURN_IF_PARAM_IS_NULL(file_path);
+
+    std::wstring wstrFilePath(file_path);
+    std::string cstrFilePath(wstrFilePath.begin(), wstrFilePath.end());
+
+    return DSL::Services::GetServices()->ConfigFileLoad(cstrFilePath.c_str());
+}
+
+DslReturnType dsl_config_string_load(const wchar_t* config)
+{
+    RETURN_IF_PARAM_IS_NULL(config);
+
+    std::wstring wstrConfig(config);
+    std::string cstrConfig(wstrConfig.begin(), wstrConfig.end());
+
+    return DSL::Services::GetServices()->ConfigStringLoad(cstrConfig.c_str());
+}
+    
+void dsl_delete_all()
+{
+    DSL::Services::GetServices()->DeleteAll();
+}
+
+const wchar_t* dsl_info_version_get()
+{
+    return DSL_VERSION;
+}
+
+uint dsl_info_gpu_type_get(uint gpu_id)
+{
+        // Get the Device properties
+        cudaDeviceProp deviceProp;
+        cudaGetDeviceProperties(&deviceProp, gpu_id);
+
+        // if aarch64 build, set memorytype to default
+        return (deviceProp.integrated) 
+            ? DSL_GPU_TYPE_INTEGRATED
+            : DSL_GPU_TYPE_DISCRETE;
+}
+
+DslReturnType dsl_info_stdout_get(const wchar_t** file_path)
+{
+    RETURN_IF_PARAM_IS_NULL(file_path);
 
     const char* cFilePath(NULL);
     static std::wstring wcstrFilePath;
@@ -8999,3 +10106,15 @@ DslReturnType dsl_info_log_function_restore()
     return DSL::Services::GetServices()->InfoLogFunctionRestore();
 }
 
+DslReturnType dsl_info_log_async_enabled_get(boolean* enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(enabled);
+
+    return DSL::Services::GetServices()->InfoLogAsyncEnabledGet(enabled);
+}
+
+DslReturnType dsl_info_log_async_enabled_set(boolean enabled)
+{
+    return DSL::Services::GetServices()->InfoLogAsyncEnabledSet(enabled);
+}
+
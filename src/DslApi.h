@@ -89,6 +89,7 @@ THE SOFTWARE.
 #define DSL_RESULT_SOURCE_CSI_NOT_SUPPORTED                         0x00020016
 #define DSL_RESULT_SOURCE_HANDLER_ADD_FAILED                        0x00020017
 #define DSL_RESULT_SOURCE_HANDLER_REMOVE_FAILED                     0x00020018
+#define DSL_RESULT_SOURCE_BUFFER_ACQUIRE_FAILED                     0x00020019
 
 /**
  * Dewarper API Return Values
@@ -146,6 +147,7 @@ THE SOFTWARE.
 #define DSL_RESULT_SINK_WEBRTC_CONNECTION_CLOSED_FAILED             0x00040019
 #define DSL_RESULT_SINK_MESSAGE_CONFIG_FILE_NOT_FOUND               0x00040020
 #define DSL_RESULT_SINK_COMPONENT_IS_NOT_MESSAGE_SINK               0x00040021
+#define DSL_RESULT_SINK_APP_QUEUE_NOT_ENABLED                       0x00040022
 
 /**
  * OSD API Return Values
@@ -277,6 +279,10 @@ THE SOFTWARE.
 #define DSL_RESULT_PPH_ODE_TRIGGER_NOT_IN_USE                       0x000D0009
 #define DSL_RESULT_PPH_METER_INVALID_INTERVAL                       0x0004000A
 #define DSL_RESULT_PPH_PAD_TYPE_INVALID                             0x0004000B
+#define DSL_RESULT_PPH_LATENCY_SEGMENT_INVALID                      0x000D000C
+#define DSL_RESULT_PPH_META_FILE_INVALID                            0x000D000D
+#define DSL_RESULT_PPH_SHM_EXPORT_PARAMS_INVALID                    0x000D000E
+#define DSL_RESULT_PPH_SHM_EXPORT_NAME_IN_USE                       0x000D000F
 
 /**
  * ODE Trigger API Return Values
@@ -478,6 +484,31 @@ THE SOFTWARE.
 #define DSL_RESULT_PREPROC_SET_FAILED                               0x00B00006
 #define DSL_RESULT_PREPROC_IS_NOT_PREPROC                           0x00B00007
 
+/**
+ * Handle API Return Values
+ */
+#define DSL_RESULT_HANDLE_RESULT                                    0x00C00000
+#define DSL_RESULT_HANDLE_INVALID                                   0x00C00001
+#define DSL_RESULT_HANDLE_TYPE_MISMATCH                             0x00C00002
+#define DSL_RESULT_HANDLE_THREW_EXCEPTION                           0x00C00003
+
+/**
+ * Configuration API Return Values
+ */
+#define DSL_RESULT_CONFIG_RESULT                                    0x00D00000
+#define DSL_RESULT_CONFIG_FILE_NOT_FOUND                            0x00D00001
+#define DSL_RESULT_CONFIG_PARSE_FAILED                              0x00D00002
+#define DSL_RESULT_CONFIG_ITEM_INVALID                              0x00D00003
+#define DSL_RESULT_CONFIG_NAME_NOT_UNIQUE                           0x00D00004
+#define DSL_RESULT_CONFIG_NAME_NOT_FOUND                            0x00D00005
+#define DSL_RESULT_CONFIG_CREATE_FAILED                             0x00D00006
+#define DSL_RESULT_CONFIG_THREW_EXCEPTION                           0x00D00007
+
+/**
+ * @brief Value of a DslHandle that never refers to an object
+ */
+#define DSL_HANDLE_INVALID                                          0
+
 /**
  * GPU Types
  */
@@ -860,6 +891,7 @@ THE SOFTWARE.
 #define DSL_EVENT_FILE_FORMAT_TEXT                                  0
 #define DSL_EVENT_FILE_FORMAT_CSV                                   1
 #define DSL_EVENT_FILE_FORMAT_MOTC                                  2
+#define DSL_EVENT_FILE_FORMAT_BINARY                                3
 
 /**
  * @brief File Open/Write Mode Options when saving Event Data 
@@ -927,11 +959,24 @@ THE SOFTWARE.
 #define DSL_SINK_APP_DATA_TYPE_SAMPLE                               0
 #define DSL_SINK_APP_DATA_TYPE_BUFFER                               1
 
+// Policies applied by a queued App Sink when a new sample arrives and full
+#define DSL_SINK_APP_QUEUE_POLICY_DROP_OLDEST                       0
+#define DSL_SINK_APP_QUEUE_POLICY_DROP_NEWEST                       1
+#define DSL_SINK_APP_QUEUE_POLICY_BLOCK                             2
+
+// Policies applied by a Mailer's outgoing queue when a new message is queued and full
+#define DSL_MAILER_QUEUE_POLICY_DROP_OLDEST                         0
+#define DSL_MAILER_QUEUE_POLICY_DROP_NEWEST                         1
+
 // Valid return values for the dsl_sink_app_new_data_handler_cb
 #define DSL_FLOW_OK                                                 0
 #define DSL_FLOW_EOS                                                1
 #define DSL_FLOW_ERROR                                              2
 
+// APP Source data-states, updated on each "need-data" and "enough-data" signal
+#define DSL_SOURCE_APP_DATA_STATE_NEED_DATA                         0
+#define DSL_SOURCE_APP_DATA_STATE_ENOUGH_DATA                       1
+
 /**
  * @brief APP Source leaky type constants - must match GstAppLeakyType
  */
@@ -947,6 +992,13 @@ EXTERN_C_BEGIN
 typedef uint DslReturnType;
 typedef uint boolean;
 
+/**
+ * @brief Opaque handle to a named DSL object, resolved once by name with
+ * one of the dsl_*_handle_get services and then passed to the dsl_*_h
+ * services in place of the object's name.
+ */
+typedef uint64_t DslHandle;
+
 /**
  * @struct dsl_rtsp_connection_data
  * @brief a structure of Connection Stats and Parameters for a given RTSP Source
@@ -1102,6 +1154,85 @@ typedef struct _dsl_webrtc_connection_data
 
 } dsl_webrtc_connection_data;
 
+/**
+ * @struct _dsl_latency_stats
+ * @brief Latency statistics for one segment of a Latency Pad Probe Handler,
+ * i.e. the time buffers spend between two consecutive trace-points. All 
+ * values are in units of microseconds.
+ */
+typedef struct _dsl_latency_stats
+{
+    /**
+     * @brief number of batched frames measured over the segment.
+     */
+    uint count;
+
+    /**
+     * @brief minimum, mean and maximum latency measured.
+     */
+    uint min;
+    uint mean;
+    uint max;
+    
+    /**
+     * @brief 50th, 90th and 99th percentile latency measured.
+     */
+    uint p50;
+    uint p90;
+    uint p99;
+    
+} dsl_latency_stats;
+
+/**
+ * @struct _dsl_meter_source_stats
+ * @brief Frame-interval statistics for one source, measured by a Meter Pad 
+ * Probe Handler over a single reporting interval. All frame-interval values 
+ * are in units of microseconds. 
+ */
+typedef struct _dsl_meter_source_stats
+{
+    /**
+     * @brief unique id of the source the statistics were measured for.
+     */
+    uint source_id;
+    
+    /**
+     * @brief average frames-per-second over the session and interval.
+     */
+    double session_fps_avg;
+    double interval_fps_avg;
+
+    /**
+     * @brief number of frames received over the interval.
+     */
+    uint frame_count;
+    
+    /**
+     * @brief mean, 50th, 90th and 99th percentile and maximum frame interval.
+     */
+    uint frame_interval_mean;
+    uint frame_interval_p50;
+    uint frame_interval_p90;
+    uint frame_interval_p99;
+    uint frame_interval_max;
+    
+    /**
+     * @brief standard deviation of the frame interval.
+     */
+    uint jitter;
+    
+    /**
+     * @brief estimated number of dropped frames, from gaps in the frame number.
+     */
+    uint dropped_frames;
+
+    /**
+     * @brief number of frame intervals exceeding the stall threshold.
+     */
+    uint stalls;
+    
+} dsl_meter_source_stats;
+
 /**
  * @struct _dsl_coordinate
  * @brief defines a frame coordinate by it's x and y pixel position
@@ -1456,6 +1587,18 @@ typedef boolean (*dsl_ode_post_process_frame_cb)(void* buffer,
  */
 typedef boolean (*dsl_pph_meter_client_handler_cb)(double* session_fps_averages, 
     double* interval_fps_averages, uint source_count, void* client_data);
+
+/**
+ * @brief callback typedef for a client to handle new frame-interval statistics
+ * calculated by the Meter Pad Probe Handler, at an interval specified by the client.
+ * @param[in] stats array of frame-interval statistics, one per source, 
+ * specified by source_count.
+ * @param[in] source_count count of statistics in the stats array.
+ * @param[in] client_data opaque pointer to client's user data.
+ * @return true to continue reporting, false to stop.
+ */
+typedef boolean (*dsl_pph_meter_stats_handler_cb)(dsl_meter_source_stats* stats, 
+    uint source_count, void* client_data);
     
 /**
  * @brief callback typedef for a client pad probe handler function. Once added to a Component, 
@@ -1645,6 +1788,16 @@ typedef void (*dsl_source_app_need_data_handler_cb)(uint length, void* client_da
  */
 typedef void (*dsl_source_app_enough_data_handler_cb)(void* client_data);
 
+/**
+ * @brief Callback typedef for an App Source to notify the client that memory
+ * pushed with dsl_source_app_memory_push is no longer in use and can be 
+ * reused or freed. The function is called from whichever thread releases 
+ * the buffer wrapping the memory - typically a streaming thread.
+ * @param[in] data pointer to the memory pushed by the client.
+ * @param[in] client_data opaque pointer to client's user data.
+ */
+typedef void (*dsl_source_app_memory_release_cb)(void* data, void* client_data);
+
 /**
  * @brief Callback typedef for the App Sink Component. The function is registered
  * when the App Sink is created with dsl_sink_app_new. Once the Pipeline is playing, 
@@ -2155,15 +2308,35 @@ DslReturnType dsl_ode_action_email_new(const wchar_t* name,
  * The file will be created if one does exists, or opened for append if found.
  * @param[in] mode file open/write mode, one of DSL_EVENT_FILE_MODE_* options
  * @param[in] format one of the DSL_EVENT_FILE_FORMAT_* options
- * @param[in] force_flush  if true, the action will schedule a flush to be performed 
- * by the idle thread. NOTE: although the flush event occurs in a background thread,
- * flushing is still a CPU intensive operation and should be used sparingly, when tailing
- * the file for runtime debugging as an example. Set to 0 to disable forced flushing, 
- * and to allow the operating system to more effectively handle the stream flushing.
+ * @param[in] force_flush  if true, queued events are written to file by the Action's 
+ * background writer thread as soon as they are formatted. Set to 0 to write in 
+ * larger batches - once the write buffer fills or once per second.
  * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_ODE_ACTION_RESULT otherwise.
  */
 DslReturnType dsl_ode_action_file_new(const wchar_t* name, 
     const wchar_t* file_path, uint mode, uint format, boolean force_flush);
+
+/**
+ * @brief Gets the current file rotation settings for the named File ODE Action.
+ * @param[in] name unique name of the File ODE Action to query.
+ * @param[out] max_size maximum file size in bytes before rotating, 0 = unlimited.
+ * @param[out] max_duration maximum time in seconds before rotating, 0 = unlimited.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_file_rotation_get(const wchar_t* name, 
+    uint* max_size, uint* max_duration);
+
+/**
+ * @brief Sets the file rotation settings for the named File ODE Action. When either
+ * limit is reached, the current file is closed and renamed with a timestamp suffix
+ * and a new file is opened with the original file path.
+ * @param[in] name unique name of the File ODE Action to update.
+ * @param[in] max_size maximum file size in bytes before rotating, 0 = unlimited.
+ * @param[in] max_duration maximum time in seconds before rotating, 0 = unlimited.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_file_rotation_set(const wchar_t* name, 
+    uint max_size, uint max_duration);
     
 /**
  * @brief Creates a uniquely named Fill Frame ODE Action, that fills the entire
@@ -3186,6 +3359,41 @@ DslReturnType dsl_ode_trigger_source_get(const wchar_t* name, const wchar_t** so
  */
 DslReturnType dsl_ode_trigger_source_set(const wchar_t* name, const wchar_t* source);
 
+/**
+ * @brief Adds a source name to the source-set filter for the ODE Trigger. 
+ * A Trigger with a source-set checks frames from every Source in the set, 
+ * keeping any per-source state - i.e. process interval - for each. 
+ * The set is applied in addition to the source name filter.
+ * @param[in] name unique name of the ODE Trigger to update
+ * @param[in] source unique source name to add to the source-set.
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_sources_add(const wchar_t* name, const wchar_t* source);
+
+/**
+ * @brief Adds a list of source names to the source-set filter for the ODE Trigger.
+ * @param[in] name unique name of the ODE Trigger to update
+ * @param[in] sources a NULL terminated array of unique source names to add.
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_sources_add_many(const wchar_t* name, const wchar_t** sources);
+
+/**
+ * @brief Removes a source name from the source-set filter for the ODE Trigger.
+ * @param[in] name unique name of the ODE Trigger to update
+ * @param[in] source unique source name to remove from the source-set.
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_sources_remove(const wchar_t* name, const wchar_t* source);
+
+/**
+ * @brief Removes all source names from the source-set filter for the ODE Trigger,
+ * disabling the filter.
+ * @param[in] name unique name of the ODE Trigger to update
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_sources_remove_all(const wchar_t* name);
+
 /**
  * @brief Gets the current infer component name filter for the ODE Trigger
  * A value of NULL indicates filter disabled (default)
@@ -3219,6 +3427,29 @@ DslReturnType dsl_ode_trigger_class_id_get(const wchar_t* name, uint* class_id);
  */
 DslReturnType dsl_ode_trigger_class_id_set(const wchar_t* name, uint class_id);
 
+/**
+ * @brief Gets the current class-set filter for the ODE Trigger
+ * @param[in] name unique name of the ODE Trigger to query
+ * @param[out] class_ids an array to copy the class_ids in the set to.
+ * @param[inout] size max size of the class_ids array on call, actual size on return.
+ * A size of 0 indicates the filter is disabled (default).
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_class_ids_get(const wchar_t* name, 
+    uint* class_ids, uint* size);
+
+/**
+ * @brief Sets the class-set filter for the ODE Trigger. The set is applied in
+ * addition to the class_id filter, which is typically left as DSL_ODE_ANY_CLASS.
+ * Not supported by AB Triggers.
+ * @param[in] name unique name of the ODE Trigger to update
+ * @param[in] class_ids an array of class_ids, each less than 1024.
+ * @param[in] size of the class_ids array, 0 to disable the filter.
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_class_ids_set(const wchar_t* name, 
+    const uint* class_ids, uint size);
+
 /**
  * @brief Gets the current class_id_a and class_id_b filters for the ODE Trigger
  * @param[in] name unique name of the Intersection ODE Trigger to query
@@ -3761,6 +3992,28 @@ DslReturnType dsl_ode_heat_mapper_legend_settings_get(const wchar_t* name,
 DslReturnType dsl_ode_heat_mapper_legend_settings_set(const wchar_t* name, 
     boolean enabled, uint location, uint width, uint height);
 
+/**
+ * @brief Gets the current exponential decay half-life for the named ODE Heat-Mapper.
+ * @param[in] name unique name of the ODE Heat-Mapper to query.
+ * @param[out] half_life current half-life in units of frames. 0 = decay disabled.
+ * @return DSL_RESULT_SUCCESS on successful query, 
+ * DSL_RESULT_ODE_HEAT_MAPPER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_heat_mapper_decay_half_life_get(const wchar_t* name, 
+    uint* half_life);
+
+/**
+ * @brief Sets the exponential decay half-life for the named ODE Heat-Mapper. 
+ * When enabled, the occurrences for all map locations are halved every
+ * half_life frames so that the heat-map does not saturate over time.
+ * @param[in] name unique name of the ODE Heat-Mapper to update.
+ * @param[in] half_life new half-life in units of frames. Set to 0 to disable.
+ * @return DSL_RESULT_SUCCESS on successful update, 
+ * DSL_RESULT_ODE_HEAT_MAPPER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_heat_mapper_decay_half_life_set(const wchar_t* name, 
+    uint half_life);
+
 /**
  * @brief Calls on an ODE Heat-Mapper to clear its current heat-map metrics
  * returning the map to its initial all-zero state. 
@@ -3895,7 +4148,8 @@ DslReturnType dsl_pph_ode_trigger_remove_all(const wchar_t* name);
  * @brief Gets the current setting for the number of Display Meta structures that
  * are allocated for each frame. Each structure can hold up to 16 display elements
  * for each display type (lines, arrows, rectangles, etc.). The default size is one.
- * Note: each allocation adds overhead to the processing of each frame. 
+ * Note: structures are acquired on demand, only when an ODE Action adds a display 
+ * element to a frame. The size is the maximum number acquired for each frame.
  * @param[in] name unique name of the ODE Handler to query.
  * @param[out] count current count of Display Meta structures allocated per frame
  * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
@@ -3906,13 +4160,51 @@ DslReturnType dsl_pph_ode_display_meta_alloc_size_get(const wchar_t* name, uint*
  * @brief Sets the current setting for the number of Display Meta structures that
  * are allocated for each frame. Each structure can hold up to 16 display elements
  * for each display type (lines, arrows, rectangles, etc.). The default size is one.
- * Note: each allocation adds overhead to the processing of each frame. 
+ * Note: structures are acquired on demand, only when an ODE Action adds a display 
+ * element to a frame. The size is the maximum number acquired for each frame.
  * @param[in] name unique name of the ODE Handler to update.
  * @param[in] size number of Display Meta structures allocated per frame
  * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
  */
 DslReturnType dsl_pph_ode_display_meta_alloc_size_set(const wchar_t* name, uint size);
 
+/**
+ * @brief Gets the current number of worker threads the ODE Handler uses to
+ * process the frames of each batch in parallel. 
+ * @param[in] name unique name of the ODE Handler to query.
+ * @param[out] workers current number of worker threads, 0 = disabled (default).
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_parallel_frames_get(const wchar_t* name, uint* workers);
+
+/**
+ * @brief Sets the number of worker threads the ODE Handler uses to process the
+ * frames of each batch in parallel. ODE Triggers with a Source filter are run 
+ * on the workers for the frames of their Source, with the exception of Custom 
+ * Triggers. All cross-source Triggers - those without a Source filter - are run
+ * serially once all workers have completed.
+ * Note: Actions shared between partitioned Triggers may be invoked concurrently.
+ * @param[in] name unique name of the ODE Handler to update.
+ * @param[in] workers number of worker threads to use, 0 to disable.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_parallel_frames_set(const wchar_t* name, uint workers);
+
+/**
+ * @brief Replays a Meta Record file, created with a Meta Recorder PPH, through
+ * the named ODE Pad Probe Handler. Each recorded batch is rebuilt as synthetic 
+ * batch meta and handled as fast as the CPU allows - no Pipeline, GPU, or clock
+ * is required. The call blocks until all batches have been handled.
+ * @param[in] name unique name of the ODE Pad Probe Handler to replay into.
+ * @param[in] file_path path to the Meta Record file to replay.
+ * @param[out] frames number of frames replayed.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise.
+ * @note ODE Actions that require the video frame, e.g. capture actions, 
+ * are not supported during replay.
+ */
+DslReturnType dsl_pph_ode_meta_replay(const wchar_t* name, 
+    const wchar_t* file_path, uint64_t* frames);
+
 /**
  * @brief creates a new, uniquely named Custom pad-probe-handler to process a buffer
  * @param[in] name unique component name for the new Custom Handler
@@ -3950,6 +4242,144 @@ DslReturnType dsl_pph_meter_interval_get(const wchar_t* name, uint* interval);
  */
 DslReturnType dsl_pph_meter_interval_set(const wchar_t* name, uint interval);
 
+/**
+ * @brief creates a new, uniquely named Meter pad-probe-handler that reports
+ * frame-interval statistics - percentiles, jitter, dropped frames and stalls -
+ * for each source.
+ * @param[in] name unique component name for the new Meter
+ * @param[in] interval interval at which to report performance measurements
+ * @param[in] stats_handler client callback function, called at "interval" with 
+ * frame-interval statistics for each source
+ * @param[in] client_data opaque pointer to client date returned with the callback
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_meter_stats_new(const wchar_t* name, uint interval,
+    dsl_pph_meter_stats_handler_cb stats_handler, void* client_data);
+
+/**
+ * @brief gets the current stall threshold for the named Meter PPH.
+ * @param[in] name unique name of the Meter PPH to query
+ * @param[out] threshold frame interval in milliseconds above which a source
+ * is counted as stalled. 
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_meter_stall_threshold_get(const wchar_t* name, 
+    uint* threshold);
+
+/**
+ * @brief sets the stall threshold for the named Meter PPH.
+ * @param[in] name unique name of the Meter PPH to update
+ * @param[in] threshold new frame interval in milliseconds above which a source
+ * is counted as stalled. 
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_meter_stall_threshold_set(const wchar_t* name, 
+    uint threshold);
+
+/**
+ * @brief Creates a new, uniquely named Latency Pad Probe Handler (PPH). The 
+ * handler can be added to the sink or src pad of any number of components.
+ * Each addition creates a trace-point that stamps each batched frame, keyed 
+ * by source-id and buffer PTS, with a monotonic time. The latency between
+ * each pair of consecutive trace-points is recorded as a "segment". 
+ * @param[in] name unique name for the new Pad Probe Handler.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise.
+ * @note trace-points must be added in pipeline (upstream to downstream) 
+ * order and only measure batched buffers, i.e. downstream of the Streammuxer.
+ */
+DslReturnType dsl_pph_latency_new(const wchar_t* name);
+
+/**
+ * @brief Gets the current number of segments for the named Latency PPH,
+ * equal to the number of trace-points minus one. 
+ * @param[in] name unique name of the Latency PPH to query.
+ * @param[out] count current number of segments.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise.
+ */
+DslReturnType dsl_pph_latency_segment_count_get(const wchar_t* name, uint* count);
+
+/**
+ * @brief Gets the name of a segment for the named Latency PPH in the
+ * form "<component>:<pad> -> <component>:<pad>".
+ * @param[in] name unique name of the Latency PPH to query.
+ * @param[in] segment index of the segment to query, 0 to count-1.
+ * @param[out] segment_name name of the segment.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise.
+ */
+DslReturnType dsl_pph_latency_segment_name_get(const wchar_t* name, 
+    uint segment, const wchar_t** segment_name);
+
+/**
+ * @brief Gets the latency statistics for a segment of the named Latency PPH.
+ * @param[in] name unique name of the Latency PPH to query.
+ * @param[in] segment index of the segment to query, 0 to count-1.
+ * @param[out] stats latency statistics for the segment in microseconds.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise.
+ */
+DslReturnType dsl_pph_latency_segment_stats_get(const wchar_t* name, 
+    uint segment, dsl_latency_stats* stats);
+
+/**
+ * @brief Clears the latency statistics for all segments of the named 
+ * Latency PPH.
+ * @param[in] name unique name of the Latency PPH to update.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise.
+ */
+DslReturnType dsl_pph_latency_stats_clear(const wchar_t* name);
+
+/**
+ * @brief Creates a new, uniquely named Shared-Memory Export Pad Probe Handler 
+ * (PPH). The handler serializes the object metadata of each batched frame into 
+ * fixed-layout binary records, written to a memory-mapped multi-reader ring 
+ * in /dev/shm. See DslShmExport.h for the record layout and reader functions.
+ * @param[in] name unique name for the new Pad Probe Handler.
+ * @param[in] shm_name name of the shared-memory object to create, must start 
+ * with a single "/", e.g. "/dsl-detections". The object must not already 
+ * exist, nor be in use by another Shm Export PPH.
+ * @param[in] capacity number of records in the ring, from 1 to 
+ * DSL_SHM_EXPORT_MAX_CAPACITY, rounded up to the next power of 2. 
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise.
+ */
+DslReturnType dsl_pph_shm_export_new(const wchar_t* name, 
+    const wchar_t* shm_name, uint capacity);
+
+/**
+ * @brief Gets the number of frames and records written by the named 
+ * Shared-Memory Export PPH since creation.
+ * @param[in] name unique name of the Shared-Memory Export PPH to query.
+ * @param[out] frames number of frames, with one or more objects, written.
+ * @param[out] records number of object records written, equal to the 
+ * ring's current write sequence.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise.
+ */
+DslReturnType dsl_pph_shm_export_stats_get(const wchar_t* name, 
+    uint64_t* frames, uint64_t* records);
+
+/**
+ * @brief Creates a new, uniquely named Meta Recorder Pad Probe Handler (PPH).
+ * The handler records the frame and object metadata of each batch to a compact
+ * binary file, written by a background thread, for offline replay with
+ * dsl_pph_ode_meta_replay.
+ * @param[in] name unique name for the new Pad Probe Handler.
+ * @param[in] file_path path to the Meta Record file to create. Any existing
+ * file is truncated.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise.
+ */
+DslReturnType dsl_pph_meta_recorder_new(const wchar_t* name, 
+    const wchar_t* file_path);
+
+/**
+ * @brief Gets the number of batches recorded and dropped by the named 
+ * Meta Recorder PPH since creation.
+ * @param[in] name unique name of the Meta Recorder PPH to query.
+ * @param[out] batches number of batches recorded.
+ * @param[out] dropped number of batches dropped because the writer's
+ * queue was full. Batches are always dropped whole.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise.
+ */
+DslReturnType dsl_pph_meta_recorder_stats_get(const wchar_t* name, 
+    uint64_t* batches, uint64_t* dropped);
+
 /**
  * @brief Creates a new, uniquely named Non-Maximum Processor (NMP) Pad 
  * Probe Handler (PPH) component.
@@ -4165,6 +4595,68 @@ DslReturnType dsl_source_app_buffer_push(const wchar_t* name, void* buffer);
  */
 DslReturnType dsl_source_app_sample_push(const wchar_t* name, void* sample);
 
+/**
+ * @brief Wraps client memory in a new buffer, without copying, and pushes 
+ * it to a uniquely named App Source component for processing.
+ * @param[in] name unique name of the App Source to push to.
+ * @param[in] data pointer to the client memory to wrap. The memory must 
+ * remain valid and unchanged until the release_handler is called.
+ * @param[in] size size of the client memory in bytes.
+ * @param[in] release_handler client callback function to be called when the 
+ * memory is no longer in use. 
+ * @param[in] client_data opaque pointer to client data passed back into the 
+ * release_handler function.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ * On failure, the client retains ownership and is not called back.
+ */
+DslReturnType dsl_source_app_memory_push(const wchar_t* name, 
+    void* data, uint size, dsl_source_app_memory_release_cb release_handler, 
+    void* client_data);
+
+/**
+ * @brief Gets the number of buffers pre-allocated by the buffer pool for
+ * the named App Source Component.
+ * @param[in] name unique name of the App Source to query.
+ * @param[out] size current buffer-pool size, 0 if disabled. Default = 0.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_buffer_pool_size_get(const wchar_t* name, 
+    uint* size);
+
+/**
+ * @brief Sets the number of buffers to pre-allocate for the named App Source
+ * Component. The pool is created when the Pipeline is played, with buffers
+ * sized for the App Source's buffer-in format and dimensions.
+ * @param[in] name unique name of the App Source to update.
+ * @param[in] size new buffer-pool size, 0 to disable the pool.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_buffer_pool_size_set(const wchar_t* name, 
+    uint size);
+
+/**
+ * @brief Acquires a free buffer from the named App Source's buffer pool. The
+ * client fills the buffer's memory and pushes it with dsl_source_app_buffer_push,
+ * or returns it with dsl_source_app_buffer_release. The service does not wait
+ * if all buffers are in use.
+ * @param[in] name unique name of the App Source to acquire from.
+ * @param[out] buffer acquired buffer.
+ * @param[out] data pointer to the buffer's memory to fill.
+ * @param[out] size size of the buffer's memory in bytes.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_buffer_acquire(const wchar_t* name, 
+    void** buffer, void** data, uint* size);
+
+/**
+ * @brief Returns a buffer, acquired with dsl_source_app_buffer_acquire and 
+ * not pushed, to the named App Source's buffer pool.
+ * @param[in] name unique name of the App Source to release to.
+ * @param[in] buffer buffer to release.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_buffer_release(const wchar_t* name, void* buffer);
+
 /**
  * @brief Notifies a uniquely named App Source component that no more buffers
  * are available.
@@ -4270,6 +4762,39 @@ DslReturnType dsl_source_app_max_level_bytes_get(const wchar_t* name,
 DslReturnType dsl_source_app_max_level_bytes_set(const wchar_t* name,
     uint64_t level);
 
+/**
+ * @brief Gets the min-level of queued data, as a percentage of the max-level,
+ * for the named App Source Component. The App Source will call the 
+ * "need-data-callback" when the level of queued data falls below.
+ * @param[in] name unique name of the App Source to query.
+ * @param[out] percent current min-level percentage. Default = 0.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_min_level_percent_get(const wchar_t* name,
+    uint* percent);
+
+/**
+ * @brief Sets the min-level of queued data, as a percentage of the max-level,
+ * for the named App Source Component. 
+ * @param[in] name unique name of the App Source to update.
+ * @param[in] percent new min-level percentage, 0..100.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_min_level_percent_set(const wchar_t* name,
+    uint percent);
+
+/**
+ * @brief Gets the current data-state for the named App Source Component,
+ * updated each time the max-level is reached (enough-data) and each time the 
+ * level falls below the min-level (need-data). Allows clients to apply 
+ * back-pressure without adding data-handlers.
+ * @param[in] name unique name of the App Source to query.
+ * @param[out] state one of the DSL_SOURCE_APP_DATA_STATE constants.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_app_data_state_get(const wchar_t* name,
+    uint* state);
+
 /**
  * @brief Gets the leaky type for the named App Source Component.
  * @param[in] name unique name of the App Source to query.
@@ -6064,6 +6589,83 @@ DslReturnType dsl_sink_app_data_type_get(const wchar_t* name, uint* data_type);
  */
 DslReturnType dsl_sink_app_data_type_set(const wchar_t* name, uint data_type);
     
+/**
+ * @brief Creates a new, uniquely named App Sink component in queued delivery
+ * mode. New samples are added to a bounded queue on the streaming thread and 
+ * the client pulls them at its own rate with dsl_sink_app_pull_batch. 
+ * @param[in] name unique component name for the new App Sink.
+ * @param[in] data_type either DSL_SINK_APP_DATA_TYPE_SAMPLE or 
+ * DSL_SINK_APP_DATA_TYPE_BUFFER
+ * @param[in] max_size maximum number of samples to queue, must be > 0.
+ * @param[in] policy one of the DSL_SINK_APP_QUEUE_POLICY constants to apply
+ * when a new sample arrives and the queue is full.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_app_queued_new(const wchar_t* name, uint data_type,
+    uint max_size, uint policy);
+
+/**
+ * @brief Gets the current queue settings for the named, queued App Sink.
+ * @param[in] name unique name of the App Sink to query.
+ * @param[out] max_size maximum number of samples to queue.
+ * @param[out] policy current DSL_SINK_APP_QUEUE_POLICY in use.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_app_queue_settings_get(const wchar_t* name, 
+    uint* max_size, uint* policy);
+
+/**
+ * @brief Sets the queue settings for the named, queued App Sink. The
+ * max-size can only be changed when the App Sink is not in use.
+ * @param[in] name unique name of the App Sink to update.
+ * @param[in] max_size maximum number of samples to queue, must be > 0.
+ * @param[in] policy new DSL_SINK_APP_QUEUE_POLICY to use.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_app_queue_settings_set(const wchar_t* name, 
+    uint max_size, uint policy);
+
+/**
+ * @brief Pulls up to max_count queued samples or buffers - depending on the
+ * current data-type - from the named, queued App Sink, oldest first. The 
+ * service does not wait for new data. The client owns a reference to each
+ * item returned and must release them with dsl_sink_app_batch_release.
+ * @param[in] name unique name of the App Sink to pull from.
+ * @param[out] data client array of at least max_count pointers to fill.
+ * @param[in] max_count maximum number of items to pull.
+ * @param[out] count number of items returned in data, 0 if none queued.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_app_pull_batch(const wchar_t* name, 
+    void** data, uint max_count, uint* count);
+
+/**
+ * @brief Releases the samples or buffers returned by dsl_sink_app_pull_batch.
+ * @param[in] data array of items returned by dsl_sink_app_pull_batch.
+ * @param[in] count number of items in data to release.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_app_batch_release(void** data, uint count);
+
+/**
+ * @brief Gets the current queue statistics for the named, queued App Sink.
+ * @param[in] name unique name of the App Sink to query.
+ * @param[out] depth current number of samples in the queue.
+ * @param[out] high_water largest queue depth since last cleared.
+ * @param[out] dropped number of samples dropped since last cleared.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_app_queue_stats_get(const wchar_t* name, 
+    uint* depth, uint* high_water, uint64_t* dropped);
+
+/**
+ * @brief Clears the queue high-water mark and dropped count for the
+ * named, queued App Sink.
+ * @param[in] name unique name of the App Sink to update.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise
+ */
+DslReturnType dsl_sink_app_queue_stats_clear(const wchar_t* name);
+
 /**
  * @brief creates a new, uniquely named Fake Sink component
  * @param[in] name unique component name for the new Fake Sink
@@ -6508,6 +7110,43 @@ DslReturnType dsl_sink_webrtc_client_listener_add(const wchar_t* name,
 DslReturnType dsl_sink_webrtc_client_listener_remove(const wchar_t* name, 
     dsl_sink_webrtc_client_listener_cb listener);
 
+/**
+ * @brief creates a new, uniquely named WebRTC Fan-out Sink component. The 
+ * Fan-out Sink serves up to max_peers Websocket clients from a single encoder.
+ * A new WebRTC peer is created for each new Websocket connection and removed 
+ * when the connection closes. Each peer has its own leaky queue so that a 
+ * congested client drops its own buffers without stalling the other clients. 
+ * A new key frame is requested from the encoder when a peer joins.
+ * @param[in] name unique component name for the new WebRTC Fan-out Sink
+ * @param[in] stun_server STUN server to use of the form stun://hostname:port.
+ * Set to NULL to omit if using TURN server(s)
+ * @param[in] turn_server TURN server(s) to use of the form 
+ * turn(s)://username:password@host:port. Set to NULL to omit if using a STUN server
+ * @param[in] codec either DSL_CODEC_H264 DSL_CODEC_H265
+ * @param[in] bitrate in bits per second
+ * @param[in] interval frame interval to encode at
+ * @param[in] max_peers maximum number of concurrent peers, must be > 0.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT on failure
+ * ** IMPORTANT: the WebRTC Sink implementation requires DS 1.18.0 or later
+ */
+DslReturnType dsl_sink_webrtc_fanout_new(const wchar_t* name, 
+    const wchar_t* stun_server, const wchar_t* turn_server, 
+    uint codec, uint bitrate, uint interval, uint max_peers);
+
+/**
+ * @brief Gets the current peer count and congestion statistics for a 
+ * named WebRTC Fan-out Sink.
+ * @param[in] name unique name of the WebRTC Fan-out Sink to query.
+ * @param[out] peers current number of connected peers.
+ * @param[out] dropped_buffers total number of RTP buffers dropped by 
+ * congested peers since the Sink was created.
+ * @param[out] key_frame_requests total number of key frames requested by
+ * joining and recovering peers since the Sink was created.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SINK_RESULT otherwise.
+ */
+DslReturnType dsl_sink_webrtc_fanout_stats_get(const wchar_t* name, 
+    uint* peers, uint64_t* dropped_buffers, uint64_t* key_frame_requests);
+
 /**
  * @brief Adds a new Websocket Path to be handled by the Websocket Server
  * Note: the server is created with one default Path = "/ws". paths must be added when
@@ -7731,6 +8370,79 @@ DslReturnType dsl_mailer_address_cc_remove_all(const wchar_t* name);
  */
 DslReturnType dsl_mailer_test_message_send(const wchar_t* name);
 
+/**
+ * @brief Gets the current outgoing queue settings for the named Mailer.
+ * @param[in] name unique name of the Mailer to query
+ * @param[out] max_size maximum number of messages the queue will hold.
+ * @param[out] policy current DSL_MAILER_QUEUE_POLICY in use.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_mailer_queue_settings_get(const wchar_t* name,
+    uint* max_size, uint* policy);
+
+/**
+ * @brief Sets the outgoing queue settings for the named Mailer. The policy
+ * is applied when a message is queued while the queue is full.
+ * @param[in] name unique name of the Mailer to update
+ * @param[in] max_size maximum number of messages the queue will hold, > 0.
+ * @param[in] policy one of the DSL_MAILER_QUEUE_POLICY constants.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_mailer_queue_settings_set(const wchar_t* name,
+    uint max_size, uint policy);
+
+/**
+ * @brief Gets the current rate limit for the named Mailer.
+ * @param[in] name unique name of the Mailer to query
+ * @param[out] max_per_minute maximum messages sent per minute, 0 = unlimited.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_mailer_rate_limit_get(const wchar_t* name,
+    uint* max_per_minute);
+
+/**
+ * @brief Sets the rate limit for the named Mailer. Messages in excess of
+ * the limit remain queued until they can be sent.
+ * @param[in] name unique name of the Mailer to update
+ * @param[in] max_per_minute maximum messages sent per minute, 0 = unlimited.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_mailer_rate_limit_set(const wchar_t* name,
+    uint max_per_minute);
+
+/**
+ * @brief Gets the current digest settings for the named Mailer.
+ * @param[in] name unique name of the Mailer to query
+ * @param[out] window digest window in seconds, 0 = disabled.
+ * @param[out] max_messages maximum messages merged into one digest, 0 = no limit.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_mailer_digest_settings_get(const wchar_t* name,
+    uint* window, uint* max_messages);
+
+/**
+ * @brief Sets the digest settings for the named Mailer. When enabled, all 
+ * messages queued with the same subject within the window are merged, with 
+ * their attachments, into a single message.
+ * @param[in] name unique name of the Mailer to update
+ * @param[in] window digest window in seconds, 0 = disabled.
+ * @param[in] max_messages maximum messages merged into one digest, 0 = no limit.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_mailer_digest_settings_set(const wchar_t* name,
+    uint window, uint max_messages);
+
+/**
+ * @brief Gets the delivery statistics for the named Mailer.
+ * @param[in] name unique name of the Mailer to query
+ * @param[out] sent number of messages sent successfully.
+ * @param[out] failed number of messages that failed to send.
+ * @param[out] dropped number of messages dropped on queue overflow.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_mailer_stats_get(const wchar_t* name,
+    uint64_t* sent, uint64_t* failed, uint64_t* dropped);
+
 /**
  * @brief Deletes a SMTP Mailer Object by name.
  * @param[in] name unique name of the Mailer to delete.
@@ -7903,6 +8615,500 @@ DslReturnType dsl_message_broker_delete_all();
  */
 uint dsl_message_broker_list_size();
 
+/**
+ * @brief Gets a handle for a uniquely named ODE Trigger. The handle can be 
+ * passed to the dsl_ode_trigger_*_h services in place of the Trigger's name.
+ * The same handle is returned each time until it is released.
+ * @param[in] name unique name of the ODE Trigger to query.
+ * @param[out] handle handle for the named ODE Trigger.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_ODE_TRIGGER_RESULT
+ * or DSL_RESULT_HANDLE_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_handle_get(const wchar_t* name, DslHandle* handle);
+
+/**
+ * @brief Gets a handle for a uniquely named ODE Action. The handle can be 
+ * passed to the dsl_ode_action_*_h services in place of the Action's name.
+ * @param[in] name unique name of the ODE Action to query.
+ * @param[out] handle handle for the named ODE Action.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_ODE_ACTION_RESULT
+ * or DSL_RESULT_HANDLE_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_handle_get(const wchar_t* name, DslHandle* handle);
+
+/**
+ * @brief Gets a handle for a uniquely named Pad Probe Handler. The handle can 
+ * be passed to the dsl_pph_*_h services in place of the Handler's name.
+ * @param[in] name unique name of the Pad Probe Handler to query.
+ * @param[out] handle handle for the named Pad Probe Handler.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_PPH_RESULT
+ * or DSL_RESULT_HANDLE_RESULT otherwise.
+ */
+DslReturnType dsl_pph_handle_get(const wchar_t* name, DslHandle* handle);
+
+/**
+ * @brief Gets a handle for a uniquely named Source. The handle can be passed 
+ * to the dsl_source_*_h services in place of the Source's name.
+ * @param[in] name unique name of the Source to query.
+ * @param[out] handle handle for the named Source.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_SOURCE_RESULT
+ * or DSL_RESULT_HANDLE_RESULT otherwise.
+ */
+DslReturnType dsl_source_handle_get(const wchar_t* name, DslHandle* handle);
+
+/**
+ * @brief Gets a handle for a uniquely named Sink. The handle can be passed 
+ * to the dsl_sink_*_h services in place of the Sink's name.
+ * @param[in] name unique name of the Sink to query.
+ * @param[out] handle handle for the named Sink.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_SINK_RESULT
+ * or DSL_RESULT_HANDLE_RESULT otherwise.
+ */
+DslReturnType dsl_sink_handle_get(const wchar_t* name, DslHandle* handle);
+
+/**
+ * @brief Releases a handle. The handle, and any copies of it, will no longer
+ * resolve. Handles are also invalidated when their objects are deleted.
+ * @param[in] handle handle to release.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_HANDLE_INVALID if the 
+ * handle is not current.
+ */
+DslReturnType dsl_handle_release(DslHandle handle);
+
+/**
+ * @brief Returns the number of handles currently in use.
+ * @return number of current handles.
+ */
+uint dsl_handle_list_size();
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_enabled_get.
+ * @param[in] handle handle of the ODE Trigger to query.
+ * @param[out] enabled true if the ODE Trigger is currently enabled, false otherwise.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_enabled_get_h(DslHandle handle, boolean* enabled);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_enabled_set.
+ * @param[in] handle handle of the ODE Trigger to update.
+ * @param[in] enabled set to true to enable the ODE Trigger, false to disable.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_enabled_set_h(DslHandle handle, boolean enabled);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_limit_event_get.
+ * @param[in] handle handle of the ODE Trigger to query.
+ * @param[out] limit current event limit for the ODE Trigger.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_limit_event_get_h(DslHandle handle, uint* limit);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_limit_event_set.
+ * @param[in] handle handle of the ODE Trigger to update.
+ * @param[in] limit new event limit for the ODE Trigger.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_limit_event_set_h(DslHandle handle, uint limit);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_interval_get.
+ * @param[in] handle handle of the ODE Trigger to query.
+ * @param[out] interval current frame interval for the ODE Trigger.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_interval_get_h(DslHandle handle, uint* interval);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_interval_set.
+ * @param[in] handle handle of the ODE Trigger to update.
+ * @param[in] interval new frame interval for the ODE Trigger.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_interval_set_h(DslHandle handle, uint interval);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_reset.
+ * @param[in] handle handle of the ODE Trigger to reset.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_reset_h(DslHandle handle);
+
+/**
+ * @brief Handle-based version of dsl_ode_action_enabled_get.
+ * @param[in] handle handle of the ODE Action to query.
+ * @param[out] enabled true if the ODE Action is currently enabled, false otherwise.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_enabled_get_h(DslHandle handle, boolean* enabled);
+
+/**
+ * @brief Handle-based version of dsl_ode_action_enabled_set.
+ * @param[in] handle handle of the ODE Action to update.
+ * @param[in] enabled set to true to enable the ODE Action, false to disable.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_enabled_set_h(DslHandle handle, boolean enabled);
+
+/**
+ * @brief Handle-based version of dsl_pph_enabled_get.
+ * @param[in] handle handle of the Pad Probe Handler to query.
+ * @param[out] enabled true if the Handler is currently enabled, false otherwise.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_PPH_RESULT otherwise.
+ */
+DslReturnType dsl_pph_enabled_get_h(DslHandle handle, boolean* enabled);
+
+/**
+ * @brief Handle-based version of dsl_pph_enabled_set.
+ * @param[in] handle handle of the Pad Probe Handler to update.
+ * @param[in] enabled set to true to enable the Handler, false to disable.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_PPH_RESULT otherwise.
+ */
+DslReturnType dsl_pph_enabled_set_h(DslHandle handle, boolean enabled);
+
+/**
+ * @brief Handle-based version of dsl_source_video_dimensions_get.
+ * @param[in] handle handle of the Source to query.
+ * @param[out] width current width of the Source's output in pixels.
+ * @param[out] height current height of the Source's output in pixels.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_video_dimensions_get_h(DslHandle handle, 
+    uint* width, uint* height);
+
+/**
+ * @brief Handle-based version of dsl_source_frame_rate_get.
+ * @param[in] handle handle of the Source to query.
+ * @param[out] fps_n frames per second numerator.
+ * @param[out] fps_d frames per second denominator.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_frame_rate_get_h(DslHandle handle, 
+    uint* fps_n, uint* fps_d);
+
+/**
+ * @brief Handle-based version of dsl_sink_sync_enabled_get.
+ * @param[in] handle handle of the Sink to query.
+ * @param[out] enabled true if the Sink is synchronized with the clock.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_SINK_RESULT otherwise.
+ */
+DslReturnType dsl_sink_sync_enabled_get_h(DslHandle handle, boolean* enabled);
+
+/**
+ * @brief Handle-based version of dsl_sink_sync_enabled_set.
+ * @param[in] handle handle of the Sink to update.
+ * @param[in] enabled set to true to synchronize the Sink with the clock.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_SINK_RESULT otherwise.
+ */
+DslReturnType dsl_sink_sync_enabled_set_h(DslHandle handle, boolean enabled);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_source_get.
+ * @param[in] handle handle of the ODE Trigger to query.
+ * @param[out] source current Source name filter in use, NULL if disabled.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_source_get_h(DslHandle handle, 
+    const wchar_t** source);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_source_set.
+ * @param[in] handle handle of the ODE Trigger to update.
+ * @param[in] source new Source name to filter on, NULL to disable the filter.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_source_set_h(DslHandle handle, 
+    const wchar_t* source);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_infer_get.
+ * @param[in] handle handle of the ODE Trigger to query.
+ * @param[out] infer current inference component name filter in use, NULL if disabled.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_infer_get_h(DslHandle handle, 
+    const wchar_t** infer);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_infer_set.
+ * @param[in] handle handle of the ODE Trigger to update.
+ * @param[in] infer new inference component name to filter on, NULL to disable the filter.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_infer_set_h(DslHandle handle, 
+    const wchar_t* infer);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_class_id_get.
+ * @param[in] handle handle of the ODE Trigger to query.
+ * @param[out] class_id current class id filter in use.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_class_id_get_h(DslHandle handle, uint* class_id);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_class_id_set.
+ * @param[in] handle handle of the ODE Trigger to update.
+ * @param[in] class_id new class id to filter on.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_class_id_set_h(DslHandle handle, uint class_id);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_limit_frame_get.
+ * @param[in] handle handle of the ODE Trigger to query.
+ * @param[out] limit current frame limit for the ODE Trigger.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_limit_frame_get_h(DslHandle handle, uint* limit);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_limit_frame_set.
+ * @param[in] handle handle of the ODE Trigger to update.
+ * @param[in] limit new frame limit for the ODE Trigger.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_limit_frame_set_h(DslHandle handle, uint limit);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_reset_timeout_get.
+ * @param[in] handle handle of the ODE Trigger to query.
+ * @param[out] timeout current reset timeout in seconds, 0 if disabled.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_reset_timeout_get_h(DslHandle handle, 
+    uint* timeout);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_reset_timeout_set.
+ * @param[in] handle handle of the ODE Trigger to update.
+ * @param[in] timeout new reset timeout in seconds, 0 to disable.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_reset_timeout_set_h(DslHandle handle, 
+    uint timeout);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_infer_confidence_min_get.
+ * @param[in] handle handle of the ODE Trigger to query.
+ * @param[out] min_confidence current minimum inference confidence filter, 0 if disabled.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_infer_confidence_min_get_h(DslHandle handle, 
+    float* min_confidence);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_infer_confidence_min_set.
+ * @param[in] handle handle of the ODE Trigger to update.
+ * @param[in] min_confidence new minimum inference confidence filter, 0 to disable.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_infer_confidence_min_set_h(DslHandle handle, 
+    float min_confidence);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_infer_confidence_max_get.
+ * @param[in] handle handle of the ODE Trigger to query.
+ * @param[out] max_confidence current maximum inference confidence filter, 0 if disabled.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_infer_confidence_max_get_h(DslHandle handle, 
+    float* max_confidence);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_infer_confidence_max_set.
+ * @param[in] handle handle of the ODE Trigger to update.
+ * @param[in] max_confidence new maximum inference confidence filter, 0 to disable.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_infer_confidence_max_set_h(DslHandle handle, 
+    float max_confidence);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_tracker_confidence_min_get.
+ * @param[in] handle handle of the ODE Trigger to query.
+ * @param[out] min_confidence current minimum Tracker confidence filter, 0 if disabled.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_tracker_confidence_min_get_h(DslHandle handle, 
+    float* min_confidence);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_tracker_confidence_min_set.
+ * @param[in] handle handle of the ODE Trigger to update.
+ * @param[in] min_confidence new minimum Tracker confidence filter, 0 to disable.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_tracker_confidence_min_set_h(DslHandle handle, 
+    float min_confidence);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_tracker_confidence_max_get.
+ * @param[in] handle handle of the ODE Trigger to query.
+ * @param[out] max_confidence current maximum Tracker confidence filter, 0 if disabled.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_tracker_confidence_max_get_h(DslHandle handle, 
+    float* max_confidence);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_tracker_confidence_max_set.
+ * @param[in] handle handle of the ODE Trigger to update.
+ * @param[in] max_confidence new maximum Tracker confidence filter, 0 to disable.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_tracker_confidence_max_set_h(DslHandle handle, 
+    float max_confidence);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_dimensions_min_get.
+ * @param[in] handle handle of the ODE Trigger to query.
+ * @param[out] min_width current minimum width in pixels, 0 if disabled.
+ * @param[out] min_height current minimum height in pixels, 0 if disabled.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_dimensions_min_get_h(DslHandle handle, 
+    float* min_width, float* min_height);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_dimensions_min_set.
+ * @param[in] handle handle of the ODE Trigger to update.
+ * @param[in] min_width new minimum width in pixels, 0 to disable.
+ * @param[in] min_height new minimum height in pixels, 0 to disable.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_dimensions_min_set_h(DslHandle handle, 
+    float min_width, float min_height);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_dimensions_max_get.
+ * @param[in] handle handle of the ODE Trigger to query.
+ * @param[out] max_width current maximum width in pixels, 0 if disabled.
+ * @param[out] max_height current maximum height in pixels, 0 if disabled.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_dimensions_max_get_h(DslHandle handle, 
+    float* max_width, float* max_height);
+
+/**
+ * @brief Handle-based version of dsl_ode_trigger_dimensions_max_set.
+ * @param[in] handle handle of the ODE Trigger to update.
+ * @param[in] max_width new maximum width in pixels, 0 to disable.
+ * @param[in] max_height new maximum height in pixels, 0 to disable.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_dimensions_max_set_h(DslHandle handle, 
+    float max_width, float max_height);
+
+/**
+ * @brief Handle-based version of dsl_pph_meter_interval_get.
+ * @param[in] handle handle of the Meter PPH to query.
+ * @param[out] interval current reporting interval in seconds.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_PPH_RESULT otherwise.
+ */
+DslReturnType dsl_pph_meter_interval_get_h(DslHandle handle, uint* interval);
+
+/**
+ * @brief Handle-based version of dsl_pph_meter_interval_set.
+ * @param[in] handle handle of the Meter PPH to update.
+ * @param[in] interval new reporting interval in seconds, must be greater than 0.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_PPH_RESULT otherwise.
+ */
+DslReturnType dsl_pph_meter_interval_set_h(DslHandle handle, uint interval);
+
+/**
+ * @brief Handle-based version of dsl_pph_latency_segment_stats_get.
+ * @param[in] handle handle of the Latency PPH to query.
+ * @param[in] segment index of the segment to query, 0 to count-1.
+ * @param[out] stats latency statistics for the segment in microseconds.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_PPH_RESULT otherwise.
+ */
+DslReturnType dsl_pph_latency_segment_stats_get_h(DslHandle handle, 
+    uint segment, dsl_latency_stats* stats);
+
+/**
+ * @brief Handle-based version of dsl_source_is_live.
+ * @param[in] handle handle of the Source to query.
+ * @param[out] is_live true if the Source's stream is live, false otherwise.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_is_live_h(DslHandle handle, boolean* is_live);
+
+/**
+ * @brief Handle-based version of dsl_sink_app_queue_stats_get.
+ * @param[in] handle handle of the App Sink to query.
+ * @param[out] depth current number of samples in the queue.
+ * @param[out] high_water largest queue depth since last cleared.
+ * @param[out] dropped number of samples dropped since last cleared.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_HANDLE_RESULT
+ * or DSL_RESULT_SINK_RESULT otherwise.
+ */
+DslReturnType dsl_sink_app_queue_stats_get_h(DslHandle handle, 
+    uint* depth, uint* high_water, uint64_t* dropped);
+
+/**
+ * @brief Loads a JSON configuration file describing any number of ODE Actions,
+ * ODE Areas, ODE Triggers, Pad Probe Handlers, Components, and Pipelines, and 
+ * the relationships between them. The file is loaded as a single transaction;
+ * if any item fails to validate or create, no objects are created and all
+ * existing objects are left unchanged.
+ * @param[in] file_path absolute or relative path to the configuration file.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_CONFIG_RESULT 
+ * otherwise.
+ */
+DslReturnType dsl_config_file_load(const wchar_t* file_path);
+
+/**
+ * @brief Loads a JSON configuration string, see dsl_config_file_load.
+ * @param[in] config JSON configuration document to load.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_CONFIG_RESULT 
+ * otherwise.
+ */
+DslReturnType dsl_config_string_load(const wchar_t* config);
+
 /**
  * @brief entry point to the GST Main Loop
  * Note: This is a blocking call - executes an endless loop
@@ -8040,6 +9246,26 @@ DslReturnType dsl_info_log_file_set_with_ts(const wchar_t* file_path);
  */
 DslReturnType dsl_info_log_function_restore();
 
+/**
+ * @brief Gets the current async logging setting. When enabled, DSL log
+ * messages are queued and written to the current log function by a 
+ * background writer-thread. Async logging can also be enabled by setting
+ * the DSL_LOG_ASYNC environment variable to 1.
+ * @param[out] enabled true if async logging is enabled, false otherwise.
+ * @return true on successful query, one of DSL_RESULT otherwise.
+ */
+DslReturnType dsl_info_log_async_enabled_get(boolean* enabled);
+
+/**
+ * @brief Sets the async logging setting. Disabling async logging will
+ * write all queued messages before returning.
+ * @param[in] enabled set to true to enable async logging, false to disable.
+ * @return true on successful update, one of DSL_RESULT otherwise.
+ * @note when enabled, the GST log thread-id and timestamp of each DSL 
+ * message are those of the writer-thread, not of the calling thread.
+ */
+DslReturnType dsl_info_log_async_enabled_set(boolean enabled);
+
 
 EXTERN_C_END
 
@@ -162,6 +162,17 @@ namespace DSL
             return m_parentName == pParent->GetName();
         }
 
+        /**
+         * @brief Returns this Object's parent name, empty if not "In-Use"
+         * @return current parent name
+         */
+        const std::string& GetParentName()
+        {
+            LOG_FUNC();
+            
+            return m_parentName;
+        }
+
         /**
          * @brief Assigns this Object's parent name. Having a Parent name
          * indicates that the Object is "In-Use"
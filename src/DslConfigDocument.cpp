@@ -0,0 +1,338 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslConfigDocument.h"
+
+namespace DSL
+{
+    bool ConfigItem::CheckMembers(const std::vector<ConfigMember>& members)
+    {
+        LOG_FUNC();
+        
+        bool valid(true);
+        std::vector<std::string> allowed;
+        
+        for (auto& member: members)
+        {
+            allowed.push_back(member.m_name);
+            
+            bool present(false), correctKind(false);
+            switch (member.m_kind)
+            {
+            case DSL_CONFIG_MEMBER_STRING :
+                present = m_strings.count(member.m_name);
+                break;
+            case DSL_CONFIG_MEMBER_UINT :
+                present = m_uints.count(member.m_name);
+                break;
+            case DSL_CONFIG_MEMBER_BOOL :
+                present = m_bools.count(member.m_name);
+                break;
+            default :
+                present = m_lists.count(member.m_name);
+                break;
+            }
+            correctKind = present;
+            if (!present)
+            {
+                present = m_strings.count(member.m_name) or 
+                    m_uints.count(member.m_name) or
+                    m_bools.count(member.m_name) or 
+                    m_lists.count(member.m_name);
+            }
+            if (present and !correctKind)
+            {
+                LOG_ERROR("Member '" << member.m_name << "' of " << m_section 
+                    << " item '" << m_name << "' has the wrong value type");
+                valid = false;
+            }
+            else if (!present and member.m_required)
+            {
+                LOG_ERROR("Required member '" << member.m_name << "' of " 
+                    << m_section << " item '" << m_name << "' is missing");
+                valid = false;
+            }
+        }
+        
+        // every member of the item must be known for its type
+        std::vector<std::string> names;
+        for (auto& imap: m_strings) names.push_back(imap.first);
+        for (auto& imap: m_uints) names.push_back(imap.first);
+        for (auto& imap: m_bools) names.push_back(imap.first);
+        for (auto& imap: m_lists) names.push_back(imap.first);
+        
+        for (auto& name: names)
+        {
+            if (std::find(allowed.begin(), allowed.end(), name) == allowed.end())
+            {
+                LOG_ERROR("Unknown member '" << name << "' for " << m_section 
+                    << " item '" << m_name << "' of type '" << m_type << "'");
+                valid = false;
+            }
+        }
+        return valid;
+    }
+    
+    std::string ConfigItem::GetString(const char* member, const char* defValue)
+    {
+        auto iter = m_strings.find(member);
+        return (iter == m_strings.end()) ? defValue : iter->second;
+    }
+    
+    uint ConfigItem::GetUint(const char* member, uint defValue)
+    {
+        auto iter = m_uints.find(member);
+        return (iter == m_uints.end()) ? defValue : iter->second;
+    }
+    
+    bool ConfigItem::GetBool(const char* member, bool defValue)
+    {
+        auto iter = m_bools.find(member);
+        return (iter == m_bools.end()) ? defValue : iter->second;
+    }
+    
+    std::vector<std::string> ConfigItem::GetList(const char* member)
+    {
+        auto iter = m_lists.find(member);
+        return (iter == m_lists.end()) ? std::vector<std::string>() : iter->second;
+    }
+    
+    //----------------------------------------------------------------------------
+    
+    const std::vector<std::string> ConfigDocument::SECTIONS = 
+        {"actions", "areas", "triggers", "pphs", "components", "pipelines"};
+    
+    ConfigDocument::ConfigDocument()
+    {
+        LOG_FUNC();
+    }
+    
+    ConfigDocument::~ConfigDocument()
+    {
+        LOG_FUNC();
+    }
+    
+    bool ConfigDocument::Parse(const std::string& config)
+    {
+        LOG_FUNC();
+        
+        m_sections.clear();
+        
+        JsonParser* pParser = json_parser_new();
+        GError* pError(NULL);
+        
+        if (!json_parser_load_from_data(pParser, config.c_str(), -1, &pError))
+        {
+            LOG_ERROR("Failed to parse configuration: " << pError->message);
+            g_error_free(pError);
+            g_object_unref(pParser);
+            return false;
+        }
+        JsonNode* pRoot = json_parser_get_root(pParser);
+        if (!pRoot or !JSON_NODE_HOLDS_OBJECT(pRoot))
+        {
+            LOG_ERROR("Configuration root must be a JSON object");
+            g_object_unref(pParser);
+            return false;
+        }
+        JsonObject* pRootObject = json_node_get_object(pRoot);
+        
+        bool valid(true);
+        GList* pMembers = json_object_get_members(pRootObject);
+        for (GList* pIter = pMembers; pIter and valid; pIter = pIter->next)
+        {
+            std::string section((const char*)pIter->data);
+            
+            if (std::find(SECTIONS.begin(), SECTIONS.end(), section) == SECTIONS.end())
+            {
+                LOG_ERROR("Unknown configuration section '" << section << "'");
+                valid = false;
+                break;
+            }
+            JsonNode* pSection = json_object_get_member(pRootObject, 
+                section.c_str());
+            if (!JSON_NODE_HOLDS_ARRAY(pSection))
+            {
+                LOG_ERROR("Configuration section '" << section 
+                    << "' must be an array");
+                valid = false;
+                break;
+            }
+            JsonArray* pArray = json_node_get_array(pSection);
+            std::vector<ConfigItem>& items = m_sections[section];
+            
+            for (uint i = 0; i < json_array_get_length(pArray); i++)
+            {
+                items.push_back(ConfigItem(section));
+                if (!parseItem(json_array_get_element(pArray, i), items.back()))
+                {
+                    valid = false;
+                    break;
+                }
+                for (uint j = 0; j < items.size()-1; j++)
+                {
+                    if (items[j].m_name == items.back().m_name)
+                    {
+                        LOG_ERROR("Name '" << items.back().m_name 
+                            << "' is not unique in configuration section '" 
+                            << section << "'");
+                        valid = false;
+                        break;
+                    }
+                }
+                if (!valid)
+                {
+                    break;
+                }
+            }
+        }
+        g_list_free(pMembers);
+        g_object_unref(pParser);
+        
+        if (!valid)
+        {
+            m_sections.clear();
+        }
+        return valid;
+    }
+    
+    bool ConfigDocument::parseItem(JsonNode* pNode, ConfigItem& item)
+    {
+        LOG_FUNC();
+        
+        if (!JSON_NODE_HOLDS_OBJECT(pNode))
+        {
+            LOG_ERROR("Items of configuration section '" << item.m_section 
+                << "' must be objects");
+            return false;
+        }
+        JsonObject* pObject = json_node_get_object(pNode);
+        
+        bool valid(true);
+        GList* pMembers = json_object_get_members(pObject);
+        for (GList* pIter = pMembers; pIter and valid; pIter = pIter->next)
+        {
+            std::string member((const char*)pIter->data);
+            JsonNode* pMember = json_object_get_member(pObject, member.c_str());
+            
+            if (JSON_NODE_HOLDS_VALUE(pMember))
+            {
+                GType valueType = json_node_get_value_type(pMember);
+                
+                if (valueType == G_TYPE_STRING)
+                {
+                    item.m_strings[member] = json_node_get_string(pMember);
+                    continue;
+                }
+                if (valueType == G_TYPE_BOOLEAN)
+                {
+                    item.m_bools[member] = json_node_get_boolean(pMember);
+                    continue;
+                }
+                if (valueType == G_TYPE_INT64)
+                {
+                    gint64 value = json_node_get_int(pMember);
+                    if (value >= 0 and value <= UINT32_MAX)
+                    {
+                        item.m_uints[member] = (uint)value;
+                        continue;
+                    }
+                }
+            }
+            else if (JSON_NODE_HOLDS_ARRAY(pMember))
+            {
+                JsonArray* pArray = json_node_get_array(pMember);
+                std::vector<std::string>& list = item.m_lists[member];
+                
+                for (uint i = 0; i < json_array_get_length(pArray); i++)
+                {
+                    JsonNode* pElement = json_array_get_element(pArray, i);
+                    if (!JSON_NODE_HOLDS_VALUE(pElement) or
+                        json_node_get_value_type(pElement) != G_TYPE_STRING)
+                    {
+                        valid = false;
+                        break;
+                    }
+                    list.push_back(json_node_get_string(pElement));
+                }
+                if (valid)
+                {
+                    continue;
+                }
+            }
+            LOG_ERROR("Member '" << member << "' of configuration section '"
+                << item.m_section << "' has an unsupported value");
+            valid = false;
+        }
+        g_list_free(pMembers);
+        
+        if (!valid)
+        {
+            return false;
+        }
+        
+        // name and type are held apart from the other members
+        if (!item.m_strings.count("name") or !item.m_strings["name"].size())
+        {
+            LOG_ERROR("Item of configuration section '" << item.m_section
+                << "' is missing its 'name'");
+            return false;
+        }
+        item.m_name = item.m_strings["name"];
+        item.m_strings.erase("name");
+        
+        if (item.m_strings.count("type"))
+        {
+            item.m_type = item.m_strings["type"];
+            item.m_strings.erase("type");
+        }
+        else if (item.m_section != "pipelines")
+        {
+            LOG_ERROR("Item '" << item.m_name << "' of configuration section '" 
+                << item.m_section << "' is missing its 'type'");
+            return false;
+        }
+        return true;
+    }
+    
+    std::vector<ConfigItem>& ConfigDocument::GetSection(const std::string& section)
+    {
+        LOG_FUNC();
+        
+        return m_sections[section];
+    }
+    
+    uint ConfigDocument::GetItemCount()
+    {
+        LOG_FUNC();
+        
+        uint count(0);
+        for (auto& imap: m_sections)
+        {
+            count += imap.second.size();
+        }
+        return count;
+    }
+}
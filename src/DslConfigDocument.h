@@ -0,0 +1,210 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_CONFIG_DOCUMENT_H
+#define _DSL_CONFIG_DOCUMENT_H
+
+#include <json-glib/json-glib.h>
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @brief Value kinds for the members of a configuration item.
+     */
+    #define DSL_CONFIG_MEMBER_STRING                            0
+    #define DSL_CONFIG_MEMBER_UINT                              1
+    #define DSL_CONFIG_MEMBER_BOOL                              2
+    #define DSL_CONFIG_MEMBER_LIST                              3
+
+    /**
+     * @struct ConfigMember
+     * @brief Describes one member that an item of a given type may have.
+     */
+    struct ConfigMember
+    {
+        const char* m_name;
+        uint m_kind;
+        bool m_required;
+    };
+
+    /**
+     * @class ConfigItem
+     * @brief One named object in a configuration document. The item's 
+     * members are copied out of the JSON tree on parse, so an item remains 
+     * valid after its document is destroyed.
+     */
+    class ConfigItem
+    {
+    public:
+    
+        /**
+         * @brief ctor for the ConfigItem class
+         * @param[in] section name of the document section holding the item.
+         */
+        ConfigItem(const std::string& section)
+            : m_section(section)
+        {};
+        
+        /**
+         * @brief Checks the item's members against the members allowed for 
+         * its type. Unknown members, members of the wrong kind, and missing
+         * required members are logged as errors.
+         * @param[in] members all members allowed for the item's type.
+         * @return true if the item's members are valid, false otherwise.
+         */
+        bool CheckMembers(const std::vector<ConfigMember>& members);
+        
+        /**
+         * @brief Gets a string member.
+         * @param[in] member name of the member to get.
+         * @param[in] defValue value to return if the member is not present.
+         * @return value of the member, or defValue.
+         */
+        std::string GetString(const char* member, const char* defValue="");
+        
+        /**
+         * @brief Gets an unsigned integer member.
+         * @param[in] member name of the member to get.
+         * @param[in] defValue value to return if the member is not present.
+         * @return value of the member, or defValue.
+         */
+        uint GetUint(const char* member, uint defValue=0);
+        
+        /**
+         * @brief Gets a boolean member.
+         * @param[in] member name of the member to get.
+         * @param[in] defValue value to return if the member is not present.
+         * @return value of the member, or defValue.
+         */
+        bool GetBool(const char* member, bool defValue=false);
+
+        /**
+         * @brief Gets a list-of-names member.
+         * @param[in] member name of the member to get.
+         * @return value of the member, or an empty list if not present.
+         */
+        std::vector<std::string> GetList(const char* member);
+
+        /**
+         * @brief name of the document section holding the item.
+         */
+        std::string m_section;
+        
+        /**
+         * @brief unique name of the object to create.
+         */
+        std::string m_name;
+        
+        /**
+         * @brief type of the object to create, e.g. "occurrence".
+         */
+        std::string m_type;
+
+        /**
+         * @brief string members, key=member name.
+         */
+        std::map<std::string, std::string> m_strings;
+
+        /**
+         * @brief non-negative integer members, key=member name.
+         */
+        std::map<std::string, uint> m_uints;
+
+        /**
+         * @brief boolean members, key=member name.
+         */
+        std::map<std::string, bool> m_bools;
+
+        /**
+         * @brief list-of-names members, key=member name.
+         */
+        std::map<std::string, std::vector<std::string>> m_lists;
+    };
+
+    /**
+     * @class ConfigDocument
+     * @brief Parses a JSON configuration document into lists of ConfigItems,
+     * one list per section. A document is an object with any of the sections
+     * "actions", "areas", "triggers", "pphs", "components", and "pipelines",
+     * each an array of objects with a unique "name", a "type", and any number
+     * of string, non-negative integer, boolean, and list-of-names members.
+     */
+    class ConfigDocument
+    {
+    public:
+    
+        /**
+         * @brief ctor for the ConfigDocument class
+         */
+        ConfigDocument();
+        
+        /**
+         * @brief dtor for the ConfigDocument class
+         */
+        ~ConfigDocument();
+        
+        /**
+         * @brief Parses a JSON configuration document.
+         * @param[in] config JSON string to parse.
+         * @return true if the document is well formed, false otherwise.
+         */
+        bool Parse(const std::string& config);
+        
+        /**
+         * @brief Returns the items of a document section, in document order.
+         * @param[in] section name of the section to get.
+         * @return items of the section, empty if the section is not present.
+         */
+        std::vector<ConfigItem>& GetSection(const std::string& section);
+        
+        /**
+         * @brief Returns the total number of items over all sections.
+         */
+        uint GetItemCount();
+        
+        /**
+         * @brief names of all sections in the order they must be created.
+         */
+        static const std::vector<std::string> SECTIONS;
+        
+    private:
+    
+        /**
+         * @brief Parses one item of a section.
+         * @param[in] pNode JSON node for the item.
+         * @param[out] item item to update.
+         * @return true if the item is well formed, false otherwise.
+         */
+        bool parseItem(JsonNode* pNode, ConfigItem& item);
+        
+        /**
+         * @brief items of each section, key=section name.
+         */
+        std::map<std::string, std::vector<ConfigItem>> m_sections;
+    };
+}
+
+#endif // _DSL_CONFIG_DOCUMENT_H
@@ -182,6 +182,289 @@ namespace DSL
     
     // ********************************************************************
 
+    void DisplayMetaAllocator::Reset(std::vector<NvDsDisplayMeta*>& displayMetaData,
+        uint maxSize)
+    {
+        // Do not log function entry - called for every frame
+
+        // The size is the limit, with NULL for each structure not acquired.
+        displayMetaData.assign(maxSize, NULL);
+    }
+    
+    bool DisplayMetaAllocator::IsEnabled(
+        const std::vector<NvDsDisplayMeta*>& displayMetaData)
+    {
+        return displayMetaData.size() > 0;
+    }
+
+    NvDsDisplayMeta* DisplayMetaAllocator::Get(
+        std::vector<NvDsDisplayMeta*>& displayMetaData, NvDsFrameMeta* pFrameMeta, 
+        uint elementType, uint count)
+    {
+        // Do not log function entry - called for every element added
+
+        NvDsDisplayMeta** ppFreeEntry(NULL);
+        
+        for (auto& ivec: displayMetaData)
+        {
+            if (!ivec)
+            {
+                if (!ppFreeEntry)
+                {
+                    ppFreeEntry = &ivec;
+                }
+                continue;
+            }
+            guint numElements(0);
+            switch (elementType)
+            {
+            case DISPLAY_META_LABELS :
+                numElements = ivec->num_labels;
+                break;
+            case DISPLAY_META_LINES :
+                numElements = ivec->num_lines;
+                break;
+            case DISPLAY_META_ARROWS :
+                numElements = ivec->num_arrows;
+                break;
+            case DISPLAY_META_RECTS :
+                numElements = ivec->num_rects;
+                break;
+            case DISPLAY_META_CIRCLES :
+                numElements = ivec->num_circles;
+                break;
+            }
+            if (numElements + count <= MAX_ELEMENTS_IN_DISPLAY_META)
+            {
+                return ivec;
+            }
+        }
+        // All full - acquire a new Display Meta unless at the maximum
+        if (!ppFreeEntry or !pFrameMeta or !pFrameMeta->base_meta.batch_meta)
+        {
+            return NULL;
+        }
+        NvDsBatchMeta* pBatchMeta = pFrameMeta->base_meta.batch_meta;
+        
+        // The pool is shared by all frames in the batch - which may be 
+        // processed on different ODE Handler worker threads.
+        nvds_acquire_meta_lock(pBatchMeta);
+        *ppFreeEntry = nvds_acquire_display_meta_from_pool(pBatchMeta);
+        nvds_release_meta_lock(pBatchMeta);
+        
+        return *ppFreeEntry;
+    }
+    
+    // ********************************************************************
+
+    gchar DisplayStringPool::m_pool[DSL_DISPLAY_STRING_POOL_SIZE];
+    
+    uint DisplayStringPool::m_poolUsed(0);
+    
+    std::unordered_map<std::string, const gchar*> DisplayStringPool::m_index;
+    
+    GMutex DisplayStringPool::m_poolMutex;
+
+    const gchar* DisplayStringPool::Intern(const std::string& str)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+        
+        auto ipool = m_index.find(str);
+        if (ipool != m_index.end())
+        {
+            return ipool->second;
+        }
+        if (m_poolUsed + str.size() + 1 > DSL_DISPLAY_STRING_POOL_SIZE)
+        {
+            LOG_WARN("Display string pool exhausted - '" << str 
+                << "' will be copied for each frame");
+            return NULL;
+        }
+        gchar* pStr = &m_pool[m_poolUsed];
+        str.copy(pStr, str.size(), 0);
+        pStr[str.size()] = 0;
+        m_poolUsed += str.size() + 1;
+        
+        m_index[str] = pStr;
+        return pStr;
+    }
+    
+    bool DisplayStringPool::IsPooled(const gchar* str)
+    {
+        // No function log - called for every label released
+        
+        return (str >= m_pool and str < m_pool + DSL_DISPLAY_STRING_POOL_SIZE);
+    }
+
+    // ********************************************************************
+
+    gchar DisplayTextArena::m_slots[DSL_DISPLAY_TEXT_ARENA_SLOTS][MAX_DISPLAY_LEN];
+    
+    uint DisplayTextArena::m_freeSlots[DSL_DISPLAY_TEXT_ARENA_SLOTS];
+    
+    bool DisplayTextArena::m_slotInUse[DSL_DISPLAY_TEXT_ARENA_SLOTS];
+    
+    uint DisplayTextArena::m_freeCount(0);
+    
+    uint DisplayTextArena::m_slotsUnused(0);
+    
+    std::atomic<NvDsMetaReleaseFunc> DisplayTextArena::m_originalRelease(NULL);
+    
+    std::atomic<uint64_t> DisplayTextArena::m_heapFallbacks(0);
+    
+    GMutex DisplayTextArena::m_arenaMutex;
+
+    gchar* DisplayTextArena::Assign(NvDsDisplayMeta* pDisplayMeta, 
+        const char* text, const gchar* pInterned)
+    {
+        // No function log - called for every label added
+        
+        gchar* pText(NULL);
+        
+        if (pDisplayMeta and wrapRelease(pDisplayMeta))
+        {
+            if (pInterned)
+            {
+                return (gchar*)pInterned;
+            }
+            pText = acquireSlot();
+        }
+        if (!pText)
+        {
+            m_heapFallbacks++;
+            pText = (gchar*) g_malloc0(MAX_DISPLAY_LEN);
+        }
+        g_strlcpy(pText, (text) ? text : "", MAX_DISPLAY_LEN);
+        
+        return pText;
+    }
+    
+    bool DisplayTextArena::IsArenaOwned(const gchar* str)
+    {
+        // No function log - called for every label released
+        
+        return (str >= m_slots[0] and 
+            str < m_slots[0] + sizeof(m_slots));
+    }
+    
+    uint DisplayTextArena::GetSlotsInUse()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_arenaMutex);
+        
+        return m_slotsUnused - m_freeCount;
+    }
+    
+    uint64_t DisplayTextArena::GetHeapFallbacks()
+    {
+        return m_heapFallbacks;
+    }
+    
+    bool DisplayTextArena::wrapRelease(NvDsDisplayMeta* pDisplayMeta)
+    {
+        NvDsMetaReleaseFunc releaseFunc = pDisplayMeta->base_meta.release_func;
+        
+        if (releaseFunc == releaseDisplayMeta)
+        {
+            return true;
+        }
+        if (!releaseFunc)
+        {
+            return false;
+        }
+        
+        // The first release function seen is the one DeepStream installs 
+        // for all Display Meta in the pool. Anything else is left alone. 
+        NvDsMetaReleaseFunc expected(NULL);
+        if (!m_originalRelease.compare_exchange_strong(expected, releaseFunc) and
+            expected != releaseFunc)
+        {
+            return false;
+        }
+        pDisplayMeta->base_meta.release_func = releaseDisplayMeta;
+        return true;
+    }
+    
+    void DisplayTextArena::releaseDisplayMeta(gpointer data, gpointer user_data)
+    {
+        // No function log - called for every Display Meta released
+        
+        NvDsDisplayMeta* pDisplayMeta = (NvDsDisplayMeta*)data;
+        
+        for (uint i = 0; i < pDisplayMeta->num_labels and 
+            i < MAX_ELEMENTS_IN_DISPLAY_META; i++)
+        {
+            NvOSD_TextParams* pTextParams = &pDisplayMeta->text_params[i];
+            
+            if (IsArenaOwned(pTextParams->display_text))
+            {
+                releaseSlot(pTextParams->display_text);
+                pTextParams->display_text = NULL;
+            }
+            else if (DisplayStringPool::IsPooled(pTextParams->display_text))
+            {
+                pTextParams->display_text = NULL;
+            }
+            if (IsArenaOwned(pTextParams->font_params.font_name))
+            {
+                releaseSlot(pTextParams->font_params.font_name);
+                pTextParams->font_params.font_name = NULL;
+            }
+            else if (DisplayStringPool::IsPooled(pTextParams->font_params.font_name))
+            {
+                pTextParams->font_params.font_name = NULL;
+            }
+        }
+        NvDsMetaReleaseFunc originalRelease = m_originalRelease;
+        if (originalRelease)
+        {
+            originalRelease(data, user_data);
+        }
+    }
+    
+    gchar* DisplayTextArena::acquireSlot()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_arenaMutex);
+        
+        uint slot(0);
+        if (m_freeCount)
+        {
+            slot = m_freeSlots[--m_freeCount];
+        }
+        else if (m_slotsUnused < DSL_DISPLAY_TEXT_ARENA_SLOTS)
+        {
+            slot = m_slotsUnused++;
+        }
+        else
+        {
+            return NULL;
+        }
+        m_slotInUse[slot] = true;
+        return m_slots[slot];
+    }
+    
+    void DisplayTextArena::releaseSlot(gchar* pSlot)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_arenaMutex);
+        
+        ptrdiff_t offset = pSlot - m_slots[0];
+        uint slot = offset / MAX_DISPLAY_LEN;
+        
+        // Only the start of a slot that is currently in use can be released.
+        // Pushing any other would overflow the free stack, or hand the same 
+        // slot to two labels.
+        if (offset < 0 or offset % MAX_DISPLAY_LEN or 
+            slot >= m_slotsUnused or !m_slotInUse[slot])
+        {
+            LOG_ERROR("Invalid release of Display Text Arena slot at offset " 
+                << offset << " - ignoring");
+            return;
+        }
+        m_slotInUse[slot] = false;
+        m_freeSlots[m_freeCount++] = slot;
+    }
+    
+    // ********************************************************************
+
     RgbaColor::RgbaColor(const char* name, 
         double red, double green, double blue, double alpha)
         : DisplayType(name)
@@ -375,6 +658,9 @@ namespace DSL
         , NvOSD_FontParams{NULL, size, *color}
     {
         LOG_FUNC();
+        
+        // font_name references the shared, immutable copy - NULL if exhausted
+        font_name = (gchar*)DisplayStringPool::Intern(m_fontName);
     }
 
     RgbaFont::~RgbaFont()
@@ -409,6 +695,10 @@ namespace DSL
         , m_shadowYOffset(0)
     {
         LOG_FUNC();
+        
+        // Static text is interned, as displayed, to be shared by all labels
+        m_pInternedText = DisplayStringPool::Intern(
+            m_text.substr(0, MAX_DISPLAY_LEN-1));
     }
 
     RgbaText::~RgbaText()
@@ -453,18 +743,18 @@ namespace DSL
     {
 //        LOG_FUNC();
 
-        // check to see if we're adding meta data - client can disable
-        // by setting the PPH ODE display meta alloc size to 0.
-        // and ensure we have available space in the vector of meta structs.
-        NvDsDisplayMeta* pDisplayMeta(NULL);
-        for (const auto& ivec: displayMetaData)
-        {
-            if (ivec->num_labels < MAX_ELEMENTS_IN_DISPLAY_META)
-            {
-                pDisplayMeta = ivec;
-                break;
-            }
-        }
+        addLabelMeta(displayMetaData, pFrameMeta, m_text.c_str(), m_pInternedText);
+    }
+
+    void RgbaText::addLabelMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        NvDsFrameMeta* pFrameMeta, const char* text, const gchar* pInterned)
+    {
+        // get a Display Meta with available slots - two if shadowed - acquired 
+        // on demand. Client can disable by setting the PPH ODE display meta 
+        // alloc size to 0.
+        NvDsDisplayMeta* pDisplayMeta = DisplayMetaAllocator::Get(displayMetaData, 
+            pFrameMeta, DisplayMetaAllocator::DISPLAY_META_LABELS, 
+            (m_shadowEnabled) ? 2 : 1);
         if (!pDisplayMeta)
         {
             return;
@@ -481,16 +771,15 @@ namespace DSL
             pTextParams->set_bg_clr = true;
             pTextParams->text_bg_clr = *m_pShadowColor;
 
-            // need to allocate storage for actual text, then copy.
-            pTextParams->display_text = (gchar*) g_malloc0(MAX_DISPLAY_LEN);
-            m_text.copy(pTextParams->display_text, MAX_DISPLAY_LEN, 0);
+            // shared interned text, or a copy released with the batch.
+            pTextParams->display_text = 
+                DisplayTextArena::Assign(pDisplayMeta, text, pInterned);
 
             pTextParams->font_params = *m_pShadowFont;
             // Font, font-size, font-color
-            pTextParams->font_params.font_name = (gchar*) g_malloc0(MAX_DISPLAY_LEN);
-            m_pShadowFont->m_fontName.copy(pTextParams->font_params.font_name, 
-                MAX_DISPLAY_LEN, 0);
-                
+            pTextParams->font_params.font_name = DisplayTextArena::Assign(
+                pDisplayMeta, m_pShadowFont->m_fontName.c_str(), 
+                m_pShadowFont->font_name);
         }
         NvOSD_TextParams *pTextParams = &pDisplayMeta->
             text_params[pDisplayMeta->num_labels++];
@@ -500,14 +789,13 @@ namespace DSL
         *pTextParams = *this;
         Unlock();
         
-        // need to allocate storage for actual text, then copy.
-        pTextParams->display_text = (gchar*) g_malloc0(MAX_DISPLAY_LEN);
-        m_text.copy(pTextParams->display_text, MAX_DISPLAY_LEN, 0);
+        // shared interned text, or a copy released with the batch.
+        pTextParams->display_text = 
+            DisplayTextArena::Assign(pDisplayMeta, text, pInterned);
         
         // Font, font-size, font-color
-        pTextParams->font_params.font_name = (gchar*) g_malloc0(MAX_DISPLAY_LEN);
-        m_pFont->m_fontName.copy(pTextParams->font_params.font_name, 
-            MAX_DISPLAY_LEN, 0);
+        pTextParams->font_params.font_name = DisplayTextArena::Assign(
+            pDisplayMeta, m_pFont->m_fontName.c_str(), m_pFont->font_name);
     }
         
     // ********************************************************************
@@ -531,18 +819,10 @@ namespace DSL
     {
 //        LOG_FUNC();
 
-        // check to see if we're adding meta data - client can disable
-        // by setting the PPH ODE display meta alloc size to 0.
-        // and ensure we have available space in the vector of meta structs.
-        NvDsDisplayMeta* pDisplayMeta(NULL);
-        for (const auto& ivec: displayMetaData)
-        {
-            if (ivec->num_lines < MAX_ELEMENTS_IN_DISPLAY_META)
-            {
-                pDisplayMeta = ivec;
-                break;
-            }
-        }
+        // get a Display Meta with an available slot, acquired on demand. 
+        // Client can disable by setting the PPH ODE display meta alloc size to 0.
+        NvDsDisplayMeta* pDisplayMeta = DisplayMetaAllocator::Get(displayMetaData, 
+            pFrameMeta, DisplayMetaAllocator::DISPLAY_META_LINES);
         if (!pDisplayMeta)
         {
             return;
@@ -576,18 +856,10 @@ namespace DSL
     {
 //        LOG_FUNC();
 
-        // check to see if we're adding meta data - client can disable
-        // by setting the PPH ODE display meta alloc size to 0.
-        // and ensure we have available space in the vector of meta structs.
-        NvDsDisplayMeta* pDisplayMeta(NULL);
-        for (const auto& ivec: displayMetaData)
-        {
-            if (ivec->num_arrows < MAX_ELEMENTS_IN_DISPLAY_META)
-            {
-                pDisplayMeta = ivec;
-                break;
-            }
-        }
+        // get a Display Meta with an available slot, acquired on demand. 
+        // Client can disable by setting the PPH ODE display meta alloc size to 0.
+        NvDsDisplayMeta* pDisplayMeta = DisplayMetaAllocator::Get(displayMetaData, 
+            pFrameMeta, DisplayMetaAllocator::DISPLAY_META_ARROWS);
         if (!pDisplayMeta)
         {
             return;
@@ -623,18 +895,10 @@ namespace DSL
     {
 //        LOG_FUNC();
 
-        // check to see if we're adding meta data - client can disable
-        // by setting the PPH ODE display meta alloc size to 0.
-        // and ensure we have available space in the vector of meta structs.
-        NvDsDisplayMeta* pDisplayMeta(NULL);
-        for (const auto& ivec: displayMetaData)
-        {
-            if (ivec->num_rects < MAX_ELEMENTS_IN_DISPLAY_META)
-            {
-                pDisplayMeta = ivec;
-                break;
-            }
-        }
+        // get a Display Meta with an available slot, acquired on demand. 
+        // Client can disable by setting the PPH ODE display meta alloc size to 0.
+        NvDsDisplayMeta* pDisplayMeta = DisplayMetaAllocator::Get(displayMetaData, 
+            pFrameMeta, DisplayMetaAllocator::DISPLAY_META_RECTS);
         if (!pDisplayMeta)
         {
             return;
@@ -684,18 +948,10 @@ namespace DSL
         
         for (uint i = 0; i < num_coordinates; i++)
         {
-            // check to see if we're adding meta data - client can disable
-            // by setting the PPH ODE display meta alloc size to 0.
-            // and ensure we have available space in the vector of meta structs.
-            NvDsDisplayMeta* pDisplayMeta(NULL);
-            for (const auto& ivec: displayMetaData)
-            {
-                if (ivec->num_lines < MAX_ELEMENTS_IN_DISPLAY_META)
-                {
-                    pDisplayMeta = ivec;
-                    break;
-                }
-            }
+            // get a Display Meta with an available slot, acquired on demand. 
+            // Client can disable by setting the PPH ODE display meta alloc size to 0.
+            NvDsDisplayMeta* pDisplayMeta = DisplayMetaAllocator::Get(displayMetaData, 
+                pFrameMeta, DisplayMetaAllocator::DISPLAY_META_LINES);
             if (!pDisplayMeta)
             {
                 return;
@@ -748,18 +1004,10 @@ namespace DSL
 
         for (uint i = 0; i < num_coordinates-1; i++)
         {
-            // check to see if we're adding meta data - client can disable
-            // by setting the PPH ODE display meta alloc size to 0.
-            // and ensure we have available space in the vector of meta structs.
-            NvDsDisplayMeta* pDisplayMeta(NULL);
-            for (const auto& ivec: displayMetaData)
-            {
-                if (ivec->num_lines < MAX_ELEMENTS_IN_DISPLAY_META)
-                {
-                    pDisplayMeta = ivec;
-                    break;
-                }
-            }
+            // get a Display Meta with an available slot, acquired on demand. 
+            // Client can disable by setting the PPH ODE display meta alloc size to 0.
+            NvDsDisplayMeta* pDisplayMeta = DisplayMetaAllocator::Get(displayMetaData, 
+                pFrameMeta, DisplayMetaAllocator::DISPLAY_META_LINES);
             if (!pDisplayMeta)
             {
                 return;
@@ -797,9 +1045,11 @@ namespace DSL
     {
 //        LOG_FUNC();
 
-        // check to see if we're adding meta data - client can disable
-        // by setting the PPH ODE display meta alloc size to 0.
-        if (displayMetaData.empty())
+        // get a Display Meta with an available slot, acquired on demand. 
+        // Client can disable by setting the PPH ODE display meta alloc size to 0.
+        NvDsDisplayMeta* pDisplayMeta = DisplayMetaAllocator::Get(displayMetaData, 
+            pFrameMeta, DisplayMetaAllocator::DISPLAY_META_CIRCLES);
+        if (!pDisplayMeta)
         {
             return;
         }
@@ -810,8 +1060,7 @@ namespace DSL
         bg_color = *m_pBgColor;
         m_pBgColor->Unlock();
         
-        displayMetaData.at(0)->circle_params[
-            displayMetaData.at(0)->num_circles++] = *this;
+        pDisplayMeta->circle_params[pDisplayMeta->num_circles++] = *this;
     }
 
     // ********************************************************************
@@ -833,10 +1082,13 @@ namespace DSL
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
-        m_text = std::to_string(pFrameMeta->source_frame_width) + " x " + 
-            std::to_string(pFrameMeta->source_frame_height);
 
-        RgbaText::AddMeta(displayMetaData, pFrameMeta);
+        // format on the stack - m_text is shared by all frames in flight
+        gchar text[MAX_DISPLAY_LEN];
+        g_snprintf(text, MAX_DISPLAY_LEN, "%u x %u", 
+            pFrameMeta->source_frame_width, pFrameMeta->source_frame_height);
+
+        addLabelMeta(displayMetaData, pFrameMeta, text, NULL);
     }
 
     // ********************************************************************
@@ -885,9 +1137,10 @@ namespace DSL
     {
 //        LOG_FUNC();
 
-        m_text = std::to_string(pFrameMeta->source_id);
+        gchar text[MAX_DISPLAY_LEN];
+        g_snprintf(text, MAX_DISPLAY_LEN, "%u", pFrameMeta->source_id);
 
-        RgbaText::AddMeta(displayMetaData, pFrameMeta);
+        addLabelMeta(displayMetaData, pFrameMeta, text, NULL);
     }
 
     // ********************************************************************
@@ -914,9 +1167,7 @@ namespace DSL
         if (Services::GetServices()->SourceNameGet(pFrameMeta->source_id, &name) == 
             DSL_RESULT_SUCCESS)
         {
-            m_text.assign(name);
-
-            RgbaText::AddMeta(displayMetaData, pFrameMeta);
+            addLabelMeta(displayMetaData, pFrameMeta, name, NULL);
         }
         
     }
@@ -32,6 +32,19 @@ THE SOFTWARE.
 
 #define MAX_DISPLAY_LEN 64
 
+/**
+ * @brief size of the static region used to intern font names and static
+ * display text. Interned strings live for the life of the process.
+ */
+#define DSL_DISPLAY_STRING_POOL_SIZE 65536
+
+/**
+ * @brief number of MAX_DISPLAY_LEN slots in the display text arena. 
+ * Slots are returned when the Display Meta they're added to is released 
+ * with its batch.
+ */
+#define DSL_DISPLAY_TEXT_ARENA_SLOTS 4096
+
 namespace DSL
 {
     #define DSL_DISPLAY_TYPE_PTR std::shared_ptr<DisplayType>
@@ -133,6 +146,222 @@ namespace DSL
 
     // ********************************************************************
 
+    /**
+     * @class DisplayMetaAllocator
+     * @brief Static services to acquire the Display Meta for a Frame on demand.
+     * The vector of Display Meta for a Frame is sized - by the ODE Handler - to
+     * the maximum number of structures allowed, with all entries set to NULL.
+     * A new structure is acquired from the batch's pool, into the first NULL
+     * entry, only when all acquired structures are full for the element type
+     * being added. Consumers of the vector must skip the NULL entries.
+     */
+    class DisplayMetaAllocator
+    {
+    public:
+    
+        /**
+         * @brief Display Meta element types
+         */
+        enum {DISPLAY_META_LABELS=0, DISPLAY_META_LINES, DISPLAY_META_ARROWS,
+            DISPLAY_META_RECTS, DISPLAY_META_CIRCLES};
+    
+        /**
+         * @brief Resets a vector of Display Meta for reuse with a new Frame.
+         * @param[in,out] displayMetaData vector of Display Meta to reset. The
+         * vector is resized to maxSize with all entries set to NULL.
+         * @param[in] maxSize maximum number of Display Meta structures that 
+         * can be acquired for the Frame. 0 disables adding display meta.
+         */
+        static void Reset(std::vector<NvDsDisplayMeta*>& displayMetaData,
+            uint maxSize);
+            
+        /**
+         * @brief Returns true if display meta can be added to the Frame.
+         * @param[in] displayMetaData vector of Display Meta for the Frame.
+         * @return false if the maximum number of structures is 0.
+         */
+        static bool IsEnabled(const std::vector<NvDsDisplayMeta*>& displayMetaData);
+        
+        /**
+         * @brief Gets a Display Meta with free slots for one or more elements
+         * of a given type, acquiring a new one from the pool if needed. The
+         * batch's meta lock is held while acquiring, as Get may be called from
+         * an ODE Handler worker thread.
+         * @param[in,out] displayMetaData vector of Display Meta for the Frame.
+         * @param[in] pFrameMeta Frame the Display Meta will be added to.
+         * @param[in] elementType one of the DISPLAY_META_* element types.
+         * @param[in] count number of free slots required.
+         * @return Display Meta to add to, or NULL if the maximum has been reached.
+         */
+        static NvDsDisplayMeta* Get(std::vector<NvDsDisplayMeta*>& displayMetaData,
+            NvDsFrameMeta* pFrameMeta, uint elementType, uint count = 1);
+    };
+
+    // ********************************************************************
+
+    /**
+     * @class DisplayStringPool
+     * @brief Static, append-only pool of immutable strings - font names and
+     * static display text - shared by all Display Meta that reference them.
+     * Strings are interned once when a Display Type is created so that no
+     * per-frame copy is required.
+     */
+    class DisplayStringPool
+    {
+    public:
+    
+        /**
+         * @brief Interns a string, returning the existing copy if found.
+         * @param[in] str string to intern.
+         * @return pointer to the immutable copy in the pool, or NULL if
+         * the pool is exhausted.
+         */
+        static const gchar* Intern(const std::string& str);
+        
+        /**
+         * @brief Returns true if a string is owned by the pool.
+         * @param[in] str string pointer to check.
+         */
+        static bool IsPooled(const gchar* str);
+        
+    private:
+    
+        /**
+         * @brief static storage for all interned strings.
+         */
+        static gchar m_pool[DSL_DISPLAY_STRING_POOL_SIZE];
+        
+        /**
+         * @brief number of bytes used in m_pool.
+         */
+        static uint m_poolUsed;
+        
+        /**
+         * @brief map of interned string to its copy in m_pool.
+         */
+        static std::unordered_map<std::string, const gchar*> m_index;
+        
+        /**
+         * @brief mutex to protect mutual access to m_poolUsed and m_index.
+         */
+        static GMutex m_poolMutex;
+    };
+
+    // ********************************************************************
+
+    /**
+     * @class DisplayTextArena
+     * @brief Static arena of fixed size MAX_DISPLAY_LEN text slots for the 
+     * dynamic label text added to Display Meta. DeepStream frees the 
+     * display_text of each label when the Display Meta is released with its
+     * batch. The arena wraps the meta's release function so that its own 
+     * slots - and pooled strings - are reclaimed and cleared first. Text is 
+     * copied to the heap, as before, if the release function can't be 
+     * wrapped or the arena is full.
+     */
+    class DisplayTextArena
+    {
+    public:
+    
+        /**
+         * @brief Gets storage for a label's display text holding a copy of 
+         * text, truncated and NUL terminated to fit MAX_DISPLAY_LEN.
+         * @param[in] pDisplayMeta Display Meta the label is added to.
+         * @param[in] text text to copy.
+         * @param[in] pInterned optional interned copy of text to use without 
+         * copying, from DisplayStringPool::Intern.
+         * @return display_text for the label, never NULL.
+         */
+        static gchar* Assign(NvDsDisplayMeta* pDisplayMeta, 
+            const char* text, const gchar* pInterned = NULL);
+        
+        /**
+         * @brief Returns true if a string is owned by the arena.
+         * @param[in] str string pointer to check.
+         */
+        static bool IsArenaOwned(const gchar* str);
+        
+        /**
+         * @brief Gets the number of arena slots currently in use.
+         */
+        static uint GetSlotsInUse();
+        
+        /**
+         * @brief Gets the number of labels copied to the heap because the
+         * release function couldn't be wrapped or the arena was full.
+         */
+        static uint64_t GetHeapFallbacks();
+
+    private:
+    
+        /**
+         * @brief wraps the release function of a Display Meta, once.
+         * @return true if the Display Meta's release function is wrapped.
+         */
+        static bool wrapRelease(NvDsDisplayMeta* pDisplayMeta);
+        
+        /**
+         * @brief release function installed by wrapRelease. Reclaims all
+         * arena and pooled strings before calling the original.
+         */
+        static void releaseDisplayMeta(gpointer data, gpointer user_data);
+        
+        /**
+         * @brief pops a free slot, returns NULL if the arena is full.
+         */
+        static gchar* acquireSlot();
+        
+        /**
+         * @brief pushes a slot back on the free stack. A pointer that is not
+         * the start of a slot in use - e.g. a second release of a slot by a
+         * copied Display Meta - is logged and ignored.
+         */
+        static void releaseSlot(gchar* pSlot);
+        
+        /**
+         * @brief static storage for all slots.
+         */
+        static gchar m_slots[DSL_DISPLAY_TEXT_ARENA_SLOTS][MAX_DISPLAY_LEN];
+        
+        /**
+         * @brief stack of free slot indices below m_slotsUnused.
+         */
+        static uint m_freeSlots[DSL_DISPLAY_TEXT_ARENA_SLOTS];
+        
+        /**
+         * @brief in-use flag for each slot, set on acquire and cleared on release.
+         */
+        static bool m_slotInUse[DSL_DISPLAY_TEXT_ARENA_SLOTS];
+        
+        /**
+         * @brief number of indices on the m_freeSlots stack.
+         */
+        static uint m_freeCount;
+        
+        /**
+         * @brief index of the first slot never used.
+         */
+        static uint m_slotsUnused;
+        
+        /**
+         * @brief the release function DeepStream installs in Display Meta,
+         * saved on first use. 
+         */
+        static std::atomic<NvDsMetaReleaseFunc> m_originalRelease;
+        
+        /**
+         * @brief running count of labels copied to the heap.
+         */
+        static std::atomic<uint64_t> m_heapFallbacks;
+        
+        /**
+         * @brief mutex to protect mutual access to the slot stack.
+         */
+        static GMutex m_arenaMutex;
+    };
+
+    // ********************************************************************
+
     class DisplayType : public Base
     {
     public: 
@@ -495,8 +724,28 @@ namespace DSL
         
         std::string m_text;
         
+    protected:
+    
+        /**
+         * @brief Adds a label - and its shadow if enabled - to the 
+         * displayMetaData with the RGBA Text's properties and given text.
+         * @param displayMetaData vector of allocated Display metadata to add 
+         * the meta to
+         * @param pFrameMeta frame meta for the frame the display meta 
+         * will be added to.
+         * @param text text for the label.
+         * @param pInterned interned copy of text if static, NULL otherwise.
+         */
+        void addLabelMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            NvDsFrameMeta* pFrameMeta, const char* text, const gchar* pInterned);
+        
     private:
     
+        /**
+         * @brief m_text interned in the DisplayStringPool, NULL if exhausted.
+         */
+        const gchar* m_pInternedText;
+    
         /**
          * @breif shared pointer to a RGBA Font Type for this RGBA Text
          */
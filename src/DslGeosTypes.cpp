@@ -257,7 +257,8 @@ namespace DSL
     // *****************************************************************************
 
     GeosPolygon::GeosPolygon(const dsl_polygon_params& polygon)
-        : m_pGeosPolygon(NULL)
+        : m_pGeosMultiLine(NULL)
+        , m_pGeosPolygon(NULL)
     {
         // Don't log function entry/exit
         
@@ -282,8 +283,10 @@ namespace DSL
         }
 
         // First, create Line String to use for calculating a points distance
-        // to the boarder of the Polygon, inside and out.
-        m_pGeosMultiLine = GEOSGeom_createLineString(geosCoordSequence);
+        // to the boarder of the Polygon, inside and out. The Line String takes
+        // ownership of the sequence, so it must be given its own copy.
+        m_pGeosMultiLine = GEOSGeom_createLineString(
+            GEOSCoordSeq_clone(geosCoordSequence));
         if (!m_pGeosMultiLine)
         {
             LOG_ERROR("Exception when creating GEOS Line String");
@@ -310,7 +313,8 @@ namespace DSL
     }
 
     GeosPolygon::GeosPolygon(const NvOSD_RectParams& rectangle)
-        : m_pGeosPolygon(NULL)
+        : m_pGeosMultiLine(NULL)
+        , m_pGeosPolygon(NULL)
     {
         // Don't log function entry/exit
         
@@ -336,8 +340,10 @@ namespace DSL
         }
         
         // First, create Line String to use for calculating a points distance
-        // to the boarder of the Polygon, inside and out.
-        m_pGeosMultiLine = GEOSGeom_createLineString(geosCoordSequence);
+        // to the boarder of the Polygon, inside and out. The Line String takes
+        // ownership of the sequence, so it must be given its own copy.
+        m_pGeosMultiLine = GEOSGeom_createLineString(
+            GEOSCoordSeq_clone(geosCoordSequence));
         if (!m_pGeosMultiLine)
         {
             LOG_ERROR("Exception when creating GEOS Line String");
@@ -367,6 +373,10 @@ namespace DSL
     {
         // Don't log function entry/exit
         
+        if (m_pGeosMultiLine)
+        {
+            GEOSGeom_destroy(m_pGeosMultiLine);
+        }
         if (m_pGeosPolygon)
         {
             GEOSGeom_destroy(m_pGeosPolygon);
@@ -432,6 +442,119 @@ namespace DSL
 
     //******************************************************************************
     
+    GeosPreparedPolygon::GeosPreparedPolygon(const dsl_polygon_params& polygon)
+        : GeosPolygon(polygon)
+        , m_pGeosPreparedPolygon(NULL)
+    {
+        // Don't log function entry/exit
+        
+        // The Prepared Geometry references, but does not own, the Polygon 
+        // geometry created by the base class.
+        m_pGeosPreparedPolygon = GEOSPrepare(m_pGeosPolygon);
+        if (!m_pGeosPreparedPolygon)
+        {
+            LOG_ERROR("Exception when creating GEOS Prepared Polygon");
+            throw;
+        }
+    }
+    
+    GeosPreparedPolygon::~GeosPreparedPolygon()
+    {
+        // Don't log function entry/exit
+        
+        // must be destroyed before the base class destroys the Polygon
+        if (m_pGeosPreparedPolygon)
+        {
+            GEOSPreparedGeom_destroy(m_pGeosPreparedPolygon);
+        }
+    }
+
+    bool GeosPreparedPolygon::Overlaps(const GeosPolygon& testPolygon)
+    {
+        // Don't log function entry/exit
+
+        char result = GEOSPreparedOverlaps(m_pGeosPreparedPolygon, 
+            testPolygon.m_pGeosPolygon);
+        if (result == 2)
+        {
+            LOG_ERROR("Exception when testing if GEOS Prepared Polygon overlaps");
+            throw;
+        }
+        return bool(result);
+    }
+
+    bool GeosPreparedPolygon::Contains(const GeosPolygon& testPolygon)
+    {
+        // Don't log function entry/exit
+
+        char result = GEOSPreparedContains(m_pGeosPreparedPolygon, 
+            testPolygon.m_pGeosPolygon);
+        if (result == 2)
+        {
+            LOG_ERROR("Exception when testing if GEOS Prepared Polygon contains Polygon");
+            throw;
+        }
+        return bool(result);
+    }
+
+    bool GeosPreparedPolygon::Contains(const GeosPoint& testPoint)
+    {
+        // Don't log function entry/exit
+
+        char result = GEOSPreparedContains(m_pGeosPreparedPolygon, 
+            testPoint.m_pGeosPoint);
+        if (result == 2)
+        {
+            LOG_ERROR("Exception when testing if GEOS Prepared Polygon contains Point");
+            throw;
+        }
+        return bool(result);
+    }
+
+    bool GeosPreparedPolygon::ContainsProperly(const GeosPolygon& testPolygon)
+    {
+        // Don't log function entry/exit
+
+        char result = GEOSPreparedContainsProperly(m_pGeosPreparedPolygon, 
+            testPolygon.m_pGeosPolygon);
+        if (result == 2)
+        {
+            LOG_ERROR("Exception when testing if GEOS Prepared Polygon properly contains Polygon");
+            throw;
+        }
+        return bool(result);
+    }
+
+    bool GeosPreparedPolygon::Within(const GeosPolygon& testPolygon)
+    {
+        // Don't log function entry/exit
+
+        char result = GEOSPreparedWithin(m_pGeosPreparedPolygon, 
+            testPolygon.m_pGeosPolygon);
+        if (result == 2)
+        {
+            LOG_ERROR("Exception when testing if GEOS Prepared Polygon is within Polygon");
+            throw;
+        }
+        return bool(result);
+    }
+
+    bool GeosPreparedPolygon::Disjoint(const GeosPolygon& testPolygon)
+    {
+        // Don't log function entry/exit
+
+        char result = GEOSPreparedDisjoint(m_pGeosPreparedPolygon, 
+            testPolygon.m_pGeosPolygon);
+        if (result == 2)
+        {
+            LOG_ERROR("Exception when testing if GEOS Prepared Polygon is disjoint");
+            throw;
+        }
+        return bool(result);
+    }
+
+    //******************************************************************************
+    
     GeosMultiLine::GeosMultiLine(const dsl_multi_line_params& multiLine)
         : m_pGeosMultiLine(NULL)
     {
@@ -223,6 +223,81 @@ namespace DSL
 
     };
 
+    /**
+     * @class GeosPreparedPolygon
+     * @file DslGeosTypes.h
+     * @brief Implements a GEOS Polygon object with an additional GEOS Prepared
+     * Geometry. The Prepared Geometry caches the Polygon's spatial index so that
+     * repeated overlap and containment tests against the same Polygon do not 
+     * need to rebuild it for each test.
+     */
+    class GeosPreparedPolygon : public GeosPolygon
+    {
+    public: 
+
+        /**
+         * @brief ctor for the GeosPreparedPolygon class
+         * @param[in] polygon reference to a DSL Polygon Structure.
+         */
+        GeosPreparedPolygon(const dsl_polygon_params& polygon);
+
+        /**
+         * @brief dtor for the GeosPreparedPolygon class
+         */
+        ~GeosPreparedPolygon();
+
+        /**
+         * @brief function to determine if the prepared polygon overlaps a polygon
+         * @param[in] testPolygon polygon to test for overlap
+         * @return true if the polygons overlap, false otherwise
+         */
+        bool Overlaps(const GeosPolygon& testPolygon);
+
+        /**
+         * @brief function to determine if the prepared polygon contains a polygon
+         * @param[in] testPolygon polygon to test
+         * @return true if the polygon contains the test polygon, false otherwise
+         */
+        bool Contains(const GeosPolygon& testPolygon);
+
+        /**
+         * @brief function to determine if the prepared polygon contains a point
+         * @param[in] testPoint GeosPoint to test
+         * @return true if the polygon contains the point, false otherwise
+         */
+        bool Contains(const GeosPoint& testPoint);
+
+        /**
+         * @brief function to determine if the prepared polygon contains a polygon
+         * without the polygon touching the prepared polygon's boundary.
+         * @param[in] testPolygon polygon to test
+         * @return true if the test polygon is fully within the interior of the 
+         * prepared polygon, false otherwise
+         */
+        bool ContainsProperly(const GeosPolygon& testPolygon);
+
+        /**
+         * @brief function to determine if the prepared polygon is within a polygon
+         * @param[in] testPolygon polygon to test
+         * @return true if the test polygon contains the prepared polygon, 
+         * false otherwise
+         */
+        bool Within(const GeosPolygon& testPolygon);
+
+        /**
+         * @brief function to determine if the prepared polygon and a polygon
+         * have no points in common, including their boundaries.
+         * @param[in] testPolygon polygon to test
+         * @return true if the polygons are disjoint, false otherwise
+         */
+        bool Disjoint(const GeosPolygon& testPolygon);
+
+        /**
+         * @brief Actual GEOS Prepared Geometry for this class.
+         */
+        const GEOSPreparedGeometry* m_pGeosPreparedPolygon;
+    };
+
     /**
      * @class GeosMultiLine
      * @file DslGeosTypes.h
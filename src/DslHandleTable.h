@@ -0,0 +1,276 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_HANDLE_TABLE_H
+#define _DSL_HANDLE_TABLE_H
+
+#include "Dsl.h"
+#include "DslBase.h"
+
+namespace DSL
+{
+    /**
+     * @brief Object types that can be referenced by a client handle. A handle
+     * only resolves for the type it was acquired with.
+     */
+    #define DSL_HANDLE_TYPE_ODE_TRIGGER                         1
+    #define DSL_HANDLE_TYPE_ODE_ACTION                          2
+    #define DSL_HANDLE_TYPE_PPH                                 3
+    #define DSL_HANDLE_TYPE_SOURCE                              4
+    #define DSL_HANDLE_TYPE_SINK                                5
+
+    /**
+     * @class HandleTable
+     * @brief Maps opaque 64-bit client handles to DSL objects. The low 32 bits
+     * of a handle are an index into a table of slots and the high 32 bits are
+     * the generation of the slot when the handle was issued, so resolution is
+     * a bounds check and a compare. A slot's generation is incremented each
+     * time the slot is freed, so a released handle - or the handle of a 
+     * deleted object - can never resolve to an object created later.
+     */
+    class HandleTable
+    {
+    public:
+    
+        /**
+         * @brief ctor for the HandleTable class
+         */
+        HandleTable()
+        {
+            g_rw_lock_init(&m_rwLock);
+        }
+        
+        /**
+         * @brief dtor for the HandleTable class
+         */
+        ~HandleTable()
+        {
+            g_rw_lock_clear(&m_rwLock);
+        }
+        
+        /**
+         * @brief Acquires a handle for an object. The same handle is returned 
+         * for an object that already has one of the same type.
+         * @param[in] pObject shared pointer to the object to reference.
+         * @param[in] type one of the DSL_HANDLE_TYPE constants.
+         * @return new or existing handle for the object.
+         */
+        uint64_t Acquire(DSL_BASE_PTR pObject, uint type)
+        {
+            LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_rwLock);
+            
+            auto iter = m_slotsByObject.find(pObject.get());
+            if (iter != m_slotsByObject.end())
+            {
+                Slot& slot = m_slots[iter->second];
+                
+                // The address may belong to a deleted object that was never 
+                // released - only reuse the slot if it still holds this object.
+                if (slot.m_pObject.lock() == pObject and slot.m_type == type)
+                {
+                    return toHandle(iter->second, slot.m_generation);
+                }
+                freeSlot(iter->second);
+            }
+            if (m_freeSlots.empty())
+            {
+                reclaimExpiredSlots();
+            }
+            uint index;
+            if (m_freeSlots.size())
+            {
+                index = m_freeSlots.back();
+                m_freeSlots.pop_back();
+            }
+            else
+            {
+                index = m_slots.size();
+                m_slots.push_back(Slot());
+            }
+            Slot& slot = m_slots[index];
+            slot.m_pObject = pObject;
+            slot.m_pAddress = pObject.get();
+            slot.m_type = type;
+            m_slotsByObject[pObject.get()] = index;
+            
+            return toHandle(index, slot.m_generation);
+        }
+        
+        /**
+         * @brief Resolves a handle to the object it references.
+         * @param[in] handle handle to resolve.
+         * @param[out] type type the handle was acquired with.
+         * @return shared pointer to the object if the handle is current and 
+         * the object still exists, nullptr otherwise.
+         */
+        DSL_BASE_PTR Resolve(uint64_t handle, uint& type)
+        {
+            // No function log - called once per handle-based service.
+            LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_rwLock);
+            
+            uint index(handle & 0xFFFFFFFF);
+            uint generation(handle >> 32);
+            
+            if (index >= m_slots.size() or 
+                m_slots[index].m_generation != generation)
+            {
+                return nullptr;
+            }
+            type = m_slots[index].m_type;
+            return m_slots[index].m_pObject.lock();
+        }
+        
+        /**
+         * @brief Releases a handle, freeing its slot for reuse.
+         * @param[in] handle handle to release.
+         * @return true if the handle was current and is now released, 
+         * false otherwise.
+         */
+        bool Release(uint64_t handle)
+        {
+            LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_rwLock);
+            
+            uint index(handle & 0xFFFFFFFF);
+            uint generation(handle >> 32);
+            
+            if (index >= m_slots.size() or 
+                m_slots[index].m_generation != generation)
+            {
+                return false;
+            }
+            freeSlot(index);
+            return true;
+        }
+        
+        /**
+         * @brief Returns the number of current handles, excluding handles 
+         * whose objects have been deleted.
+         * @return number of handles in use.
+         */
+        uint Size()
+        {
+            LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_rwLock);
+            
+            uint size(0);
+            for (auto& slot: m_slots)
+            {
+                if (slot.m_type and !slot.m_pObject.expired())
+                {
+                    size++;
+                }
+            }
+            return size;
+        }
+        
+    private:
+    
+        /**
+         * @struct Slot
+         * @brief One entry in the table. The object is held weakly so that
+         * an outstanding handle never keeps a deleted object alive.
+         */
+        struct Slot
+        {
+            Slot() : m_generation(1), m_type(0), m_pAddress(NULL) {};
+            
+            uint m_generation;
+            uint m_type;
+            std::weak_ptr<Base> m_pObject;
+            
+            /**
+             * @brief address of the object, the slot's key in m_slotsByObject.
+             */
+            Base* m_pAddress;
+        };
+
+        /**
+         * @brief Combines a slot index and generation into a handle. 
+         * Generations start at 1 so that no handle equals DSL_HANDLE_INVALID.
+         */
+        static uint64_t toHandle(uint index, uint generation)
+        {
+            return ((uint64_t)generation << 32) | index;
+        }
+        
+        /**
+         * @brief Frees a slot, invalidating all handles issued for it.
+         */
+        void freeSlot(uint index)
+        {
+            Slot& slot = m_slots[index];
+            
+            m_slotsByObject.erase(slot.m_pAddress);
+            slot.m_pObject.reset();
+            slot.m_pAddress = NULL;
+            slot.m_type = 0;
+            
+            // Skip generation 0 on wrap-around to keep handles non-zero.
+            if (++slot.m_generation == 0)
+            {
+                slot.m_generation = 1;
+            }
+            m_freeSlots.push_back(index);
+        }
+        
+        /**
+         * @brief Frees all slots whose objects have been deleted. Called only
+         * when the free list is empty, so the cost is amortized over the 
+         * slots it reclaims.
+         */
+        void reclaimExpiredSlots()
+        {
+            for (uint index = 0; index < m_slots.size(); index++)
+            {
+                if (m_slots[index].m_type and m_slots[index].m_pObject.expired())
+                {
+                    freeSlot(index);
+                }
+            }
+        }
+    
+        /**
+         * @brief reader/writer lock protecting the slots. Resolution only 
+         * takes the shared reader lock.
+         */
+        GRWLock m_rwLock;
+        
+        /**
+         * @brief table of slots indexed by the low 32 bits of a handle.
+         */
+        std::vector<Slot> m_slots;
+        
+        /**
+         * @brief indices of unused slots.
+         */
+        std::vector<uint> m_freeSlots;
+        
+        /**
+         * @brief map of object address to slot index, used to return the 
+         * existing handle for an object.
+         */
+        std::unordered_map<Base*, uint> m_slotsByObject;
+    };
+}
+
+#endif // _DSL_HANDLE_TABLE_H
@@ -0,0 +1,173 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslHistogram.h"
+
+namespace DSL
+{
+    LogLinearHistogram::LogLinearHistogram()
+    {
+        LOG_FUNC();
+        
+        Reset();
+    }
+    
+    void LogLinearHistogram::Record(uint64_t value)
+    {
+        // No function log - avoid overhead.
+        
+        m_buckets[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(value, std::memory_order_relaxed);
+        
+        double square((double)value*(double)value);
+        double sumOfSquares(m_sumOfSquares.load(std::memory_order_relaxed));
+        while (!m_sumOfSquares.compare_exchange_weak(sumOfSquares, 
+            sumOfSquares + square, std::memory_order_relaxed));
+
+        uint64_t min(m_min.load(std::memory_order_relaxed));
+        while (value < min and !m_min.compare_exchange_weak(min, value,
+            std::memory_order_relaxed));
+        
+        uint64_t max(m_max.load(std::memory_order_relaxed));
+        while (value > max and !m_max.compare_exchange_weak(max, value,
+            std::memory_order_relaxed));
+    }
+    
+    void LogLinearHistogram::Reset()
+    {
+        LOG_FUNC();
+        
+        for (auto& bucket: m_buckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        m_count.store(0, std::memory_order_relaxed);
+        m_min.store(UINT64_MAX, std::memory_order_relaxed);
+        m_max.store(0, std::memory_order_relaxed);
+        m_sum.store(0, std::memory_order_relaxed);
+        m_sumOfSquares.store(0, std::memory_order_relaxed);
+    }
+    
+    uint64_t LogLinearHistogram::GetCount()
+    {
+        return m_count.load(std::memory_order_relaxed);
+    }
+    
+    uint64_t LogLinearHistogram::GetMin()
+    {
+        return (GetCount()) ? m_min.load(std::memory_order_relaxed) : 0;
+    }
+    
+    uint64_t LogLinearHistogram::GetMax()
+    {
+        return m_max.load(std::memory_order_relaxed);
+    }
+    
+    double LogLinearHistogram::GetMean()
+    {
+        uint64_t count(GetCount());
+        
+        return (count) 
+            ? (double)m_sum.load(std::memory_order_relaxed)/count : 0;
+    }
+    
+    double LogLinearHistogram::GetStdDev()
+    {
+        uint64_t count(GetCount());
+        if (count < 2)
+        {
+            return 0;
+        }
+        double mean(GetMean());
+        double variance(m_sumOfSquares.load(std::memory_order_relaxed)/count 
+            - mean*mean);
+        
+        return (variance > 0) ? sqrt(variance) : 0;
+    }
+    
+    uint64_t LogLinearHistogram::GetPercentile(double percentile)
+    {
+        LOG_FUNC();
+        
+        // Snapshot the buckets first so the total is consistent with them.
+        uint64_t counts[DSL_HISTOGRAM_BUCKET_COUNT];
+        uint64_t total(0);
+        for (uint i = 0; i < DSL_HISTOGRAM_BUCKET_COUNT; i++)
+        {
+            counts[i] = m_buckets[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+        if (!total)
+        {
+            return 0;
+        }
+        percentile = std::max(0.0, std::min(100.0, percentile));
+        uint64_t rank = std::max((uint64_t)1, 
+            (uint64_t)ceil(percentile/100.0*total));
+        
+        uint64_t cumulative(0);
+        for (uint i = 0; i < DSL_HISTOGRAM_BUCKET_COUNT; i++)
+        {
+            cumulative += counts[i];
+            if (cumulative >= rank)
+            {
+                // Never report beyond the true extremes.
+                return std::max(GetMin(), std::min(GetMax(), BucketValue(i)));
+            }
+        }
+        return GetMax();
+    }
+    
+    uint LogLinearHistogram::BucketIndex(uint64_t value)
+    {
+        if (value < DSL_HISTOGRAM_SUB_BUCKET_COUNT)
+        {
+            return (uint)value;
+        }
+        uint exponent = 63 - __builtin_clzll(value);
+        if (exponent >= DSL_HISTOGRAM_MAX_VALUE_BITS)
+        {
+            return DSL_HISTOGRAM_BUCKET_COUNT - 1;
+        }
+        uint shift = exponent - DSL_HISTOGRAM_SUB_BUCKET_BITS;
+        uint subBucket = (uint)(value >> shift) & (DSL_HISTOGRAM_SUB_BUCKET_COUNT - 1);
+        
+        return (shift + 1)*DSL_HISTOGRAM_SUB_BUCKET_COUNT + subBucket;
+    }
+    
+    uint64_t LogLinearHistogram::BucketValue(uint index)
+    {
+        if (index < DSL_HISTOGRAM_SUB_BUCKET_COUNT)
+        {
+            return index;
+        }
+        uint shift = index/DSL_HISTOGRAM_SUB_BUCKET_COUNT - 1;
+        uint64_t subBucket = index % DSL_HISTOGRAM_SUB_BUCKET_COUNT;
+        uint64_t lower = (DSL_HISTOGRAM_SUB_BUCKET_COUNT + subBucket) << shift;
+        
+        return lower + ((1ULL << shift) >> 1);
+    }
+}
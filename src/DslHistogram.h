@@ -0,0 +1,140 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_HISTOGRAM_H
+#define _DSL_HISTOGRAM_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @brief Number of linear sub-buckets per power-of-two range, as a power 
+     * of two. 4 bits = 16 sub-buckets giving a worst case error of ~6%.
+     */
+    #define DSL_HISTOGRAM_SUB_BUCKET_BITS 4
+    #define DSL_HISTOGRAM_SUB_BUCKET_COUNT (1 << DSL_HISTOGRAM_SUB_BUCKET_BITS)
+    
+    /**
+     * @brief Largest recordable value as a power of two. Values above are 
+     * clamped into the last bucket, but m_max always holds the true value.
+     * 2^36 microseconds is ~19 hours.
+     */
+    #define DSL_HISTOGRAM_MAX_VALUE_BITS 36
+    
+    #define DSL_HISTOGRAM_BUCKET_COUNT \
+        ((DSL_HISTOGRAM_MAX_VALUE_BITS - DSL_HISTOGRAM_SUB_BUCKET_BITS + 1) \
+            * DSL_HISTOGRAM_SUB_BUCKET_COUNT)
+
+    /**
+     * @class LogLinearHistogram
+     * @brief Fixed-memory, lock-free log-linear histogram. Values below 
+     * DSL_HISTOGRAM_SUB_BUCKET_COUNT are recorded exactly, larger values into 
+     * one of DSL_HISTOGRAM_SUB_BUCKET_COUNT linear buckets per power-of-two. 
+     * Record may be called concurrently from any number of threads, and
+     * queries may run concurrently with Record.
+     */
+    class LogLinearHistogram
+    {
+    public:
+    
+        LogLinearHistogram();
+
+        /**
+         * @brief Records a single value.
+         * @param[in] value value to record, in the caller's units.
+         */
+        void Record(uint64_t value);
+        
+        /**
+         * @brief Clears all recorded values.
+         */
+        void Reset();
+        
+        /**
+         * @brief Returns the number of recorded values.
+         */
+        uint64_t GetCount();
+        
+        /**
+         * @brief Returns the smallest recorded value, 0 if empty.
+         */
+        uint64_t GetMin();
+        
+        /**
+         * @brief Returns the largest recorded value, 0 if empty.
+         */
+        uint64_t GetMax();
+        
+        /**
+         * @brief Returns the mean of all recorded values, 0 if empty.
+         */
+        double GetMean();
+        
+        /**
+         * @brief Returns the standard deviation of all recorded values.
+         */
+        double GetStdDev();
+        
+        /**
+         * @brief Returns the value at a given percentile, within the 
+         * precision of the bucket the percentile falls in.
+         * @param[in] percentile percentile to query, 0.0 to 100.0.
+         * @return value at percentile, 0 if empty.
+         */
+        uint64_t GetPercentile(double percentile);
+
+        /**
+         * @brief Maps a value to its bucket index.
+         */
+        static uint BucketIndex(uint64_t value);
+        
+        /**
+         * @brief Maps a bucket index to the midpoint of the bucket's range.
+         */
+        static uint64_t BucketValue(uint index);
+        
+    private:
+    
+        /**
+         * @brief count of values recorded in each bucket.
+         */
+        std::atomic<uint64_t> m_buckets[DSL_HISTOGRAM_BUCKET_COUNT];
+        
+        std::atomic<uint64_t> m_count;
+        
+        std::atomic<uint64_t> m_min;
+        
+        std::atomic<uint64_t> m_max;
+        
+        /**
+         * @brief running sums used to calculate mean and standard deviation.
+         */
+        std::atomic<uint64_t> m_sum;
+        
+        std::atomic<double> m_sumOfSquares;
+    };
+}
+
+#endif // _DSL_HISTOGRAM_H
@@ -28,23 +28,42 @@ THE SOFTWARE.
 GST_DEBUG_CATEGORY_EXTERN(GST_CAT_DSL);
 
 #include "Dsl.h"
+#include "DslLogSink.h"
 
 namespace DSL
 {
 
+/**
+ * Single, predictable branch used to gate all logging. _gst_debug_min is
+ * GStreamer's cached minimum of all category thresholds, so a disabled level
+ * costs one compare. The DSL category threshold is only read when some
+ * category has the level enabled.
+ */
+#define LOG_LEVEL_ENABLED(level) \
+    (G_UNLIKELY((level) <= _gst_debug_min and GST_CAT_DSL and \
+        (level) <= gst_debug_category_get_threshold(GST_CAT_DSL)))
+
 /**
  * Logs the Entry and Exit of a Function with the DEBUG level.
  * Add macro as the first statement to each function of interest.
- * Consider the intrussion/penalty of this call when adding.
+ * The method name is only formatted when the DEBUG level is enabled.
  */
-#define LOG_FUNC() LogFunc lf(__METHOD_NAME__)
+#define LOG_FUNC() LogFunc lf(__PRETTY_FUNCTION__, \
+    GST_FUNCTION, __FILE__, __LINE__)
 
+/**
+ * The message expression is only evaluated when the level is enabled.
+ */
 #define LOG(message, level) \
     do \
     { \
-        std::stringstream logMessage; \
-        logMessage  << " : " << message; \
-        GST_CAT_LEVEL_LOG(GST_CAT_DSL, level, NULL, logMessage.str().c_str(), NULL); \
+        if (LOG_LEVEL_ENABLED(level)) \
+        { \
+            std::stringstream logMessage; \
+            logMessage  << " : " << message; \
+            LogSink::GetSink().Write(level, __FILE__, GST_FUNCTION, \
+                __LINE__, logMessage.str()); \
+        } \
     } while (0)
 
 #define LOG_DEBUG(message) LOG(message, GST_LEVEL_DEBUG)
@@ -57,26 +76,40 @@ namespace DSL
  
     /**
      * @class LogFunc
-     * @brief Used to log entry and exit of a function.
+     * @brief Used to log entry and exit of a function. Holds pointers to
+     * string literals only, the method name is formatted on demand.
      */
     class LogFunc
     {
     public:
-        LogFunc(const std::string& method) 
+        LogFunc(const char* prettyFunction, const char* function,
+            const char* file, int line) 
+            : m_prettyFunction(prettyFunction)
+            , m_function(function)
+            , m_file(file)
+            , m_line(line)
         {
-            m_logMessage  << method;
-            GST_CAT_LEVEL_LOG(GST_CAT_DSL, GST_LEVEL_DEBUG, NULL, 
-                m_logMessage.str().c_str(), "");
+            if (LOG_LEVEL_ENABLED(GST_LEVEL_DEBUG))
+            {
+                LogSink::GetSink().Write(GST_LEVEL_DEBUG, m_file, 
+                    m_function, m_line, methodName(m_prettyFunction));
+            }
         };
         
         ~LogFunc()
         {
-            GST_CAT_LEVEL_LOG(GST_CAT_DSL, GST_LEVEL_DEBUG, NULL, 
-                m_logMessage.str().c_str(), "");
+            if (LOG_LEVEL_ENABLED(GST_LEVEL_DEBUG))
+            {
+                LogSink::GetSink().Write(GST_LEVEL_DEBUG, m_file, 
+                    m_function, m_line, methodName(m_prettyFunction));
+            }
         };
         
     private:
-        std::stringstream m_logMessage; 
+        const char* m_prettyFunction;
+        const char* m_function;
+        const char* m_file;
+        int m_line;
     };
 
 } // namespace 
@@ -0,0 +1,266 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslLogSink.h"
+
+namespace DSL
+{
+    LogSink& LogSink::GetSink()
+    {
+        // Function-local static - destroyed, and the queue drained, at exit.
+        static LogSink sink;
+        
+        return sink;
+    }
+
+    LogSink::LogSink()
+        : m_asyncEnabled(false)
+        , m_pRecords(new LogRecord[DSL_LOG_SINK_QUEUE_SIZE])
+        , m_enqueuePos(0)
+        , m_dequeuePos(0)
+        , m_pThread(NULL)
+        , m_stop(false)
+    {
+        // No function log - the sink must never log to itself.
+        
+        g_mutex_init(&m_drainMutex);
+        g_mutex_init(&m_threadMutex);
+        g_cond_init(&m_threadCond);
+        
+        // Each record is free for the first pass through the ring.
+        for (size_t i = 0; i < DSL_LOG_SINK_QUEUE_SIZE; i++)
+        {
+            m_pRecords[i].m_sequence.store(i, std::memory_order_relaxed);
+        }
+        
+        const char* asyncEnv = getenv(DSL_LOG_ASYNC_ENV);
+        if (asyncEnv and atoi(asyncEnv))
+        {
+            SetAsyncEnabled(true);
+        }
+    }
+    
+    LogSink::~LogSink()
+    {
+        SetAsyncEnabled(false);
+        
+        // Drain any records pushed by producers that were still in Write 
+        // when the writer-thread was joined.
+        g_mutex_lock(&m_drainMutex);
+        drainAll();
+        g_mutex_unlock(&m_drainMutex);
+
+        g_cond_clear(&m_threadCond);
+        g_mutex_clear(&m_threadMutex);
+        g_mutex_clear(&m_drainMutex);
+    }
+    
+    void LogSink::Write(GstDebugLevel level, const char* file, 
+        const char* function, int line, std::string&& message)
+    {
+        if (!m_asyncEnabled.load(std::memory_order_relaxed))
+        {
+            gst_debug_log(GST_CAT_DSL, level, file, function, line, 
+                NULL, "%s", message.c_str());
+            return;
+        }
+        if (!push(level, file, function, line, message))
+        {
+            // Queue full or message too long - write synchronously, after
+            // all queued records, so that the order is maintained.
+            g_mutex_lock(&m_drainMutex);
+            drainAll();
+            gst_debug_log(GST_CAT_DSL, level, file, function, line, 
+                NULL, "%s", message.c_str());
+            g_mutex_unlock(&m_drainMutex);
+        }
+    }
+
+    bool LogSink::push(GstDebugLevel level, const char* file, 
+        const char* function, int line, const std::string& message)
+    {
+        if (message.size() >= DSL_LOG_RECORD_MESSAGE_SIZE)
+        {
+            return false;
+        }
+        // Vyukov bounded queue - claim the next free record with a single CAS.
+        LogRecord* pRecord(NULL);
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            pRecord = &m_pRecords[pos & (DSL_LOG_SINK_QUEUE_SIZE-1)];
+            size_t sequence = pRecord->m_sequence.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+            
+            if (diff == 0)
+            {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos+1, 
+                    std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // The record is still waiting to be written - queue full.
+                return false;
+            }
+            else
+            {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        pRecord->m_level = level;
+        pRecord->m_file = file;
+        pRecord->m_function = function;
+        pRecord->m_line = line;
+        message.copy(pRecord->m_message, message.size());
+        pRecord->m_message[message.size()] = 0;
+        
+        // Publish the record to the writer-thread.
+        pRecord->m_sequence.store(pos+1, std::memory_order_release);
+        return true;
+    }
+
+    bool LogSink::GetAsyncEnabled()
+    {
+        return m_asyncEnabled.load(std::memory_order_relaxed);
+    }
+    
+    void LogSink::SetAsyncEnabled(bool enabled)
+    {
+        g_mutex_lock(&m_threadMutex);
+        
+        if (enabled and !m_pThread)
+        {
+            m_stop = false;
+            m_pThread = g_thread_new("dsl-log-sink", LogSinkThread, this);
+            m_asyncEnabled.store(true, std::memory_order_release);
+        }
+        else if (!enabled and m_pThread)
+        {
+            // Route new messages directly first, then stop and join the
+            // writer-thread which drains any records still queued.
+            m_asyncEnabled.store(false, std::memory_order_release);
+            m_stop = true;
+            g_cond_signal(&m_threadCond);
+            
+            GThread* pThread = m_pThread;
+            m_pThread = NULL;
+            g_mutex_unlock(&m_threadMutex);
+            
+            g_thread_join(pThread);
+            Flush();
+            return;
+        }
+        g_mutex_unlock(&m_threadMutex);
+    }
+    
+    void LogSink::Flush()
+    {
+        Suspend();
+        Resume();
+    }
+    
+    void LogSink::Suspend()
+    {
+        g_mutex_lock(&m_drainMutex);
+        drainAll();
+    }
+    
+    void LogSink::Resume()
+    {
+        g_mutex_unlock(&m_drainMutex);
+    }
+    
+    void LogSink::Run()
+    {
+        g_mutex_lock(&m_threadMutex);
+        while (!m_stop)
+        {
+            g_mutex_unlock(&m_threadMutex);
+            Flush();
+            g_mutex_lock(&m_threadMutex);
+            
+            if (!m_stop)
+            {
+                gint64 endTime = g_get_monotonic_time() + 
+                    DSL_LOG_SINK_WAKE_INTERVAL_US;
+                g_cond_wait_until(&m_threadCond, &m_threadMutex, endTime);
+            }
+        }
+        g_mutex_unlock(&m_threadMutex);
+        
+        Flush();
+    }
+
+    uint LogSink::drain()
+    {
+        uint count(0);
+        while (true)
+        {
+            LogRecord* pRecord = 
+                &m_pRecords[m_dequeuePos & (DSL_LOG_SINK_QUEUE_SIZE-1)];
+            
+            // Empty, or a producer is between its claim and publish.
+            if (pRecord->m_sequence.load(std::memory_order_acquire) != 
+                m_dequeuePos+1)
+            {
+                break;
+            }
+            gst_debug_log(GST_CAT_DSL, pRecord->m_level, pRecord->m_file, 
+                pRecord->m_function, pRecord->m_line, NULL, "%s", 
+                pRecord->m_message);
+
+            // Free the record for the next pass through the ring.
+            pRecord->m_sequence.store(m_dequeuePos + DSL_LOG_SINK_QUEUE_SIZE, 
+                std::memory_order_release);
+            m_dequeuePos++;
+            count++;
+        }
+        return count;
+    }
+
+    void LogSink::drainAll()
+    {
+        size_t enqueuePos = m_enqueuePos.load(std::memory_order_acquire);
+        
+        while ((intptr_t)(enqueuePos - m_dequeuePos) > 0)
+        {
+            if (!drain())
+            {
+                // A producer has claimed a record but not yet written it.
+                g_thread_yield();
+            }
+        }
+    }
+
+    static gpointer LogSinkThread(gpointer pSink)
+    {
+        static_cast<LogSink*>(pSink)->Run();
+        
+        return NULL;
+    }
+}
@@ -0,0 +1,224 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_LOG_SINK_H
+#define _DSL_LOG_SINK_H
+
+#include "Dsl.h"
+
+GST_DEBUG_CATEGORY_EXTERN(GST_CAT_DSL);
+
+namespace DSL
+{
+    /**
+     * @brief Environment variable which, when set to a non-zero value,
+     * enables asynchronous logging on first use of the LogSink.
+     */
+    #define DSL_LOG_ASYNC_ENV "DSL_LOG_ASYNC"
+
+    /**
+     * @brief Maximum time the LogSink writer-thread will sleep before
+     * draining the record queue, in units of microseconds.
+     */
+    #define DSL_LOG_SINK_WAKE_INTERVAL_US 10000
+
+    /**
+     * @brief Number of pre-allocated records in the LogSink's queue. 
+     * Must be a power of 2.
+     */
+    #define DSL_LOG_SINK_QUEUE_SIZE 1024
+
+    /**
+     * @brief Maximum message size, including the terminating null, that can 
+     * be queued in a pre-allocated record.
+     */
+    #define DSL_LOG_RECORD_MESSAGE_SIZE 512
+
+    /**
+     * @struct LogRecord
+     * @brief Single pre-allocated slot in the LogSink's bounded, lock-free 
+     * MPSC queue.
+     */
+    struct LogRecord
+    {
+        /**
+         * @brief Slot sequence number. Equal to the queue position when the 
+         * slot is free, and to the position + 1 once the record is written.
+         */
+        std::atomic<size_t> m_sequence;
+        GstDebugLevel m_level;
+        const char* m_file;
+        const char* m_function;
+        int m_line;
+        char m_message[DSL_LOG_RECORD_MESSAGE_SIZE];
+    };
+
+    /**
+     * @class LogSink
+     * @brief Single destination for all enabled DSL log messages. Messages 
+     * are either passed synchronously to gst_debug_log or, when async is
+     * enabled, copied into a pre-allocated record in a bounded, lock-free 
+     * multi-producer/single-consumer queue that is drained by a background 
+     * writer-thread. Messages that are too long for a record, or that find 
+     * the queue full, are written synchronously after draining the queue. 
+     * Disabled log-levels never reach the sink, see LOG_LEVEL_ENABLED in 
+     * DslLogGst.h.
+     */
+    class LogSink
+    {
+    public:
+
+        /**
+         * @brief Returns the single LogSink instance.
+         */
+        static LogSink& GetSink();
+
+        /**
+         * @brief Writes a formatted message to the GST_CAT_DSL category. 
+         * @param[in] level GST debug level of the message.
+         * @param[in] file source file of the calling code.
+         * @param[in] function name of the calling function.
+         * @param[in] line source line of the calling code.
+         * @param[in] message fully formatted message to write.
+         */
+        void Write(GstDebugLevel level, const char* file, 
+            const char* function, int line, std::string&& message);
+        
+        /**
+         * @brief Gets the current async enabled setting.
+         * @return true if async logging is enabled, false otherwise.
+         */
+        bool GetAsyncEnabled();
+
+        /**
+         * @brief Sets the async enabled setting. Disabling async logging
+         * will stop the writer-thread after draining the queue.
+         * @param[in] enabled set to true to enable async logging.
+         */
+        void SetAsyncEnabled(bool enabled);
+        
+        /**
+         * @brief Synchronously drains all queued records. Used prior to 
+         * changing the log function or log file so that no queued records
+         * are lost or written to the wrong destination.
+         */
+        void Flush();
+        
+        /**
+         * @brief Drains all queued records and then suspends the writer-thread
+         * until Resume is called. Used to safely close or change the current
+         * log file. Messages logged while suspended remain queued.
+         */
+        void Suspend();
+        
+        /**
+         * @brief Resumes the writer-thread after a call to Suspend.
+         */
+        void Resume();
+
+        /**
+         * @brief Writer-thread function, drains the queue until stopped.
+         */
+        void Run();
+
+    private:
+
+        LogSink();
+
+        ~LogSink();
+
+        /**
+         * @brief Pops and writes all currently queued records. 
+         * The m_drainMutex must be held by the caller.
+         * @return number of records written.
+         */
+        uint drain();
+
+        /**
+         * @brief Writes all records claimed by producers prior to the call,
+         * waiting for any that are still being copied.
+         * The m_drainMutex must be held by the caller.
+         */
+        void drainAll();
+
+        /**
+         * @brief Copies a message into the next free record.
+         * @return false if the queue is full or the message is too long.
+         */
+        bool push(GstDebugLevel level, const char* file, 
+            const char* function, int line, const std::string& message);
+
+        /**
+         * @brief Async enabled setting, read on every Write.
+         */
+        std::atomic<bool> m_asyncEnabled;
+
+        /**
+         * @brief Pre-allocated records, used as a ring buffer.
+         */
+        std::unique_ptr<LogRecord[]> m_pRecords;
+
+        /**
+         * @brief Producer position in the ring, claimed by all producers.
+         */
+        alignas(64) std::atomic<size_t> m_enqueuePos;
+
+        /**
+         * @brief Consumer position in the ring, the next record to write.
+         */
+        alignas(64) size_t m_dequeuePos;
+
+        /**
+         * @brief Mutex to serialize consumers, i.e. writer-thread and Flush.
+         */
+        GMutex m_drainMutex;
+
+        /**
+         * @brief Mutex and condition used to start, wake and stop
+         * the writer-thread.
+         */
+        GMutex m_threadMutex;
+
+        GCond m_threadCond;
+
+        /**
+         * @brief Writer-thread, NULL when async is disabled.
+         */
+        GThread* m_pThread;
+
+        /**
+         * @brief Set to true to signal the writer-thread to exit.
+         */
+        bool m_stop;
+    };
+
+    /**
+     * @brief LogSink writer-thread function.
+     * @param[in] pSink pointer to the LogSink that started the thread.
+     */
+    static gpointer LogSinkThread(gpointer pSink);
+
+} // namespace
+
+#endif // _DSL_LOG_SINK_H
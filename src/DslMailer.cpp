@@ -58,7 +58,18 @@ namespace DSL
         const EmailAddress& from, const EmailAddresses& ccList,
         const std::string& subject, const std::vector<std::string>& body,
         const std::string& attachment)
-        : m_attachment(attachment.c_str())
+        : SmtpMessage(toList, from, ccList, subject, body, 
+            (attachment.size()) 
+                ? std::vector<std::string>{attachment} 
+                : std::vector<std::string>())
+    {
+    }
+
+    SmtpMessage::SmtpMessage(const EmailAddresses& toList,
+        const EmailAddress& from, const EmailAddresses& ccList,
+        const std::string& subject, const std::vector<std::string>& body,
+        const std::vector<std::string>& attachments)
+        : m_attachments(attachments)
     {
         LOG_FUNC();
 
@@ -151,9 +162,11 @@ namespace DSL
 
     // ------------------------------------------------------------------------------
 
-    SmtpMessageQueue::SmtpMessageQueue()
+    SmtpMessageQueue::SmtpMessageQueue(uint maxSize)
         : m_enabled(true)
-        , m_purgeTimerId(0)
+        , m_maxSize(maxSize)
+        , m_policy(DSL_MAILER_QUEUE_POLICY_DROP_OLDEST)
+        , m_droppedCount(0)
     {
         LOG_FUNC();
         
@@ -164,10 +177,10 @@ namespace DSL
     {
         LOG_FUNC();
 
-        if (m_purgeTimerId)
+        if (m_droppedCount)
         {
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_queueMutex);
-            g_source_remove(m_purgeTimerId);
+            LOG_WARN("SMTP Message Queue dropped " << m_droppedCount 
+                << " messages - queue full");
         }
         g_mutex_clear(&m_queueMutex);
     }
@@ -188,6 +201,52 @@ namespace DSL
         m_enabled = enabled;
     }
 
+    void SmtpMessageQueue::GetSettings(uint* maxSize, uint* policy)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_queueMutex);
+
+        *maxSize = m_maxSize;
+        *policy = m_policy;
+    }
+    
+    void SmtpMessageQueue::SetSettings(uint maxSize, uint policy)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_queueMutex);
+
+        m_maxSize = maxSize;
+        m_policy = policy;
+        
+        while (m_queue.size() > m_maxSize)
+        {
+            m_queue.pop_front();
+            m_droppedCount++;
+        }
+    }
+
+    uint64_t SmtpMessageQueue::GetDroppedCount()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_queueMutex);
+
+        return m_droppedCount;
+    }
+
+    bool SmtpMessageQueue::IsEmpty()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_queueMutex);
+        
+        return m_queue.empty();
+    }
+    
+    uint SmtpMessageQueue::Size()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_queueMutex);
+        
+        return m_queue.size();
+    }
+
     bool SmtpMessageQueue::Push(std::shared_ptr<SmtpMessage> pMessage)
     {
         LOG_FUNC();
@@ -199,9 +258,23 @@ namespace DSL
             return false;
         }
         
+        if (m_queue.size() >= m_maxSize)
+        {
+            // log the first drop only, the total is logged on destruction.
+            if (m_droppedCount++ == 0)
+            {
+                LOG_WARN("SMTP Message Queue is dropping messages - queue full");
+            }
+            if (m_policy == DSL_MAILER_QUEUE_POLICY_DROP_NEWEST or !m_maxSize)
+            {
+                return false;
+            }
+            m_queue.pop_front();
+        }
+        
         LOG_INFO("Pushing: SMTP Message with Id = " << pMessage->GetId());
 
-        m_queue.push(pMessage);
+        m_queue.push_back(pMessage);
         return true;
     }
 
@@ -216,7 +289,7 @@ namespace DSL
         }
 
         std::shared_ptr<SmtpMessage> pFront = m_queue.front();
-        m_queue.pop();
+        m_queue.pop_front();
         return pFront;
     }
     
@@ -224,23 +297,63 @@ namespace DSL
     
     Mailer::Mailer(const char* name)
         : Base(name)
-        , m_sendMessageThreadId(0)
         , m_sslEnabled(true)
+        , m_maxPerMinute(0)
+        , m_nextSendTime(0)
+        , m_digestWindow(0)
+        , m_digestMaxMessages(0)
+        , m_sentCount(0)
+        , m_failedCount(0)
+        , m_pMulti(NULL)
+        , m_pCurl(NULL)
+        , m_pRecipients(NULL)
+        , m_pHeaders(NULL)
+        , m_pMime(NULL)
+        , m_stop(false)
+        , m_pSendThread(NULL)
     {
         LOG_FUNC();
         
+        m_pMulti = curl_multi_init();
+        m_pCurl = curl_easy_init();
+        if (!m_pMulti or !m_pCurl)
+        {
+            LOG_ERROR("Failed to initialize libcurl handles for Mailer '" 
+                << name << "'");
+            if (m_pCurl)
+            {
+                curl_easy_cleanup(m_pCurl);
+            }
+            if (m_pMulti)
+            {
+                curl_multi_cleanup(m_pMulti);
+            }
+            throw std::runtime_error("curl init failed");
+        }
+        
         g_mutex_init(&m_commsMutex);
+        g_mutex_init(&m_wakeMutex);
+        g_cond_init(&m_wakeCond);
+        
+        m_pSendThread = g_thread_new(NULL, MailerSendThread, this);
     }
     
     Mailer::~Mailer()
     {
         LOG_FUNC();
         
-        if (m_sendMessageThreadId)
+        m_stop = true;
         {
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_commsMutex);
-            g_source_remove(m_sendMessageThreadId);
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_wakeMutex);
+            g_cond_signal(&m_wakeCond);
         }
+        g_thread_join(m_pSendThread);
+        
+        curl_easy_cleanup(m_pCurl);
+        curl_multi_cleanup(m_pMulti);
+        
+        g_cond_clear(&m_wakeCond);
+        g_mutex_clear(&m_wakeMutex);
         g_mutex_clear(&m_commsMutex);
     }
     
@@ -389,6 +502,47 @@ namespace DSL
             LOG_ERROR("Unable to queue Message - SMTP Mail settings are incomplete.");
             return false;
         }
+        
+        if (m_digestWindow)
+        {
+            if (!m_pMessageQueue.GetEnabled())
+            {
+                LOG_ERROR("SMTP Message Queue is currently disabled, unable to queue new message");
+                return false;
+            }
+            
+            // Merge the message into the pending digest for this subject,
+            // creating a new digest if this is the first message in the window.
+            auto iter = m_digests.find(subject);
+            if (iter == m_digests.end())
+            {
+                SmtpDigest digest{g_get_monotonic_time(), 0};
+                iter = m_digests.emplace(subject, digest).first;
+            }
+            SmtpDigest& digest = iter->second;
+            
+            if (digest.m_count)
+            {
+                digest.m_body.push_back(
+                    "----------------------------------------------------\r\n");
+            }
+            digest.m_body.insert(digest.m_body.end(), body.begin(), body.end());
+            if (attachment.size())
+            {
+                digest.m_attachments.push_back(attachment);
+            }
+            digest.m_count++;
+            
+            // The send thread will queue the digest once its window expires,
+            // unless it's full now.
+            if (!m_digestMaxMessages or digest.m_count < m_digestMaxMessages)
+            {
+                return true;
+            }
+            bool result = queueDigest(subject, digest);
+            m_digests.erase(iter);
+            return result;
+        }
 
         // Create a new message with the caller's unique content
         std::shared_ptr<SmtpMessage> pMessage = 
@@ -401,74 +555,250 @@ namespace DSL
             return false;
         }
         
-        // if the SendMessage thread is not currently running
-        if (!m_sendMessageThreadId)
+        // wake the send thread now rather than on its next periodic wake.
+        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_wakeMutex);
+        g_cond_signal(&m_wakeCond);
+        
+        return true;
+    }
+    
+    bool Mailer::queueDigest(const std::string& subject, const SmtpDigest& digest)
+    {
+        LOG_FUNC();
+        
+        std::ostringstream digestSubject;
+        digestSubject << subject;
+        if (digest.m_count > 1)
+        {
+            digestSubject << " (" << digest.m_count << " events)";
+        }
+        
+        std::shared_ptr<SmtpMessage> pMessage = 
+            std::shared_ptr<SmtpMessage>(new SmtpMessage(m_toAddresses, 
+                m_fromAddress, m_ccAddresses, digestSubject.str(), 
+                digest.m_body, digest.m_attachments));
+        
+        if (!m_pMessageQueue.Push(pMessage))
+        {
+            return false;
+        }
+        // the caller holds the comms mutex.
+        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_wakeMutex);
+        g_cond_signal(&m_wakeCond);
+        
+        return true;
+    }
+    
+    void Mailer::flushDigests()
+    {
+        // No function log - called on every wake of the send thread.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_commsMutex);
+        
+        gint64 now = g_get_monotonic_time();
+        
+        for (auto iter = m_digests.begin(); iter != m_digests.end(); )
         {
-            m_sendMessageThreadId = g_idle_add(MailerSendMessage, this);
+            if (!m_digestWindow or (now - iter->second.m_startTime >= 
+                (gint64)m_digestWindow*G_TIME_SPAN_SECOND))
+            {
+                queueDigest(iter->first, iter->second);
+                iter = m_digests.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
         }
-        return (bool)m_sendMessageThreadId;
+    }
+    
+    void Mailer::GetQueueSettings(uint* maxSize, uint* policy)
+    {
+        LOG_FUNC();
+        
+        m_pMessageQueue.GetSettings(maxSize, policy);
+    }
+    
+    void Mailer::SetQueueSettings(uint maxSize, uint policy)
+    {
+        LOG_FUNC();
+        
+        m_pMessageQueue.SetSettings(maxSize, policy);
+    }
+    
+    uint Mailer::GetRateLimit()
+    {
+        LOG_FUNC();
         
+        return m_maxPerMinute;
     }
     
-    bool Mailer::SendMessage()
+    void Mailer::SetRateLimit(uint maxPerMinute)
+    {
+        LOG_FUNC();
+        
+        m_maxPerMinute = maxPerMinute;
+    }
+    
+    void Mailer::GetDigestSettings(uint* window, uint* maxMessages)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_commsMutex);
         
-        // Make sure the queue has a message to process
-        if (m_pMessageQueue.IsEmpty())
+        *window = m_digestWindow;
+        *maxMessages = m_digestMaxMessages;
+    }
+    
+    void Mailer::SetDigestSettings(uint window, uint maxMessages)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_commsMutex);
+        
+        m_digestWindow = window;
+        m_digestMaxMessages = maxMessages;
+    }
+    
+    void Mailer::GetStats(uint64_t* sent, uint64_t* failed, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        
+        *sent = m_sentCount;
+        *failed = m_failedCount;
+        *dropped = m_pMessageQueue.GetDroppedCount();
+    }
+    
+    void Mailer::Run()
+    {
+        LOG_FUNC();
+        
+        while (true)
         {
-            m_sendMessageThreadId = 0;
-            return false;
+            if (m_stop)
+            {
+                break;
+            }
+            
+            // Sleep until woken or the next periodic wake, only if idle. 
+            if (!m_pActiveMessage)
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_wakeMutex);
+                g_cond_wait_until(&m_wakeCond, &m_wakeMutex, 
+                    g_get_monotonic_time() + 
+                        DSL_MAILER_WAKE_INTERVAL_MS*G_TIME_SPAN_MILLISECOND);
+            }
+            
+            flushDigests();
+            
+            gint64 now = g_get_monotonic_time();
+            
+            // Start the next transfer if idle and permitted by the rate limit.
+            if (!m_pActiveMessage and now >= m_nextSendTime)
+            {
+                std::shared_ptr<SmtpMessage> pMessage = m_pMessageQueue.PopFront();
+                if (pMessage)
+                {
+                    uint maxPerMinute(m_maxPerMinute);
+                    m_nextSendTime = (maxPerMinute)
+                        ? now + (60*G_TIME_SPAN_SECOND)/maxPerMinute
+                        : 0;
+                    
+                    if (!beginTransfer(pMessage))
+                    {
+                        m_failedCount++;
+                    }
+                }
+            }
+            if (!m_pActiveMessage)
+            {
+                continue;
+            }
+            
+            // Drive the transfer, waiting on socket activity for no longer 
+            // than the wake interval so that a stop request is serviced.
+            int running(0);
+            curl_multi_perform(m_pMulti, &running);
+            if (running)
+            {
+                curl_multi_wait(m_pMulti, NULL, 0, 
+                    DSL_MAILER_WAKE_INTERVAL_MS, NULL);
+            }
+            
+            int remaining(0);
+            CURLMsg* pMsg;
+            while ((pMsg = curl_multi_info_read(m_pMulti, &remaining)))
+            {
+                if (pMsg->msg == CURLMSG_DONE)
+                {
+                    endTransfer(pMsg->data.result);
+                }
+            }
         }
         
-        std::shared_ptr<SmtpMessage> message = m_pMessageQueue.PopFront();
-
-        CURL* pCurl = curl_easy_init();
-        if(!pCurl)
+        // Abort any transfer in progress. Messages still queued are dropped,
+        // as they were before when the Mailer was deleted.
+        if (m_pActiveMessage)
+        {
+            endTransfer(CURLE_ABORTED_BY_CALLBACK);
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_commsMutex);
+        
+        uint remaining = m_pMessageQueue.Size();
+        if (remaining or m_digests.size())
         {
-            LOG_ERROR("curl_easy_init() failed");
+            LOG_WARN("Mailer '" << GetName() << "' stopped with " << remaining 
+                << " queued messages and " << m_digests.size() 
+                << " pending digests unsent");
         }
+    }
+    
+    bool Mailer::beginTransfer(std::shared_ptr<SmtpMessage> pMessage)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_commsMutex);
+        
+        // Reset the options from the previous transfer. The connection, 
+        // if still alive, is kept in the multi handle's cache for reuse.
+        curl_easy_reset(m_pCurl);
         
         // Set the options for this curl sesion
         if (m_sslEnabled)
         {
-            curl_easy_setopt(pCurl, CURLOPT_USE_SSL, CURLUSESSL_ALL);
-            curl_easy_setopt(pCurl, CURLOPT_USERNAME, m_username.c_str());
-            curl_easy_setopt(pCurl, CURLOPT_PASSWORD, m_password.c_str());
+            curl_easy_setopt(m_pCurl, CURLOPT_USE_SSL, CURLUSESSL_ALL);
+            curl_easy_setopt(m_pCurl, CURLOPT_USERNAME, m_username.c_str());
+            curl_easy_setopt(m_pCurl, CURLOPT_PASSWORD, m_password.c_str());
         }
-        curl_easy_setopt(pCurl, CURLOPT_URL, m_mailServerUrl.c_str());
-        curl_easy_setopt(pCurl, CURLOPT_MAIL_FROM, (const char*)m_fromAddress);
-        
+        curl_easy_setopt(m_pCurl, CURLOPT_URL, m_mailServerUrl.c_str());
+        curl_easy_setopt(m_pCurl, CURLOPT_MAIL_FROM, (const char*)m_fromAddress);
+        curl_easy_setopt(m_pCurl, CURLOPT_CONNECTTIMEOUT, 
+            (long)DSL_MAILER_CONNECT_TIMEOUT_SEC);
+        curl_easy_setopt(m_pCurl, CURLOPT_TIMEOUT, 
+            (long)DSL_MAILER_TRANSFER_TIMEOUT_SEC);
+        curl_easy_setopt(m_pCurl, CURLOPT_NOSIGNAL, 1L);
         
         // build a recipient list of all TO and CC addresses
-        curl_slist* recipients(NULL);
-        
         for (auto &ivec: m_toAddresses)
         {
-            recipients = curl_slist_append(recipients, (const char*)ivec);
+            m_pRecipients = curl_slist_append(m_pRecipients, (const char*)ivec);
         }
         for (auto &ivec: m_ccAddresses)
         {
-            recipients = curl_slist_append(recipients, (const char*)ivec);
+            m_pRecipients = curl_slist_append(m_pRecipients, (const char*)ivec);
         }
-        curl_easy_setopt(pCurl, CURLOPT_MAIL_RCPT, recipients);
+        curl_easy_setopt(m_pCurl, CURLOPT_MAIL_RCPT, m_pRecipients);
         
         // Build and set the message header list.
-        curl_slist* headers(NULL);
-        for (auto &ivec: message->m_header)
+        for (auto &ivec: pMessage->m_header)
         {
-            headers = curl_slist_append(headers, ivec.c_str());
+            m_pHeaders = curl_slist_append(m_pHeaders, ivec.c_str());
         }
-        curl_easy_setopt(pCurl, CURLOPT_HTTPHEADER, headers);
+        curl_easy_setopt(m_pCurl, CURLOPT_HTTPHEADER, m_pHeaders);
  
         // Build the mime message. The inline part is an alternative proposing 
         // the html and the text versions of the e-mail.
-        curl_mime* mime = curl_mime_init(pCurl);
-        curl_mime* alt = curl_mime_init(pCurl);
+        m_pMime = curl_mime_init(m_pCurl);
+        curl_mime* alt = curl_mime_init(m_pCurl);
 
         std::ostringstream inlineHtml;
-        for (auto &ivec: message->m_content)
+        for (auto &ivec: pMessage->m_content)
         {
             inlineHtml << ivec;
         }
@@ -479,58 +809,70 @@ namespace DSL
         curl_mime_type(part, "text/html");
 
         // Create the inline part.
-        part = curl_mime_addpart(mime);
+        part = curl_mime_addpart(m_pMime);
         curl_mime_subparts(part, alt);
         curl_mime_type(part, "multipart/alternative");
         curl_slist* slist = curl_slist_append(NULL, "Content-Disposition: inline");
         curl_mime_headers(part, slist, 1);
 
-        // Add optional file attachement
-        if (message->m_attachment.size())
+        // Add optional file attachements
+        for (auto &ivec: pMessage->m_attachments)
         {
-            part = curl_mime_addpart(mime);
-            curl_mime_filedata(part, message->m_attachment.c_str());
+            part = curl_mime_addpart(m_pMime);
+            curl_mime_filedata(part, ivec.c_str());
             curl_mime_encoder(part, "base64");
         }
 
-        curl_easy_setopt(pCurl, CURLOPT_MIMEPOST, mime);
+        curl_easy_setopt(m_pCurl, CURLOPT_MIMEPOST, m_pMime);
+        
+        m_pActiveMessage = pMessage;
+
+        CURLMcode result = curl_multi_add_handle(m_pMulti, m_pCurl);
+        if (result != CURLM_OK)
+        {
+            LOG_ERROR("libcurl returned " << result << ": '"
+                << curl_multi_strerror(result) << "' adding message with id "
+                << pMessage->GetId());
+            endTransfer(CURLE_FAILED_INIT);
+            return false;
+        }
+        return true;
+    }
+    
+    void Mailer::endTransfer(CURLcode result)
+    {
+        LOG_FUNC();
         
-        // perform the actual send, ReadLine function is called in this context
-        CURLcode result = curl_easy_perform(pCurl);
         if (result == CURLE_OK)
         {
-            LOG_INFO("Email Message with id " << message->GetId() << " sent successfully");
+            LOG_INFO("Email Message with id " << m_pActiveMessage->GetId() 
+                << " sent successfully");
+            m_sentCount++;
         }
-        else
+        // transfers that fail to initialize are counted by the caller.
+        else if (result != CURLE_FAILED_INIT)
         {
             LOG_ERROR("libcurl returned " << result << ": '"
-                << curl_easy_strerror(result) << "' sending message");
+                << curl_easy_strerror(result) << "' sending message with id "
+                << m_pActiveMessage->GetId());
+            m_failedCount++;
         }
+        curl_multi_remove_handle(m_pMulti, m_pCurl);
 
-        // free up all recipients/headers
-        curl_slist_free_all(recipients);       
-        curl_slist_free_all(headers);       
-
-        // clean up resources
-        curl_easy_cleanup(pCurl);
- 
-        // Free multipart message
-        curl_mime_free(mime);        
+        // free up all recipients/headers and the multipart message
+        curl_slist_free_all(m_pRecipients);
+        curl_slist_free_all(m_pHeaders);
+        curl_mime_free(m_pMime);
+        m_pRecipients = NULL;
+        m_pHeaders = NULL;
+        m_pMime = NULL;
         
-        // if there is more than one message to send, return true to reschedule
-        if (!m_pMessageQueue.Size() > 1)
-        {
-            return true;
-        }
-        
-        // otherwise, end the thread
-        m_sendMessageThreadId = 0;
-        return false;
+        m_pActiveMessage = nullptr;
     }
     
-    static gboolean MailerSendMessage(gpointer pMailer)
+    static gpointer MailerSendThread(gpointer pMailer)
     {
-        return static_cast<Mailer*>(pMailer)->SendMessage();
+        static_cast<Mailer*>(pMailer)->Run();
+        return NULL;
     }
 }
-
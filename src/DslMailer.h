@@ -36,6 +36,25 @@ namespace DSL {
     #define DSL_MAILER_PTR std::shared_ptr<Mailer>
     #define DSL_MAILER_NEW(name) \
         std::shared_ptr<Mailer>(new Mailer(name))
+
+    /**
+     * @brief Default maximum number of messages held by a Mailer's outgoing
+     * queue. Messages are dropped according to the queue's policy when full.
+     */
+    #define DSL_MAILER_DEFAULT_QUEUE_MAX_SIZE       100
+    
+    /**
+     * @brief Interval at which the Mailer's send thread wakes to check for
+     * expired digests and queued messages when idle.
+     */
+    #define DSL_MAILER_WAKE_INTERVAL_MS             100
+    
+    /**
+     * @brief Connect and total transfer timeouts applied to each send so 
+     * that an unresponsive server can't hold the send thread indefinitely.
+     */
+    #define DSL_MAILER_CONNECT_TIMEOUT_SEC          10
+    #define DSL_MAILER_TRANSFER_TIMEOUT_SEC         60
     
     /**
      * @class EmailAddress
@@ -185,12 +204,27 @@ namespace DSL {
          * @param[in] ccList recipient CC list of eamils.
          * @param[in] subject subject of this message.
          * @param[in] body unique body content for this message
+         * @param[in] attachment filepath to an optional attachment, empty for none.
          */
         SmtpMessage(const EmailAddresses& toList,
             const EmailAddress& from, const EmailAddresses& ccList,
             const std::string& subject, const std::vector<std::string>& body,
             const std::string& attachment);
         
+        /**
+         * @brief ctor for the SmtpMessageData class with multiple attachments
+         * @param[in] toList recipient TO list of emails
+         * @param[in] from sender's email
+         * @param[in] ccList recipient CC list of eamils.
+         * @param[in] subject subject of this message.
+         * @param[in] body unique body content for this message
+         * @param[in] attachments filepaths to zero or more attachments.
+         */
+        SmtpMessage(const EmailAddresses& toList,
+            const EmailAddress& from, const EmailAddresses& ccList,
+            const std::string& subject, const std::vector<std::string>& body,
+            const std::vector<std::string>& attachments);
+        
         /**
          * @brief dtor for the SmtpMessageData class
          */
@@ -215,9 +249,9 @@ namespace DSL {
         std::vector<std::string> m_content;
         
         /**
-         * @brief filepath to the (optional) attachment
+         * @brief filepaths to the (optional) attachments
          */
-        std::string m_attachment;
+        std::vector<std::string> m_attachments;
     
     private:
     
@@ -287,7 +321,8 @@ namespace DSL {
 
     /**
      * @class SmtpMessageQueue
-     * @brief Implements a self-purging outgoing SMPT message queue
+     * @brief Implements a bounded outgoing SMPT message queue. Messages are
+     * dropped according to the queue's policy when full.
      */
     class SmtpMessageQueue
     {
@@ -295,8 +330,9 @@ namespace DSL {
     
         /**
          * @brief ctor for the SmtpMessageQueue class
+         * @param[in] maxSize maximum number of messages to hold.
          */
-        SmtpMessageQueue();
+        SmtpMessageQueue(uint maxSize=DSL_MAILER_DEFAULT_QUEUE_MAX_SIZE);
         
         /**
          * @brief dtor for the SmtpMessageQueue class
@@ -304,7 +340,8 @@ namespace DSL {
         ~SmtpMessageQueue();
         
         /**
-         * @brief inserts a new SMTP Message
+         * @brief inserts a new SMTP Message. If the queue is full, either the
+         * oldest queued message or the new message is dropped per the policy.
          * @param message new message to queue
          * @return true if the message could be queue successfully, false otherwise.
          */
@@ -314,13 +351,13 @@ namespace DSL {
          * @brief queries the queue to see if the Queue is empty
          * @return true if the queue is emptry, false other
          */
-        bool IsEmpty(){return m_queue.empty();};
+        bool IsEmpty();
 
         /**
          * @brief queries the queue for its current size - number of entries
          * @return the current size of the queue
          */
-        uint Size(){return m_queue.size();};
+        uint Size();
         
         /**
          * @brief returns a pointer to the element at the front of the Queue
@@ -340,6 +377,27 @@ namespace DSL {
          */
         void SetEnabled(bool enabled);
         
+        /**
+         * @brief gets the current max-size and overflow policy for the queue
+         * @param[out] maxSize maximum number of messages the queue will hold.
+         * @param[out] policy one of the DSL_MAILER_QUEUE_POLICY constants.
+         */
+        void GetSettings(uint* maxSize, uint* policy);
+        
+        /**
+         * @brief sets the max-size and overflow policy for the queue. Messages
+         * in excess of a reduced max-size are dropped, oldest first.
+         * @param[in] maxSize maximum number of messages the queue will hold.
+         * @param[in] policy one of the DSL_MAILER_QUEUE_POLICY constants.
+         */
+        void SetSettings(uint maxSize, uint policy);
+        
+        /**
+         * @brief gets the number of messages dropped because the queue was full.
+         * @return total number of dropped messages.
+         */
+        uint64_t GetDroppedCount();
+        
     private:
     
         /**
@@ -347,20 +405,59 @@ namespace DSL {
          */
         bool m_enabled;
         
+        /**
+         * @brief maximum number of messages the queue will hold.
+         */
+        uint m_maxSize;
+        
+        /**
+         * @brief one of the DSL_MAILER_QUEUE_POLICY constants.
+         */
+        uint m_policy;
+        
+        /**
+         * @brief number of messages dropped because the queue was full.
+         */
+        uint64_t m_droppedCount;
+        
         /**
          * @brief mutex to protect mutual access to queue data
          */
         GMutex m_queueMutex;
 
         /**
-         * @brief Queue of SMTP Messages in one of three states.
+         * @brief Queue of SMTP Messages waiting to be sent.
+         */
+        std::deque<std::shared_ptr<SmtpMessage>> m_queue;
+    };
+
+    /**
+     * @struct SmtpDigest
+     * @brief Collects the body content and attachments of all messages queued
+     * with the same subject within a Mailer's digest window, to be sent as a 
+     * single message when the window expires or the digest is full.
+     */
+    struct SmtpDigest
+    {
+        /**
+         * @brief monotonic time the first message was added to the digest
          */
-        std::queue<std::shared_ptr<SmtpMessage>> m_queue;
+        gint64 m_startTime;
         
         /**
-         * @brief gnome timer id for the self purging 
+         * @brief number of messages added to the digest
          */
-        uint m_purgeTimerId;
+        uint m_count;
+        
+        /**
+         * @brief combined body content of all messages added.
+         */
+        std::vector<std::string> m_body;
+        
+        /**
+         * @brief combined attachments of all messages added.
+         */
+        std::vector<std::string> m_attachments;
     };
 
 
@@ -470,7 +567,10 @@ namespace DSL {
         bool IsSetup();
         
         /**
-         * @brief Queues a Message to be sent to all current recepients
+         * @brief Queues a Message to be sent to all current recepients. The
+         * call never blocks on the mail server; messages are sent by the 
+         * Mailer's send thread. If digests are enabled, the message is merged
+         * into the pending digest for the same subject.
          * @param[in] subject subject line for the email /r/n terminated
          * @param[in] body message body to add, each line /r/n terminated
          * @param[in] attachment (optional) filepath to the attachment to add
@@ -480,12 +580,95 @@ namespace DSL {
             const std::vector<std::string>& body, const std::string& attachment="");
 
         /**
-         * @brief background thread function to send a pending SMTP message
-         * @return true if the message was sent successfully, false otherwise
+         * @brief Gets the current outgoing queue settings.
+         * @param[out] maxSize maximum number of messages the queue will hold.
+         * @param[out] policy one of the DSL_MAILER_QUEUE_POLICY constants.
+         */
+        void GetQueueSettings(uint* maxSize, uint* policy);
+        
+        /**
+         * @brief Sets the outgoing queue settings.
+         * @param[in] maxSize maximum number of messages the queue will hold.
+         * @param[in] policy one of the DSL_MAILER_QUEUE_POLICY constants.
+         */
+        void SetQueueSettings(uint maxSize, uint policy);
+        
+        /**
+         * @brief Gets the current rate limit for outgoing messages.
+         * @return maximum messages to send per minute, 0 = unlimited.
+         */
+        uint GetRateLimit();
+        
+        /**
+         * @brief Sets the rate limit for outgoing messages.
+         * @param[in] maxPerMinute maximum messages to send per minute, 
+         * 0 = unlimited.
          */
-        bool SendMessage();
+        void SetRateLimit(uint maxPerMinute);
+        
+        /**
+         * @brief Gets the current digest settings.
+         * @param[out] window digest window in seconds, 0 = digests disabled.
+         * @param[out] maxMessages maximum messages to merge into one digest,
+         * 0 = no limit.
+         */
+        void GetDigestSettings(uint* window, uint* maxMessages);
+        
+        /**
+         * @brief Sets the digest settings. Pending digests are sent on the
+         * next wake of the send thread if the window is reduced or disabled.
+         * @param[in] window digest window in seconds, 0 = digests disabled.
+         * @param[in] maxMessages maximum messages to merge into one digest,
+         * 0 = no limit.
+         */
+        void SetDigestSettings(uint window, uint maxMessages);
+        
+        /**
+         * @brief Gets the current delivery statistics for this Mailer.
+         * @param[out] sent number of messages sent successfully.
+         * @param[out] failed number of messages that failed to send.
+         * @param[out] dropped number of messages dropped on queue overflow.
+         */
+        void GetStats(uint64_t* sent, uint64_t* failed, uint64_t* dropped);
+        
+        /**
+         * @brief Send thread function. Flushes expired digests and sends 
+         * queued messages using a curl multi handle, reusing the connection 
+         * to the mail server between messages.
+         */
+        void Run();
         
     private:
+    
+        /**
+         * @brief Builds a message from a pending digest and pushes it onto 
+         * the outgoing queue. The caller must hold the comms mutex.
+         * @param[in] subject subject of the digest to queue.
+         * @param[in] digest pending digest to build the message from.
+         * @return true if successfully queued, false otherwise
+         */
+        bool queueDigest(const std::string& subject, const SmtpDigest& digest);
+        
+        /**
+         * @brief Queues all pending digests that have expired, or all pending
+         * digests if digests have since been disabled.
+         */
+        void flushDigests();
+        
+        /**
+         * @brief Sets up and adds a transfer for a message to the multi handle.
+         * Called by the send thread only.
+         * @param[in] pMessage message to begin sending.
+         * @return true if the transfer was added successfully.
+         */
+        bool beginTransfer(std::shared_ptr<SmtpMessage> pMessage);
+        
+        /**
+         * @brief Removes and frees the current transfer, updating the stats
+         * with the result. Called by the send thread only.
+         * @param[in] result libcurl result of the completed transfer.
+         */
+        void endTransfer(CURLcode result);
 
         /**
          * @brief mutex to protect mutual access to comms data
@@ -528,18 +711,82 @@ namespace DSL {
         EmailAddresses m_ccAddresses;
 
         /**
-         * @brief gnome thread id for the background send message thread
+         * @brief queue of pending messages waiting for the send thread.
          */
-        uint m_sendMessageThreadId;
+        SmtpMessageQueue m_pMessageQueue;
         
         /**
-         * @brief queue of pending, in-progress, and complete (in a 
-         * state of waiting to be purged) messages.
+         * @brief maximum messages to send per minute, 0 = unlimited.
          */
-        SmtpMessageQueue m_pMessageQueue;
+        std::atomic<uint> m_maxPerMinute;
+        
+        /**
+         * @brief earliest monotonic time the next message can be sent
+         * under the current rate limit. Used by the send thread only.
+         */
+        gint64 m_nextSendTime;
+        
+        /**
+         * @brief digest window in seconds, 0 = digests disabled.
+         */
+        uint m_digestWindow;
+        
+        /**
+         * @brief maximum messages to merge into one digest, 0 = no limit.
+         */
+        uint m_digestMaxMessages;
+        
+        /**
+         * @brief map of pending digests keyed by subject.
+         */
+        std::map<std::string, SmtpDigest> m_digests;
+        
+        /**
+         * @brief delivery statistics.
+         */
+        std::atomic<uint64_t> m_sentCount;
+        std::atomic<uint64_t> m_failedCount;
+        
+        /**
+         * @brief curl multi and easy handles owned by the send thread. The 
+         * easy handle is reused for every message so that its connection 
+         * to the mail server is kept alive in the multi handle's cache.
+         */
+        CURLM* m_pMulti;
+        CURL* m_pCurl;
+        
+        /**
+         * @brief message currently being sent and its curl resources, 
+         * nullptr/NULL when idle. Used by the send thread only.
+         */
+        std::shared_ptr<SmtpMessage> m_pActiveMessage;
+        curl_slist* m_pRecipients;
+        curl_slist* m_pHeaders;
+        curl_mime* m_pMime;
+        
+        /**
+         * @brief set to stop the send thread.
+         */
+        std::atomic<bool> m_stop;
+        
+        /**
+         * @brief background thread that sends all queued messages.
+         */
+        GThread* m_pSendThread;
+
+        /**
+         * @brief mutex and condition used to wake the send thread.
+         */
+        GMutex m_wakeMutex;
+        GCond m_wakeCond;
     };
 
-    static int MailerSendMessage(gpointer pMailer);
+    /**
+     * @brief Thread function for the Mailer's send thread.
+     * @param pMailer pointer to the Mailer to run.
+     * @return NULL always.
+     */
+    static gpointer MailerSendThread(gpointer pMailer);
     
     /**
      * @struct MailerSpecs
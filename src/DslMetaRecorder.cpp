@@ -0,0 +1,426 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslMetaRecorder.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace DSL
+{
+    MetaRecordWriter::MetaRecordWriter(const char* name, const char* filePath)
+        : m_name(name)
+        , m_filePath(filePath)
+        , m_fd(-1)
+        , m_batchCount(0)
+        , m_droppedCount(0)
+        , m_stop(false)
+        , m_pWriterThread(NULL)
+    {
+        LOG_FUNC();
+        
+        m_buffer.reserve(DSL_META_RECORD_WRITER_BUFFER_SIZE);
+        
+        m_fd = open(m_filePath.c_str(), 
+            O_WRONLY | O_CREAT | O_CLOEXEC | O_TRUNC, 0644);
+        if (m_fd < 0)
+        {
+            LOG_ERROR("Meta Record Writer for '" << name 
+                << "' failed to open file '" << filePath << "'");
+            throw std::runtime_error("failed to open meta record file");
+        }
+        
+        // magic, version, and record size so readers can validate the layout.
+        uint32_t version(DSL_META_RECORD_VERSION);
+        uint32_t recordSize(sizeof(MetaRecord));
+        m_buffer.append(DSL_META_RECORD_MAGIC, sizeof(DSL_META_RECORD_MAGIC));
+        m_buffer.append((const char*)&version, sizeof(version));
+        m_buffer.append((const char*)&recordSize, sizeof(recordSize));
+        writeBuffer();
+        
+        g_mutex_init(&m_wakeMutex);
+        g_cond_init(&m_wakeCond);
+        
+        m_pWriterThread = g_thread_new(NULL, MetaRecordWriterThread, this);
+    }
+    
+    MetaRecordWriter::~MetaRecordWriter()
+    {
+        LOG_FUNC();
+        
+        m_stop = true;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_wakeMutex);
+            g_cond_signal(&m_wakeCond);
+        }
+        g_thread_join(m_pWriterThread);
+        
+        g_cond_clear(&m_wakeCond);
+        g_mutex_clear(&m_wakeMutex);
+        
+        close(m_fd);
+        
+        if (m_droppedCount)
+        {
+            LOG_WARN("Meta Record Writer for '" << m_name << "' dropped " 
+                << m_droppedCount << " batches - queue full");
+        }
+    }
+    
+    bool MetaRecordWriter::WriteBatch(NvDsBatchMeta* pBatchMeta)
+    {
+        // No function log - avoid overhead.
+        
+        // count the records first, a batch is queued whole or not at all.
+        size_t recordCount(1);
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+            recordCount += 1 + g_list_length(pFrameMeta->obj_meta_list);
+        }
+        
+        // the consumer only frees space, so this check is conservative.
+        if (recordCount > DSL_META_RECORD_WRITER_QUEUE_SIZE - m_queue.Size())
+        {
+            // log the first drop only, the total is logged on close.
+            if (m_droppedCount.fetch_add(1, std::memory_order_relaxed) == 0)
+            {
+                LOG_WARN("Meta Record Writer for '" << m_name 
+                    << "' is dropping batches - queue full");
+            }
+            return false;
+        }
+        
+        MetaRecord record;
+        memset(&record, 0, sizeof(record));
+        record.m_type = DSL_META_RECORD_TYPE_BATCH;
+        record.m_count = g_list_length(pBatchMeta->frame_meta_list);
+        m_queue.Push(record);
+        
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+            
+            memset(&record, 0, sizeof(record));
+            record.m_type = DSL_META_RECORD_TYPE_FRAME;
+            record.m_count = g_list_length(pFrameMeta->obj_meta_list);
+            record.m_frame.m_pts = pFrameMeta->buf_pts;
+            record.m_frame.m_ntpTimestamp = pFrameMeta->ntp_timestamp;
+            record.m_frame.m_sourceId = pFrameMeta->source_id;
+            record.m_frame.m_frameNum = pFrameMeta->frame_num;
+            record.m_frame.m_frameWidth = pFrameMeta->source_frame_width;
+            record.m_frame.m_frameHeight = pFrameMeta->source_frame_height;
+            m_queue.Push(record);
+            
+            for (NvDsMetaList* pObjectMetaList = pFrameMeta->obj_meta_list; 
+                pObjectMetaList; pObjectMetaList = pObjectMetaList->next)
+            {
+                NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*)(pObjectMetaList->data);
+                
+                memset(&record, 0, sizeof(record));
+                record.m_type = DSL_META_RECORD_TYPE_OBJECT;
+                record.m_object.m_trackingId = pObjectMeta->object_id;
+                record.m_object.m_classId = pObjectMeta->class_id;
+                record.m_object.m_inferId = pObjectMeta->unique_component_id;
+                record.m_object.m_confidence = pObjectMeta->confidence;
+                record.m_object.m_trackerConfidence = pObjectMeta->tracker_confidence;
+                record.m_object.m_left = pObjectMeta->rect_params.left;
+                record.m_object.m_top = pObjectMeta->rect_params.top;
+                record.m_object.m_width = pObjectMeta->rect_params.width;
+                record.m_object.m_height = pObjectMeta->rect_params.height;
+                m_queue.Push(record);
+            }
+        }
+        m_batchCount.fetch_add(1, std::memory_order_relaxed);
+        
+        // Wake the writer early if the queue is getting full. Otherwise the 
+        // writer will pick up the records on its next periodic wake. 
+        if (m_queue.Size() >= DSL_META_RECORD_WRITER_QUEUE_SIZE/2)
+        {
+            g_cond_signal(&m_wakeCond);
+        }
+        return true;
+    }
+    
+    void MetaRecordWriter::GetStats(uint64_t* batches, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        
+        *batches = m_batchCount;
+        *dropped = m_droppedCount;
+    }
+
+    void MetaRecordWriter::Run()
+    {
+        LOG_FUNC();
+        
+        while (true)
+        {
+            bool stopping(m_stop);
+            
+            if (!stopping)
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_wakeMutex);
+                g_cond_wait_until(&m_wakeCond, &m_wakeMutex, 
+                    g_get_monotonic_time() + 
+                        DSL_META_RECORD_WRITER_WAKE_INTERVAL_MS*G_TIME_SPAN_MILLISECOND);
+            }
+            
+            // copy all queued records, writing whenever the buffer fills.
+            const MetaRecord* pRecord;
+            while ((pRecord = m_queue.Front()))
+            {
+                m_buffer.append((const char*)pRecord, sizeof(MetaRecord));
+                m_queue.Pop();
+                
+                if (m_buffer.size() >= DSL_META_RECORD_WRITER_BUFFER_SIZE)
+                {
+                    writeBuffer();
+                }
+            }
+            writeBuffer();
+            
+            if (stopping)
+            {
+                break;
+            }
+        }
+    }
+    
+    void MetaRecordWriter::writeBuffer()
+    {
+        if (m_buffer.empty())
+        {
+            return;
+        }
+        const char* pData = m_buffer.data();
+        size_t remaining = m_buffer.size();
+        
+        while (remaining)
+        {
+            ssize_t written = write(m_fd, pData, remaining);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                LOG_ERROR("Meta Record Writer for '" << m_name 
+                    << "' failed to write to file '" << m_filePath 
+                    << "' errno = " << errno);
+                break;
+            }
+            pData += written;
+            remaining -= written;
+        }
+        m_buffer.clear();
+    }
+    
+    static gpointer MetaRecordWriterThread(gpointer pWriter)
+    {
+        static_cast<MetaRecordWriter*>(pWriter)->Run();
+        return NULL;
+    }
+    
+    //----------------------------------------------------------------------------------------------
+    
+    MetaRecordReader::MetaRecordReader(const char* filePath)
+        : m_filePath(filePath)
+        , m_pFile(NULL)
+        , m_pBuffer(NULL)
+        , m_pBatchMeta(NULL)
+        , m_maxBatchSize(0)
+        , m_frameCount(0)
+    {
+        LOG_FUNC();
+        
+        m_pFile = fopen(filePath, "rb");
+        if (!m_pFile)
+        {
+            LOG_ERROR("Meta Record Reader failed to open file '" << filePath << "'");
+            throw std::runtime_error("failed to open meta record file");
+        }
+        
+        char magic[sizeof(DSL_META_RECORD_MAGIC)];
+        uint32_t version(0), recordSize(0);
+        
+        if (fread(magic, sizeof(magic), 1, m_pFile) != 1 or
+            fread(&version, sizeof(version), 1, m_pFile) != 1 or
+            fread(&recordSize, sizeof(recordSize), 1, m_pFile) != 1 or
+            memcmp(magic, DSL_META_RECORD_MAGIC, sizeof(magic)) or
+            version != DSL_META_RECORD_VERSION or
+            recordSize != sizeof(MetaRecord))
+        {
+            LOG_ERROR("Meta Record Reader found an invalid header in file '" 
+                << filePath << "'");
+            fclose(m_pFile);
+            throw std::runtime_error("invalid meta record file");
+        }
+        
+        // start with a typical batch size, grown on demand.
+        createBatch(16);
+    }
+    
+    MetaRecordReader::~MetaRecordReader()
+    {
+        LOG_FUNC();
+        
+        if (m_pBuffer)
+        {
+            // releases the batch meta as well
+            gst_buffer_unref(m_pBuffer);
+        }
+        fclose(m_pFile);
+    }
+    
+    bool MetaRecordReader::ReadBatch()
+    {
+        // Do not log function entry - called for every batch
+        
+        MetaRecord record;
+        if (!readRecord(record))
+        {
+            return false;
+        }
+        if (record.m_type != DSL_META_RECORD_TYPE_BATCH)
+        {
+            LOG_ERROR("Meta Record Reader found an unexpected record in file '" 
+                << m_filePath << "'");
+            return false;
+        }
+        uint frameCount(record.m_count);
+        
+        if (frameCount > m_maxBatchSize)
+        {
+            createBatch(frameCount);
+        }
+        else
+        {
+            clearBatch();
+        }
+        
+        for (uint i = 0; i < frameCount; i++)
+        {
+            if (!readRecord(record) or record.m_type != DSL_META_RECORD_TYPE_FRAME)
+            {
+                LOG_ERROR("Meta Record Reader found a truncated batch in file '" 
+                    << m_filePath << "'");
+                return false;
+            }
+            NvDsFrameMeta* pFrameMeta = nvds_acquire_frame_meta_from_pool(m_pBatchMeta);
+            pFrameMeta->source_id = record.m_frame.m_sourceId;
+            pFrameMeta->pad_index = record.m_frame.m_sourceId;
+            pFrameMeta->batch_id = i;
+            pFrameMeta->frame_num = record.m_frame.m_frameNum;
+            pFrameMeta->buf_pts = record.m_frame.m_pts;
+            pFrameMeta->ntp_timestamp = record.m_frame.m_ntpTimestamp;
+            pFrameMeta->source_frame_width = record.m_frame.m_frameWidth;
+            pFrameMeta->source_frame_height = record.m_frame.m_frameHeight;
+            pFrameMeta->bInferDone = true;
+            nvds_add_frame_meta_to_batch(m_pBatchMeta, pFrameMeta);
+            
+            uint objectCount(record.m_count);
+            
+            for (uint j = 0; j < objectCount; j++)
+            {
+                if (!readRecord(record) or record.m_type != DSL_META_RECORD_TYPE_OBJECT)
+                {
+                    LOG_ERROR("Meta Record Reader found a truncated frame in file '" 
+                        << m_filePath << "'");
+                    return false;
+                }
+                NvDsObjectMeta* pObjectMeta = 
+                    nvds_acquire_obj_meta_from_pool(m_pBatchMeta);
+                pObjectMeta->object_id = record.m_object.m_trackingId;
+                pObjectMeta->class_id = record.m_object.m_classId;
+                pObjectMeta->unique_component_id = record.m_object.m_inferId;
+                pObjectMeta->confidence = record.m_object.m_confidence;
+                pObjectMeta->tracker_confidence = record.m_object.m_trackerConfidence;
+                pObjectMeta->rect_params.left = record.m_object.m_left;
+                pObjectMeta->rect_params.top = record.m_object.m_top;
+                pObjectMeta->rect_params.width = record.m_object.m_width;
+                pObjectMeta->rect_params.height = record.m_object.m_height;
+                nvds_add_obj_meta_to_frame(pFrameMeta, pObjectMeta, NULL);
+            }
+            m_frameCount++;
+        }
+        return true;
+    }
+    
+    bool MetaRecordReader::readRecord(MetaRecord& record)
+    {
+        return fread(&record, sizeof(MetaRecord), 1, m_pFile) == 1;
+    }
+    
+    void MetaRecordReader::clearBatch()
+    {
+        for (NvDsMetaList* pFrameMetaList = m_pBatchMeta->frame_meta_list; 
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+            
+            if (pFrameMeta->obj_meta_list)
+            {
+                nvds_clear_obj_meta_list(pFrameMeta, pFrameMeta->obj_meta_list);
+                pFrameMeta->obj_meta_list = NULL;
+                pFrameMeta->num_obj_meta = 0;
+            }
+            if (pFrameMeta->display_meta_list)
+            {
+                nvds_clear_display_meta_list(pFrameMeta, 
+                    pFrameMeta->display_meta_list);
+                pFrameMeta->display_meta_list = NULL;
+                pFrameMeta->num_display_meta = 0;
+            }
+        }
+        if (m_pBatchMeta->frame_meta_list)
+        {
+            nvds_clear_frame_meta_list(m_pBatchMeta, m_pBatchMeta->frame_meta_list);
+            m_pBatchMeta->frame_meta_list = NULL;
+            m_pBatchMeta->num_frames_in_batch = 0;
+        }
+    }
+    
+    void MetaRecordReader::createBatch(uint maxBatchSize)
+    {
+        LOG_FUNC();
+        
+        if (m_pBuffer)
+        {
+            gst_buffer_unref(m_pBuffer);
+        }
+        m_maxBatchSize = maxBatchSize;
+        m_pBatchMeta = nvds_create_batch_meta(m_maxBatchSize);
+        m_pBuffer = gst_buffer_new();
+        
+        // attach the batch meta as nvstreammux does, the buffer takes ownership.
+        NvDsMeta* pMeta = gst_buffer_add_nvds_meta(m_pBuffer, m_pBatchMeta, NULL,
+            nvds_batch_meta_copy_func, nvds_batch_meta_release_func);
+        pMeta->meta_type = NVDS_BATCH_GST_META;
+        m_pBatchMeta->base_meta.batch_meta = m_pBatchMeta;
+    }
+}
@@ -0,0 +1,261 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_META_RECORDER_H
+#define _DSL_META_RECORDER_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslOdeEventWriter.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_META_RECORD_WRITER_PTR std::shared_ptr<MetaRecordWriter>
+    #define DSL_META_RECORD_WRITER_NEW(name, filePath) \
+        std::shared_ptr<MetaRecordWriter>(new MetaRecordWriter(name, filePath))
+
+    #define DSL_META_RECORD_READER_PTR std::shared_ptr<MetaRecordReader>
+    #define DSL_META_RECORD_READER_NEW(filePath) \
+        std::shared_ptr<MetaRecordReader>(new MetaRecordReader(filePath))
+
+    #define DSL_META_RECORD_WRITER_QUEUE_SIZE       8192
+    #define DSL_META_RECORD_WRITER_BUFFER_SIZE      262144
+    #define DSL_META_RECORD_WRITER_WAKE_INTERVAL_MS 50
+    
+    #define DSL_META_RECORD_MAGIC                   "DSLMETA"
+    #define DSL_META_RECORD_VERSION                 1
+    
+    /**
+     * @brief Meta Record types. A batch record is followed by "count" frame 
+     * records, and each frame record by "count" object records.
+     */
+    #define DSL_META_RECORD_TYPE_BATCH              0
+    #define DSL_META_RECORD_TYPE_FRAME              1
+    #define DSL_META_RECORD_TYPE_OBJECT             2
+
+    /**
+     * @struct MetaRecordFrame
+     * @brief Frame data for a DSL_META_RECORD_TYPE_FRAME record.
+     */
+    struct MetaRecordFrame
+    {
+        uint64_t m_pts;
+        uint64_t m_ntpTimestamp;
+        uint32_t m_sourceId;
+        uint32_t m_frameNum;
+        uint32_t m_frameWidth;
+        uint32_t m_frameHeight;
+    };
+    
+    /**
+     * @struct MetaRecordObject
+     * @brief Object data for a DSL_META_RECORD_TYPE_OBJECT record.
+     */
+    struct MetaRecordObject
+    {
+        uint64_t m_trackingId;
+        int32_t m_classId;
+        int32_t m_inferId;
+        float m_confidence;
+        float m_trackerConfidence;
+        float m_left;
+        float m_top;
+        float m_width;
+        float m_height;
+    };
+    
+    /**
+     * @struct MetaRecord
+     * @brief Fixed size (48 byte) record written to and read from a Meta 
+     * Record file. The file is a small header followed by a flat sequence 
+     * of records in batch, frame, object order.
+     */
+    struct MetaRecord
+    {
+        /**
+         * @brief one of the DSL_META_RECORD_TYPE constants.
+         */
+        uint32_t m_type;
+        
+        /**
+         * @brief number of frames in the batch, or objects in the frame,
+         * that follow this record. Unused for object records.
+         */
+        uint32_t m_count;
+        
+        union
+        {
+            MetaRecordFrame m_frame;
+            MetaRecordObject m_object;
+        };
+    };
+
+    /**
+     * @class MetaRecordWriter
+     * @brief Writes the frame and object metadata of each batch to a Meta 
+     * Record file in a background thread. The streaming thread only copies
+     * fixed size records into a lock-free queue.
+     */
+    class MetaRecordWriter
+    {
+    public:
+    
+        /**
+         * @brief ctor for the MetaRecordWriter class
+         * @param[in] name name of the owner, for logging.
+         * @param[in] filePath path to the file to create. Any existing
+         * file is truncated.
+         */
+        MetaRecordWriter(const char* name, const char* filePath);
+        
+        ~MetaRecordWriter();
+        
+        /**
+         * @brief Queues the records for all frames and objects in a batch. 
+         * The batch is dropped as a whole if the queue can't hold all records 
+         * so that the file never contains a partial batch.
+         * ** Streaming thread only **
+         * @param[in] pBatchMeta batch meta to record.
+         * @return false if the batch was dropped, true otherwise.
+         */
+        bool WriteBatch(NvDsBatchMeta* pBatchMeta);
+        
+        /**
+         * @brief Gets the number of batches queued and dropped.
+         * @param[out] batches number of batches queued for writing.
+         * @param[out] dropped number of batches dropped - queue full.
+         */
+        void GetStats(uint64_t* batches, uint64_t* dropped);
+        
+        /**
+         * @brief Writer thread function.
+         */
+        void Run();
+        
+    private:
+    
+        /**
+         * @brief writes all of m_buffer to file and clears it.
+         */
+        void writeBuffer();
+        
+        std::string m_name;
+        
+        std::string m_filePath;
+        
+        int m_fd;
+        
+        std::string m_buffer;
+        
+        SpscRingBuffer<MetaRecord, DSL_META_RECORD_WRITER_QUEUE_SIZE> m_queue;
+        
+        std::atomic<uint64_t> m_batchCount;
+        
+        std::atomic<uint64_t> m_droppedCount;
+        
+        std::atomic<bool> m_stop;
+        
+        GThread* m_pWriterThread;
+
+        GMutex m_wakeMutex;
+        GCond m_wakeCond;
+    };
+    
+    static gpointer MetaRecordWriterThread(gpointer pWriter);
+
+    /**
+     * @class MetaRecordReader
+     * @brief Reads a Meta Record file one batch at a time, rebuilding each
+     * batch as synthetic NvDsBatchMeta attached to a GstBuffer - as 
+     * nvstreammux would - so the batch can be passed to any Pad Probe 
+     * Handler without a pipeline, GPU, or clock.
+     */
+    class MetaRecordReader
+    {
+    public:
+    
+        /**
+         * @brief ctor for the MetaRecordReader class
+         * @param[in] filePath path to the Meta Record file to read.
+         * @throws if the file can't be opened or has an invalid header.
+         */
+        MetaRecordReader(const char* filePath);
+        
+        ~MetaRecordReader();
+        
+        /**
+         * @brief Reads the next batch from file into the batch meta. All 
+         * meta from the previous batch, including any display meta added
+         * by the previous consumer, is released first.
+         * @return false on end of file or a truncated batch, true otherwise.
+         */
+        bool ReadBatch();
+        
+        /**
+         * @brief Gets the GstBuffer with the batch meta attached.
+         * @return buffer owned by this MetaRecordReader.
+         */
+        GstBuffer* GetBuffer(){return m_pBuffer;};
+
+        /**
+         * @brief Gets the number of frames read since construction.
+         */
+        uint64_t GetFrameCount(){return m_frameCount;};
+        
+    private:
+    
+        /**
+         * @brief reads the next record from file.
+         * @return false on end of file, true otherwise.
+         */
+        bool readRecord(MetaRecord& record);
+        
+        /**
+         * @brief releases all frame, object, and display meta in the batch.
+         */
+        void clearBatch();
+        
+        /**
+         * @brief (re)creates the buffer and batch meta for a max batch size.
+         */
+        void createBatch(uint maxBatchSize);
+        
+        std::string m_filePath;
+        
+        FILE* m_pFile;
+        
+        GstBuffer* m_pBuffer;
+        
+        NvDsBatchMeta* m_pBatchMeta;
+        
+        uint m_maxBatchSize;
+        
+        uint64_t m_frameCount;
+    };
+}
+
+#endif // _DSL_META_RECORDER_H
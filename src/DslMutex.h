@@ -57,6 +57,53 @@ namespace DSL
         GMutex* m_pMutex; 
     };
 
+    #define LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(rwlock) \
+        ReadLockForCurrentScope rlock(rwlock)
+    #define LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(rwlock) \
+        WriteLockForCurrentScope wlock(rwlock)
+
+    /**
+     * @class ReadLockForCurrentScope
+     * @brief Takes a shared reader lock on a GRWLock for the current scope {}.
+     */
+    class ReadLockForCurrentScope
+    {
+    public:
+        ReadLockForCurrentScope(GRWLock* rwlock) : m_pRwLock(rwlock) 
+        {
+            g_rw_lock_reader_lock(m_pRwLock);
+        };
+        
+        ~ReadLockForCurrentScope()
+        {
+            g_rw_lock_reader_unlock(m_pRwLock);
+        };
+        
+    private:
+        GRWLock* m_pRwLock; 
+    };
+
+    /**
+     * @class WriteLockForCurrentScope
+     * @brief Takes an exclusive writer lock on a GRWLock for the current scope {}.
+     */
+    class WriteLockForCurrentScope
+    {
+    public:
+        WriteLockForCurrentScope(GRWLock* rwlock) : m_pRwLock(rwlock) 
+        {
+            g_rw_lock_writer_lock(m_pRwLock);
+        };
+        
+        ~WriteLockForCurrentScope()
+        {
+            g_rw_lock_writer_unlock(m_pRwLock);
+        };
+        
+    private:
+        GRWLock* m_pRwLock; 
+    };
+
     #define UNREF_MESSAGE_ON_RETURN(message) UnrefMessageOnReturn ref(message)
 
     /**
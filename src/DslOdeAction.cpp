@@ -220,11 +220,10 @@ namespace DSL
         }
         try
         {
-            NvDsDisplayMeta* pDisplayMeta(NULL);
-            if (displayMetaData.size())
-            {
-                pDisplayMeta = displayMetaData.at(0);
-            }
+            // Any Display Meta with room, acquired on demand, NULL if disabled.
+            NvDsDisplayMeta* pDisplayMeta = DisplayMetaAllocator::Get(
+                displayMetaData, pFrameMeta, 
+                DisplayMetaAllocator::DISPLAY_META_LABELS, 0);
             DSL_ODE_TRIGGER_PTR pTrigger 
                 = std::dynamic_pointer_cast<OdeTrigger>(pBase);
             m_clientHandler(pTrigger->s_eventCount, pTrigger->m_wName.c_str(), 
@@ -845,7 +844,10 @@ namespace DSL
                         GetName() << "'");
                 }
             }
-            label.copy(pObjectMeta->text_params.display_text, MAX_DISPLAY_LEN, 0);
+            // Object Meta labels stay on the heap - downstream consumers free 
+            // and replace them - but are always NUL terminated.
+            g_strlcpy(pObjectMeta->text_params.display_text, 
+                label.c_str(), MAX_DISPLAY_LEN);
         }
     }
 
@@ -877,31 +879,22 @@ namespace DSL
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        if (m_enabled and displayMetaData.size())
+        if (m_enabled and DisplayMetaAllocator::IsEnabled(displayMetaData))
         {
             DSL_ODE_TRIGGER_PTR pTrigger = 
                 std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
 
-            // check to see if we're adding meta data - client can disable
-            // by setting the PPH ODE display meta alloc size to 0.
-            // and ensure we have available space in the vector of meta structs.
-            NvDsDisplayMeta* pDisplayMeta(NULL);
-            for (const auto& ivec: displayMetaData)
-            {
-                if (ivec->num_labels < MAX_ELEMENTS_IN_DISPLAY_META)
-                {
-                    pDisplayMeta = ivec;
-                    break;
-                }
-            }
+            // get a Display Meta with an available slot, acquired on demand. 
+            // Client can disable by setting the PPH ODE display meta alloc size to 0.
+            NvDsDisplayMeta* pDisplayMeta = DisplayMetaAllocator::Get(displayMetaData, 
+                pFrameMeta, DisplayMetaAllocator::DISPLAY_META_LABELS);
             if (!pDisplayMeta)
             {
                 return;
             }
             
             NvOSD_TextParams *pTextParams = 
-                &displayMetaData.at(0)->text_params[pDisplayMeta->num_labels++];
-            pTextParams->display_text = (gchar*) g_malloc0(MAX_DISPLAY_LEN);
+                &pDisplayMeta->text_params[pDisplayMeta->num_labels++];
             
             std::string text(m_formatString.c_str());
             
@@ -947,25 +940,23 @@ namespace DSL
                             DSL_FRAME_INFO_OCCURRENCES_DIRECTION_OUT]));
                 }
             }
-            text.copy(pTextParams->display_text, MAX_DISPLAY_LEN, 0);
-
+            // copy to an arena slot released with the batch
+            pTextParams->display_text = 
+                DisplayTextArena::Assign(pDisplayMeta, text.c_str());
 
             // Setup X and Y display offsets
             pTextParams->x_offset = m_offsetX;
             pTextParams->y_offset = m_offsetY;
 
-            // Font, font-size, font-color
+            // Font, font-size, font-color - shared interned font name
             pTextParams->font_params = *m_pFont;
-            pTextParams->font_params.font_name = (gchar*) g_malloc0(MAX_DISPLAY_LEN);
-            m_pFont->m_fontName.copy(
-                pTextParams->font_params.font_name, MAX_DISPLAY_LEN, 0);
+            pTextParams->font_params.font_name = DisplayTextArena::Assign(
+                pDisplayMeta, m_pFont->m_fontName.c_str(), m_pFont->font_name);
             
 
             // Text background color
             pTextParams->set_bg_clr = m_hasBgColor;
             pTextParams->text_bg_clr = *m_pBgColor;
-            
-            nvds_add_display_meta_to_frame(pFrameMeta, displayMetaData.at(0));
         }
     }
     
@@ -1075,10 +1066,12 @@ namespace DSL
 
             }
 
+            DSL_ODE_TRIGGER_CONFIG_PTR pConfig = pTrigger->GetConfig();
+
             body.push_back(std::string("  Criteria          : ------------------------<br>"));
             body.push_back(std::string("    Class Id        : " 
-                +  std::to_string(pTrigger->m_classId) + "<br>"));
-            if (pTrigger->m_inferDoneOnly)
+                +  std::to_string(pConfig->m_classId) + "<br>"));
+            if (pConfig->m_inferDoneOnly)
             {
                 body.push_back(std::string("    Infer Done Only       : Yes<br>"));
             }
@@ -1087,20 +1080,20 @@ namespace DSL
                 body.push_back(std::string("    Inference       : No<br>"));
             }
             body.push_back(std::string("    Min Infer Conf  : " 
-                +  std::to_string(pTrigger->m_minConfidence) + "<br>"));
+                +  std::to_string(pConfig->m_minConfidence) + "<br>"));
             body.push_back(std::string("    Min Track Conf  : " 
-                +  std::to_string(pTrigger->m_minConfidence) + "<br>"));
+                +  std::to_string(pConfig->m_minConfidence) + "<br>"));
             body.push_back(std::string("    Min Frame Count : " 
-                +  std::to_string(pTrigger->m_minFrameCountN) + " out of " 
-                +  std::to_string(pTrigger->m_minFrameCountD) + "<br>"));
+                +  std::to_string(pConfig->m_minFrameCountN) + " out of " 
+                +  std::to_string(pConfig->m_minFrameCountD) + "<br>"));
             body.push_back(std::string("    Min Width       : " 
-                +  std::to_string(lrint(pTrigger->m_minWidth)) + "<br>"));
+                +  std::to_string(lrint(pConfig->m_minWidth)) + "<br>"));
             body.push_back(std::string("    Min Height      : " 
-                +  std::to_string(lrint(pTrigger->m_minHeight)) + "<br>"));
+                +  std::to_string(lrint(pConfig->m_minHeight)) + "<br>"));
             body.push_back(std::string("    Max Width       : " 
-                +  std::to_string(lrint(pTrigger->m_maxWidth)) + "<br>"));
+                +  std::to_string(lrint(pConfig->m_maxWidth)) + "<br>"));
             body.push_back(std::string("    Max Height      : " 
-                +  std::to_string(lrint(pTrigger->m_maxHeight)) + "<br>"));
+                +  std::to_string(lrint(pConfig->m_maxHeight)) + "<br>"));
             
             std::dynamic_pointer_cast<Mailer>(m_pMailer)->QueueMessage(m_subject, body);
         }
@@ -1109,427 +1102,145 @@ namespace DSL
     // ********************************************************************
 
     FileOdeAction::FileOdeAction(const char* name,
-        const char* filePath, uint mode, bool forceFlush)
+        const char* filePath, uint mode, uint format, bool forceFlush)
         : OdeAction(name)
         , m_filePath(filePath)
         , m_mode(mode)
-        , m_forceFlush(forceFlush)
-        , m_flushThreadFunctionId(0)
+        , m_format(format)
     {
         LOG_FUNC();
     
-        g_mutex_init(&m_ostreamMutex);
+        m_pEventWriter = DSL_ODE_EVENT_WRITER_NEW(name, 
+            filePath, mode, format, forceFlush);
     }
 
     FileOdeAction::~FileOdeAction()
     {
         LOG_FUNC();
-        
-        if (!m_ostream.is_open())
-        {
-            return;
-        }
-        
-        if (m_flushThreadFunctionId)
-        {
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ostreamMutex);
-            g_source_remove(m_flushThreadFunctionId);
-        }
-            
-        m_ostream.close();
-        g_mutex_clear(&m_ostreamMutex);
     }
     
-    bool FileOdeAction::Flush()
-    {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ostreamMutex);
-        
-        m_ostream.flush();
-        
-        // end the thread
-        m_flushThreadFunctionId = 0;
-        return false;
-    }
-
-    static gboolean FileActionFlush(gpointer pAction)
-    {
-        return static_cast<FileOdeAction*>(pAction)->Flush();
-    }
-
-    FileTextOdeAction::FileTextOdeAction(const char* name,
-        const char* filePath, uint mode, bool forceFlush)
-        : FileOdeAction(name, filePath, mode, forceFlush)
+    void FileOdeAction::GetRotation(uint* maxSize, uint* maxDuration)
     {
         LOG_FUNC();
-
-        // determine if new or existing file
-        std::ifstream streamUriFile(filePath);
-        bool fileExists(streamUriFile.good());
-        
-        try
-        {
-            if (m_mode == DSL_WRITE_MODE_APPEND)
-            {
-                m_ostream.open(m_filePath, std::fstream::out | std::fstream::app);
-            }
-            else
-            {
-                m_ostream.open(m_filePath, std::fstream::out | std::fstream::trunc);
-            }
-        }
-        catch(...) 
-        {
-            LOG_ERROR("New FileTextOdeAction '" << name << "' failed to open");
-            throw;
-        }
-    
-        char dateTime[DATE_BUFF_LENGTH] = {0};
-        time_t seconds = time(NULL);
-        struct tm currentTm;
-        localtime_r(&seconds, &currentTm);
-
-        strftime(dateTime, DATE_BUFF_LENGTH, "%a, %d %b %Y %H:%M:%S %z", 
-            &currentTm);
-        std::string dateTimeStr(dateTime);
         
-        m_ostream << "-------------------------------------------------------------------" << "\n";
-        m_ostream << " File opened: " << dateTimeStr.c_str() << "\n";
-        m_ostream << "-------------------------------------------------------------------" << "\n";
+        m_pEventWriter->GetRotation(maxSize, maxDuration);
     }
-
-    FileTextOdeAction::~FileTextOdeAction()
+    
+    void FileOdeAction::SetRotation(uint maxSize, uint maxDuration)
     {
         LOG_FUNC();
         
-        if (!m_ostream.is_open())
-        {
-            return;
-        }
-        
-        char dateTime[DATE_BUFF_LENGTH] = {0};
-        time_t seconds = time(NULL);
-        struct tm currentTm;
-        localtime_r(&seconds, &currentTm);
-
-        strftime(dateTime, DATE_BUFF_LENGTH, "%a, %d %b %Y %H:%M:%S %z", &currentTm);
-        std::string dateTimeStr(dateTime);
-
-        m_ostream << "-------------------------------------------------------------------" << "\n";
-        m_ostream << " File closed: " << dateTimeStr.c_str() << "\n";
-        m_ostream << "-------------------------------------------------------------------" << "\n";
+        m_pEventWriter->SetRotation(maxSize, maxDuration);
     }
 
-    void FileTextOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+    void FileOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
         GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
+        // The property mutex serializes all producers of the writer's queue
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_ostreamMutex);
 
         if (!m_enabled)
         {
             return;
         }
+        // MOT Challenge format is for Object events only.
+        if (m_format == DSL_EVENT_FILE_FORMAT_MOTC and !pObjectMeta)
+        {
+            return;
+        }
         DSL_ODE_TRIGGER_PTR pTrigger = 
             std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
         
-        m_ostream << "Trigger Name        : " << pTrigger->GetName() << "\n";
-        m_ostream << "  Unique ODE Id     : " << pTrigger->s_eventCount << "\n";
-        m_ostream << "  NTP Timestamp     : " << Ntp2Str(pFrameMeta->ntp_timestamp) << "\n";
-        m_ostream << "  Source Data       : ------------------------" << "\n";
-        if (pFrameMeta->bInferDone)
-        {
-            m_ostream << "    Inference       : Yes\n";
-        }
-        else
-        {
-            m_ostream << "    Inference       : No\n";
+        // Value-initialized for each event so that Frame level events don't
+        // carry the Object data of a previous event.
+        OdeEventRecord record{};
+        
+        g_strlcpy(record.m_triggerName, pTrigger->GetCStrName(), 
+            DSL_ODE_EVENT_RECORD_NAME_SIZE);
+        record.m_eventId = pTrigger->s_eventCount;
+        record.m_occurrences = pTrigger->m_occurrences;
+        
+        record.m_ntpTimestamp = pFrameMeta->ntp_timestamp;
+        record.m_sourceId = pFrameMeta->source_id;
+        record.m_batchId = pFrameMeta->batch_id;
+        record.m_padIndex = pFrameMeta->pad_index;
+        record.m_frameNum = pFrameMeta->frame_num;
+        record.m_frameWidth = pFrameMeta->source_frame_width;
+        record.m_frameHeight = pFrameMeta->source_frame_height;
+        record.m_inferDone = pFrameMeta->bInferDone;
+        for (uint i = 0; i < MAX_USER_FIELDS; i++)
+        {
+            record.m_frameInfo[i] = pFrameMeta->misc_frame_info[i];
         }
-        m_ostream << "    Source Id       : " << pFrameMeta->source_id << "\n";
-        m_ostream << "    Batch Id        : " << pFrameMeta->batch_id << "\n";
-        m_ostream << "    Pad Index       : " << pFrameMeta->pad_index << "\n";
-        m_ostream << "    Frame           : " << pFrameMeta->frame_num << "\n";
-        m_ostream << "    Width           : " << pFrameMeta->source_frame_width << "\n";
-        m_ostream << "    Heigh           : " << pFrameMeta->source_frame_height << "\n";
-        m_ostream << "  Object Data       : ------------------------" << "\n";
-
+        
+        record.m_hasObject = (pObjectMeta != NULL);
         if (pObjectMeta)
         {
-            m_ostream << "    Occurrences     : " << pTrigger->m_occurrences << "\n";
-            m_ostream << "    Obj ClassId     : " << pObjectMeta->class_id << "\n";
-            m_ostream << "    Infer Id        : " << pObjectMeta->unique_component_id << "\n";
-            m_ostream << "    Tracking Id     : " << pObjectMeta->object_id << "\n";
-            m_ostream << "    Label           : " << pObjectMeta->obj_label << "\n";
-            m_ostream << "    Persistence     : " << pObjectMeta->
-                misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] << "\n";
-            if (pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_DIRECTION] == 
-                DSL_AREA_CROSS_DIRECTION_NONE)
-            {
-                m_ostream << "    Direction In    : " << "No\n";
-                m_ostream << "    Direction Out   : " << "No\n";
-            }
-            else if (pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_DIRECTION] == 
-                DSL_AREA_CROSS_DIRECTION_IN)
-            {
-                m_ostream << "    Direction In    : " << "Yes\n";
-                m_ostream << "    Direction Out   : " << "No\n";
-            }
-            else
-            {
-                m_ostream << "    Direction In    : " << "No\n";
-                m_ostream << "    Direction Out   : " << "Yes\n";
-            }
-                
-            m_ostream << "    Infer Conf      : " << pObjectMeta->confidence << "\n";
-            m_ostream << "    Track Conf      : " << pObjectMeta->tracker_confidence << "\n";
-            m_ostream << "    Left            : " << lrint(pObjectMeta->rect_params.left) << "\n";
-            m_ostream << "    Top             : " << lrint(pObjectMeta->rect_params.top) << "\n";
-            m_ostream << "    Width           : " << lrint(pObjectMeta->rect_params.width) << "\n";
-            m_ostream << "    Height          : " << lrint(pObjectMeta->rect_params.height) << "\n";
-        }
-        else
-        {
-            if (pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] == 
-                DSL_FRAME_INFO_OCCURRENCES)
-            {
-                m_ostream << "    Occurrences     : " 
-                    << pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] << "\n";
-            }
-            else if (pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] == 
-                DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN)
-            {
-                m_ostream << "    Occurrences In  : " 
-                    << pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN] << "\n";
-                m_ostream << "    Occurrences Out : " 
-                    << pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_OUT] << "\n";
-            }
-        }
-
-        m_ostream << "  Criteria          : ------------------------" << "\n";
-        m_ostream << "    Class Id        : " << pTrigger->m_classId << "\n";
-        m_ostream << "    Min Infer Conf  : " << pTrigger->m_minConfidence << "\n";
-        m_ostream << "    Min Track Conf  : " << pTrigger->m_minTrackerConfidence << "\n";
-        m_ostream << "    Min Frame Count : " << pTrigger->m_minFrameCountN
-            << " out of " << pTrigger->m_minFrameCountD << "\n";
-        m_ostream << "    Min Width       : " << lrint(pTrigger->m_minWidth) << "\n";
-        m_ostream << "    Min Height      : " << lrint(pTrigger->m_minHeight) << "\n";
-        m_ostream << "    Max Width       : " << lrint(pTrigger->m_maxWidth) << "\n";
-        m_ostream << "    Max Height      : " << lrint(pTrigger->m_maxHeight) << "\n";
-
-        if (pTrigger->m_inferDoneOnly)
-        {
-            m_ostream << "    Inference   : Yes\n\n";
-        }
-        else
-        {
-            m_ostream << "    Inference   : No\n\n";
+            record.m_classId = pObjectMeta->class_id;
+            record.m_inferId = pObjectMeta->unique_component_id;
+            record.m_trackingId = pObjectMeta->object_id;
+            g_strlcpy(record.m_label, pObjectMeta->obj_label, MAX_LABEL_SIZE);
+            record.m_persistence = 
+                pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE];
+            record.m_direction = 
+                pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_DIRECTION];
+            record.m_confidence = pObjectMeta->confidence;
+            record.m_trackerConfidence = pObjectMeta->tracker_confidence;
+            record.m_left = pObjectMeta->rect_params.left;
+            record.m_top = pObjectMeta->rect_params.top;
+            record.m_width = pObjectMeta->rect_params.width;
+            record.m_height = pObjectMeta->rect_params.height;
         }
         
-        // If we're force flushing the stream and the flush
-        // handler is not currently added to the idle thread
-        if (m_forceFlush and !m_flushThreadFunctionId)
-        {
-            m_flushThreadFunctionId = g_idle_add(FileActionFlush, this);
-        }
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = pTrigger->GetConfig();
+        
+        record.m_criteriaClassId = pConfig->m_classId;
+        record.m_minConfidence = pConfig->m_minConfidence;
+        record.m_minTrackerConfidence = pConfig->m_minTrackerConfidence;
+        record.m_minFrameCountN = pConfig->m_minFrameCountN;
+        record.m_minFrameCountD = pConfig->m_minFrameCountD;
+        record.m_minWidth = pConfig->m_minWidth;
+        record.m_minHeight = pConfig->m_minHeight;
+        record.m_maxWidth = pConfig->m_maxWidth;
+        record.m_maxHeight = pConfig->m_maxHeight;
+        record.m_inferDoneOnly = pConfig->m_inferDoneOnly;
+        
+        m_pEventWriter->Write(record);
     }
 
-    FileCsvOdeAction::FileCsvOdeAction(const char* name,
+    FileTextOdeAction::FileTextOdeAction(const char* name,
         const char* filePath, uint mode, bool forceFlush)
-        : FileOdeAction(name, filePath, mode, forceFlush)
+        : FileOdeAction(name, filePath, mode, 
+            DSL_EVENT_FILE_FORMAT_TEXT, forceFlush)
     {
         LOG_FUNC();
-
-        // determine if new or existing file
-        std::ifstream streamUriFile(filePath);
-        bool fileExists(streamUriFile.good());
-        
-        // add the CSV header by default (if format == CSV)
-        bool addCsvHeader(true);
-
-        try
-        {
-            if (m_mode == DSL_WRITE_MODE_APPEND)
-            {
-                m_ostream.open(m_filePath, std::fstream::out | std::fstream::app);
-                
-                // don't add the header if we're appending to an existing file
-                addCsvHeader = !fileExists;
-            }
-            else
-            {
-                m_ostream.open(m_filePath, std::fstream::out | std::fstream::trunc);
-            }
-        }
-        catch(...) 
-        {
-            LOG_ERROR("New FileCsvOdeAction '" << name << "' failed to open");
-            throw;
-        }
-    
-        if (addCsvHeader)
-        {
-            m_ostream << "Trigger Name,";
-            m_ostream << "Event Id,";
-            m_ostream << "NTP Timestamp,";
-            m_ostream << "Inference Done,";
-            m_ostream << "Source Id,";
-            m_ostream << "Batch Idx,";
-            m_ostream << "Pad Idx,";
-            m_ostream << "Frame,";
-            m_ostream << "Width,";
-            m_ostream << "Height,";
-            m_ostream << "Occurrences,";
-            m_ostream << "Class Id,";
-            m_ostream << "Object Id,";
-            m_ostream << "Label,";
-            m_ostream << "Persistence,";
-            m_ostream << "Direction In,";
-            m_ostream << "Direction Out,";
-            m_ostream << "Infer Conf,";
-            m_ostream << "Tracker Conf,";
-            m_ostream << "Left,";
-            m_ostream << "Top,";
-            m_ostream << "Width,";
-            m_ostream << "Height,";
-            m_ostream << "Class Id Filter,";
-            m_ostream << "Min Infer Conf,";
-            m_ostream << "Min Track Conf,";
-            m_ostream << "Min Width,";
-            m_ostream << "Min Height,";
-            m_ostream << "Max Width,";
-            m_ostream << "Max Height,";
-            m_ostream << "Inference Done Only\n";
-        }
     }
 
-    FileCsvOdeAction::~FileCsvOdeAction()
+    FileTextOdeAction::~FileTextOdeAction()
     {
         LOG_FUNC();
     }
 
-    void FileCsvOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
-        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    FileCsvOdeAction::FileCsvOdeAction(const char* name,
+        const char* filePath, uint mode, bool forceFlush)
+        : FileOdeAction(name, filePath, mode, 
+            DSL_EVENT_FILE_FORMAT_CSV, forceFlush)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_ostreamMutex);
-
-        if (!m_enabled)
-        {
-            return;
-        }
-        DSL_ODE_TRIGGER_PTR pTrigger = 
-            std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
-        
-        m_ostream << pTrigger->GetName() << ",";
-        m_ostream << pTrigger->s_eventCount << ",";
-        m_ostream << pFrameMeta->ntp_timestamp << ",";
-        if (pFrameMeta->bInferDone)
-        {
-            m_ostream << "Yes,";
-        }
-        else
-        {
-            m_ostream << "No,";
-        }
-        m_ostream << pFrameMeta->source_id << ",";
-        m_ostream << pFrameMeta->batch_id << ",";
-        m_ostream << pFrameMeta->pad_index << ",";
-        m_ostream << pFrameMeta->frame_num << ",";
-        m_ostream << pFrameMeta->source_frame_width << ",";
-        m_ostream << pFrameMeta->source_frame_height << ",";
-        m_ostream << pTrigger->m_occurrences << ",";
-
-        if (pObjectMeta)
-        {
-            m_ostream << pObjectMeta->class_id << ",";
-            m_ostream << pObjectMeta->unique_component_id << ",";
-            m_ostream << pObjectMeta->object_id << ",";
-            m_ostream << pObjectMeta->obj_label << ",";
-            m_ostream << pObjectMeta->confidence << ",";
-            m_ostream << pObjectMeta->tracker_confidence << ",";
-            m_ostream << pObjectMeta->
-                misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] + ",";
-            if (pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_DIRECTION] == 
-                DSL_AREA_CROSS_DIRECTION_NONE)
-            {
-                m_ostream << "No,";
-                m_ostream << "No,";
-            }
-            else if (pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_DIRECTION] == 
-                DSL_AREA_CROSS_DIRECTION_IN)
-            {
-                m_ostream << "Yes,";
-                m_ostream << "No,";
-            }
-            else
-            {
-                m_ostream << "No,";
-                m_ostream << "Yes,";
-            }
-            m_ostream << lrint(pObjectMeta->rect_params.left) << ",";
-            m_ostream << lrint(pObjectMeta->rect_params.top) << ",";
-            m_ostream << lrint(pObjectMeta->rect_params.width) << ",";
-            m_ostream << lrint(pObjectMeta->rect_params.height) << ",";
-        }
-        else
-        {
-            m_ostream << "0,0,0,0,0,0,0";
-            
-            m_ostream << "0,0,0,0,0";
-        }
-
-        m_ostream << pTrigger->m_classId << ",";
-        m_ostream << lrint(pTrigger->m_minWidth) << ",";
-        m_ostream << lrint(pTrigger->m_minHeight) << ",";
-        m_ostream << lrint(pTrigger->m_maxWidth) << ",";
-        m_ostream << lrint(pTrigger->m_maxHeight) << ",";
-        m_ostream << pTrigger->m_minConfidence << ",";
-        m_ostream << pTrigger->m_minTrackerConfidence << ",";
+        LOG_FUNC();
+    }
 
-        if (pTrigger->m_inferDoneOnly)
-        {
-            m_ostream << "Yes\n";
-        }
-        else
-        {
-            m_ostream << "No\n";
-        }
-        
-        // If we're force flushing the stream and the flush
-        // handler is not currently added to the idle thread
-        if (m_forceFlush and !m_flushThreadFunctionId)
-        {
-            m_flushThreadFunctionId = g_idle_add(FileActionFlush, this);
-        }
+    FileCsvOdeAction::~FileCsvOdeAction()
+    {
+        LOG_FUNC();
     }
-    
+
     FileMotcOdeAction::FileMotcOdeAction(const char* name,
         const char* filePath, uint mode, bool forceFlush)
-        : FileOdeAction(name, filePath, mode, forceFlush)
+        : FileOdeAction(name, filePath, mode, 
+            DSL_EVENT_FILE_FORMAT_MOTC, forceFlush)
     {
         LOG_FUNC();
-
-        // determine if new or existing file
-        std::ifstream streamUriFile(filePath);
-        bool fileExists(streamUriFile.good());
-        
-        try
-        {
-            if (m_mode == DSL_WRITE_MODE_APPEND)
-            {
-                m_ostream.open(m_filePath, std::fstream::out | std::fstream::app);
-            }
-            else
-            {
-                m_ostream.open(m_filePath, std::fstream::out | std::fstream::trunc);
-            }
-        }
-        catch(...) 
-        {
-            LOG_ERROR("New FileMotcOdeAction '" << name << "' failed to open");
-            throw;
-        }
     }
 
     FileMotcOdeAction::~FileMotcOdeAction()
@@ -1537,39 +1248,19 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void FileMotcOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
-        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    FileBinaryOdeAction::FileBinaryOdeAction(const char* name,
+        const char* filePath, uint mode, bool forceFlush)
+        : FileOdeAction(name, filePath, mode, 
+            DSL_EVENT_FILE_FORMAT_BINARY, forceFlush)
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_ostreamMutex);
+        LOG_FUNC();
+    }
 
-        if (!m_enabled or !pObjectMeta)
-        {
-            return;
-        }
-        DSL_ODE_TRIGGER_PTR pTrigger = 
-            std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
-        
-        m_ostream << pFrameMeta->frame_num << ", ";
-        m_ostream << pObjectMeta->class_id << ", ";
-        m_ostream << pObjectMeta->object_id << ", ";
-        m_ostream << pObjectMeta->rect_params.left << ", ";
-        m_ostream << pObjectMeta->rect_params.top << ", ";
-        m_ostream << pObjectMeta->rect_params.width << ", ";
-        m_ostream << pObjectMeta->rect_params.height << ", ";
-        m_ostream << pObjectMeta->tracker_confidence << ", ";
-        m_ostream << "-1, -1, -1" << std::endl;
-            
-        // If we're force flushing the stream and the flush
-        // handler is not currently added to the idle thread
-        if (m_forceFlush and !m_flushThreadFunctionId)
-        {
-            m_flushThreadFunctionId = g_idle_add(FileActionFlush, this);
-        }
+    FileBinaryOdeAction::~FileBinaryOdeAction()
+    {
+        LOG_FUNC();
     }
     
-    
     // ********************************************************************
 
     FillSurroundingsOdeAction::FillSurroundingsOdeAction(const char* name, 
@@ -1592,7 +1283,8 @@ namespace DSL
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        if (m_enabled and pObjectMeta and displayMetaData.size())
+        if (m_enabled and pObjectMeta and 
+            DisplayMetaAllocator::IsEnabled(displayMetaData))
         {
             
             uint x1(roundf(pObjectMeta->rect_params.left));
@@ -1656,8 +1348,14 @@ namespace DSL
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        if (m_enabled and displayMetaData.size())
+        if (m_enabled)
         {
+            NvDsDisplayMeta* pDisplayMeta = DisplayMetaAllocator::Get(displayMetaData, 
+                pFrameMeta, DisplayMetaAllocator::DISPLAY_META_RECTS);
+            if (!pDisplayMeta)
+            {
+                return;
+            }
             NvOSD_RectParams rectParams{0};
             rectParams.left = 0;
             rectParams.top = 0;
@@ -1667,7 +1365,7 @@ namespace DSL
             rectParams.has_bg_color = true;
             rectParams.bg_color = *m_pColor;
             
-            displayMetaData.at(0)->rect_params[displayMetaData.at(0)->num_rects++] = rectParams;
+            pDisplayMeta->rect_params[pDisplayMeta->num_rects++] = rectParams;
         }
     }
 
@@ -1751,19 +1449,21 @@ namespace DSL
                         << pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_OUT]);
                 }
             }
+            DSL_ODE_TRIGGER_CONFIG_PTR pConfig = pTrigger->GetConfig();
+
             LOG_INFO("  Criteria          : ------------------------");
-            LOG_INFO("    Class Id        : " << pTrigger->m_classId );
-            LOG_INFO("    Min Infer Id    : " << pTrigger->m_inferId );
-            LOG_INFO("    Min Infer Conf  : " << pTrigger->m_minConfidence);
-            LOG_INFO("    Min Track Conf  : " << pTrigger->m_minTrackerConfidence);
-            LOG_INFO("    Frame Count     : " << pTrigger->m_minFrameCountN
-                << " out of " << pTrigger->m_minFrameCountD);
-            LOG_INFO("    Min Width       : " << pTrigger->m_minWidth);
-            LOG_INFO("    Min Height      : " << pTrigger->m_minHeight);
-            LOG_INFO("    Max Width       : " << pTrigger->m_maxWidth);
-            LOG_INFO("    Max Height      : " << pTrigger->m_maxHeight);
+            LOG_INFO("    Class Id        : " << pConfig->m_classId );
+            LOG_INFO("    Min Infer Id    : " << pConfig->m_inferId );
+            LOG_INFO("    Min Infer Conf  : " << pConfig->m_minConfidence);
+            LOG_INFO("    Min Track Conf  : " << pConfig->m_minTrackerConfidence);
+            LOG_INFO("    Frame Count     : " << pConfig->m_minFrameCountN
+                << " out of " << pConfig->m_minFrameCountD);
+            LOG_INFO("    Min Width       : " << pConfig->m_minWidth);
+            LOG_INFO("    Min Height      : " << pConfig->m_minHeight);
+            LOG_INFO("    Max Width       : " << pConfig->m_maxWidth);
+            LOG_INFO("    Max Height      : " << pConfig->m_maxHeight);
             
-            if (pTrigger->m_inferDoneOnly)
+            if (pConfig->m_inferDoneOnly)
             {
                 LOG_INFO("    Inference       : Yes");
             }
@@ -1976,16 +1676,18 @@ namespace DSL
             }
             
             // Trigger criteria set for this ODE occurrence.
-            info.criteria_info.class_id =  pTrigger->m_classId;
-            info.criteria_info.inference_done_only = pTrigger->m_inferDoneOnly;
-            info.criteria_info.inference_component_id = pTrigger->m_inferId;
-            info.criteria_info.min_inference_confidence = pTrigger->m_minConfidence;
-            info.criteria_info.min_tracker_confidence = pTrigger->m_minTrackerConfidence;
-            info.criteria_info.min_width = pTrigger->m_minWidth;
-            info.criteria_info.min_height = pTrigger->m_minHeight;
-            info.criteria_info.max_width = pTrigger->m_maxWidth;
-            info.criteria_info.max_height = pTrigger->m_maxHeight;
-            info.criteria_info.interval = pTrigger->m_interval;
+            DSL_ODE_TRIGGER_CONFIG_PTR pConfig = pTrigger->GetConfig();
+
+            info.criteria_info.class_id =  pConfig->m_classId;
+            info.criteria_info.inference_done_only = pConfig->m_inferDoneOnly;
+            info.criteria_info.inference_component_id = pConfig->m_inferId;
+            info.criteria_info.min_inference_confidence = pConfig->m_minConfidence;
+            info.criteria_info.min_tracker_confidence = pConfig->m_minTrackerConfidence;
+            info.criteria_info.min_width = pConfig->m_minWidth;
+            info.criteria_info.min_height = pConfig->m_minHeight;
+            info.criteria_info.max_width = pConfig->m_maxWidth;
+            info.criteria_info.max_height = pConfig->m_maxHeight;
+            info.criteria_info.interval = pConfig->m_interval;
             
             // Call the Client's monitor callback with the info and client-data
             m_clientMonitor(&info, m_clientData);
@@ -2127,7 +1829,7 @@ namespace DSL
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        if (m_enabled and displayMetaData.size())
+        if (m_enabled and DisplayMetaAllocator::IsEnabled(displayMetaData))
         {
             for (const auto &ivec: m_pDisplayTypes)
             {
@@ -2282,18 +1984,20 @@ namespace DSL
 
         }
 
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = pTrigger->GetConfig();
+
         std::cout << "  Criteria          : ------------------------" << "\n";
-        std::cout << "    Class Id        : " << pTrigger->m_classId << "\n";
-        std::cout << "    Min Infer Conf  : " << pTrigger->m_minConfidence << "\n";
-        std::cout << "    Min Track Conf  : " << pTrigger->m_minTrackerConfidence << "\n";
-        std::cout << "    Min Frame Count : " << pTrigger->m_minFrameCountN
-            << " out of " << pTrigger->m_minFrameCountD << "\n";
-        std::cout << "    Min Width       : " << lrint(pTrigger->m_minWidth) << "\n";
-        std::cout << "    Min Height      : " << lrint(pTrigger->m_minHeight) << "\n";
-        std::cout << "    Max Width       : " << lrint(pTrigger->m_maxWidth) << "\n";
-        std::cout << "    Max Height      : " << lrint(pTrigger->m_maxHeight) << "\n";
-
-        if (pTrigger->m_inferDoneOnly)
+        std::cout << "    Class Id        : " << pConfig->m_classId << "\n";
+        std::cout << "    Min Infer Conf  : " << pConfig->m_minConfidence << "\n";
+        std::cout << "    Min Track Conf  : " << pConfig->m_minTrackerConfidence << "\n";
+        std::cout << "    Min Frame Count : " << pConfig->m_minFrameCountN
+            << " out of " << pConfig->m_minFrameCountD << "\n";
+        std::cout << "    Min Width       : " << lrint(pConfig->m_minWidth) << "\n";
+        std::cout << "    Min Height      : " << lrint(pConfig->m_minHeight) << "\n";
+        std::cout << "    Max Width       : " << lrint(pConfig->m_maxWidth) << "\n";
+        std::cout << "    Max Height      : " << lrint(pConfig->m_maxHeight) << "\n";
+
+        if (pConfig->m_inferDoneOnly)
         {
             std::cout << "    Inference       : Yes\n\n";
         }
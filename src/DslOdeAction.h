@@ -32,6 +32,7 @@ THE SOFTWARE.
 #include "DslDisplayTypes.h"
 #include "DslPlayerBintr.h"
 #include "DslMailer.h"
+#include "DslOdeEventWriter.h"
 
 namespace DSL
 {
@@ -157,6 +158,8 @@ namespace DSL
     #define DSL_ODE_ACTION_PRINT_NEW(name, forceFlush) \
         std::shared_ptr<PrintOdeAction>(new PrintOdeAction(name, forceFlush))
 
+    #define DSL_ODE_ACTION_FILE_PTR std::shared_ptr<FileOdeAction>
+
     #define DSL_ODE_ACTION_FILE_TEXT_PTR std::shared_ptr<FileTextOdeAction>
     #define DSL_ODE_ACTION_FILE_TEXT_NEW(name, filePath, mode, forceFlush) \
         std::shared_ptr<FileTextOdeAction>(new FileTextOdeAction(name, \
@@ -172,6 +175,11 @@ namespace DSL
         std::shared_ptr<FileMotcOdeAction>(new FileMotcOdeAction(name, \
             filePath, mode, forceFlush))
         
+    #define DSL_ODE_ACTION_FILE_BINARY_PTR std::shared_ptr<FileBinaryOdeAction>
+    #define DSL_ODE_ACTION_FILE_BINARY_NEW(name, filePath, mode, forceFlush) \
+        std::shared_ptr<FileBinaryOdeAction>(new FileBinaryOdeAction(name, \
+            filePath, mode, forceFlush))
+        
     #define DSL_ODE_ACTION_REDACT_PTR std::shared_ptr<RedactOdeAction>
     #define DSL_ODE_ACTION_REDACT_NEW(name) \
         std::shared_ptr<RedactOdeAction>(new RedactOdeAction(name))
@@ -272,9 +280,21 @@ namespace DSL
             GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta) = 0;
         
-    protected:
-
-        std::string Ntp2Str(uint64_t ntp);
+        /**
+         * @brief Returns true if the Action only updates the Object Meta passed
+         * to it and can be called from an ODE Handler worker thread. Actions are
+         * called from the streaming thread by default, Action types opt-in by
+         * overriding this function.
+         * @return true if source-partitionable, false otherwise.
+         */
+        virtual bool IsSourcePartitionable(){return false;};
+        
+        /**
+         * @brief Converts an NTP timestamp to a local date-time string.
+         * @param[in] ntp NTP timestamp in nanoseconds.
+         * @return date-time string with microsecond resolution.
+         */
+        static std::string Ntp2Str(uint64_t ntp);
 
     };
 
@@ -365,6 +385,12 @@ namespace DSL
          */
         ~ScaleBBoxOdeAction();
 
+        /**
+         * @brief Scale BBox Actions only update the Object Meta provided.
+         * @return true always.
+         */
+        bool IsSourcePartitionable(){return true;};
+
         /**
          * @brief Handles the ODE occurrence by scalling the bounding box of pObjectMeta
          * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
@@ -668,6 +694,12 @@ namespace DSL
          */
         ~CustomizeLabelOdeAction();
 
+        /**
+         * @brief Customize Label Actions only update the Object Meta provided.
+         * @return true always.
+         */
+        bool IsSourcePartitionable(){return true;};
+
         /**
          * @brief gets the content types in use by this Customize Label Action
          * @return vector of DSL_OBJECT_LABEL_<type> values
@@ -1241,6 +1273,12 @@ namespace DSL
          */
         ~OffsetLabelOdeAction();
 
+        /**
+         * @brief Offset Label Actions only update the Object Meta provided.
+         * @return true always.
+         */
+        bool IsSourcePartitionable(){return true;};
+
         /**
          * @brief Handles the ODE occurrence by calling the client handler
          * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
@@ -1415,7 +1453,9 @@ namespace DSL
 
     /**
      * @class FileOdeAction
-     * @brief File ODE Action class
+     * @brief File ODE Action class. Each occurrence is copied into a fixed size 
+     * Event Record and queued for the Action's Event Writer which formats and 
+     * writes the records to file in a background thread.
      */
     class FileOdeAction : public OdeAction
     {
@@ -1425,10 +1465,12 @@ namespace DSL
          * @brief ctor for the ODE File Action class
          * @param[in] filePath absolute or relative path to the output file.
          * @param[in] mode open/write mode - truncate or append
-         * @param[in] forceFlush unique name for the ODE Action
+         * @param[in] format one of the DSL_EVENT_FILE_FORMAT_* constants
+         * @param[in] forceFlush if true, events are written to file on every 
+         * wake of the writer thread.
          */
         FileOdeAction(const char* name, 
-            const char* filePath, uint mode, bool forceFlush);
+            const char* filePath, uint mode, uint format, bool forceFlush);
         
         /**
          * @brief dtor for the File ODE Action class
@@ -1436,10 +1478,31 @@ namespace DSL
         ~FileOdeAction();
         
         /**
-         * @brief Flushes the ostream buffer. ** To be called by the idle thread only **.
-         * @return false to unschedule always - single flush operation.
+         * @brief Handles the ODE occurrence by queuing the occurrence data 
+         * to be written to file.
+         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
+         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
+         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
+         * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
+         * NULL if Frame level absence, total, min, max, etc. events.
          */
-        bool Flush();
+        void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
+            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+            
+        /**
+         * @brief Gets the current file rotation settings.
+         * @param[out] maxSize maximum file size in bytes, 0 = unlimited.
+         * @param[out] maxDuration maximum file duration in seconds, 0 = unlimited.
+         */
+        void GetRotation(uint* maxSize, uint* maxDuration);
+        
+        /**
+         * @brief Sets the file rotation settings.
+         * @param[in] maxSize maximum file size in bytes, 0 = unlimited.
+         * @param[in] maxDuration maximum file duration in seconds, 0 = unlimited.
+         */
+        void SetRotation(uint maxSize, uint maxDuration);
 
     protected:
     
@@ -1455,33 +1518,16 @@ namespace DSL
         uint m_mode;
         
         /**
-         * @brief output stream for all file writes
+         * @brief one of the DSL_EVENT_FILE_FORMAT_* constants
          */
-        std::fstream m_ostream;
+        uint m_format;
         
         /**
-         * @brief flag to enable/disable forced stream buffer flushing
-         */
-        bool m_forceFlush;
-    
-        /**
-         * @brief gnome thread id for the background thread to flush
+         * @brief Event Writer that formats and writes all queued events.
          */
-        uint m_flushThreadFunctionId;
-
-        /**
-         * @brief mutex to protect mutual access to comms data
-         */
-        GMutex m_ostreamMutex;
+        DSL_ODE_EVENT_WRITER_PTR m_pEventWriter;
     };
 
-    /**
-     * @brief Idle Thread Function to flush the ostream buffer
-     * @param pAction pointer to the File Action to call flush
-     * @return false to unschedule always
-     */
-    static gboolean FileActionFlush(gpointer pAction);
-
     /**
      * @class FileTextOdeAction
      * @brief Text File ODE Action class
@@ -1503,19 +1549,6 @@ namespace DSL
          * @brief dtor for the ODE Text Action class
          */
         ~FileTextOdeAction();
-        
-        /**
-         * @brief Handles the ODE occurrence by writing the occurrence data to file
-         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
-         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
-         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
-         * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
-         * NULL if Frame level absence, total, min, max, etc. events.
-         */
-        void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
-            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
-    
     };
 
     /**
@@ -1539,19 +1572,6 @@ namespace DSL
          * @brief dtor for the ODE Text Action class
          */
         ~FileCsvOdeAction();
-        
-        /**
-         * @brief Handles the ODE occurrence by writing the occurrence data to file
-         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
-         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
-         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
-         * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
-         * NULL if Frame level absence, total, min, max, etc. events.
-         */
-        void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
-            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
-    
     };
 
     /**
@@ -1575,19 +1595,30 @@ namespace DSL
          * @brief dtor for the ODE MOT Challenge Action class
          */
         ~FileMotcOdeAction();
+    };
+
+    /**
+     * @class FileBinaryOdeAction
+     * @brief Binary File ODE Action class - writes each Event Record as a 
+     * fixed size binary record following a short file header.
+     */
+    class FileBinaryOdeAction : public FileOdeAction
+    {
+    public:
+    
+        /**
+         * @brief ctor for the ODE Binary File Action class
+         * @param[in] filePath absolute or relative path to the output file.
+         * @param[in] mode open/write mode - truncate or append
+         * @param[in] forceFlush unique name for the ODE Action
+         */
+        FileBinaryOdeAction(const char* name, 
+            const char* filePath, uint mode, bool forceFlush);
         
         /**
-         * @brief Handles the ODE occurrence by writing the occurrence data to file.
-         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event.
-         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event.
-         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event.
-         * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
-         * NULL if Frame level absence, total, min, max, etc. events.
+         * @brief dtor for the ODE Binary File Action class
          */
-        void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
-            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
-    
+        ~FileBinaryOdeAction();
     };
         
     // ********************************************************************
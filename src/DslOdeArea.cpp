@@ -125,8 +125,25 @@ namespace DSL
         DSL_RGBA_POLYGON_PTR pPolygon, bool show, uint bboxTestPoint)
         : OdeArea(name, pPolygon, show, bboxTestPoint)
         , m_pPolygon(pPolygon)
+        , m_preparedPolygon(*pPolygon)
+        , m_minX(UINT32_MAX)
+        , m_minY(UINT32_MAX)
+        , m_maxX(0)
+        , m_maxY(0)
+        , m_maskCellSize(DSL_ODE_AREA_DEFAULT_MASK_CELL_SIZE)
+        , m_maskColumns(0)
+        , m_maskRows(0)
     {
         LOG_FUNC();
+        
+        for (uint i = 0; i < m_pPolygon->num_coordinates; i++)
+        {
+            m_minX = std::min(m_minX, m_pPolygon->coordinates[i].x);
+            m_minY = std::min(m_minY, m_pPolygon->coordinates[i].y);
+            m_maxX = std::max(m_maxX, m_pPolygon->coordinates[i].x);
+            m_maxY = std::max(m_maxY, m_pPolygon->coordinates[i].y);
+        }
+        buildOccupancyMask();
     }
     
     OdePolygonArea::~OdePolygonArea()
@@ -134,23 +151,127 @@ namespace DSL
         LOG_FUNC();
     }
     
-    bool OdePolygonArea::IsBboxInside(const NvOSD_RectParams& bbox)
+    void OdePolygonArea::SetOccupancyMaskCellSize(uint cellSize)
+    {
+        LOG_FUNC();
+        
+        m_maskCellSize = cellSize;
+        buildOccupancyMask();
+    }
+    
+    void OdePolygonArea::buildOccupancyMask()
+    {
+        LOG_FUNC();
+        
+        m_occupancyMask.clear();
+        m_maskColumns = m_maskRows = 0;
+        
+        if (!m_maskCellSize)
+        {
+            return;
+        }
+        m_maskColumns = (m_maxX - m_minX)/m_maskCellSize + 1;
+        m_maskRows = (m_maxY - m_minY)/m_maskCellSize + 1;
+        m_occupancyMask.assign(m_maskColumns*m_maskRows, MASK_CELL_BOUNDARY);
+        
+        for (uint row = 0; row < m_maskRows; row++)
+        {
+            for (uint col = 0; col < m_maskColumns; col++)
+            {
+                NvOSD_RectParams cell{0};
+                cell.left = m_minX + col*m_maskCellSize;
+                cell.top = m_minY + row*m_maskCellSize;
+                cell.width = m_maskCellSize;
+                cell.height = m_maskCellSize;
+                
+                GeosPolygon cellPolygon(cell);
+                
+                // A cell is only classified if every point of the closed cell,
+                // including its edges, is strictly inside or strictly outside.
+                // All other cells must fall back to the Prepared Polygon. 
+                if (m_preparedPolygon.ContainsProperly(cellPolygon))
+                {
+                    m_occupancyMask[row*m_maskColumns + col] = MASK_CELL_INSIDE;
+                }
+                else if (m_preparedPolygon.Disjoint(cellPolygon))
+                {
+                    m_occupancyMask[row*m_maskColumns + col] = MASK_CELL_OUTSIDE;
+                }
+            }
+        }
+    }
+    
+    bool OdePolygonArea::containsPoint(const dsl_coordinate& coordinate)
     {
         // Do not log function entry
         
-        GeosPolygon testPolygon(bbox);
+        // Points on or outside of the bounding box can't be in the interior
+        if (coordinate.x <= m_minX or coordinate.x >= m_maxX or
+            coordinate.y <= m_minY or coordinate.y >= m_maxY)
+        {
+            return false;
+        }
+        if (m_maskCellSize)
+        {
+            uint cell = ((coordinate.y - m_minY)/m_maskCellSize)*m_maskColumns +
+                (coordinate.x - m_minX)/m_maskCellSize;
+                
+            if (m_occupancyMask[cell] == MASK_CELL_INSIDE)
+            {
+                return true;
+            }
+            if (m_occupancyMask[cell] == MASK_CELL_OUTSIDE)
+            {
+                return false;
+            }
+        }
+        GeosPoint testPoint(coordinate.x, coordinate.y);
+        return m_preparedPolygon.Contains(testPoint);
+    }
+    
+    bool OdePolygonArea::IsBboxInside(const NvOSD_RectParams& bbox)
+    {
+        // Do not log function entry
         
         if (m_bboxTestPoint == DSL_BBOX_POINT_ANY)
         {
-            return (((GeosPolygon)*m_pPolygon).Overlaps(testPolygon) or
-                ((GeosPolygon)*m_pPolygon).Contains(testPolygon) or
-                testPolygon.Contains((GeosPolygon)*m_pPolygon));
+            // The bbox can only overlap, contain, or be contained by the Polygon
+            // if it intersects the interior of the Polygon's bounding box.
+            if (bbox.left >= m_maxX or bbox.top >= m_maxY or
+                (bbox.left + bbox.width) <= m_minX or 
+                (bbox.top + bbox.height) <= m_minY)
+            {
+                return false;
+            }
+            
+            // If the center of the bbox falls in an inside cell, the interiors
+            // of the bbox and Polygon intersect. Meaning one contains the other
+            // or the two overlap.
+            float centerX(bbox.left + bbox.width/2);
+            float centerY(bbox.top + bbox.height/2);
+            
+            if (m_maskCellSize and bbox.width > 0 and bbox.height > 0 and
+                centerX >= m_minX and centerY >= m_minY)
+            {
+                uint col = (uint)(centerX - m_minX)/m_maskCellSize;
+                uint row = (uint)(centerY - m_minY)/m_maskCellSize;
+                
+                if (col < m_maskColumns and row < m_maskRows and
+                    m_occupancyMask[row*m_maskColumns + col] == MASK_CELL_INSIDE)
+                {
+                    return true;
+                }
+            }
+            GeosPolygon testPolygon(bbox);
+            
+            return (m_preparedPolygon.Overlaps(testPolygon) or
+                m_preparedPolygon.Contains(testPolygon) or
+                m_preparedPolygon.Within(testPolygon));
         }        
         dsl_coordinate coordinate;
         getCoordinate(bbox, coordinate);
         
-        GeosPoint testPoint(coordinate.x, coordinate.y);
-        return ((GeosPolygon)*m_pPolygon).Contains(testPoint);
+        return containsPoint(coordinate);
     }
 
     bool OdePolygonArea::IsPointInside(const dsl_coordinate& coordinate)
@@ -172,7 +293,7 @@ namespace DSL
             {
                 return false;
             }
-            return ((GeosPolygon)*m_pPolygon).Contains(testPoint);          
+            return m_preparedPolygon.Contains(testPoint);          
         }
     }
     
@@ -196,7 +317,7 @@ namespace DSL
                 return DSL_AREA_POINT_LOCATION_ON_LINE;
             }
         }
-        return ((GeosPolygon)*m_pPolygon).Contains(testPoint)
+        return containsPoint(coordinate)
             ? DSL_AREA_POINT_LOCATION_INSIDE
             : DSL_AREA_POINT_LOCATION_OUTSIDE;
     }
@@ -238,7 +359,7 @@ namespace DSL
         // for cross with this Area's line.
         GeosMultiLine multiLine(lineParms);
         
-        if (!multiLine.Crosses(*m_pPolygon))
+        if (!multiLine.Crosses(m_preparedPolygon))
         { 
             return false;
         }
@@ -249,7 +370,7 @@ namespace DSL
             coordinates[numCoordinates-1].x, 
             coordinates[numCoordinates-1].y);
         
-        bool crossed(((GeosPolygon)*m_pPolygon).Distance(endPoint) > 
+        bool crossed(m_preparedPolygon.Distance(endPoint) > 
             (m_pPolygon->border_width/2));
 
         if (crossed)
@@ -59,6 +59,12 @@ namespace DSL
         std::shared_ptr<OdeMultiLineArea>(new OdeMultiLineArea( \
             name, pMultiLine, show, bboxTestPoint))
 
+    /**
+     * @brief default cell size, in pixels, for the Polygon Area's rasterized
+     * occupancy mask. A cell size of 0 disables the mask. 
+     */
+    #define DSL_ODE_AREA_DEFAULT_MASK_CELL_SIZE 16
+
     class OdeArea : public Base
     {
     public: 
@@ -239,11 +245,77 @@ namespace DSL
         bool DoesTraceCrossLine(dsl_coordinate* coordinates, uint numCoordinates,
             uint& direction);
 
+        /**
+         * @brief Gets the current cell size for the Area's occupancy mask.
+         * @return cell size in pixels, 0 if the mask is disabled.
+         */
+        uint GetOccupancyMaskCellSize(){return m_maskCellSize;};
+
+        /**
+         * @brief Sets the cell size for the Area's occupancy mask, rebuilding
+         * the mask. Must be called before the Area is added to a Trigger.
+         * @param[in] cellSize new cell size in pixels, 0 to disable the mask.
+         */
+        void SetOccupancyMaskCellSize(uint cellSize);
+
         /**
          * @brief Polygon display type used to define the Area's location, dimensions, and color
          */
         DSL_RGBA_POLYGON_PTR m_pPolygon;
         
+    private:
+    
+        /**
+         * @brief Checks if an x,y coordinate is inside the Area's Polygon using 
+         * the cached bounding box and occupancy mask first, and the Prepared 
+         * Polygon only when the coordinate falls on a boundary cell.
+         * @param[in] coordinate x,y coordinate to test.
+         * @return true if the Polygon contains the coordinate, false otherwise.
+         */
+        bool containsPoint(const dsl_coordinate& coordinate);
+        
+        /**
+         * @brief Builds the Area's occupancy mask from the Prepared Polygon by 
+         * classifying each cell of the Polygon's bounding box.
+         */
+        void buildOccupancyMask();
+        
+        /**
+         * @brief Occupancy mask cell states.
+         */
+        enum {MASK_CELL_BOUNDARY = 0, MASK_CELL_INSIDE, MASK_CELL_OUTSIDE};
+    
+        /**
+         * @brief GEOS Prepared Polygon created once from m_pPolygon.
+         */
+        GeosPreparedPolygon m_preparedPolygon;
+        
+        /**
+         * @brief axis-aligned bounding box of the Polygon, cached on construction.
+         */
+        uint m_minX, m_minY, m_maxX, m_maxY;
+        
+        /**
+         * @brief cell size, in pixels, for the occupancy mask. 0 = disabled.
+         */
+        uint m_maskCellSize;
+        
+        /**
+         * @brief number of columns in the occupancy mask.
+         */
+        uint m_maskColumns;
+        
+        /**
+         * @brief number of rows in the occupancy mask.
+         */
+        uint m_maskRows;
+        
+        /**
+         * @brief row-major occupancy mask covering the Polygon's bounding box. 
+         * Each cell is one of MASK_CELL_BOUNDARY, MASK_CELL_INSIDE, or 
+         * MASK_CELL_OUTSIDE.
+         */
+        std::vector<uint8_t> m_occupancyMask;
     };
 
 
@@ -154,9 +154,10 @@ namespace DSL
         GMutex m_propertyMutex;
     
         /**
-         * @brief enabled flag.
+         * @brief enabled flag. Atomic so that it can be read by the
+         * streaming thread without the property mutex.
          */
-        bool m_enabled;
+        std::atomic<bool> m_enabled;
 
     private:
     
@@ -0,0 +1,540 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslOdeEventWriter.h"
+#include "DslOdeAction.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#define DATE_BUFF_LENGTH 40
+
+namespace DSL
+{
+    OdeEventWriter::OdeEventWriter(const char* name, const char* filePath, 
+        uint mode, uint format, bool forceFlush)
+        : m_name(name)
+        , m_filePath(filePath)
+        , m_format(format)
+        , m_forceFlush(forceFlush)
+        , m_fd(-1)
+        , m_fileSize(0)
+        , m_fileOpenTime(0)
+        , m_lastWriteTime(0)
+        , m_maxSize(0)
+        , m_maxDuration(0)
+        , m_droppedCount(0)
+        , m_dropping(false)
+        , m_stop(false)
+        , m_pWriterThread(NULL)
+    {
+        LOG_FUNC();
+        
+        m_buffer.reserve(DSL_ODE_EVENT_WRITER_BUFFER_SIZE);
+        
+        if (!openFile(mode == DSL_WRITE_MODE_TRUNCATE))
+        {
+            LOG_ERROR("ODE Event Writer for '" << name 
+                << "' failed to open file '" << filePath << "'");
+            throw std::runtime_error("failed to open event file");
+        }
+        // write the header now so that it's in place prior to the first event.
+        writeBuffer();
+        
+        g_mutex_init(&m_wakeMutex);
+        g_cond_init(&m_wakeCond);
+        
+        m_pWriterThread = g_thread_new(NULL, OdeEventWriterThread, this);
+    }
+    
+    OdeEventWriter::~OdeEventWriter()
+    {
+        LOG_FUNC();
+        
+        m_stop = true;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_wakeMutex);
+            g_cond_signal(&m_wakeCond);
+        }
+        g_thread_join(m_pWriterThread);
+        
+        g_cond_clear(&m_wakeCond);
+        g_mutex_clear(&m_wakeMutex);
+        
+        if (m_droppedCount)
+        {
+            LOG_WARN("ODE Event Writer for '" << m_name << "' dropped " 
+                << m_droppedCount << " records - queue full");
+        }
+    }
+    
+    bool OdeEventWriter::Write(const OdeEventRecord& record)
+    {
+        // No function log - avoid overhead.
+        
+        if (!m_queue.Push(record))
+        {
+            uint64_t droppedCount = 
+                m_droppedCount.fetch_add(1, std::memory_order_relaxed) + 1;
+                
+            // log once at the start of each period of drops.
+            if (!m_dropping)
+            {
+                m_dropping = true;
+                LOG_WARN("ODE Event Writer for '" << m_name 
+                    << "' is dropping records - queue full, " 
+                    << droppedCount << " dropped in total");
+            }
+            return false;
+        }
+        if (m_dropping)
+        {
+            m_dropping = false;
+            LOG_WARN("ODE Event Writer for '" << m_name 
+                << "' has resumed queuing records - " 
+                << m_droppedCount << " dropped in total");
+        }
+        // Wake the writer early if the queue is getting full. Otherwise the 
+        // writer will pick up the record on its next periodic wake. 
+        if (m_queue.Size() == DSL_ODE_EVENT_WRITER_QUEUE_SIZE/2)
+        {
+            g_cond_signal(&m_wakeCond);
+        }
+        return true;
+    }
+
+    void OdeEventWriter::GetRotation(uint* maxSize, uint* maxDuration)
+    {
+        LOG_FUNC();
+        
+        *maxSize = m_maxSize;
+        *maxDuration = m_maxDuration;
+    }
+    
+    void OdeEventWriter::SetRotation(uint maxSize, uint maxDuration)
+    {
+        LOG_FUNC();
+        
+        m_maxSize = maxSize;
+        m_maxDuration = maxDuration;
+    }
+    
+    uint64_t OdeEventWriter::GetDroppedCount()
+    {
+        LOG_FUNC();
+        
+        return m_droppedCount;
+    }
+
+    void OdeEventWriter::Run()
+    {
+        LOG_FUNC();
+        
+        while (true)
+        {
+            bool stopping(m_stop);
+            
+            if (!stopping)
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_wakeMutex);
+                g_cond_wait_until(&m_wakeCond, &m_wakeMutex, 
+                    g_get_monotonic_time() + 
+                        DSL_ODE_EVENT_WRITER_WAKE_INTERVAL_MS*G_TIME_SPAN_MILLISECOND);
+            }
+            
+            // format all queued records, writing whenever the buffer fills.
+            const OdeEventRecord* pRecord;
+            while ((pRecord = m_queue.Front()))
+            {
+                formatRecord(*pRecord);
+                m_queue.Pop();
+                
+                if (m_buffer.size() >= DSL_ODE_EVENT_WRITER_BUFFER_SIZE)
+                {
+                    writeBuffer();
+                }
+            }
+            
+            gint64 now = g_get_monotonic_time();
+            
+            if (m_forceFlush or stopping or (now - m_lastWriteTime >= 
+                DSL_ODE_EVENT_WRITER_FLUSH_INTERVAL_MS*G_TIME_SPAN_MILLISECOND))
+            {
+                writeBuffer();
+            }
+            if (stopping)
+            {
+                break;
+            }
+            uint maxSize(m_maxSize), maxDuration(m_maxDuration);
+            
+            if ((maxSize and m_fileSize >= maxSize) or (maxDuration and 
+                now - m_fileOpenTime >= (gint64)maxDuration*G_TIME_SPAN_SECOND))
+            {
+                rotateFile();
+            }
+        }
+        closeFile();
+    }
+    
+    bool OdeEventWriter::openFile(bool truncate)
+    {
+        LOG_FUNC();
+        
+        // determine if new or existing file
+        struct stat fileStat;
+        bool fileExists(stat(m_filePath.c_str(), &fileStat) == 0);
+        
+        int flags = O_WRONLY | O_CREAT | O_CLOEXEC | ((truncate) ? O_TRUNC : O_APPEND);
+        
+        m_fd = open(m_filePath.c_str(), flags, 0644);
+        if (m_fd < 0)
+        {
+            return false;
+        }
+        m_fileSize = (fileExists and !truncate) ? fileStat.st_size : 0;
+        m_fileOpenTime = g_get_monotonic_time();
+        m_lastWriteTime = m_fileOpenTime;
+        
+        formatHeader(truncate or !fileExists or m_fileSize == 0);
+        return true;
+    }
+
+    void OdeEventWriter::closeFile()
+    {
+        LOG_FUNC();
+        
+        if (m_fd < 0)
+        {
+            return;
+        }
+        formatFooter();
+        writeBuffer();
+        close(m_fd);
+        m_fd = -1;
+        m_fileSize = 0;
+        m_fileOpenTime = g_get_monotonic_time();
+    }
+    
+    void OdeEventWriter::rotateFile()
+    {
+        LOG_FUNC();
+        
+        closeFile();
+        
+        char dateTime[DATE_BUFF_LENGTH] = {0};
+        time_t seconds = time(NULL);
+        struct tm currentTm;
+        localtime_r(&seconds, &currentTm);
+        strftime(dateTime, DATE_BUFF_LENGTH, "%Y%m%d-%H%M%S", &currentTm);
+
+        // add an index if more than one rotation occurs within a second.
+        std::string rotatedPath = m_filePath + "." + dateTime;
+        struct stat fileStat;
+        for (uint i = 1; stat(rotatedPath.c_str(), &fileStat) == 0; i++)
+        {
+            rotatedPath = m_filePath + "." + dateTime + "." + std::to_string(i);
+        }
+        if (rename(m_filePath.c_str(), rotatedPath.c_str()))
+        {
+            LOG_ERROR("ODE Event Writer for '" << m_name 
+                << "' failed to rename '" << m_filePath << "'");
+        }
+        else
+        {
+            LOG_INFO("ODE Event Writer for '" << m_name 
+                << "' rotated file to '" << rotatedPath << "'");
+        }
+        if (!openFile(true))
+        {
+            LOG_ERROR("ODE Event Writer for '" << m_name 
+                << "' failed to open file '" << m_filePath << "'");
+        }
+    }
+    
+    void OdeEventWriter::writeBuffer()
+    {
+        m_lastWriteTime = g_get_monotonic_time();
+        
+        if (m_buffer.empty())
+        {
+            return;
+        }
+        if (m_fd >= 0)
+        {
+            const char* pData = m_buffer.data();
+            size_t remaining = m_buffer.size();
+            
+            while (remaining)
+            {
+                ssize_t written = write(m_fd, pData, remaining);
+                if (written < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+                    LOG_ERROR("ODE Event Writer for '" << m_name 
+                        << "' failed to write to file '" << m_filePath 
+                        << "' errno = " << errno);
+                    break;
+                }
+                pData += written;
+                remaining -= written;
+            }
+            m_fileSize += m_buffer.size() - remaining;
+        }
+        m_buffer.clear();
+    }
+    
+    void OdeEventWriter::formatHeader(bool newFile)
+    {
+        switch (m_format)
+        {
+        case DSL_EVENT_FILE_FORMAT_TEXT :
+            {
+                char dateTime[DATE_BUFF_LENGTH] = {0};
+                time_t seconds = time(NULL);
+                struct tm currentTm;
+                localtime_r(&seconds, &currentTm);
+                strftime(dateTime, DATE_BUFF_LENGTH, "%a, %d %b %Y %H:%M:%S %z", 
+                    &currentTm);
+
+                m_buffer += "-------------------------------------------------------------------\n";
+                m_buffer += " File opened: " + std::string(dateTime) + "\n";
+                m_buffer += "-------------------------------------------------------------------\n";
+            }
+            break;
+        case DSL_EVENT_FILE_FORMAT_CSV :
+            // don't add the header if we're appending to an existing file
+            if (newFile)
+            {
+                m_buffer += "Trigger Name,Event Id,NTP Timestamp,Inference Done,"
+                    "Source Id,Batch Idx,Pad Idx,Frame,Width,Height,Occurrences,"
+                    "Class Id,Object Id,Label,Persistence,Direction In,Direction Out,"
+                    "Infer Conf,Tracker Conf,Left,Top,Width,Height,Class Id Filter,"
+                    "Min Infer Conf,Min Track Conf,Min Width,Min Height,Max Width,"
+                    "Max Height,Inference Done Only\n";
+            }
+            break;
+        case DSL_EVENT_FILE_FORMAT_BINARY :
+            // magic, version, and record size so readers can validate the layout.
+            if (newFile)
+            {
+                uint32_t version(DSL_ODE_EVENT_BINARY_VERSION);
+                uint32_t recordSize(sizeof(OdeEventRecord));
+                m_buffer.append(DSL_ODE_EVENT_BINARY_MAGIC, 
+                    sizeof(DSL_ODE_EVENT_BINARY_MAGIC));
+                m_buffer.append((const char*)&version, sizeof(version));
+                m_buffer.append((const char*)&recordSize, sizeof(recordSize));
+            }
+            break;
+        default :
+            break;
+        }
+    }
+
+    void OdeEventWriter::formatFooter()
+    {
+        if (m_format == DSL_EVENT_FILE_FORMAT_TEXT)
+        {
+            char dateTime[DATE_BUFF_LENGTH] = {0};
+            time_t seconds = time(NULL);
+            struct tm currentTm;
+            localtime_r(&seconds, &currentTm);
+            strftime(dateTime, DATE_BUFF_LENGTH, "%a, %d %b %Y %H:%M:%S %z", 
+                &currentTm);
+
+            m_buffer += "-------------------------------------------------------------------\n";
+            m_buffer += " File closed: " + std::string(dateTime) + "\n";
+            m_buffer += "-------------------------------------------------------------------\n";
+        }
+    }
+    
+    void OdeEventWriter::formatRecord(const OdeEventRecord& record)
+    {
+        switch (m_format)
+        {
+        case DSL_EVENT_FILE_FORMAT_TEXT :
+            formatTextRecord(record);
+            break;
+        case DSL_EVENT_FILE_FORMAT_CSV :
+            formatCsvRecord(record);
+            break;
+        case DSL_EVENT_FILE_FORMAT_MOTC :
+            formatMotcRecord(record);
+            break;
+        case DSL_EVENT_FILE_FORMAT_BINARY :
+            m_buffer.append((const char*)&record, sizeof(record));
+            break;
+        }
+    }
+
+    void OdeEventWriter::formatTextRecord(const OdeEventRecord& record)
+    {
+        std::ostringstream ostream;
+        
+        ostream << "Trigger Name        : " << record.m_triggerName << "\n";
+        ostream << "  Unique ODE Id     : " << record.m_eventId << "\n";
+        ostream << "  NTP Timestamp     : " << OdeAction::Ntp2Str(record.m_ntpTimestamp) << "\n";
+        ostream << "  Source Data       : ------------------------" << "\n";
+        ostream << "    Inference       : " << ((record.m_inferDone) ? "Yes\n" : "No\n");
+        ostream << "    Source Id       : " << record.m_sourceId << "\n";
+        ostream << "    Batch Id        : " << record.m_batchId << "\n";
+        ostream << "    Pad Index       : " << record.m_padIndex << "\n";
+        ostream << "    Frame           : " << record.m_frameNum << "\n";
+        ostream << "    Width           : " << record.m_frameWidth << "\n";
+        ostream << "    Heigh           : " << record.m_frameHeight << "\n";
+        ostream << "  Object Data       : ------------------------" << "\n";
+
+        if (record.m_hasObject)
+        {
+            ostream << "    Occurrences     : " << record.m_occurrences << "\n";
+            ostream << "    Obj ClassId     : " << record.m_classId << "\n";
+            ostream << "    Infer Id        : " << record.m_inferId << "\n";
+            ostream << "    Tracking Id     : " << record.m_trackingId << "\n";
+            ostream << "    Label           : " << record.m_label << "\n";
+            ostream << "    Persistence     : " << record.m_persistence << "\n";
+            ostream << "    Direction In    : " << ((record.m_direction == 
+                DSL_AREA_CROSS_DIRECTION_IN) ? "Yes\n" : "No\n");
+            ostream << "    Direction Out   : " << ((record.m_direction == 
+                DSL_AREA_CROSS_DIRECTION_OUT) ? "Yes\n" : "No\n");
+            ostream << "    Infer Conf      : " << record.m_confidence << "\n";
+            ostream << "    Track Conf      : " << record.m_trackerConfidence << "\n";
+            ostream << "    Left            : " << lrint(record.m_left) << "\n";
+            ostream << "    Top             : " << lrint(record.m_top) << "\n";
+            ostream << "    Width           : " << lrint(record.m_width) << "\n";
+            ostream << "    Height          : " << lrint(record.m_height) << "\n";
+        }
+        else
+        {
+            if (record.m_frameInfo[DSL_FRAME_INFO_ACTIVE_INDEX] == 
+                DSL_FRAME_INFO_OCCURRENCES)
+            {
+                ostream << "    Occurrences     : " 
+                    << record.m_frameInfo[DSL_FRAME_INFO_OCCURRENCES] << "\n";
+            }
+            else if (record.m_frameInfo[DSL_FRAME_INFO_ACTIVE_INDEX] == 
+                DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN)
+            {
+                ostream << "    Occurrences In  : " 
+                    << record.m_frameInfo[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN] << "\n";
+                ostream << "    Occurrences Out : " 
+                    << record.m_frameInfo[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_OUT] << "\n";
+            }
+        }
+        ostream << "  Criteria          : ------------------------" << "\n";
+        ostream << "    Class Id        : " << record.m_criteriaClassId << "\n";
+        ostream << "    Min Infer Conf  : " << record.m_minConfidence << "\n";
+        ostream << "    Min Track Conf  : " << record.m_minTrackerConfidence << "\n";
+        ostream << "    Min Frame Count : " << record.m_minFrameCountN
+            << " out of " << record.m_minFrameCountD << "\n";
+        ostream << "    Min Width       : " << lrint(record.m_minWidth) << "\n";
+        ostream << "    Min Height      : " << lrint(record.m_minHeight) << "\n";
+        ostream << "    Max Width       : " << lrint(record.m_maxWidth) << "\n";
+        ostream << "    Max Height      : " << lrint(record.m_maxHeight) << "\n";
+        ostream << "    Inference   : " << ((record.m_inferDoneOnly) ? "Yes\n\n" : "No\n\n");
+        
+        m_buffer += ostream.str();
+    }
+
+    void OdeEventWriter::formatCsvRecord(const OdeEventRecord& record)
+    {
+        std::ostringstream ostream;
+        
+        // columns in the same order as the header.
+        ostream << record.m_triggerName << ",";
+        ostream << record.m_eventId << ",";
+        ostream << record.m_ntpTimestamp << ",";
+        ostream << ((record.m_inferDone) ? "Yes," : "No,");
+        ostream << record.m_sourceId << ",";
+        ostream << record.m_batchId << ",";
+        ostream << record.m_padIndex << ",";
+        ostream << record.m_frameNum << ",";
+        ostream << record.m_frameWidth << ",";
+        ostream << record.m_frameHeight << ",";
+        ostream << record.m_occurrences << ",";
+
+        if (record.m_hasObject)
+        {
+            ostream << record.m_classId << ",";
+            ostream << record.m_trackingId << ",";
+            ostream << record.m_label << ",";
+            ostream << record.m_persistence << ",";
+            ostream << ((record.m_direction == 
+                DSL_AREA_CROSS_DIRECTION_IN) ? "Yes," : "No,");
+            ostream << ((record.m_direction == 
+                DSL_AREA_CROSS_DIRECTION_OUT) ? "Yes," : "No,");
+            ostream << record.m_confidence << ",";
+            ostream << record.m_trackerConfidence << ",";
+            ostream << lrint(record.m_left) << ",";
+            ostream << lrint(record.m_top) << ",";
+            ostream << lrint(record.m_width) << ",";
+            ostream << lrint(record.m_height) << ",";
+        }
+        else
+        {
+            ostream << "0,0,,0,No,No,0,0,0,0,0,0,";
+        }
+        ostream << record.m_criteriaClassId << ",";
+        ostream << record.m_minConfidence << ",";
+        ostream << record.m_minTrackerConfidence << ",";
+        ostream << lrint(record.m_minWidth) << ",";
+        ostream << lrint(record.m_minHeight) << ",";
+        ostream << lrint(record.m_maxWidth) << ",";
+        ostream << lrint(record.m_maxHeight) << ",";
+        ostream << ((record.m_inferDoneOnly) ? "Yes\n" : "No\n");
+        
+        m_buffer += ostream.str();
+    }
+
+    void OdeEventWriter::formatMotcRecord(const OdeEventRecord& record)
+    {
+        // MOT Challenge format is for Object events only
+        if (!record.m_hasObject)
+        {
+            return;
+        }
+        std::ostringstream ostream;
+        
+        ostream << record.m_frameNum << ", ";
+        ostream << record.m_classId << ", ";
+        ostream << record.m_trackingId << ", ";
+        ostream << record.m_left << ", ";
+        ostream << record.m_top << ", ";
+        ostream << record.m_width << ", ";
+        ostream << record.m_height << ", ";
+        ostream << record.m_trackerConfidence << ", ";
+        ostream << "-1, -1, -1\n";
+        
+        m_buffer += ostream.str();
+    }
+    
+    static gpointer OdeEventWriterThread(gpointer pWriter)
+    {
+        static_cast<OdeEventWriter*>(pWriter)->Run();
+        return NULL;
+    }
+}
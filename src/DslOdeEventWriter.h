@@ -0,0 +1,396 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_ODE_EVENT_WRITER_H
+#define _DSL_ODE_EVENT_WRITER_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_ODE_EVENT_WRITER_PTR std::shared_ptr<OdeEventWriter>
+    #define DSL_ODE_EVENT_WRITER_NEW(name, filePath, mode, format, forceFlush) \
+        std::shared_ptr<OdeEventWriter>(new OdeEventWriter(name, \
+            filePath, mode, format, forceFlush))
+
+    /**
+     * @brief Maximum number of event records that can be queued for the 
+     * writer thread. Records are dropped if the queue is full.
+     */
+    #define DSL_ODE_EVENT_WRITER_QUEUE_SIZE         1024
+    
+    /**
+     * @brief Size of the formatted-output buffer. The buffer is written to 
+     * file when full, on each wake if force-flush is enabled, or once the
+     * flush interval has elapsed.
+     */
+    #define DSL_ODE_EVENT_WRITER_BUFFER_SIZE        65536
+    #define DSL_ODE_EVENT_WRITER_WAKE_INTERVAL_MS   50
+    #define DSL_ODE_EVENT_WRITER_FLUSH_INTERVAL_MS  1000
+    
+    /**
+     * @brief Maximum Trigger name length stored in an Event Record.
+     */
+    #define DSL_ODE_EVENT_RECORD_NAME_SIZE          128
+    
+    /**
+     * @brief Magic and version written at the start of each Binary event file.
+     */
+    #define DSL_ODE_EVENT_BINARY_MAGIC              "DSLODE"
+    #define DSL_ODE_EVENT_BINARY_VERSION            1
+
+    /**
+     * @struct OdeEventRecord
+     * @brief Fixed size snapshot of an ODE occurrence - the Frame, Object and
+     * Trigger Criteria data required by all Event File formats. Records are 
+     * filled in on the streaming thread and formatted by the writer thread.
+     */
+    struct OdeEventRecord
+    {
+        char m_triggerName[DSL_ODE_EVENT_RECORD_NAME_SIZE];
+        uint64_t m_eventId;
+        uint64_t m_occurrences;
+        
+        // Frame data
+        uint64_t m_ntpTimestamp;
+        uint m_sourceId;
+        uint m_batchId;
+        uint m_padIndex;
+        int m_frameNum;
+        uint m_frameWidth;
+        uint m_frameHeight;
+        bool m_inferDone;
+        int64_t m_frameInfo[MAX_USER_FIELDS];
+        
+        // Object data - valid if m_hasObject is true
+        bool m_hasObject;
+        int m_classId;
+        int m_inferId;
+        uint64_t m_trackingId;
+        char m_label[MAX_LABEL_SIZE];
+        int64_t m_persistence;
+        int64_t m_direction;
+        float m_confidence;
+        float m_trackerConfidence;
+        float m_left;
+        float m_top;
+        float m_width;
+        float m_height;
+        
+        // Trigger criteria
+        uint m_criteriaClassId;
+        float m_minConfidence;
+        float m_minTrackerConfidence;
+        uint m_minFrameCountN;
+        uint m_minFrameCountD;
+        float m_minWidth;
+        float m_minHeight;
+        float m_maxWidth;
+        float m_maxHeight;
+        bool m_inferDoneOnly;
+    };
+    
+    /**
+     * @class SpscRingBuffer
+     * @brief Lock-free, bounded, single-producer/single-consumer queue. 
+     * Capacity must be a power of 2.
+     */
+    template <typename T, size_t capacity>
+    class SpscRingBuffer
+    {
+    public:
+    
+        SpscRingBuffer()
+            : m_items(capacity)
+            , m_head(0)
+            , m_tail(0)
+        {
+            static_assert((capacity & (capacity-1)) == 0, 
+                "capacity must be a power of 2");
+        }
+        
+        /**
+         * @brief Copies an item into the queue. ** Producer thread only **
+         * @return false if the queue is full, true otherwise.
+         */
+        bool Push(const T& item)
+        {
+            size_t tail = m_tail.load(std::memory_order_relaxed);
+            if (tail - m_head.load(std::memory_order_acquire) == capacity)
+            {
+                return false;
+            }
+            m_items[tail & (capacity-1)] = item;
+            m_tail.store(tail+1, std::memory_order_release);
+            return true;
+        }
+        
+        /**
+         * @brief Returns a pointer to the oldest item or NULL if empty. 
+         * The item remains valid until Pop is called. ** Consumer thread only **
+         */
+        const T* Front()
+        {
+            size_t head = m_head.load(std::memory_order_relaxed);
+            if (head == m_tail.load(std::memory_order_acquire))
+            {
+                return NULL;
+            }
+            return &m_items[head & (capacity-1)];
+        }
+        
+        /**
+         * @brief Removes the oldest item. ** Consumer thread only **
+         */
+        void Pop()
+        {
+            m_head.store(m_head.load(std::memory_order_relaxed)+1, 
+                std::memory_order_release);
+        }
+        
+        /**
+         * @brief Returns the approximate number of queued items.
+         */
+        size_t Size()
+        {
+            return m_tail.load(std::memory_order_acquire) - 
+                m_head.load(std::memory_order_acquire);
+        }
+        
+    private:
+    
+        std::vector<T> m_items;
+        
+        /**
+         * @brief read and write positions - on separate cache lines so that
+         * the producer and consumer do not contend.
+         */
+        alignas(64) std::atomic<size_t> m_head;
+        alignas(64) std::atomic<size_t> m_tail;
+    };
+
+    /**
+     * @class OdeEventWriter
+     * @brief Writes ODE Event Records to file in a background thread. The 
+     * streaming thread only copies a fixed size record into a lock-free queue.
+     * Formatting, batched writes, and size/time based file rotation are all
+     * performed by the writer thread.
+     */
+    class OdeEventWriter
+    {
+    public:
+    
+        /**
+         * @brief ctor for the ODE Event Writer class
+         * @param[in] name name of the owning File Action, for logging.
+         * @param[in] filePath absolute or relative path to the output file.
+         * @param[in] mode open/write mode - one of DSL_WRITE_MODE_*.
+         * @param[in] format output format - one of DSL_EVENT_FILE_FORMAT_*.
+         * @param[in] forceFlush if true, queued records are written to file on 
+         * every wake of the writer thread.
+         */
+        OdeEventWriter(const char* name, const char* filePath, 
+            uint mode, uint format, bool forceFlush);
+        
+        /**
+         * @brief dtor for the ODE Event Writer class. Writes all queued records
+         * before closing the file.
+         */
+        ~OdeEventWriter();
+        
+        /**
+         * @brief Queues a record for writing. ** Producer thread only **
+         * Callers must serialize concurrent calls.
+         * @param[in] record event record to copy into the queue.
+         * @return false if the queue is full and the record was dropped.
+         */
+        bool Write(const OdeEventRecord& record);
+        
+        /**
+         * @brief Gets the current file rotation settings.
+         * @param[out] maxSize maximum file size in bytes, 0 = unlimited.
+         * @param[out] maxDuration maximum file duration in seconds, 0 = unlimited.
+         */
+        void GetRotation(uint* maxSize, uint* maxDuration);
+        
+        /**
+         * @brief Sets the file rotation settings. When either limit is reached
+         * the current file is closed and renamed with a timestamp suffix, and
+         * a new file is opened at the original path.
+         * @param[in] maxSize maximum file size in bytes, 0 = unlimited.
+         * @param[in] maxDuration maximum file duration in seconds, 0 = unlimited.
+         */
+        void SetRotation(uint maxSize, uint maxDuration);
+        
+        /**
+         * @brief Gets the number of records dropped because the queue was full.
+         */
+        uint64_t GetDroppedCount();
+        
+        /**
+         * @brief Writer thread function. ** To be called by the writer thread only **
+         */
+        void Run();
+        
+    private:
+    
+        /**
+         * @brief Opens the output file and writes the format header.
+         * @param[in] truncate if true, the file is truncated on open.
+         * @return true on successful open, false otherwise.
+         */
+        bool openFile(bool truncate);
+        
+        /**
+         * @brief Writes the format footer and closes the output file.
+         */
+        void closeFile();
+        
+        /**
+         * @brief Closes the current file, renames it, and opens a new file.
+         */
+        void rotateFile();
+        
+        /**
+         * @brief Writes the formatted-output buffer to file with a single
+         * write call (looping on partial writes only).
+         */
+        void writeBuffer();
+        
+        /**
+         * @brief Appends the file header for the current format to the buffer.
+         * @param[in] newFile true if the file was created or truncated on open.
+         */
+        void formatHeader(bool newFile);
+        
+        /**
+         * @brief Appends the file footer for the current format to the buffer.
+         */
+        void formatFooter();
+        
+        /**
+         * @brief Appends a formatted event record to the buffer.
+         */
+        void formatRecord(const OdeEventRecord& record);
+        
+        void formatTextRecord(const OdeEventRecord& record);
+        void formatCsvRecord(const OdeEventRecord& record);
+        void formatMotcRecord(const OdeEventRecord& record);
+        
+        /**
+         * @brief name of the owning File Action, for logging.
+         */
+        std::string m_name;
+        
+        /**
+         * @brief relative or absolute path to the file to write to
+         */ 
+        std::string m_filePath;
+        
+        /**
+         * @brief one of DSL_EVENT_FILE_FORMAT_*
+         */
+        uint m_format;
+        
+        /**
+         * @brief if true, the buffer is written to file on every wake.
+         */
+        bool m_forceFlush;
+        
+        /**
+         * @brief file descriptor for the open output file, -1 if closed.
+         */
+        int m_fd;
+        
+        /**
+         * @brief current size of the output file in bytes.
+         */
+        uint64_t m_fileSize;
+        
+        /**
+         * @brief monotonic time the current output file was opened.
+         */
+        gint64 m_fileOpenTime;
+        
+        /**
+         * @brief monotonic time of the last write to file.
+         */
+        gint64 m_lastWriteTime;
+        
+        /**
+         * @brief formatted output pending write.
+         */
+        std::string m_buffer;
+        
+        /**
+         * @brief queue of records pending formatting.
+         */
+        SpscRingBuffer<OdeEventRecord, DSL_ODE_EVENT_WRITER_QUEUE_SIZE> m_queue;
+        
+        /**
+         * @brief file rotation settings, 0 = unlimited.
+         */
+        std::atomic<uint> m_maxSize;
+        std::atomic<uint> m_maxDuration;
+        
+        /**
+         * @brief number of records dropped because the queue was full.
+         */
+        std::atomic<uint64_t> m_droppedCount;
+        
+        /**
+         * @brief true while records are being dropped. ** Producer only **
+         */
+        bool m_dropping;
+        
+        /**
+         * @brief set to stop the writer thread.
+         */
+        std::atomic<bool> m_stop;
+        
+        /**
+         * @brief background thread that formats and writes records.
+         */
+        GThread* m_pWriterThread;
+
+        /**
+         * @brief mutex and condition used to wake the writer thread.
+         */
+        GMutex m_wakeMutex;
+        GCond m_wakeCond;
+    };
+    
+    /**
+     * @brief Thread function for the ODE Event Writer.
+     * @param pWriter pointer to the ODE Event Writer to run.
+     * @return NULL always.
+     */
+    static gpointer OdeEventWriterThread(gpointer pWriter);
+}
+
+#endif // _DSL_ODE_EVENT_WRITER_H
@@ -26,6 +26,9 @@ THE SOFTWARE.
 
 #define DATE_BUFF_LENGTH 40
 
+// renormalize all weights when the occurrence weight exceeds this value
+#define MAX_OCCURRENCE_WEIGHT 1.0e12
+
 namespace DSL
 {
     OdeHeatMapper::OdeHeatMapper(const char* name, uint cols, uint rows,
@@ -37,8 +40,17 @@ namespace DSL
         , m_gridRectHeight(0)
         , m_bboxTestPoint(bboxTestPoint)
         , m_pColorPalette(pColorPalette)
-        , m_heatMap(rows, std::vector<uint64_t> (cols, 0))
-        , m_mostOccurrences(0)
+        , m_heatMap(rows*cols, 0)
+        , m_colorIndices(rows*cols, -1)
+        , m_locationIsDirty(rows*cols, false)
+        , m_colorIndicesDirty(true)
+        , m_rectanglesDirty(true)
+        , m_occurrenceWeight(1.0)
+        , m_decayHalfLife(0)
+        , m_decayFactor(1.0)
+        , m_decayFrameCount(0)
+        , m_mostWeight(0)
+        , m_indexedMostWeight(0)
         , m_legendEnabled(false)
         , m_legendLocation(0)
         , m_legendLeft(0)
@@ -49,6 +61,12 @@ namespace DSL
         LOG_FUNC();
         
         m_outBuffer = std::unique_ptr<uint64_t[]>(new uint64_t[cols*rows]);
+        
+        // worst case, each location is a separate rectangle
+        m_heatMapRectangles.reserve(rows*cols);
+        m_dirtyLocations.reserve(rows*cols);
+        
+        updatePaletteColors();
     }
 
     OdeHeatMapper::~OdeHeatMapper()
@@ -70,6 +88,9 @@ namespace DSL
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
             m_pColorPalette = pColorPalette;
+            
+            updatePaletteColors();
+            m_colorIndicesDirty = true;
         }
         // need to recalculated legend settings.
         return SetLegendSettings(m_legendEnabled, m_legendLocation,
@@ -95,6 +116,7 @@ namespace DSL
         
         // disable untill all params are checked.
         m_legendEnabled = false;
+        m_rectanglesDirty = true;
         
         // If client is disabling - done
         if (!enabled)
@@ -140,17 +162,32 @@ namespace DSL
         return true;
     }            
 
+    uint OdeHeatMapper::GetDecayHalfLife()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        return m_decayHalfLife;
+    }
+    
+    void OdeHeatMapper::SetDecayHalfLife(uint halfLife)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_decayHalfLife = halfLife;
+        m_decayFrameCount = 0;
+        m_decaySourceIds.clear();
+        
+        updateDecayFactor();
+    }
+
     void OdeHeatMapper::HandleOccurrence(NvDsFrameMeta* pFrameMeta, 
         NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        // one-time initialization of the grid rectangle dimensions
-        if (!m_gridRectWidth)
-        {
-            m_gridRectWidth = pFrameMeta->source_frame_width/m_cols;
-            m_gridRectHeight = pFrameMeta->source_frame_height/m_rows;
-        }
+        setGridDimensions(pFrameMeta);
         
         // get the x,y map coordinates based on the bbox and test-point.
         dsl_coordinate mapCoordinate;
@@ -160,86 +197,104 @@ namespace DSL
         // coordinates are 1-based, so subtract 1 pixel to keep within map.
         uint colPosition((mapCoordinate.x-1)/m_gridRectWidth);
         uint rowPosition((mapCoordinate.y-1)/m_gridRectHeight);
+        
+        uint index(rowPosition*m_cols + colPosition);
 
-        // increment the running count of occurrences at this poisition
-        m_heatMap[rowPosition][colPosition] += 1;
+        // increment the running weight of occurrences at this poisition
+        m_heatMap[index] += m_occurrenceWeight;
         
         // if the new total for this position is now the greatest  
-        if (m_heatMap[rowPosition][colPosition] > m_mostOccurrences)
+        if (m_heatMap[index] > m_mostWeight)
+        {
+            m_mostWeight = m_heatMap[index];
+        }
+        
+        // only the updated locations need their color index recalculated, 
+        // unless m_mostWeight has changed.
+        if (!m_locationIsDirty[index])
         {
-            m_mostOccurrences = m_heatMap[rowPosition][colPosition];
+            m_locationIsDirty[index] = true;
+            m_dirtyLocations.push_back(index);
         }
     }
   
-    void OdeHeatMapper::AddDisplayMeta(std::vector<NvDsDisplayMeta*>& displayMetaData)
+    void OdeHeatMapper::AddDisplayMeta(std::vector<NvDsDisplayMeta*>& displayMetaData,
+        NvDsFrameMeta* pFrameMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        // Add legend first, just in case we run out of display-meta
-        if (m_legendEnabled)
+        setGridDimensions(pFrameMeta);
+        
+        if (m_decayHalfLife)
         {
-            // If the legend is added to a vertical axis
-            if (m_legendLocation == DSL_HEAT_MAP_LEGEND_LOCATION_TOP or
-                m_legendLocation == DSL_HEAT_MAP_LEGEND_LOCATION_BOTTOM)
+            // Called once per Source for each batch - scale the decay by the
+            // number of Sources so that the half-life is in frames per Source.
+            if (std::find(m_decaySourceIds.begin(), m_decaySourceIds.end(),
+                pFrameMeta->source_id) == m_decaySourceIds.end())
             {
-                for (uint j=0; j < m_pColorPalette->GetSize(); j++)
-                {
-                    m_pColorPalette->SetIndex(j);
-
-                    DSL_RGBA_RECTANGLE_PTR pRectangle = DSL_RGBA_RECTANGLE_NEW("", 
-                        m_legendLeft*m_gridRectWidth + j*m_gridRectWidth*m_legendWidth, 
-                        m_legendTop*m_gridRectHeight, 
-                        m_gridRectWidth*m_legendWidth, 
-                        m_gridRectHeight*m_legendHeight, 
-                        false, m_pColorPalette, true, m_pColorPalette);
-                        
-                    pRectangle->AddMeta(displayMetaData, NULL);
-                }
+                m_decaySourceIds.push_back(pFrameMeta->source_id);
+                updateDecayFactor();
             }
-            // Else the legend is added to a horizontal axis
-            else
+            m_occurrenceWeight *= m_decayFactor;
+            
+            // Once every half-life, clear all locations that have decayed to 
+            // no occurrences, and renormalize the weights if growing too large.
+            if (++m_decayFrameCount >= m_decayHalfLife*m_decaySourceIds.size())
             {
-                for (uint i=0; i < m_pColorPalette->GetSize(); i++)
+                m_decayFrameCount = 0;
+                
+                double divisor = (m_occurrenceWeight > MAX_OCCURRENCE_WEIGHT)
+                    ? m_occurrenceWeight
+                    : 1.0;
+                    
+                // The location with the most weight may have been cleared,
+                // so m_mostWeight is recalculated from the remaining locations.
+                m_mostWeight = 0;
+                
+                for (uint i=0; i < m_heatMap.size(); i++)
                 {
-                    m_pColorPalette->SetIndex(i);
-
-                    DSL_RGBA_RECTANGLE_PTR pRectangle = DSL_RGBA_RECTANGLE_NEW("", 
-                        m_legendLeft*m_gridRectWidth, 
-                        m_legendTop*m_gridRectHeight + i*m_gridRectHeight*m_legendHeight, 
-                        m_gridRectWidth*m_legendWidth, 
-                        m_gridRectHeight*m_legendHeight, 
-                        false, m_pColorPalette, true, m_pColorPalette);
-                        
-                    pRectangle->AddMeta(displayMetaData, NULL);
+                    if (m_heatMap[i] and m_heatMap[i] < m_occurrenceWeight/2)
+                    {
+                        m_heatMap[i] = 0;
+                        if (!m_locationIsDirty[i])
+                        {
+                            m_locationIsDirty[i] = true;
+                            m_dirtyLocations.push_back(i);
+                        }
+                    }
+                    m_heatMap[i] /= divisor;
+                    m_mostWeight = std::max(m_mostWeight, m_heatMap[i]);
                 }
-            }    
+                m_occurrenceWeight /= divisor;
+            }
         }
-        // Iterate through all rows
-        for (uint i=0; i < m_rows; i++)
+        updateColorIndices();
+        
+        if (m_rectanglesDirty)
         {
-            // and for each row, iterate through all columns.
-            for (uint j=0; j < m_cols; j++)
+            updateRectangles();
+        }
+        
+        // Add legend first, just in case we run out of display-meta
+        for (auto const& legendRectangle: m_legendRectangles)
+        {
+            NvDsDisplayMeta* pDisplayMeta = DisplayMetaAllocator::Get(
+                displayMetaData, pFrameMeta, DisplayMetaAllocator::DISPLAY_META_RECTS);
+            if (!pDisplayMeta)
             {
-                // if we have at least one occurrence at the current iteration
-                if (m_heatMap[i][j])
-                {
-                    // Callculate the index into the color palette of size 10 as 
-                    // a ratio of occurrences for the current position vs. the 
-                    // position with the most occurrences. 
-                    
-                    // multiply the occurrence for the current position by 10 and 
-                    // divide by the most occurrences rouded up or down.
-                    m_pColorPalette->SetIndex(
-                        std::round((double)m_heatMap[i][j]*(m_pColorPalette->GetSize()-1) / 
-                            (double)(m_mostOccurrences)));
-                    
-                    DSL_RGBA_RECTANGLE_PTR pRectangle = DSL_RGBA_RECTANGLE_NEW(
-                        "", j*m_gridRectWidth, i*m_gridRectHeight, m_gridRectWidth, 
-                        m_gridRectHeight, false, m_pColorPalette, true, m_pColorPalette);
-                        
-                    pRectangle->AddMeta(displayMetaData, NULL);
-                }
+                return;
             }
+            pDisplayMeta->rect_params[pDisplayMeta->num_rects++] = legendRectangle;
+        }
+        for (auto const& heatMapRectangle: m_heatMapRectangles)
+        {
+            NvDsDisplayMeta* pDisplayMeta = DisplayMetaAllocator::Get(
+                displayMetaData, pFrameMeta, DisplayMetaAllocator::DISPLAY_META_RECTS);
+            if (!pDisplayMeta)
+            {
+                return;
+            }
+            pDisplayMeta->rect_params[pDisplayMeta->num_rects++] = heatMapRectangle;
         }
     }
 
@@ -248,17 +303,16 @@ namespace DSL
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        // Iterate through all rows
-        for (uint i=0; i < m_rows; i++)
-        {
-            // and for each row, iterate through all columns.
-            for (uint j=0; j < m_cols; j++)
-            {
-                // clear data by resetting to 0
-                m_heatMap[i][j] = 0;
-            }
-        }
-        m_mostOccurrences = 0;
+        // clear data by resetting to 0
+        std::fill(m_heatMap.begin(), m_heatMap.end(), 0);
+        
+        m_occurrenceWeight = 1.0;
+        m_decayFrameCount = 0;
+        m_decaySourceIds.clear();
+        updateDecayFactor();
+        m_mostWeight = 0;
+        m_indexedMostWeight = 0;
+        m_colorIndicesDirty = true;
     }
 
     void OdeHeatMapper::GetMetrics(const uint64_t** buffer, uint* size)
@@ -266,13 +320,9 @@ namespace DSL
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        int i=0;
-        for (auto const& ivec: m_heatMap)
+        for (uint i=0; i < m_heatMap.size(); i++)
         {
-            for (auto const& jvec: ivec)
-            {
-                m_outBuffer[i++] = jvec;
-            }
+            m_outBuffer[i] = getOccurrences(i);
         }
         *buffer = m_outBuffer.get();
         *size = m_cols * m_rows;
@@ -283,16 +333,18 @@ namespace DSL
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        uint charwidth = (m_mostOccurrences)
-            ? floor(log10(m_mostOccurrences)) + 2
+        uint64_t mostOccurrences = std::round(m_mostWeight/m_occurrenceWeight);
+        uint charwidth = (mostOccurrences)
+            ? floor(log10(mostOccurrences)) + 2
             : 2;
         
-        for (auto const& ivec: m_heatMap)
+        for (uint i=0; i < m_rows; i++)
         {
             std::stringstream ss;
-            for (auto const& jvec: ivec)
+            for (uint j=0; j < m_cols; j++)
             {
-                ss << std::setw(charwidth) << std::setfill(' ') << jvec;
+                ss << std::setw(charwidth) << std::setfill(' ') 
+                    << getOccurrences(i*m_cols + j);
             }
             std::cout << ss.str();
             std::cout << std::endl;
@@ -304,16 +356,18 @@ namespace DSL
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        uint charwidth = (m_mostOccurrences)
-            ? floor(log10(m_mostOccurrences)) + 2
+        uint64_t mostOccurrences = std::round(m_mostWeight/m_occurrenceWeight);
+        uint charwidth = (mostOccurrences)
+            ? floor(log10(mostOccurrences)) + 2
             : 2;
 
-        for (auto const& ivec: m_heatMap)
+        for (uint i=0; i < m_rows; i++)
         {
             std::stringstream ss;
-            for (auto const& jvec: ivec)
+            for (uint j=0; j < m_cols; j++)
             {
-                ss << std::setw(charwidth) << std::setfill(' ') << jvec;
+                ss << std::setw(charwidth) << std::setfill(' ') 
+                    << getOccurrences(i*m_cols + j);
             }
             LOG_INFO(ss.str());
         }
@@ -344,8 +398,9 @@ namespace DSL
             return false;
         }
 
-        uint charwidth = (m_mostOccurrences)
-            ? floor(log10(m_mostOccurrences)) + 2
+        uint64_t mostOccurrences = std::round(m_mostWeight/m_occurrenceWeight);
+        uint charwidth = (mostOccurrences)
+            ? floor(log10(mostOccurrences)) + 2
             : 2;
     
         if ( format == DSL_EVENT_FILE_FORMAT_TEXT)
@@ -363,22 +418,23 @@ namespace DSL
             ostream << " File opened: " << dateTimeStr.c_str() << "\n";
             ostream << "-------------------------------------------------------------------" << "\n";
             
-            for (auto const& ivec: m_heatMap)
+            for (uint i=0; i < m_rows; i++)
             {
-                for (auto const& jvec: ivec)
+                for (uint j=0; j < m_cols; j++)
                 {
-                    ostream << std::setw(charwidth) << std::setfill(' ') << jvec;
+                    ostream << std::setw(charwidth) << std::setfill(' ') 
+                        << getOccurrences(i*m_cols + j);
                 }
                 ostream << std::endl;
             }
         }
         else
         {
-            for (auto const& ivec: m_heatMap)
+            for (uint i=0; i < m_rows; i++)
             {
-                for (auto const& jvec: ivec)
+                for (uint j=0; j < m_cols; j++)
                 {
-                    ostream << jvec << ",";
+                    ostream << getOccurrences(i*m_cols + j) << ",";
                 }
                 ostream << std::endl;
             }
@@ -388,6 +444,159 @@ namespace DSL
         return true;
     }
 
+    void OdeHeatMapper::setGridDimensions(NvDsFrameMeta* pFrameMeta)
+    {
+        // one-time initialization of the grid rectangle dimensions
+        if (!m_gridRectWidth and pFrameMeta)
+        {
+            m_gridRectWidth = pFrameMeta->source_frame_width/m_cols;
+            m_gridRectHeight = pFrameMeta->source_frame_height/m_rows;
+            m_rectanglesDirty = true;
+        }
+    }
+    
+    uint64_t OdeHeatMapper::getOccurrences(uint index)
+    {
+        return std::round(m_heatMap[index]/m_occurrenceWeight);
+    }
+    
+    void OdeHeatMapper::updatePaletteColors()
+    {
+        m_paletteColors.clear();
+        for (uint i=0; i < m_pColorPalette->GetSize(); i++)
+        {
+            m_pColorPalette->SetIndex(i);
+            m_pColorPalette->Lock();
+            m_paletteColors.push_back(*m_pColorPalette);
+            m_pColorPalette->Unlock();
+        }
+    }
+    
+    void OdeHeatMapper::updateDecayFactor()
+    {
+        // Rather than scaling every grid location down each frame, the weight
+        // of new occurrences is scaled up - by 2^(1/(halfLife*sources)) for 
+        // each frame of each Source.
+        uint frames = m_decayHalfLife*std::max((size_t)1, m_decaySourceIds.size());
+        
+        m_decayFactor = (m_decayHalfLife)
+            ? std::pow(2.0, 1.0/frames)
+            : 1.0;
+    }
+    
+    void OdeHeatMapper::updateColorIndices()
+    {
+        // Calculate the index into the color palette as a ratio of the weight 
+        // for the current position vs. the position with the most weight. The 
+        // ratio - and therefore the index - is unaffected by decay.
+        double maxIndex = m_paletteColors.size() ? m_paletteColors.size()-1 : 0;
+        
+        // If the most weight has changed, all indices must be recalculated.
+        if (m_colorIndicesDirty or m_mostWeight != m_indexedMostWeight)
+        {
+            for (uint i=0; i < m_heatMap.size(); i++)
+            {
+                int colorIndex = (m_heatMap[i])
+                    ? std::round(m_heatMap[i]*maxIndex/m_mostWeight)
+                    : -1;
+                if (colorIndex != m_colorIndices[i])
+                {
+                    m_colorIndices[i] = colorIndex;
+                    m_rectanglesDirty = true;
+                }
+            }
+            m_colorIndicesDirty = false;
+            m_indexedMostWeight = m_mostWeight;
+        }
+        else
+        {
+            for (auto const& i: m_dirtyLocations)
+            {
+                int colorIndex = (m_heatMap[i])
+                    ? std::round(m_heatMap[i]*maxIndex/m_mostWeight)
+                    : -1;
+                if (colorIndex != m_colorIndices[i])
+                {
+                    m_colorIndices[i] = colorIndex;
+                    m_rectanglesDirty = true;
+                }
+            }
+        }
+        for (auto const& i: m_dirtyLocations)
+        {
+            m_locationIsDirty[i] = false;
+        }
+        m_dirtyLocations.clear();
+    }
+    
+    void OdeHeatMapper::updateRectangles()
+    {
+        m_legendRectangles.clear();
+        m_heatMapRectangles.clear();
+        m_rectanglesDirty = false;
+        
+        if (m_legendEnabled)
+        {
+            for (uint k=0; k < m_paletteColors.size(); k++)
+            {
+                // If the legend is added to a vertical axis
+                NvOSD_RectParams rectParams{0};
+                if (m_legendLocation == DSL_HEAT_MAP_LEGEND_LOCATION_TOP or
+                    m_legendLocation == DSL_HEAT_MAP_LEGEND_LOCATION_BOTTOM)
+                {
+                    rectParams.left = m_legendLeft*m_gridRectWidth + 
+                        k*m_gridRectWidth*m_legendWidth;
+                    rectParams.top = m_legendTop*m_gridRectHeight;
+                }
+                // Else the legend is added to a horizontal axis
+                else
+                {
+                    rectParams.left = m_legendLeft*m_gridRectWidth;
+                    rectParams.top = m_legendTop*m_gridRectHeight + 
+                        k*m_gridRectHeight*m_legendHeight;
+                }
+                rectParams.width = m_gridRectWidth*m_legendWidth;
+                rectParams.height = m_gridRectHeight*m_legendHeight;
+                rectParams.border_color = m_paletteColors[k];
+                rectParams.has_bg_color = true;
+                rectParams.bg_color = m_paletteColors[k];
+                
+                m_legendRectangles.push_back(rectParams);
+            }
+        }
+        
+        // Iterate through all rows merging adjacent locations of the same 
+        // color into a single rectangle - run-length encoding each row.
+        for (uint i=0; i < m_rows; i++)
+        {
+            uint j(0);
+            while (j < m_cols)
+            {
+                int colorIndex = m_colorIndices[i*m_cols + j];
+                if (colorIndex < 0)
+                {
+                    j++;
+                    continue;
+                }
+                uint runStart(j);
+                while (j < m_cols and m_colorIndices[i*m_cols + j] == colorIndex)
+                {
+                    j++;
+                }
+                NvOSD_RectParams rectParams{0};
+                rectParams.left = runStart*m_gridRectWidth;
+                rectParams.top = i*m_gridRectHeight;
+                rectParams.width = (j - runStart)*m_gridRectWidth;
+                rectParams.height = m_gridRectHeight;
+                rectParams.border_color = m_paletteColors[colorIndex];
+                rectParams.has_bg_color = true;
+                rectParams.bg_color = m_paletteColors[colorIndex];
+                
+                m_heatMapRectangles.push_back(rectParams);
+            }
+        }
+    }
+
     void OdeHeatMapper::getCoordinate(NvDsObjectMeta* pObjectMeta, 
         dsl_coordinate& mapCoordinate)
     {
@@ -96,6 +96,22 @@ namespace DSL
         bool SetLegendSettings(bool enabled, uint location, 
             uint width, uint height);
         
+        /**
+         * @brief Gets the current exponential decay setting for the OdeHeatMapper.
+         * @return half-life in units of frames, 0 = decay disabled.
+         */
+        uint GetDecayHalfLife();
+        
+        /**
+         * @brief Sets the exponential decay setting for the OdeHeatMapper. 
+         * When enabled, the weight of all previous occurrences halves every
+         * halfLife frames so that the heat-map does not saturate over time.
+         * The half-life is per Source, i.e. decay is scaled by the number of
+         * Sources the Heat-Mapper is adding display meta for.
+         * @param[in] halfLife half-life in units of frames, 0 to disable.
+         */
+        void SetDecayHalfLife(uint halfLife);
+        
         /**
          * @brief Handles the ODE occurrence by updating the heat-map with new 
          * the bounding box center point provided by pObjectMeta,  
@@ -106,36 +122,39 @@ namespace DSL
 
         /**
          * @brief and adds the heat-map's display-metadata to displayMetaData for
-         * downstream display.
+         * downstream display. The rectangles are only regenerated if one or
+         * more grid locations changed color since the previous frame.
          * @param[in] displayMetaData Vector of metadata structures to add the 
          * heat-map's display-metadata to.
+         * @param[in] pFrameMeta pointer to the Frame Meta data for the current frame
          */
-        void AddDisplayMeta(std::vector<NvDsDisplayMeta*>& displayMetaData);
+        void AddDisplayMeta(std::vector<NvDsDisplayMeta*>& displayMetaData,
+            NvDsFrameMeta* pFrameMeta);
         
         /**
-         * @brief Resets the OdeHeatMapper which clears the 2D m_heatMap vector.
+         * @brief Resets the OdeHeatMapper which clears the m_heatMap grid.
          */
         void ClearMetrics();
         
         /**
-         * @brief Gets the 2D m_heatMap vector as a linear buffer.
+         * @brief Gets the m_heatMap grid as a linear buffer of occurrences.
          * @param[out] buffer pointer to the returned buffer
          * @param[out] size of the return buffer m_cols*m_rows
          */
         void GetMetrics(const uint64_t** buffer, uint* size); 
 
         /**
-         * @brief Prints the 2D m_heatMap vector to the console.
+         * @brief Prints the m_heatMap grid to the console.
          */
         void PrintMetrics(); 
         
         /**
-         * @brief Logs the 2D m_heatMap vector at level = INFO.
+         * @brief Logs the m_heatMap grid at level = INFO.
          */
         void LogMetrics(); 
         
         /**
-         * @brief Writes the 2D m_heatMap vector to a file.
+         * @brief Writes the m_heatMap grid to a file.
          * @param[in] relative or absolute path to the file to write to.
          * @param[in] mode file open/write mode, one of DSL_EVENT_FILE_MODE_* options
          * @param[in] format one of the DSL_EVENT_FILE_FORMAT_* options
@@ -152,6 +171,41 @@ namespace DSL
          */
         void getCoordinate(NvDsObjectMeta* pObjectMeta, 
             dsl_coordinate& mapCoordinate);
+            
+        /**
+         * @brief one-time initialization of the grid rectangle dimensions
+         * @param[in] pFrameMeta frame meta with the source frame dimensions.
+         */
+        void setGridDimensions(NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief returns the number of occurrences for a grid location with 
+         * decay applied.
+         * @param[in] index linear index of the grid location.
+         */
+        uint64_t getOccurrences(uint index);
+        
+        /**
+         * @brief updates the cached color palette colors from m_pColorPalette.
+         */
+        void updatePaletteColors();
+        
+        /**
+         * @brief updates the cached color palette index for all dirty grid
+         * locations, or for all locations if m_mostWeight has changed.
+         */
+        void updateColorIndices();
+        
+        /**
+         * @brief regenerates the legend and run-length heat-map rectangles.
+         */
+        void updateRectangles();
+        
+        /**
+         * @brief updates m_decayFactor for the current half-life and number
+         * of Sources in m_decaySourceIds.
+         */
+        void updateDecayFactor();
     
         /**
          * @brief number of columns along the horizontal axis
@@ -188,9 +242,88 @@ namespace DSL
         DSL_RGBA_COLOR_PALETTE_PTR m_pColorPalette;
         
         /**
-         * @brief two dimensional vector sized cols x rows
+         * @brief contiguous grid sized cols x rows in row-major order, of 
+         * weighted occurrences. A grid location's occurrences = weight / 
+         * m_occurrenceWeight.
+         */
+        std::vector<double> m_heatMap;
+        
+        /**
+         * @brief cached color palette index for each grid location, 
+         * -1 if the location has no occurrences.
+         */
+        std::vector<int> m_colorIndices;
+        
+        /**
+         * @brief linear indices of grid locations updated since the color
+         * indices were last calculated.
+         */
+        std::vector<uint> m_dirtyLocations;
+        
+        /**
+         * @brief true for each grid location in m_dirtyLocations.
          */
-        std::vector<std::vector<uint64_t>> m_heatMap;
+        std::vector<bool> m_locationIsDirty;
+        
+        /**
+         * @brief true if all color indices need to be recalculated.
+         */
+        bool m_colorIndicesDirty;
+        
+        /**
+         * @brief true if the legend and heat-map rectangles need to be
+         * regenerated.
+         */
+        bool m_rectanglesDirty;
+        
+        /**
+         * @brief cached colors for each index in m_pColorPalette.
+         */
+        std::vector<NvOSD_ColorParams> m_paletteColors;
+        
+        /**
+         * @brief cached legend rectangles, one for each palette color.
+         */
+        std::vector<NvOSD_RectParams> m_legendRectangles;
+        
+        /**
+         * @brief cached heat-map rectangles, where adjacent grid locations
+         * in the same row with the same color are merged into one rectangle.
+         */
+        std::vector<NvOSD_RectParams> m_heatMapRectangles;
+        
+        /**
+         * @brief weight added to a grid location for each new occurrence. 
+         * Fixed at 1.0 unless decay is enabled, in which case the weight grows
+         * by m_decayFactor every frame, decaying all previous occurrences
+         * without having to update every grid location.
+         */
+        double m_occurrenceWeight;
+        
+        /**
+         * @brief decay half-life in units of frames, 0 = disabled.
+         */
+        uint m_decayHalfLife;
+        
+        /**
+         * @brief growth factor applied to m_occurrenceWeight every frame.
+         * Scaled by the number of Sources in m_decaySourceIds.
+         */
+        double m_decayFactor;
+        
+        /**
+         * @brief number of frames since grid locations that have decayed 
+         * to no occurrences were last cleared.
+         */
+        uint m_decayFrameCount;
+        
+        /**
+         * @brief unique Source Ids the Heat-Mapper has added display meta for
+         * since decay was set or the metrics were cleared. AddDisplayMeta is 
+         * called once per Source per batch, so the decay for each call is 
+         * scaled by the number of Sources.
+         */
+        std::vector<uint> m_decaySourceIds;
         
         /**
          * @brief a linear array of heat-map metrics updated on
@@ -199,9 +332,15 @@ namespace DSL
         std::unique_ptr<uint64_t[]> m_outBuffer;
         
         /**
-         * @brief the most occurrences in any one map location..
+         * @brief the greatest weight in any one map location.
+         */
+        double m_mostWeight;
+        
+        /**
+         * @brief value of m_mostWeight when the color indices were last
+         * calculated.
          */
-        uint64_t m_mostOccurrences;
+        double m_indexedMostWeight;
         
         /**
          * @brief true if Legend display is enabled, false otherwise.
@@ -27,19 +27,101 @@ THE SOFTWARE.
 
 namespace DSL
 {
+    BboxTrace::BboxTrace(uint capacity)
+        : m_coordinates(capacity)
+        , m_head(0)
+        , m_size(0)
+    {
+        // No function log - avoid overhead.
+    }
+    
+    void BboxTrace::SetCapacity(uint capacity)
+    {
+        if (capacity == m_coordinates.size())
+        {
+            return;
+        }
+        // keep the most recent coordinates that fit in the new capacity
+        size_t size = std::min(m_size, (size_t)capacity);
+        
+        std::vector<NvBbox_Coords> coordinates(capacity);
+        for (size_t i = 0; i < size; i++)
+        {
+            coordinates[i] = At(m_size - size + i);
+        }
+        m_coordinates.swap(coordinates);
+        m_head = 0;
+        m_size = size;
+    }
+    
+    void BboxTrace::PushBack(const NvBbox_Coords& coordinates)
+    {
+        // No function log - avoid overhead.
+        
+        size_t capacity = m_coordinates.size();
+        if (!capacity)
+        {
+            return;
+        }
+        // if full, overwrite the oldest coordinates
+        if (m_size == capacity)
+        {
+            m_coordinates[m_head] = coordinates;
+            m_head = (m_head + 1) % capacity;
+        }
+        else
+        {
+            m_coordinates[(m_head + m_size) % capacity] = coordinates;
+            m_size++;
+        }
+    }
+    
+    void BboxTrace::PopFront()
+    {
+        // No function log - avoid overhead.
+        
+        if (m_size)
+        {
+            m_head = (m_head + 1) % m_coordinates.size();
+            m_size--;
+        }
+    }
+    
+    //********************************************************************************
+
     TrackedObject::TrackedObject(uint64_t trackingId, uint64_t frameNumber,
         const NvBbox_Coords* pCoordinates, DSL_RGBA_COLOR_PTR pColor, 
         uint maxHistory)
         : trackingId(trackingId)
-        , m_maxHistory(maxHistory)
         , frameCount(0)
         , preEventFrameCount(1)
         , onEventFrameCount(0)
+        , m_maxHistory(maxHistory)
+        , m_bboxTrace(maxHistory)
+        , m_prevBboxTrace(maxHistory)
     {
         // No function log - avoid overhead.
         
-        m_pBboxTrace = std::shared_ptr<std::deque<std::shared_ptr<NvBbox_Coords>>>(
-            new std::deque<std::shared_ptr<NvBbox_Coords>>);
+        Reset(trackingId, frameNumber, pCoordinates, pColor, maxHistory);
+    }
+    
+    void TrackedObject::Reset(uint64_t trackingId, uint64_t frameNumber,
+        const NvBbox_Coords* pCoordinates, DSL_RGBA_COLOR_PTR pColor, 
+        uint maxHistory)
+    {
+        // No function log - avoid overhead.
+        
+        this->trackingId = trackingId;
+        frameCount = 0;
+        preEventFrameCount = 1;
+        onEventFrameCount = 0;
+        
+        if (maxHistory != m_maxHistory)
+        {
+            SetMaxHistory(maxHistory);
+        }
+        m_bboxTrace.Clear();
+        m_prevBboxTrace.Clear();
         
         timeval creationTime;
         gettimeofday(&creationTime, NULL);
@@ -48,13 +130,18 @@ namespace DSL
         // update will increment the frameCount to 1
         Update(frameNumber, pCoordinates);
         
-        if (pColor)
+        NvOSD_ColorParams colorParams = (pColor) 
+            ? (NvOSD_ColorParams)*pColor 
+            : NvOSD_ColorParams{0.0, 0.0, 0.0, 0.0};
+
+        // reuse the color if no previous trace is still holding on to it.
+        if (m_pColor and m_pColor.use_count() == 1)
         {
-            m_pColor = std::shared_ptr<RgbaColor>(new RgbaColor(*pColor));
+            static_cast<NvOSD_ColorParams&>(*m_pColor) = colorParams;
         }
         else
         {
-            m_pColor = std::shared_ptr<RgbaColor>(new RgbaColor());
+            m_pColor = std::shared_ptr<RgbaColor>(new RgbaColor("", colorParams));
         }
     }
     
@@ -63,6 +150,8 @@ namespace DSL
         LOG_FUNC();
         
         m_maxHistory = maxHistory;
+        m_bboxTrace.SetCapacity(maxHistory);
+        m_prevBboxTrace.SetCapacity(maxHistory);
     }
     
     void TrackedObject::Update(uint64_t currentFrameNumber, 
@@ -76,40 +165,20 @@ namespace DSL
         // update the tracked object's frame number - the filter used for purging.
         frameNumber = currentFrameNumber;
         
-        // Copy only the rectangle coordinates of the Object's RectParams
-        std::shared_ptr pBboxCoords = 
-            std::shared_ptr<NvBbox_Coords>(new NvBbox_Coords);
-            
-        *pBboxCoords = *pCoordinates;
-
         // If maintaining bbox trace-point history
         if (m_maxHistory)
         {
-            // if there's a previous trace, purge from this deque first.
-            if (m_pPrevBboxTrace)
+            // if there's a previous trace, purge from it first so that both
+            // traces together stay within the max history.
+            while (!m_prevBboxTrace.IsEmpty() and 
+                (m_prevBboxTrace.Size() + m_bboxTrace.Size() >= m_maxHistory))
             {
-                // while there are elements to purge..
-                while (m_pPrevBboxTrace and 
-                    (m_pPrevBboxTrace->size() + m_pBboxTrace->size() >= m_maxHistory))
-                {
-                   m_pPrevBboxTrace->pop_front();
-                   
-                   // If we've emptied the previous trace deque then remove it.
-                   if (m_pPrevBboxTrace->empty())
-                   {
-                       m_pPrevBboxTrace = nullptr;
-                   }
-                }
-                
+                m_prevBboxTrace.PopFront();
             }
-            else
-            {
-                while (m_pBboxTrace->size() >= m_maxHistory)
-                {
-                   m_pBboxTrace->pop_front();
-                }
-            }            
-            m_pBboxTrace->push_back(pBboxCoords);
+            
+            // Copy only the rectangle coordinates of the Object's RectParams.
+            // The ring-buffer overwrites the oldest coordinates when full.
+            m_bboxTrace.PushBack(*pCoordinates);
         }
     }
 
@@ -125,14 +194,20 @@ namespace DSL
     dsl_coordinate TrackedObject::GetFirstCoordinate(uint testPoint)
     {
         dsl_coordinate traceCoordinate{0};
-        getCoordinate(m_pBboxTrace->front(), testPoint, traceCoordinate);
+        if (!m_bboxTrace.IsEmpty())
+        {
+            getCoordinate(m_bboxTrace.Front(), testPoint, traceCoordinate);
+        }
         return traceCoordinate;
     }
     
     dsl_coordinate TrackedObject::GetLastCoordinate(uint testPoint)
     {
         dsl_coordinate traceCoordinate{0};
-        getCoordinate(m_pBboxTrace->back(), testPoint, traceCoordinate);
+        if (!m_bboxTrace.IsEmpty())
+        {
+            getCoordinate(m_bboxTrace.Back(), testPoint, traceCoordinate);
+        }
         return traceCoordinate;
     }
     
@@ -141,30 +216,7 @@ namespace DSL
     {
         // No function log - avoid overhead.
         
-        // Create the trace - i.e. a vector of pre-sized blank coordinates
-        std::vector<dsl_coordinate> traceCoordinates;
-
-        dsl_coordinate traceCoordinate{0};
-            
-        if (method == DSL_OBJECT_TRACE_TEST_METHOD_END_POINTS)
-        {
-            getCoordinate(m_pBboxTrace->front(), testPoint, traceCoordinate);
-            traceCoordinates.push_back(traceCoordinate);
-            
-            getCoordinate(m_pBboxTrace->back(), testPoint, traceCoordinate);
-            traceCoordinates.push_back(traceCoordinate);
-        }
-
-        else
-        {
-            for (const auto& ideque: *m_pBboxTrace)
-            {
-                getCoordinate(ideque, testPoint, traceCoordinate);
-                traceCoordinates.push_back(traceCoordinate);
-            }
-        }
-        return DSL_RGBA_MULTI_LINE_NEW("", traceCoordinates.data(), 
-            traceCoordinates.size(), lineWidth, m_pColor);
+        return getTrace(m_bboxTrace, testPoint, method, lineWidth);
     }
 
     DSL_RGBA_MULTI_LINE_PTR TrackedObject::GetPreviousTrace(
@@ -172,92 +224,103 @@ namespace DSL
     {
         // No function log - avoid overhead.
         
-        if (m_pPrevBboxTrace == nullptr)
+        if (m_prevBboxTrace.IsEmpty())
         {
             return nullptr;
         }
-        
-        // Create the trace - i.e. a vector of pre-sized blank coordinates
+        return getTrace(m_prevBboxTrace, testPoint, method, lineWidth);
+    }
+
+    void TrackedObject::HandleOccurrence()
+    {
+        // Swap the traces - no allocation - and start a new current trace.
+        std::swap(m_bboxTrace, m_prevBboxTrace);
+        m_bboxTrace.Clear();
+
+        // Add last point of previous trace as first point to current trace to ensure
+        // a continuous line (line segment between previous-trace-end and current-trace-start) 
+        if (!m_prevBboxTrace.IsEmpty())
+        {
+            m_bboxTrace.PushBack(m_prevBboxTrace.Back());
+        }
+
+        preEventFrameCount = 1;
+        onEventFrameCount = 0;
+    }
+    
+    DSL_RGBA_MULTI_LINE_PTR TrackedObject::getTrace(const BboxTrace& trace,
+        uint testPoint, uint method, uint lineWidth)
+    {
+        // Create the trace - i.e. a vector of coordinates
         std::vector<dsl_coordinate> traceCoordinates;
 
         dsl_coordinate traceCoordinate{0};
-            
-        if (method == DSL_OBJECT_TRACE_TEST_METHOD_END_POINTS)
+        
+        if (trace.IsEmpty())
+        {
+            // return an empty trace
+        }
+        else if (method == DSL_OBJECT_TRACE_TEST_METHOD_END_POINTS)
         {
-            getCoordinate(m_pPrevBboxTrace->front(), testPoint, traceCoordinate);
+            getCoordinate(trace.Front(), testPoint, traceCoordinate);
             traceCoordinates.push_back(traceCoordinate);
             
-            getCoordinate(m_pPrevBboxTrace->back(), testPoint, traceCoordinate);
+            getCoordinate(trace.Back(), testPoint, traceCoordinate);
             traceCoordinates.push_back(traceCoordinate);
         }
-
         else
         {
-            traceCoordinates.reserve(m_pPrevBboxTrace->size());
-            for (const auto& ideque: *m_pPrevBboxTrace)
+            traceCoordinates.reserve(trace.Size());
+            for (size_t i = 0; i < trace.Size(); i++)
             {
-                getCoordinate(ideque, testPoint, traceCoordinate);
+                getCoordinate(trace.At(i), testPoint, traceCoordinate);
                 traceCoordinates.push_back(traceCoordinate);
             }
         }
         return DSL_RGBA_MULTI_LINE_NEW("", traceCoordinates.data(), 
             traceCoordinates.size(), lineWidth, m_pColor);
     }
-
-    void TrackedObject::HandleOccurrence()
-    {
-        m_pPrevBboxTrace = m_pBboxTrace;
-        m_pBboxTrace = std::shared_ptr<std::deque<std::shared_ptr<NvBbox_Coords>>>(
-            new std::deque<std::shared_ptr<NvBbox_Coords>>);
-
-        // Add last point of previous trace as first point to current trace to ensure
-        // a continuous line (line segment between previous-trace-end and current-trace-start) 
-        m_pBboxTrace->push_back(m_pPrevBboxTrace->back());
-
-        preEventFrameCount = 1;
-        onEventFrameCount = 0;
-    }
     
-    void TrackedObject::getCoordinate(std::shared_ptr<NvBbox_Coords> pBbox, 
+    void TrackedObject::getCoordinate(const NvBbox_Coords& bbox, 
         uint testPoint, dsl_coordinate& traceCoordinate)
     {
         switch (testPoint)
         {
         case DSL_BBOX_POINT_CENTER :
-            traceCoordinate.x = round(pBbox->left + pBbox->width/2);
-            traceCoordinate.y = round(pBbox->top + pBbox->height/2);
+            traceCoordinate.x = round(bbox.left + bbox.width/2);
+            traceCoordinate.y = round(bbox.top + bbox.height/2);
             break;
         case DSL_BBOX_POINT_NORTH_WEST :
-            traceCoordinate.x = round(pBbox->left);
-            traceCoordinate.y = round(pBbox->top);
+            traceCoordinate.x = round(bbox.left);
+            traceCoordinate.y = round(bbox.top);
             break;
         case DSL_BBOX_POINT_NORTH :
-            traceCoordinate.x = round(pBbox->left + pBbox->width/2);
-            traceCoordinate.y = round(pBbox->top);
+            traceCoordinate.x = round(bbox.left + bbox.width/2);
+            traceCoordinate.y = round(bbox.top);
             break;
         case DSL_BBOX_POINT_NORTH_EAST :
-            traceCoordinate.x = round(pBbox->left + pBbox->width);
-            traceCoordinate.y = round(pBbox->top);
+            traceCoordinate.x = round(bbox.left + bbox.width);
+            traceCoordinate.y = round(bbox.top);
             break;
         case DSL_BBOX_POINT_EAST :
-            traceCoordinate.x = round(pBbox->left + pBbox->width);
-            traceCoordinate.y = round(pBbox->top + pBbox->height/2);
+            traceCoordinate.x = round(bbox.left + bbox.width);
+            traceCoordinate.y = round(bbox.top + bbox.height/2);
             break;
         case DSL_BBOX_POINT_SOUTH_EAST :
-            traceCoordinate.x = round(pBbox->left + pBbox->width);
-            traceCoordinate.y = round(pBbox->top + pBbox->height);
+            traceCoordinate.x = round(bbox.left + bbox.width);
+            traceCoordinate.y = round(bbox.top + bbox.height);
             break;
         case DSL_BBOX_POINT_SOUTH :
-            traceCoordinate.x = round(pBbox->left + pBbox->width/2);
-            traceCoordinate.y = round(pBbox->top + pBbox->height);
+            traceCoordinate.x = round(bbox.left + bbox.width/2);
+            traceCoordinate.y = round(bbox.top + bbox.height);
             break;
         case DSL_BBOX_POINT_SOUTH_WEST :
-            traceCoordinate.x = round(pBbox->left);
-            traceCoordinate.y = round(pBbox->top + pBbox->height);
+            traceCoordinate.x = round(bbox.left);
+            traceCoordinate.y = round(bbox.top + bbox.height);
             break;
         case DSL_BBOX_POINT_WEST :
-            traceCoordinate.x = round(pBbox->left);
-            traceCoordinate.y = round(pBbox->top + pBbox->height/2);
+            traceCoordinate.x = round(bbox.left);
+            traceCoordinate.y = round(bbox.top + bbox.height/2);
             break;
         default:
             LOG_ERROR("Invalid DSL_BBOX_POINT = '" << testPoint 
@@ -270,6 +333,8 @@ namespace DSL
     
     TrackedObjects::TrackedObjects(uint maxHistory)
         : m_maxHistory(maxHistory)
+        , m_slots(64)  // initial number of slots, must be a power of two.
+        , m_size(0)
     {
         LOG_FUNC();
     }
@@ -278,23 +343,7 @@ namespace DSL
     {
         // No function log - avoid overhead.
 
-        // If the sourceId does not exist, then not tracked.
-        if (m_trackedObjectsPerSource.find(sourceId) == 
-            m_trackedObjectsPerSource.end())
-        {
-            return false;
-        }
-        std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-            m_trackedObjectsPerSource[sourceId];
-            
-        // else, if this is the first occurrence of a specific object for this source
-        if (pTrackedObjects->find(trackingId) == pTrackedObjects->end())
-        {
-            return false;
-        }
-        
-        // else, the object is currently being tracked.
-        return true;
+        return findSlot(sourceId, trackingId) != m_slots.size();
     }
     
     std::shared_ptr<TrackedObject> TrackedObjects::GetObject(
@@ -302,23 +351,12 @@ namespace DSL
     {
         // No function log - avoid overhead.
 
-        // If the sourceId does not exist, then not tracked.
-        if (m_trackedObjectsPerSource.find(sourceId) == 
-            m_trackedObjectsPerSource.end())
-        {
-            return nullptr;
-        }
-        std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-            m_trackedObjectsPerSource[sourceId];
-            
-        // else, if this is the first occurrence of a specific object for this source
-        if (pTrackedObjects->find(trackingId) == pTrackedObjects->end())
+        size_t index = findSlot(sourceId, trackingId);
+        if (index == m_slots.size())
         {
             return nullptr;
         }
-        
-        // else, the object is currently being tracked.
-        return pTrackedObjects->at(trackingId);
+        return m_slots[index].m_pObject;
     }
     
     std::shared_ptr<TrackedObject> TrackedObjects::Track(NvDsFrameMeta* pFrameMeta, 
@@ -326,122 +364,107 @@ namespace DSL
     {
         // No function log - avoid overhead.
 
-        // if this is the first occurrence of any object for this source
-        if (m_trackedObjectsPerSource.find(pFrameMeta->source_id) == 
-            m_trackedObjectsPerSource.end())
+        if (IsTracked(pFrameMeta->source_id, pObjectMeta->object_id))
         {
-            LOG_DEBUG("First object detected with id = " << pObjectMeta->object_id 
-                << " for source = " << pFrameMeta->source_id);
-            
-            // create a new tracked object for this tracking Id and source
-            std::shared_ptr<TrackedObject> pTrackedObject = 
-                std::shared_ptr<TrackedObject>(new TrackedObject(
-                    pObjectMeta->object_id, pFrameMeta->frame_num, 
-                    (NvBbox_Coords*)&pObjectMeta->rect_params, 
-                    pColor, m_maxHistory));
-                
-            // create a map of tracked objects for this source    
-            std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-                std::shared_ptr<TrackedObjectsT>(new TrackedObjectsT());
-                
-            // insert the new tracked object into the new map    
-            pTrackedObjects->insert(std::pair<uint64_t, 
-                std::shared_ptr<TrackedObject>>(pObjectMeta->object_id, 
-                    pTrackedObject));
-                
-            // add the map of tracked objects for this source to the map of 
-            // all tracked objects.
-            m_trackedObjectsPerSource[pFrameMeta->source_id] = pTrackedObjects;
-            
-            return pTrackedObject;
+            LOG_ERROR("Object with id = " << pObjectMeta->object_id 
+                << " for source = " << pFrameMeta->source_id 
+                << " is already being tracked");
+            return nullptr;
         }
-        std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-            m_trackedObjectsPerSource[pFrameMeta->source_id];
+
+        LOG_DEBUG("New object detected with id = " << pObjectMeta->object_id 
+            << " for source = " << pFrameMeta->source_id);
             
-        // else, if this is the first occurrence of a specific object for this source
-        if (pTrackedObjects->find(pObjectMeta->object_id) == pTrackedObjects->end())
+        // keep the load factor at or below 3/4 to bound the probe lengths.
+        if ((m_size + 1)*4 > m_slots.size()*3)
+        {
+            grow();
+        }
+        
+        // reuse a previously purged object if available, else create a new one.
+        std::shared_ptr<TrackedObject> pTrackedObject;
+        if (m_freeObjects.size())
         {
-            LOG_DEBUG("New object detected with id = " << pObjectMeta->object_id 
-                << " for source = " << pFrameMeta->source_id);
+            pTrackedObject = std::move(m_freeObjects.back());
+            m_freeObjects.pop_back();
             
-            // create a new tracked object for this tracking Id and source
-            std::shared_ptr<TrackedObject> pTrackedObject = 
-                std::shared_ptr<TrackedObject>(new TrackedObject(
-                    pObjectMeta->object_id, pFrameMeta->frame_num,
-                    (NvBbox_Coords*)&pObjectMeta->rect_params, 
-                    pColor, m_maxHistory));
+            pTrackedObject->Reset(pObjectMeta->object_id, pFrameMeta->frame_num,
+                (NvBbox_Coords*)&pObjectMeta->rect_params, pColor, m_maxHistory);
+        }
+        else
+        {
+            pTrackedObject = std::shared_ptr<TrackedObject>(new TrackedObject(
+                pObjectMeta->object_id, pFrameMeta->frame_num, 
+                (NvBbox_Coords*)&pObjectMeta->rect_params, 
+                pColor, m_maxHistory));
+        }
 
-            // insert the new tracked object into the new map    
-            pTrackedObjects->insert(std::pair<uint64_t, 
-                std::shared_ptr<TrackedObject>>(pObjectMeta->object_id, 
-                    pTrackedObject));
-            
-            return pTrackedObject;
+        // linear probe for the first empty slot
+        size_t mask = m_slots.size() - 1;
+        size_t index = homeSlot(pFrameMeta->source_id, pObjectMeta->object_id);
+        while (m_slots[index].m_pObject)
+        {
+            index = (index + 1) & mask;
         }
+        m_slots[index].m_sourceId = pFrameMeta->source_id;
+        m_slots[index].m_trackingId = pObjectMeta->object_id;
+        m_slots[index].m_pObject = pTrackedObject;
+        m_size++;
         
-        LOG_ERROR("Object with id = " << pObjectMeta->object_id 
-            << " for source = " << pFrameMeta->source_id 
-            << " is already being tracked");
-        return nullptr;
+        return pTrackedObject;
     }
 
     void TrackedObjects::DeleteObject(uint sourceId, uint64_t trackingId)
     {
-        // If the sourceId does not exist, then not tracked.
-        if (m_trackedObjectsPerSource.find(sourceId) == 
-            m_trackedObjectsPerSource.end())
-        {
-            LOG_ERROR("Source = " << sourceId 
-                << " is not being tracked");
-            return;
-        }
-        std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-            m_trackedObjectsPerSource[sourceId];
-            
-        // else, if this is the first occurrence of a specific object for this source
-        if (pTrackedObjects->find(trackingId) == pTrackedObjects->end())
+        size_t index = findSlot(sourceId, trackingId);
+        if (index == m_slots.size())
         {
             LOG_ERROR("Object with id = " << trackingId 
                 << " for source = " << sourceId 
                 << " is not being tracked");
             return;
         }
-        
-        // else, the object is currently being tracked.
-        pTrackedObjects->erase(trackingId);
+        eraseSlot(index);
     }    
 
     void TrackedObjects::Purge(uint64_t currentFrameNumber)
     {
         // No function log - avoid overhead.
 
-        for (const auto &trackedObjects: m_trackedObjectsPerSource)
+        // Single pass over the slots. When a slot is erased, following slots 
+        // can be shifted back into it, so the same index is checked again.
+        size_t index(0);
+        while (index < m_slots.size())
         {
-            std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-                trackedObjects.second;
-
-            auto trackedObject = pTrackedObjects->cbegin();
-            while (trackedObject != pTrackedObjects->cend())
+            const TrackedObjectSlot& slot = m_slots[index];
+            
+            if (slot.m_pObject and 
+                slot.m_pObject->frameNumber != currentFrameNumber)
             {
-                if (trackedObject->second->frameNumber != currentFrameNumber)
-                {
-                    LOG_DEBUG("Purging tracked object with id = " 
-                        << trackedObject->first << " for source = " 
-                        << trackedObjects.first);
-                        
-                    // use the return value to update the iterator, as erase invalidates it
-                    trackedObject = pTrackedObjects->erase(trackedObject);
-                }
-                else {
-                    trackedObject++;
-                }            
+                LOG_DEBUG("Purging tracked object with id = " 
+                    << slot.m_trackingId << " for source = " 
+                    << slot.m_sourceId);
+                    
+                eraseSlot(index);
+            }
+            else
+            {
+                index++;
             }
         }
     }
     
     void TrackedObjects::Clear()
     {
-        m_trackedObjectsPerSource.clear();
+        for (auto& slot: m_slots)
+        {
+            if (slot.m_pObject and slot.m_pObject.use_count() == 1)
+            {
+                m_freeObjects.push_back(std::move(slot.m_pObject));
+            }
+            slot.m_pObject = nullptr;
+        }
+        m_size = 0;
     }
     
     double TrackedObjects::GetCreationTime(NvDsFrameMeta* pFrameMeta, 
@@ -449,33 +472,119 @@ namespace DSL
     {
         // No function log - avoid overhead.
         
-        if (!IsTracked(pFrameMeta->source_id, pObjectMeta->object_id))
+        size_t index = findSlot(pFrameMeta->source_id, pObjectMeta->object_id);
+        if (index == m_slots.size())
         {
             LOG_ERROR("Object with id = " << pObjectMeta->object_id 
                 << " for source = " << pFrameMeta->source_id 
                 << " is NOT being tracked");
             return 0;
         }
-        std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-            m_trackedObjectsPerSource[pFrameMeta->source_id];
-            
-        return pTrackedObjects->at(pObjectMeta->object_id)->GetDurationMs();
+        return m_slots[index].m_pObject->GetDurationMs();
     }
 
     void TrackedObjects::SetMaxHistory(uint maxHistory)
     {
         LOG_FUNC();
         
-        for (const auto &trackedObjects: m_trackedObjectsPerSource)
+        m_maxHistory = maxHistory;
+        
+        // Objects in the free-list are updated when reused.
+        for (const auto& slot: m_slots)
         {
-            std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-                trackedObjects.second;
+            if (slot.m_pObject)
+            {
+                slot.m_pObject->SetMaxHistory(maxHistory);
+            }
+        }
+    }
+    
+    size_t TrackedObjects::homeSlot(uint sourceId, uint64_t trackingId)
+    {
+        // 64-bit finalizer mix of the combined key - tracking ids are often 
+        // sequential so the low bits alone would cluster.
+        uint64_t key = trackingId + 0x9E3779B97F4A7C15ULL*((uint64_t)sourceId + 1);
+        key ^= key >> 30;
+        key *= 0xBF58476D1CE4E5B9ULL;
+        key ^= key >> 27;
+        key *= 0x94D049BB133111EBULL;
+        key ^= key >> 31;
+        
+        return key & (m_slots.size() - 1);
+    }
+    
+    size_t TrackedObjects::findSlot(uint sourceId, uint64_t trackingId)
+    {
+        size_t mask = m_slots.size() - 1;
+        size_t index = homeSlot(sourceId, trackingId);
+        
+        // The load factor guarantees at least one empty slot to end the probe.
+        while (m_slots[index].m_pObject)
+        {
+            if (m_slots[index].m_trackingId == trackingId and
+                m_slots[index].m_sourceId == sourceId)
+            {
+                return index;
+            }
+            index = (index + 1) & mask;
+        }
+        return m_slots.size();
+    }
+    
+    void TrackedObjects::eraseSlot(size_t index)
+    {
+        std::shared_ptr<TrackedObject> pTrackedObject = 
+            std::move(m_slots[index].m_pObject);
+        m_slots[index].m_pObject = nullptr;
+        m_size--;
+        
+        // only reuse the object if a trigger isn't still holding on to it.
+        if (pTrackedObject.use_count() == 1)
+        {
+            m_freeObjects.push_back(std::move(pTrackedObject));
+        }
+        
+        // Backward-shift deletion - move following slots of the same probe
+        // sequence into the hole so that no tombstones are required.
+        size_t mask = m_slots.size() - 1;
+        size_t hole = index;
+        size_t next = (hole + 1) & mask;
+        
+        while (m_slots[next].m_pObject)
+        {
+            size_t home = homeSlot(m_slots[next].m_sourceId, 
+                m_slots[next].m_trackingId);
                 
-            for (const auto &trackedObject: *pTrackedObjects)
+            // move if the hole lies on the probe path from home to next
+            if (((next - home) & mask) >= ((next - hole) & mask))
             {
-                trackedObject.second->SetMaxHistory(maxHistory);
+                m_slots[hole] = std::move(m_slots[next]);
+                m_slots[next].m_pObject = nullptr;
+                hole = next;
             }
+            next = (next + 1) & mask;
         }
     }
     
-}    
\ No newline at end of file
+    void TrackedObjects::grow()
+    {
+        LOG_FUNC();
+        
+        std::vector<TrackedObjectSlot> oldSlots(m_slots.size()*2);
+        m_slots.swap(oldSlots);
+        
+        size_t mask = m_slots.size() - 1;
+        for (auto& slot: oldSlots)
+        {
+            if (slot.m_pObject)
+            {
+                size_t index = homeSlot(slot.m_sourceId, slot.m_trackingId);
+                while (m_slots[index].m_pObject)
+                {
+                    index = (index + 1) & mask;
+                }
+                m_slots[index] = std::move(slot);
+            }
+        }
+    }
+}
@@ -32,6 +32,98 @@ THE SOFTWARE.
 
 namespace DSL
 {
+    /**
+     * @class BboxTrace
+     * @file DslOdeTrackedObject.h
+     * @brief Implements a fixed capacity ring-buffer of bbox coordinates. 
+     * Storage is allocated once when the capacity is set, pushing on to a 
+     * full trace overwrites the oldest coordinates.
+     */
+    class BboxTrace
+    {
+    public:
+    
+        /**
+         * @brief Ctor for the BboxTrace class
+         * @param[in] capacity maximum number of bbox coordinates to hold.
+         */
+        BboxTrace(uint capacity);
+        
+        /**
+         * @brief Sets the capacity for this BboxTrace, keeping the most 
+         * recent coordinates that fit within the new capacity.
+         * @param[in] capacity new maximum number of bbox coordinates to hold.
+         */
+        void SetCapacity(uint capacity);
+        
+        /**
+         * @brief Gets the current number of bbox coordinates in the trace.
+         * @return current size of the trace.
+         */
+        size_t Size()const{return m_size;};
+        
+        /**
+         * @brief Query to determine if the trace is empty.
+         * @return true if empty, false otherwise.
+         */
+        bool IsEmpty()const{return m_size == 0;};
+        
+        /**
+         * @brief Clears the trace, the storage is retained.
+         */
+        void Clear(){m_head = 0; m_size = 0;};
+        
+        /**
+         * @brief Pushes a copy of bbox coordinates on to the back of the trace.
+         * @param[in] coordinates bbox coordinates to push.
+         */
+        void PushBack(const NvBbox_Coords& coordinates);
+        
+        /**
+         * @brief Pops the oldest bbox coordinates from the front of the trace.
+         */
+        void PopFront();
+        
+        /**
+         * @brief Gets the bbox coordinates at a given position in the trace.
+         * @param[in] index position to get, 0 is the oldest.
+         * @return const reference to the bbox coordinates.
+         */
+        const NvBbox_Coords& At(size_t index)const
+        {
+            return m_coordinates[(m_head + index) % m_coordinates.size()];
+        };
+        
+        /**
+         * @brief Gets the oldest bbox coordinates in the trace.
+         */
+        const NvBbox_Coords& Front()const{return At(0);};
+        
+        /**
+         * @brief Gets the most recent bbox coordinates in the trace.
+         */
+        const NvBbox_Coords& Back()const{return At(m_size-1);};
+        
+    private:
+    
+        /**
+         * @brief fixed size storage for the ring-buffer.
+         */
+        std::vector<NvBbox_Coords> m_coordinates;
+        
+        /**
+         * @brief storage index of the oldest bbox coordinates.
+         */
+        size_t m_head;
+        
+        /**
+         * @brief current number of bbox coordinates in the trace.
+         */
+        size_t m_size;
+    };
+    
+    //*******************************************************************************
+
     /**
      * @class TrackedObject
      * @file DslOdeTrackedObject.h
@@ -55,6 +147,21 @@ namespace DSL
             const NvBbox_Coords* pCoordinates, DSL_RGBA_COLOR_PTR pColor, 
             uint maxHistory);
             
+        /**
+         * @brief Resets a previously used TrackedObject for reuse with a new 
+         * object. The trace storage is reused if the max history is unchanged.
+         * @param[in] unique trackingId for the tracked object
+         * @param[in] frameNumber the object was first detected
+         * @param[in] pCoordinates bounding box coordinates from the object's meta 
+         * when first detected
+         * @param[in] pColor shared pointer to an RGBA Color Type to
+         * set a unique color for the tracked object. 
+         * @param[in] maxHistory maximum number of bbox coordinates to track
+         */
+        void Reset(uint64_t trackingId, uint64_t frameNumber,
+            const NvBbox_Coords* pCoordinates, DSL_RGBA_COLOR_PTR pColor, 
+            uint maxHistory);
+            
         /**
          * @brief Sets the max history for this tracked object
          * @param maxHistory new max history setting.
@@ -64,7 +171,7 @@ namespace DSL
         /**
          * @brief function to update the tracked-object's last frame number and 
          * push a new set of positional bbox coordinates on to the tracked 
-         * object's m_bboxTrace queue.
+         * object's m_bboxTrace ring-buffer.
          * @param[in] currentFrameNumber new frame number to save
          * @param[in] pCoordinates new bounding box coordinates to push.
          */
@@ -80,7 +187,7 @@ namespace DSL
          * @brief Gets the current size of the bounding box trace.
          * @return current size of the bbox trace.
          */
-        size_t BboxTraceSize(){return m_pBboxTrace->size();};
+        size_t BboxTraceSize(){return m_bboxTrace.Size();};
         
         /**
          * @brief Gets the coordinates for a specific test-point for the 
@@ -113,7 +220,7 @@ namespace DSL
          * @brief used to query if the tracked object has a previous Trace
          * from a previous line cross event.
          */
-        bool HasPreviousTrace(){return m_pPrevBboxTrace != nullptr;};
+        bool HasPreviousTrace(){return !m_prevBboxTrace.IsEmpty();};
 
         /**
          * @brief Returns a vector of coordinates defining the TrackedObject's
@@ -128,8 +235,8 @@ namespace DSL
             
         /**
          * @brief Handles an ODE Occurrence for this tracked object. The current
-         * m_pBboxTrace is moved to the m_pPreviousBboxTrace and a new/empty
-         * m_pBboxTrace is created.
+         * m_bboxTrace is swapped with the m_prevBboxTrace and the new current
+         * trace is cleared.
          */
         void HandleOccurrence();
 
@@ -164,13 +271,24 @@ namespace DSL
         /**
          * @brief Get an x,y coordinate from a Bbox based on this Trigger's
          * client specified test-point
-         * @param[in] pBbox to optain the coordinate from
+         * @param[in] bbox to optain the coordinate from
          * @param[in] testPoint one of the DSL_BBOX_POINT_* constants
          * @param[out] traceCoordinate x,y coordinate value.
          */
-        void getCoordinate(std::shared_ptr<NvBbox_Coords> pBbox, 
+        void getCoordinate(const NvBbox_Coords& bbox, 
             uint testPoint, dsl_coordinate& traceCoordinate);
         
+        /**
+         * @brief Returns a multi-line for a specfic test-point for a given trace.
+         * @param[in] trace bbox trace to generate the multi-line from.
+         * @param[in] testPoint test-point to generate the trace with.
+         * @param[in] method one of the DSL_OBJECT_TRACE_TEST_METHOD_* constants
+         * @param[in] lineWidth the width value to assign to the line.
+         * @return shared pointer to a new multi-line.
+         */
+        DSL_RGBA_MULTI_LINE_PTR getTrace(const BboxTrace& trace,
+            uint testPoint, uint method, uint lineWidth);
+        
         /**
          * @brief time of creation for this Tracked Object, used to test 
          * for object persistence.
@@ -183,14 +301,15 @@ namespace DSL
         uint m_maxHistory;
         
         /**
-         * @brief a max sized queue of Rectangle Params.
+         * @brief a max sized ring-buffer of bbox coordinates.
          */
-        std::shared_ptr<std::deque<std::shared_ptr<NvBbox_Coords>>> m_pBboxTrace;
+        BboxTrace m_bboxTrace;
         
         /**
-         * @brief a max sized queue of Rectangle Params.
+         * @brief a max sized ring-buffer of bbox coordinates from the previous
+         * occurrence. Empty if there is no previous trace.
          */
-        std::shared_ptr<std::deque<std::shared_ptr<NvBbox_Coords>>> m_pPrevBboxTrace;
+        BboxTrace m_prevBboxTrace;
         
         /**
          * @brief used to identify the tracked object with an RGBA color.
@@ -204,7 +323,10 @@ namespace DSL
     /**
      * @class TrackedObjects
      * @file DslOdeTrackedObject.h
-     * @brief Manages a map of tracked objects.
+     * @brief Manages an open-addressing hash table of tracked objects keyed on 
+     * source Id and tracking Id. Tracked objects that are purged or deleted are
+     * kept in a free-list and reused, so that once the table has grown to the 
+     * number of concurrently tracked objects no allocation occurs per frame. 
      */
     class TrackedObjects
     {
@@ -266,7 +388,7 @@ namespace DSL
          * @brief Query to determine if the container is empty
          * @return true if empty of tracked objects, false otherwise
          */
-        bool IsEmpty(){return m_trackedObjectsPerSource.empty();};
+        bool IsEmpty(){return m_size == 0;};
         
         /**
          * @brief gets the time of tracked object creation
@@ -286,20 +408,60 @@ namespace DSL
         
     private:
     
+        /**
+         * @brief A slot in the open-addressing hash table. A slot with a 
+         * null m_pObject is empty.
+         */
+        struct TrackedObjectSlot
+        {
+            uint m_sourceId;
+            uint64_t m_trackingId;
+            std::shared_ptr<TrackedObject> m_pObject;
+        };
+        
+        /**
+         * @brief Returns the home slot index for a source and tracking Id.
+         */
+        size_t homeSlot(uint sourceId, uint64_t trackingId);
+        
+        /**
+         * @brief Finds the slot index for a source and tracking Id.
+         * @return slot index if found, m_slots.size() otherwise.
+         */
+        size_t findSlot(uint sourceId, uint64_t trackingId);
+        
+        /**
+         * @brief Empties a slot, shifting back any following slots in the 
+         * same probe sequence. The removed object is added to the free-list
+         * if no other owner holds a reference to it.
+         * @param[in] index index of the slot to empty.
+         */
+        void eraseSlot(size_t index);
+        
+        /**
+         * @brief Doubles the number of slots and rehashes all tracked objects.
+         */
+        void grow();
+    
         /**
          * @brief maximum number of bbox coordinates to maintain/trace
          */
         uint m_maxHistory;
         
         /**
-         * @brief map of tracked objects - Key = unique Tracking Id
+         * @brief hash table of slots, the size is always a power of two.
          */
-        typedef std::map <uint64_t, std::shared_ptr<TrackedObject>> TrackedObjectsT;
-
+        std::vector<TrackedObjectSlot> m_slots;
+        
+        /**
+         * @brief current number of tracked objects in m_slots.
+         */
+        size_t m_size;
+        
         /**
-         * @brief map of tracked objects per source - Key = source Id
+         * @brief free-list of purged/deleted tracked objects for reuse.
          */
-        std::map <uint, std::shared_ptr<TrackedObjectsT>> m_trackedObjectsPerSource;
+        std::vector<std::shared_ptr<TrackedObject>> m_freeObjects;
     };    
 }
 
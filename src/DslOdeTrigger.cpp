@@ -28,42 +28,38 @@ THE SOFTWARE.
 #include "DslOdeArea.h"
 #include "DslOdeHeatMapper.h"
 #include "DslServices.h"
+#include "DslTimerWheel.h"
 
 namespace DSL
 {
 
     // Initialize static Event Counter
-    uint64_t OdeTrigger::s_eventCount = 0;
+    std::atomic<uint64_t> OdeTrigger::s_eventCount(0);
+
+    // Initialize static Dispatch Generation
+    std::atomic<uint64_t> OdeTrigger::s_dispatchGeneration(0);
 
     OdeTrigger::OdeTrigger(const char* name, const char* source, 
         uint classId, uint limit)
         : OdeBase(name)
         , m_wName(m_name.begin(), m_name.end())
+        , m_pConfig(new OdeTriggerConfig(source, classId))
+        , m_configGeneration(0)
+        , m_frameConfigGeneration(0)
+        , m_failedLookupGeneration(UINT64_MAX)
         , m_source(source)
-        , m_sourceId(-1)
-        , m_inferId(-1)
-        , m_classId(classId)
         , m_triggered(0)
         , m_eventLimit(limit)
         , m_frameCount(0)
         , m_frameLimit(0)
         , m_occurrences(0)
         , m_occurrencesAccumulated(0)
-        , m_minConfidence(0)
-        , m_maxConfidence(0)
-        , m_minTrackerConfidence(0)
-        , m_maxTrackerConfidence(0)
-        , m_minWidth(0)
-        , m_minHeight(0)
-        , m_maxWidth(0)
-        , m_maxHeight(0)
-        , m_minFrameCountN(1)
-        , m_minFrameCountD(1)
-        , m_inferDoneOnly(false)
         , m_resetTimeout(0)
         , m_resetTimerId(0)
-        , m_interval(0)
+        , m_lastResetTimerId(0)
+        , m_countedInterval(0)
         , m_intervalCounter(0)
+        , m_sourceIntervalCounters(DSL_ODE_SOURCE_SET_SIZE, 0)
         , m_skipFrame(false)
         , m_nextAreaIndex(0)
         , m_nextActionIndex(0)
@@ -71,6 +67,7 @@ namespace DSL
         LOG_FUNC();
 
         g_mutex_init(&m_resetTimerMutex);
+        g_mutex_init(&m_configMutex);
     }
 
     OdeTrigger::~OdeTrigger()
@@ -79,23 +76,32 @@ namespace DSL
         
         RemoveAllActions();
         RemoveAllAreas();
-        if (m_pAccumulator)
+        if (GetConfig()->m_pAccumulator)
         {
             RemoveAccumulator();
         }
         
-        if (m_resetTimerId)
+        uint lastResetTimerId(0);
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_resetTimerMutex);
-            g_source_remove(m_resetTimerId);
+            lastResetTimerId = m_lastResetTimerId;
+        }
+        if (lastResetTimerId)
+        {
+            // Cancel a pending reset, or wait for a running reset to return
+            // - without the mutex held. The last id scheduled is used as the
+            // running callback has already cleared m_resetTimerId.
+            TimerWheel::GetTimerWheel().CancelAndWait(lastResetTimerId);
         }
         g_mutex_clear(&m_resetTimerMutex);
+        g_mutex_clear(&m_configMutex);
     }
 
     bool OdeTrigger::AddAction(DSL_BASE_PTR pChild)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
         if (m_pOdeActions.find(pChild->GetName()) != m_pOdeActions.end())
         {
@@ -110,7 +116,13 @@ namespace DSL
 
         // Add the shared pointer to child to both Maps, by name and index
         m_pOdeActions[pChild->GetName()] = pChild;
-        m_pOdeActionsIndexed[m_nextActionIndex] = pChild;
+        
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_pOdeActionsIndexed[m_nextActionIndex] = pChild;
+        PublishConfig(pConfig);
+        
+        // the Actions determine if the Trigger is source-partitionable
+        s_dispatchGeneration++;
         
         return true;
     }
@@ -119,6 +131,7 @@ namespace DSL
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
         if (m_pOdeActions.find(pChild->GetName()) == m_pOdeActions.end())
         {
@@ -129,7 +142,13 @@ namespace DSL
         
         // Erase the child from both maps
         m_pOdeActions.erase(pChild->GetName());
-        m_pOdeActionsIndexed.erase(pChild->GetIndex());
+        
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_pOdeActionsIndexed.erase(pChild->GetIndex());
+        PublishConfig(pConfig);
+        
+        // the Actions determine if the Trigger is source-partitionable
+        s_dispatchGeneration++;
         
         // Clear the parent relationship and index
         pChild->ClearParentName();
@@ -141,6 +160,7 @@ namespace DSL
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
         for (auto &imap: m_pOdeActions)
         {
@@ -149,13 +169,20 @@ namespace DSL
             imap.second->ClearParentName();
         }
         m_pOdeActions.clear();
-        m_pOdeActionsIndexed.clear();
+        
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_pOdeActionsIndexed.clear();
+        PublishConfig(pConfig);
+        
+        // the Actions determine if the Trigger is source-partitionable
+        s_dispatchGeneration++;
     }
     
     bool OdeTrigger::AddArea(DSL_BASE_PTR pChild)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
         if (m_pOdeAreas.find(pChild->GetName()) != m_pOdeAreas.end())
         {
@@ -169,7 +196,10 @@ namespace DSL
         
         // Add the shared pointer to child to both Maps, by name and index
         m_pOdeAreas[pChild->GetName()] = pChild;
-        m_pOdeAreasIndexed[m_nextAreaIndex] = pChild;
+        
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_pOdeAreasIndexed[m_nextAreaIndex] = pChild;
+        PublishConfig(pConfig);
         
         return true;
     }
@@ -178,6 +208,7 @@ namespace DSL
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
         if (m_pOdeAreas.find(pChild->GetName()) == m_pOdeAreas.end())
         {
@@ -188,7 +219,10 @@ namespace DSL
         
         // Erase the child from both maps
         m_pOdeAreas.erase(pChild->GetName());
-        m_pOdeAreasIndexed.erase(pChild->GetIndex());
+        
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_pOdeAreasIndexed.erase(pChild->GetIndex());
+        PublishConfig(pConfig);
 
         // Clear the parent relationship and index
         pChild->ClearParentName();
@@ -201,6 +235,7 @@ namespace DSL
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
         for (auto &imap: m_pOdeAreas)
         {
@@ -209,66 +244,81 @@ namespace DSL
             imap.second->ClearParentName();
         }
         m_pOdeAreas.clear();
-        m_pOdeAreasIndexed.clear();
+        
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_pOdeAreasIndexed.clear();
+        PublishConfig(pConfig);
     }
 
     bool OdeTrigger::AddAccumulator(DSL_BASE_PTR pAccumulator)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
 
-        if (m_pAccumulator)
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        if (pConfig->m_pAccumulator)
         {
             LOG_ERROR("ODE Trigger '" << GetName() 
                 << "' all ready has an Accumulator");
             return false;
         }
-        m_pAccumulator = pAccumulator;
+        pConfig->m_pAccumulator = pAccumulator;
+        PublishConfig(pConfig);
+        s_dispatchGeneration++;
         return true;
     }
     
     bool OdeTrigger::RemoveAccumulator()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
 
-        if (!m_pAccumulator)
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        if (!pConfig->m_pAccumulator)
         {
             LOG_ERROR("ODE Trigger '" << GetName() 
                 << "' does not have an Accumulator");
             return false;
         }
-        m_pAccumulator = NULL;
+        pConfig->m_pAccumulator = NULL;
+        PublishConfig(pConfig);
+        s_dispatchGeneration++;
         return true;
     }
         
     bool OdeTrigger::AddHeatMapper(DSL_BASE_PTR pHeatMapper)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
 
-        if (m_pHeatMapper)
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        if (pConfig->m_pHeatMapper)
         {
             LOG_ERROR("ODE Trigger '" << GetName() 
                 << "' all ready has a Heat-Mapper");
             return false;
         }
-        m_pHeatMapper = pHeatMapper;
+        pConfig->m_pHeatMapper = pHeatMapper;
+        PublishConfig(pConfig);
+        s_dispatchGeneration++;
         return true;
     }
     
     bool OdeTrigger::RemoveHeatMapper()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
 
-        if (!m_pHeatMapper)
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        if (!pConfig->m_pHeatMapper)
         {
             LOG_ERROR("ODE Trigger '" << GetName() 
                 << "' does not have a Heat-Mapper");
             return false;
         }
-        m_pHeatMapper = NULL;
+        pConfig->m_pHeatMapper = NULL;
+        PublishConfig(pConfig);
+        s_dispatchGeneration++;
         return true;
     }
         
@@ -282,8 +332,10 @@ namespace DSL
         
         m_frameCount = 0;
         
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        
         // iterate through the map of limit-event-listeners calling each
-        for(auto const& imap: m_limitStateChangeListeners)
+        for(auto const& imap: pConfig->m_limitStateChangeListeners)
         {
             try
             {
@@ -300,14 +352,14 @@ namespace DSL
     void OdeTrigger::IncrementAndCheckTriggerCount()
     {
         LOG_FUNC();
-        // internal do not lock m_propertyMutex
+        // internal - called from the streaming thread without m_propertyMutex
         
         m_triggered++;
         
         if (m_triggered >= m_eventLimit)
         {
             // iterate through the map of limit-event-listeners calling each
-            for(auto const& imap: m_limitStateChangeListeners)
+            for(auto const& imap: FrameConfig().m_limitStateChangeListeners)
             {
                 try
                 {
@@ -321,30 +373,57 @@ namespace DSL
             }
             if (m_resetTimeout)
             {
-                m_resetTimerId = g_timeout_add(1000*m_resetTimeout, 
-                    TriggerResetTimeoutHandler, this);            
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_resetTimerMutex);
+                startResetTimer(m_resetTimeout);
             }
         }
     }
 
-    static int TriggerResetTimeoutHandler(gpointer pTrigger)
+    static uint TriggerResetTimeoutHandler(void* pTrigger)
     {
-        return static_cast<OdeTrigger*>(pTrigger)->
-            HandleResetTimeout();
+        static_cast<OdeTrigger*>(pTrigger)->HandleResetTimeout();
+        
+        return 0;
     }
 
     int OdeTrigger::HandleResetTimeout()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_resetTimerMutex);
         
-        m_resetTimerId = 0;
+        uint timerId = TimerWheel::GetTimerWheel().GetRunningTimerId();
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_resetTimerMutex);
+            
+            // The timer may have been cancelled or replaced by SetResetTimeout
+            // while this callback was waiting on the mutex. Only the pending 
+            // timer can clear its id and reset the Trigger.
+            if (timerId != m_resetTimerId)
+            {
+                return false;
+            }
+            m_resetTimerId = 0;
+        }
+        // Reset without the timer mutex held - Reset acquires m_propertyMutex
         Reset();
         
         // One shot - return false.
         return false;
     }
     
+    void OdeTrigger::startResetTimer(uint timeout)
+    {
+        LOG_FUNC();
+        // internal - the m_resetTimerMutex must be held by the caller
+        
+        if (!timeout or m_resetTimerId)
+        {
+            return;
+        }
+        m_resetTimerId = TimerWheel::GetTimerWheel().Schedule(
+            1000*timeout, TriggerResetTimeoutHandler, this);
+        m_lastResetTimerId = m_resetTimerId;
+    }
+    
     uint OdeTrigger::GetResetTimeout()
     {
         LOG_FUNC();
@@ -361,7 +440,7 @@ namespace DSL
         // timeout value is zero (disabled), then kill the timer.
         if (m_resetTimerId and !timeout)
         {
-            g_source_remove(m_resetTimerId);
+            TimerWheel::GetTimerWheel().Cancel(m_resetTimerId);
             m_resetTimerId = 0;
         }
         
@@ -369,24 +448,22 @@ namespace DSL
         // timeout value is non-zero, stop and restart the timer.
         else if (m_resetTimerId and timeout)
         {
-            g_source_remove(m_resetTimerId);
-            m_resetTimerId = g_timeout_add(1000*m_resetTimeout, 
-                TriggerResetTimeoutHandler, this);            
+            TimerWheel::GetTimerWheel().Cancel(m_resetTimerId);
+            m_resetTimerId = 0;
+            startResetTimer(timeout);
         }
         
         // Else, if the Trigger has reached its limit and the 
         // client is setting a Timeout value, start the timer.
         else if (m_eventLimit and (m_triggered >= m_eventLimit) and timeout)
         {
-            m_resetTimerId = g_timeout_add(1000*m_resetTimeout, 
-                TriggerResetTimeoutHandler, this);            
+            startResetTimer(timeout);
         } 
         // Else, if the Trigger has reached its frame limit and the 
         // client is setting a Timeout value, start the timer.
         else if (m_frameLimit and (m_frameCount >= m_frameLimit) and timeout)
         {
-            m_resetTimerId = g_timeout_add(1000*m_resetTimeout, 
-                TriggerResetTimeoutHandler, this);            
+            startResetTimer(timeout);
         } 
         
         m_resetTimeout = timeout;
@@ -395,6 +472,7 @@ namespace DSL
     bool OdeTrigger::IsResetTimerRunning()
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_resetTimerMutex);
 
         return m_resetTimerId;
     }
@@ -403,15 +481,17 @@ namespace DSL
         dsl_ode_trigger_limit_state_change_listener_cb listener, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
 
-        if (m_limitStateChangeListeners.find(listener) != 
-            m_limitStateChangeListeners.end())
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        if (pConfig->m_limitStateChangeListeners.find(listener) != 
+            pConfig->m_limitStateChangeListeners.end())
         {   
             LOG_ERROR("Limit state change listener is not unique");
             return false;
         }
-        m_limitStateChangeListeners[listener] = clientData;
+        pConfig->m_limitStateChangeListeners[listener] = clientData;
+        PublishConfig(pConfig);
 
         return true;
     }
@@ -420,15 +500,17 @@ namespace DSL
         dsl_ode_trigger_limit_state_change_listener_cb listener)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
 
-        if (m_limitStateChangeListeners.find(listener) == 
-            m_limitStateChangeListeners.end())
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        if (pConfig->m_limitStateChangeListeners.find(listener) == 
+            pConfig->m_limitStateChangeListeners.end())
         {   
             LOG_ERROR("Limit state change listener was not found");
             return false;
         }
-        m_limitStateChangeListeners.erase(listener);
+        pConfig->m_limitStateChangeListeners.erase(listener);
+        PublishConfig(pConfig);
 
         return true;
     }        
@@ -437,21 +519,65 @@ namespace DSL
     {
         LOG_FUNC();
         
-        return m_classId;
+        return GetConfig()->m_classId;
     }
     
     void OdeTrigger::SetClassId(uint classId)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
+        
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_classId = classId;
+        PublishConfig(pConfig);
+        s_dispatchGeneration++;
+    }
+    
+    std::vector<uint> OdeTrigger::GetClassIds()
+    {
+        LOG_FUNC();
         
-        m_classId = classId;
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        
+        std::vector<uint> classIds;
+        for (uint i = 0; i < DSL_ODE_CLASS_SET_SIZE; i++)
+        {
+            if (pConfig->m_classSet.test(i))
+            {
+                classIds.push_back(i);
+            }
+        }
+        return classIds;
+    }
+    
+    bool OdeTrigger::SetClassIds(const uint* classIds, uint size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
+        
+        std::bitset<DSL_ODE_CLASS_SET_SIZE> classSet;
+        for (uint i = 0; i < size; i++)
+        {
+            if (classIds[i] >= DSL_ODE_CLASS_SET_SIZE)
+            {
+                LOG_ERROR("Class Id " << classIds[i] 
+                    << " is out of range for the class-set of Trigger '" 
+                    << GetName() << "'");
+                return false;
+            }
+            classSet.set(classIds[i]);
+        }
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_classSet = classSet;
+        PublishConfig(pConfig);
+        s_dispatchGeneration++;
+        
+        return true;
     }
 
     uint OdeTrigger::GetEventLimit()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         return m_eventLimit;
     }
@@ -463,8 +589,10 @@ namespace DSL
         
         m_eventLimit = limit;
         
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        
         // iterate through the map of limit-event-listeners calling each
-        for(auto const& imap: m_limitStateChangeListeners)
+        for(auto const& imap: pConfig->m_limitStateChangeListeners)
         {
             try
             {
@@ -481,7 +609,6 @@ namespace DSL
     uint OdeTrigger::GetFrameLimit()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         return m_frameLimit;
     }
@@ -493,8 +620,10 @@ namespace DSL
         
         m_frameLimit = limit;
         
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        
         // iterate through the map of limit-event-listeners calling each
-        for(auto const& imap: m_limitStateChangeListeners)
+        for(auto const& imap: pConfig->m_limitStateChangeListeners)
         {
             try
             {
@@ -511,6 +640,7 @@ namespace DSL
     const char* OdeTrigger::GetSource()
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
         if (m_source.size())
         {
@@ -522,21 +652,95 @@ namespace DSL
     void OdeTrigger::SetSource(const char* source)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
         m_source.assign(source);
+        
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_source.assign(source);
+        pConfig->m_sourceId = -1;
+        PublishConfig(pConfig);
+        s_dispatchGeneration++;
     }
 
     void OdeTrigger::_setSourceId(int id)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
+        
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_sourceId = id;
+        PublishConfig(pConfig);
+        s_dispatchGeneration++;
+    }
+    
+    bool OdeTrigger::AddSourceToSet(const char* source)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
+        
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        
+        if (std::find(pConfig->m_sourceSet.begin(), pConfig->m_sourceSet.end(), 
+            source) != pConfig->m_sourceSet.end())
+        {
+            LOG_ERROR("Source '" << source 
+                << "' is already in the source-set of Trigger '" << GetName() << "'");
+            return false;
+        }
+        pConfig->m_sourceSet.push_back(source);
+        
+        // resolved, along with all other names, on next use.
+        pConfig->m_sourceSetResolved = false;
+        PublishConfig(pConfig);
+        s_dispatchGeneration++;
+        
+        return true;
+    }
+    
+    bool OdeTrigger::RemoveSourceFromSet(const char* source)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
+        
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        
+        auto ivec = std::find(pConfig->m_sourceSet.begin(), 
+            pConfig->m_sourceSet.end(), source);
+        if (ivec == pConfig->m_sourceSet.end())
+        {
+            LOG_ERROR("Source '" << source 
+                << "' is not in the source-set of Trigger '" << GetName() << "'");
+            return false;
+        }
+        pConfig->m_sourceSet.erase(ivec);
+        
+        // recompile the remaining names on next use.
+        pConfig->m_sourceSetIds.reset();
+        pConfig->m_sourceSetResolved = pConfig->m_sourceSet.empty();
+        PublishConfig(pConfig);
+        s_dispatchGeneration++;
+        
+        return true;
+    }
+    
+    void OdeTrigger::RemoveAllSourcesFromSet()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_sourceId = id;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_sourceSet.clear();
+        pConfig->m_sourceSetIds.reset();
+        pConfig->m_sourceSetResolved = true;
+        PublishConfig(pConfig);
+        s_dispatchGeneration++;
     }
     
     const char* OdeTrigger::GetInfer()
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
         if (m_infer.size())
         {
@@ -548,205 +752,425 @@ namespace DSL
     void OdeTrigger::SetInfer(const char* infer)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
         m_infer.assign(infer);
+        
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_infer.assign(infer);
+        pConfig->m_inferId = -1;
+        PublishConfig(pConfig);
+        s_dispatchGeneration++;
     }
 
     void OdeTrigger::_setInferId(int id)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_inferId = id;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_inferId = id;
+        PublishConfig(pConfig);
+        s_dispatchGeneration++;
     }
     
     float OdeTrigger::GetMinConfidence()
     {
         LOG_FUNC();
         
-        return m_minConfidence;
+        return GetConfig()->m_minConfidence;
     }
     
     void OdeTrigger::SetMinConfidence(float minConfidence)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_minConfidence = minConfidence;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_minConfidence = minConfidence;
+        PublishConfig(pConfig);
     }
     
     float OdeTrigger::GetMaxConfidence()
     {
         LOG_FUNC();
         
-        return m_maxConfidence;
+        return GetConfig()->m_maxConfidence;
     }
     
     void OdeTrigger::SetMaxConfidence(float maxConfidence)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_maxConfidence = maxConfidence;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_maxConfidence = maxConfidence;
+        PublishConfig(pConfig);
     }
     
     float OdeTrigger::GetMinTrackerConfidence()
     {
         LOG_FUNC();
         
-        return m_minTrackerConfidence;
+        return GetConfig()->m_minTrackerConfidence;
     }
     
     void OdeTrigger::SetMinTrackerConfidence(float minConfidence)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_minTrackerConfidence = minConfidence;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_minTrackerConfidence = minConfidence;
+        PublishConfig(pConfig);
     }
     
     float OdeTrigger::GetMaxTrackerConfidence()
     {
         LOG_FUNC();
         
-        return m_maxTrackerConfidence;
+        return GetConfig()->m_maxTrackerConfidence;
     }
     
     void OdeTrigger::SetMaxTrackerConfidence(float maxConfidence)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_maxTrackerConfidence = maxConfidence;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_maxTrackerConfidence = maxConfidence;
+        PublishConfig(pConfig);
     }
     
     void OdeTrigger::GetMinDimensions(float* minWidth, float* minHeight)
     {
         LOG_FUNC();
         
-        *minWidth = m_minWidth;
-        *minHeight = m_minHeight;
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        *minWidth = pConfig->m_minWidth;
+        *minHeight = pConfig->m_minHeight;
     }
 
     void OdeTrigger::SetMinDimensions(float minWidth, float minHeight)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_minWidth = minWidth;
-        m_minHeight = minHeight;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_minWidth = minWidth;
+        pConfig->m_minHeight = minHeight;
+        PublishConfig(pConfig);
     }
     
     void OdeTrigger::GetMaxDimensions(float* maxWidth, float* maxHeight)
     {
         LOG_FUNC();
         
-        *maxWidth = m_maxWidth;
-        *maxHeight = m_maxHeight;
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        *maxWidth = pConfig->m_maxWidth;
+        *maxHeight = pConfig->m_maxHeight;
     }
 
     void OdeTrigger::SetMaxDimensions(float maxWidth, float maxHeight)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_maxWidth = maxWidth;
-        m_maxHeight = maxHeight;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_maxWidth = maxWidth;
+        pConfig->m_maxHeight = maxHeight;
+        PublishConfig(pConfig);
     }
     
     bool OdeTrigger::GetInferDoneOnlySetting()
     {
         LOG_FUNC();
         
-        return m_inferDoneOnly;
+        return GetConfig()->m_inferDoneOnly;
     }
     
     void OdeTrigger::SetInferDoneOnlySetting(bool inferDoneOnly)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_inferDoneOnly = inferDoneOnly;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_inferDoneOnly = inferDoneOnly;
+        PublishConfig(pConfig);
     }
     
     void OdeTrigger::GetMinFrameCount(uint* minFrameCountN, uint* minFrameCountD)
     {
         LOG_FUNC();
         
-        *minFrameCountN = m_minFrameCountN;
-        *minFrameCountD = m_minFrameCountD;
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        *minFrameCountN = pConfig->m_minFrameCountN;
+        *minFrameCountD = pConfig->m_minFrameCountD;
     }
 
     void OdeTrigger::SetMinFrameCount(uint minFrameCountN, uint minFrameCountD)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_minFrameCountN = minFrameCountN;
-        m_minFrameCountD = minFrameCountD;
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_minFrameCountN = minFrameCountN;
+        pConfig->m_minFrameCountD = minFrameCountD;
+        PublishConfig(pConfig);
     }
 
     uint OdeTrigger::GetInterval()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        return m_interval;
+        return GetConfig()->m_interval;
     }
     
     void OdeTrigger::SetInterval(uint interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_configMutex);
         
-        m_interval = interval;
-        m_intervalCounter = 0;
+        // The interval counters are reset by the streaming thread when it
+        // first sees the new interval - see CheckForIntervalSkip.
+        std::shared_ptr<OdeTriggerConfig> pConfig = CopyConfig();
+        pConfig->m_interval = interval;
+        PublishConfig(pConfig);
     }
     
-    bool OdeTrigger::CheckForSourceId(int sourceId)
+    DSL_ODE_TRIGGER_CONFIG_PTR OdeTrigger::AcquireConfig()
     {
-        LOG_FUNC();
+        // Do not log function entry
 
-        // Filter on Source id if set
-        if (m_source.size())
+        // Read the dispatch generation before the snapshot so that a name
+        // registered after the lookups below is retried on the next call.
+        uint64_t dispatchGeneration = s_dispatchGeneration;
+        
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = std::atomic_load(&m_pConfig);
+        
+        // Fast path - nothing to resolve, or nothing registered since the 
+        // last lookup failed.
+        if (pConfig->IsResolved() or 
+            m_failedLookupGeneration == dispatchGeneration)
+        {
+            return pConfig;
+        }
+        
+        // a "one-time-get" of the source and inference component Ids 
+        // from their names. 
+        int sourceId(pConfig->m_sourceId);
+        int inferId(pConfig->m_inferId);
+        std::bitset<DSL_ODE_SOURCE_SET_SIZE> sourceSetIds(pConfig->m_sourceSetIds);
+        bool sourceSetResolved(true);
+        
+        if (pConfig->m_source.size() and sourceId == -1)
         {
-            // a "one-time-get" of the source Id from the source name
-            if (m_sourceId == -1)
+            Services::GetServices()->SourceIdGet(
+                pConfig->m_source.c_str(), &sourceId);
+        }
+        if (pConfig->m_infer.size() and inferId == -1)
+        {
+            Services::GetServices()->InferIdGet(
+                pConfig->m_infer.c_str(), &inferId);
+        }
+        // compile the source-set names into the bitset, once per name.
+        for (const auto& ivec: pConfig->m_sourceSet)
+        {
+            int setSourceId(-1);
+            if (Services::GetServices()->SourceIdGet(ivec.c_str(), 
+                &setSourceId) != DSL_RESULT_SUCCESS)
             {
-                
-                Services::GetServices()->SourceIdGet(m_source.c_str(), &m_sourceId);
+                sourceSetResolved = false;
+                continue;
             }
-            if (m_sourceId != sourceId)
+            if (setSourceId >= DSL_ODE_SOURCE_SET_SIZE)
             {
-                return false;
+                LOG_ERROR("Source '" << ivec << "' id = " << setSourceId
+                    << " is out of range for the source-set of Trigger '" 
+                    << GetName() << "'");
+                continue;
             }
+            sourceSetIds.set(setSourceId);
         }
-        return true;
+        bool resolved = (pConfig->m_source.empty() or sourceId != -1) and
+            (pConfig->m_infer.empty() or inferId != -1) and sourceSetResolved;
+        if (!resolved)
+        {
+            // not resolvable yet, try again once a name has been registered.
+            m_failedLookupGeneration = dispatchGeneration;
+        }
+        if (sourceId == pConfig->m_sourceId and inferId == pConfig->m_inferId and
+            sourceSetIds == pConfig->m_sourceSetIds and 
+            sourceSetResolved == pConfig->m_sourceSetResolved)
+        {
+            return pConfig;
+        }
+        
+        std::shared_ptr<OdeTriggerConfig> pResolved = 
+            std::shared_ptr<OdeTriggerConfig>(new OdeTriggerConfig(*pConfig));
+        pResolved->m_sourceId = sourceId;
+        pResolved->m_inferId = inferId;
+        pResolved->m_sourceSetIds = sourceSetIds;
+        pResolved->m_sourceSetResolved = sourceSetResolved;
+        
+        // Only replace the snapshot the Ids were resolved from. If a client 
+        // update was published in the meantime, it wins and is resolved next.
+        DSL_ODE_TRIGGER_CONFIG_PTR pExpected(pConfig);
+        if (std::atomic_compare_exchange_strong(&m_pConfig, &pExpected, 
+            DSL_ODE_TRIGGER_CONFIG_PTR(pResolved)))
+        {
+            m_configGeneration++;
+        }
+        return pResolved;
     }
-
-    bool OdeTrigger::CheckForInferId(int inferId)
+    
+    void OdeTrigger::UpdateFrameConfig()
+    {
+        // Do not log function entry - called for every object
+        
+        // Read the generation before the snapshot. A snapshot published
+        // in between is simply loaded again on the next call.
+        uint64_t configGeneration = m_configGeneration;
+        
+        if (m_pFrameConfig and configGeneration == m_frameConfigGeneration and
+            (m_pFrameConfig->IsResolved() or 
+                m_failedLookupGeneration == s_dispatchGeneration))
+        {
+            return;
+        }
+        m_frameConfigGeneration = configGeneration;
+        m_pFrameConfig = AcquireConfig();
+    }
+    
+    bool OdeTrigger::ChildrenAreSourcePartitionable()
     {
         LOG_FUNC();
-
-        // Filter on Source id if set
-        if (m_infer.size())
+        
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = GetConfig();
+        
+        // Accumulators and Heat-Mappers may be shared with other Triggers.
+        if (pConfig->m_pAccumulator or pConfig->m_pHeatMapper)
         {
-            // a "one-time-get" of the inference component Id from the name
-            if (m_inferId == -1)
-            {
-                Services::GetServices()->InferIdGet(m_infer.c_str(), &m_inferId);
-            }
-            if (m_inferId != inferId)
+            return false;
+        }
+        for (const auto &imap: pConfig->m_pOdeActionsIndexed)
+        {
+            if (!std::dynamic_pointer_cast<OdeAction>(
+                imap.second)->IsSourcePartitionable())
             {
                 return false;
             }
         }
         return true;
     }
+    
+    std::shared_ptr<OdeTriggerConfig> OdeTrigger::CopyConfig()
+    {
+        LOG_FUNC();
+        
+        return std::shared_ptr<OdeTriggerConfig>(
+            new OdeTriggerConfig(*std::atomic_load(&m_pConfig)));
+    }
+    
+    void OdeTrigger::PublishConfig(std::shared_ptr<OdeTriggerConfig> pConfig)
+    {
+        LOG_FUNC();
+        
+        std::atomic_store(&m_pConfig, DSL_ODE_TRIGGER_CONFIG_PTR(pConfig));
+        m_configGeneration++;
+    }
+
+    bool OdeTrigger::CheckForSourceId(int sourceId)
+    {
+        // Do not log function entry
+
+        const OdeTriggerConfig& config = FrameConfig();
+
+        // Filter on Source id and source-set if set
+        return ((config.m_source.empty() or config.m_sourceId == sourceId) and
+            (config.m_sourceSet.empty() or (sourceId >= 0 and 
+                sourceId < DSL_ODE_SOURCE_SET_SIZE and 
+                config.m_sourceSetIds.test(sourceId))));
+    }
+    
+    bool OdeTrigger::CheckForIntervalSkip(uint sourceId)
+    {
+        // Do not log function entry
+
+        // Read the interval once, from the Frame snapshot, as the client
+        // can set a new interval at any time.
+        const OdeTriggerConfig& config = FrameConfig();
+        uint interval = config.m_interval;
+        
+        // Restart counting on the first Frame for a new interval.
+        if (interval != m_countedInterval)
+        {
+            m_countedInterval = interval;
+            m_intervalCounter = 0;
+            std::fill(m_sourceIntervalCounters.begin(), 
+                m_sourceIntervalCounters.end(), 0);
+        }
+        if (!interval)
+        {
+            return false;
+        }
+        // A Trigger filtering on a source-set counts each Source separately, 
+        // as if it were one Trigger per Source.
+        uint& intervalCounter = (config.m_sourceSet.size() and 
+            sourceId < DSL_ODE_SOURCE_SET_SIZE)
+            ? m_sourceIntervalCounters[sourceId]
+            : m_intervalCounter;
+            
+        intervalCounter = (intervalCounter + 1) % interval; 
+        return (intervalCounter != 0);
+    }
+
+    bool OdeTrigger::CheckForInferId(int inferId)
+    {
+        // Do not log function entry
+
+        const OdeTriggerConfig& config = FrameConfig();
+
+        // Filter on inference component id if set
+        return (config.m_infer.empty() or config.m_inferId == inferId);
+    }
+
+    bool OdeTrigger::GetDispatchFilter(int* sourceId, int* classId, int* inferId)
+    {
+        LOG_FUNC();
+        
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = AcquireConfig();
+        
+        *sourceId = (pConfig->m_source.size()) ? pConfig->m_sourceId : -1;
+        *inferId = (pConfig->m_infer.size()) ? pConfig->m_inferId : -1;
+        *classId = (pConfig->m_classId == DSL_ODE_ANY_CLASS) 
+            ? -1 : pConfig->m_classId;
+        
+        // Set filters are checked by CheckForFilterSets
+        return pConfig->IsResolved();
+    }
+
+    bool OdeTrigger::CheckForFilterSets(uint sourceId, uint classId)
+    {
+        // Do not log function entry
+        
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = AcquireConfig();
+        
+        return ((pConfig->m_sourceSet.empty() or 
+                (sourceId < DSL_ODE_SOURCE_SET_SIZE and 
+                    pConfig->m_sourceSetIds.test(sourceId))) and
+            (pConfig->m_classSet.none() or 
+                (classId < DSL_ODE_CLASS_SET_SIZE and 
+                    pConfig->m_classSet.test(classId))));
+    }
 
     void OdeTrigger::PreProcessFrame(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
     {
+        // Load the criteria snapshot once for the Frame
+        UpdateFrameConfig();
+        
         // Reset the occurrences from the last frame, even if disabled  
         m_occurrences = 0;
 
@@ -756,32 +1180,23 @@ namespace DSL
         }
 
         // Call on each of the Trigger's Areas to (optionally) display their Rectangle
-        for (const auto &imap: m_pOdeAreasIndexed)
+        for (const auto &imap: FrameConfig().m_pOdeAreasIndexed)
         {
             DSL_ODE_AREA_PTR pOdeArea = 
                 std::dynamic_pointer_cast<OdeArea>(imap.second);
             
             pOdeArea->AddMeta(displayMetaData, pFrameMeta);
         }
-        if (m_interval)
-        {
-            m_intervalCounter = (m_intervalCounter + 1) % m_interval; 
-            if (m_intervalCounter != 0)
-            {
-                m_skipFrame = true;
-                return;
-            }
-        }
-        m_skipFrame = false;
+        m_skipFrame = CheckForIntervalSkip(pFrameMeta->source_id);
     }
 
     uint OdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Note: function is called from the system (callback) context.
+        // The criteria, limits and counters are read without the property mutex.
+        UpdateFrameConfig();
         
         // Filter on skip-frame interval
         if (!m_enabled or m_skipFrame)
@@ -806,7 +1221,7 @@ namespace DSL
         if (m_frameLimit and (m_frameCount == m_frameLimit))
         {
             // iterate through the map of limit-event-listeners calling each
-            for(auto const& imap: m_limitStateChangeListeners)
+            for(auto const& imap: FrameConfig().m_limitStateChangeListeners)
             {
                 try
                 {
@@ -820,13 +1235,13 @@ namespace DSL
             }
             if (m_resetTimeout)
             {
-                m_resetTimerId = g_timeout_add(1000*m_resetTimeout, 
-                    TriggerResetTimeoutHandler, this);            
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_resetTimerMutex);
+                startResetTimer(m_resetTimeout);
             }
         }
 
         // If the client has added an accumulator, 
-        if (m_pAccumulator)
+        if (FrameConfig().m_pAccumulator)
         {
             m_occurrencesAccumulated += m_occurrences;
             
@@ -836,17 +1251,17 @@ namespace DSL
                 m_occurrencesAccumulated;
                 
             DSL_ODE_ACCUMULATOR_PTR pOdeAccumulator = 
-                std::dynamic_pointer_cast<OdeAccumulator>(m_pAccumulator);
+                std::dynamic_pointer_cast<OdeAccumulator>(FrameConfig().m_pAccumulator);
                 
             pOdeAccumulator->HandleOccurrences(shared_from_this(),
                 pBuffer, displayMetaData, pFrameMeta);
         }
         
         // If the client has added a heat-mapper
-        if (m_pHeatMapper)
+        if (FrameConfig().m_pHeatMapper)
         {
-            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->AddDisplayMeta(
-                displayMetaData);
+            std::dynamic_pointer_cast<OdeHeatMapper>(FrameConfig().m_pHeatMapper)->AddDisplayMeta(
+                displayMetaData, pFrameMeta);
         }
         
         return m_occurrences;
@@ -854,6 +1269,23 @@ namespace DSL
     
     bool OdeTrigger::CheckForMinCriteria(NvDsFrameMeta* pFrameMeta, 
         NvDsObjectMeta* pObjectMeta)
+    {
+        const OdeTriggerConfig& config = FrameConfig();
+        
+        // Filter on Class-set if set, in addition to the Class id
+        if (config.m_classSet.any() and 
+            ((uint)pObjectMeta->class_id >= DSL_ODE_CLASS_SET_SIZE or 
+                !config.m_classSet.test(pObjectMeta->class_id)))
+        {
+            return false;
+        }
+        return CheckForMinCriteria(pFrameMeta, pObjectMeta, 
+            config, config.m_classId);
+    }
+
+    bool OdeTrigger::CheckForMinCriteria(NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta, const OdeTriggerConfig& config, 
+        uint classId)
     {
         // Filter on enable and skip-frame interval
         if (!m_enabled or m_skipFrame)
@@ -871,56 +1303,61 @@ namespace DSL
         {
             return false;
         }
-        // Filter on unique source-id and unique-inference-component-id
-        if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForInferId(pObjectMeta->unique_component_id))
+        // Filter on unique source-id, source-set and unique-inference-component-id
+        if ((config.m_source.size() and 
+                config.m_sourceId != (int)pFrameMeta->source_id) or 
+            (config.m_sourceSet.size() and 
+                (pFrameMeta->source_id >= DSL_ODE_SOURCE_SET_SIZE or
+                    !config.m_sourceSetIds.test(pFrameMeta->source_id))) or 
+            (config.m_infer.size() and 
+                config.m_inferId != (int)pObjectMeta->unique_component_id))
         {
             return false;
         }
         // Filter on Class id if set
-        if ((m_classId != DSL_ODE_ANY_CLASS) and 
-            (m_classId != pObjectMeta->class_id))
+        if ((classId != DSL_ODE_ANY_CLASS) and 
+            (classId != pObjectMeta->class_id))
         {
             return false;
         }
         // Ensure that the minimum Inference confidence has been reached
         if (pObjectMeta->confidence > 0 and 
-            pObjectMeta->confidence < m_minConfidence)
+            pObjectMeta->confidence < config.m_minConfidence)
         {
             return false;
         }
         // Ensure that the maximum Inference confidence has been reached
-        if (pObjectMeta->confidence > 0 and m_maxConfidence and
-            pObjectMeta->confidence > m_maxConfidence)
+        if (pObjectMeta->confidence > 0 and config.m_maxConfidence and
+            pObjectMeta->confidence > config.m_maxConfidence)
         {
             return false;
         }
         // Ensure that the minimum Tracker confidence has been reached
         if (pObjectMeta->tracker_confidence > 0 and 
-            pObjectMeta->tracker_confidence < m_minTrackerConfidence)
+            pObjectMeta->tracker_confidence < config.m_minTrackerConfidence)
         {
             return false;
         }
         // Ensure that the maximum Tracker confidence has been reached
-        if (pObjectMeta->tracker_confidence > 0 and m_maxTrackerConfidence and
-            pObjectMeta->tracker_confidence > m_maxTrackerConfidence)
+        if (pObjectMeta->tracker_confidence > 0 and config.m_maxTrackerConfidence and
+            pObjectMeta->tracker_confidence > config.m_maxTrackerConfidence)
         {
             return false;
         }
         // If defined, check for minimum dimensions
-        if ((m_minWidth > 0 and pObjectMeta->rect_params.width < m_minWidth) or
-            (m_minHeight > 0 and pObjectMeta->rect_params.height < m_minHeight))
+        if ((config.m_minWidth > 0 and pObjectMeta->rect_params.width < config.m_minWidth) or
+            (config.m_minHeight > 0 and pObjectMeta->rect_params.height < config.m_minHeight))
         {
             return false;
         }
         // If defined, check for maximum dimensions
-        if ((m_maxWidth > 0 and pObjectMeta->rect_params.width > m_maxWidth) or
-            (m_maxHeight > 0 and pObjectMeta->rect_params.height > m_maxHeight))
+        if ((config.m_maxWidth > 0 and pObjectMeta->rect_params.width > config.m_maxWidth) or
+            (config.m_maxHeight > 0 and pObjectMeta->rect_params.height > config.m_maxHeight))
         {
             return false;
         }
         // If define, check if Inference was done on the frame or not
-        if (m_inferDoneOnly and !pFrameMeta->bInferDone)
+        if (config.m_inferDoneOnly and !pFrameMeta->bInferDone)
         {
             return false;
         }
@@ -931,9 +1368,11 @@ namespace DSL
     {
         // If areas are defined, check condition
 
-        if (m_pOdeAreasIndexed.size())
+        const OdeTriggerConfig& config = FrameConfig();
+        
+        if (config.m_pOdeAreasIndexed.size())
         {
-            for (const auto &imap: m_pOdeAreasIndexed)
+            for (const auto &imap: config.m_pOdeAreasIndexed)
             {
                 DSL_ODE_AREA_PTR pOdeArea = 
                     std::dynamic_pointer_cast<OdeArea>(imap.second);
@@ -965,20 +1404,19 @@ namespace DSL
         std::vector<NvDsDisplayMeta*>& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
     {
+        // Load the criteria snapshot once for the Frame
+        UpdateFrameConfig();
+        
         if (!m_enabled or !CheckForSourceId(pFrameMeta->source_id) or 
             m_when != DSL_ODE_PRE_OCCURRENCE_CHECK)
         {
             return;
         }
-        if (m_interval)
+        if (CheckForIntervalSkip(pFrameMeta->source_id))
         {
-            m_intervalCounter = (m_intervalCounter + 1) % m_interval; 
-            if (m_intervalCounter != 0)
-            {
-                return;
-            }
+            return;
         }
-        for (const auto &imap: m_pOdeActionsIndexed)
+        for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
         {
             DSL_ODE_ACTION_PTR pOdeAction = 
                 std::dynamic_pointer_cast<OdeAction>(imap.second);
@@ -991,24 +1429,20 @@ namespace DSL
         std::vector<NvDsDisplayMeta*>& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
         
         if (!m_enabled or !CheckForSourceId(pFrameMeta->source_id) or 
             m_when != DSL_ODE_POST_OCCURRENCE_CHECK)
         {
             return 0;
         }
-        if (m_interval)
+        if (CheckForIntervalSkip(pFrameMeta->source_id))
         {
-            m_intervalCounter = (m_intervalCounter + 1) % m_interval; 
-            if (m_intervalCounter != 0)
-            {
-                return 0;
-            }
+            return 0;
         }
-        for (const auto &imap: m_pOdeActionsIndexed)
+        for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
         {
             DSL_ODE_ACTION_PTR pOdeAction = 
                 std::dynamic_pointer_cast<OdeAction>(imap.second);
@@ -1036,9 +1470,9 @@ namespace DSL
         std::vector<NvDsDisplayMeta*>& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
         
         if (!m_enabled or 
             !CheckForSourceId(pFrameMeta->source_id) or 
@@ -1058,13 +1492,13 @@ namespace DSL
         pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = m_occurrences;
 
 
-        if (m_pHeatMapper)
+        if (FrameConfig().m_pHeatMapper)
         {
-            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
+            std::dynamic_pointer_cast<OdeHeatMapper>(FrameConfig().m_pHeatMapper)->HandleOccurrence(
                 pFrameMeta, pObjectMeta);
         }
 
-        for (const auto &imap: m_pOdeActionsIndexed)
+        for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
         {
             DSL_ODE_ACTION_PTR pOdeAction = 
                 std::dynamic_pointer_cast<OdeAction>(imap.second);
@@ -1100,9 +1534,9 @@ namespace DSL
         std::vector<NvDsDisplayMeta*>& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
         
         // Important **** we need to check for Criteria even if the Absence Trigger is disabled. 
         // This is case another Trigger enables This trigger, and it checks for the number of 
@@ -1123,37 +1557,32 @@ namespace DSL
     uint AbsenceOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData, NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
+        
+        if (!m_enabled or (m_eventLimit and m_triggered >= m_eventLimit) 
+            or m_occurrences) 
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            if (!m_enabled or (m_eventLimit and m_triggered >= m_eventLimit) 
-                or m_occurrences) 
-            {
-                return 0;
-            }        
-            
-            // since occurrences = 0, ODE occurrence for the Absence Trigger = 1
-            m_occurrences = 1;
-            
-            // event has been triggered 
-            IncrementAndCheckTriggerCount();
+            return 0;
+        }        
+        
+        // since occurrences = 0, ODE occurrence for the Absence Trigger = 1
+        m_occurrences = 1;
+        
+        // event has been triggered 
+        IncrementAndCheckTriggerCount();
 
-            // update the total event count static variable
-            s_eventCount++;
+        // update the total event count static variable
+        s_eventCount++;
 
-            for (const auto &imap: m_pOdeActionsIndexed)
-            {
-                DSL_ODE_ACTION_PTR pOdeAction = 
-                    std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
-                    pBuffer, displayMetaData, pFrameMeta, NULL);
-            }
+        for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
+        {
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(imap.second);
+            pOdeAction->HandleOccurrence(shared_from_this(), 
+                pBuffer, displayMetaData, pFrameMeta, NULL);
         }
-        // mutext unlocked - safe to call base class
         return OdeTrigger::PostProcessFrame(pBuffer, 
             displayMetaData, pFrameMeta);
     }
@@ -1208,9 +1637,9 @@ namespace DSL
         std::vector<NvDsDisplayMeta*>& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
         
         if (!m_enabled or 
             !CheckForSourceId(pFrameMeta->source_id) or 
@@ -1220,6 +1649,9 @@ namespace DSL
             return false;
         }
 
+        // Gaurd the Trigger's state against a Reset from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+
         std::shared_ptr<TrackedObject> pTrackedObject;
         
         // if this is the first occurrence of this object for this source
@@ -1254,16 +1686,16 @@ namespace DSL
             s_eventCount++;
 
             // If the client has added a heat mapper, call to add the occurrence data
-            if (m_pHeatMapper)
+            if (FrameConfig().m_pHeatMapper)
             {
-                std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
+                std::dynamic_pointer_cast<OdeHeatMapper>(FrameConfig().m_pHeatMapper)->HandleOccurrence(
                     pFrameMeta, pObjectMeta);
             }
 
             // set the primary metric as the current occurrence for this frame
             pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = m_occurrences;
                 
-            for (const auto &imap: m_pOdeActionsIndexed)
+            for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
             {
                 DSL_ODE_ACTION_PTR pOdeAction = 
                     std::dynamic_pointer_cast<OdeAction>(imap.second);
@@ -1287,8 +1719,10 @@ namespace DSL
     uint InstanceOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        UpdateFrameConfig();
+        
+        // create scope so the property-mutex is unlocked before
+        // calling the base-class PostProcessFrame.
         {
             // Note: function is called from the system (callback) context
             // Gaurd against property updates from the client API
@@ -1325,9 +1759,9 @@ namespace DSL
         std::vector<NvDsDisplayMeta*>& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
         
         if (!m_enabled or 
             !CheckForSourceId(pFrameMeta->source_id) or 
@@ -1345,35 +1779,30 @@ namespace DSL
     uint SummationOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
+        
+        if (!m_enabled or m_skipFrame or (m_eventLimit and m_triggered >= m_eventLimit))
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            if (!m_enabled or m_skipFrame or (m_eventLimit and m_triggered >= m_eventLimit))
-            {
-                return 0;
-            }
-            // event has been triggered
-            IncrementAndCheckTriggerCount();
+            return 0;
+        }
+        // event has been triggered
+        IncrementAndCheckTriggerCount();
 
-             // update the total event count static variable
-            s_eventCount++;
+         // update the total event count static variable
+        s_eventCount++;
 
-            pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] = 
-                DSL_FRAME_INFO_OCCURRENCES;
-            pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] = m_occurrences;
-            for (const auto &imap: m_pOdeActionsIndexed)
-            {
-                DSL_ODE_ACTION_PTR pOdeAction = 
-                    std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
-                    pBuffer, displayMetaData, pFrameMeta, NULL);
-            }
+        pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] = 
+            DSL_FRAME_INFO_OCCURRENCES;
+        pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] = m_occurrences;
+        for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
+        {
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(imap.second);
+            pOdeAction->HandleOccurrence(shared_from_this(), 
+                pBuffer, displayMetaData, pFrameMeta, NULL);
         }
-        // mutex unlocked safe to call base class
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
    }
@@ -1400,9 +1829,9 @@ namespace DSL
         std::vector<NvDsDisplayMeta*>& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
         
         // conditional execution
         if (!m_enabled or 
@@ -1433,13 +1862,13 @@ namespace DSL
         // update the total event count static variable
         s_eventCount++;
 
-        if (m_pHeatMapper)
+        if (FrameConfig().m_pHeatMapper)
         {
-            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
+            std::dynamic_pointer_cast<OdeHeatMapper>(FrameConfig().m_pHeatMapper)->HandleOccurrence(
                 pFrameMeta, pObjectMeta);
         }
 
-        for (const auto &imap: m_pOdeActionsIndexed)
+        for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
         {
             DSL_ODE_ACTION_PTR pOdeAction = 
                 std::dynamic_pointer_cast<OdeAction>(imap.second);
@@ -1452,47 +1881,42 @@ namespace DSL
     uint CustomOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
+        
+        // conditional execution
+        if (!m_enabled or m_clientPostProcessor == NULL)
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            // conditional execution
-            if (!m_enabled or m_clientPostProcessor == NULL)
-            {
-                return false;
-            }
-            try
-            {
-                if (!m_clientPostProcessor(pBuffer, pFrameMeta, m_clientData))
-                {
-                    return 0;
-                }
-            }
-            catch(...)
+            return false;
+        }
+        try
+        {
+            if (!m_clientPostProcessor(pBuffer, pFrameMeta, m_clientData))
             {
-                LOG_ERROR("Custon ODE Trigger '" << GetName() 
-                    << "' threw exception calling client callback");
-                return false;
+                return 0;
             }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Custon ODE Trigger '" << GetName() 
+                << "' threw exception calling client callback");
+            return false;
+        }
 
-            // event has been triggered
-            IncrementAndCheckTriggerCount();
+        // event has been triggered
+        IncrementAndCheckTriggerCount();
 
-             // update the total event count static variable
-            s_eventCount++;
+         // update the total event count static variable
+        s_eventCount++;
 
-            for (const auto &imap: m_pOdeActionsIndexed)
-            {
-                DSL_ODE_ACTION_PTR pOdeAction = 
-                    std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
-                    pBuffer, displayMetaData, pFrameMeta, NULL);
-            }
+        for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
+        {
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(imap.second);
+            pOdeAction->HandleOccurrence(shared_from_this(), 
+                pBuffer, displayMetaData, pFrameMeta, NULL);
         }
-        // mutex unlocked - safe to call base class
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
     }
@@ -1534,9 +1958,9 @@ namespace DSL
         std::vector<NvDsDisplayMeta*>& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
         
         if (!CheckForSourceId(pFrameMeta->source_id) or 
             !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
@@ -1547,9 +1971,9 @@ namespace DSL
         
         m_occurrences++;
         
-        if (m_pHeatMapper)
+        if (FrameConfig().m_pHeatMapper)
         {
-            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
+            std::dynamic_pointer_cast<OdeHeatMapper>(FrameConfig().m_pHeatMapper)->HandleOccurrence(
                 pFrameMeta, pObjectMeta);
         }
         return true;
@@ -1558,8 +1982,10 @@ namespace DSL
     uint CountOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        UpdateFrameConfig();
+        
+        // create scope so the property-mutex is unlocked before
+        // calling the base-class PostProcessFrame.
         {
             // Note: function is called from the system (callback) context
             // Gaurd against property updates from the client API
@@ -1576,7 +2002,7 @@ namespace DSL
              // update the total event count static variable
             s_eventCount++;
 
-            for (const auto &imap: m_pOdeActionsIndexed)
+            for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
             {
                 DSL_ODE_ACTION_PTR pOdeAction = 
                     std::dynamic_pointer_cast<OdeAction>(imap.second);
@@ -1607,9 +2033,9 @@ namespace DSL
         std::vector<NvDsDisplayMeta*>& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
         
         if (!CheckForSourceId(pFrameMeta->source_id) or 
             !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
@@ -1626,60 +2052,55 @@ namespace DSL
     uint SmallestOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
+        
+        m_occurrences = 0;
+        
+        // need at least one object for a Minimum event
+        if (m_enabled and m_occurrenceMetaList.size())
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            m_occurrences = 0;
+            // One occurrence to return and increment the accumulative Trigger count
+            m_occurrences = 1;
+            IncrementAndCheckTriggerCount();
+            // update the total event count static variable
+            s_eventCount++;
+
+            uint smallestArea = UINT32_MAX;
+            NvDsObjectMeta* pSmallestObject(NULL);
             
-            // need at least one object for a Minimum event
-            if (m_enabled and m_occurrenceMetaList.size())
+            // iterate through the list of object occurrences that passed all min criteria
+            for (const auto &ivec: m_occurrenceMetaList) 
             {
-                // One occurrence to return and increment the accumulative Trigger count
-                m_occurrences = 1;
-                IncrementAndCheckTriggerCount();
-                // update the total event count static variable
-                s_eventCount++;
-
-                uint smallestArea = UINT32_MAX;
-                NvDsObjectMeta* pSmallestObject(NULL);
-                
-                // iterate through the list of object occurrences that passed all min criteria
-                for (const auto &ivec: m_occurrenceMetaList) 
-                {
-                    uint rectArea = ivec->rect_params.width * ivec->rect_params.height;
-                    if (rectArea < smallestArea) 
-                    { 
-                        smallestArea = rectArea;
-                        pSmallestObject = ivec;    
-                    }
-                }
-                // conditionally add the 
-                if (m_pHeatMapper)
-                {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, pSmallestObject);
-                }
-                // set the primary metric as the smallest bounding box by area
-                pSmallestObject->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                    = smallestArea;
-                for (const auto &imap: m_pOdeActionsIndexed)
-                {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                        pBuffer, displayMetaData, pFrameMeta, pSmallestObject);
+                uint rectArea = ivec->rect_params.width * ivec->rect_params.height;
+                if (rectArea < smallestArea) 
+                { 
+                    smallestArea = rectArea;
+                    pSmallestObject = ivec;    
                 }
-            }   
+            }
+            // conditionally add the 
+            if (FrameConfig().m_pHeatMapper)
+            {
+                std::dynamic_pointer_cast<OdeHeatMapper>(FrameConfig().m_pHeatMapper)->HandleOccurrence(
+                    pFrameMeta, pSmallestObject);
+            }
+            // set the primary metric as the smallest bounding box by area
+            pSmallestObject->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
+                = smallestArea;
+            for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
+            {
+                DSL_ODE_ACTION_PTR pOdeAction = 
+                    std::dynamic_pointer_cast<OdeAction>(imap.second);
+                
+                pOdeAction->HandleOccurrence(shared_from_this(), 
+                    pBuffer, displayMetaData, pFrameMeta, pSmallestObject);
+            }
+        }   
 
-            // reset for next frame
-            m_occurrenceMetaList.clear();
-        }
-        // mutex unlocked - safe to call base class
+        // reset for next frame
+        m_occurrenceMetaList.clear();
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
    }
@@ -1702,9 +2123,9 @@ namespace DSL
         std::vector<NvDsDisplayMeta*>& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
         
         if (!CheckForSourceId(pFrameMeta->source_id) or 
             !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
@@ -1721,63 +2142,58 @@ namespace DSL
     uint LargestOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
+        
+        m_occurrences = 0;
+        
+        // need at least one object for a Minimum event
+        if (m_enabled and m_occurrenceMetaList.size())
         {
-            // Note: function is called from the system (callback) context
-            // Gaurd against property updates from the client API
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
-            
-            m_occurrences = 0;
+            // Once occurrence to return and increment the accumulative Trigger count
+            m_occurrences = 1;
+            IncrementAndCheckTriggerCount();
+            // update the total event count static variable
+            s_eventCount++;
+
+            uint largestArea = 0;
+            NvDsObjectMeta* pLargestObject(NULL);
             
-            // need at least one object for a Minimum event
-            if (m_enabled and m_occurrenceMetaList.size())
+            // iterate through the list of object occurrences that passed all min criteria
+            for (const auto &ivec: m_occurrenceMetaList) 
             {
-                // Once occurrence to return and increment the accumulative Trigger count
-                m_occurrences = 1;
-                IncrementAndCheckTriggerCount();
-                // update the total event count static variable
-                s_eventCount++;
-
-                uint largestArea = 0;
-                NvDsObjectMeta* pLargestObject(NULL);
-                
-                // iterate through the list of object occurrences that passed all min criteria
-                for (const auto &ivec: m_occurrenceMetaList) 
-                {
-                    uint rectArea = ivec->rect_params.width * ivec->rect_params.height;
-                    if (rectArea > largestArea) 
-                    { 
-                        largestArea = rectArea;
-                        pLargestObject = ivec;    
-                    }
+                uint rectArea = ivec->rect_params.width * ivec->rect_params.height;
+                if (rectArea > largestArea) 
+                { 
+                    largestArea = rectArea;
+                    pLargestObject = ivec;    
                 }
+            }
 
-                // If the client has added a heat mapper, call to add-occurrence
-                if (m_pHeatMapper)
-                {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, pLargestObject);
-                }
-                
-                // set the primary metric as the larget area
-                pLargestObject->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                    = largestArea;
+            // If the client has added a heat mapper, call to add-occurrence
+            if (FrameConfig().m_pHeatMapper)
+            {
+                std::dynamic_pointer_cast<OdeHeatMapper>(FrameConfig().m_pHeatMapper)->HandleOccurrence(
+                    pFrameMeta, pLargestObject);
+            }
+            
+            // set the primary metric as the larget area
+            pLargestObject->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
+                = largestArea;
+            
+            for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
+            {
+                DSL_ODE_ACTION_PTR pOdeAction = 
+                    std::dynamic_pointer_cast<OdeAction>(imap.second);
                 
-                for (const auto &imap: m_pOdeActionsIndexed)
-                {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                        pBuffer, displayMetaData, pFrameMeta, pLargestObject);
-                }
-            }   
+                pOdeAction->HandleOccurrence(shared_from_this(), 
+                    pBuffer, displayMetaData, pFrameMeta, pLargestObject);
+            }
+        }   
 
-            // reset for next frame
-            m_occurrenceMetaList.clear();
-        }
-        // mutex unlocked  - safe to call base class
+        // reset for next frame
+        m_occurrenceMetaList.clear();
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
     }
@@ -1815,9 +2231,9 @@ namespace DSL
         std::vector<NvDsDisplayMeta*>& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
         
         if (!m_enabled or 
             !CheckForSourceId(pFrameMeta->source_id) or 
@@ -1835,8 +2251,10 @@ namespace DSL
     uint NewLowOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        UpdateFrameConfig();
+        
+        // create scope so the property-mutex is unlocked before
+        // calling the base-class PostProcessFrame.
         {
             // Note: function is called from the system (callback) context
             // Gaurd against property updates from the client API
@@ -1864,7 +2282,7 @@ namespace DSL
                 pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] = 
                     m_occurrences;
 
-                for (const auto &imap: m_pOdeActionsIndexed)
+                for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
                 {
                     DSL_ODE_ACTION_PTR pOdeAction = 
                         std::dynamic_pointer_cast<OdeAction>(imap.second);
@@ -1918,9 +2336,9 @@ namespace DSL
         std::vector<NvDsDisplayMeta*>& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
         
         if (!m_enabled or 
             !CheckForSourceId(pFrameMeta->source_id) or 
@@ -1938,8 +2356,10 @@ namespace DSL
     uint NewHighOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        UpdateFrameConfig();
+        
+        // create scope so the property-mutex is unlocked before
+        // calling the base-class PostProcessFrame.
         {
             // Note: function is called from the system (callback) context
             // Gaurd against property updates from the client API
@@ -1967,7 +2387,7 @@ namespace DSL
                 pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] = 
                     m_occurrences;
 
-                for (const auto &imap: m_pOdeActionsIndexed)
+                for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
                 {
                     DSL_ODE_ACTION_PTR pOdeAction = 
                         std::dynamic_pointer_cast<OdeAction>(imap.second);
@@ -2047,17 +2467,20 @@ namespace DSL
         std::vector<NvDsDisplayMeta*>& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
         
-        if (!m_pOdeAreasIndexed.size())
+        if (!FrameConfig().m_pOdeAreasIndexed.size())
         {
             LOG_ERROR("At least one OdeArea is required for CrossOdeTrigger '" 
                 << GetName() << "'");
             return false;
         }
 
+        // Gaurd the Trigger's state against a Reset from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+
         // Check for minimum criteria - but not for within an Area. 
         if (!CheckForSourceId(pFrameMeta->source_id) or 
             !CheckForMinCriteria(pFrameMeta, pObjectMeta))
@@ -2088,7 +2511,7 @@ namespace DSL
             (NvBbox_Coords*)&pObjectMeta->rect_params);
             
         // Iterate through the map of 1 or more Areas to test for line cross
-        for (const auto &imap: m_pOdeAreasIndexed)
+        for (const auto &imap: FrameConfig().m_pOdeAreasIndexed)
         {
             DSL_ODE_AREA_PTR pOdeArea = 
                 std::dynamic_pointer_cast<OdeArea>(imap.second);
@@ -2180,9 +2603,9 @@ namespace DSL
                 s_eventCount++;
 
                 // If the client has added a heat mapper, call to add the occurrence data
-                if (m_pHeatMapper)
+                if (FrameConfig().m_pHeatMapper)
                 {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
+                    std::dynamic_pointer_cast<OdeHeatMapper>(FrameConfig().m_pHeatMapper)->HandleOccurrence(
                         pFrameMeta, pObjectMeta);
                 }
 
@@ -2195,7 +2618,7 @@ namespace DSL
                 pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] = 
                     (uint64_t)(pTrackedObject->GetDurationMs());
                     
-                for (const auto &imap: m_pOdeActionsIndexed)
+                for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
                 {
                     DSL_ODE_ACTION_PTR pOdeAction = 
                         std::dynamic_pointer_cast<OdeAction>(imap.second);
@@ -2217,6 +2640,8 @@ namespace DSL
     uint CrossOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
+        UpdateFrameConfig();
+        
         // Note: function is called from the system (callback) context
         // Gaurd against property updates from the client API
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2229,14 +2654,14 @@ namespace DSL
 
         // If the client has added a heat-mapper, need to AddDisplayMeta here as
         // the base/super class PostProcessFrame is not called .
-        if (m_pHeatMapper)
+        if (FrameConfig().m_pHeatMapper)
         {
-            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->AddDisplayMeta(
-                displayMetaData);
+            std::dynamic_pointer_cast<OdeHeatMapper>(FrameConfig().m_pHeatMapper)->AddDisplayMeta(
+                displayMetaData, pFrameMeta);
         }
 
         // If the client has added an accumulator, 
-        if (m_pAccumulator)
+        if (FrameConfig().m_pAccumulator)
         {
             m_occurrencesInAccumulated += m_occurrencesIn;
             m_occurrencesOutAccumulated += m_occurrencesOut;
@@ -2253,7 +2678,7 @@ namespace DSL
                 m_occurrencesOutAccumulated;
                 
             DSL_ODE_ACCUMULATOR_PTR pOdeAccumulator = 
-                std::dynamic_pointer_cast<OdeAccumulator>(m_pAccumulator);
+                std::dynamic_pointer_cast<OdeAccumulator>(FrameConfig().m_pAccumulator);
                 
             pOdeAccumulator->HandleOccurrences(shared_from_this(),
                 pBuffer, displayMetaData, pFrameMeta);
@@ -2364,9 +2789,9 @@ namespace DSL
         std::vector<NvDsDisplayMeta*>& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
         
         if (!CheckForSourceId(pFrameMeta->source_id) or 
             !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
@@ -2375,6 +2800,9 @@ namespace DSL
             return false;
         }
 
+        // Gaurd the Trigger's state against a Reset from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+
         // if this is the first occurrence of this object for this source
         if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
             pObjectMeta->object_id))
@@ -2409,9 +2837,9 @@ namespace DSL
                 s_eventCount++;
     
                 // If the client has added a heat mapper, call to add the occurrence data
-                if (m_pHeatMapper)
+                if (FrameConfig().m_pHeatMapper)
                 {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
+                    std::dynamic_pointer_cast<OdeHeatMapper>(FrameConfig().m_pHeatMapper)->HandleOccurrence(
                         pFrameMeta, pObjectMeta);
                 }
 
@@ -2421,7 +2849,7 @@ namespace DSL
                 pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
                     (uint64_t)(trackedTimeMs/1000);
                     
-                for (const auto &imap: m_pOdeActionsIndexed)
+                for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
                 {
                     DSL_ODE_ACTION_PTR pOdeAction = 
                         std::dynamic_pointer_cast<OdeAction>(imap.second);
@@ -2436,8 +2864,10 @@ namespace DSL
     uint PersistenceOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        UpdateFrameConfig();
+        
+        // create scope so the property-mutex is unlocked before
+        // calling the base-class PostProcessFrame.
         {
             // Note: function is called from the system (callback) context
             // Gaurd against property updates from the client API
@@ -2475,9 +2905,9 @@ namespace DSL
         std::vector<NvDsDisplayMeta*>& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
         
         if (!CheckForSourceId(pFrameMeta->source_id) or 
             !CheckForMinCriteria(pFrameMeta, pObjectMeta) or !CheckForInside(pObjectMeta))
@@ -2485,6 +2915,9 @@ namespace DSL
             return false;
         }
 
+        // Gaurd the Trigger's state against a Reset from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+
         // if this is the first occurrence of this object for this source
         if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
             pObjectMeta->object_id))
@@ -2516,8 +2949,10 @@ namespace DSL
     uint LatestOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        UpdateFrameConfig();
+        
+        // create scope so the property-mutex is unlocked before
+        // calling the base-class PostProcessFrame.
         {
             // Note: function is called from the system (callback) context
             // Gaurd against property updates from the client API
@@ -2539,9 +2974,9 @@ namespace DSL
                 s_eventCount++;
 
                 // If the client has added a heat mapper, call to add the occurrence data
-                if (m_pHeatMapper)
+                if (FrameConfig().m_pHeatMapper)
                 {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
+                    std::dynamic_pointer_cast<OdeHeatMapper>(FrameConfig().m_pHeatMapper)->HandleOccurrence(
                         pFrameMeta, m_pLatestObjectMeta);
                 }
                 
@@ -2551,7 +2986,7 @@ namespace DSL
                 m_pLatestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
                     (uint64_t)(m_latestTrackedTimeMs/1000);
 
-                for (const auto &imap: m_pOdeActionsIndexed)
+                for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
                 {
                     DSL_ODE_ACTION_PTR pOdeAction = 
                         std::dynamic_pointer_cast<OdeAction>(imap.second);
@@ -2591,9 +3026,9 @@ namespace DSL
         std::vector<NvDsDisplayMeta*>& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
         
         if (!CheckForSourceId(pFrameMeta->source_id) or 
             !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
@@ -2602,6 +3037,9 @@ namespace DSL
             return false;
         }
 
+        // Gaurd the Trigger's state against a Reset from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+
         // if this is the first occurrence of this object for this source
         if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
             pObjectMeta->object_id)) 
@@ -2635,8 +3073,10 @@ namespace DSL
     uint EarliestOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        UpdateFrameConfig();
+        
+        // create scope so the property-mutex is unlocked before
+        // calling the base-class PostProcessFrame.
         {
             // Note: function is called from the system (callback) context
             // Gaurd against property updates from the client API
@@ -2657,9 +3097,9 @@ namespace DSL
                 s_eventCount++;
 
                 // If the client has added a heat mapper, call to add the occurrence data
-                if (m_pHeatMapper)
+                if (FrameConfig().m_pHeatMapper)
                 {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
+                    std::dynamic_pointer_cast<OdeHeatMapper>(FrameConfig().m_pHeatMapper)->HandleOccurrence(
                         pFrameMeta, m_pEarliestObjectMeta);
                 }
 
@@ -2669,7 +3109,7 @@ namespace DSL
                 m_pEarliestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
                     (uint64_t)(m_earliestTrackedTimeMs/1000);
 
-                for (const auto &imap: m_pOdeActionsIndexed)
+                for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
                 {
                     DSL_ODE_ACTION_PTR pOdeAction = 
                         std::dynamic_pointer_cast<OdeAction>(imap.second);
@@ -2726,25 +3166,46 @@ namespace DSL
         m_classIdA = classIdA;
         m_classIdB = classIdB;
         m_classIdAOnly = (m_classIdA == m_classIdB);
+        s_dispatchGeneration++;
+    }
+    
+    bool ABOdeTrigger::GetDispatchFilter(int* sourceId, int* classId, int* inferId)
+    {
+        LOG_FUNC();
+        
+        bool resolved = OdeTrigger::GetDispatchFilter(sourceId, classId, inferId);
+
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        // Objects are checked against both Class A and Class B, so only
+        // Class A can be reported and only if A-A.
+        *classId = (!m_classIdAOnly or m_classIdA == DSL_ODE_ANY_CLASS)
+            ? -1 : m_classIdA;
+            
+        return resolved;
     }
     
     bool ABOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Note: function is called from the system (callback) context.
+        // The criteria are read from the Frame snapshot without the property mutex.
+        UpdateFrameConfig();
         
         if (!m_enabled or !CheckForSourceId(pFrameMeta->source_id))
         {
             return false;
         }
         
+        // Gaurd the Class A/B settings against updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
         bool occurrenceAdded(false);
         
-        m_classId = m_classIdA;
-        if (CheckForMinCriteria(pFrameMeta, pObjectMeta) and 
+        const OdeTriggerConfig& config = FrameConfig();
+        
+        if (CheckForMinCriteria(pFrameMeta, pObjectMeta, config, m_classIdA) and 
             CheckForInside(pObjectMeta))
         {
             m_occurrenceMetaListA.push_back(pObjectMeta);
@@ -2752,8 +3213,7 @@ namespace DSL
         }
         else if (!m_classIdAOnly)
         {
-            m_classId = m_classIdB;
-            if (CheckForMinCriteria(pFrameMeta, pObjectMeta) and 
+            if (CheckForMinCriteria(pFrameMeta, pObjectMeta, config, m_classIdB) and 
                 CheckForInside(pObjectMeta))
             {
                 m_occurrenceMetaListB.push_back(pObjectMeta);
@@ -2767,6 +3227,8 @@ namespace DSL
     uint ABOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
+        UpdateFrameConfig();
+        
         if (m_classIdAOnly)
         {
             return PostProcessFrameA(pBuffer, displayMetaData, pFrameMeta);
@@ -2831,8 +3293,8 @@ namespace DSL
     uint DistanceOdeTrigger::PostProcessFrameA(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        // create scope so the property-mutex is unlocked before
+        // calling the base-class PostProcessFrame.
         {
             // Note: function is called from the system (callback) context
             // Gaurd against property updates from the client API
@@ -2864,7 +3326,7 @@ namespace DSL
                             m_occurrenceMetaListA[j]->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
                                 = m_occurrences;
 
-                            for (const auto &imap: m_pOdeActionsIndexed)
+                            for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
                             {
                                 DSL_ODE_ACTION_PTR pOdeAction = 
                                     std::dynamic_pointer_cast<OdeAction>(imap.second);
@@ -2897,8 +3359,8 @@ namespace DSL
     uint DistanceOdeTrigger::PostProcessFrameAB(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        // create scope so the property-mutex is unlocked before
+        // calling the base-class PostProcessFrame.
         {
             // Note: function is called from the system (callback) context
             // Gaurd against property updates from the client API
@@ -2934,7 +3396,7 @@ namespace DSL
                                 iterB->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
                                     = m_occurrences;
 
-                                for (const auto &imap: m_pOdeActionsIndexed)
+                                for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
                                 {
                                     DSL_ODE_ACTION_PTR pOdeAction = 
                                         std::dynamic_pointer_cast<OdeAction>(imap.second);
@@ -3091,8 +3553,8 @@ namespace DSL
     uint IntersectionOdeTrigger::PostProcessFrameA(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        // create scope so the property-mutex is unlocked before
+        // calling the base-class PostProcessFrame.
         {
             // Note: function is called from the system (callback) context
             // Gaurd against property updates from the client API
@@ -3126,7 +3588,7 @@ namespace DSL
                             m_occurrenceMetaListA[j]->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
                                 = m_occurrences;
 
-                            for (const auto &imap: m_pOdeActionsIndexed)
+                            for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
                             {
                                 DSL_ODE_ACTION_PTR pOdeAction = 
                                     std::dynamic_pointer_cast<OdeAction>(imap.second);
@@ -3158,8 +3620,8 @@ namespace DSL
     uint IntersectionOdeTrigger::PostProcessFrameAB(GstBuffer* pBuffer, 
         std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
-        // create scope so the property-mutex can be unlocked before
-        // calling the base-class PostProcessFrame which locks the mutex.
+        // create scope so the property-mutex is unlocked before
+        // calling the base-class PostProcessFrame.
         {
             // Note: function is called from the system (callback) context
             // Gaurd against property updates from the client API
@@ -3198,7 +3660,7 @@ namespace DSL
                                 iterB->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
                                     = m_occurrences;
                                 
-                                for (const auto &imap: m_pOdeActionsIndexed)
+                                for (const auto &imap: FrameConfig().m_pOdeActionsIndexed)
                                 {
                                     DSL_ODE_ACTION_PTR pOdeAction = 
                                         std::dynamic_pointer_cast<OdeAction>(imap.second);
@@ -31,6 +31,8 @@ THE SOFTWARE.
 #include "DslOdeTrackedObject.h"
 #include "DslDisplayTypes.h"
 
+#include <bitset>
+
 namespace DSL
 {
     /**
@@ -136,6 +138,203 @@ namespace DSL
         std::shared_ptr<IntersectionOdeTrigger> \
             (new IntersectionOdeTrigger(name, source, classIdA, classIdB, limit))
 
+    #define DSL_ODE_TRIGGER_CONFIG_PTR std::shared_ptr<const OdeTriggerConfig>
+
+    /**
+     * @brief Source Ids - and Class Ids - in a Trigger's source-set and 
+     * class-set filters must be less than their set size.
+     */
+    #define DSL_ODE_SOURCE_SET_SIZE 256
+    #define DSL_ODE_CLASS_SET_SIZE 1024
+
+    // *****************************************************************************
+
+    /**
+     * @struct OdeTriggerConfig
+     * @brief Immutable snapshot of an ODE Trigger's filter criteria and
+     * child components. Client setters publish a new snapshot which the 
+     * streaming thread picks up on its next call, without taking the 
+     * Trigger's property mutex.
+     */
+    struct OdeTriggerConfig
+    {
+        /**
+         * @brief ctor for the OdeTriggerConfig struct
+         * @param[in] source unique source name filter, empty for any source
+         * @param[in] classId GIE Class Id filter
+         */
+        OdeTriggerConfig(const char* source, uint classId)
+            : m_source(source)
+            , m_sourceId(-1)
+            , m_inferId(-1)
+            , m_classId(classId)
+            , m_minConfidence(0)
+            , m_maxConfidence(0)
+            , m_minTrackerConfidence(0)
+            , m_maxTrackerConfidence(0)
+            , m_minWidth(0)
+            , m_minHeight(0)
+            , m_maxWidth(0)
+            , m_maxHeight(0)
+            , m_minFrameCountN(1)
+            , m_minFrameCountD(1)
+            , m_inferDoneOnly(false)
+            , m_interval(0)
+            , m_sourceSetResolved(true)
+        {};
+
+        /**
+         * @brief unique source name filter for this event
+         * empty indicates filter is disabled
+         */
+        std::string m_source;
+        
+        /**
+         * @brief unique source id filter for this event
+         * -1 indicates not set ... updated on first use.
+         */
+        int m_sourceId;
+        
+        /**
+         * @brief unique inference component name filter for this event
+         * empty indicates filter is disabled
+         */
+        std::string m_infer;
+        
+        /**
+         * @brief unique inference component id filter for this event
+         * -1 indicates not set ... updated on first use.
+         */
+        int m_inferId;
+        
+        /**
+         * @brief GIE Class Id filter for this event
+         */
+        uint m_classId;
+        
+        /**
+         * Mininum inference confidence to trigger an ODE occurrence [0.0..1.0]
+         */
+        float m_minConfidence;
+        
+        /**
+         * Maximum inference confidence to trigger an ODE occurrence [0.0..1.0]
+         */
+        float m_maxConfidence;
+        
+        /**
+         * Mininum tracker confidence to trigger an ODE occurrence [0.0..1.0]
+         */
+        float m_minTrackerConfidence;
+        
+        /**
+         * Maximum tracker confidence to trigger an ODE occurrence [0.0..1.0]
+         */
+        float m_maxTrackerConfidence;
+        
+        /**
+         * @brief Minimum rectangle width to trigger an ODE occurrence
+         */
+        float m_minWidth;
+
+        /**
+         * @brief Minimum rectangle height to trigger an ODE occurrence
+         */
+        float m_minHeight;
+
+        /**
+         * @brief Maximum rectangle width to trigger an ODE occurrence
+         */
+        float m_maxWidth;
+
+        /**
+         * @brief Maximum rectangle height to trigger an ODE occurrence
+         */
+        float m_maxHeight;
+
+        /**
+         * @brief Minimum frame count numerator to trigger an ODE occurrence
+         */
+        uint m_minFrameCountN;
+
+        /**
+         * @brief Minimum frame count denominator to trigger an ODE occurrence
+         */
+        uint m_minFrameCountD;
+        
+        /**
+         * @brief if set, the Frame meta value "bInferDone" must be set
+         * to trigger an occurrence
+         */
+        bool m_inferDoneOnly;
+        
+        /**
+         * @brief process interval in units of frames, 0 = every frame.
+         */
+        uint m_interval;
+        
+        /**
+         * @brief unique source names in the source-set filter for this event,
+         * empty indicates filter is disabled
+         */
+        std::vector<std::string> m_sourceSet;
+        
+        /**
+         * @brief Source Ids of m_sourceSet compiled into a bitset.
+         * Updated on first use as each name is resolved.
+         */
+        std::bitset<DSL_ODE_SOURCE_SET_SIZE> m_sourceSetIds;
+        
+        /**
+         * @brief true once every name in m_sourceSet has been resolved.
+         */
+        bool m_sourceSetResolved;
+        
+        /**
+         * @brief GIE Class Ids in the class-set filter for this event,
+         * none set indicates filter is disabled.
+         */
+        std::bitset<DSL_ODE_CLASS_SET_SIZE> m_classSet;
+        
+        /**
+         * @brief Map of child ODE Areas indexed by thier add-order for execution
+         */
+        std::map <uint, DSL_BASE_PTR> m_pOdeAreasIndexed;
+
+        /**
+         * @brief Map of child ODE Actions indexed by their add-order for execution
+         */
+        std::map <uint, DSL_BASE_PTR> m_pOdeActionsIndexed;
+        
+        /**
+         * @brief optional metric accumulator owned by the ODE Trigger.
+         */
+        DSL_BASE_PTR m_pAccumulator;
+    
+        /**
+         * @brief optional ODE Heat-Mapper owned by the ODE Trigger.
+         */
+        DSL_BASE_PTR m_pHeatMapper;
+
+        /**
+         * @brief map of all currently registered limit-state-change-listeners
+         * callback functions mapped with the user provided data
+         */
+        std::map<dsl_ode_trigger_limit_state_change_listener_cb, 
+            void*>m_limitStateChangeListeners;
+        
+        /**
+         * @brief Checks whether the Source, Infer and source-set name filters 
+         * have all been resolved to ids.
+         * @return true if there is nothing left to resolve, false otherwise.
+         */
+        bool IsResolved() const
+        {
+            return (m_source.empty() or m_sourceId != -1) and
+                (m_infer.empty() or m_inferId != -1) and m_sourceSetResolved;
+        };
+    };
+
     // *****************************************************************************
 
     /**
@@ -151,9 +350,19 @@ namespace DSL
         ~OdeTrigger();
 
         /**
-         * @brief total count of all events
+         * @brief total count of all events. Atomic as Triggers may be run
+         * on ODE Handler worker threads, see IsSourcePartitionable.
+         */
+        static std::atomic<uint64_t> s_eventCount;
+
+        /**
+         * @brief dispatch generation, incremented each time the Source, Class,
+         * or Infer filter, or the child components, of any Trigger change and 
+         * each time a Source or Infer name is registered or erased. ODE Handlers 
+         * compare against their last value to know when their dispatch index
+         * must be rebuilt.
          */
-        static uint64_t s_eventCount;
+        static std::atomic<uint64_t> s_dispatchGeneration;
         
         /**
          * @brief Function to check a given Object Meta data structure for the 
@@ -311,6 +520,21 @@ namespace DSL
          */
         void SetClassId(uint classId);
         
+        /**
+         * @brief Gets the class-set filter used for Object detection.
+         * @return vector of Class Ids in the set, empty if disabled.
+         */
+        std::vector<uint> GetClassIds();
+        
+        /**
+         * @brief Sets the class-set filter for Object detection. The set is
+         * applied in addition to the ClassId filter.
+         * @param[in] classIds array of Class Ids, each < DSL_ODE_CLASS_SET_SIZE.
+         * @param[in] size size of the classIds array, 0 to disable the filter.
+         * @return false if a Class Id is out of range, true otherwise.
+         */
+        bool SetClassIds(const uint* classIds, uint size);
+        
         /**
          * @brief Gets the trigger event limit for this ODE Trigger 
          * @return the current frame limit value
@@ -355,6 +579,27 @@ namespace DSL
          * @param id Source Id to use for test scenario
          */
         void _setSourceId(int id);
+        
+        /**
+         * @brief Adds a source name to the source-set filter for Object 
+         * detection. The set is applied in addition to the source filter.
+         * @param[in] source unique source name to add.
+         * @return false if the source is already in the set, true otherwise.
+         */
+        bool AddSourceToSet(const char* source);
+        
+        /**
+         * @brief Removes a source name from the source-set filter.
+         * @param[in] source unique source name to remove.
+         * @return false if the source is not in the set, true otherwise.
+         */
+        bool RemoveSourceFromSet(const char* source);
+        
+        /**
+         * @brief Removes all source names from the source-set filter,
+         * disabling the filter.
+         */
+        void RemoveAllSourcesFromSet();
 
         /**
          * @brief Gets the inference component name filter used for Object detection
@@ -377,6 +622,46 @@ namespace DSL
          */
         void _setInferId(int id);
         
+        /**
+         * @brief Gets the Trigger's resolved Source, Class, and Infer Id filters.
+         * Used by the parent ODE Handler to build its trigger dispatch index.
+         * @param[out] sourceId Source Id filter, -1 if not filtering on Source.
+         * @param[out] classId Class Id filter, -1 if not filtering on Class.
+         * @param[out] inferId Infer Id filter, -1 if not filtering on Infer.
+         * @return false if a Source or Infer name filter could not yet be 
+         * resolved to an id and is reported as -1, true otherwise.
+         */
+        virtual bool GetDispatchFilter(int* sourceId, int* classId, int* inferId);
+        
+        /**
+         * @brief Checks a Source and Class Id against the Trigger's compiled
+         * source-set and class-set filters. Used by the parent ODE Handler
+         * once for each Source/Class combination when building its index.
+         * @param[in] sourceId Source Id to check.
+         * @param[in] classId Class Id to check.
+         * @return true if both Ids pass the set filters, false otherwise.
+         */
+        virtual bool CheckForFilterSets(uint sourceId, uint classId);
+
+        /**
+         * @brief Returns true if the Trigger can be run - for the Frames of its 
+         * Source only - on an ODE Handler worker thread. Only used if the 
+         * Trigger has a Source filter. Triggers are run serially by default, 
+         * Trigger types opt-in by overriding this function.
+         * @return true if source-partitionable, false otherwise.
+         */
+        virtual bool IsSourcePartitionable(){return false;};
+
+        /**
+         * @brief Gets the Trigger's current filter criteria snapshot. The 
+         * snapshot is immutable and remains valid for as long as it is held.
+         * @return shared pointer to the current criteria snapshot.
+         */
+        DSL_ODE_TRIGGER_CONFIG_PTR GetConfig()
+        {
+            return std::atomic_load(&m_pConfig);
+        };
+        
         /**
          * @brief Gets the Minimuum Inference Confidence to trigger the event
          * @return the current Minimum Confidence value in use [0..1.0]
@@ -498,6 +783,13 @@ namespace DSL
         void SetInterval(uint interval);
         
     protected:
+
+        /**
+         * @brief Starts the auto-reset timer if enabled and not already pending.
+         * The m_resetTimerMutex must be held by the caller.
+         * @param[in] timeout auto-reset timeout in units of seconds.
+         */
+        void startResetTimer(uint timeout);
     
         /**
          * @brief Common function to check if an Object's meta data meets the 
@@ -511,6 +803,19 @@ namespace DSL
         bool CheckForMinCriteria(NvDsFrameMeta* pFrameMeta, 
             NvDsObjectMeta* pObjectMeta);
 
+        /**
+         * @brief Common function to check if an Object's meta data meets the 
+         * min criteria for ODE occurrence using a given snapshot and Class Id.
+         * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to test 
+         * @param[in] config criteria snapshot to test against.
+         * @param[in] classId Class Id filter to use in place of the snapshot's.
+         * @return true if Min Criteria is met, false otherwise
+         */
+        bool CheckForMinCriteria(NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta, const OdeTriggerConfig& config, 
+            uint classId);
+
         /**
          * @brief Common function to check if an Object's bbox fails within
          * one of the Triggers Areas
@@ -529,6 +834,14 @@ namespace DSL
          */
         bool CheckForSourceId(int sourceId);
         
+        /**
+         * @brief Advances the Trigger's process-interval counter for a Frame.
+         * Each Source in a source-set filter is counted separately. 
+         * @param sourceId a Frame's Source Id.
+         * @return true if the Frame is to be skipped, false otherwise.
+         */
+        bool CheckForIntervalSkip(uint sourceId);
+        
         /**
          * @brief Common function to check if an Objects's infer component id 
          * meets the criteria for ODE occurrence.
@@ -546,212 +859,223 @@ namespace DSL
         void IncrementAndCheckTriggerCount();
 
         /**
-         * @brief Index variable to incremment/assign on ODE Area add.
+         * @brief Gets the current criteria snapshot, resolving the Source and
+         * Infer names to ids on first use. A resolved snapshot is published
+         * in place of the current one unless a client update got there first.
+         * Names that fail to resolve are not looked up again until the
+         * dispatch generation changes.
+         * @return shared pointer to the current, resolved if possible, snapshot.
          */
-        uint m_nextAreaIndex;
+        DSL_ODE_TRIGGER_CONFIG_PTR AcquireConfig();
         
         /**
-         * @brief Map of child ODE Areas to use for minimum critera
+         * @brief Updates the Frame snapshot if a new criteria snapshot has been
+         * published, or if a Source or Infer name has been registered since a
+         * name failed to resolve. Called on entry to PreProcessFrame, 
+         * CheckForOccurrence, and PostProcessFrame only, so that the Frame 
+         * snapshot is stable for the duration of each call.
          */
-        std::map <std::string, DSL_BASE_PTR> m_pOdeAreas;
+        void UpdateFrameConfig();
         
         /**
-         * @brief Map of child ODE Areas indexed by thier add-order for execution
-         */
-        std::map <uint, DSL_BASE_PTR> m_pOdeAreasIndexed;
-
-        /**
-         * @brief Index variable to incremment/assign on ODE Action add.
-         */
-        uint m_nextActionIndex;
-
-        /**
-         * @brief Map of child ODE Actions owned by this trigger
+         * @brief Gets the Frame snapshot for the current call without an 
+         * atomic load. Use from the streaming thread only.
+         * @return reference to the current Frame snapshot.
          */
-        std::map <std::string, DSL_BASE_PTR> m_pOdeActions;
+        const OdeTriggerConfig& FrameConfig()
+        {
+            if (!m_pFrameConfig)
+            {
+                UpdateFrameConfig();
+            }
+            return *m_pFrameConfig;
+        };
         
         /**
-         * @brief Map of child ODE Actions indexed by their add-order for execution
+         * @brief Common function for source-partitionable Trigger types.
+         * Checks that the Trigger has no Accumulator or Heat-Mapper and that
+         * all of its Actions can be called from a worker thread.
+         * @return true if all child components are source-partitionable.
          */
-        std::map <uint, DSL_BASE_PTR> m_pOdeActionsIndexed;
+        bool ChildrenAreSourcePartitionable();
         
         /**
-         * @brief optional metric accumulator owned by the ODE Trigger.
-         */
-        DSL_BASE_PTR m_pAccumulator;
-    
-        /**
-         * @brief optional ODE Heat-Mapper owned by the ODE Trigger.
+         * @brief Copies the current criteria snapshot for update.
+         * Note: m_configMutex must be held by the caller.
+         * @return new, mutable copy of the current snapshot.
          */
-        DSL_BASE_PTR m_pHeatMapper;
-    
-        /**
-         * @brief auto-reset timeout in units of seconds
-         */
-        uint m_resetTimeout;
-
-        /**
-         * @brief gnome timer Id for the auto-reset timeout
-         */
-        uint m_resetTimerId;
+        std::shared_ptr<OdeTriggerConfig> CopyConfig();
         
         /**
-         * @brief Mutex for timer reset logic
+         * @brief Publishes a new criteria snapshot.
+         * Note: m_configMutex must be held by the caller.
+         * @param[in] pConfig updated snapshot to publish.
          */
-        GMutex m_resetTimerMutex;
+        void PublishConfig(std::shared_ptr<OdeTriggerConfig> pConfig);
 
         /**
-         * @brief map of all currently registered limit-state-change-listeners
-         * callback functions mapped with the user provided data
+         * @brief current filter criteria snapshot. Read with std::atomic_load
+         * and replaced with std::atomic_store only.
          */
-        std::map<dsl_ode_trigger_limit_state_change_listener_cb, 
-            void*>m_limitStateChangeListeners;
+        DSL_ODE_TRIGGER_CONFIG_PTR m_pConfig;
         
         /**
-         * @brief current number of frames in the current interval
+         * @brief mutex to serialize client updates of the criteria snapshot. 
+         * Never taken by the streaming thread once the snapshot is resolved.
          */
-        uint m_intervalCounter;
+        GMutex m_configMutex;
         
         /**
-         * @brief flag to identify frames that should be skipped, if m_skipFrameInterval > 0
+         * @brief incremented each time a new criteria snapshot is published.
          */
-         bool m_skipFrame;
-         
-    public:
-    
-        // access made public for performance reasons
-
+        std::atomic<uint64_t> m_configGeneration;
+        
         /**
-         * @brief Wide string name used for C/Python API
+         * @brief criteria snapshot in use by the thread processing the 
+         * current Frame. Only replaced by UpdateFrameConfig.
          */
-        std::wstring m_wName;
+        DSL_ODE_TRIGGER_CONFIG_PTR m_pFrameConfig;
         
         /**
-         * @brief trigger count, incremented on every event occurrence
+         * @brief value of m_configGeneration when m_pFrameConfig was loaded.
          */
-        uint64_t m_triggered;    
-    
+        uint64_t m_frameConfigGeneration;
+        
         /**
-         * @brief trigger event limit, once reached, actions will no longer be invoked
+         * @brief value of s_dispatchGeneration when a Source or Infer name 
+         * last failed to resolve. The names are not looked up again until 
+         * the dispatch generation changes, i.e. a name is registered.
          */
-        uint m_eventLimit;
-
+        std::atomic<uint64_t> m_failedLookupGeneration;
+        
         /**
-         * @brief number of Frames the trigger has processed.
+         * @brief client copy of the source name filter, returned by GetSource
+         * so that the pointer is not invalidated by a new snapshot.
          */
-        uint64_t m_frameCount;
+        std::string m_source;
         
         /**
-         * @brief trigger frame limit, once reached, actions will no longer be invoked
+         * @brief client copy of the infer name filter, returned by GetInfer.
          */
-        uint m_frameLimit;
+        std::string m_infer;
 
         /**
-         * @brief number of occurrences for the current frame, 
-         * reset on exit of PostProcessFrame
+         * @brief Index variable to incremment/assign on ODE Area add.
          */
-        uint m_occurrences; 
+        uint m_nextAreaIndex;
         
         /**
-         * @brief number of occurrences in the accumlated over all frames, reset on
-         * Trigger reset. Only updated if/when the Trigger has an ODE Accumulator. 
+         * @brief Map of child ODE Areas to use for minimum critera
          */
-        uint m_occurrencesAccumulated;
+        std::map <std::string, DSL_BASE_PTR> m_pOdeAreas;
         
-
         /**
-         * @brief unique source name filter for this event
-         * NULL indicates filter is disabled
+         * @brief Index variable to incremment/assign on ODE Action add.
          */
-        std::string m_source;
-        
+        uint m_nextActionIndex;
+
         /**
-         * @brief unique source id filter for this event
-         * -1 indicates not set ... updated on first use.
+         * @brief Map of child ODE Actions owned by this trigger
          */
-        int m_sourceId;
-        
+        std::map <std::string, DSL_BASE_PTR> m_pOdeActions;
+    
         /**
-         * @brief unique inference component name filter for this event
-         * NULL indicates filter is disabled
+         * @brief auto-reset timeout in units of seconds
          */
-        std::string m_infer;
-        
+        uint m_resetTimeout;
+
         /**
-         * @brief unique inference component id filter for this event
-         * -1 indicates not set ... updated on first use.
+         * @brief TimerWheel timer Id for the auto-reset timeout, 0 if the
+         * timer is not pending.
          */
-        int m_inferId;
+        uint m_resetTimerId;
         
         /**
-         * @brief GIE Class Id filter for this event
+         * @brief TimerWheel timer Id of the last auto-reset timer scheduled.
+         * Not cleared on expiry, so that the destructor can wait on a 
+         * callback that is still running.
          */
-        uint m_classId;
+        uint m_lastResetTimerId;
         
         /**
-         * Mininum inference confidence to trigger an ODE occurrence [0.0..1.0]
+         * @brief Mutex for timer reset logic
          */
-        float m_minConfidence;
+        GMutex m_resetTimerMutex;
         
         /**
-         * Maximum inference confidence to trigger an ODE occurrence [0.0..1.0]
+         * @brief process interval the counters below were last reset for.
+         * The counters are reset by the streaming thread on first use of a
+         * snapshot with a new interval. Streaming thread only.
          */
-        float m_maxConfidence;
+        uint m_countedInterval;
         
         /**
-         * Mininum tracker confidence to trigger an ODE occurrence [0.0..1.0]
+         * @brief current number of frames in the current interval.
+         * Streaming thread only.
          */
-        float m_minTrackerConfidence;
+        uint m_intervalCounter;
         
         /**
-         * Maximum tracker confidence to trigger an ODE occurrence [0.0..1.0]
+         * @brief current number of frames in the current interval for each
+         * Source when filtering on a source-set. Streaming thread only.
          */
-        float m_maxTrackerConfidence;
+        std::vector<uint> m_sourceIntervalCounters;
         
         /**
-         * @brief Minimum rectangle width to trigger an ODE occurrence
+         * @brief flag to identify frames that should be skipped, if m_skipFrameInterval > 0
          */
-        float m_minWidth;
+         bool m_skipFrame;
+         
+    public:
+    
+        // access made public for performance reasons
 
         /**
-         * @brief Minimum rectangle height to trigger an ODE occurrence
+         * @brief Wide string name used for C/Python API
          */
-        float m_minHeight;
-
+        std::wstring m_wName;
+        
         /**
-         * @brief Maximum rectangle width to trigger an ODE occurrence
+         * @brief trigger count, incremented on every event occurrence.
+         * Atomic, as with the limits below, so that the streaming thread
+         * can read it without the property mutex.
          */
-        float m_maxWidth;
-
+        std::atomic<uint64_t> m_triggered;    
+    
         /**
-         * @brief Maximum rectangle height to trigger an ODE occurrence
+         * @brief trigger event limit, once reached, actions will no longer be invoked
          */
-        float m_maxHeight;
+        std::atomic<uint> m_eventLimit;
 
         /**
-         * @brief process interval, default = 0
+         * @brief number of Frames the trigger has processed.
          */
-        uint m_interval;
+        std::atomic<uint64_t> m_frameCount;
         
         /**
-         * @brief Minimum frame count numerator to trigger an ODE occurrence
+         * @brief trigger frame limit, once reached, actions will no longer be invoked
          */
-        uint m_minFrameCountN;
+        std::atomic<uint> m_frameLimit;
 
         /**
-         * @brief Minimum frame count denominator to trigger an ODE occurrence
+         * @brief number of occurrences for the current frame, 
+         * reset on exit of PostProcessFrame
          */
-        uint m_minFrameCountD;
+        uint m_occurrences; 
         
         /**
-         * @brief if set, the Frame meta value "bInferDone" must be set
-         * to trigger an occurrence
+         * @brief number of occurrences in the accumlated over all frames, reset on
+         * Trigger reset. Only updated if/when the Trigger has an ODE Accumulator. 
          */
-        bool m_inferDoneOnly;
-
+        std::atomic<uint> m_occurrencesAccumulated;
     };
     
-    static int TriggerResetTimeoutHandler(gpointer pTrigger);
+    /**
+     * @brief TimerWheel callback for the Trigger's one-shot auto-reset timer.
+     * @param[in] pTrigger pointer to the OdeTrigger to reset.
+     * @return 0 always to stop the one-shot timer.
+     */
+    static uint TriggerResetTimeoutHandler(void* pTrigger);
     
     
     class AlwaysOdeTrigger : public OdeTrigger
@@ -798,6 +1122,13 @@ namespace DSL
         
         ~OccurrenceOdeTrigger();
 
+        /**
+         * @brief Occurrence Triggers keep no state shared with other Triggers and
+         * are source-partitionable if all of their child components are.
+         * @return true if source-partitionable, false otherwise.
+         */
+        bool IsSourcePartitionable(){return ChildrenAreSourcePartitionable();};
+
         /**
          * @brief Function to check a given Object Meta data structure for an Every Occurence event
          * and to invoke all Event Actions owned by the event
@@ -822,6 +1153,13 @@ namespace DSL
         
         ~AbsenceOdeTrigger();
 
+        /**
+         * @brief Absence Triggers keep no state shared with other Triggers and
+         * are source-partitionable if all of their child components are.
+         * @return true if source-partitionable, false otherwise.
+         */
+        bool IsSourcePartitionable(){return ChildrenAreSourcePartitionable();};
+
         /**
          * @brief Function to check a given Object Meta data structure for Object occurrence
          * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta - that holds the Object Meta
@@ -1010,6 +1348,13 @@ namespace DSL
             const char* source, uint classId, uint limit);
         
         ~InstanceOdeTrigger();
+
+        /**
+         * @brief Instance Triggers keep no state shared with other Triggers and
+         * are source-partitionable if all of their child components are.
+         * @return true if source-partitionable, false otherwise.
+         */
+        bool IsSourcePartitionable(){return ChildrenAreSourcePartitionable();};
         
         /**
          * @brief Gets the current instance and suppression count settings for the
@@ -1089,6 +1434,13 @@ namespace DSL
         
         ~SummationOdeTrigger();
 
+        /**
+         * @brief Summation Triggers keep no state shared with other Triggers and
+         * are source-partitionable if all of their child components are.
+         * @return true if source-partitionable, false otherwise.
+         */
+        bool IsSourcePartitionable(){return ChildrenAreSourcePartitionable();};
+
         /**
          * @brief Function to check a given Object Meta data structure for Object occurrence
          * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame 
@@ -1142,6 +1494,7 @@ namespace DSL
         bool CheckForOccurrence(GstBuffer* pBuffer, 
             std::vector<NvDsDisplayMeta*>& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+            
         /**
          * @brief Function to call the client provided callback to post process the frame 
          * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta
@@ -1180,6 +1533,13 @@ namespace DSL
         
         ~MinimumOdeTrigger();
 
+        /**
+         * @brief Minimum Triggers keep no state shared with other Triggers and
+         * are source-partitionable if all of their child components are.
+         * @return true if source-partitionable, false otherwise.
+         */
+        bool IsSourcePartitionable(){return ChildrenAreSourcePartitionable();};
+
         /**
          * @brief Function to check a given Object Meta data structure for Object occurrence, 
          * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame 
@@ -1222,6 +1582,13 @@ namespace DSL
         
         ~MaximumOdeTrigger();
 
+        /**
+         * @brief Maximum Triggers keep no state shared with other Triggers and
+         * are source-partitionable if all of their child components are.
+         * @return true if source-partitionable, false otherwise.
+         */
+        bool IsSourcePartitionable(){return ChildrenAreSourcePartitionable();};
+
         /**
          * @brief Function to check a given Object Meta data structure for Object occurrence, 
          * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame 
@@ -1264,6 +1631,13 @@ namespace DSL
         
         ~PersistenceOdeTrigger();
 
+        /**
+         * @brief Persistence Triggers keep no state shared with other Triggers and
+         * are source-partitionable if all of their child components are.
+         * @return true if source-partitionable, false otherwise.
+         */
+        bool IsSourcePartitionable(){return ChildrenAreSourcePartitionable();};
+
         /**
          * @brief Gets the current Minimum and Maximum time settings in use. 
          * a value of 0 means no minimum or maximum
@@ -1328,6 +1702,13 @@ namespace DSL
         
         ~CountOdeTrigger();
 
+        /**
+         * @brief Count Triggers keep no state shared with other Triggers and
+         * are source-partitionable if all of their child components are.
+         * @return true if source-partitionable, false otherwise.
+         */
+        bool IsSourcePartitionable(){return ChildrenAreSourcePartitionable();};
+
         /**
          * @brief Gets the current Minimum and Maximum count setting in use. 
          * a value of 0 means no minimum or maximum
@@ -1391,6 +1772,13 @@ namespace DSL
         
         ~SmallestOdeTrigger();
 
+        /**
+         * @brief Smallest Triggers keep no state shared with other Triggers and
+         * are source-partitionable if all of their child components are.
+         * @return true if source-partitionable, false otherwise.
+         */
+        bool IsSourcePartitionable(){return ChildrenAreSourcePartitionable();};
+
         /**
          * @brief Function to check a given Object Meta data structure for Object occurrence
          * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame 
@@ -1435,6 +1823,13 @@ namespace DSL
         
         ~LargestOdeTrigger();
 
+        /**
+         * @brief Largest Triggers keep no state shared with other Triggers and
+         * are source-partitionable if all of their child components are.
+         * @return true if source-partitionable, false otherwise.
+         */
+        bool IsSourcePartitionable(){return ChildrenAreSourcePartitionable();};
+
         /**
          * @brief Function to check a given Object Meta data structure for Object occurrence
          * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame 
@@ -1479,6 +1874,13 @@ namespace DSL
         
         ~LatestOdeTrigger();
 
+        /**
+         * @brief Latest Triggers keep no state shared with other Triggers and
+         * are source-partitionable if all of their child components are.
+         * @return true if source-partitionable, false otherwise.
+         */
+        bool IsSourcePartitionable(){return ChildrenAreSourcePartitionable();};
+
         /**
          * @brief Function to check a given Object Meta data structure for Object occurrence
          * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame 
@@ -1525,6 +1927,13 @@ namespace DSL
         
         ~EarliestOdeTrigger();
 
+        /**
+         * @brief Earliest Triggers keep no state shared with other Triggers and
+         * are source-partitionable if all of their child components are.
+         * @return true if source-partitionable, false otherwise.
+         */
+        bool IsSourcePartitionable(){return ChildrenAreSourcePartitionable();};
+
         /**
          * @brief Function to check a given Object Meta data structure for Object occurrence
          * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame 
@@ -1571,6 +1980,13 @@ namespace DSL
         
         ~NewLowOdeTrigger();
 
+        /**
+         * @brief New Low Triggers keep no state shared with other Triggers and
+         * are source-partitionable if all of their child components are.
+         * @return true if source-partitionable, false otherwise.
+         */
+        bool IsSourcePartitionable(){return ChildrenAreSourcePartitionable();};
+
         /**
          * @brief Overrides the base Reset to reset the m_currentLow to m_preset
          */
@@ -1624,6 +2040,13 @@ namespace DSL
         
         ~NewHighOdeTrigger();
 
+        /**
+         * @brief New High Triggers keep no state shared with other Triggers and
+         * are source-partitionable if all of their child components are.
+         * @return true if source-partitionable, false otherwise.
+         */
+        bool IsSourcePartitionable(){return ChildrenAreSourcePartitionable();};
+
         /**
          * @brief Overrides the base Reset to reset the m_currentHigh to m_preset
          */
@@ -1722,6 +2145,12 @@ namespace DSL
          */
         void SetClassIdAB(uint classIdA, uint classIdB);
 
+        /**
+         * @brief Overrides the base GetDispatchFilter to report the Class A 
+         * filter when A-A testing, and no Class filter when A-B testing.
+         */
+        bool GetDispatchFilter(int* sourceId, int* classId, int* inferId);
+
     protected:
 
         /**
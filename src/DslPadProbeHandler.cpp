@@ -26,6 +26,12 @@ THE SOFTWARE.
 #include "DslPadProbeHandler.h"
 #include "DslBase.h"
 #include "DslBintr.h"
+#include "DslTimerWheel.h"
+
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
 
 namespace DSL
 {
@@ -180,9 +186,17 @@ namespace DSL
         : PadProbeHandler(name)
         , m_nextTriggerIndex(0)
         , m_displayMetaAllocSize(1)
+        , m_dispatchIndexDirty(true)
+        , m_dispatchGeneration(0)
+        , m_parallelFrames(0)
+        , m_pWorkerPool(NULL)
+        , m_frameWorkPending(0)
     {
         LOG_FUNC();
         
+        g_mutex_init(&m_frameWorkMutex);
+        g_cond_init(&m_frameWorkCond);
+        
         // Enable now
         if (!SetEnabled(true))
         {
@@ -193,6 +207,14 @@ namespace DSL
     OdePadProbeHandler::~OdePadProbeHandler()
     {
         LOG_FUNC();
+        
+        if (m_pWorkerPool)
+        {
+            // wait for all workers to finish
+            g_thread_pool_free(m_pWorkerPool, FALSE, TRUE);
+        }
+        g_cond_clear(&m_frameWorkCond);
+        g_mutex_clear(&m_frameWorkMutex);
     }
 
     bool OdePadProbeHandler::AddChild(DSL_BASE_PTR pChild)
@@ -210,6 +232,7 @@ namespace DSL
 
         // Add the child to the Indexed map 
         m_pChildrenIndexed[m_nextTriggerIndex] = pChild;
+        m_dispatchIndexDirty = true;
         
         return true;
     }
@@ -226,6 +249,7 @@ namespace DSL
         
         // Remove the the child from Indexed map
         m_pChildrenIndexed.erase(pChild->GetIndex());
+        m_dispatchIndexDirty = true;
         
         return true;
     }
@@ -239,6 +263,7 @@ namespace DSL
         
         // Remove all children from Indexed map
         m_pChildrenIndexed.clear();
+        m_dispatchIndexDirty = true;
     }
 
     uint OdePadProbeHandler::GetDisplayMetaAllocSize()
@@ -256,6 +281,121 @@ namespace DSL
         m_displayMetaAllocSize = size;
     }
     
+    uint OdePadProbeHandler::GetParallelFrames()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        return m_parallelFrames;
+    }
+    
+    bool OdePadProbeHandler::SetParallelFrames(uint workers)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        if (m_parallelFrames == workers)
+        {
+            return true;
+        }
+        // Safe to free, the streaming thread holds the handler mutex
+        // for the full duration of each batch.
+        if (m_pWorkerPool)
+        {
+            g_thread_pool_free(m_pWorkerPool, FALSE, TRUE);
+            m_pWorkerPool = NULL;
+        }
+        if (workers)
+        {
+            GError* error(NULL);
+            
+            m_pWorkerPool = g_thread_pool_new(OdeFrameWorkHandler, 
+                this, workers, TRUE, &error);
+            if (!m_pWorkerPool)
+            {
+                LOG_ERROR("ODE Handler '" << GetName() 
+                    << "' failed to create worker pool: " << error->message);
+                g_error_free(error);
+                m_parallelFrames = 0;
+                m_dispatchIndexDirty = true;
+                return false;
+            }
+        }
+        m_parallelFrames = workers;
+        m_dispatchIndexDirty = true;
+        
+        return true;
+    }
+    
+    void OdePadProbeHandler::rebuildDispatchIndex()
+    {
+        LOG_FUNC();
+        // internal - m_padHandlerMutex is held by the caller
+        
+        // Read the generation first so that a filter update made while 
+        // rebuilding will trigger another rebuild on the next batch.
+        m_dispatchGeneration = OdeTrigger::s_dispatchGeneration;
+        m_dispatchIndexDirty = false;
+        
+        m_dispatchEntries.clear();
+        m_partitionedEntries.clear();
+        m_dispatchIndex.clear();
+        
+        for (const auto &imap: m_pChildrenIndexed)
+        {
+            DispatchEntry entry{0};
+            entry.pTrigger = std::dynamic_pointer_cast<OdeTrigger>(imap.second).get();
+            
+            // If a Source or Infer name can't be resolved yet, the Trigger is
+            // indexed as "any" and checks its own filter. The dispatch 
+            // generation is bumped when a Source or Infer name is registered
+            // or erased, so the index is only rebuilt when the name changes.
+            entry.pTrigger->GetDispatchFilter(&entry.sourceId, 
+                &entry.classId, &entry.inferId);
+            // Source-partitionable Triggers filtering on a single Source are 
+            // run on the workers if enabled. All other Triggers - including 
+            // those with a source-set filter - are run serially.
+            if (m_pWorkerPool and entry.sourceId != -1 and 
+                entry.pTrigger->IsSourcePartitionable())
+            {
+                m_partitionedEntries[entry.sourceId].push_back(entry);
+            }
+            else
+            {
+                m_dispatchEntries.push_back(entry);
+            }
+        }
+    }
+    
+    const std::vector<OdeTrigger*>& OdePadProbeHandler::getEligibleTriggers(
+        uint sourceId, int classId, int inferId)
+    {
+        // Do not log function entry
+        
+        DispatchKey key{sourceId, classId, inferId};
+            
+        auto ientry = m_dispatchIndex.find(key);
+        if (ientry != m_dispatchIndex.end())
+        {
+            return ientry->second;
+        }
+        
+        // First object seen with this key since the last rebuild
+        std::vector<OdeTrigger*>& eligibleTriggers = m_dispatchIndex[key];
+        
+        for (const auto &ivec: m_dispatchEntries)
+        {
+            if ((ivec.sourceId == -1 or ivec.sourceId == (int)sourceId) and
+                (ivec.classId == -1 or ivec.classId == classId) and
+                (ivec.inferId == -1 or ivec.inferId == inferId) and
+                ivec.pTrigger->CheckForFilterSets(sourceId, (uint)classId))
+            {
+                eligibleTriggers.push_back(ivec.pTrigger);
+            }
+        }
+        return eligibleTriggers;
+    }
+    
     GstPadProbeReturn OdePadProbeHandler::HandlePadData(GstPadProbeInfo* pInfo)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
@@ -264,10 +404,19 @@ namespace DSL
         {
             return GST_PAD_PROBE_OK;
         }
+        
+        // Rebuild on Trigger add/remove or on Trigger filter update. 
+        if (m_dispatchIndexDirty or 
+            m_dispatchGeneration != OdeTrigger::s_dispatchGeneration)
+        {
+            rebuildDispatchIndex();
+        }
         GstBuffer* pBuffer = (GstBuffer*)pInfo->data;
         
         NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
         
+        m_batchFrames.clear();
+        
         // For each frame in the batched meta data
         for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
             pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
@@ -276,77 +425,232 @@ namespace DSL
             NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*) (pFrameMetaList->data);
             if (pFrameMeta != NULL)
             {
-                std::vector<NvDsDisplayMeta*> displayMetaData;
-                displayMetaData.reserve(m_displayMetaAllocSize);
-                
-                for (auto i=0; i<m_displayMetaAllocSize; i++)
+                m_batchFrames.push_back(pFrameMeta);
+            }
+        }
+        if (m_batchDisplayMeta.size() < m_batchFrames.size())
+        {
+            m_batchDisplayMeta.resize(m_batchFrames.size());
+        }
+        for (uint i=0; i<m_batchFrames.size(); i++)
+        {
+            // Display meta is acquired on demand, as each Trigger/Action(s) 
+            // adds meta, up to m_displayMetaAllocSize structures per frame.
+            DisplayMetaAllocator::Reset(m_batchDisplayMeta[i], m_displayMetaAllocSize);
+        }
+        
+        // Source-partitioned Triggers first, in parallel if enabled.
+        if (m_partitionedEntries.size())
+        {
+            processPartitionedFrames(pBuffer);
+        }
+        
+        // Followed by all serial Triggers, one frame after another.
+        for (uint i=0; i<m_batchFrames.size(); i++)
+        {
+            processFrame(pBuffer, m_batchDisplayMeta[i], m_batchFrames[i]);
+            
+            // Add the display data acquired for the frame, if any.
+            for (const auto & ivec: m_batchDisplayMeta[i])
+            {
+                if (ivec)
                 {
-                    // Acquire new Display meta for this frame, with each Trigger/Action(s)
-                    // adding meta as needed
-                    NvDsDisplayMeta* pDisplayMeta = 
-                        nvds_acquire_display_meta_from_pool(pBatchMeta);
-                    displayMetaData.push_back(pDisplayMeta);
+                    nvds_add_display_meta_to_frame(m_batchFrames[i], ivec);
                 }
-                // Preprocess the frame
-                for (const auto &imap: m_pChildrenIndexed)
+            }
+        }
+        return GST_PAD_PROBE_OK;
+    }
+
+    void OdePadProbeHandler::processFrame(GstBuffer* pBuffer,
+        std::vector<NvDsDisplayMeta*>& displayMetaData, NvDsFrameMeta* pFrameMeta)
+    {
+        // Do not log function entry - m_padHandlerMutex is held by the caller
+        
+        // Preprocess the frame
+        for (const auto &ivec: m_dispatchEntries)
+        {
+            ivec.pTrigger->PreProcessFrame(pBuffer, displayMetaData, pFrameMeta);
+        }
+
+        NvDsMetaList* pNextMeta = pFrameMeta->obj_meta_list;
+        
+        // For each detected object in the frame.
+        while (pNextMeta != NULL)
+        {
+            NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*) (pNextMeta->data);
+
+            // We need to advance the pointer now in case the object is removed
+            // from the frame meta by an action which will null the pObjectMeta 
+            // making pNextMeta in an invalid state an unable to increment. 
+            pNextMeta = pNextMeta->next;
+
+            if (pObjectMeta == NULL)
+            {
+                continue;
+            }
+            
+            // For each ODE Trigger owned by this ODE Manager that can be met
+            // by the object's source, class, and infer ids, check for ODE
+            for (const auto &ivec: getEligibleTriggers(pFrameMeta->source_id,
+                pObjectMeta->class_id, pObjectMeta->unique_component_id))
+            {
+                // check for valid object meta as it may have be nulled by
+                // a trigger with a remove action
+                if (pObjectMeta != NULL)
                 {
-                    DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                        std::dynamic_pointer_cast<OdeTrigger>(imap.second);
-                    pOdeTrigger->PreProcessFrame(pBuffer, displayMetaData, pFrameMeta);
+                    try
+                    {
+                        ivec->CheckForOccurrence(pBuffer, 
+                            displayMetaData, pFrameMeta, pObjectMeta);
+                    }
+                    catch(...)
+                    {
+                        LOG_ERROR("Trigger '" << ivec->GetName() 
+                            << "' threw exception");
+                    }
+                }
+            }
+        }
+        
+        // After each detected object is checked for ODE individually, post process 
+        // each frame for Absence events, Limit events, etc. (i.e. frame level events).
+        for (const auto &ivec: m_dispatchEntries)
+        {
+            ivec.pTrigger->PostProcessFrame(pBuffer, displayMetaData, pFrameMeta);
+        }
+    }
+    
+    void OdePadProbeHandler::processPartitionedFrames(GstBuffer* pBuffer)
+    {
+        // Do not log function entry - m_padHandlerMutex is held by the caller
+        
+        m_frameWork.clear();
+        
+        // Group the frames by Source so that a partitioned Trigger is never
+        // run on two frames at once. There's typically one frame per Source.
+        for (uint i=0; i<m_batchFrames.size(); i++)
+        {
+            uint sourceId = m_batchFrames[i]->source_id;
+            
+            if (m_partitionedEntries.find(sourceId) == m_partitionedEntries.end())
+            {
+                continue;
+            }
+            auto iwork = std::find_if(m_frameWork.begin(), m_frameWork.end(),
+                [sourceId](const OdeFrameWork& work)
+                {
+                    return work.m_sourceId == sourceId;
+                });
+            if (iwork == m_frameWork.end())
+            {
+                m_frameWork.push_back({pBuffer, sourceId, {i}});
+            }
+            else
+            {
+                iwork->m_frameIndices.push_back(i);
+            }
+        }
+        if (m_frameWork.empty())
+        {
+            return;
+        }
+        
+        m_frameWorkPending = m_frameWork.size();
+        
+        // Queue all but the first unit of work - m_frameWork must not be 
+        // resized from this point on - and process the first on this thread.
+        for (uint i=1; i<m_frameWork.size(); i++)
+        {
+            g_thread_pool_push(m_pWorkerPool, &m_frameWork[i], NULL);
+        }
+        HandleFrameWork(&m_frameWork[0]);
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_frameWorkMutex);
+        while (m_frameWorkPending)
+        {
+            g_cond_wait(&m_frameWorkCond, &m_frameWorkMutex);
+        }
+    }
+    
+    void OdePadProbeHandler::HandleFrameWork(OdeFrameWork* pFrameWork)
+    {
+        // Do not log function entry - called for every Source in every batch
+        
+        // Read only while workers are running, m_padHandlerMutex is held by
+        // the streaming thread until all units of work have completed.
+        const std::vector<DispatchEntry>& entries = 
+            m_partitionedEntries.at(pFrameWork->m_sourceId);
+            
+        for (const auto &iframe: pFrameWork->m_frameIndices)
+        {
+            NvDsFrameMeta* pFrameMeta = m_batchFrames[iframe];
+            std::vector<NvDsDisplayMeta*>& displayMetaData = 
+                m_batchDisplayMeta[iframe];
+                
+            try
+            {
+                for (const auto &ivec: entries)
+                {
+                    ivec.pTrigger->PreProcessFrame(pFrameWork->m_pBuffer, 
+                        displayMetaData, pFrameMeta);
                 }
-
                 NvDsMetaList* pNextMeta = pFrameMeta->obj_meta_list;
                 
-                // For each detected object in the frame.
                 while (pNextMeta != NULL)
                 {
                     NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*) (pNextMeta->data);
 
-                    // We need to advance the pointer now in case the object is removed
-                    // from the frame meta by an action which will null the pObjectMeta 
-                    // making pNextMeta in an invalid state an unable to increment. 
+                    // Advance now in case the object is removed by an action
                     pNextMeta = pNextMeta->next;
 
-                    // For each ODE Trigger owned by this ODE Manager, check for ODE
-                    for (const auto &imap: m_pChildrenIndexed)
+                    // The Source filter is common to all entries
+                    for (const auto &ivec: entries)
                     {
-                        // check for valid object meta as it may have be nulled by
-                        // a trigger with a remove action
-                        if (pObjectMeta != NULL)
+                        if (pObjectMeta != NULL and
+                            (ivec.classId == -1 or 
+                                ivec.classId == pObjectMeta->class_id) and
+                            (ivec.inferId == -1 or 
+                                ivec.inferId == pObjectMeta->unique_component_id))
                         {
-                            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                                std::dynamic_pointer_cast<OdeTrigger>(imap.second);
                             try
                             {
-                                pOdeTrigger->CheckForOccurrence(pBuffer, 
+                                ivec.pTrigger->CheckForOccurrence(pFrameWork->m_pBuffer, 
                                     displayMetaData, pFrameMeta, pObjectMeta);
                             }
                             catch(...)
                             {
-                                LOG_ERROR("Trigger '" << pOdeTrigger->GetName() 
+                                LOG_ERROR("Trigger '" << ivec.pTrigger->GetName() 
                                     << "' threw exception");
                             }
                         }
                     }
                 }
-                
-                // After each detected object is checked for ODE individually, post process 
-                // each frame for Absence events, Limit events, etc. (i.e. frame level events).
-                for (const auto &imap: m_pChildrenIndexed)
-                {
-                    DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                        std::dynamic_pointer_cast<OdeTrigger>(imap.second);
-                    pOdeTrigger->PostProcessFrame(pBuffer, displayMetaData, pFrameMeta);
-                }
-                
-                for (const auto & ivec: displayMetaData)
+                for (const auto &ivec: entries)
                 {
-                    // Add the updated display data to the frame
-                    nvds_add_display_meta_to_frame(pFrameMeta, ivec);
+                    ivec.pTrigger->PostProcessFrame(pFrameWork->m_pBuffer, 
+                        displayMetaData, pFrameMeta);
                 }
             }
+            catch(...)
+            {
+                LOG_ERROR("ODE Handler '" << GetName() 
+                    << "' caught exception processing frame for source " 
+                    << pFrameWork->m_sourceId);
+            }
         }
-        return GST_PAD_PROBE_OK;
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_frameWorkMutex);
+        if (--m_frameWorkPending == 0)
+        {
+            g_cond_signal(&m_frameWorkCond);
+        }
+    }
+    
+    static void OdeFrameWorkHandler(gpointer pFrameWork, gpointer pOdeHandler)
+    {
+        static_cast<OdePadProbeHandler*>(pOdeHandler)->HandleFrameWork(
+            static_cast<OdeFrameWork*>(pFrameWork));
     }
 
     //----------------------------------------------------------------------------------------------
@@ -398,7 +702,28 @@ namespace DSL
         : PadProbeHandler(name)
         , m_interval(interval)
         , m_clientHandler(clientHandler)
+        , m_statsHandler(NULL)
+        , m_clientData(clientData)
+        , m_stallThreshold(DSL_SOURCE_METER_DEFAULT_STALL_THRESHOLD)
+        , m_timerId(0)
+    {
+        LOG_FUNC();
+
+        // Enable now
+        if (!SetEnabled(true))
+        {
+            throw;
+        }
+    }
+
+    MeterPadProbeHandler::MeterPadProbeHandler(const char* name, 
+        uint interval, dsl_pph_meter_stats_handler_cb statsHandler, void* clientData)
+        : PadProbeHandler(name)
+        , m_interval(interval)
+        , m_clientHandler(NULL)
+        , m_statsHandler(statsHandler)
         , m_clientData(clientData)
+        , m_stallThreshold(DSL_SOURCE_METER_DEFAULT_STALL_THRESHOLD)
         , m_timerId(0)
     {
         LOG_FUNC();
@@ -416,7 +741,7 @@ namespace DSL
 
         if (m_timerId)
         {
-            g_source_remove(m_timerId);
+            TimerWheel::GetTimerWheel().CancelAndWait(m_timerId);
         }
     }
     
@@ -438,20 +763,22 @@ namespace DSL
             LOG_INFO("Enabling performance measurements for MeterPadProbeHandler '" << GetName() << "'");
 
             // if have Source Meters, i.e we are currently linked, reset each.
-            for (auto const &imap: m_sourceMeters)
+            for (auto const &ivec: m_sourceMeters)
             {
-                imap.second->SessionReset();
-                imap.second->IntervalReset();
+                if (ivec)
+                {
+                    ivec->SessionReset();
+                    ivec->IntervalReset();
+                }
             }
 
             return true;
         }
         LOG_INFO("Disabling performance measurements for MeterPadProbeHandler '" << GetName() << "'");
         
-        if (m_timerId and !g_source_remove(m_timerId))
+        if (m_timerId)
         {
-            LOG_ERROR("Interval-timer shutdown failed for MeterPadProbeHandler '" << GetName() << "' ");
-            return false;
+            TimerWheel::GetTimerWheel().Cancel(m_timerId);
         }
         m_timerId = 0;
         
@@ -480,6 +807,29 @@ namespace DSL
         m_interval = interval;
         return true;
     }
+    
+    uint MeterPadProbeHandler::GetStallThreshold()
+    {
+        LOG_FUNC();
+        
+        return m_stallThreshold;
+    }
+    
+    void MeterPadProbeHandler::SetStallThreshold(uint stallThreshold)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+
+        m_stallThreshold = stallThreshold;
+        
+        for (auto const &ivec: m_sourceMeters)
+        {
+            if (ivec)
+            {
+                ivec->SetStallThreshold(stallThreshold);
+            }
+        }
+    }
 
     GstPadProbeReturn MeterPadProbeHandler::HandlePadData(GstPadProbeInfo* pInfo)
     {
@@ -497,21 +847,31 @@ namespace DSL
         if (!m_timerId)
         {    
             LOG_INFO("Setting interval timer to " << m_interval*1000);
-            m_timerId = g_timeout_add(m_interval*1000, MeterIntervalTimeoutHandler, this);
+            m_timerId = TimerWheel::GetTimerWheel().Schedule(m_interval*1000, 
+                MeterIntervalTimeoutHandler, this);
         }
         try
         {
             for (NvDsMetaList* pFrame = pBatchMeta->frame_meta_list; pFrame; pFrame = pFrame->next)
             {
                 NvDsFrameMeta *pFrameMeta = (NvDsFrameMeta*) pFrame->data;
-                if (m_sourceMeters.find(pFrameMeta->pad_index) == m_sourceMeters.end())
+                uint padIndex = pFrameMeta->pad_index;
+                
+                if (padIndex >= m_sourceMeters.size())
+                {
+                    m_sourceMeters.resize(padIndex+1);
+                }
+                DSL_SOURCE_METER_PTR& pSourceMeter = m_sourceMeters[padIndex];
+                if (!pSourceMeter)
                 {
-                    m_sourceMeters[pFrameMeta->pad_index] = DSL_SOURCE_METER_NEW(pFrameMeta->pad_index);
+                    pSourceMeter = DSL_SOURCE_METER_NEW(padIndex);
+                    pSourceMeter->SetStallThreshold(m_stallThreshold);
                 }
 
-                m_sourceMeters[pFrameMeta->pad_index]->Timestamp();
+                pSourceMeter->Timestamp();
                 // increment the frame counters, calculations will be made based on last timestamp and frame counts.
-                m_sourceMeters[pFrameMeta->pad_index]->IncrementFrameCounts();
+                pSourceMeter->IncrementFrameCounts();
+                pSourceMeter->UpdateFrameNumber(pFrameMeta->frame_num);
             }
         }
         catch(...)
@@ -531,19 +891,39 @@ namespace DSL
         
         std::vector<double> sessionAverages;
         std::vector<double> intervalAverages;
+        std::vector<dsl_meter_source_stats> sourceStats;
 
-        for (auto const &imap: m_sourceMeters)
+        for (auto const &ivec: m_sourceMeters)
         {
-            sessionAverages.push_back(imap.second->GetSessionFpsAvg());
-            intervalAverages.push_back(imap.second->GetIntervalFpsAvg());
-
-            imap.second->IntervalReset();
+            if (!ivec)
+            {
+                continue;
+            }
+            if (m_statsHandler)
+            {
+                dsl_meter_source_stats stats{0};
+                
+                ivec->CheckForStall();
+                ivec->GetIntervalStats(stats);
+                sourceStats.push_back(stats);
+            }
+            else
+            {
+                sessionAverages.push_back(ivec->GetSessionFpsAvg());
+                intervalAverages.push_back(ivec->GetIntervalFpsAvg());
+            }
+            ivec->IntervalReset();
         }
         
         try
         {
-            return m_clientHandler((double*)&sessionAverages[0], (double*)&intervalAverages[0], 
-                (uint)m_sourceMeters.size(), m_clientData);
+            if (m_statsHandler)
+            {
+                return m_statsHandler(sourceStats.data(), 
+                    (uint)sourceStats.size(), m_clientData);
+            }
+            return m_clientHandler(sessionAverages.data(), intervalAverages.data(), 
+                (uint)sessionAverages.size(), m_clientData);
         }
         catch(...)
         {
@@ -555,10 +935,13 @@ namespace DSL
     
     //----------------------------------------------------------------------------------------------
     
-    static int MeterIntervalTimeoutHandler(void* user_data)
+    static uint MeterIntervalTimeoutHandler(void* user_data)
     {
-        return static_cast<MeterPadProbeHandler*>(user_data)->
-            HandleIntervalTimeout();
+        MeterPadProbeHandler* pMeter = 
+            static_cast<MeterPadProbeHandler*>(user_data);
+            
+        return (pMeter->HandleIntervalTimeout()) 
+            ? pMeter->GetInterval()*1000 : 0;
     }
 
     //----------------------------------------------------------------------------------------------
@@ -641,8 +1024,8 @@ namespace DSL
         LOG_FUNC();
         if (m_bufferTimerId)
         {
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
-            g_source_remove(m_bufferTimerId);
+            // Wait for a running check to return - without the mutex held.
+            TimerWheel::GetTimerWheel().CancelAndWait(m_bufferTimerId);
         }
     }
     
@@ -657,14 +1040,16 @@ namespace DSL
 
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
 
+        // A single deadline timer per handler, rescheduled for the time
+        // remaining on each check, rather than polling every 10 ms.
         if (m_isEnabled)
         {
-            m_bufferTimerId = g_timeout_add(10, 
-                buffer_timer_cb, this);
+            m_bufferTimerId = TimerWheel::GetTimerWheel().Schedule(
+                m_timeout*1000, buffer_timer_cb, this);
         }
         else if (m_bufferTimerId)
         {
-            g_source_remove(m_bufferTimerId);
+            TimerWheel::GetTimerWheel().Cancel(m_bufferTimerId);
             m_bufferTimerId = 0;
         }
         return true;
@@ -686,14 +1071,13 @@ namespace DSL
         m_timeout = timeout;
     }
     
-    int BufferTimeoutPadProbeHandler::TimerHanlder()
+    uint BufferTimeoutPadProbeHandler::TimerHanlder()
     {
         // Note - wait to lock the mutex as GetTime will lock it.
         
-        // Get the last buffer time. This timer callback will not be called
-        // until after the timer is started on main-loop run after play 
-        // therefore the lastBufferTime should be non-zero once the first
-        // buffer is received
+        // Get the last buffer time. The lastBufferTime will be zero until
+        // the first buffer is received, in which case check back after
+        // a full timeout period.
         struct timeval lastBufferTime;
         GetTime(lastBufferTime);
 
@@ -707,7 +1091,7 @@ namespace DSL
         {
             LOG_DEBUG("Waiting for first buffer before checking for timeout \\\
                 for Buffer Timer PPH '" << GetName() << "'");
-            return true;
+            return m_timeout*1000;
         }
 
         double timeSinceLastBufferMs = 1000.0*(currentTime.tv_sec - lastBufferTime.tv_sec) + 
@@ -715,8 +1099,8 @@ namespace DSL
 
         if (timeSinceLastBufferMs < (double)m_timeout*1000)
         {
-            // Timeout has not been exceeded, so return true to sleep again
-            return true;
+            // Timeout has not been exceeded, so sleep until the new deadline
+            return (uint)ceil((double)m_timeout*1000 - timeSinceLastBufferMs);
         }
         LOG_INFO("Buffer timeout of " << m_timeout << " seconds exceeded for PPH '" 
             << GetName() << "'");
@@ -736,11 +1120,11 @@ namespace DSL
         m_bufferTimerId = 0;
         m_isEnabled = false;
 
-        // return false to stop the timer.
-        return false;
+        // return 0 to stop the timer.
+        return 0;
     }
 
-    static int buffer_timer_cb(gpointer pPph)
+    static uint buffer_timer_cb(void* pPph)
     {
         return static_cast<BufferTimeoutPadProbeHandler*>(pPph)->
             TimerHanlder();
@@ -748,11 +1132,21 @@ namespace DSL
 
     //----------------------------------------------------------------------------------------------
 
-    EosConsumerPadProbeEventHandler::EosConsumerPadProbeEventHandler(const char* name)
+    LatencyPadProbeHandler::LatencyPadProbeHandler(const char* name)
         : PadProbeHandler(name)
+        , m_stamps(new LatencyStamp[DSL_PPH_LATENCY_STAMP_TABLE_SIZE])
     {
         LOG_FUNC();
         
+        for (uint i = 0; i < DSL_PPH_LATENCY_STAMP_TABLE_SIZE; i++)
+        {
+            m_stamps[i].m_key.store(0, std::memory_order_relaxed);
+            for (auto& time: m_stamps[i].m_times)
+            {
+                time.store(0, std::memory_order_relaxed);
+            }
+        }
+        
         // Enable now
         if (!SetEnabled(true))
         {
@@ -760,52 +1154,579 @@ namespace DSL
         }
     }
 
-    EosConsumerPadProbeEventHandler::~EosConsumerPadProbeEventHandler()
+    LatencyPadProbeHandler::~LatencyPadProbeHandler()
     {
         LOG_FUNC();
     }
     
-    GstPadProbeReturn EosConsumerPadProbeEventHandler::HandlePadData(GstPadProbeInfo* pInfo)
+    bool LatencyPadProbeHandler::AddToParent(DSL_BASE_PTR pParent, uint pad)
     {
+        LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
-
-        if (!m_isEnabled)
+        
+        DSL_BINTR_PTR pParentBintr = 
+            std::dynamic_pointer_cast<Bintr>(pParent);
+            
+        if (m_tracepoints.size() == DSL_PPH_LATENCY_MAX_TRACEPOINTS)
         {
-            return GST_PAD_PROBE_OK;
+            LOG_ERROR("Latency PadProbeHandler '" << GetName() 
+                << "' has the maximum number of trace-points");
+            return false;
         }
+        std::string label = pParentBintr->GetName() + 
+            ((pad == DSL_PAD_SINK) ? ":sink" : ":src");
         
-        GstEvent *event = (GstEvent*)pInfo->data;
-        if (GST_EVENT_TYPE(event) == GST_EVENT_EOS)
+        if (std::find(m_tracepointLabels.begin(), m_tracepointLabels.end(),
+            label) != m_tracepointLabels.end())
         {
-            LOG_INFO("EOS Consumer -- dropping EOS Event");
-            return GST_PAD_PROBE_DROP;
+            LOG_ERROR("Latency PadProbeHandler '" << GetName() 
+                << "' already has a trace-point at '" << label << "'");
+            return false;
         }
-        return GST_PAD_PROBE_OK;
-    }
- 
-    //----------------------------------------------------------------------------------------------
-
-    EosHandlerPadProbeEventHandler::EosHandlerPadProbeEventHandler(const char* name, 
-        dsl_pph_eos_handler_cb clientHandler, void* clientData)
-        : PadProbeHandler(name)
-        , m_clientHandler(clientHandler)
-        , m_clientData(clientData)
-    {
-        LOG_FUNC();
+        std::string tracepointName = GetName() + "-" + label;
         
-        m_clientData = clientData;
-
-        // Enable now
-        if (!SetEnabled(true))
+        DSL_PPH_LATENCY_TRACEPOINT_PTR pTracepoint = 
+            DSL_PPH_LATENCY_TRACEPOINT_NEW(tracepointName.c_str(), 
+                this, m_tracepoints.size());
+        
+        if (!pParentBintr->AddPadProbeHandler(pTracepoint, pad))
         {
-            throw;
+            LOG_ERROR("Failed to add Latency PadProbeHandler '" << GetName() << 
+                "' to Parent '" << pParentBintr->GetName() << "'");
+            return false;
         }
+        if (m_tracepoints.size())
+        {
+            m_segmentNames.push_back(m_tracepointLabels.back() + " -> " + label);
+        }
+        m_tracepoints.push_back(pTracepoint);
+        m_tracepointLabels.push_back(label);
+        
+        // In-use for as long as the tracer has one or more trace-points.
+        AssignParentName(pParentBintr->GetName());
+        
+        LOG_INFO("Latency PadProbeHandler '" << GetName() 
+            << "' added trace-point " << m_tracepoints.size()-1 
+            << " at '" << label << "'");
+        return true;
     }
 
-    EosHandlerPadProbeEventHandler::~EosHandlerPadProbeEventHandler()
+    bool LatencyPadProbeHandler::RemoveFromParent(DSL_BASE_PTR pParent, uint pad)
     {
         LOG_FUNC();
-    }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        DSL_BINTR_PTR pParentBintr = 
+            std::dynamic_pointer_cast<Bintr>(pParent);
+            
+        std::string label = pParentBintr->GetName() + 
+            ((pad == DSL_PAD_SINK) ? ":sink" : ":src");
+
+        auto iter = std::find(m_tracepointLabels.begin(), 
+            m_tracepointLabels.end(), label);
+        if (iter == m_tracepointLabels.end())
+        {
+            LOG_ERROR("Latency PadProbeHandler '" << GetName() 
+                << "' has no trace-point at '" << label << "'");
+            return false;
+        }
+        uint tracepoint = iter - m_tracepointLabels.begin();
+        
+        if (!pParentBintr->RemovePadProbeHandler(m_tracepoints[tracepoint], pad))
+        {
+            LOG_ERROR("Failed to remove Latency PadProbeHandler '" << GetName() << 
+                "' from Parent '" << pParentBintr->GetName() << "'");
+            return false;
+        }
+        m_tracepoints.erase(m_tracepoints.begin() + tracepoint);
+        m_tracepointLabels.erase(iter);
+        
+        // Renumber the downstream trace-points and rebuild the segments.
+        m_segmentNames.clear();
+        for (uint i = 0; i < m_tracepoints.size(); i++)
+        {
+            m_tracepoints[i]->SetTracepoint(i);
+            if (i)
+            {
+                m_segmentNames.push_back(m_tracepointLabels[i-1] + 
+                    " -> " + m_tracepointLabels[i]);
+            }
+        }
+        for (auto& histogram: m_segmentHistograms)
+        {
+            histogram.Reset();
+        }
+        if (m_tracepoints.empty())
+        {
+            ClearParentName();
+        }
+        return true;
+    }
+    
+    uint LatencyPadProbeHandler::GetSegmentCount()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        return m_segmentNames.size();
+    }
+    
+    const char* LatencyPadProbeHandler::GetSegmentName(uint segment)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        if (segment >= m_segmentNames.size())
+        {
+            return "";
+        }
+        return m_segmentNames[segment].c_str();
+    }
+    
+    bool LatencyPadProbeHandler::GetSegmentStats(uint segment, 
+        dsl_latency_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        if (segment >= m_segmentNames.size())
+        {
+            LOG_ERROR("Segment " << segment << " is out of range for Latency " 
+                << "PadProbeHandler '" << GetName() << "'");
+            return false;
+        }
+        LogLinearHistogram& histogram = m_segmentHistograms[segment];
+        
+        stats->count = histogram.GetCount();
+        stats->min = histogram.GetMin();
+        stats->mean = (uint)round(histogram.GetMean());
+        stats->max = histogram.GetMax();
+        stats->p50 = histogram.GetPercentile(50);
+        stats->p90 = histogram.GetPercentile(90);
+        stats->p99 = histogram.GetPercentile(99);
+        
+        return true;
+    }
+    
+    void LatencyPadProbeHandler::ClearStats()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        for (auto& histogram: m_segmentHistograms)
+        {
+            histogram.Reset();
+        }
+    }
+    
+    void LatencyPadProbeHandler::Stamp(uint tracepoint, uint sourceId, 
+        uint64_t pts, int64_t now)
+    {
+        // No function log - avoid overhead.
+        
+        if (!m_isEnabled or tracepoint >= DSL_PPH_LATENCY_MAX_TRACEPOINTS)
+        {
+            return;
+        }
+        // Key 0 is reserved for unused stamps.
+        uint64_t key = ((uint64_t)(sourceId+1) << 48) ^ pts;
+        key = (key) ? key : 1;
+
+        // Fibonacci hash of the key into the stamp table.
+        uint slot = (uint)((key * 0x9E3779B97F4A7C15ULL) >> 32) & 
+            (DSL_PPH_LATENCY_STAMP_TABLE_SIZE - 1);
+        LatencyStamp& stamp = m_stamps[slot];
+        
+        if (tracepoint == 0)
+        {
+            // Claim the stamp, evicting any older frame in the same slot.
+            stamp.m_key.store(0, std::memory_order_relaxed);
+            for (uint i = 1; i < DSL_PPH_LATENCY_MAX_TRACEPOINTS; i++)
+            {
+                stamp.m_times[i].store(0, std::memory_order_relaxed);
+            }
+            stamp.m_times[0].store(now, std::memory_order_relaxed);
+            stamp.m_key.store(key, std::memory_order_release);
+            return;
+        }
+        if (stamp.m_key.load(std::memory_order_acquire) != key)
+        {
+            // Never seen at the first trace-point, or evicted.
+            return;
+        }
+        int64_t previous = stamp.m_times[tracepoint-1].load(
+            std::memory_order_relaxed);
+        if (!previous or now < previous)
+        {
+            return;
+        }
+        stamp.m_times[tracepoint].store(now, std::memory_order_relaxed);
+        m_segmentHistograms[tracepoint-1].Record(now - previous);
+    }
+
+    //----------------------------------------------------------------------------------------------
+
+    LatencyTracepointPadProbeHandler::LatencyTracepointPadProbeHandler(
+        const char* name, LatencyPadProbeHandler* pTracer, uint tracepoint)
+        : PadProbeHandler(name)
+        , m_pTracer(pTracer)
+        , m_tracepoint(tracepoint)
+    {
+        LOG_FUNC();
+        
+        // Enable now - the tracer's enabled setting gates all stamping.
+        if (!SetEnabled(true))
+        {
+            throw;
+        }
+    }
+
+    LatencyTracepointPadProbeHandler::~LatencyTracepointPadProbeHandler()
+    {
+        LOG_FUNC();
+    }
+    
+    void LatencyTracepointPadProbeHandler::SetTracepoint(uint tracepoint)
+    {
+        LOG_FUNC();
+        
+        m_tracepoint.store(tracepoint, std::memory_order_relaxed);
+    }
+
+    GstPadProbeReturn LatencyTracepointPadProbeHandler::HandlePadData(
+        GstPadProbeInfo* pInfo)
+    {
+        // No function log - avoid overhead.
+        
+        GstBuffer* pGstBuffer = (GstBuffer*)pInfo->data;
+        
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pGstBuffer);
+        if (!pBatchMeta)
+        {
+            return GST_PAD_PROBE_OK;
+        }
+        
+        // One monotonic timestamp for all frames in the batch.
+        int64_t now = g_get_monotonic_time();
+        uint tracepoint = m_tracepoint.load(std::memory_order_relaxed);
+        
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+            if (pFrameMeta)
+            {
+                m_pTracer->Stamp(tracepoint, pFrameMeta->source_id,
+                    pFrameMeta->buf_pts, now);
+            }
+        }
+        return GST_PAD_PROBE_OK;
+    }
+
+    //----------------------------------------------------------------------------------------------
+
+    ShmExportPadProbeHandler::ShmExportPadProbeHandler(const char* name,
+        const char* shmName, uint capacity)
+        : PadProbeHandler(name)
+        , m_shmName(shmName)
+        , m_capacity(1)
+        , m_shmSize(0)
+        , m_pHeader(NULL)
+        , m_pRecords(NULL)
+        , m_writeSequence(0)
+        , m_framesWritten(0)
+        , m_recordsWritten(0)
+    {
+        LOG_FUNC();
+        
+        if (!capacity or capacity > DSL_SHM_EXPORT_MAX_CAPACITY)
+        {
+            LOG_ERROR("Invalid capacity " << capacity 
+                << " for ShmExportPadProbeHandler '" << name << "'");
+            throw std::invalid_argument("capacity out of range");
+        }
+        
+        // round up to a power of 2 so the slot is a mask of the sequence.
+        // Bounded by DSL_SHM_EXPORT_MAX_CAPACITY, a power of 2, so can't overflow.
+        while (m_capacity < capacity)
+        {
+            m_capacity <<= 1;
+        }
+        m_shmSize = dsl_shm_export_size(m_capacity);
+        
+        // Exclusive create - never truncate, or later unlink, an object that
+        // is owned by another Handler or process.
+        int fd = shm_open(m_shmName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+        if (fd < 0)
+        {
+            if (errno == EEXIST)
+            {
+                LOG_ERROR("Shared-memory object '" << m_shmName 
+                    << "' already exists for ShmExportPadProbeHandler '" << name 
+                    << "' - remove it from /dev/shm if left by an earlier process");
+            }
+            else
+            {
+                LOG_ERROR("Failed to open shared-memory object '" << m_shmName 
+                    << "' for ShmExportPadProbeHandler '" << name << "'");
+            }
+            throw std::runtime_error("shm_open failed");
+        }
+        if (ftruncate(fd, m_shmSize) < 0)
+        {
+            LOG_ERROR("Failed to size shared-memory object '" << m_shmName 
+                << "' for ShmExportPadProbeHandler '" << name << "'");
+            close(fd);
+            shm_unlink(m_shmName.c_str());
+            throw std::runtime_error("ftruncate failed");
+        }
+        void* pMapping = mmap(NULL, m_shmSize, PROT_READ | PROT_WRITE, 
+            MAP_SHARED, fd, 0);
+            
+        // the mapping holds its own reference to the object.
+        close(fd);
+        
+        if (pMapping == MAP_FAILED)
+        {
+            LOG_ERROR("Failed to map shared-memory object '" << m_shmName 
+                << "' for ShmExportPadProbeHandler '" << name << "'");
+            shm_unlink(m_shmName.c_str());
+            throw std::runtime_error("mmap failed");
+        }
+        
+        // new object, zero-filled by ftruncate - all records start with sequence = 0.
+        m_pHeader = (dsl_shm_export_header*)pMapping;
+        m_pRecords = (dsl_shm_export_record*)(m_pHeader + 1);
+        
+        m_pHeader->version = DSL_SHM_EXPORT_VERSION;
+        m_pHeader->record_size = sizeof(dsl_shm_export_record);
+        m_pHeader->capacity = m_capacity;
+        m_pHeader->write_sequence = 0;
+        
+        // magic is written last so readers never see a partial header.
+        __atomic_store_n(&m_pHeader->magic, DSL_SHM_EXPORT_MAGIC, __ATOMIC_RELEASE);
+        
+        LOG_INFO("ShmExportPadProbeHandler '" << name << "' mapped '" 
+            << m_shmName << "' with capacity " << m_capacity);
+        
+        // Enable now
+        if (!SetEnabled(true))
+        {
+            throw;
+        }
+    }
+
+    ShmExportPadProbeHandler::~ShmExportPadProbeHandler()
+    {
+        LOG_FUNC();
+        
+        munmap(m_pHeader, m_shmSize);
+        shm_unlink(m_shmName.c_str());
+    }
+    
+    const char* ShmExportPadProbeHandler::GetShmName()
+    {
+        LOG_FUNC();
+        
+        return m_shmName.c_str();
+    }
+    
+    uint ShmExportPadProbeHandler::GetCapacity()
+    {
+        LOG_FUNC();
+        
+        return m_capacity;
+    }
+    
+    void ShmExportPadProbeHandler::GetStats(uint64_t* frames, uint64_t* records)
+    {
+        LOG_FUNC();
+        
+        *frames = m_framesWritten.load(std::memory_order_relaxed);
+        *records = m_recordsWritten.load(std::memory_order_relaxed);
+    }
+
+    GstPadProbeReturn ShmExportPadProbeHandler::HandlePadData(
+        GstPadProbeInfo* pInfo)
+    {
+        // No function log - avoid overhead.
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        if (!m_isEnabled)
+        {
+            return GST_PAD_PROBE_OK;
+        }
+        
+        GstBuffer* pGstBuffer = (GstBuffer*)pInfo->data;
+        
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pGstBuffer);
+        if (!pBatchMeta)
+        {
+            return GST_PAD_PROBE_OK;
+        }
+        
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+            if (!pFrameMeta or !pFrameMeta->num_obj_meta)
+            {
+                continue;
+            }
+            uint objectIndex(0);
+            
+            for (NvDsMetaList* pObjectMetaList = pFrameMeta->obj_meta_list; 
+                pObjectMetaList; pObjectMetaList = pObjectMetaList->next)
+            {
+                NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*)(pObjectMetaList->data);
+                if (!pObjectMeta)
+                {
+                    continue;
+                }
+                uint64_t sequence = ++m_writeSequence;
+                dsl_shm_export_record* pRecord = 
+                    &m_pRecords[sequence & (m_capacity - 1)];
+                
+                // invalidate the slot before the payload is overwritten.
+                __atomic_store_n(&pRecord->sequence, 0, __ATOMIC_RELAXED);
+                __atomic_thread_fence(__ATOMIC_RELEASE);
+                
+                pRecord->pts = pFrameMeta->buf_pts;
+                pRecord->tracking_id = pObjectMeta->object_id;
+                pRecord->source_id = pFrameMeta->source_id;
+                pRecord->frame_num = pFrameMeta->frame_num;
+                pRecord->object_index = objectIndex++;
+                pRecord->object_count = pFrameMeta->num_obj_meta;
+                pRecord->class_id = pObjectMeta->class_id;
+                pRecord->confidence = pObjectMeta->confidence;
+                pRecord->left = pObjectMeta->rect_params.left;
+                pRecord->top = pObjectMeta->rect_params.top;
+                pRecord->width = pObjectMeta->rect_params.width;
+                pRecord->height = pObjectMeta->rect_params.height;
+                
+                __atomic_store_n(&pRecord->sequence, sequence, __ATOMIC_RELEASE);
+            }
+            
+            // publish a frame at a time so readers see complete frames.
+            __atomic_store_n(&m_pHeader->write_sequence, 
+                m_writeSequence, __ATOMIC_RELEASE);
+                
+            m_framesWritten.fetch_add(1, std::memory_order_relaxed);
+            m_recordsWritten.store(m_writeSequence, std::memory_order_relaxed);
+        }
+        return GST_PAD_PROBE_OK;
+    }
+
+    //----------------------------------------------------------------------------------------------
+
+    MetaRecorderPadProbeHandler::MetaRecorderPadProbeHandler(const char* name,
+        const char* filePath)
+        : PadProbeHandler(name)
+    {
+        LOG_FUNC();
+        
+        m_pWriter = DSL_META_RECORD_WRITER_NEW(name, filePath);
+        
+        // Enable now
+        if (!SetEnabled(true))
+        {
+            throw;
+        }
+    }
+
+    MetaRecorderPadProbeHandler::~MetaRecorderPadProbeHandler()
+    {
+        LOG_FUNC();
+    }
+    
+    void MetaRecorderPadProbeHandler::GetStats(uint64_t* batches, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        
+        m_pWriter->GetStats(batches, dropped);
+    }
+
+    GstPadProbeReturn MetaRecorderPadProbeHandler::HandlePadData(
+        GstPadProbeInfo* pInfo)
+    {
+        // No function log - avoid overhead.
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        if (!m_isEnabled)
+        {
+            return GST_PAD_PROBE_OK;
+        }
+        
+        GstBuffer* pGstBuffer = (GstBuffer*)pInfo->data;
+        
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pGstBuffer);
+        if (pBatchMeta)
+        {
+            m_pWriter->WriteBatch(pBatchMeta);
+        }
+        return GST_PAD_PROBE_OK;
+    }
+
+    //----------------------------------------------------------------------------------------------
+
+    EosConsumerPadProbeEventHandler::EosConsumerPadProbeEventHandler(const char* name)
+        : PadProbeHandler(name)
+    {
+        LOG_FUNC();
+        
+        // Enable now
+        if (!SetEnabled(true))
+        {
+            throw;
+        }
+    }
+
+    EosConsumerPadProbeEventHandler::~EosConsumerPadProbeEventHandler()
+    {
+        LOG_FUNC();
+    }
+    
+    GstPadProbeReturn EosConsumerPadProbeEventHandler::HandlePadData(GstPadProbeInfo* pInfo)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+
+        if (!m_isEnabled)
+        {
+            return GST_PAD_PROBE_OK;
+        }
+        
+        GstEvent *event = (GstEvent*)pInfo->data;
+        if (GST_EVENT_TYPE(event) == GST_EVENT_EOS)
+        {
+            LOG_INFO("EOS Consumer -- dropping EOS Event");
+            return GST_PAD_PROBE_DROP;
+        }
+        return GST_PAD_PROBE_OK;
+    }
+ 
+    //----------------------------------------------------------------------------------------------
+
+    EosHandlerPadProbeEventHandler::EosHandlerPadProbeEventHandler(const char* name, 
+        dsl_pph_eos_handler_cb clientHandler, void* clientData)
+        : PadProbeHandler(name)
+        , m_clientHandler(clientHandler)
+        , m_clientData(clientData)
+    {
+        LOG_FUNC();
+        
+        m_clientData = clientData;
+
+        // Enable now
+        if (!SetEnabled(true))
+        {
+            throw;
+        }
+    }
+
+    EosHandlerPadProbeEventHandler::~EosHandlerPadProbeEventHandler()
+    {
+        LOG_FUNC();
+    }
     
     GstPadProbeReturn EosHandlerPadProbeEventHandler::HandlePadData(GstPadProbeInfo* pInfo)
     {
@@ -842,6 +1763,9 @@ namespace DSL
         , m_padProbeType(padProbeType)
         , m_pStaticPad(NULL)
         , m_nextHanlderIndex(0)
+        , m_pHandlerList(new PadProbeHandlerList())
+        , m_activeReaders(0)
+        , m_retiredPending(false)
     {
         LOG_FUNC();
         
@@ -864,6 +1788,13 @@ namespace DSL
             }
             gst_object_unref(m_pStaticPad);
         }
+        
+        // probe has been removed, no reader can hold any list at this point.
+        for (auto const& ivec: m_retiredLists)
+        {
+            delete ivec;
+        }
+        delete m_pHandlerList.load();
 
         g_mutex_clear(&m_padProbeMutex);
     }
@@ -904,6 +1835,8 @@ namespace DSL
         // Add the child to the Indexed map 
         m_pChildrenIndexed[m_nextHanlderIndex] = pPadProbeHandler;
         
+        publishHandlerList();
+        
         return true;
         
     }
@@ -924,8 +1857,77 @@ namespace DSL
             return false;
         }
         m_pChildrenIndexed.erase(pPadProbeHandler->GetIndex());
+        
+        publishHandlerList();
+        
         return true;
     }
+    
+    void PadProbetr::publishHandlerList()
+    {
+        LOG_FUNC();
+        
+        PadProbeHandlerList* pNewList = new PadProbeHandlerList();
+        pNewList->m_owners.reserve(m_pChildrenIndexed.size());
+        pNewList->m_handlers.reserve(m_pChildrenIndexed.size());
+        
+        // cast once here so the streaming thread never has to.
+        for (auto const& imap: m_pChildrenIndexed)
+        {
+            DSL_PPH_PTR pPadProbeHandler = 
+                std::dynamic_pointer_cast<PadProbeHandler>(imap.second);
+            pNewList->m_owners.push_back(pPadProbeHandler);
+            pNewList->m_handlers.push_back(pPadProbeHandler.get());
+        }
+        
+        m_retiredLists.push_back(m_pHandlerList.exchange(pNewList));
+        m_retiredPending.store(true);
+        
+        reclaimHandlerLists();
+    }
+    
+    void PadProbetr::reclaimHandlerLists()
+    {
+        // No function log - called from the streaming thread.
+        
+        // Any reader that enters after this point is guaranteed to load the 
+        // current list, so a count of zero means no reader holds a retired list.
+        if (m_retiredLists.empty() or m_activeReaders.load())
+        {
+            return;
+        }
+        for (auto const& ivec: m_retiredLists)
+        {
+            delete ivec;
+        }
+        m_retiredLists.clear();
+        m_retiredPending.store(false);
+    }
+    
+    const PadProbeHandlerList* PadProbetr::AcquireHandlerList()
+    {
+        // No function log - avoid overhead.
+        
+        m_activeReaders.fetch_add(1);
+        return m_pHandlerList.load();
+    }
+    
+    void PadProbetr::ReleaseHandlerList()
+    {
+        // No function log - avoid overhead.
+        
+        if (m_activeReaders.fetch_sub(1) == 1 and 
+            m_retiredPending.load(std::memory_order_relaxed))
+        {
+            // Never block the streaming thread - if a writer holds the mutex
+            // it will reclaim (or defer to the next reader) itself.
+            if (g_mutex_trylock(&m_padProbeMutex))
+            {
+                reclaimHandlerLists();
+                g_mutex_unlock(&m_padProbeMutex);
+            }
+        }
+    }
 
     //----------------------------------------------------------------------------------------------
 
@@ -945,44 +1947,45 @@ namespace DSL
     {
         if ((pInfo->type & GST_PAD_PROBE_TYPE_BUFFER))
         {
-            // list of Pad Probe Handler names that need removal after processing.
+            if (!(GstBuffer*)pInfo->data)
+            {
+                LOG_WARN("Unable to get data buffer for PadProbetr '" << m_name << "'");
+                return GST_PAD_PROBE_OK;
+            }
+            
+            // list of Pad Probe Handlers that need removal after processing.
+            // Only allocates in the rare case that a handler is removed.
             std::vector <DSL_PPH_PTR> removalList;
+            
+            const PadProbeHandlerList* pHandlerList = AcquireHandlerList();
+            
+            for (size_t i = 0; i < pHandlerList->m_handlers.size(); i++)
             {
-                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padProbeMutex);
-        
-                if (!(GstBuffer*)pInfo->data)
+                GstPadProbeReturn retval(GST_PAD_PROBE_OK);
+                try
                 {
-                    LOG_WARN("Unable to get data buffer for PadProbetr '" << m_name << "'");
-                    return GST_PAD_PROBE_OK;
+                    retval = pHandlerList->m_handlers[i]->HandlePadData(pInfo);
                 }
-            
-                for (auto const& imap: m_pChildrenIndexed)
+                catch(...)
                 {
-                    DSL_PPH_PTR pPadProbeHandler = std::dynamic_pointer_cast<PadProbeHandler>(imap.second);
-                    
-                    GstPadProbeReturn retval;
-                    try
-                    {
-                        retval = pPadProbeHandler->HandlePadData(pInfo);
-                    }
-                    catch(...)
-                    {
-                        LOG_ERROR("Exception calling Pad Probe Handler for PadProbetr '" << m_name 
-                            << "' - removing Pad Probe Handler");
-                        removalList.push_back(pPadProbeHandler);
-                    }
-                    if (retval > DSL_PAD_PROBE_REMOVE)
-                    {
-                        LOG_ERROR("Invalid return from Pad Probe Handler for PadProbetr '" << m_name 
-                            << "' - removing Pad Probe Handler");
-                        removalList.push_back(pPadProbeHandler);
-                    }
-                    if (retval == GST_PAD_PROBE_REMOVE)
-                    {
-                        removalList.push_back(pPadProbeHandler);
-                    }
+                    LOG_ERROR("Exception calling Pad Probe Handler for PadProbetr '" << m_name 
+                        << "' - removing Pad Probe Handler");
+                    removalList.push_back(pHandlerList->m_owners[i]);
+                    continue;
+                }
+                if (retval > DSL_PAD_PROBE_REMOVE)
+                {
+                    LOG_ERROR("Invalid return from Pad Probe Handler for PadProbetr '" << m_name 
+                        << "' - removing Pad Probe Handler");
+                    removalList.push_back(pHandlerList->m_owners[i]);
+                }
+                else if (retval == GST_PAD_PROBE_REMOVE)
+                {
+                    removalList.push_back(pHandlerList->m_owners[i]);
                 }
             }
+            ReleaseHandlerList();
+            
             for (auto const& ivec: removalList)
             {
                 RemovePadProbeHandler(ivec);
@@ -1009,39 +2012,42 @@ namespace DSL
     {
         if (pInfo->type & GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM)
         {
-            // list of Pad Probe Handler names that need removal after processing.
+            if (!(GstEvent*)pInfo->data)
+            {
+                LOG_WARN("Unable to get event for PadProbetr '" << m_name << "'");
+                return GST_PAD_PROBE_OK;
+            }
+            
+            // list of Pad Probe Handlers that need removal after processing.
             std::vector <DSL_PPH_PTR> removalList;
+            
+            const PadProbeHandlerList* pHandlerList = AcquireHandlerList();
+            
+            for (size_t i = 0; i < pHandlerList->m_handlers.size(); i++)
             {
-                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padProbeMutex);
-                if (!(GstEvent*)pInfo->data)
+                try
                 {
-                    LOG_WARN("Unable to get event for PadProbetr '" << m_name << "'");
-                    return GST_PAD_PROBE_OK;
-                }
-                
-                for (auto const& imap: m_pChildrenIndexed)
-                {
-                    DSL_PPH_PTR pPadProbeHandler = std::dynamic_pointer_cast<PadProbeHandler>(imap.second);
-                    try
+                    GstPadProbeReturn retval = 
+                        pHandlerList->m_handlers[i]->HandlePadData(pInfo);
+                    if (retval == GST_PAD_PROBE_REMOVE)
                     {
-                        GstPadProbeReturn retval = pPadProbeHandler->HandlePadData(pInfo);
-                        if (retval == GST_PAD_PROBE_REMOVE)
-                        {
-                            LOG_INFO("Removing Pad Probe Handler from PadProbetr '" << m_name << "'");
-                            removalList.push_back(pPadProbeHandler);
-                        }
-                        else if (retval == GST_PAD_PROBE_DROP)
-                        {
-                            return retval;
-                        }
+                        LOG_INFO("Removing Pad Probe Handler from PadProbetr '" << m_name << "'");
+                        removalList.push_back(pHandlerList->m_owners[i]);
                     }
-                    catch(...)
+                    else if (retval == GST_PAD_PROBE_DROP)
                     {
-                        LOG_INFO("Removing Pad Probe Handler for PadProbetr '" << m_name << "'");
-                        removalList.push_back(pPadProbeHandler);
+                        ReleaseHandlerList();
+                        return retval;
                     }
                 }
+                catch(...)
+                {
+                    LOG_INFO("Removing Pad Probe Handler for PadProbetr '" << m_name << "'");
+                    removalList.push_back(pHandlerList->m_owners[i]);
+                }
             }
+            ReleaseHandlerList();
+            
             for (auto const& ivec: removalList)
             {
                 RemovePadProbeHandler(ivec);
@@ -30,6 +30,9 @@ THE SOFTWARE.
 #include "DslElementr.h"
 #include "DslOdeTrigger.h"
 #include "DslSourceMeter.h"
+#include "DslHistogram.h"
+#include "DslShmExport.h"
+#include "DslMetaRecorder.h"
 
 
 namespace DSL
@@ -48,6 +51,9 @@ namespace DSL
     #define DSL_PPH_METER_NEW(name, interval, clientHandler, clientData) \
         std::shared_ptr<MeterPadProbeHandler>(new MeterPadProbeHandler(name, \
             interval, clientHandler, clientData))
+    #define DSL_PPH_METER_STATS_NEW(name, interval, statsHandler, clientData) \
+        std::shared_ptr<MeterPadProbeHandler>(new MeterPadProbeHandler(name, \
+            interval, statsHandler, clientData))
         
     #define DSL_PPH_ODE_PTR std::shared_ptr<OdePadProbeHandler>
     #define DSL_PPH_ODE_NEW(name) \
@@ -62,6 +68,26 @@ namespace DSL
         std::shared_ptr<BufferTimeoutPadProbeHandler>(new BufferTimeoutPadProbeHandler( \
             name, timeout, handler, clientData))
 
+    #define DSL_PPH_LATENCY_PTR std::shared_ptr<LatencyPadProbeHandler>
+    #define DSL_PPH_LATENCY_NEW(name) \
+        std::shared_ptr<LatencyPadProbeHandler>(new LatencyPadProbeHandler(name))
+
+    #define DSL_PPH_LATENCY_TRACEPOINT_PTR \
+        std::shared_ptr<LatencyTracepointPadProbeHandler>
+    #define DSL_PPH_LATENCY_TRACEPOINT_NEW(name, pTracer, tracepoint) \
+        std::shared_ptr<LatencyTracepointPadProbeHandler>( \
+            new LatencyTracepointPadProbeHandler(name, pTracer, tracepoint))
+
+    #define DSL_PPH_SHM_EXPORT_PTR std::shared_ptr<ShmExportPadProbeHandler>
+    #define DSL_PPH_SHM_EXPORT_NEW(name, shmName, capacity) \
+        std::shared_ptr<ShmExportPadProbeHandler>( \
+            new ShmExportPadProbeHandler(name, shmName, capacity))
+
+    #define DSL_PPH_META_RECORDER_PTR std::shared_ptr<MetaRecorderPadProbeHandler>
+    #define DSL_PPH_META_RECORDER_NEW(name, filePath) \
+        std::shared_ptr<MetaRecorderPadProbeHandler>( \
+            new MetaRecorderPadProbeHandler(name, filePath))
+
     #define DSL_PPEH_EOS_CONSUMER_PTR std::shared_ptr<EosConsumerPadProbeEventHandler>
     #define DSL_PPEH_EOS_CONSUMER_NEW(name) \
         std::shared_ptr<EosConsumerPadProbeEventHandler>( \
@@ -104,9 +130,9 @@ namespace DSL
 
         ~PadProbeHandler();
 
-        bool AddToParent(DSL_BASE_PTR pParent, uint pad);
+        virtual bool AddToParent(DSL_BASE_PTR pParent, uint pad);
 
-        bool RemoveFromParent(DSL_BASE_PTR pParent, uint pad);
+        virtual bool RemoveFromParent(DSL_BASE_PTR pParent, uint pad);
         
         /**
          * @brief Gets the current state of the Handler enabled flag
@@ -319,6 +345,31 @@ namespace DSL
     
     //----------------------------------------------------------------------------------------------
 
+    /**
+     * @struct OdeFrameWork
+     * @brief Unit of work for an ODE Pad Probe Handler worker thread: the 
+     * Frames of one Source, within the current batch, to run the Source's 
+     * partitioned ODE Triggers on.
+     */
+    struct OdeFrameWork
+    {
+        /**
+         * @brief pointer to the GST Buffer containing all meta
+         */
+        GstBuffer* m_pBuffer;
+        
+        /**
+         * @brief Source Id of all Frames in this unit of work.
+         */
+        uint m_sourceId;
+        
+        /**
+         * @brief indices of the Frames, in batch order, into the Handler's
+         * per-batch frame and display meta vectors.
+         */
+        std::vector<uint> m_frameIndices;
+    };
+
     /**
      * @class OdePadProbeHandler
      * @brief Pad Probe Handler to Handle a collection ODE triggers
@@ -367,6 +418,30 @@ namespace DSL
          */
         void SetDisplayMetaAllocSize(uint count);
 
+        /**
+         * @brief Gets the number of worker threads used to process the 
+         * Frames of each batch in parallel.
+         * @return number of worker threads, 0 = disabled (default).
+         */
+        uint GetParallelFrames();
+        
+        /**
+         * @brief Sets the number of worker threads used to process the Frames
+         * of each batch in parallel. Source-partitionable ODE Triggers, with a
+         * Source filter, are run on the workers for the Frames of their Source.
+         * All other Triggers are run serially once all workers have completed.
+         * @param[in] workers number of worker threads to use, 0 to disable.
+         * @return true if successful, false otherwise.
+         */
+        bool SetParallelFrames(uint workers);
+
+        /**
+         * @brief Runs the partitioned ODE Triggers for one unit of frame work.
+         * Called by the worker pool, and by the streaming thread for the first unit.
+         * @param[in] pFrameWork unit of work to process.
+         */
+        void HandleFrameWork(OdeFrameWork* pFrameWork);
+
         /**
          * @brief ODE Pad Probe Handler
          * @param[in] pBuffer Pad buffer
@@ -377,6 +452,43 @@ namespace DSL
         
     private:
     
+        /**
+         * @brief rebuilds the list of child ODE Triggers, with the resolved 
+         * Source, Class, and Infer filters for each, and clears the dispatch
+         * index so that it is rebuilt on demand.
+         */
+        void rebuildDispatchIndex();
+        
+        /**
+         * @brief Gets the list of child ODE Triggers - in add-order - whose
+         * filters can be met by an object with the given ids. The list is 
+         * built and added to the dispatch index on first use.
+         * @param[in] sourceId Source Id of the Frame holding the object.
+         * @param[in] classId Class Id of the object.
+         * @param[in] inferId unique component Id of the object.
+         * @return reference to the list of eligible ODE Triggers.
+         */
+        const std::vector<OdeTrigger*>& getEligibleTriggers(uint sourceId, 
+            int classId, int inferId);
+            
+        /**
+         * @brief Runs all serial ODE Triggers - those not partitioned by 
+         * Source - for a single Frame.
+         * @param[in] pBuffer pointer to the GST Buffer containing all meta
+         * @param[in] displayMetaData Display Meta allocated for the Frame.
+         * @param[in] pFrameMeta Frame to process.
+         */
+        void processFrame(GstBuffer* pBuffer,
+            std::vector<NvDsDisplayMeta*>& displayMetaData, NvDsFrameMeta* pFrameMeta);
+
+        /**
+         * @brief Groups the Frames of the current batch by Source and runs the
+         * partitioned ODE Triggers for each group on the worker pool. Returns
+         * once all groups have been processed.
+         * @param[in] pBuffer pointer to the GST Buffer containing all meta
+         */
+        void processPartitionedFrames(GstBuffer* pBuffer);
+    
         /**
          * @brief specifies how many Display Meta structures are allocated for each frame
          */
@@ -392,8 +504,133 @@ namespace DSL
          */
         std::map <uint, DSL_BASE_PTR> m_pChildrenIndexed; 
         
+        /**
+         * @brief ODE Trigger with its Source, Class, and Infer Id filters 
+         * resolved at the time the dispatch index was last rebuilt. -1 = any.
+         */
+        struct DispatchEntry
+        {
+            OdeTrigger* pTrigger;
+            int sourceId;
+            int classId;
+            int inferId;
+        };
+        
+        /**
+         * @brief vector of all serial child ODE Triggers in add-order. 
+         * All child Triggers if parallel frame processing is disabled.
+         */
+        std::vector<DispatchEntry> m_dispatchEntries;
+        
+        /**
+         * @brief map of Source Id to the source-partitionable child ODE 
+         * Triggers, in add-order, filtering on that Source. Empty if 
+         * parallel frame processing is disabled.
+         */
+        std::unordered_map<uint, std::vector<DispatchEntry>> m_partitionedEntries;
+        
+        /**
+         * @brief full-width (source_id, class_id, unique_component_id) key 
+         * for the dispatch index. 
+         */
+        struct DispatchKey
+        {
+            uint sourceId;
+            int classId;
+            int inferId;
+            
+            bool operator==(const DispatchKey& other) const
+            {
+                return sourceId == other.sourceId and 
+                    classId == other.classId and inferId == other.inferId;
+            }
+        };
+        
+        /**
+         * @brief hash functor for the DispatchKey, combining all fields
+         * without truncation.
+         */
+        struct DispatchKeyHash
+        {
+            std::size_t operator()(const DispatchKey& key) const
+            {
+                std::size_t hash = std::hash<uint>()(key.sourceId);
+                hash ^= std::hash<int>()(key.classId) + 0x9e3779b9 + 
+                    (hash << 6) + (hash >> 2);
+                hash ^= std::hash<int>()(key.inferId) + 0x9e3779b9 + 
+                    (hash << 6) + (hash >> 2);
+                return hash;
+            }
+        };
+        
+        /**
+         * @brief dispatch index mapping (source_id, class_id, 
+         * unique_component_id) keys to the child ODE Triggers that can be met. 
+         */
+        std::unordered_map<DispatchKey, 
+            std::vector<OdeTrigger*>, DispatchKeyHash> m_dispatchIndex;
+        
+        /**
+         * @brief true if the dispatch entries need to be rebuilt before the
+         * next batch is processed, i.e. on Trigger add/remove.
+         */
+        bool m_dispatchIndexDirty;
+        
+        /**
+         * @brief value of OdeTrigger::s_dispatchGeneration when the dispatch 
+         * entries were last rebuilt.
+         */
+        uint64_t m_dispatchGeneration;
+        
+        /**
+         * @brief number of worker threads for parallel frame processing.
+         */
+        uint m_parallelFrames;
+        
+        /**
+         * @brief exclusive pool of m_parallelFrames worker threads, 
+         * NULL if parallel frame processing is disabled.
+         */
+        GThreadPool* m_pWorkerPool;
+        
+        /**
+         * @brief valid Frames of the current batch, in batch order.
+         */
+        std::vector<NvDsFrameMeta*> m_batchFrames;
+        
+        /**
+         * @brief Display Meta allocated for each Frame in m_batchFrames.
+         */
+        std::vector<std::vector<NvDsDisplayMeta*>> m_batchDisplayMeta;
+        
+        /**
+         * @brief units of frame work - one per Source - for the current batch.
+         */
+        std::vector<OdeFrameWork> m_frameWork;
+        
+        /**
+         * @brief number of units of frame work not yet completed.
+         */
+        uint m_frameWorkPending;
+        
+        /**
+         * @brief mutex to protect m_frameWorkPending.
+         */
+        GMutex m_frameWorkMutex;
+        
+        /**
+         * @brief condition signaled when m_frameWorkPending reaches 0.
+         */
+        GCond m_frameWorkCond;
     };
     
+    /**
+     * @brief Worker pool function to process a unit of ODE frame work.
+     * @param[in] pFrameWork pointer to the OdeFrameWork to process.
+     * @param[in] pOdeHandler pointer to the owning OdePadProbeHandler.
+     */
+    static void OdeFrameWorkHandler(gpointer pFrameWork, gpointer pOdeHandler);
+    
     //----------------------------------------------------------------------------------------------
     /**
      * @class MeterPadProbeHandler
@@ -407,6 +644,17 @@ namespace DSL
         MeterPadProbeHandler(const char* name, 
             uint interval, dsl_pph_meter_client_handler_cb clientHandler, void* clientData);
 
+        /**
+         * @brief ctor for a Meter Pad Probe Handler that reports frame-interval
+         * statistics for each source.
+         * @param[in] name unique name for the Meter Pad Probe Handler.
+         * @param[in] interval reporting interval in seconds.
+         * @param[in] statsHandler client callback function to call on interval.
+         * @param[in] clientData opaque pointer to client data to return on callback.
+         */
+        MeterPadProbeHandler(const char* name, 
+            uint interval, dsl_pph_meter_stats_handler_cb statsHandler, void* clientData);
+
         /**
          * @brief dtor for the Meter Consumer Pad Probe Handler
          */
@@ -440,6 +688,19 @@ namespace DSL
          */
         bool SetInterval(uint interval);
         
+        /**
+         * @brief gets the current stall threshold for the MeterPadProbeHandler
+         * @return frame interval in milliseconds above which a source is stalled.
+         */
+        uint GetStallThreshold();
+
+        /**
+         * @brief sets the stall threshold for the MeterPadProbeHandler
+         * @param[in] stallThreshold new frame interval in milliseconds above 
+         * which a source is stalled.
+         */
+        void SetStallThreshold(uint stallThreshold);
+        
         /**
          * @brief Interval Timer experation handler
          * @return non-zero (true) to continue, 0 (false) otherwise 
@@ -454,7 +715,7 @@ namespace DSL
         uint m_interval;
         
         /**
-         * @brief gnome timer Id for peformance calculation interval timer
+         * @brief TimerWheel timer Id for peformance calculation interval timer
          */
         uint m_timerId;
         
@@ -463,20 +724,37 @@ namespace DSL
          */
         dsl_pph_meter_client_handler_cb m_clientHandler;
         
+        /**
+         * @brief client callback funtion for frame-interval statistics, 
+         * called on reporting interval if set.
+         */
+        dsl_pph_meter_stats_handler_cb m_statsHandler;
+        
         /**
          * @brief opaue pointer to client data, returned on callback
          */
         void* m_clientData;
         
         /**
-         * @brief map of all current source meters, one per source_id
+         * @brief frame interval in milliseconds above which a source is stalled.
+         */
+        uint m_stallThreshold;
+        
+        /**
+         * @brief vector of all current source meters indexed by pad_index,
+         * avoids a map lookup per frame. Unused indexes hold a nullptr.
          */
-        std::map<uint, DSL_SOURCE_METER_PTR> m_sourceMeters;
+        std::vector<DSL_SOURCE_METER_PTR> m_sourceMeters;
     };
 
     //----------------------------------------------------------------------------------------------
 
-    static int MeterIntervalTimeoutHandler(void* user_data);
+    /**
+     * @brief TimerWheel callback for the MeterPadProbeHandler's interval timer.
+     * @param user_data pointer to the MeterPadProbeHandler.
+     * @return the reporting interval in milliseconds to continue, 0 to stop.
+     */
+    static uint MeterIntervalTimeoutHandler(void* user_data);
 
     //----------------------------------------------------------------------------------------------
 
@@ -568,8 +846,10 @@ namespace DSL
         
         /**
          * @brief handles the timer experation to check for new buffer timeout
+         * @return time in milliseconds until the buffer timeout deadline, 
+         * 0 once the timeout has been reported.
          */
-        int TimerHanlder();
+        uint TimerHanlder();
         
     private:
     
@@ -586,7 +866,7 @@ namespace DSL
         void* m_clientData;
         
         /**
-         * @brief gnome timer Id for buffer timeout management 
+         * @brief TimerWheel timer Id for buffer timeout management 
          */
         uint m_bufferTimerId;
         
@@ -595,9 +875,356 @@ namespace DSL
     /**
      * @brief Timer callback for the BufferTimeoutPadProbeHandler.
      * @param pPph shared pointer to BufferTimeoutPadProbeHandler.
-     * @return int true to continue, 0 to self remove
+     * @return time in milliseconds until the next check, 0 to self remove
      */
-    static int buffer_timer_cb(gpointer pPph);
+    static uint buffer_timer_cb(void* pPph);
+
+    //----------------------------------------------------------------------------------------------
+
+    /**
+     * @brief Maximum number of trace-points per Latency PPH.
+     */
+    #define DSL_PPH_LATENCY_MAX_TRACEPOINTS 8
+    
+    /**
+     * @brief Number of in-flight frame stamps per Latency PPH, must be a
+     * power of 2. Must exceed the number of frames in-flight between the
+     * first and last trace-point, or stamps will be evicted and not measured.
+     */
+    #define DSL_PPH_LATENCY_STAMP_TABLE_SIZE 1024
+
+    /**
+     * @struct LatencyStamp
+     * @brief Monotonic time at which one frame, identified by m_key, passed
+     * each trace-point. A time of 0 indicates not-yet-passed.
+     */
+    struct LatencyStamp
+    {
+        std::atomic<uint64_t> m_key;
+        std::atomic<int64_t> m_times[DSL_PPH_LATENCY_MAX_TRACEPOINTS];
+    };
+
+    class LatencyTracepointPadProbeHandler;
+
+    /**
+     * @class LatencyPadProbeHandler
+     * @brief Implements a latency tracer. Each call to AddToParent creates a
+     * new trace-point child handler on the parent's pad. The time each 
+     * frame spends between two consecutive trace-points is recorded into a
+     * lock-free histogram, one per segment.
+     */
+    class LatencyPadProbeHandler : public PadProbeHandler
+    {
+    public: 
+    
+        /**
+         * @brief ctor for the LatencyPadProbeHandler.
+         * @param[in] name unique name for the LatencyPadProbeHandler.
+         */
+        LatencyPadProbeHandler(const char* name);
+
+        /**
+         * @brief dtor for the LatencyPadProbeHandler.
+         */
+        ~LatencyPadProbeHandler();
+
+        /**
+         * @brief Creates and adds a new trace-point to a parent's pad. 
+         * @param[in] pParent parent Bintr to add the trace-point to.
+         * @param[in] pad one of DSL_PAD_SINK or DSL_PAD_SRC.
+         * @return true on successful add, false otherwise.
+         */
+        bool AddToParent(DSL_BASE_PTR pParent, uint pad);
+
+        /**
+         * @brief Removes a trace-point from a parent's pad. All segment 
+         * statistics are cleared as the segments are redefined.
+         * @param[in] pParent parent Bintr to remove the trace-point from.
+         * @param[in] pad one of DSL_PAD_SINK or DSL_PAD_SRC.
+         * @return true on successful remove, false otherwise.
+         */
+        bool RemoveFromParent(DSL_BASE_PTR pParent, uint pad);
+        
+        /**
+         * @brief Gets the current number of segments.
+         * @return number of trace-points minus one, 0 if none.
+         */
+        uint GetSegmentCount();
+        
+        /**
+         * @brief Gets the name of a segment.
+         * @param[in] segment index of the segment to query.
+         * @return segment name, empty if segment is out of range.
+         */
+        const char* GetSegmentName(uint segment);
+        
+        /**
+         * @brief Gets the latency statistics for a segment.
+         * @param[in] segment index of the segment to query.
+         * @param[out] stats latency statistics in microseconds.
+         * @return true on success, false if segment is out of range.
+         */
+        bool GetSegmentStats(uint segment, dsl_latency_stats* stats);
+        
+        /**
+         * @brief Clears the latency statistics for all segments.
+         */
+        void ClearStats();
+        
+        /**
+         * @brief Stamps a frame with the time it passed a trace-point and,
+         * if not the first trace-point, records the segment latency.
+         * Called by the trace-points on the streaming threads.
+         * @param[in] tracepoint index of the calling trace-point.
+         * @param[in] sourceId source id of the frame.
+         * @param[in] pts buffer PTS of the frame.
+         * @param[in] now monotonic time in microseconds.
+         */
+        void Stamp(uint tracepoint, uint sourceId, uint64_t pts, int64_t now);
+        
+    private:
+    
+        /**
+         * @brief ordered list of trace-points, index = trace-point index.
+         */
+        std::vector<DSL_PPH_LATENCY_TRACEPOINT_PTR> m_tracepoints;
+        
+        /**
+         * @brief "<component>:<pad>" label for each trace-point.
+         */
+        std::vector<std::string> m_tracepointLabels;
+
+        /**
+         * @brief "<label> -> <label>" name for each segment.
+         */
+        std::vector<std::string> m_segmentNames;
+
+        /**
+         * @brief fixed table of in-flight frame stamps, indexed by key hash.
+         */
+        std::unique_ptr<LatencyStamp[]> m_stamps;
+        
+        /**
+         * @brief one histogram per possible segment, allocated on creation
+         * so the streaming threads never see a reallocation.
+         */
+        LogLinearHistogram m_segmentHistograms[DSL_PPH_LATENCY_MAX_TRACEPOINTS-1];
+    };
+    
+    /**
+     * @class LatencyTracepointPadProbeHandler
+     * @brief Trace-point child of a LatencyPadProbeHandler, created and
+     * owned by its tracer. Stamps each batched frame on each buffer.
+     */
+    class LatencyTracepointPadProbeHandler : public PadProbeHandler
+    {
+    public: 
+    
+        /**
+         * @brief ctor for the LatencyTracepointPadProbeHandler.
+         * @param[in] name unique name for the trace-point.
+         * @param[in] pTracer parent tracer to stamp frames with.
+         * @param[in] tracepoint index of this trace-point.
+         */
+        LatencyTracepointPadProbeHandler(const char* name,
+            LatencyPadProbeHandler* pTracer, uint tracepoint);
+
+        /**
+         * @brief dtor for the LatencyTracepointPadProbeHandler.
+         */
+        ~LatencyTracepointPadProbeHandler();
+
+        /**
+         * @brief Sets the index of this trace-point, updated by the
+         * tracer when an upstream trace-point is removed.
+         * @param[in] tracepoint new index for this trace-point.
+         */
+        void SetTracepoint(uint tracepoint);
+
+        /**
+         * @brief Stamps each frame in the batch with the current time.
+         * @param[in] pInfo pad probe info with the batched buffer.
+         * @return always GST_PAD_PROBE_OK.
+         */
+        GstPadProbeReturn HandlePadData(GstPadProbeInfo* pInfo);
+        
+    private:
+    
+        /**
+         * @brief parent tracer, which out-lives all of its trace-points.
+         */
+        LatencyPadProbeHandler* m_pTracer;
+        
+        /**
+         * @brief index of this trace-point.
+         */
+        std::atomic<uint> m_tracepoint;
+    };
+
+    //----------------------------------------------------------------------------------------------
+    /**
+     * @class ShmExportPadProbeHandler
+     * @brief Serializes the object metadata of each batched frame into 
+     * fixed-layout records written to a memory-mapped, multi-reader ring in
+     * /dev/shm. See DslShmExport.h for the layout and reader functions. 
+     */
+    class ShmExportPadProbeHandler : public PadProbeHandler
+    {
+    public: 
+    
+        /**
+         * @brief ctor for the ShmExportPadProbeHandler.
+         * @param[in] name unique name for the ShmExportPadProbeHandler.
+         * @param[in] shmName name of the shared-memory object to create, 
+         * e.g. "/dsl-detections". Any existing object is replaced.
+         * @param[in] capacity number of records in the ring, rounded up 
+         * to the next power of 2.
+         */
+        ShmExportPadProbeHandler(const char* name, 
+            const char* shmName, uint capacity);
+
+        /**
+         * @brief dtor for the ShmExportPadProbeHandler. Unmaps and unlinks
+         * the shared-memory object. Readers with the object mapped are unaffected.
+         */
+        ~ShmExportPadProbeHandler();
+        
+        /**
+         * @brief Gets the name of the shared-memory object in use.
+         * @return name of the shared-memory object.
+         */
+        const char* GetShmName();
+        
+        /**
+         * @brief Gets the number of records in the ring.
+         * @return capacity of the ring, always a power of 2.
+         */
+        uint GetCapacity();
+        
+        /**
+         * @brief Gets the number of frames and records written since creation.
+         * @param[out] frames number of frames with one or more objects written.
+         * @param[out] records number of records written, also the current
+         * write sequence of the ring.
+         */
+        void GetStats(uint64_t* frames, uint64_t* records);
+
+        /**
+         * @brief Writes one record for each object of each frame in the batch.
+         * @param[in] pInfo pad probe info with the batched buffer.
+         * @return always GST_PAD_PROBE_OK.
+         */
+        GstPadProbeReturn HandlePadData(GstPadProbeInfo* pInfo);
+        
+    private:
+    
+        /**
+         * @brief name of the shared-memory object.
+         */
+        std::string m_shmName;
+        
+        /**
+         * @brief number of records in the ring, a power of 2.
+         */
+        uint m_capacity;
+        
+        /**
+         * @brief size of the mapping in bytes.
+         */
+        size_t m_shmSize;
+        
+        /**
+         * @brief mapped ring header, followed by m_capacity records.
+         */
+        dsl_shm_export_header* m_pHeader;
+        
+        /**
+         * @brief first record of the mapped ring.
+         */
+        dsl_shm_export_record* m_pRecords;
+        
+        /**
+         * @brief sequence number of the last record written, only 
+         * updated on the streaming thread.
+         */
+        uint64_t m_writeSequence;
+        
+        /**
+         * @brief number of frames written, for GetStats.
+         */
+        std::atomic<uint64_t> m_framesWritten;
+        
+        /**
+         * @brief number of records written, for GetStats.
+         */
+        std::atomic<uint64_t> m_recordsWritten;
+    };
+
+    //----------------------------------------------------------------------------------------------
+    /**
+     * @class MetaRecorderPadProbeHandler
+     * @brief Records the frame and object metadata of each batch to a compact
+     * Meta Record file, for offline replay with a MetaRecordReader.
+     */
+    class MetaRecorderPadProbeHandler : public PadProbeHandler
+    {
+    public: 
+    
+        /**
+         * @brief ctor for the MetaRecorderPadProbeHandler.
+         * @param[in] name unique name for the MetaRecorderPadProbeHandler.
+         * @param[in] filePath path to the Meta Record file to create.
+         */
+        MetaRecorderPadProbeHandler(const char* name, const char* filePath);
+
+        /**
+         * @brief dtor for the MetaRecorderPadProbeHandler. All queued
+         * records are written before the file is closed.
+         */
+        ~MetaRecorderPadProbeHandler();
+        
+        /**
+         * @brief Gets the number of batches recorded and dropped.
+         * @param[out] batches number of batches recorded.
+         * @param[out] dropped number of batches dropped - writer queue full.
+         */
+        void GetStats(uint64_t* batches, uint64_t* dropped);
+
+        /**
+         * @brief Queues the batch meta for writing.
+         * @param[in] pInfo pad probe info with the batched buffer.
+         * @return always GST_PAD_PROBE_OK.
+         */
+        GstPadProbeReturn HandlePadData(GstPadProbeInfo* pInfo);
+        
+    private:
+    
+        /**
+         * @brief background writer for the Meta Record file.
+         */
+        DSL_META_RECORD_WRITER_PTR m_pWriter;
+    };
+
+    //----------------------------------------------------------------------------------------------
+    /**
+     * @struct PadProbeHandlerList
+     * @brief Immutable snapshot of a PadProbetr's handlers in execution order.
+     * A new list is built on each add/remove and swapped in atomically so that 
+     * the streaming thread can iterate it without locking or casting.
+     */
+    struct PadProbeHandlerList
+    {
+        /**
+         * @brief shared pointers to keep the handlers alive for the life
+         * of the list - not accessed on the streaming thread.
+         */
+        std::vector<DSL_PPH_PTR> m_owners;
+        
+        /**
+         * @brief already-cast handler pointers to iterate on each probe.
+         */
+        std::vector<PadProbeHandler*> m_handlers;
+    };
 
     //----------------------------------------------------------------------------------------------
     /**
@@ -645,6 +1272,36 @@ namespace DSL
         virtual GstPadProbeReturn HandlePadProbe(
             GstPad* pPad, GstPadProbeInfo* pInfo) = 0;
 
+    protected:
+    
+        /**
+         * @brief Enters a read-side critical section and returns the current
+         * handler list. The list remains valid until ReleaseHandlerList is 
+         * called. Lock and allocation free - called on the streaming thread.
+         * @return current list of handlers, never NULL.
+         */
+        const PadProbeHandlerList* AcquireHandlerList();
+        
+        /**
+         * @brief Leaves the read-side critical section entered with
+         * AcquireHandlerList and reclaims any retired lists if possible.
+         */
+        void ReleaseHandlerList();
+        
+    private:
+    
+        /**
+         * @brief Builds a new handler list from m_pChildrenIndexed, swaps it in
+         * and retires the previous list. Must be called with m_padProbeMutex held.
+         */
+        void publishHandlerList();
+        
+        /**
+         * @brief Frees all retired handler lists if no reader is active. 
+         * Must be called with m_padProbeMutex held.
+         */
+        void reclaimHandlerLists();
+        
     protected:
     
         /**
@@ -691,7 +1348,30 @@ namespace DSL
          * @brief Map of child PadProbeHandlers indexed by their add-order for execution
          */
         std::map <uint, DSL_BASE_PTR> m_pChildrenIndexed; 
+        
+    private:
 
+        /**
+         * @brief current list of handlers read by the streaming thread.
+         */
+        std::atomic<PadProbeHandlerList*> m_pHandlerList;
+        
+        /**
+         * @brief number of readers currently in a read-side critical section.
+         */
+        std::atomic<uint> m_activeReaders;
+        
+        /**
+         * @brief lists replaced while a reader was active, freed once no 
+         * reader can hold them. Protected by m_padProbeMutex.
+         */
+        std::vector<PadProbeHandlerList*> m_retiredLists;
+        
+        /**
+         * @brief true if m_retiredLists is not empty - checked by readers
+         * without taking m_padProbeMutex.
+         */
+        std::atomic<bool> m_retiredPending;
     };
 
     //----------------------------------------------------------------------------------------------
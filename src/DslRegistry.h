@@ -0,0 +1,195 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_REGISTRY_H
+#define _DSL_REGISTRY_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @brief Default number of shards for a ShardedRegistry. Lookups of keys
+     * in different shards never contend, and lookups of keys in the same 
+     * shard only contend with a writer to that shard.
+     */
+    #define DSL_REGISTRY_DEFAULT_SHARD_COUNT    16
+
+    /**
+     * @class ShardedRegistry
+     * @brief Implements a read-mostly key-value registry partitioned into 
+     * shards, each a hash table protected by its own reader/writer lock. 
+     * Used for lookups made from streaming threads, which must not wait on
+     * the Services lock while a Pipeline is being linked or reconfigured.
+     */
+    template<typename Key, typename Value>
+    class ShardedRegistry
+    {
+    public:
+    
+        /**
+         * @brief ctor for the ShardedRegistry class
+         * @param[in] shardCount number of shards to partition keys into.
+         */
+        ShardedRegistry(uint shardCount=DSL_REGISTRY_DEFAULT_SHARD_COUNT)
+            : m_shards(std::max(shardCount, 1U))
+        {
+            for (auto& shard: m_shards)
+            {
+                g_rw_lock_init(&shard.m_rwLock);
+            }
+        }
+        
+        /**
+         * @brief dtor for the ShardedRegistry class
+         */
+        ~ShardedRegistry()
+        {
+            for (auto& shard: m_shards)
+            {
+                g_rw_lock_clear(&shard.m_rwLock);
+            }
+        }
+        
+        /**
+         * @brief Finds the value for a key, copying it out under the shard's
+         * reader lock.
+         * @param[in] key key to find.
+         * @param[out] value value for the key if found.
+         * @return true if the key was found, false otherwise.
+         */
+        bool Find(const Key& key, Value& value)
+        {
+            // No function log - called from streaming threads.
+            Shard& shard = shardFor(key);
+            LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&shard.m_rwLock);
+            
+            auto iter = shard.m_map.find(key);
+            if (iter == shard.m_map.end())
+            {
+                return false;
+            }
+            value = iter->second;
+            return true;
+        }
+        
+        /**
+         * @brief Finds the value for a key, returning a pointer to the value
+         * held in the registry. The pointer remains valid until the key is 
+         * erased - i.e. it is not invalidated by inserts into the same shard.
+         * @param[in] key key to find.
+         * @return pointer to the value if found, nullptr otherwise.
+         */
+        const Value* Lookup(const Key& key)
+        {
+            // No function log - called from streaming threads.
+            Shard& shard = shardFor(key);
+            LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&shard.m_rwLock);
+            
+            auto iter = shard.m_map.find(key);
+            return (iter == shard.m_map.end()) ? nullptr : &iter->second;
+        }
+        
+        /**
+         * @brief Queries the registry for a key.
+         * @param[in] key key to find.
+         * @return true if the key exists, false otherwise.
+         */
+        bool Exists(const Key& key)
+        {
+            Shard& shard = shardFor(key);
+            LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&shard.m_rwLock);
+            
+            return shard.m_map.find(key) != shard.m_map.end();
+        }
+        
+        /**
+         * @brief Inserts or replaces the value for a key.
+         * @param[in] key key to set.
+         * @param[in] value new value for the key.
+         */
+        void Set(const Key& key, const Value& value)
+        {
+            Shard& shard = shardFor(key);
+            LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&shard.m_rwLock);
+            
+            shard.m_map[key] = value;
+        }
+        
+        /**
+         * @brief Erases a key and its value from the registry.
+         * @param[in] key key to erase.
+         * @return true if the key was found and erased, false otherwise.
+         */
+        bool Erase(const Key& key)
+        {
+            Shard& shard = shardFor(key);
+            LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&shard.m_rwLock);
+            
+            return shard.m_map.erase(key);
+        }
+        
+        /**
+         * @brief Returns the total number of keys in the registry.
+         * @return number of keys over all shards.
+         */
+        uint Size()
+        {
+            uint size(0);
+            for (auto& shard: m_shards)
+            {
+                LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&shard.m_rwLock);
+                size += shard.m_map.size();
+            }
+            return size;
+        }
+        
+    private:
+    
+        /**
+         * @struct Shard
+         * @brief One partition of the registry.
+         */
+        struct Shard
+        {
+            GRWLock m_rwLock;
+            std::unordered_map<Key, Value> m_map;
+        };
+        
+        /**
+         * @brief Returns the shard for a given key.
+         */
+        Shard& shardFor(const Key& key)
+        {
+            return m_shards[std::hash<Key>()(key) % m_shards.size()];
+        }
+        
+        /**
+         * @brief fixed vector of shards, never resized after construction.
+         */
+        std::vector<Shard> m_shards;
+    };
+}
+
+#endif // _DSL_REGISTRY_H
@@ -185,7 +185,7 @@ namespace DSL
             LOG_ERROR("DSL threw exception intializing Debug Settings");
             throw;
         }
-        g_mutex_init(&m_servicesMutex);
+        g_rw_lock_init(&m_servicesLock);
     }
 
     Services::~Services()
@@ -193,7 +193,7 @@ namespace DSL
         LOG_FUNC();
         
         {
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+            LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
             // Cleanup GEOS
             finishGEOS();
@@ -214,7 +214,7 @@ namespace DSL
                 g_main_loop_unref(m_pMainLoop);
             }
         }
-        g_mutex_clear(&m_servicesMutex);
+        g_rw_lock_clear(&m_servicesLock);
     }
     
     void Services::DeleteAll()
@@ -322,6 +322,7 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_SOURCE_CSI_NOT_SUPPORTED] = L"DSL_RESULT_SOURCE_CSI_NOT_SUPPORTED";
         m_returnValueToString[DSL_RESULT_SOURCE_HANDLER_ADD_FAILED] = L"DSL_RESULT_SOURCE_HANDLER_ADD_FAILED";
         m_returnValueToString[DSL_RESULT_SOURCE_HANDLER_REMOVE_FAILED] = L"DSL_RESULT_SOURCE_HANDLER_REMOVE_FAILED";
+        m_returnValueToString[DSL_RESULT_SOURCE_BUFFER_ACQUIRE_FAILED] = L"DSL_RESULT_SOURCE_BUFFER_ACQUIRE_FAILED";
 
         m_returnValueToString[DSL_RESULT_DEWARPER_NAME_NOT_UNIQUE] = L"DSL_RESULT_DEWARPER_NAME_NOT_UNIQUE";
         m_returnValueToString[DSL_RESULT_DEWARPER_NAME_NOT_FOUND] = L"DSL_RESULT_DEWARPER_NAME_NOT_FOUND";
@@ -352,6 +353,11 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_PPH_ODE_TRIGGER_REMOVE_FAILED] = L"DSL_RESULT_PPH_ODE_TRIGGER_REMOVE_FAILED";
         m_returnValueToString[DSL_RESULT_PPH_ODE_TRIGGER_NOT_IN_USE] = L"DSL_RESULT_PPH_ODE_TRIGGER_NOT_IN_USE";
         m_returnValueToString[DSL_RESULT_PPH_METER_INVALID_INTERVAL] = L"DSL_RESULT_PPH_METER_INVALID_INTERVAL";
+        m_returnValueToString[DSL_RESULT_PPH_PAD_TYPE_INVALID] = L"DSL_RESULT_PPH_PAD_TYPE_INVALID";
+        m_returnValueToString[DSL_RESULT_PPH_LATENCY_SEGMENT_INVALID] = L"DSL_RESULT_PPH_LATENCY_SEGMENT_INVALID";
+        m_returnValueToString[DSL_RESULT_PPH_META_FILE_INVALID] = L"DSL_RESULT_PPH_META_FILE_INVALID";
+        m_returnValueToString[DSL_RESULT_PPH_SHM_EXPORT_PARAMS_INVALID] = L"DSL_RESULT_PPH_SHM_EXPORT_PARAMS_INVALID";
+        m_returnValueToString[DSL_RESULT_PPH_SHM_EXPORT_NAME_IN_USE] = L"DSL_RESULT_PPH_SHM_EXPORT_NAME_IN_USE";
 
         m_returnValueToString[DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE] = L"DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE";
         m_returnValueToString[DSL_RESULT_ODE_TRIGGER_NAME_NOT_FOUND] = L"DSL_RESULT_ODE_TRIGGER_NAME_NOT_FOUND";
@@ -431,6 +437,7 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_SINK_COMPONENT_IS_NOT_ENCODE_SINK] = L"DSL_RESULT_SINK_COMPONENT_IS_NOT_ENCODE_SINK";
         m_returnValueToString[DSL_RESULT_SINK_COMPONENT_IS_NOT_RENDER_SINK] = L"DSL_RESULT_SINK_COMPONENT_IS_NOT_RENDER_SINK";
         m_returnValueToString[DSL_RESULT_SINK_COMPONENT_IS_NOT_MESSAGE_SINK] = L"DSL_RESULT_SINK_COMPONENT_IS_NOT_MESSAGE_SINK";
+        m_returnValueToString[DSL_RESULT_SINK_APP_QUEUE_NOT_ENABLED] = L"DSL_RESULT_SINK_APP_QUEUE_NOT_ENABLED";
         m_returnValueToString[DSL_RESULT_SINK_OBJECT_CAPTURE_CLASS_ADD_FAILED] = L"DSL_RESULT_SINK_OBJECT_CAPTURE_CLASS_ADD_FAILED";
         m_returnValueToString[DSL_RESULT_SINK_OBJECT_CAPTURE_CLASS_REMOVE_FAILED] = L"DSL_RESULT_SINK_OBJECT_CAPTURE_CLASS_REMOVE_FAILED";
         m_returnValueToString[DSL_RESULT_SINK_HANDLER_ADD_FAILED] = L"DSL_RESULT_SINK_HANDLER_ADD_FAILED";
@@ -597,6 +604,18 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_BROKER_DISCONNECT_FAILED] = L"DSL_RESULT_BROKER_DISCONNECT_FAILED";
         m_returnValueToString[DSL_RESULT_BROKER_MESSAGE_SEND_FAILED] = L"DSL_RESULT_BROKER_MESSAGE_SEND_FAILED";
 
+        m_returnValueToString[DSL_RESULT_HANDLE_INVALID] = L"DSL_RESULT_HANDLE_INVALID";
+        m_returnValueToString[DSL_RESULT_HANDLE_TYPE_MISMATCH] = L"DSL_RESULT_HANDLE_TYPE_MISMATCH";
+        m_returnValueToString[DSL_RESULT_HANDLE_THREW_EXCEPTION] = L"DSL_RESULT_HANDLE_THREW_EXCEPTION";
+
+        m_returnValueToString[DSL_RESULT_CONFIG_FILE_NOT_FOUND] = L"DSL_RESULT_CONFIG_FILE_NOT_FOUND";
+        m_returnValueToString[DSL_RESULT_CONFIG_PARSE_FAILED] = L"DSL_RESULT_CONFIG_PARSE_FAILED";
+        m_returnValueToString[DSL_RESULT_CONFIG_ITEM_INVALID] = L"DSL_RESULT_CONFIG_ITEM_INVALID";
+        m_returnValueToString[DSL_RESULT_CONFIG_NAME_NOT_UNIQUE] = L"DSL_RESULT_CONFIG_NAME_NOT_UNIQUE";
+        m_returnValueToString[DSL_RESULT_CONFIG_NAME_NOT_FOUND] = L"DSL_RESULT_CONFIG_NAME_NOT_FOUND";
+        m_returnValueToString[DSL_RESULT_CONFIG_CREATE_FAILED] = L"DSL_RESULT_CONFIG_CREATE_FAILED";
+        m_returnValueToString[DSL_RESULT_CONFIG_THREW_EXCEPTION] = L"DSL_RESULT_CONFIG_THREW_EXCEPTION";
+
         m_returnValueToString[DSL_RESULT_INVALID_RESULT_CODE] = L"Invalid DSL Result CODE";
    }
 
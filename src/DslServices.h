@@ -35,6 +35,9 @@ THE SOFTWARE.
 #include "DslOdeTrigger.h"
 #include "DslPipelineBintr.h"
 #include "DslMessageBroker.h"
+#include "DslRegistry.h"
+#include "DslHandleTable.h"
+#include "DslConfigDocument.h"
 #if !defined(GSTREAMER_SUB_VERSION)
     #error "GSTREAMER_SUB_VERSION must be defined"
 #elif GSTREAMER_SUB_VERSION >= 18
@@ -220,6 +223,12 @@ namespace DSL {
         DslReturnType OdeActionFileNew(const char* name, 
             const char* filePath, uint mode, uint format, boolean forceFlush);
         
+        DslReturnType OdeActionFileRotationGet(const char* name, 
+            uint* maxSize, uint* maxDuration);
+        
+        DslReturnType OdeActionFileRotationSet(const char* name, 
+            uint maxSize, uint maxDuration);
+        
         DslReturnType OdeActionFillSurroundingsNew(const char* name, const char* color);
         
         DslReturnType OdeActionFillFrameNew(const char* name, const char* color);
@@ -435,6 +444,12 @@ namespace DSL {
         
         DslReturnType OdeTriggerSourceSet(const char* name, const char* source);
         
+        DslReturnType OdeTriggerSourcesAdd(const char* name, const char* source);
+        
+        DslReturnType OdeTriggerSourcesRemove(const char* name, const char* source);
+        
+        DslReturnType OdeTriggerSourcesRemoveAll(const char* name);
+        
         DslReturnType OdeTriggerInferGet(const char* name, const char** infer);
         
         DslReturnType OdeTriggerInferSet(const char* name, const char* infer);
@@ -443,6 +458,12 @@ namespace DSL {
         
         DslReturnType OdeTriggerClassIdSet(const char* name, uint classId);
         
+        DslReturnType OdeTriggerClassIdsGet(const char* name, 
+            uint* classIds, uint* size);
+        
+        DslReturnType OdeTriggerClassIdsSet(const char* name, 
+            const uint* classIds, uint size);
+        
         DslReturnType OdeTriggerClassIdABGet(const char* name, 
             uint* classIdA, uint* classIdB);
         
@@ -566,6 +587,12 @@ namespace DSL {
         DslReturnType OdeHeatMapperLegendSettingsSet(const char* name,
             boolean enabled, uint location, uint width, uint height);
 
+        DslReturnType OdeHeatMapperDecayHalfLifeGet(const char* name,
+            uint* halfLife);
+
+        DslReturnType OdeHeatMapperDecayHalfLifeSet(const char* name,
+            uint halfLife);
+
         DslReturnType OdeHeatMapperMetricsClear(const char* name);
 
         DslReturnType OdeHeatMapperMetricsGet(const char* name,
@@ -593,6 +620,36 @@ namespace DSL {
         DslReturnType PphMeterIntervalGet(const char* name, uint* interval);
         
         DslReturnType PphMeterIntervalSet(const char* name, uint interval);
+
+        DslReturnType PphMeterStatsNew(const char* name, uint interval, 
+            dsl_pph_meter_stats_handler_cb statsHandler, void* clientData);
+            
+        DslReturnType PphMeterStallThresholdGet(const char* name, uint* threshold);
+        
+        DslReturnType PphMeterStallThresholdSet(const char* name, uint threshold);
+
+        DslReturnType PphLatencyNew(const char* name);
+        
+        DslReturnType PphLatencySegmentCountGet(const char* name, uint* count);
+        
+        DslReturnType PphLatencySegmentNameGet(const char* name, 
+            uint segment, const char** segmentName);
+        
+        DslReturnType PphLatencySegmentStatsGet(const char* name, 
+            uint segment, dsl_latency_stats* stats);
+        
+        DslReturnType PphLatencyStatsClear(const char* name);
+        
+        DslReturnType PphShmExportNew(const char* name, 
+            const char* shmName, uint capacity);
+        
+        DslReturnType PphShmExportStatsGet(const char* name, 
+            uint64_t* frames, uint64_t* records);
+        
+        DslReturnType PphMetaRecorderNew(const char* name, const char* filePath);
+        
+        DslReturnType PphMetaRecorderStatsGet(const char* name, 
+            uint64_t* batches, uint64_t* dropped);
         
         DslReturnType PphOdeNew(const char* name);
 
@@ -606,6 +663,13 @@ namespace DSL {
 
         DslReturnType PphOdeDisplayMetaAllocSizeSet(const char* name, uint size);
 
+        DslReturnType PphOdeParallelFramesGet(const char* name, uint* workers);
+
+        DslReturnType PphOdeParallelFramesSet(const char* name, uint workers);
+
+        DslReturnType PphOdeMetaReplay(const char* name, 
+            const char* filePath, uint64_t* frames);
+
         DslReturnType PphNmpNew(const char* name, const char* labelFile,
             uint processMethod, uint matchMethod, float matchThreshold);
             
@@ -654,6 +718,19 @@ namespace DSL {
 
         DslReturnType SourceAppSamplePush(const char* name, void* sample);
 
+        DslReturnType SourceAppMemoryPush(const char* name, void* data, 
+            uint size, dsl_source_app_memory_release_cb releaseHandler, 
+            void* clientData);
+
+        DslReturnType SourceAppBufferPoolSizeGet(const char* name, uint* size);
+
+        DslReturnType SourceAppBufferPoolSizeSet(const char* name, uint size);
+
+        DslReturnType SourceAppBufferAcquire(const char* name, 
+            void** buffer, void** data, uint* size);
+
+        DslReturnType SourceAppBufferRelease(const char* name, void* buffer);
+
         DslReturnType SourceAppEos(const char* name);
         
         DslReturnType SourceAppStreamFormatGet(const char* name,
@@ -681,6 +758,15 @@ namespace DSL {
         DslReturnType SourceAppMaxLevelBytesSet(const char* name,
             uint64_t level);
         
+        DslReturnType SourceAppMinLevelPercentGet(const char* name,
+            uint* percent);
+        
+        DslReturnType SourceAppMinLevelPercentSet(const char* name,
+            uint percent);
+        
+        DslReturnType SourceAppDataStateGet(const char* name,
+            uint* state);
+        
 //        DslReturnType SourceAppLeakyTypeGet(const char* name,
 //            uint* leakyType);
 //        
@@ -1112,6 +1198,25 @@ namespace DSL {
 
         DslReturnType SinkAppDataTypeSet(const char* name, uint dataType);
 
+        DslReturnType SinkAppQueuedNew(const char* name, uint dataType,
+            uint maxSize, uint policy);
+        
+        DslReturnType SinkAppQueueSettingsGet(const char* name, 
+            uint* maxSize, uint* policy);
+        
+        DslReturnType SinkAppQueueSettingsSet(const char* name, 
+            uint maxSize, uint policy);
+        
+        DslReturnType SinkAppPullBatch(const char* name, 
+            void** data, uint maxCount, uint* count);
+        
+        DslReturnType SinkAppBatchRelease(void** data, uint count);
+        
+        DslReturnType SinkAppQueueStatsGet(const char* name, 
+            uint* depth, uint* highWater, uint64_t* dropped);
+        
+        DslReturnType SinkAppQueueStatsClear(const char* name);
+
         DslReturnType SinkFakeNew(const char* name);
 
         DslReturnType SinkOverlayNew(const char* name, uint display_id,
@@ -1220,6 +1325,13 @@ namespace DSL {
         DslReturnType SinkWebRtcClientListenerRemove(const char* name,
             dsl_sink_webrtc_client_listener_cb listener);
 
+        DslReturnType SinkWebRtcFanoutNew(const char* name, const char* stunServer, 
+            const char* turnServer, uint codec, uint bitrate, uint interval,
+            uint maxPeers);
+
+        DslReturnType SinkWebRtcFanoutStatsGet(const char* name, uint* peers,
+            uint64_t* droppedBuffers, uint64_t* keyFrameRequests);
+
         DslReturnType SinkPphAdd(const char* name, const char* handler);
 
         DslReturnType SinkPphRemove(const char* name, const char* handler);
@@ -1520,6 +1632,25 @@ namespace DSL {
         
         DslReturnType MailerSendTestMessage(const char* name);
 
+        DslReturnType MailerQueueSettingsGet(const char* name, 
+            uint* maxSize, uint* policy);
+            
+        DslReturnType MailerQueueSettingsSet(const char* name, 
+            uint maxSize, uint policy);
+
+        DslReturnType MailerRateLimitGet(const char* name, uint* maxPerMinute);
+
+        DslReturnType MailerRateLimitSet(const char* name, uint maxPerMinute);
+
+        DslReturnType MailerDigestSettingsGet(const char* name, 
+            uint* window, uint* maxMessages);
+            
+        DslReturnType MailerDigestSettingsSet(const char* name, 
+            uint window, uint maxMessages);
+
+        DslReturnType MailerStatsGet(const char* name, 
+            uint64_t* sent, uint64_t* failed, uint64_t* dropped);
+
         DslReturnType MailerExists(const char* name);
         
         DslReturnType MailerDelete(const char* name);
@@ -1570,6 +1701,115 @@ namespace DSL {
 
         uint MessageBrokerListSize();
         
+        DslReturnType OdeTriggerHandleGet(const char* name, DslHandle* handle);
+        
+        DslReturnType OdeActionHandleGet(const char* name, DslHandle* handle);
+        
+        DslReturnType PphHandleGet(const char* name, DslHandle* handle);
+        
+        DslReturnType SourceHandleGet(const char* name, DslHandle* handle);
+        
+        DslReturnType SinkHandleGet(const char* name, DslHandle* handle);
+        
+        DslReturnType HandleRelease(DslHandle handle);
+        
+        uint HandleListSize();
+        
+        DslReturnType OdeTriggerEnabledGetH(DslHandle handle, boolean* enabled);
+        
+        DslReturnType OdeTriggerEnabledSetH(DslHandle handle, boolean enabled);
+        
+        DslReturnType OdeTriggerLimitEventGetH(DslHandle handle, uint* limit);
+        
+        DslReturnType OdeTriggerLimitEventSetH(DslHandle handle, uint limit);
+        
+        DslReturnType OdeTriggerIntervalGetH(DslHandle handle, uint* interval);
+        
+        DslReturnType OdeTriggerIntervalSetH(DslHandle handle, uint interval);
+        
+        DslReturnType OdeTriggerResetH(DslHandle handle);
+        
+        DslReturnType OdeActionEnabledGetH(DslHandle handle, boolean* enabled);
+        
+        DslReturnType OdeActionEnabledSetH(DslHandle handle, boolean enabled);
+        
+        DslReturnType PphEnabledGetH(DslHandle handle, boolean* enabled);
+        
+        DslReturnType PphEnabledSetH(DslHandle handle, boolean enabled);
+        
+        DslReturnType SourceVideoDimensionsGetH(DslHandle handle, 
+            uint* width, uint* height);
+        
+        DslReturnType SourceFrameRateGetH(DslHandle handle, uint* fpsN, uint* fpsD);
+        
+        DslReturnType SinkSyncEnabledGetH(DslHandle handle, boolean* enabled);
+        
+        DslReturnType SinkSyncEnabledSetH(DslHandle handle, boolean enabled);
+        
+        DslReturnType OdeTriggerSourceGetH(DslHandle handle, const char** source);
+        
+        DslReturnType OdeTriggerSourceSetH(DslHandle handle, const char* source);
+        
+        DslReturnType OdeTriggerInferGetH(DslHandle handle, const char** infer);
+        
+        DslReturnType OdeTriggerInferSetH(DslHandle handle, const char* infer);
+        
+        DslReturnType OdeTriggerClassIdGetH(DslHandle handle, uint* classId);
+        
+        DslReturnType OdeTriggerClassIdSetH(DslHandle handle, uint classId);
+        
+        DslReturnType OdeTriggerLimitFrameGetH(DslHandle handle, uint* limit);
+        
+        DslReturnType OdeTriggerLimitFrameSetH(DslHandle handle, uint limit);
+        
+        DslReturnType OdeTriggerResetTimeoutGetH(DslHandle handle, uint* timeout);
+        
+        DslReturnType OdeTriggerResetTimeoutSetH(DslHandle handle, uint timeout);
+        
+        DslReturnType OdeTriggerConfidenceMinGetH(DslHandle handle, float* minConfidence);
+        
+        DslReturnType OdeTriggerConfidenceMinSetH(DslHandle handle, float minConfidence);
+        
+        DslReturnType OdeTriggerConfidenceMaxGetH(DslHandle handle, float* maxConfidence);
+        
+        DslReturnType OdeTriggerConfidenceMaxSetH(DslHandle handle, float maxConfidence);
+        
+        DslReturnType OdeTriggerTrackerConfidenceMinGetH(DslHandle handle, float* minConfidence);
+        
+        DslReturnType OdeTriggerTrackerConfidenceMinSetH(DslHandle handle, float minConfidence);
+        
+        DslReturnType OdeTriggerTrackerConfidenceMaxGetH(DslHandle handle, float* maxConfidence);
+        
+        DslReturnType OdeTriggerTrackerConfidenceMaxSetH(DslHandle handle, float maxConfidence);
+        
+        DslReturnType OdeTriggerDimensionsMinGetH(DslHandle handle, 
+            float* minWidth, float* minHeight);
+        
+        DslReturnType OdeTriggerDimensionsMinSetH(DslHandle handle, 
+            float minWidth, float minHeight);
+        
+        DslReturnType OdeTriggerDimensionsMaxGetH(DslHandle handle, 
+            float* maxWidth, float* maxHeight);
+        
+        DslReturnType OdeTriggerDimensionsMaxSetH(DslHandle handle, 
+            float maxWidth, float maxHeight);
+        
+        DslReturnType PphMeterIntervalGetH(DslHandle handle, uint* interval);
+        
+        DslReturnType PphMeterIntervalSetH(DslHandle handle, uint interval);
+        
+        DslReturnType PphLatencySegmentStatsGetH(DslHandle handle, 
+            uint segment, dsl_latency_stats* stats);
+        
+        DslReturnType SourceIsLiveH(DslHandle handle, boolean* isLive);
+        
+        DslReturnType SinkAppQueueStatsGetH(DslHandle handle, 
+            uint* depth, uint* highWater, uint64_t* dropped);
+        
+        DslReturnType ConfigFileLoad(const char* filePath);
+        
+        DslReturnType ConfigStringLoad(const char* config);
+        
         void DeleteAll();
         
         DslReturnType InfoInitDebugSettings();
@@ -1596,6 +1836,10 @@ namespace DSL {
         
         DslReturnType InfoLogFunctionRestore();
         
+        DslReturnType InfoLogAsyncEnabledGet(boolean* enabled);
+        
+        DslReturnType InfoLogAsyncEnabledSet(boolean enabled);
+        
         FILE* InfoLogFileHandleGet();
 
         GMainLoop* GetMainLoopHandle()
@@ -1655,6 +1899,16 @@ namespace DSL {
          * @brief called during construction to intialize the NO type Display Types.
          */
         void DisplayTypeCreateIntrinsicTypes();
+
+        /**
+         * @brief called with the Services lock held to validate, create, and 
+         * commit all items of a parsed configuration document as a single
+         * transaction. All changes are undone on failure.
+         * @param[in] document parsed configuration document to apply.
+         * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_CONFIG_RESULT
+         * otherwise.
+         */
+        DslReturnType _configApply(ConfigDocument& document);
         
         std::map <uint, std::wstring> m_returnValueToString;
         
@@ -1679,9 +1933,17 @@ namespace DSL {
         GMainLoop* m_pMainLoop;
             
         /**
-         * @brief mutex to prevent Services reentry
+         * @brief reader/writer lock to prevent Services reentry. Services that
+         * only query the object maps take the shared reader lock so that they
+         * never block one another; all other Services take the writer lock.
         */
-        GMutex m_servicesMutex;
+        GRWLock m_servicesLock;
+        
+        /**
+         * @brief table of client handles for ODE Triggers, ODE Actions, Pad 
+         * Probe Handlers, Sources and Sinks, used by the handle-based Services.
+         */
+        HandleTable m_handles;
 
         /**
          * @brief map of all default intrinsic RGBA Display Types
@@ -1750,24 +2012,26 @@ namespace DSL {
         std::vector<bool> m_usedSourceIds;
         
         /**
-         * @brief container of all unique source Ids mapped by their unique name.
+         * @brief registry of all unique source Ids mapped by their unique name.
+         * Queried without the Services lock - updated under the writer lock.
          */
-        std::map <std::string, uint> m_sourceIdsByName;
+        ShardedRegistry<std::string, uint> m_sourceIdsByName;
         
         /**
-         * @brief container of all unique source names mapped by their unique Id.
+         * @brief registry of all unique source names mapped by their unique Id.
+         * Queried from streaming threads without the Services lock.
          */
-        std::map <uint, std::string> m_sourceNamesById;
+        ShardedRegistry<uint, std::string> m_sourceNamesById;
         
         /**
-         * @brief map of all infer ids to infer names
+         * @brief registry of all infer ids to infer names
          */
-        std::map <uint, std::string> m_inferNames;
+        ShardedRegistry<uint, std::string> m_inferNames;
 
         /**
-         * @brief map of all infer names to infer ids
+         * @brief registry of all infer names to infer ids
          */
-        std::map <std::string, uint> m_inferIds;
+        ShardedRegistry<std::string, uint> m_inferIds;
         
         /**
          * @brief map of all mailer objects by name
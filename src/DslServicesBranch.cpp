@@ -33,7 +33,7 @@ namespace DSL
     DslReturnType Services::BranchNew(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         if (m_components[name])
         {   
@@ -58,7 +58,7 @@ namespace DSL
         const char* component)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, branch);
         DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
 
@@ -95,7 +95,7 @@ namespace DSL
         const char* component)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         try
         {
             DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, branch);
@@ -32,7 +32,7 @@ namespace DSL
     DslReturnType Services::ComponentDelete(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
         
         if (m_components[name]->IsInUse())
@@ -50,7 +50,7 @@ namespace DSL
     DslReturnType Services::ComponentDeleteAll()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -87,7 +87,7 @@ namespace DSL
     uint Services::ComponentListSize()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         return m_components.size();
     }
@@ -95,13 +95,13 @@ namespace DSL
     DslReturnType Services::ComponentGpuIdGet(const char* name, uint* gpuid)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
             DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
             
-            *gpuid = m_components[name]->GetGpuId();
+            *gpuid = m_components.at(name)->GetGpuId();
 
             LOG_INFO("Current GPU ID = " << *gpuid 
                 << " for component '" << name << "'");
@@ -119,7 +119,7 @@ namespace DSL
     DslReturnType Services::ComponentGpuIdSet(const char* name, uint gpuid)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -148,7 +148,7 @@ namespace DSL
 DslReturnType Services::ComponentNvbufMemTypeGet(const char* name, uint* type)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -172,7 +172,7 @@ DslReturnType Services::ComponentNvbufMemTypeGet(const char* name, uint* type)
     DslReturnType Services::ComponentNvbufMemTypeSet(const char* name, uint type)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -0,0 +1,732 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslServices.h"
+#include "DslServicesValidate.h"
+#include "DslSourceBintr.h"
+#include "DslInferBintr.h"
+#include "DslTrackerBintr.h"
+#include "DslTilerBintr.h"
+#include "DslOsdBintr.h"
+#include "DslSinkBintr.h"
+#include "DslPipelineBintr.h"
+#include "DslConfigDocument.h"
+
+#include <functional>
+
+namespace DSL
+{
+    /**
+     * @brief members allowed for each type of each configuration section,
+     * key=section, then key=type. Pipelines have no type.
+     */
+    static const std::vector<ConfigMember> CONFIG_AREA_MEMBERS = 
+    {
+        {"polygon", DSL_CONFIG_MEMBER_STRING, true},
+        {"show", DSL_CONFIG_MEMBER_BOOL, false},
+        {"bbox-test-point", DSL_CONFIG_MEMBER_UINT, false}
+    };
+    
+    static const std::vector<ConfigMember> CONFIG_TRIGGER_MEMBERS = 
+    {
+        {"source", DSL_CONFIG_MEMBER_STRING, false},
+        {"sources", DSL_CONFIG_MEMBER_LIST, false},
+        {"class-id", DSL_CONFIG_MEMBER_UINT, false},
+        {"limit", DSL_CONFIG_MEMBER_UINT, false},
+        {"enabled", DSL_CONFIG_MEMBER_BOOL, false},
+        {"interval", DSL_CONFIG_MEMBER_UINT, false},
+        {"actions", DSL_CONFIG_MEMBER_LIST, false},
+        {"areas", DSL_CONFIG_MEMBER_LIST, false}
+    };
+    
+    static const std::map<std::string, 
+        std::map<std::string, std::vector<ConfigMember>>> CONFIG_MEMBERS = 
+    {
+        {"actions", 
+        {
+            {"print", {{"force-flush", DSL_CONFIG_MEMBER_BOOL, false}}},
+            {"log", {}}
+        }},
+        {"areas", 
+        {
+            {"inclusion", CONFIG_AREA_MEMBERS},
+            {"exclusion", CONFIG_AREA_MEMBERS}
+        }},
+        {"triggers", 
+        {
+            {"occurrence", CONFIG_TRIGGER_MEMBERS},
+            {"absence", CONFIG_TRIGGER_MEMBERS},
+            {"instance", CONFIG_TRIGGER_MEMBERS},
+            {"summation", CONFIG_TRIGGER_MEMBERS}
+        }},
+        {"pphs", 
+        {
+            {"ode", {{"triggers", DSL_CONFIG_MEMBER_LIST, false}}}
+        }},
+        {"components", 
+        {
+            {"uri-source", 
+            {
+                {"uri", DSL_CONFIG_MEMBER_STRING, true},
+                {"is-live", DSL_CONFIG_MEMBER_BOOL, false},
+                {"skip-frames", DSL_CONFIG_MEMBER_UINT, false},
+                {"drop-frame-interval", DSL_CONFIG_MEMBER_UINT, false},
+                {"src-pphs", DSL_CONFIG_MEMBER_LIST, false}
+            }},
+            {"primary-gie", 
+            {
+                {"infer-config-file", DSL_CONFIG_MEMBER_STRING, true},
+                {"model-engine-file", DSL_CONFIG_MEMBER_STRING, false},
+                {"interval", DSL_CONFIG_MEMBER_UINT, false},
+                {"sink-pphs", DSL_CONFIG_MEMBER_LIST, false},
+                {"src-pphs", DSL_CONFIG_MEMBER_LIST, false}
+            }},
+            {"tracker", 
+            {
+                {"config-file", DSL_CONFIG_MEMBER_STRING, false},
+                {"width", DSL_CONFIG_MEMBER_UINT, true},
+                {"height", DSL_CONFIG_MEMBER_UINT, true},
+                {"sink-pphs", DSL_CONFIG_MEMBER_LIST, false},
+                {"src-pphs", DSL_CONFIG_MEMBER_LIST, false}
+            }},
+            {"tiler", 
+            {
+                {"width", DSL_CONFIG_MEMBER_UINT, true},
+                {"height", DSL_CONFIG_MEMBER_UINT, true},
+                {"sink-pphs", DSL_CONFIG_MEMBER_LIST, false},
+                {"src-pphs", DSL_CONFIG_MEMBER_LIST, false}
+            }},
+            {"osd", 
+            {
+                {"text-enabled", DSL_CONFIG_MEMBER_BOOL, false},
+                {"clock-enabled", DSL_CONFIG_MEMBER_BOOL, false},
+                {"bbox-enabled", DSL_CONFIG_MEMBER_BOOL, false},
+                {"mask-enabled", DSL_CONFIG_MEMBER_BOOL, false},
+                {"sink-pphs", DSL_CONFIG_MEMBER_LIST, false},
+                {"src-pphs", DSL_CONFIG_MEMBER_LIST, false}
+            }},
+            {"fake-sink", 
+            {
+                {"sink-pphs", DSL_CONFIG_MEMBER_LIST, false}
+            }},
+            {"window-sink", 
+            {
+                {"offset-x", DSL_CONFIG_MEMBER_UINT, false},
+                {"offset-y", DSL_CONFIG_MEMBER_UINT, false},
+                {"width", DSL_CONFIG_MEMBER_UINT, true},
+                {"height", DSL_CONFIG_MEMBER_UINT, true},
+                {"sink-pphs", DSL_CONFIG_MEMBER_LIST, false}
+            }}
+        }},
+        {"pipelines", 
+        {
+            {"", {{"components", DSL_CONFIG_MEMBER_LIST, false}}}
+        }}
+    };
+
+    DslReturnType Services::ConfigFileLoad(const char* filePath)
+    {
+        LOG_FUNC();
+        
+        // The file is read and parsed before the Services lock is taken
+        std::ifstream configFile(filePath);
+        if (!configFile.good())
+        {
+            LOG_ERROR("Configuration file '" << filePath << "' not found");
+            return DSL_RESULT_CONFIG_FILE_NOT_FOUND;
+        }
+        std::stringstream config;
+        config << configFile.rdbuf();
+        
+        return ConfigStringLoad(config.str().c_str());
+    }
+
+    DslReturnType Services::ConfigStringLoad(const char* config)
+    {
+        LOG_FUNC();
+
+        try
+        {
+            // Parse outside of the Services lock so that other clients are 
+            // only blocked for the validate, create, and commit phases.
+            ConfigDocument document;
+            if (!document.Parse(config))
+            {
+                return DSL_RESULT_CONFIG_PARSE_FAILED;
+            }
+            
+            LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+            
+            DslReturnType result = _configApply(document);
+            if (result == DSL_RESULT_SUCCESS)
+            {
+                LOG_INFO("Configuration of " << document.GetItemCount() 
+                    << " items loaded successfully");
+            }
+            return result;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Configuration threw exception on load");
+            return DSL_RESULT_CONFIG_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::_configApply(ConfigDocument& document)
+    {
+        LOG_FUNC();
+        
+        // called internally with the Services lock held for writing
+        
+        std::vector<ConfigItem>& actionItems = document.GetSection("actions");
+        std::vector<ConfigItem>& areaItems = document.GetSection("areas");
+        std::vector<ConfigItem>& triggerItems = document.GetSection("triggers");
+        std::vector<ConfigItem>& pphItems = document.GetSection("pphs");
+        std::vector<ConfigItem>& componentItems = document.GetSection("components");
+        std::vector<ConfigItem>& pipelineItems = document.GetSection("pipelines");
+        
+        // 1. validate the type and members of every item
+        
+        for (auto& section: ConfigDocument::SECTIONS)
+        {
+            const std::map<std::string, std::vector<ConfigMember>>& types =
+                CONFIG_MEMBERS.at(section);
+                
+            for (auto& item: document.GetSection(section))
+            {
+                if (types.find(item.m_type) == types.end())
+                {
+                    LOG_ERROR("Invalid type '" << item.m_type << "' for " 
+                        << section << " item '" << item.m_name << "'");
+                    return DSL_RESULT_CONFIG_ITEM_INVALID;
+                }
+                if (!item.CheckMembers(types.at(item.m_type)))
+                {
+                    return DSL_RESULT_CONFIG_ITEM_INVALID;
+                }
+            }
+        }
+        
+        // 2. check all names for conflicts before anything is created
+        
+        for (auto& item: actionItems)
+        {
+            if (m_odeActions.find(item.m_name) != m_odeActions.end())
+            {
+                LOG_ERROR("ODE Action name '" << item.m_name << "' is not unique");
+                return DSL_RESULT_CONFIG_NAME_NOT_UNIQUE;
+            }
+        }
+        for (auto& item: areaItems)
+        {
+            if (m_odeAreas.find(item.m_name) != m_odeAreas.end())
+            {
+                LOG_ERROR("ODE Area name '" << item.m_name << "' is not unique");
+                return DSL_RESULT_CONFIG_NAME_NOT_UNIQUE;
+            }
+        }
+        for (auto& item: triggerItems)
+        {
+            if (m_odeTriggers.find(item.m_name) != m_odeTriggers.end())
+            {
+                LOG_ERROR("ODE Trigger name '" << item.m_name << "' is not unique");
+                return DSL_RESULT_CONFIG_NAME_NOT_UNIQUE;
+            }
+        }
+        for (auto& item: pphItems)
+        {
+            if (m_padProbeHandlers.find(item.m_name) != m_padProbeHandlers.end())
+            {
+                LOG_ERROR("Pad Probe Handler name '" << item.m_name 
+                    << "' is not unique");
+                return DSL_RESULT_CONFIG_NAME_NOT_UNIQUE;
+            }
+        }
+        for (auto& item: componentItems)
+        {
+            if (m_components.find(item.m_name) != m_components.end())
+            {
+                LOG_ERROR("Component name '" << item.m_name << "' is not unique");
+                return DSL_RESULT_CONFIG_NAME_NOT_UNIQUE;
+            }
+        }
+        for (auto& item: pipelineItems)
+        {
+            auto iter = m_pipelines.find(item.m_name);
+            if (iter != m_pipelines.end() and iter->second)
+            {
+                LOG_ERROR("Pipeline name '" << item.m_name << "' is not unique");
+                return DSL_RESULT_CONFIG_NAME_NOT_UNIQUE;
+            }
+        }
+        
+        // 3. validate parameters and references. References are resolved
+        // against the items of the document first, and then existing objects.
+        
+        for (auto& item: areaItems)
+        {
+            std::string polygon = item.GetString("polygon");
+            
+            auto iter = m_displayTypes.find(polygon);
+            if (iter == m_displayTypes.end())
+            {
+                LOG_ERROR("Display Type '" << polygon << "' for ODE Area '"
+                    << item.m_name << "' not found");
+                return DSL_RESULT_CONFIG_NAME_NOT_FOUND;
+            }
+            if (!iter->second->IsType(typeid(RgbaPolygon)))
+            {
+                LOG_ERROR("Display Type '" << polygon << "' for ODE Area '"
+                    << item.m_name << "' is not an RGBA Polygon");
+                return DSL_RESULT_CONFIG_ITEM_INVALID;
+            }
+            if (item.GetUint("bbox-test-point", DSL_BBOX_POINT_SOUTH) 
+                > DSL_BBOX_POINT_ANY)
+            {
+                LOG_ERROR("Bounding box test point for ODE Area '" 
+                    << item.m_name << "' is invalid");
+                return DSL_RESULT_CONFIG_ITEM_INVALID;
+            }
+        }
+        
+        auto isInSection = [](std::vector<ConfigItem>& items, 
+            const std::string& name)
+        {
+            for (auto& item: items)
+            {
+                if (item.m_name == name)
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
+        
+        for (auto& item: triggerItems)
+        {
+            for (auto& action: item.GetList("actions"))
+            {
+                if (!isInSection(actionItems, action) and
+                    m_odeActions.find(action) == m_odeActions.end())
+                {
+                    LOG_ERROR("ODE Action '" << action << "' for ODE Trigger '"
+                        << item.m_name << "' not found");
+                    return DSL_RESULT_CONFIG_NAME_NOT_FOUND;
+                }
+            }
+            for (auto& area: item.GetList("areas"))
+            {
+                if (!isInSection(areaItems, area) and
+                    m_odeAreas.find(area) == m_odeAreas.end())
+                {
+                    LOG_ERROR("ODE Area '" << area << "' for ODE Trigger '"
+                        << item.m_name << "' not found");
+                    return DSL_RESULT_CONFIG_NAME_NOT_FOUND;
+                }
+            }
+        }
+        for (auto& item: pphItems)
+        {
+            for (auto& trigger: item.GetList("triggers"))
+            {
+                if (!isInSection(triggerItems, trigger) and
+                    m_odeTriggers.find(trigger) == m_odeTriggers.end())
+                {
+                    LOG_ERROR("ODE Trigger '" << trigger 
+                        << "' for Pad Probe Handler '" << item.m_name 
+                        << "' not found");
+                    return DSL_RESULT_CONFIG_NAME_NOT_FOUND;
+                }
+            }
+        }
+        for (auto& item: componentItems)
+        {
+            std::vector<std::string> pphs = item.GetList("sink-pphs");
+            std::vector<std::string> srcPphs = item.GetList("src-pphs");
+            pphs.insert(pphs.end(), srcPphs.begin(), srcPphs.end());
+            
+            for (auto& pph: pphs)
+            {
+                if (!isInSection(pphItems, pph) and
+                    m_padProbeHandlers.find(pph) == m_padProbeHandlers.end())
+                {
+                    LOG_ERROR("Pad Probe Handler '" << pph 
+                        << "' for Component '" << item.m_name << "' not found");
+                    return DSL_RESULT_CONFIG_NAME_NOT_FOUND;
+                }
+            }
+            
+            // File checks mirror those of the equivalent Services
+            if (item.m_type == "uri-source")
+            {
+                std::string uri = item.GetString("uri");
+                if (uri.find("http") == std::string::npos)
+                {
+                    std::ifstream streamUriFile(uri);
+                    if (item.GetBool("is-live") or !streamUriFile.good())
+                    {
+                        LOG_ERROR("Invalid URI '" << uri << "' for Source '" 
+                            << item.m_name << "'");
+                        return DSL_RESULT_CONFIG_ITEM_INVALID;
+                    }
+                }
+            }
+            else if (item.m_type == "primary-gie")
+            {
+                std::ifstream configFile(item.GetString("infer-config-file"));
+                std::string modelEngineFile(item.GetString("model-engine-file"));
+                std::ifstream modelFile(modelEngineFile);
+                
+                if (!configFile.good() or 
+                    (modelEngineFile.size() and !modelFile.good()))
+                {
+                    LOG_ERROR("Infer Config or Model Engine File not found for "
+                        << "Primary GIE '" << item.m_name << "'");
+                    return DSL_RESULT_CONFIG_ITEM_INVALID;
+                }
+            }
+            else if (item.m_type == "tracker")
+            {
+                std::string trackerConfigFile(item.GetString("config-file"));
+                std::ifstream configFile(trackerConfigFile);
+                
+                if (trackerConfigFile.size() and !configFile.good())
+                {
+                    LOG_ERROR("Tracker Config File not found for Tracker '" 
+                        << item.m_name << "'");
+                    return DSL_RESULT_CONFIG_ITEM_INVALID;
+                }
+            }
+        }
+        for (auto& item: pipelineItems)
+        {
+            for (auto& component: item.GetList("components"))
+            {
+                if (!isInSection(componentItems, component) and
+                    m_components.find(component) == m_components.end())
+                {
+                    LOG_ERROR("Component '" << component << "' for Pipeline '"
+                        << item.m_name << "' not found");
+                    return DSL_RESULT_CONFIG_NAME_NOT_FOUND;
+                }
+            }
+        }
+        
+        // 4. create all objects into staging maps. Nothing is visible to 
+        // the client until the commit phase below.
+        
+        std::map<std::string, DSL_ODE_ACTION_PTR> odeActions;
+        std::map<std::string, DSL_ODE_AREA_PTR> odeAreas;
+        std::map<std::string, DSL_ODE_TRIGGER_PTR> odeTriggers;
+        std::map<std::string, DSL_PPH_PTR> padProbeHandlers;
+        std::map<std::string, std::shared_ptr<Bintr>> components;
+        std::map<std::string, std::shared_ptr<PipelineBintr>> pipelines;
+        
+        for (auto& item: actionItems)
+        {
+            if (item.m_type == "print")
+            {
+                odeActions[item.m_name] = DSL_ODE_ACTION_PRINT_NEW(
+                    item.m_name.c_str(), item.GetBool("force-flush"));
+            }
+            else
+            {
+                odeActions[item.m_name] = DSL_ODE_ACTION_LOG_NEW(
+                    item.m_name.c_str());
+            }
+        }
+        for (auto& item: areaItems)
+        {
+            DSL_RGBA_POLYGON_PTR pPolygon = std::dynamic_pointer_cast<RgbaPolygon>(
+                m_displayTypes[item.GetString("polygon")]);
+            bool show = item.GetBool("show", true);
+            uint bboxTestPoint = item.GetUint("bbox-test-point", 
+                DSL_BBOX_POINT_SOUTH);
+                
+            if (item.m_type == "inclusion")
+            {
+                odeAreas[item.m_name] = DSL_ODE_AREA_INCLUSION_NEW(
+                    item.m_name.c_str(), pPolygon, show, bboxTestPoint);
+            }
+            else
+            {
+                odeAreas[item.m_name] = DSL_ODE_AREA_EXCLUSION_NEW(
+                    item.m_name.c_str(), pPolygon, show, bboxTestPoint);
+            }
+        }
+        for (auto& item: triggerItems)
+        {
+            std::string source = item.GetString("source");
+            uint classId = item.GetUint("class-id", DSL_ODE_ANY_CLASS);
+            uint limit = item.GetUint("limit");
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger;
+            if (item.m_type == "occurrence")
+            {
+                pOdeTrigger = DSL_ODE_TRIGGER_OCCURRENCE_NEW(item.m_name.c_str(), 
+                    source.c_str(), classId, limit);
+            }
+            else if (item.m_type == "absence")
+            {
+                pOdeTrigger = DSL_ODE_TRIGGER_ABSENCE_NEW(item.m_name.c_str(), 
+                    source.c_str(), classId, limit);
+            }
+            else if (item.m_type == "instance")
+            {
+                pOdeTrigger = DSL_ODE_TRIGGER_INSTANCE_NEW(item.m_name.c_str(), 
+                    source.c_str(), classId, limit);
+            }
+            else
+            {
+                pOdeTrigger = DSL_ODE_TRIGGER_SUMMATION_NEW(item.m_name.c_str(), 
+                    source.c_str(), classId, limit);
+            }
+            pOdeTrigger->SetEnabled(item.GetBool("enabled", true));
+            pOdeTrigger->SetInterval(item.GetUint("interval"));
+            for (const auto& source: item.GetList("sources"))
+            {
+                pOdeTrigger->AddSourceToSet(source.c_str());
+            }
+            
+            odeTriggers[item.m_name] = pOdeTrigger;
+        }
+        for (auto& item: pphItems)
+        {
+            padProbeHandlers[item.m_name] = DSL_PPH_ODE_NEW(item.m_name.c_str());
+        }
+        for (auto& item: componentItems)
+        {
+            const char* name = item.m_name.c_str();
+            
+            if (item.m_type == "uri-source")
+            {
+                components[name] = DSL_URI_SOURCE_NEW(name, 
+                    item.GetString("uri").c_str(), item.GetBool("is-live"), 
+                    item.GetUint("skip-frames"), 
+                    item.GetUint("drop-frame-interval"));
+            }
+            else if (item.m_type == "primary-gie")
+            {
+                components[name] = DSL_PRIMARY_GIE_NEW(name, 
+                    item.GetString("infer-config-file").c_str(), 
+                    item.GetString("model-engine-file").c_str(), 
+                    item.GetUint("interval"));
+            }
+            else if (item.m_type == "tracker")
+            {
+                components[name] = DSL_TRACKER_NEW(name, 
+                    item.GetString("config-file").c_str(),
+                    item.GetUint("width"), item.GetUint("height"));
+            }
+            else if (item.m_type == "tiler")
+            {
+                components[name] = DSL_TILER_NEW(name, 
+                    item.GetUint("width"), item.GetUint("height"));
+            }
+            else if (item.m_type == "osd")
+            {
+                components[name] = DSL_OSD_NEW(name, 
+                    item.GetBool("text-enabled", true), 
+                    item.GetBool("clock-enabled", false), 
+                    item.GetBool("bbox-enabled", true), 
+                    item.GetBool("mask-enabled", false));
+            }
+            else if (item.m_type == "fake-sink")
+            {
+                components[name] = DSL_FAKE_SINK_NEW(name);
+            }
+            else
+            {
+                components[name] = DSL_WINDOW_SINK_NEW(name, 
+                    item.GetUint("offset-x"), item.GetUint("offset-y"),
+                    item.GetUint("width"), item.GetUint("height"));
+            }
+        }
+        for (auto& item: pipelineItems)
+        {
+            pipelines[item.m_name] = DSL_PIPELINE_NEW(item.m_name.c_str());
+        }
+        
+        // 5. apply all relationships, recording how to undo each one so that
+        // any existing objects referenced by the document can be restored.
+        
+        std::vector<std::function<void()>> undoLog;
+        
+        auto rollback = [&undoLog](DslReturnType result)
+        {
+            for (auto iter = undoLog.rbegin(); iter != undoLog.rend(); ++iter)
+            {
+                (*iter)();
+            }
+            return result;
+        };
+        
+        try
+        {
+            for (auto& item: triggerItems)
+            {
+                DSL_ODE_TRIGGER_PTR pOdeTrigger = odeTriggers[item.m_name];
+            
+                for (auto& action: item.GetList("actions"))
+                {
+                    DSL_BASE_PTR pOdeAction = 
+                        (odeActions.find(action) != odeActions.end())
+                        ? odeActions[action] : m_odeActions[action];
+                    
+                    std::string parentName(pOdeAction->GetParentName());
+                    uint index(pOdeAction->GetIndex());
+                
+                    if (!pOdeTrigger->AddAction(pOdeAction))
+                    {
+                        LOG_ERROR("ODE Trigger '" << item.m_name
+                            << "' failed to add ODE Action '" << action << "'");
+                        return rollback(DSL_RESULT_CONFIG_CREATE_FAILED);
+                    }
+                    undoLog.push_back([pOdeTrigger, pOdeAction, parentName, index]()
+                    {
+                        pOdeTrigger->RemoveAction(pOdeAction);
+                        pOdeAction->AssignParentName(parentName);
+                        pOdeAction->SetIndex(index);
+                    });
+                }
+                for (auto& area: item.GetList("areas"))
+                {
+                    DSL_BASE_PTR pOdeArea = 
+                        (odeAreas.find(area) != odeAreas.end())
+                        ? odeAreas[area] : m_odeAreas[area];
+                    
+                    std::string parentName(pOdeArea->GetParentName());
+                    uint index(pOdeArea->GetIndex());
+                
+                    if (!pOdeTrigger->AddArea(pOdeArea))
+                    {
+                        LOG_ERROR("ODE Trigger '" << item.m_name
+                            << "' failed to add ODE Area '" << area << "'");
+                        return rollback(DSL_RESULT_CONFIG_CREATE_FAILED);
+                    }
+                    undoLog.push_back([pOdeTrigger, pOdeArea, parentName, index]()
+                    {
+                        pOdeTrigger->RemoveArea(pOdeArea);
+                        pOdeArea->AssignParentName(parentName);
+                        pOdeArea->SetIndex(index);
+                    });
+                }
+            }
+            for (auto& item: pphItems)
+            {
+                DSL_PPH_ODE_PTR pOde = std::dynamic_pointer_cast<OdePadProbeHandler>(
+                    padProbeHandlers[item.m_name]);
+            
+                for (auto& trigger: item.GetList("triggers"))
+                {
+                    DSL_BASE_PTR pOdeTrigger = 
+                        (odeTriggers.find(trigger) != odeTriggers.end())
+                        ? odeTriggers[trigger] : m_odeTriggers[trigger];
+                    
+                    // Can't add Triggers if they're in use by another Handler
+                    if (pOdeTrigger->IsInUse() or !pOde->AddChild(pOdeTrigger))
+                    {
+                        LOG_ERROR("ODE Pad Probe Handler '" << item.m_name
+                            << "' failed to add ODE Trigger '" << trigger << "'");
+                        return rollback(DSL_RESULT_CONFIG_CREATE_FAILED);
+                    }
+                    undoLog.push_back([pOde, pOdeTrigger]()
+                    {
+                        pOde->RemoveChild(pOdeTrigger);
+                    });
+                }
+            }
+            for (auto& item: componentItems)
+            {
+                std::shared_ptr<Bintr> pComponent = components[item.m_name];
+            
+                for (uint pad: {DSL_PAD_SINK, DSL_PAD_SRC})
+                {
+                    for (auto& pph: item.GetList((pad == DSL_PAD_SINK) 
+                        ? "sink-pphs" : "src-pphs"))
+                    {
+                        DSL_PPH_PTR pPph = 
+                            (padProbeHandlers.find(pph) != padProbeHandlers.end())
+                            ? padProbeHandlers[pph] : m_padProbeHandlers[pph];
+                        
+                        if (!pPph->AddToParent(pComponent, pad))
+                        {
+                            LOG_ERROR("Component '" << item.m_name 
+                                << "' failed to add Pad Probe Handler '" << pph << "'");
+                            return rollback(DSL_RESULT_CONFIG_CREATE_FAILED);
+                        }
+                        undoLog.push_back([pPph, pComponent, pad]()
+                        {
+                            pPph->RemoveFromParent(pComponent, pad);
+                        });
+                    }
+                }
+            }
+            for (auto& item: pipelineItems)
+            {
+                std::shared_ptr<PipelineBintr> pPipeline = pipelines[item.m_name];
+            
+                for (auto& component: item.GetList("components"))
+                {
+                    std::shared_ptr<Bintr> pComponent = 
+                        (components.find(component) != components.end())
+                        ? components[component] : m_components[component];
+                
+                    // Can't add components if they're in use by another Pipeline
+                    if (pComponent->IsInUse() or !pComponent->AddToParent(pPipeline))
+                    {
+                        LOG_ERROR("Pipeline '" << item.m_name
+                            << "' failed to add component '" << component << "'");
+                        return rollback(DSL_RESULT_CONFIG_CREATE_FAILED);
+                    }
+                    undoLog.push_back([pComponent, pPipeline]()
+                    {
+                        pComponent->RemoveFromParent(pPipeline);
+                    });
+                }
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Configuration threw exception applying relationships");
+            return rollback(DSL_RESULT_CONFIG_THREW_EXCEPTION);
+        }
+        
+        // 6. commit - batch insert all staged objects into the Services maps.
+        
+        m_odeActions.insert(odeActions.begin(), odeActions.end());
+        m_odeAreas.insert(odeAreas.begin(), odeAreas.end());
+        m_odeTriggers.insert(odeTriggers.begin(), odeTriggers.end());
+        m_padProbeHandlers.insert(padProbeHandlers.begin(), padProbeHandlers.end());
+        m_components.insert(components.begin(), components.end());
+        for (auto& imap: pipelines)
+        {
+            // a previously deleted Pipeline leaves an empty entry behind
+            m_pipelines[imap.first] = imap.second;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+}
@@ -45,7 +45,7 @@ namespace DSL
         double red, double green, double blue, double alpha)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -97,7 +97,7 @@ namespace DSL
         uint colorId, double alpha)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -140,7 +140,7 @@ namespace DSL
         uint hue, uint luminosity, double alpha, uint seed)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -189,7 +189,7 @@ namespace DSL
         dsl_display_type_rgba_color_provider_cb provider, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -219,7 +219,7 @@ namespace DSL
         const char** colors, uint num_colors)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -262,7 +262,7 @@ namespace DSL
         uint paletteId, double alpha)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -322,7 +322,7 @@ namespace DSL
             uint size, uint hue, uint luminosity, double alpha, uint seed)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -402,7 +402,7 @@ namespace DSL
         uint* index)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -432,7 +432,7 @@ namespace DSL
         uint index)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -464,7 +464,7 @@ namespace DSL
     DslReturnType Services::DisplayTypeRgbaColorNextSet(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -492,7 +492,7 @@ namespace DSL
         const char* font, uint size, const char* color)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -527,7 +527,7 @@ namespace DSL
         boolean hasBgColor, const char* bgColor)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -577,7 +577,7 @@ namespace DSL
         uint x1, uint y1, uint x2, uint y2, uint width, const char* color)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -612,7 +612,7 @@ namespace DSL
         uint x1, uint y1, uint x2, uint y2, uint width, uint head, const char* color)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -653,7 +653,7 @@ namespace DSL
         const char* bgColor)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -705,7 +705,7 @@ namespace DSL
         uint borderWidth, const char* color)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -748,7 +748,7 @@ namespace DSL
         uint borderWidth, const char* color)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -792,7 +792,7 @@ namespace DSL
         bool hasBgColor, const char* bgColor)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -843,7 +843,7 @@ namespace DSL
         const char* bgColor)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -896,7 +896,7 @@ namespace DSL
         const char* bgColor)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -948,7 +948,7 @@ namespace DSL
         const char* bgColor)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1000,7 +1000,7 @@ namespace DSL
         const char* bgColor)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1052,7 +1052,7 @@ namespace DSL
         uint xOffset, uint yOffset, const char* color)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1088,7 +1088,7 @@ namespace DSL
         void* pDisplayMeta, void* pFrameMeta)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1112,7 +1112,7 @@ namespace DSL
     DslReturnType Services::DisplayTypeDelete(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1138,7 +1138,7 @@ namespace DSL
     DslReturnType Services::DisplayTypeDeleteAll()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1162,7 +1162,7 @@ namespace DSL
     uint Services::DisplayTypeListSize()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         return m_displayTypes.size();
     }
@@ -0,0 +1,1380 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslServices.h"
+#include "DslServicesValidate.h"
+#include "DslPadProbeHandler.h"
+#include "DslSourceBintr.h"
+#include "DslSinkBintr.h"
+
+namespace DSL
+{
+    DslReturnType Services::OdeTriggerHandleGet(const char* name, DslHandle* handle)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            *handle = m_handles.Acquire(m_odeTriggers.at(name), 
+                DSL_HANDLE_TYPE_ODE_TRIGGER);
+
+            LOG_INFO("ODE Trigger '" << name << "' returned Handle = " 
+                << *handle << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name << "' threw exception getting Handle");
+            return DSL_RESULT_HANDLE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeActionHandleGet(const char* name, DslHandle* handle)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            
+            *handle = m_handles.Acquire(m_odeActions.at(name), 
+                DSL_HANDLE_TYPE_ODE_ACTION);
+
+            LOG_INFO("ODE Action '" << name << "' returned Handle = " 
+                << *handle << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name << "' threw exception getting Handle");
+            return DSL_RESULT_HANDLE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphHandleGet(const char* name, DslHandle* handle)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            
+            *handle = m_handles.Acquire(m_padProbeHandlers.at(name), 
+                DSL_HANDLE_TYPE_PPH);
+
+            LOG_INFO("Pad Probe Handler '" << name << "' returned Handle = " 
+                << *handle << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pad Probe Handler '" << name 
+                << "' threw exception getting Handle");
+            return DSL_RESULT_HANDLE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceHandleGet(const char* name, DslHandle* handle)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
+            
+            *handle = m_handles.Acquire(m_components.at(name), 
+                DSL_HANDLE_TYPE_SOURCE);
+
+            LOG_INFO("Source '" << name << "' returned Handle = " 
+                << *handle << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Source '" << name << "' threw exception getting Handle");
+            return DSL_RESULT_HANDLE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkHandleGet(const char* name, DslHandle* handle)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_SINK(m_components, name);
+            
+            *handle = m_handles.Acquire(m_components.at(name), 
+                DSL_HANDLE_TYPE_SINK);
+
+            LOG_INFO("Sink '" << name << "' returned Handle = " 
+                << *handle << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Sink '" << name << "' threw exception getting Handle");
+            return DSL_RESULT_HANDLE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::HandleRelease(DslHandle handle)
+    {
+        LOG_FUNC();
+
+        try
+        {
+            if (!m_handles.Release(handle))
+            {
+                LOG_ERROR("Handle '" << handle << "' is invalid or has been released");
+                return DSL_RESULT_HANDLE_INVALID;
+            }
+            LOG_INFO("Handle '" << handle << "' released successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Handle '" << handle << "' threw exception on release");
+            return DSL_RESULT_HANDLE_THREW_EXCEPTION;
+        }
+    }
+
+    uint Services::HandleListSize()
+    {
+        LOG_FUNC();
+        
+        return m_handles.Size();
+    }
+
+    DslReturnType Services::OdeTriggerEnabledGetH(DslHandle handle, boolean* enabled)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle, 
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+         
+            *enabled = pOdeTrigger->GetEnabled();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle 
+                << "' threw exception getting Enabled setting");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerEnabledSetH(DslHandle handle, boolean enabled)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle, 
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+         
+            pOdeTrigger->SetEnabled(enabled);
+
+            LOG_INFO("Trigger '" << pOdeTrigger->GetName() << "' set Enabled = "
+                << enabled << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle 
+                << "' threw exception setting Enabled");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerLimitEventGetH(DslHandle handle, uint* limit)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle, 
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+         
+            *limit = pOdeTrigger->GetEventLimit();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle 
+                << "' threw exception getting Event Limit");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerLimitEventSetH(DslHandle handle, uint limit)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle, 
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+         
+            pOdeTrigger->SetEventLimit(limit);
+
+            LOG_INFO("Trigger '" << pOdeTrigger->GetName() << "' set Event Limit = " 
+                << limit << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle 
+                << "' threw exception setting Event Limit");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerIntervalGetH(DslHandle handle, uint* interval)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle, 
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+         
+            *interval = pOdeTrigger->GetInterval();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle 
+                << "' threw exception getting Interval");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerIntervalSetH(DslHandle handle, uint interval)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle, 
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+         
+            pOdeTrigger->SetInterval(interval);
+
+            LOG_INFO("Trigger '" << pOdeTrigger->GetName() << "' set Interval = " 
+                << interval << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle 
+                << "' threw exception setting Interval");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerResetH(DslHandle handle)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle, 
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+         
+            pOdeTrigger->Reset();
+
+            LOG_INFO("ODE Trigger '" << pOdeTrigger->GetName() 
+                << "' Reset successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle 
+                << "' threw exception on Reset");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeActionEnabledGetH(DslHandle handle, boolean* enabled)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle, 
+                DSL_HANDLE_TYPE_ODE_ACTION, pObject);
+            
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(pObject);
+         
+            *enabled = pOdeAction->GetEnabled();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action with Handle '" << handle 
+                << "' threw exception getting Enabled setting");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeActionEnabledSetH(DslHandle handle, boolean enabled)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle, 
+                DSL_HANDLE_TYPE_ODE_ACTION, pObject);
+            
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(pObject);
+         
+            pOdeAction->SetEnabled(enabled);
+
+            LOG_INFO("ODE Action '" << pOdeAction->GetName() << "' set Enabled = " 
+                << enabled  << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action with Handle '" << handle 
+                << "' threw exception setting Enabled");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::PphEnabledGetH(DslHandle handle, boolean* enabled)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle, 
+                DSL_HANDLE_TYPE_PPH, pObject);
+            
+            DSL_PPH_PTR pPadProbeHandler = 
+                std::dynamic_pointer_cast<PadProbeHandler>(pObject);
+         
+            *enabled = pPadProbeHandler->GetEnabled();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pad Probe Handler with Handle '" << handle 
+                << "' threw exception getting the Enabled state");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::PphEnabledSetH(DslHandle handle, boolean enabled)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle, 
+                DSL_HANDLE_TYPE_PPH, pObject);
+            
+            DSL_PPH_PTR pPadProbeHandler = 
+                std::dynamic_pointer_cast<PadProbeHandler>(pObject);
+         
+            if (!pPadProbeHandler->SetEnabled(enabled))
+            {
+                LOG_ERROR("Pad Probe Handler '" << pPadProbeHandler->GetName()
+                    << "' failed to set enabled state");
+                return DSL_RESULT_PPH_SET_FAILED;
+            }
+            LOG_INFO("Pad Probe Handler '" << pPadProbeHandler->GetName() 
+                << "' set Enabled = " << enabled << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pad Probe Handler with Handle '" << handle 
+                << "' threw exception setting the Enabled state");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::SourceVideoDimensionsGetH(DslHandle handle, 
+        uint* width, uint* height)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle, 
+                DSL_HANDLE_TYPE_SOURCE, pObject);
+            
+            DSL_VIDEO_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<VideoSourceBintr>(pObject);
+         
+            pSourceBintr->GetDimensions(width, height);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Source with Handle '" << handle 
+                << "' threw exception getting dimensions");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::SourceFrameRateGetH(DslHandle handle, 
+        uint* fpsN, uint* fpsD)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle, 
+                DSL_HANDLE_TYPE_SOURCE, pObject);
+            
+            DSL_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<VideoSourceBintr>(pObject);
+         
+            pSourceBintr->GetFrameRate(fpsN, fpsD);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Source with Handle '" << handle 
+                << "' threw exception getting frame-rate");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::SinkSyncEnabledGetH(DslHandle handle, boolean* enabled)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle, 
+                DSL_HANDLE_TYPE_SINK, pObject);
+            
+            DSL_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<SinkBintr>(pObject);
+         
+            *enabled = (boolean)pSinkBintr->GetSyncEnabled();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Sink with Handle '" << handle 
+                << "' threw an exception getting Sync enabled");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::SinkSyncEnabledSetH(DslHandle handle, boolean enabled)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle, 
+                DSL_HANDLE_TYPE_SINK, pObject);
+            
+            DSL_SINK_PTR pSinkBintr = 
+                std::dynamic_pointer_cast<SinkBintr>(pObject);
+         
+            if (!pSinkBintr->SetSyncEnabled(enabled))
+            {
+                LOG_ERROR("Sink '" << pSinkBintr->GetName() 
+                    << "' failed to set sync attribute");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            LOG_INFO("Sink '" << pSinkBintr->GetName() << "' set Sync = " 
+                << enabled  << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Sink with Handle '" << handle 
+                << "' threw an exception setting sync enabled");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerSourceGetH(DslHandle handle, const char** source)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            *source = pOdeTrigger->GetSource();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception getting Source name");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerSourceSetH(DslHandle handle, const char* source)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            pOdeTrigger->SetSource(source);
+
+            LOG_INFO("Trigger '" << pOdeTrigger->GetName() << "' set Source name = " 
+                << source << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception setting Source name");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerInferGetH(DslHandle handle, const char** infer)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            *infer = pOdeTrigger->GetInfer();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception getting inference component name");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerInferSetH(DslHandle handle, const char* infer)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            pOdeTrigger->SetInfer(infer);
+
+            LOG_INFO("Trigger '" << pOdeTrigger->GetName() << "' set inference component name = " 
+                << infer << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception setting inference component name");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerClassIdGetH(DslHandle handle, uint* classId)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            *classId = pOdeTrigger->GetClassId();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception getting Class Id");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerClassIdSetH(DslHandle handle, uint classId)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            pOdeTrigger->SetClassId(classId);
+
+            LOG_INFO("Trigger '" << pOdeTrigger->GetName() << "' set Class Id = " 
+                << classId << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception setting Class Id");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerLimitFrameGetH(DslHandle handle, uint* limit)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            *limit = pOdeTrigger->GetFrameLimit();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception getting Frame Limit");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerLimitFrameSetH(DslHandle handle, uint limit)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            pOdeTrigger->SetFrameLimit(limit);
+
+            LOG_INFO("Trigger '" << pOdeTrigger->GetName() << "' set Frame Limit = " 
+                << limit << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception setting Frame Limit");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerResetTimeoutGetH(DslHandle handle, uint* timeout)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            *timeout = pOdeTrigger->GetResetTimeout();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception getting Reset Timeout");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerResetTimeoutSetH(DslHandle handle, uint timeout)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            pOdeTrigger->SetResetTimeout(timeout);
+
+            LOG_INFO("Trigger '" << pOdeTrigger->GetName() << "' set Reset Timeout = " 
+                << timeout << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception setting Reset Timeout");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerConfidenceMinGetH(DslHandle handle, float* minConfidence)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            *minConfidence = pOdeTrigger->GetMinConfidence();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception getting minimum confidence");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerConfidenceMinSetH(DslHandle handle, float minConfidence)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            pOdeTrigger->SetMinConfidence(minConfidence);
+
+            LOG_INFO("Trigger '" << pOdeTrigger->GetName() << "' set minimum confidence = " 
+                << minConfidence << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception setting minimum confidence");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerConfidenceMaxGetH(DslHandle handle, float* maxConfidence)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            *maxConfidence = pOdeTrigger->GetMaxConfidence();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception getting maximum confidence");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerConfidenceMaxSetH(DslHandle handle, float maxConfidence)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            pOdeTrigger->SetMaxConfidence(maxConfidence);
+
+            LOG_INFO("Trigger '" << pOdeTrigger->GetName() << "' set maximum confidence = " 
+                << maxConfidence << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception setting maximum confidence");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerTrackerConfidenceMinGetH(DslHandle handle, float* minConfidence)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            *minConfidence = pOdeTrigger->GetMinTrackerConfidence();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception getting minimum Tracker confidence");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerTrackerConfidenceMinSetH(DslHandle handle, float minConfidence)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            pOdeTrigger->SetMinTrackerConfidence(minConfidence);
+
+            LOG_INFO("Trigger '" << pOdeTrigger->GetName() << "' set minimum Tracker confidence = " 
+                << minConfidence << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception setting minimum Tracker confidence");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerTrackerConfidenceMaxGetH(DslHandle handle, float* maxConfidence)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            *maxConfidence = pOdeTrigger->GetMaxTrackerConfidence();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception getting maximum Tracker confidence");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerTrackerConfidenceMaxSetH(DslHandle handle, float maxConfidence)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            pOdeTrigger->SetMaxTrackerConfidence(maxConfidence);
+
+            LOG_INFO("Trigger '" << pOdeTrigger->GetName() << "' set maximum Tracker confidence = " 
+                << maxConfidence << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception setting maximum Tracker confidence");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerDimensionsMinGetH(DslHandle handle, 
+        float* minWidth, float* minHeight)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            pOdeTrigger->GetMinDimensions(minWidth, minHeight);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception getting minimum dimensions");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerDimensionsMinSetH(DslHandle handle, 
+        float minWidth, float minHeight)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            pOdeTrigger->SetMinDimensions(minWidth, minHeight);
+
+            LOG_INFO("Trigger '" << pOdeTrigger->GetName() << "' set Minimum Width = " 
+                << minWidth << " and Minimum Height = " << minHeight << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception setting minimum dimensions");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerDimensionsMaxGetH(DslHandle handle, 
+        float* maxWidth, float* maxHeight)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            pOdeTrigger->GetMaxDimensions(maxWidth, maxHeight);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception getting maximum dimensions");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerDimensionsMaxSetH(DslHandle handle, 
+        float maxWidth, float maxHeight)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_ODE_TRIGGER, pObject);
+
+            DSL_ODE_TRIGGER_PTR pOdeTrigger =
+                std::dynamic_pointer_cast<OdeTrigger>(pObject);
+
+            pOdeTrigger->SetMaxDimensions(maxWidth, maxHeight);
+
+            LOG_INFO("Trigger '" << pOdeTrigger->GetName() << "' set Maximum Width = " 
+                << maxWidth << " and Maximum Height = " << maxHeight << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger with Handle '" << handle
+                << "' threw exception setting maximum dimensions");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphMeterIntervalGetH(DslHandle handle, uint* interval)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_PPH, pObject);
+            DSL_RETURN_IF_HANDLE_OBJECT_IS_NOT_CORRECT_TYPE(handle, pObject,
+                MeterPadProbeHandler);
+
+            DSL_PPH_METER_PTR pMeter =
+                std::dynamic_pointer_cast<MeterPadProbeHandler>(pObject);
+
+            *interval = pMeter->GetInterval();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Meter Pad Probe Handler with Handle '" << handle
+                << "' threw an exception getting reporting interval");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphMeterIntervalSetH(DslHandle handle, uint interval)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_PPH, pObject);
+            DSL_RETURN_IF_HANDLE_OBJECT_IS_NOT_CORRECT_TYPE(handle, pObject,
+                MeterPadProbeHandler);
+
+            DSL_PPH_METER_PTR pMeter =
+                std::dynamic_pointer_cast<MeterPadProbeHandler>(pObject);
+
+            if (!interval)
+            {
+                LOG_ERROR("Meter Pad Probe Handler '" << pMeter->GetName()
+                    << "' failed to set property, interval must be greater than 0");
+                return DSL_RESULT_PPH_METER_INVALID_INTERVAL;
+            }
+            if (!pMeter->SetInterval(interval))
+            {
+                LOG_ERROR("Meter Pad Probe Handler '" << pMeter->GetName()
+                    << "' failed to set reporting interval");
+                return DSL_RESULT_PPH_SET_FAILED;
+            }
+            LOG_INFO("Meter Pad Probe Handler '" << pMeter->GetName()
+                << "' set Interval = " << interval << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Meter Pad Probe Handler with Handle '" << handle
+                << "' threw an exception setting reporting interval");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphLatencySegmentStatsGetH(DslHandle handle,
+        uint segment, dsl_latency_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_PPH, pObject);
+            DSL_RETURN_IF_HANDLE_OBJECT_IS_NOT_CORRECT_TYPE(handle, pObject,
+                LatencyPadProbeHandler);
+
+            DSL_PPH_LATENCY_PTR pLatency =
+                std::dynamic_pointer_cast<LatencyPadProbeHandler>(pObject);
+
+            if (!pLatency->GetSegmentStats(segment, stats))
+            {
+                LOG_ERROR("Segment " << segment
+                    << " is out of range for Latency Pad Probe Handler '"
+                    << pLatency->GetName() << "'");
+                return DSL_RESULT_PPH_LATENCY_SEGMENT_INVALID;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Latency Pad Probe Handler with Handle '" << handle
+                << "' threw an exception getting segment stats");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceIsLiveH(DslHandle handle, boolean* isLive)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_SOURCE, pObject);
+
+            DSL_SOURCE_PTR pSourceBintr =
+                std::dynamic_pointer_cast<SourceBintr>(pObject);
+
+            *isLive = (boolean)pSourceBintr->IsLive();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Source with Handle '" << handle
+                << "' threw exception getting is-live");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkAppQueueStatsGetH(DslHandle handle,
+        uint* depth, uint* highWater, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_BASE_PTR pObject;
+            DSL_RETURN_IF_HANDLE_NOT_RESOLVED(m_handles, handle,
+                DSL_HANDLE_TYPE_SINK, pObject);
+            DSL_RETURN_IF_HANDLE_OBJECT_IS_NOT_CORRECT_TYPE(handle, pObject,
+                AppSinkBintr);
+
+            DSL_APP_SINK_PTR pAppSinkBintr =
+                std::dynamic_pointer_cast<AppSinkBintr>(pObject);
+
+            if (!pAppSinkBintr->GetQueueEnabled())
+            {
+                LOG_ERROR("App Sink '" << pAppSinkBintr->GetName()
+                    << "' is not in queued mode");
+                return DSL_RESULT_SINK_APP_QUEUE_NOT_ENABLED;
+            }
+            pAppSinkBintr->GetQueueStats(depth, highWater, dropped);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Sink with Handle '" << handle
+                << "' threw an exception getting queue stats");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+}
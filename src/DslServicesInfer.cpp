@@ -34,7 +34,7 @@ namespace DSL
         const char* modelEngineFile, uint interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -81,7 +81,7 @@ namespace DSL
         const char* inferConfigFile, uint interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -120,7 +120,7 @@ namespace DSL
         const char* modelEngineFile, const char* inferOnGieName, uint interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -170,7 +170,7 @@ namespace DSL
         const char* inferOnTieName, uint interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -208,7 +208,7 @@ namespace DSL
     DslReturnType Services::InferBatchSizeGet(const char* name, uint* size)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -216,7 +216,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_INFER(m_components, name);
             
             DSL_INFER_PTR pInferBintr = 
-                std::dynamic_pointer_cast<InferBintr>(m_components[name]);
+                std::dynamic_pointer_cast<InferBintr>(m_components.at(name));
 
             *size = pInferBintr->GetBatchSize();
 
@@ -236,7 +236,7 @@ namespace DSL
     DslReturnType Services::InferBatchSizeSet(const char* name, uint size)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -268,7 +268,7 @@ namespace DSL
     DslReturnType Services::InferUniqueIdGet(const char* name, uint* id)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -276,7 +276,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_INFER(m_components, name);
             
             DSL_INFER_PTR pInferBintr = 
-                std::dynamic_pointer_cast<InferBintr>(m_components[name]);
+                std::dynamic_pointer_cast<InferBintr>(m_components.at(name));
 
             *id = pInferBintr->GetUniqueId();
 
@@ -297,7 +297,7 @@ namespace DSL
         const char* handler, uint pad)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -335,7 +335,7 @@ namespace DSL
     DslReturnType Services::InferPrimaryPphRemove(const char* name, const char* handler, uint pad) 
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
         
         try
@@ -371,7 +371,7 @@ namespace DSL
         const char* path)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -403,7 +403,7 @@ namespace DSL
         const char** inferConfigFile)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -411,7 +411,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_INFER(m_components, name);
             
             DSL_INFER_PTR pInferBintr = 
-                std::dynamic_pointer_cast<InferBintr>(m_components[name]);
+                std::dynamic_pointer_cast<InferBintr>(m_components.at(name));
 
             *inferConfigFile = pInferBintr->GetInferConfigFile();
             
@@ -430,7 +430,7 @@ namespace DSL
     DslReturnType Services::InferConfigFileSet(const char* name, const char* inferConfigFile)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -461,7 +461,7 @@ namespace DSL
     DslReturnType Services::InferGieModelEngineFileGet(const char* name, const char** modelEngineFile)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -469,7 +469,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
             
             DSL_INFER_PTR pGieBintr = 
-                std::dynamic_pointer_cast<InferBintr>(m_components[name]);
+                std::dynamic_pointer_cast<InferBintr>(m_components.at(name));
 
             *modelEngineFile = pGieBintr->GetModelEngineFile();
 
@@ -490,7 +490,7 @@ namespace DSL
         const char* modelEngineFile)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -523,7 +523,7 @@ namespace DSL
         boolean* inputEnabled, boolean* outputEnabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -531,7 +531,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
             
             DSL_INFER_PTR pInferBintr = 
-                std::dynamic_pointer_cast<InferBintr>(m_components[name]);
+                std::dynamic_pointer_cast<InferBintr>(m_components.at(name));
             
             bool InputTensorMetaEnabled(false);
             bool OutputTensorMetaEnabled(false);
@@ -560,7 +560,7 @@ namespace DSL
         boolean inputEnabled, boolean outputEnabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -592,7 +592,7 @@ namespace DSL
     DslReturnType Services::InferIntervalGet(const char* name, uint* interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -600,7 +600,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_INFER(m_components, name);
             
             DSL_INFER_PTR pInferBintr = 
-                std::dynamic_pointer_cast<InferBintr>(m_components[name]);
+                std::dynamic_pointer_cast<InferBintr>(m_components.at(name));
 
             *interval = pInferBintr->GetInterval();
 
@@ -620,7 +620,7 @@ namespace DSL
     DslReturnType Services::InferIntervalSet(const char* name, uint interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -651,11 +651,12 @@ namespace DSL
     DslReturnType Services::InferNameGet(int inferId, const char** name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        // Registry lookup only, does not take the Services lock.
         
-        if (m_inferNames.find(inferId) != m_inferNames.end())
+        const std::string* pName = m_inferNames.Lookup(inferId);
+        if (pName)
         {
-            *name = m_inferNames[inferId].c_str();
+            *name = pName->c_str();
             return DSL_RESULT_SUCCESS;
         }
         *name = NULL;
@@ -665,15 +666,9 @@ namespace DSL
     DslReturnType Services::InferIdGet(const char* name, int* inferId)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        // Registry lookup only, does not take the Services lock.
         
-        if (m_inferIds.find(name) != m_inferIds.end())
-        {
-            *inferId = m_inferIds[name];
-            return DSL_RESULT_SUCCESS;
-        }
-        *inferId = -1;
-        return DSL_RESULT_INFER_ID_NOT_FOUND;
+        return _inferIdGet(name, inferId);
     }
 
     DslReturnType Services::_inferIdGet(const char* name, int* inferId)
@@ -682,9 +677,10 @@ namespace DSL
         
         // called internally, do not lock mutex
 
-        if (m_inferIds.find(name) != m_inferIds.end())
+        uint id(0);
+        if (m_inferIds.Find(name, id))
         {
-            *inferId = m_inferIds[name];
+            *inferId = id;
             return DSL_RESULT_SUCCESS;
         }
         *inferId = -1;
@@ -698,8 +694,11 @@ namespace DSL
         
         // called internally, do not lock mutex
         
-        m_inferNames[inferId] = name;
-        m_inferIds[name] = inferId;
+        m_inferNames.Set(inferId, name);
+        m_inferIds.Set(name, inferId);
+        
+        // Triggers filtering on this Infer by name need to be re-resolved
+        OdeTrigger::s_dispatchGeneration++;
         return DSL_RESULT_SUCCESS;
     }
 
@@ -709,10 +708,12 @@ namespace DSL
 
         // called internally, do not lock mutex
         
-        if (m_inferNames.find(inferId) != m_inferNames.end())
+        std::string name;
+        if (m_inferNames.Find(inferId, name))
         {
-            m_inferIds.erase(m_inferNames[inferId]);
-            m_inferNames.erase(inferId);
+            m_inferIds.Erase(name);
+            m_inferNames.Erase(inferId);
+            OdeTrigger::s_dispatchGeneration++;
             return DSL_RESULT_SUCCESS;
         }
         return DSL_RESULT_SOURCE_NOT_FOUND;
@@ -722,7 +723,7 @@ namespace DSL
         uint width, uint height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -752,7 +753,7 @@ namespace DSL
         uint* width, uint* height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -760,7 +761,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, SegVisualBintr);
 
             DSL_SEGVISUAL_PTR pSegVisual = 
-                std::dynamic_pointer_cast<SegVisualBintr>(m_components[name]);
+                std::dynamic_pointer_cast<SegVisualBintr>(m_components.at(name));
 
             pSegVisual->GetDimensions(width, height);
             
@@ -780,7 +781,7 @@ namespace DSL
         uint width, uint height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -813,7 +814,7 @@ namespace DSL
     DslReturnType Services::SegVisualPphAdd(const char* name, const char* handler)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -843,7 +844,7 @@ namespace DSL
     DslReturnType Services::SegVisualPphRemove(const char* name, const char* handler) 
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -873,7 +874,7 @@ namespace DSL
     DslReturnType Services::OfvNew(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {   
@@ -25,6 +25,7 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslServices.h"
+#include "DslLogSink.h"
 
 namespace DSL
 {
@@ -93,7 +94,7 @@ namespace DSL
     DslReturnType Services::InfoStdoutGet(const char** filePath)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -119,7 +120,7 @@ namespace DSL
         uint mode)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -180,7 +181,7 @@ namespace DSL
     
     DslReturnType Services::InfoStdOutRestore()
     {
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -208,7 +209,7 @@ namespace DSL
     DslReturnType Services::InfoLogLevelGet(const char** level)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         { 
@@ -227,7 +228,7 @@ namespace DSL
     DslReturnType Services::InfoLogLevelSet(const char*  level)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -247,7 +248,7 @@ namespace DSL
     DslReturnType Services::InfoLogFileGet(const char** filePath)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -266,15 +267,22 @@ namespace DSL
         uint mode)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
             if (m_debugLogFileHandle)
             {
-                fclose(m_debugLogFileHandle);
-                LOG_INFO("DSL closed the current log file = '" 
+                LOG_INFO("DSL closing the current log file = '" 
                     << m_debugLogFilePath.c_str() << "'");
+            }
+            // Write all queued messages to the current log file, and hold 
+            // the async writer-thread, while the file is changed.
+            LogSink::GetSink().Suspend();
+            
+            if (m_debugLogFileHandle)
+            {
+                fclose(m_debugLogFileHandle);
                 m_debugLogFileHandle = NULL;
             }    
             m_debugLogFilePath.assign(filePath);
@@ -291,6 +299,8 @@ namespace DSL
             
             if (!m_debugLogFileHandle)
             {
+                LogSink::GetSink().Resume();
+                
                 LOG_ERROR("DSL failed to create log-file = '" 
                     << m_debugLogFilePath.c_str() << "'");
                 return DSL_RESULT_FAILURE;
@@ -298,6 +308,8 @@ namespace DSL
             
             gst_debug_remove_log_function(gst_debug_log_default);
             gst_debug_add_log_function(gst_debug_log_override, this, NULL);
+            LogSink::GetSink().Resume();
+            
             LOG_INFO("DSL set the debug log file = " << m_debugLogFilePath.c_str());
             return DSL_RESULT_SUCCESS;
         }
@@ -329,19 +341,24 @@ namespace DSL
     DslReturnType Services::InfoLogFunctionRestore()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
             if (m_debugLogFileHandle)
             {
-                fclose(m_debugLogFileHandle);
-                LOG_INFO("DSL closed the current log file = '" 
+                LOG_INFO("DSL closing the current log file = '" 
                     << m_debugLogFilePath.c_str() << "'");
-                m_debugLogFileHandle = NULL;
+
+                // Write all queued messages before closing the file
+                LogSink::GetSink().Suspend();
                 
                 gst_debug_remove_log_function(gst_debug_log_override);
                 gst_debug_add_log_function(gst_debug_log_default, NULL, NULL);
+                fclose(m_debugLogFileHandle);
+                m_debugLogFileHandle = NULL;
+                
+                LogSink::GetSink().Resume();
                 LOG_INFO("DSL Restored the default log function");
             }
             return DSL_RESULT_SUCCESS;
@@ -353,6 +370,44 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::InfoLogAsyncEnabledGet(boolean* enabled)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            *enabled = LogSink::GetSink().GetAsyncEnabled();
+            
+            LOG_INFO("Async logging enabled = " << *enabled);
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("DSL threw an exception getting async logging enabled");
+            return DSL_RESULT_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::InfoLogAsyncEnabledSet(boolean enabled)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            LogSink::GetSink().SetAsyncEnabled(enabled);
+            
+            LOG_INFO("DSL set async logging enabled = " << enabled);
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("DSL threw an exception setting async logging enabled");
+            return DSL_RESULT_THREW_EXCEPTION;
+        }
+    }
+
     static void gst_debug_log_override(GstDebugCategory * category, GstDebugLevel level,
         const gchar * file, const gchar * function, gint line,
         GObject * object, GstDebugMessage * message, gpointer unused)
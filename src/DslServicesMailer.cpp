@@ -33,7 +33,7 @@ namespace DSL
     DslReturnType Services::MailerNew(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -59,7 +59,7 @@ namespace DSL
         boolean* enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -83,7 +83,7 @@ namespace DSL
         boolean enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -107,7 +107,7 @@ namespace DSL
         const char* username, const char* password)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -131,7 +131,7 @@ namespace DSL
         const char** serverUrl)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -155,7 +155,7 @@ namespace DSL
         const char* serverUrl)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -179,7 +179,7 @@ namespace DSL
         const char** displayName, const char** address)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -204,7 +204,7 @@ namespace DSL
         const char* displayName, const char* address)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -228,7 +228,7 @@ namespace DSL
         boolean* enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -252,7 +252,7 @@ namespace DSL
         boolean enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -274,7 +274,7 @@ namespace DSL
         const char* displayName, const char* address)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -297,7 +297,7 @@ namespace DSL
     DslReturnType Services::MailerToAddressesRemoveAll(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -321,7 +321,7 @@ namespace DSL
         const char* displayName, const char* address)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -344,7 +344,7 @@ namespace DSL
     DslReturnType Services::MailerCcAddressesRemoveAll(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -366,7 +366,7 @@ namespace DSL
     DslReturnType Services::MailerSendTestMessage(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -393,10 +393,195 @@ namespace DSL
         }
     }
  
+    DslReturnType Services::MailerQueueSettingsGet(const char* name, 
+        uint* maxSize, uint* policy)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_MAILER_NAME_NOT_FOUND(m_mailers, name);
+
+            m_mailers[name]->GetQueueSettings(maxSize, policy);
+            
+            LOG_INFO("Mailer '" << name << "' returned max-size = " 
+                << *maxSize << " and policy = " << *policy << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Mailer '" << name 
+                << "' threw exception getting queue settings");
+            return DSL_RESULT_MAILER_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::MailerQueueSettingsSet(const char* name, 
+        uint maxSize, uint policy)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_MAILER_NAME_NOT_FOUND(m_mailers, name);
+
+            if (!maxSize or policy > DSL_MAILER_QUEUE_POLICY_DROP_NEWEST)
+            {
+                LOG_ERROR("Invalid queue settings max-size = " << maxSize
+                    << " and policy = " << policy << " for Mailer '" 
+                    << name << "'");
+                return DSL_RESULT_MAILER_PARAMETER_INVALID;
+            }
+            m_mailers[name]->SetQueueSettings(maxSize, policy);
+            
+            LOG_INFO("Mailer '" << name << "' set max-size = " 
+                << maxSize << " and policy = " << policy << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Mailer '" << name 
+                << "' threw exception setting queue settings");
+            return DSL_RESULT_MAILER_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::MailerRateLimitGet(const char* name, 
+        uint* maxPerMinute)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_MAILER_NAME_NOT_FOUND(m_mailers, name);
+
+            *maxPerMinute = m_mailers[name]->GetRateLimit();
+            
+            LOG_INFO("Mailer '" << name << "' returned rate limit = " 
+                << *maxPerMinute << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Mailer '" << name 
+                << "' threw exception getting rate limit");
+            return DSL_RESULT_MAILER_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::MailerRateLimitSet(const char* name, 
+        uint maxPerMinute)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_MAILER_NAME_NOT_FOUND(m_mailers, name);
+
+            m_mailers[name]->SetRateLimit(maxPerMinute);
+            
+            LOG_INFO("Mailer '" << name << "' set rate limit = " 
+                << maxPerMinute << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Mailer '" << name 
+                << "' threw exception setting rate limit");
+            return DSL_RESULT_MAILER_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::MailerDigestSettingsGet(const char* name, 
+        uint* window, uint* maxMessages)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_MAILER_NAME_NOT_FOUND(m_mailers, name);
+
+            m_mailers[name]->GetDigestSettings(window, maxMessages);
+            
+            LOG_INFO("Mailer '" << name << "' returned digest window = " 
+                << *window << " and max-messages = " << *maxMessages 
+                << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Mailer '" << name 
+                << "' threw exception getting digest settings");
+            return DSL_RESULT_MAILER_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::MailerDigestSettingsSet(const char* name, 
+        uint window, uint maxMessages)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_MAILER_NAME_NOT_FOUND(m_mailers, name);
+
+            m_mailers[name]->SetDigestSettings(window, maxMessages);
+            
+            LOG_INFO("Mailer '" << name << "' set digest window = " 
+                << window << " and max-messages = " << maxMessages 
+                << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Mailer '" << name 
+                << "' threw exception setting digest settings");
+            return DSL_RESULT_MAILER_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::MailerStatsGet(const char* name, 
+        uint64_t* sent, uint64_t* failed, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_MAILER_NAME_NOT_FOUND(m_mailers, name);
+
+            m_mailers[name]->GetStats(sent, failed, dropped);
+            
+            LOG_INFO("Mailer '" << name << "' returned sent = " << *sent
+                << ", failed = " << *failed << ", and dropped = " << *dropped
+                << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Mailer '" << name 
+                << "' threw exception getting stats");
+            return DSL_RESULT_MAILER_THREW_EXCEPTION;
+        }
+    }
+ 
     boolean Services::MailerExists(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -413,7 +598,7 @@ namespace DSL
     DslReturnType Services::MailerDelete(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -444,7 +629,7 @@ namespace DSL
     DslReturnType Services::MailerDeleteAll()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -478,7 +663,7 @@ namespace DSL
     uint Services::MailerListSize()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         return m_mailers.size();
     }
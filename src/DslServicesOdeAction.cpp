@@ -34,7 +34,7 @@ namespace DSL
         const char* outdir, boolean annotate)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -72,7 +72,7 @@ namespace DSL
         const char* outdir)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -109,7 +109,7 @@ namespace DSL
         dsl_capture_complete_listener_cb listener, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -302,7 +302,7 @@ namespace DSL
         dsl_ode_handle_occurrence_cb clientHandler, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -331,7 +331,7 @@ namespace DSL
     DslReturnType Services::OdeActionBBoxScaleNew(const char* name, uint scale)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -367,7 +367,7 @@ namespace DSL
         const uint* contentTypes, uint size)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -421,7 +421,7 @@ namespace DSL
         uint* contentTypes, uint* size)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -430,7 +430,7 @@ namespace DSL
                 name, CustomizeLabelOdeAction);
             
             DSL_ODE_ACTION_LABEL_CUSTOMIZE_PTR pOdeAction = 
-                std::dynamic_pointer_cast<CustomizeLabelOdeAction>(m_odeActions[name]);
+                std::dynamic_pointer_cast<CustomizeLabelOdeAction>(m_odeActions.at(name));
                 
             std::vector <uint> contentTypesCopy = pOdeAction->Get();
             
@@ -460,7 +460,7 @@ namespace DSL
         const uint* contentTypes, uint size)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -512,7 +512,7 @@ namespace DSL
         int offsetX, int offsetY)
 {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -545,7 +545,7 @@ namespace DSL
         const char* font, boolean hasBgColor, const char* bgColor)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -597,7 +597,7 @@ namespace DSL
         const char* mailer, const char* subject)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -628,7 +628,7 @@ namespace DSL
         const char* filePath, uint mode, uint format, boolean forceFlush)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -658,6 +658,10 @@ namespace DSL
                 m_odeActions[name] = DSL_ODE_ACTION_FILE_MOTC_NEW(name, 
                     filePath, mode, forceFlush);
                 break;
+            case DSL_EVENT_FILE_FORMAT_BINARY :
+                m_odeActions[name] = DSL_ODE_ACTION_FILE_BINARY_NEW(name, 
+                    filePath, mode, forceFlush);
+                break;
             default :
                 LOG_ERROR("File format " << format 
                     << " is invalid for ODE Action '" << name << "'");
@@ -676,11 +680,71 @@ namespace DSL
         }
     }
     
+    DslReturnType Services::OdeActionFileRotationGet(const char* name, 
+        uint* maxSize, uint* maxDuration)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            DSL_RETURN_IF_ODE_ACTION_IS_NOT_FILE_TYPE(m_odeActions, name);
+            
+            DSL_ODE_ACTION_FILE_PTR pOdeAction = 
+                std::dynamic_pointer_cast<FileOdeAction>(m_odeActions.at(name));
+
+            pOdeAction->GetRotation(maxSize, maxDuration);
+
+            LOG_INFO("ODE File Action '" << name 
+                << "' returned max-size = " << *maxSize 
+                << " and max-duration = " << *maxDuration << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE File Action '" << name 
+                << "' threw exception getting rotation settings");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::OdeActionFileRotationSet(const char* name, 
+        uint maxSize, uint maxDuration)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            DSL_RETURN_IF_ODE_ACTION_IS_NOT_FILE_TYPE(m_odeActions, name);
+            
+            DSL_ODE_ACTION_FILE_PTR pOdeAction = 
+                std::dynamic_pointer_cast<FileOdeAction>(m_odeActions[name]);
+
+            pOdeAction->SetRotation(maxSize, maxDuration);
+
+            LOG_INFO("ODE File Action '" << name 
+                << "' set max-size = " << maxSize 
+                << " and max-duration = " << maxDuration << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE File Action '" << name 
+                << "' threw exception setting rotation settings");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
+    
     DslReturnType Services::OdeActionFillSurroundingsNew(const char* 
         name, const char* color)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -716,7 +780,7 @@ namespace DSL
     DslReturnType Services::OdeActionFillFrameNew(const char* name, const char* color)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -753,7 +817,7 @@ namespace DSL
         uint borderWidth, const char* borderColor, boolean hasBgColor, const char* bgColor)  
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -814,7 +878,7 @@ namespace DSL
         const char* font, boolean hasBgColor, const char* bgColor)  
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -872,7 +936,7 @@ namespace DSL
     DslReturnType Services::OdeActionHandlerDisableNew(const char* name, const char* handler)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -899,7 +963,7 @@ namespace DSL
     DslReturnType Services::OdeActionLogNew(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -925,7 +989,7 @@ namespace DSL
     DslReturnType Services::OdeActionMessageMetaAddNew(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -953,7 +1017,7 @@ namespace DSL
         uint* metaType) 
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -962,7 +1026,7 @@ namespace DSL
                 name, MessageMetaAddOdeAction);
 
             DSL_ODE_ACTION_MESSAGE_META_ADD_PTR pAction = 
-                std::dynamic_pointer_cast<MessageMetaAddOdeAction>(m_odeActions[name]);
+                std::dynamic_pointer_cast<MessageMetaAddOdeAction>(m_odeActions.at(name));
 
             *metaType = pAction->GetMetaType();
             
@@ -983,7 +1047,7 @@ namespace DSL
         uint metaType)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1020,7 +1084,7 @@ namespace DSL
         const char* displayType)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1052,7 +1116,7 @@ namespace DSL
     DslReturnType Services::OdeActionDisplayMetaAddDisplayType(const char* name, const char* displayType)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1083,7 +1147,7 @@ namespace DSL
         dsl_ode_monitor_occurrence_cb clientMonitor, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1110,7 +1174,7 @@ namespace DSL
     DslReturnType Services::OdeActionObjectRemoveNew(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1138,7 +1202,7 @@ namespace DSL
     DslReturnType Services::OdeActionPauseNew(const char* name, const char* pipeline)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1165,7 +1229,7 @@ namespace DSL
         boolean forceFlush)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1191,7 +1255,7 @@ namespace DSL
     DslReturnType Services::OdeActionRedactNew(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1218,7 +1282,7 @@ namespace DSL
         const char* pipeline, const char* sink)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1245,7 +1309,7 @@ namespace DSL
         const char* pipeline, const char* sink)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1272,7 +1336,7 @@ namespace DSL
         const char* recordSink, uint start, uint duration, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1307,7 +1371,7 @@ namespace DSL
         const char* recordSink)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1342,7 +1406,7 @@ namespace DSL
         const char* pipeline, const char* source)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1369,7 +1433,7 @@ namespace DSL
         const char* pipeline, const char* source)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1396,7 +1460,7 @@ namespace DSL
         const char* recordTap, uint start, uint duration, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1431,7 +1495,7 @@ namespace DSL
         const char* recordTap)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1464,7 +1528,7 @@ namespace DSL
     DslReturnType Services::OdeActionActionDisableNew(const char* name, const char* action)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1490,7 +1554,7 @@ namespace DSL
     DslReturnType Services::OdeActionActionEnableNew(const char* name, const char* action)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1517,7 +1581,7 @@ namespace DSL
         const char* tiler, uint timeout, bool hasPrecedence)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1543,7 +1607,7 @@ namespace DSL
     DslReturnType Services::OdeActionTriggerResetNew(const char* name, const char* trigger)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1569,7 +1633,7 @@ namespace DSL
     DslReturnType Services::OdeActionTriggerDisableNew(const char* name, const char* trigger)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1595,7 +1659,7 @@ namespace DSL
     DslReturnType Services::OdeActionTriggerEnableNew(const char* name, const char* trigger)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1622,7 +1686,7 @@ namespace DSL
         const char* trigger, const char* area)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1649,7 +1713,7 @@ namespace DSL
         const char* trigger, const char* area)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1675,14 +1739,14 @@ namespace DSL
     DslReturnType Services::OdeActionEnabledGet(const char* name, boolean* enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
             DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
             
             DSL_ODE_ACTION_PTR pOdeAction = 
-                std::dynamic_pointer_cast<OdeAction>(m_odeActions[name]);
+                std::dynamic_pointer_cast<OdeAction>(m_odeActions.at(name));
          
             *enabled = pOdeAction->GetEnabled();
 
@@ -1701,7 +1765,7 @@ namespace DSL
     DslReturnType Services::OdeActionEnabledSet(const char* name, boolean enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1728,7 +1792,7 @@ namespace DSL
         dsl_ode_enabled_state_change_listener_cb listener, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1760,7 +1824,7 @@ namespace DSL
         dsl_ode_enabled_state_change_listener_cb listener)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1791,7 +1855,7 @@ namespace DSL
     DslReturnType Services::OdeActionDelete(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1818,7 +1882,7 @@ namespace DSL
     DslReturnType Services::OdeActionDeleteAll()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1851,7 +1915,7 @@ namespace DSL
     uint Services::OdeActionListSize()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         return m_odeActions.size();
     }
@@ -34,7 +34,7 @@ namespace DSL
         uint cols, uint rows, uint bboxTestPoint, const char* colorPalette)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -73,7 +73,7 @@ namespace DSL
         const char** colorPalette)
     {    
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -99,7 +99,7 @@ namespace DSL
         const char* colorPalette)
     {    
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -136,7 +136,7 @@ namespace DSL
         boolean* enabled, uint* location, uint* width, uint* height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -165,7 +165,7 @@ namespace DSL
         boolean enabled, uint location, uint width, uint height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -192,10 +192,60 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::OdeHeatMapperDecayHalfLifeGet(const char* name,
+        uint* halfLife)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_HEAT_MAPPER_NAME_NOT_FOUND(m_odeHeatMappers, name);
+            
+            *halfLife = m_odeHeatMappers[name]->GetDecayHalfLife();
+
+            LOG_INFO("ODE Heat-Mapper '" << name 
+                << "' returned Decay Half-Life = " << *halfLife << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE HeatMapper '" << name 
+                << "' threw an exception getting Decay Half-Life");
+            return DSL_RESULT_ODE_HEAT_MAPPER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeHeatMapperDecayHalfLifeSet(const char* name,
+        uint halfLife)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_HEAT_MAPPER_NAME_NOT_FOUND(m_odeHeatMappers, name);
+            
+            m_odeHeatMappers[name]->SetDecayHalfLife(halfLife);
+
+            LOG_INFO("ODE Heat-Mapper '" << name 
+                << "' set Decay Half-Life = " << halfLife << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE HeatMapper '" << name 
+                << "' threw an exception setting Decay Half-Life");
+            return DSL_RESULT_ODE_HEAT_MAPPER_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::OdeHeatMapperMetricsClear(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -220,7 +270,7 @@ namespace DSL
         const uint64_t** buffer, uint* size)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -244,7 +294,7 @@ namespace DSL
     DslReturnType Services::OdeHeatMapperMetricsPrint(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -268,7 +318,7 @@ namespace DSL
     DslReturnType Services::OdeHeatMapperMetricsLog(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -293,7 +343,7 @@ namespace DSL
         const char* filePath, uint mode, uint format)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -322,7 +372,7 @@ namespace DSL
     DslReturnType Services::OdeHeatMapperDelete(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -350,7 +400,7 @@ namespace DSL
     DslReturnType Services::OdeHeatMapperDeleteAll()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -384,7 +434,7 @@ namespace DSL
     uint Services::OdeHeatMapperListSize()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         return m_odeHeatMappers.size();
     }
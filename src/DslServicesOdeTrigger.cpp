@@ -32,7 +32,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerAlwaysNew(const char* name, const char* source, uint when)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -65,7 +65,7 @@ namespace DSL
         const char* source, uint classId, uint limit)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -95,7 +95,7 @@ namespace DSL
         const char* source, uint classId, uint limit)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -126,7 +126,7 @@ namespace DSL
         const char* source, uint classId, uint limit)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -156,7 +156,7 @@ namespace DSL
         uint* instanceCount, uint* suppressionCount)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -165,7 +165,7 @@ namespace DSL
                 InstanceOdeTrigger);
             
             DSL_ODE_TRIGGER_INSTANCE_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<InstanceOdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<InstanceOdeTrigger>(m_odeTriggers.at(name));
 
             pOdeTrigger->GetCountSettings(instanceCount, suppressionCount);
             
@@ -187,7 +187,7 @@ namespace DSL
         uint instanceCount, uint suppressionCount)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -223,7 +223,7 @@ namespace DSL
         const char* source, uint classIdA, uint classIdB, uint limit)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -253,7 +253,7 @@ namespace DSL
         const char* source, uint classId, uint limit)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -281,7 +281,7 @@ namespace DSL
         dsl_ode_post_process_frame_cb client_post_processor, void* client_data)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -310,7 +310,7 @@ namespace DSL
         uint classId, uint limit, uint minimum, uint maximum)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -341,7 +341,7 @@ namespace DSL
         uint* minimum, uint* maximum)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -349,7 +349,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, CountOdeTrigger);
             
             DSL_ODE_TRIGGER_COUNT_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<CountOdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<CountOdeTrigger>(m_odeTriggers.at(name));
 
             pOdeTrigger->GetRange(minimum, maximum);
             
@@ -373,7 +373,7 @@ namespace DSL
         uint minimum, uint maximum)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -405,7 +405,7 @@ namespace DSL
         uint testPoint, uint testMethod)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -437,7 +437,7 @@ namespace DSL
         uint* minimum, uint* maximum)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -445,7 +445,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, DistanceOdeTrigger);
             
             DSL_ODE_TRIGGER_DISTANCE_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<DistanceOdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<DistanceOdeTrigger>(m_odeTriggers.at(name));
 
             pOdeTrigger->GetRange(minimum, maximum);
             
@@ -469,7 +469,7 @@ namespace DSL
         uint minimum, uint maximum)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -501,7 +501,7 @@ namespace DSL
         uint* testPoint, uint* testMethod)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -509,7 +509,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, DistanceOdeTrigger);
             
             DSL_ODE_TRIGGER_DISTANCE_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<DistanceOdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<DistanceOdeTrigger>(m_odeTriggers.at(name));
          
             pOdeTrigger->GetTestParams(testPoint, testMethod);
             
@@ -530,7 +530,7 @@ namespace DSL
         uint testPoint, uint testMethod)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -559,7 +559,7 @@ namespace DSL
         const char* source, uint classId, uint limit)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -586,7 +586,7 @@ namespace DSL
         const char* source, uint classId, uint limit)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -613,7 +613,7 @@ namespace DSL
         const char* source, uint classId, uint limit, uint preset)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -642,7 +642,7 @@ namespace DSL
         const char* source, uint classId, uint limit, uint preset)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -671,7 +671,7 @@ namespace DSL
         uint minFrameCount, uint maxFrameCount, uint testMethod)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -718,7 +718,7 @@ namespace DSL
         uint* minFrameCount, uint* maxFrameCount, uint* testMethod)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -727,7 +727,7 @@ namespace DSL
                 CrossOdeTrigger);
             
             DSL_ODE_TRIGGER_CROSS_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<CrossOdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<CrossOdeTrigger>(m_odeTriggers.at(name));
 
             pOdeTrigger->GetTestSettings(minFrameCount, 
                 maxFrameCount, testMethod);
@@ -749,7 +749,7 @@ namespace DSL
         uint minFrameCount, uint maxFrameCount, uint testMethod)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -793,7 +793,7 @@ namespace DSL
         boolean* enabled, const char** color, uint* lineWidth)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -802,7 +802,7 @@ namespace DSL
                 CrossOdeTrigger);
             
             DSL_ODE_TRIGGER_CROSS_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<CrossOdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<CrossOdeTrigger>(m_odeTriggers.at(name));
 
             bool bEnabled;
             pOdeTrigger->GetViewSettings(&bEnabled, color, lineWidth);
@@ -825,7 +825,7 @@ namespace DSL
         boolean enabled, const char* color, uint lineWidth)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -860,7 +860,7 @@ namespace DSL
         uint classId, uint limit, uint minimum, uint maximum)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -891,7 +891,7 @@ namespace DSL
         uint* minimum, uint* maximum)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -900,7 +900,7 @@ namespace DSL
                 PersistenceOdeTrigger);
             
             DSL_ODE_TRIGGER_PERSISTENCE_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<PersistenceOdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<PersistenceOdeTrigger>(m_odeTriggers.at(name));
 
             pOdeTrigger->GetRange(minimum, maximum);
             
@@ -921,7 +921,7 @@ namespace DSL
         uint minimum, uint maximum)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -953,7 +953,7 @@ namespace DSL
         const char* source, uint classId, uint limit)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -983,7 +983,7 @@ namespace DSL
         const char* source, uint classId, uint limit)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1013,7 +1013,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerReset(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1038,14 +1038,14 @@ namespace DSL
     DslReturnType Services::OdeTriggerResetTimeoutGet(const char* name, uint* timeout)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             
             DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers.at(name));
          
             *timeout = pOdeTrigger->GetResetTimeout();
             
@@ -1064,7 +1064,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerResetTimeoutSet(const char* name, uint timeout)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1091,7 +1091,7 @@ namespace DSL
         dsl_ode_trigger_limit_state_change_listener_cb listener, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1123,7 +1123,7 @@ namespace DSL
         dsl_ode_trigger_limit_state_change_listener_cb listener)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1154,14 +1154,14 @@ namespace DSL
     DslReturnType Services::OdeTriggerEnabledGet(const char* name, boolean* enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             
             DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers.at(name));
          
             *enabled = pOdeTrigger->GetEnabled();
             return DSL_RESULT_SUCCESS;
@@ -1176,7 +1176,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerEnabledSet(const char* name, boolean enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1203,7 +1203,7 @@ namespace DSL
         dsl_ode_enabled_state_change_listener_cb listener, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1235,7 +1235,7 @@ namespace DSL
         dsl_ode_enabled_state_change_listener_cb listener)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1266,14 +1266,14 @@ namespace DSL
     DslReturnType Services::OdeTriggerSourceGet(const char* name, const char** source)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             
             DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers.at(name));
          
             *source = pOdeTrigger->GetSource();
             
@@ -1293,7 +1293,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerSourceSet(const char* name, const char* source)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1317,10 +1317,73 @@ namespace DSL
         }
     }                
 
-    DslReturnType Services::OdeTriggerInferGet(const char* name, const char** infer)
+    DslReturnType Services::OdeTriggerSourcesAdd(const char* name, const char* source)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+
+            if (!pOdeTrigger->AddSourceToSet(source))
+            {
+                LOG_ERROR("ODE Trigger '" << name 
+                    << "' failed to add Source '" << source << "' to its source-set");
+                return DSL_RESULT_ODE_TRIGGER_SET_FAILED;
+            }
+            LOG_INFO("Trigger '" << name << "' added Source '" 
+                << source << "' to its source-set successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name 
+                << "' threw exception adding source to source-set");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerSourcesRemove(const char* name, const char* source)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+
+            if (!pOdeTrigger->RemoveSourceFromSet(source))
+            {
+                LOG_ERROR("ODE Trigger '" << name 
+                    << "' failed to remove Source '" << source 
+                    << "' from its source-set");
+                return DSL_RESULT_ODE_TRIGGER_SET_FAILED;
+            }
+            LOG_INFO("Trigger '" << name << "' removed Source '" 
+                << source << "' from its source-set successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name 
+                << "' threw exception removing source from source-set");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerSourcesRemoveAll(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1328,6 +1391,33 @@ namespace DSL
             
             DSL_ODE_TRIGGER_PTR pOdeTrigger = 
                 std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+
+            pOdeTrigger->RemoveAllSourcesFromSet();
+            
+            LOG_INFO("Trigger '" << name 
+                << "' removed all Sources from its source-set successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name 
+                << "' threw exception removing all sources from source-set");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerInferGet(const char* name, const char** infer)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers.at(name));
          
             *infer = pOdeTrigger->GetInfer();
             
@@ -1347,7 +1437,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerInferSet(const char* name, const char* infer)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1374,14 +1464,14 @@ namespace DSL
     DslReturnType Services::OdeTriggerClassIdGet(const char* name, uint* classId)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             
             DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers.at(name));
          
             *classId = pOdeTrigger->GetClassId();
             
@@ -1401,7 +1491,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerClassIdSet(const char* name, uint classId)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1425,11 +1515,85 @@ namespace DSL
         }
     }                
 
+    DslReturnType Services::OdeTriggerClassIdsGet(const char* name, 
+        uint* classIds, uint* size)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers.at(name));
+         
+            std::vector<uint> classIdsCopy = pOdeTrigger->GetClassIds();
+            
+            if (*size < classIdsCopy.size())
+            {
+                LOG_ERROR("Insufficient 'class_ids' array size = " << *size 
+                    << " to Get the class-set of ODE Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            std::copy(classIdsCopy.begin(), classIdsCopy.end(), classIds);
+            *size = classIdsCopy.size();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name 
+                << "' threw exception getting class-set");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerClassIdsSet(const char* name, 
+        const uint* classIds, uint size)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            // AB Triggers filter on their Class A and Class B ids.
+            if (m_odeTriggers[name]->IsType(typeid(DistanceOdeTrigger)) or
+                m_odeTriggers[name]->IsType(typeid(IntersectionOdeTrigger)))
+            {
+                LOG_ERROR("ODE Trigger '" << name 
+                    << "' is an AB Trigger and does not support a class-set");
+                return DSL_RESULT_ODE_TRIGGER_SET_FAILED;
+            }
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            if (!pOdeTrigger->SetClassIds(classIds, size))
+            {
+                LOG_ERROR("ODE Trigger '" << name 
+                    << "' failed to set its class-set");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            LOG_INFO("Trigger '" << name << "' set class-set of size = " 
+                << size << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name 
+                << "' threw exception setting class-set");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
     DslReturnType Services::OdeTriggerClassIdABGet(const char* name, 
         uint* classIdA, uint* classIdB)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1437,7 +1601,7 @@ namespace DSL
             DSL_RETURN_IF_ODE_TRIGGER_IS_NOT_AB_TYPE(m_odeTriggers, name);
             
             DSL_ODE_TRIGGER_AB_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<ABOdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<ABOdeTrigger>(m_odeTriggers.at(name));
          
             pOdeTrigger->GetClassIdAB(classIdA, classIdB);
             
@@ -1458,7 +1622,7 @@ namespace DSL
         uint classIdA, uint classIdB)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1485,14 +1649,14 @@ namespace DSL
     DslReturnType Services::OdeTriggerLimitEventGet(const char* name, uint* limit)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             
             DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers.at(name));
          
             *limit = pOdeTrigger->GetEventLimit();
 
@@ -1512,7 +1676,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerLimitEventSet(const char* name, uint limit)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1539,14 +1703,14 @@ namespace DSL
     DslReturnType Services::OdeTriggerLimitFrameGet(const char* name, uint* limit)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             
             DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers.at(name));
          
             *limit = pOdeTrigger->GetFrameLimit();
 
@@ -1566,7 +1730,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerLimitFrameSet(const char* name, uint limit)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1593,14 +1757,14 @@ namespace DSL
         name, float* minConfidence)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             
             DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers.at(name));
          
             *minConfidence = pOdeTrigger->GetMinConfidence();
             
@@ -1621,7 +1785,7 @@ namespace DSL
         float minConfidence)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1649,14 +1813,14 @@ namespace DSL
         name, float* maxConfidence)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             
             DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers.at(name));
          
             *maxConfidence = pOdeTrigger->GetMaxConfidence();
             
@@ -1677,7 +1841,7 @@ namespace DSL
         float maxConfidence)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1705,14 +1869,14 @@ namespace DSL
         name, float* minConfidence)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             
             DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers.at(name));
          
             *minConfidence = pOdeTrigger->GetMinTrackerConfidence();
             
@@ -1733,7 +1897,7 @@ namespace DSL
         float minConfidence)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1761,14 +1925,14 @@ namespace DSL
         name, float* maxConfidence)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             
             DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers.at(name));
          
             *maxConfidence = pOdeTrigger->GetMaxTrackerConfidence();
             
@@ -1789,7 +1953,7 @@ namespace DSL
         float maxConfidence)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1817,14 +1981,14 @@ namespace DSL
         float* minWidth, float* minHeight)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             
             DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers.at(name));
          
             pOdeTrigger->GetMinDimensions(minWidth, minHeight);
             
@@ -1846,7 +2010,7 @@ namespace DSL
         float minWidth, float minHeight)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1875,14 +2039,14 @@ namespace DSL
         float* maxWidth, float* maxHeight)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             
             DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers.at(name));
          
             pOdeTrigger->GetMaxDimensions(maxWidth, maxHeight);
             
@@ -1904,7 +2068,7 @@ namespace DSL
         float maxWidth, float maxHeight)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1935,14 +2099,14 @@ namespace DSL
         uint* min_count_n, uint* min_count_d)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             
             DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers.at(name));
          
             pOdeTrigger->GetMinFrameCount(min_count_n, min_count_d);
 
@@ -1960,7 +2124,7 @@ namespace DSL
         uint min_count_n, uint min_count_d)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1986,14 +2150,14 @@ namespace DSL
         boolean* inferDoneOnly)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             
             DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers.at(name));
          
             *inferDoneOnly = pOdeTrigger->GetInferDoneOnlySetting();
             
@@ -2014,7 +2178,7 @@ namespace DSL
         boolean inferDoneOnly)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2041,14 +2205,14 @@ namespace DSL
     DslReturnType Services::OdeTriggerIntervalGet(const char* name, uint* interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             
             DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers.at(name));
          
             *interval = pOdeTrigger->GetInterval();
             
@@ -2067,7 +2231,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerIntervalSet(const char* name, uint interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2093,7 +2257,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerActionAdd(const char* name, const char* action)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2124,7 +2288,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerActionRemove(const char* name, const char* action)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2160,7 +2324,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerActionRemoveAll(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2182,7 +2346,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerAreaAdd(const char* name, const char* area)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2213,7 +2377,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerAreaRemove(const char* name, const char* area)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2249,7 +2413,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerAreaRemoveAll(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2272,7 +2436,7 @@ namespace DSL
         const char* accumulator)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2303,7 +2467,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerAccumulatorRemove(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2331,7 +2495,7 @@ namespace DSL
         const char* heatMapper)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2362,7 +2526,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerHeatMapperRemove(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2389,7 +2553,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerDelete(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2416,7 +2580,7 @@ namespace DSL
     DslReturnType Services::OdeTriggerDeleteAll()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2449,7 +2613,7 @@ namespace DSL
     uint Services::OdeTriggerListSize()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         return m_odeTriggers.size();
     }
@@ -27,6 +27,7 @@ THE SOFTWARE.
 #include "DslServices.h"
 #include "DslServicesValidate.h"
 #include "DslPadProbeHandler.h"
+#include <climits>
 
 namespace DSL
 {
@@ -34,7 +35,7 @@ namespace DSL
         dsl_pph_custom_client_handler_cb clientHandler, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -61,7 +62,7 @@ namespace DSL
         dsl_pph_meter_client_handler_cb clientHandler, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -94,7 +95,7 @@ namespace DSL
     DslReturnType Services::PphMeterIntervalGet(const char* name, uint* interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -102,7 +103,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, MeterPadProbeHandler);
 
             DSL_PPH_METER_PTR pMeter = 
-                std::dynamic_pointer_cast<MeterPadProbeHandler>(m_padProbeHandlers[name]);
+                std::dynamic_pointer_cast<MeterPadProbeHandler>(m_padProbeHandlers.at(name));
 
             *interval = pMeter->GetInterval();
 
@@ -121,7 +122,7 @@ namespace DSL
     DslReturnType Services::PphMeterIntervalSet(const char* name, uint interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -153,11 +154,407 @@ namespace DSL
             return DSL_RESULT_PPH_THREW_EXCEPTION;
         }
     }
+
+    DslReturnType Services::PphMeterStatsNew(const char* name, uint interval, 
+        dsl_pph_meter_stats_handler_cb statsHandler, void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            // ensure handler name uniqueness 
+            if (m_padProbeHandlers.find(name) != m_padProbeHandlers.end())
+            {   
+                LOG_ERROR("Meter Pad Probe Handler name '" << name << "' is not unique");
+                return DSL_RESULT_PPH_NAME_NOT_UNIQUE;
+            }
+            if (!interval)
+            {
+                LOG_ERROR("Meter Pad Probe Handler '" << name << "' failed to set property, interval must be greater than 0");
+                return DSL_RESULT_PPH_METER_INVALID_INTERVAL;
+            }
+            m_padProbeHandlers[name] = DSL_PPH_METER_STATS_NEW(name, 
+                interval, statsHandler, clientData);
+
+            LOG_INFO("New Meter Stats Pad Probe Handler '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Meter Stats Pad Probe handler '" << name << "' threw exception on create");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphMeterStallThresholdGet(const char* name, uint* threshold)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, MeterPadProbeHandler);
+
+            DSL_PPH_METER_PTR pMeter = 
+                std::dynamic_pointer_cast<MeterPadProbeHandler>(m_padProbeHandlers.at(name));
+
+            *threshold = pMeter->GetStallThreshold();
+
+            LOG_INFO("Meter Pad Probe Handler '" << name << "' returned Stall Threshold = "
+                << *threshold << "' successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Meter Pad Probe Handler '" << name << "' threw an exception getting stall threshold");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphMeterStallThresholdSet(const char* name, uint threshold)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, MeterPadProbeHandler);
+
+            DSL_PPH_METER_PTR pMeter = 
+                std::dynamic_pointer_cast<MeterPadProbeHandler>(m_padProbeHandlers[name]);
+
+            pMeter->SetStallThreshold(threshold);
+
+            LOG_INFO("Meter Pad Probe Handler '" << name << "' set Stall Threshold = "
+                << threshold << "' successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Meter Pad Probe Handler '" << name << "' threw an exception setting stall threshold");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
     
+    DslReturnType Services::PphLatencyNew(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            // ensure handler name uniqueness 
+            if (m_padProbeHandlers.find(name) != m_padProbeHandlers.end())
+            {   
+                LOG_ERROR("Latency Pad Probe Handler name '" << name << "' is not unique");
+                return DSL_RESULT_PPH_NAME_NOT_UNIQUE;
+            }
+            m_padProbeHandlers[name] = DSL_PPH_LATENCY_NEW(name);
+
+            LOG_INFO("New Latency Pad Probe Handler '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Latency Pad Probe Handler '" << name << "' threw exception on create");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphLatencySegmentCountGet(const char* name, uint* count)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, 
+                name, LatencyPadProbeHandler);
+
+            DSL_PPH_LATENCY_PTR pLatency = 
+                std::dynamic_pointer_cast<LatencyPadProbeHandler>(m_padProbeHandlers.at(name));
+
+            *count = pLatency->GetSegmentCount();
+
+            LOG_INFO("Latency Pad Probe Handler '" << name 
+                << "' returned Segment Count = " << *count << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Latency Pad Probe Handler '" << name 
+                << "' threw an exception getting segment count");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphLatencySegmentNameGet(const char* name, 
+        uint segment, const char** segmentName)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, 
+                name, LatencyPadProbeHandler);
+
+            DSL_PPH_LATENCY_PTR pLatency = 
+                std::dynamic_pointer_cast<LatencyPadProbeHandler>(m_padProbeHandlers.at(name));
+
+            if (segment >= pLatency->GetSegmentCount())
+            {
+                LOG_ERROR("Segment " << segment 
+                    << " is out of range for Latency Pad Probe Handler '" << name << "'");
+                return DSL_RESULT_PPH_LATENCY_SEGMENT_INVALID;
+            }
+            *segmentName = pLatency->GetSegmentName(segment);
+
+            LOG_INFO("Latency Pad Probe Handler '" << name 
+                << "' returned Segment Name = '" << *segmentName << "' successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Latency Pad Probe Handler '" << name 
+                << "' threw an exception getting segment name");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphLatencySegmentStatsGet(const char* name, 
+        uint segment, dsl_latency_stats* stats)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, 
+                name, LatencyPadProbeHandler);
+
+            DSL_PPH_LATENCY_PTR pLatency = 
+                std::dynamic_pointer_cast<LatencyPadProbeHandler>(m_padProbeHandlers.at(name));
+
+            if (!pLatency->GetSegmentStats(segment, stats))
+            {
+                LOG_ERROR("Segment " << segment 
+                    << " is out of range for Latency Pad Probe Handler '" << name << "'");
+                return DSL_RESULT_PPH_LATENCY_SEGMENT_INVALID;
+            }
+            LOG_INFO("Latency Pad Probe Handler '" << name 
+                << "' returned stats for Segment " << segment << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Latency Pad Probe Handler '" << name 
+                << "' threw an exception getting segment stats");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphLatencyStatsClear(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, 
+                name, LatencyPadProbeHandler);
+
+            DSL_PPH_LATENCY_PTR pLatency = 
+                std::dynamic_pointer_cast<LatencyPadProbeHandler>(m_padProbeHandlers[name]);
+
+            pLatency->ClearStats();
+
+            LOG_INFO("Latency Pad Probe Handler '" << name 
+                << "' cleared stats successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Latency Pad Probe Handler '" << name 
+                << "' threw an exception clearing stats");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphShmExportNew(const char* name, 
+        const char* shmName, uint capacity)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            // ensure handler name uniqueness 
+            if (m_padProbeHandlers.find(name) != m_padProbeHandlers.end())
+            {   
+                LOG_ERROR("Shm Export Pad Probe Handler name '" << name 
+                    << "' is not unique");
+                return DSL_RESULT_PPH_NAME_NOT_UNIQUE;
+            }
+            std::string shmNameStr(shmName);
+            
+            // POSIX portable object name - a single leading "/" and no other.
+            if (shmNameStr.size() < 2 or shmNameStr.size() > NAME_MAX or
+                shmNameStr[0] != '/' or 
+                shmNameStr.find('/', 1) != std::string::npos)
+            {
+                LOG_ERROR("Invalid shared-memory name '" << shmNameStr 
+                    << "' for Shm Export Pad Probe Handler '" << name << "'");
+                return DSL_RESULT_PPH_SHM_EXPORT_PARAMS_INVALID;
+            }
+            if (!capacity or capacity > DSL_SHM_EXPORT_MAX_CAPACITY)
+            {
+                LOG_ERROR("Invalid capacity " << capacity 
+                    << " for Shm Export Pad Probe Handler '" << name 
+                    << "' - must be between 1 and " << DSL_SHM_EXPORT_MAX_CAPACITY);
+                return DSL_RESULT_PPH_SHM_EXPORT_PARAMS_INVALID;
+            }
+            for (auto const& imap: m_padProbeHandlers)
+            {
+                if (imap.second->IsType(typeid(ShmExportPadProbeHandler)) and
+                    shmNameStr == std::dynamic_pointer_cast<ShmExportPadProbeHandler>
+                        (imap.second)->GetShmName())
+                {
+                    LOG_ERROR("Shared-memory name '" << shmNameStr 
+                        << "' is in use by Shm Export Pad Probe Handler '" 
+                        << imap.first << "'");
+                    return DSL_RESULT_PPH_SHM_EXPORT_NAME_IN_USE;
+                }
+            }
+            m_padProbeHandlers[name] = DSL_PPH_SHM_EXPORT_NEW(name, 
+                shmName, capacity);
+
+            LOG_INFO("New Shm Export Pad Probe Handler '" << name 
+                << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Shm Export Pad Probe Handler '" << name 
+                << "' threw exception on create");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphShmExportStatsGet(const char* name, 
+        uint64_t* frames, uint64_t* records)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, 
+                name, ShmExportPadProbeHandler);
+
+            DSL_PPH_SHM_EXPORT_PTR pShmExport = 
+                std::dynamic_pointer_cast<ShmExportPadProbeHandler>(
+                    m_padProbeHandlers.at(name));
+
+            pShmExport->GetStats(frames, records);
+
+            LOG_INFO("Shm Export Pad Probe Handler '" << name 
+                << "' returned frames = " << *frames << " and records = " 
+                << *records << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Shm Export Pad Probe Handler '" << name 
+                << "' threw an exception getting stats");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphMetaRecorderNew(const char* name, 
+        const char* filePath)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            // ensure handler name uniqueness 
+            if (m_padProbeHandlers.find(name) != m_padProbeHandlers.end())
+            {   
+                LOG_ERROR("Meta Recorder Pad Probe Handler name '" << name 
+                    << "' is not unique");
+                return DSL_RESULT_PPH_NAME_NOT_UNIQUE;
+            }
+            m_padProbeHandlers[name] = DSL_PPH_META_RECORDER_NEW(name, filePath);
+
+            LOG_INFO("New Meta Recorder Pad Probe Handler '" << name 
+                << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Meta Recorder Pad Probe Handler '" << name 
+                << "' threw exception on create");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphMetaRecorderStatsGet(const char* name, 
+        uint64_t* batches, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, 
+                name, MetaRecorderPadProbeHandler);
+
+            DSL_PPH_META_RECORDER_PTR pMetaRecorder = 
+                std::dynamic_pointer_cast<MetaRecorderPadProbeHandler>(
+                    m_padProbeHandlers.at(name));
+
+            pMetaRecorder->GetStats(batches, dropped);
+
+            LOG_INFO("Meta Recorder Pad Probe Handler '" << name 
+                << "' returned batches = " << *batches << " and dropped = " 
+                << *dropped << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Meta Recorder Pad Probe Handler '" << name 
+                << "' threw an exception getting stats");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::PphOdeNew(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {   
@@ -183,7 +580,7 @@ namespace DSL
     DslReturnType Services::PphOdeTriggerAdd(const char* name, const char* trigger)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -224,7 +621,7 @@ namespace DSL
     DslReturnType Services::PphOdeTriggerRemove(const char* name, const char* trigger)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -261,7 +658,7 @@ namespace DSL
     DslReturnType Services::PphOdeTriggerRemoveAll(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -285,7 +682,7 @@ namespace DSL
     DslReturnType Services::PphOdeDisplayMetaAllocSizeGet(const char* name, uint* size)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -293,7 +690,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, OdePadProbeHandler);
 
             DSL_PPH_ODE_PTR pOde = 
-                std::dynamic_pointer_cast<OdePadProbeHandler>(m_padProbeHandlers[name]);
+                std::dynamic_pointer_cast<OdePadProbeHandler>(m_padProbeHandlers.at(name));
             
             *size = pOde->GetDisplayMetaAllocSize();
 
@@ -313,7 +710,7 @@ namespace DSL
     DslReturnType Services::PphOdeDisplayMetaAllocSizeSet(const char* name, uint size)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -338,11 +735,128 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::PphOdeParallelFramesGet(const char* name, uint* workers)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, OdePadProbeHandler);
+
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(m_padProbeHandlers.at(name));
+            
+            *workers = pOde->GetParallelFrames();
+
+            LOG_INFO("ODE Pad Probe Handler '" << name 
+                << "' returned parallel frame workers = " << *workers << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception getting parallel frame workers");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphOdeParallelFramesSet(const char* name, uint workers)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, name, OdePadProbeHandler);
+            
+            DSL_PPH_ODE_PTR pOde = 
+                std::dynamic_pointer_cast<OdePadProbeHandler>(m_padProbeHandlers[name]); 
+
+            if (!pOde->SetParallelFrames(workers))
+            {
+                LOG_ERROR("ODE Pad Probe Handler '" << name 
+                    << "' failed to set parallel frame workers = " << workers);
+                return DSL_RESULT_PPH_SET_FAILED;
+            }
+            LOG_INFO("ODE Pad Probe Handler '" << name 
+                << "' set parallel frame workers = " << workers << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception setting parallel frame workers");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::PphOdeMetaReplay(const char* name, 
+        const char* filePath, uint64_t* frames)
+    {
+        LOG_FUNC();
+        
+        DSL_PPH_ODE_PTR pOde;
+        
+        // The services lock is only held to find the handler. Replay can run
+        // for a long time and ODE Actions may call back into the services.
+        {
+            LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+            
+            DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_padProbeHandlers, 
+                name, OdePadProbeHandler);
+            
+            pOde = std::dynamic_pointer_cast<OdePadProbeHandler>(
+                m_padProbeHandlers[name]); 
+        }
+        
+        DSL_META_RECORD_READER_PTR pReader;
+        try
+        {
+            pReader = DSL_META_RECORD_READER_NEW(filePath);
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' failed to open Meta Record file '" << filePath << "'");
+            return DSL_RESULT_PPH_META_FILE_INVALID;
+        }
+        
+        try
+        {
+            GstPadProbeInfo info{};
+            info.type = GST_PAD_PROBE_TYPE_BUFFER;
+            
+            while (pReader->ReadBatch())
+            {
+                info.data = pReader->GetBuffer();
+                pOde->HandlePadData(&info);
+            }
+            *frames = pReader->GetFrameCount();
+            
+            LOG_INFO("ODE Pad Probe Handler '" << name << "' replayed " 
+                << *frames << " frames from '" << filePath << "' successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << name 
+                << "' threw an exception replaying '" << filePath << "'");
+            return DSL_RESULT_PPH_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::PphBufferTimeoutNew(const char* name,
         uint timeout, dsl_pph_buffer_timeout_handler_cb handler, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {   
@@ -373,7 +887,7 @@ namespace DSL
         dsl_pph_eos_handler_cb handler, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {   
@@ -403,13 +917,13 @@ namespace DSL
     DslReturnType Services::PphEnabledGet(const char* name, boolean* enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
             DSL_RETURN_IF_PPH_NAME_NOT_FOUND(m_padProbeHandlers, name);
 
-            *enabled = m_padProbeHandlers[name]->GetEnabled();
+            *enabled = m_padProbeHandlers.at(name)->GetEnabled();
 
             LOG_INFO("Pad Probe Handler '" << name << "' returned Enabled = "
                 << *enabled << "' successfully");
@@ -427,7 +941,7 @@ namespace DSL
    DslReturnType Services::PphEnabledSet(const char* name, boolean enabled)
    {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -455,7 +969,7 @@ namespace DSL
     DslReturnType Services::PphDelete(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -482,7 +996,7 @@ namespace DSL
     DslReturnType Services::PphDeleteAll()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -515,7 +1029,7 @@ namespace DSL
     uint Services::PphListSize()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         return m_padProbeHandlers.size();
     }
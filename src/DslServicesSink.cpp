@@ -34,7 +34,7 @@ namespace DSL
         dsl_sink_app_new_data_handler_cb clientHandler, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -67,7 +67,7 @@ namespace DSL
     DslReturnType Services::SinkAppDataTypeGet(const char* name, uint* dataType)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -96,7 +96,7 @@ namespace DSL
     DslReturnType Services::SinkAppDataTypeSet(const char* name, uint dataType)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -129,10 +129,260 @@ namespace DSL
         }
     }
         
+    DslReturnType Services::SinkAppQueuedNew(const char* name, uint dataType,
+        uint maxSize, uint policy)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Sink name '" << name << "' is not unique");
+                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+            }
+            if (dataType > DSL_SINK_APP_DATA_TYPE_BUFFER)
+            {
+                LOG_ERROR("Invalid data-type = " << dataType 
+                    << " specified for App Sink '" << name << "'");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            if (!maxSize or policy > DSL_SINK_APP_QUEUE_POLICY_BLOCK)
+            {
+                LOG_ERROR("Invalid queue settings max-size = " << maxSize 
+                    << ", policy = " << policy << " specified for App Sink '" 
+                    << name << "'");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            m_components[name] = DSL_APP_SINK_QUEUED_NEW(name,
+                dataType, maxSize, policy);
+
+            LOG_INFO("New queued App Sink '" << name 
+                << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New queued App Sink '" << name 
+                << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkAppQueueSettingsGet(const char* name, 
+        uint* maxSize, uint* policy)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSinkBintr);
+
+            DSL_APP_SINK_PTR pAppSinkBintr = 
+                std::dynamic_pointer_cast<AppSinkBintr>(m_components[name]);
+
+            if (!pAppSinkBintr->GetQueueEnabled())
+            {
+                LOG_ERROR("App Sink '" << name << "' is not in queued mode");
+                return DSL_RESULT_SINK_APP_QUEUE_NOT_ENABLED;
+            }
+            pAppSinkBintr->GetQueueSettings(maxSize, policy);
+            
+            LOG_INFO("App Sink '" << name << "' returned queue max-size = " 
+                << *maxSize << " and policy = " << *policy << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Sink'" << name 
+                << "' threw an exception getting queue settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkAppQueueSettingsSet(const char* name, 
+        uint maxSize, uint policy)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSinkBintr);
+
+            DSL_APP_SINK_PTR pAppSinkBintr = 
+                std::dynamic_pointer_cast<AppSinkBintr>(m_components[name]);
+
+            if (!pAppSinkBintr->GetQueueEnabled())
+            {
+                LOG_ERROR("App Sink '" << name << "' is not in queued mode");
+                return DSL_RESULT_SINK_APP_QUEUE_NOT_ENABLED;
+            }
+            if (!maxSize or policy > DSL_SINK_APP_QUEUE_POLICY_BLOCK)
+            {
+                LOG_ERROR("Invalid queue settings max-size = " << maxSize 
+                    << ", policy = " << policy << " specified for App Sink '" 
+                    << name << "'");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            if (!pAppSinkBintr->SetQueueSettings(maxSize, policy))
+            {
+                LOG_ERROR("App Sink '" << name 
+                    << "' failed to set queue settings");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            LOG_INFO("App Sink '" << name << "' set queue max-size = " 
+                << maxSize << " and policy = " << policy << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Sink'" << name 
+                << "' threw an exception setting queue settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkAppPullBatch(const char* name, 
+        void** data, uint maxCount, uint* count)
+    {
+        // No function log - avoid overhead.
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSinkBintr);
+
+            DSL_APP_SINK_PTR pAppSinkBintr = 
+                std::dynamic_pointer_cast<AppSinkBintr>(m_components[name]);
+
+            if (!pAppSinkBintr->GetQueueEnabled())
+            {
+                LOG_ERROR("App Sink '" << name << "' is not in queued mode");
+                return DSL_RESULT_SINK_APP_QUEUE_NOT_ENABLED;
+            }
+            *count = pAppSinkBintr->PullBatch(data, maxCount);
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Sink'" << name 
+                << "' threw an exception pulling a batch");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkAppBatchRelease(void** data, uint count)
+    {
+        // No function log - avoid overhead.
+        
+        // No services lock required - the references are owned by the client.
+        try
+        {
+            for (uint i = 0; i < count; i++)
+            {
+                if (data[i])
+                {
+                    gst_mini_object_unref(GST_MINI_OBJECT(data[i]));
+                    data[i] = NULL;
+                }
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Sink threw an exception releasing a batch");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkAppQueueStatsGet(const char* name, 
+        uint* depth, uint* highWater, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSinkBintr);
+
+            DSL_APP_SINK_PTR pAppSinkBintr = 
+                std::dynamic_pointer_cast<AppSinkBintr>(m_components[name]);
+
+            if (!pAppSinkBintr->GetQueueEnabled())
+            {
+                LOG_ERROR("App Sink '" << name << "' is not in queued mode");
+                return DSL_RESULT_SINK_APP_QUEUE_NOT_ENABLED;
+            }
+            pAppSinkBintr->GetQueueStats(depth, highWater, dropped);
+            
+            LOG_INFO("App Sink '" << name << "' returned queue depth = " 
+                << *depth << ", high-water = " << *highWater 
+                << ", dropped = " << *dropped << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Sink'" << name 
+                << "' threw an exception getting queue stats");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkAppQueueStatsClear(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSinkBintr);
+
+            DSL_APP_SINK_PTR pAppSinkBintr = 
+                std::dynamic_pointer_cast<AppSinkBintr>(m_components[name]);
+
+            if (!pAppSinkBintr->GetQueueEnabled())
+            {
+                LOG_ERROR("App Sink '" << name << "' is not in queued mode");
+                return DSL_RESULT_SINK_APP_QUEUE_NOT_ENABLED;
+            }
+            pAppSinkBintr->ClearQueueStats();
+            
+            LOG_INFO("App Sink '" << name 
+                << "' cleared queue stats successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Sink'" << name 
+                << "' threw an exception clearing queue stats");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+        
     DslReturnType Services::SinkFakeNew(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -159,7 +409,7 @@ namespace DSL
         uint depth, uint offsetX, uint offsetY, uint width, uint height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -197,7 +447,7 @@ namespace DSL
         uint offsetX, uint offsetY, uint width, uint height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -224,7 +474,7 @@ namespace DSL
         boolean* force)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -253,7 +503,7 @@ namespace DSL
         boolean force)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -285,7 +535,7 @@ namespace DSL
     DslReturnType Services::SinkRenderOffsetsGet(const char* name, uint* offsetX, uint* offsetY)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -312,7 +562,7 @@ namespace DSL
     DslReturnType Services::SinkRenderOffsetsSet(const char* name, uint offsetX, uint offsetY)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -342,7 +592,7 @@ namespace DSL
     DslReturnType Services::SinkRenderDimensionsGet(const char* name, uint* width, uint* height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -369,7 +619,7 @@ namespace DSL
     DslReturnType Services::SinkRenderDimensionsSet(const char* name, uint width, uint height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -399,7 +649,7 @@ namespace DSL
     DslReturnType Services::SinkRenderReset(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -429,7 +679,7 @@ namespace DSL
             uint codec, uint container, uint bitrate, uint interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -466,7 +716,7 @@ namespace DSL
         uint bitrate, uint interval, dsl_record_client_listener_cb clientListener)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -514,7 +764,7 @@ namespace DSL
         uint start, uint duration, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -543,7 +793,7 @@ namespace DSL
     DslReturnType Services::SinkRecordSessionStop(const char* name, boolean sync)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -572,7 +822,7 @@ namespace DSL
     DslReturnType Services::SinkRecordOutdirGet(const char* name, const char** outdir)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -597,7 +847,7 @@ namespace DSL
     DslReturnType Services::SinkRecordOutdirSet(const char* name, const char* outdir)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -626,7 +876,7 @@ namespace DSL
     DslReturnType Services::SinkRecordContainerGet(const char* name, uint* container)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -654,7 +904,7 @@ namespace DSL
     DslReturnType Services::SinkRecordContainerSet(const char* name, uint container)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -691,7 +941,7 @@ namespace DSL
     DslReturnType Services::SinkRecordCacheSizeGet(const char* name, uint* cacheSize)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -719,7 +969,7 @@ namespace DSL
     DslReturnType Services::SinkRecordCacheSizeSet(const char* name, uint cacheSize)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -749,7 +999,7 @@ namespace DSL
     DslReturnType Services::SinkRecordDimensionsGet(const char* name, uint* width, uint* height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -777,7 +1027,7 @@ namespace DSL
     DslReturnType Services::SinkRecordDimensionsSet(const char* name, uint width, uint height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -809,7 +1059,7 @@ namespace DSL
     DslReturnType Services::SinkRecordIsOnGet(const char* name, boolean* isOn)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -837,7 +1087,7 @@ namespace DSL
     DslReturnType Services::SinkRecordResetDoneGet(const char* name, boolean* resetDone)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -865,7 +1115,7 @@ namespace DSL
         const char* player)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
     
         try
         {
@@ -900,7 +1150,7 @@ namespace DSL
         const char* player)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -935,7 +1185,7 @@ namespace DSL
         const char* mailer, const char* subject)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
     
         try
         {
@@ -966,7 +1216,7 @@ namespace DSL
         const char* mailer)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
     
         try
         {
@@ -999,7 +1249,7 @@ namespace DSL
         uint* codec, uint* bitrate, uint* interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1027,7 +1277,7 @@ namespace DSL
         uint codec, uint bitrate, uint interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1065,7 +1315,7 @@ namespace DSL
             uint udpPort, uint rtspPort, uint codec, uint bitrate, uint interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1096,7 +1346,7 @@ namespace DSL
     DslReturnType Services::SinkRtspServerSettingsGet(const char* name, uint* udpPort, uint* rtspPort)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1124,7 +1374,7 @@ namespace DSL
         boolean forwardEos, boolean forwardEvents)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1155,7 +1405,7 @@ namespace DSL
         boolean* forwardEos, boolean* forwardEvents)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1189,7 +1439,7 @@ namespace DSL
         boolean forwardEos, boolean forwardEvents)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1225,7 +1475,7 @@ namespace DSL
         uint* numListeners)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1257,7 +1507,7 @@ namespace DSL
         const char* connectionString, const char* topic)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1308,7 +1558,7 @@ namespace DSL
         uint* metaType)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1337,7 +1587,7 @@ namespace DSL
         uint metaType)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1374,7 +1624,7 @@ namespace DSL
         const char** converterConfigFile, uint* payloadType)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1407,7 +1657,7 @@ namespace DSL
         const char* converterConfigFile, uint payloadType)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1450,7 +1700,7 @@ namespace DSL
         const char** connectionString, const char** topic)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1484,7 +1734,7 @@ namespace DSL
         const char* connectionString, const char* topic)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1525,7 +1775,7 @@ namespace DSL
     DslReturnType Services::SinkPphAdd(const char* name, const char* handler)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -1553,7 +1803,7 @@ namespace DSL
     DslReturnType Services::SinkPphRemove(const char* name, const char* handler) 
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
         
         try
@@ -1582,7 +1832,7 @@ namespace DSL
     DslReturnType Services::SinkSyncEnabledGet(const char* name,  boolean* enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
         
         try
@@ -1612,7 +1862,7 @@ namespace DSL
     DslReturnType Services::SinkSyncEnabledSet(const char* name,  boolean enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
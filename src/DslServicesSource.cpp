@@ -34,7 +34,7 @@ namespace DSL
         const char* bufferInFormat, uint width, uint height, uint fpsN, uint fpsD)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -64,7 +64,7 @@ namespace DSL
         void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -98,7 +98,7 @@ namespace DSL
     DslReturnType Services::SourceAppDataHandlersRemove(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -131,7 +131,7 @@ namespace DSL
     DslReturnType Services::SourceAppBufferPush(const char* name, void* buffer)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -163,7 +163,7 @@ namespace DSL
     DslReturnType Services::SourceAppSamplePush(const char* name, void* sample)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -192,10 +192,167 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::SourceAppMemoryPush(const char* name, void* data, 
+        uint size, dsl_source_app_memory_release_cb releaseHandler, 
+        void* clientData)
+    {
+        // No function log - avoid overhead.
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSourceBintr);
+
+            DSL_APP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
+
+            if (!pSourceBintr->PushMemory(data, size, 
+                releaseHandler, clientData))
+            {
+                LOG_ERROR("Failed to push memory to App Source '" 
+                    << name << "'");
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
+            // don't log successful case for performance reasons
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Source '" << name 
+                << "' threw exception on push memory");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceAppBufferPoolSizeGet(const char* name, 
+        uint* size)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSourceBintr);
+
+            DSL_APP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components.at(name));
+
+            *size = pSourceBintr->GetBufferPoolSize();
+
+            LOG_INFO("App Source '" << name << "' returned buffer-pool size = "
+                << *size << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Source '" << name 
+                << "' threw exception getting buffer-pool size");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceAppBufferPoolSizeSet(const char* name, 
+        uint size)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSourceBintr);
+
+            DSL_APP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
+
+            if (!pSourceBintr->SetBufferPoolSize(size))
+            {
+                LOG_ERROR("App Source '" << name 
+                    << "' failed to set buffer-pool size = " << size);
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
+
+            LOG_INFO("App Source '" << name << "' set buffer-pool size = "
+                << size << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Source '" << name 
+                << "' threw exception setting buffer-pool size");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceAppBufferAcquire(const char* name, 
+        void** buffer, void** data, uint* size)
+    {
+        // No function log - avoid overhead.
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSourceBintr);
+
+            DSL_APP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
+
+            if (!pSourceBintr->AcquireBuffer(buffer, data, size))
+            {
+                // Not logged as an error - the pool may simply be empty.
+                return DSL_RESULT_SOURCE_BUFFER_ACQUIRE_FAILED;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Source '" << name 
+                << "' threw exception on buffer acquire");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceAppBufferRelease(const char* name, 
+        void* buffer)
+    {
+        // No function log - avoid overhead.
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSourceBintr);
+
+            DSL_APP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
+
+            pSourceBintr->ReleaseBuffer(buffer);
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Source '" << name 
+                << "' threw exception on buffer release");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::SourceAppEos(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -229,7 +386,7 @@ namespace DSL
         uint* streamFormat)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -238,7 +395,7 @@ namespace DSL
                 AppSourceBintr);
 
             DSL_APP_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components.at(name));
 
             *streamFormat = pSourceBintr->GetStreamFormat();
             
@@ -259,7 +416,7 @@ namespace DSL
         uint streamFormat)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -293,7 +450,7 @@ namespace DSL
         boolean* doTimestamp)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -301,7 +458,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
             
             DSL_APP_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components.at(name));
          
             *doTimestamp = pSourceBintr->GetDoTimestamp();
 
@@ -321,7 +478,7 @@ namespace DSL
         boolean doTimestamp)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -354,7 +511,7 @@ namespace DSL
         boolean* enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -363,7 +520,7 @@ namespace DSL
                 AppSourceBintr);
 
             DSL_APP_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components.at(name));
 
             *enabled = pSourceBintr->GetBlockEnabled();
             
@@ -384,7 +541,7 @@ namespace DSL
         boolean enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -418,7 +575,7 @@ namespace DSL
         uint64_t* level)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -427,7 +584,7 @@ namespace DSL
                 AppSourceBintr);
 
             DSL_APP_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components.at(name));
 
             *level = pSourceBintr->GetCurrentLevelBytes();
             
@@ -449,7 +606,7 @@ namespace DSL
         uint64_t* level)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -458,7 +615,7 @@ namespace DSL
                 AppSourceBintr);
 
             DSL_APP_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components.at(name));
 
             *level = pSourceBintr->GetMaxLevelBytes();
             
@@ -480,7 +637,7 @@ namespace DSL
         uint64_t level)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -511,11 +668,111 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::SourceAppMinLevelPercentGet(const char* name,
+        uint* percent)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSourceBintr);
+
+            DSL_APP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components.at(name));
+
+            *percent = pSourceBintr->GetMinLevelPercent();
+
+            LOG_INFO("App Source '" << name << "' returned min-level-percent = "
+                << *percent << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Source '" << name 
+                << "' threw exception getting min-level-percent");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceAppMinLevelPercentSet(const char* name,
+        uint percent)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSourceBintr);
+
+            DSL_APP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components[name]);
+
+            if (percent > 100)
+            {
+                LOG_ERROR("Invalid min-level-percent = " << percent
+                    << " for App Source '" << name << "'");
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
+            if (!pSourceBintr->SetMinLevelPercent(percent))
+            {
+                LOG_ERROR("App Source '" << name 
+                    << "' failed to set min-level-percent = " << percent);
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
+
+            LOG_INFO("App Source '" << name << "' set min-level-percent = "
+                << percent << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Source '" << name 
+                << "' threw exception setting min-level-percent");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceAppDataStateGet(const char* name,
+        uint* state)
+    {
+        // No function log - avoid overhead.
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                AppSourceBintr);
+
+            DSL_APP_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<AppSourceBintr>(m_components.at(name));
+
+            *state = pSourceBintr->GetDataState();
+
+            // don't log successful case for performance reasons
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("App Source '" << name 
+                << "' threw exception getting data-state");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
 //    DslReturnType Services::SourceAppLeakyTypeGet(const char* name,
 //        uint* leakyType)
 //    {
 //        LOG_FUNC();
-//        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+//        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 //
 //        try
 //        {
@@ -545,7 +802,7 @@ namespace DSL
 //        uint leakyType)
 //    {
 //        LOG_FUNC();
-//        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+//        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 //
 //        try
 //        {
@@ -586,7 +843,7 @@ namespace DSL
         uint width, uint height, uint fpsN, uint fpsD)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -622,7 +879,7 @@ namespace DSL
             uint* sensorId)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -632,7 +889,7 @@ namespace DSL
 
 
             DSL_CSI_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<CsiSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<CsiSourceBintr>(m_components.at(name));
 
             *sensorId = pSourceBintr->GetSensorId();
 
@@ -654,7 +911,7 @@ namespace DSL
             uint sensorId)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -688,7 +945,7 @@ namespace DSL
         uint width, uint height, uint fpsN, uint fpsD)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -715,7 +972,7 @@ namespace DSL
             const char** deviceLocation)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -725,7 +982,7 @@ namespace DSL
 
 
             DSL_USB_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<UsbSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<UsbSourceBintr>(m_components.at(name));
 
             *deviceLocation = pSourceBintr->GetDeviceLocation();
 
@@ -747,7 +1004,7 @@ namespace DSL
             const char* deviceLocation)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -781,7 +1038,7 @@ namespace DSL
         boolean isLive, uint skipFrames, uint dropFrameInterval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -824,7 +1081,7 @@ namespace DSL
             boolean repeatEnabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -862,7 +1119,7 @@ namespace DSL
         const char** filePath)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -871,7 +1128,7 @@ namespace DSL
                 FileSourceBintr);
 
             DSL_FILE_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<FileSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<FileSourceBintr>(m_components.at(name));
 
             *filePath = pSourceBintr->GetUri();
 
@@ -893,7 +1150,7 @@ namespace DSL
         const char* filePath)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -926,7 +1183,7 @@ namespace DSL
     DslReturnType Services::SourceFileRepeatEnabledGet(const char* name, boolean* enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -934,7 +1191,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, FileSourceBintr);
 
             DSL_FILE_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<FileSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<FileSourceBintr>(m_components.at(name));
          
             *enabled = pSourceBintr->GetRepeatEnabled();
 
@@ -954,7 +1211,7 @@ namespace DSL
         boolean enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -988,7 +1245,7 @@ namespace DSL
         const char* filePath)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1023,7 +1280,7 @@ namespace DSL
         const char* filePath, uint fpsN, uint fpsD)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1053,7 +1310,7 @@ namespace DSL
         boolean* enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1062,7 +1319,7 @@ namespace DSL
                 MultiImageSourceBintr);
 
             DSL_MULTI_IMAGE_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<MultiImageSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<MultiImageSourceBintr>(m_components.at(name));
          
             *enabled = pSourceBintr->GetLoopEnabled();
 
@@ -1083,7 +1340,7 @@ namespace DSL
         boolean enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1117,7 +1374,7 @@ namespace DSL
         int* startIndex, int* stopIndex)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1126,7 +1383,7 @@ namespace DSL
                 MultiImageSourceBintr);
 
             DSL_MULTI_IMAGE_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<MultiImageSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<MultiImageSourceBintr>(m_components.at(name));
          
             pSourceBintr->GetIndices(startIndex, stopIndex);
 
@@ -1148,7 +1405,7 @@ namespace DSL
         int startIndex, int stopIndex)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1191,7 +1448,7 @@ namespace DSL
         boolean isLive, uint fpsN, uint fpsD, uint timeout)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1224,7 +1481,7 @@ namespace DSL
     DslReturnType Services::SourceImageStreamTimeoutGet(const char* name, uint* timeout)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1232,7 +1489,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageStreamSourceBintr);
 
             DSL_IMAGE_STREAM_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<ImageStreamSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<ImageStreamSourceBintr>(m_components.at(name));
          
             *timeout = pSourceBintr->GetTimeout();
 
@@ -1251,7 +1508,7 @@ namespace DSL
     DslReturnType Services::SourceImageStreamTimeoutSet(const char* name, uint timeout)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1283,7 +1540,7 @@ namespace DSL
         const char** filePath)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1291,7 +1548,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_IMAGE_SOURCE(m_components, name);
 
             DSL_RESOURCE_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<ResourceSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<ResourceSourceBintr>(m_components.at(name));
 
             *filePath = pSourceBintr->GetUri();
 
@@ -1313,7 +1570,7 @@ namespace DSL
         const char* filePath)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1347,7 +1604,7 @@ namespace DSL
         boolean acceptEos, boolean acceptEvents)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1377,7 +1634,7 @@ namespace DSL
         const char** listenTo)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1386,7 +1643,7 @@ namespace DSL
                 InterpipeSourceBintr);
 
             DSL_INTERPIPE_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<InterpipeSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<InterpipeSourceBintr>(m_components.at(name));
          
             *listenTo = pSourceBintr->GetListenTo();
 
@@ -1407,7 +1664,7 @@ namespace DSL
         const char* listenTo)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1437,7 +1694,7 @@ namespace DSL
         boolean* acceptEos, boolean* acceptEvents)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1446,7 +1703,7 @@ namespace DSL
                 InterpipeSourceBintr);
 
             DSL_INTERPIPE_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<InterpipeSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<InterpipeSourceBintr>(m_components.at(name));
          
             bool bAcceptEos(false), bAcceptEvents(false);
             pSourceBintr->GetAcceptSettings(&bAcceptEos, &bAcceptEvents);
@@ -1471,7 +1728,7 @@ namespace DSL
         boolean acceptEos, boolean acceptEvents)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1507,7 +1764,7 @@ namespace DSL
        uint skipFrames, uint dropFrameInterval, uint latency, uint timeout)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1534,7 +1791,7 @@ namespace DSL
     DslReturnType Services::SourcePphAdd(const char* name, const char* handler)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -1568,7 +1825,7 @@ namespace DSL
     DslReturnType Services::SourcePphRemove(const char* name, const char* handler) 
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -1602,7 +1859,7 @@ namespace DSL
         const char** mediaType)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1610,7 +1867,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
             
             DSL_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<SourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<SourceBintr>(m_components.at(name));
          
             *mediaType = pSourceBintr->GetMediaType();
 
@@ -1631,7 +1888,7 @@ namespace DSL
         const char** format)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1639,7 +1896,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
             
             DSL_VIDEO_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<VideoSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<VideoSourceBintr>(m_components.at(name));
          
             *format = pSourceBintr->GetBufferOutFormat();
 
@@ -1660,7 +1917,7 @@ namespace DSL
         const char* format)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1694,7 +1951,7 @@ namespace DSL
         uint* width, uint* height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1702,7 +1959,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
             
             DSL_VIDEO_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<VideoSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<VideoSourceBintr>(m_components.at(name));
          
             pSourceBintr->GetBufferOutDimensions(width, height);
 
@@ -1724,7 +1981,7 @@ namespace DSL
         uint width, uint height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1760,7 +2017,7 @@ namespace DSL
         uint cropAt, uint* left, uint* top, uint* width, uint* height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1768,7 +2025,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
             
             DSL_VIDEO_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<VideoSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<VideoSourceBintr>(m_components.at(name));
          
             pSourceBintr->GetBufferOutCropRectangle(cropAt, 
                 left, top, width, height);
@@ -1793,7 +2050,7 @@ namespace DSL
         uint cropAt, uint left, uint top, uint width, uint height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1839,7 +2096,7 @@ namespace DSL
         uint* orientation)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1847,7 +2104,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
             
             DSL_VIDEO_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<VideoSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<VideoSourceBintr>(m_components.at(name));
          
             *orientation = pSourceBintr->GetBufferOutOrientation();
 
@@ -1868,7 +2125,7 @@ namespace DSL
         uint orientation)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1909,7 +2166,7 @@ namespace DSL
         uint* width, uint* height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1917,7 +2174,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
             
             DSL_VIDEO_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<VideoSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<VideoSourceBintr>(m_components.at(name));
          
             pSourceBintr->GetDimensions(width, height);
 
@@ -1936,7 +2193,7 @@ namespace DSL
     DslReturnType Services::SourceFrameRateGet(const char* name, uint* fpsN, uint* fpsD)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -1944,7 +2201,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
             
             DSL_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<VideoSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<VideoSourceBintr>(m_components.at(name));
          
             pSourceBintr->GetFrameRate(fpsN, fpsD);
 
@@ -1963,7 +2220,7 @@ namespace DSL
     DslReturnType Services::SourceUriUriGet(const char* name, const char** uri)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -1972,7 +2229,7 @@ namespace DSL
                 UriSourceBintr);
 
             DSL_URI_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<UriSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<UriSourceBintr>(m_components.at(name));
 
             *uri = pSourceBintr->GetUri();
 
@@ -1992,7 +2249,7 @@ namespace DSL
     DslReturnType Services::SourceUriUriSet(const char* name, const char* uri)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2024,7 +2281,7 @@ namespace DSL
     DslReturnType Services::SourceRtspUriGet(const char* name, const char** uri)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2033,7 +2290,7 @@ namespace DSL
                 RtspSourceBintr);
 
             DSL_RTSP_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<RtspSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<RtspSourceBintr>(m_components.at(name));
 
             *uri = pSourceBintr->GetUri();
 
@@ -2053,7 +2310,7 @@ namespace DSL
     DslReturnType Services::SourceRtspUriSet(const char* name, const char* uri)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2085,7 +2342,7 @@ namespace DSL
     DslReturnType Services::SourceVideoDewarperAdd(const char* name, const char* dewarper)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2122,7 +2379,7 @@ namespace DSL
     DslReturnType Services::SourceVideoDewarperRemove(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2151,7 +2408,7 @@ namespace DSL
     DslReturnType Services::SourceRtspTimeoutGet(const char* name, uint* timeout)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2159,7 +2416,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSourceBintr);   
 
             DSL_RTSP_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<RtspSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<RtspSourceBintr>(m_components.at(name));
                 
             *timeout = pSourceBintr->GetBufferTimeout();
 
@@ -2178,7 +2435,7 @@ namespace DSL
     DslReturnType Services::SourceRtspTimeoutSet(const char* name, uint timeout)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2205,7 +2462,7 @@ namespace DSL
     DslReturnType Services::SourceRtspReconnectionParamsGet(const char* name, uint* sleep, uint* timeout)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2213,7 +2470,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSourceBintr);   
 
             DSL_RTSP_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<RtspSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<RtspSourceBintr>(m_components.at(name));
                 
             pSourceBintr->GetReconnectionParams(sleep, timeout);
             
@@ -2232,7 +2489,7 @@ namespace DSL
     DslReturnType Services::SourceRtspReconnectionParamsSet(const char* name, uint sleep, uint timeout)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2262,7 +2519,7 @@ namespace DSL
     DslReturnType Services::SourceRtspConnectionDataGet(const char* name, dsl_rtsp_connection_data* data)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2270,7 +2527,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSourceBintr);   
 
             DSL_RTSP_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<RtspSourceBintr>(m_components[name]);
+                std::dynamic_pointer_cast<RtspSourceBintr>(m_components.at(name));
                 
             pSourceBintr->GetConnectionData(data);
 
@@ -2288,7 +2545,7 @@ namespace DSL
     DslReturnType Services::SourceRtspConnectionStatsClear(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2315,7 +2572,7 @@ namespace DSL
         dsl_state_change_listener_cb listener, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2377,7 +2634,7 @@ namespace DSL
     DslReturnType Services::SourceRtspTapAdd(const char* name, const char* tap)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2419,7 +2676,7 @@ namespace DSL
     DslReturnType Services::SourceRtspTapRemove(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2454,12 +2711,13 @@ namespace DSL
     
     DslReturnType Services::SourceNameGet(int sourceId, const char** name)
     {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        // No function log - called from streaming threads.
+        // Registry lookup only, does not take the Services lock.
         
-        if (m_sourceNamesById.find(sourceId) != m_sourceNamesById.end())
+        const std::string* pName = m_sourceNamesById.Lookup(sourceId);
+        if (pName)
         {
-            *name = m_sourceNamesById[sourceId].c_str();
+            *name = pName->c_str();
             return DSL_RESULT_SUCCESS;
         }
         *name = NULL;
@@ -2469,11 +2727,12 @@ namespace DSL
     DslReturnType Services::SourceIdGet(const char* name, int* sourceId)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        // Registry lookup only, does not take the Services lock.
         
-        if (m_sourceIdsByName.find(name) != m_sourceIdsByName.end())
+        uint id(0);
+        if (m_sourceIdsByName.Find(name, id))
         {
-            *sourceId = m_sourceIdsByName[name];
+            *sourceId = id;
             return DSL_RESULT_SUCCESS;
         }
         *sourceId = -1;
@@ -2484,8 +2743,9 @@ namespace DSL
     {
         LOG_FUNC();
         
+        // called internally with the writer lock held, do not lock
         
-       uint sourceId(0);
+        uint sourceId(0);
         
         // find the next available unused source-id
         auto ivec = find(m_usedSourceIds.begin(), m_usedSourceIds.end(), false);
@@ -2500,8 +2760,11 @@ namespace DSL
             m_usedSourceIds.push_back(true);
         }            
         
-        m_sourceNamesById[sourceId] = name;
-        m_sourceIdsByName[name] = sourceId;
+        m_sourceNamesById.Set(sourceId, name);
+        m_sourceIdsByName.Set(name, sourceId);
+        
+        // Triggers filtering on this Source by name need to be re-resolved
+        OdeTrigger::s_dispatchGeneration++;
         
         return sourceId;
     }
@@ -2512,22 +2775,24 @@ namespace DSL
 
         // called internally, do not lock mutex
         
-        if (m_sourceIdsByName.find(name) == m_sourceIdsByName.end())
+        uint sourceId(0);
+        if (!m_sourceIdsByName.Find(name, sourceId))
         {
             LOG_ERROR("Source '" << name << "' not found ");
             return false;
         }
         
-        m_usedSourceIds[m_sourceIdsByName[name]] = false;
-        m_sourceNamesById.erase(m_sourceIdsByName[name]);
-        m_sourceIdsByName.erase(name);
+        m_usedSourceIds[sourceId] = false;
+        m_sourceNamesById.Erase(sourceId);
+        m_sourceIdsByName.Erase(name);
+        OdeTrigger::s_dispatchGeneration++;
         return true;
     }
 
     DslReturnType Services::SourcePause(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -2568,7 +2833,7 @@ namespace DSL
     DslReturnType Services::SourceResume(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -2610,7 +2875,7 @@ namespace DSL
     boolean Services::SourceIsLive(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -2634,7 +2899,7 @@ namespace DSL
         const char* configFile, uint sourceId)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2670,7 +2935,7 @@ namespace DSL
         const char** configFile)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2679,7 +2944,7 @@ namespace DSL
                 name, DewarperBintr);
 
             DSL_DEWARPER_PTR pDewarperBintr = 
-                std::dynamic_pointer_cast<DewarperBintr>(m_components[name]);
+                std::dynamic_pointer_cast<DewarperBintr>(m_components.at(name));
 
             *configFile = pDewarperBintr->GetConfigFile();
 
@@ -2700,7 +2965,7 @@ namespace DSL
         const char* configFile)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2740,7 +3005,7 @@ namespace DSL
         uint* cameraId)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2749,7 +3014,7 @@ namespace DSL
                 name, DewarperBintr);
 
             DSL_DEWARPER_PTR pDewarperBintr = 
-                std::dynamic_pointer_cast<DewarperBintr>(m_components[name]);
+                std::dynamic_pointer_cast<DewarperBintr>(m_components.at(name));
 
             *cameraId = pDewarperBintr->GetCameraId();
 
@@ -2769,7 +3034,7 @@ namespace DSL
         uint cameraId)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2802,7 +3067,7 @@ namespace DSL
         uint* num)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2811,7 +3076,7 @@ namespace DSL
                 name, DewarperBintr);
 
             DSL_DEWARPER_PTR pDewarperBintr = 
-                std::dynamic_pointer_cast<DewarperBintr>(m_components[name]);
+                std::dynamic_pointer_cast<DewarperBintr>(m_components.at(name));
 
             *num = pDewarperBintr->GetNumBatchBuffers();
 
@@ -2831,7 +3096,7 @@ namespace DSL
         uint num)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2871,7 +3136,7 @@ namespace DSL
         dsl_record_client_listener_cb clientListener)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -2916,7 +3181,7 @@ namespace DSL
         uint start, uint duration, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2947,7 +3212,7 @@ namespace DSL
     DslReturnType Services::TapRecordSessionStop(const char* name, boolean sync)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2977,7 +3242,7 @@ namespace DSL
     DslReturnType Services::TapRecordOutdirGet(const char* name, const char** outdir)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -2985,7 +3250,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
             
             DSL_RECORD_TAP_PTR pRecordTapBintr = 
-                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
+                std::dynamic_pointer_cast<RecordTapBintr>(m_components.at(name));
 
             *outdir = pRecordTapBintr->GetOutdir();
             
@@ -3002,7 +3267,7 @@ namespace DSL
     DslReturnType Services::TapRecordOutdirSet(const char* name, const char* outdir)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -3031,7 +3296,7 @@ namespace DSL
     DslReturnType Services::TapRecordContainerGet(const char* name, uint* container)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -3039,7 +3304,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
 
             DSL_RECORD_TAP_PTR pRecordTapBintr = 
-                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
+                std::dynamic_pointer_cast<RecordTapBintr>(m_components.at(name));
 
             *container = pRecordTapBintr->GetContainer();
 
@@ -3057,7 +3322,7 @@ namespace DSL
     DslReturnType Services::TapRecordContainerSet(const char* name, uint container)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -3093,7 +3358,7 @@ namespace DSL
     DslReturnType Services::TapRecordCacheSizeGet(const char* name, uint* cacheSize)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -3101,7 +3366,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
 
             DSL_RECORD_TAP_PTR pRecordTapBintr = 
-                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
+                std::dynamic_pointer_cast<RecordTapBintr>(m_components.at(name));
 
             *cacheSize = pRecordTapBintr->GetCacheSize();
 
@@ -3119,7 +3384,7 @@ namespace DSL
     DslReturnType Services::TapRecordCacheSizeSet(const char* name, uint cacheSize)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -3150,7 +3415,7 @@ namespace DSL
     DslReturnType Services::TapRecordDimensionsGet(const char* name, uint* width, uint* height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -3158,7 +3423,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
 
             DSL_RECORD_TAP_PTR pRecordTapBintr = 
-                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
+                std::dynamic_pointer_cast<RecordTapBintr>(m_components.at(name));
 
             // TODO verify args before calling
             pRecordTapBintr->GetDimensions(width, height);
@@ -3179,7 +3444,7 @@ namespace DSL
     DslReturnType Services::TapRecordDimensionsSet(const char* name, uint width, uint height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -3212,7 +3477,7 @@ namespace DSL
     DslReturnType Services::TapRecordIsOnGet(const char* name, boolean* isOn)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -3220,7 +3485,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RecordTapBintr);
 
             DSL_RECORD_TAP_PTR pRecordTapBintr = 
-                std::dynamic_pointer_cast<RecordTapBintr>(m_components[name]);
+                std::dynamic_pointer_cast<RecordTapBintr>(m_components.at(name));
 
             *isOn = pRecordTapBintr->IsOn();
 
@@ -3240,7 +3505,7 @@ namespace DSL
     DslReturnType Services::TapRecordResetDoneGet(const char* name, boolean* resetDone)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
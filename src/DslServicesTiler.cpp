@@ -33,7 +33,7 @@ namespace DSL
     DslReturnType Services::TilerNew(const char* name, uint width, uint height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -60,7 +60,7 @@ namespace DSL
     DslReturnType Services::TilerDimensionsGet(const char* name, uint* width, uint* height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -68,7 +68,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
 
             DSL_TILER_PTR tilerBintr = 
-                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+                std::dynamic_pointer_cast<TilerBintr>(m_components.at(name));
 
             tilerBintr->GetDimensions(width, height);
             LOG_INFO("New Tiler '" << name << "' created successfully");
@@ -88,7 +88,7 @@ namespace DSL
     DslReturnType Services::TilerDimensionsSet(const char* name, uint width, uint height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -120,7 +120,7 @@ namespace DSL
     DslReturnType Services::TilerTilesGet(const char* name, uint* columns, uint* rows)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -128,7 +128,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
 
             DSL_TILER_PTR tilerBintr = 
-                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+                std::dynamic_pointer_cast<TilerBintr>(m_components.at(name));
 
             // TODO verify args before calling
             tilerBintr->GetTiles(columns, rows);
@@ -148,7 +148,7 @@ namespace DSL
     DslReturnType Services::TilerTilesSet(const char* name, uint columns, uint rows)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -180,7 +180,7 @@ namespace DSL
             boolean* enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -189,7 +189,7 @@ namespace DSL
                 TilerBintr);
 
             DSL_TILER_PTR tilerBintr = 
-                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+                std::dynamic_pointer_cast<TilerBintr>(m_components.at(name));
 
             // TODO verify args before calling
             *enabled = tilerBintr->GetFrameNumberingEnabled();
@@ -212,7 +212,7 @@ namespace DSL
             boolean enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -246,7 +246,7 @@ namespace DSL
         const char** source, uint* timeout)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -254,7 +254,7 @@ namespace DSL
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
 
             DSL_TILER_PTR tilerBintr = 
-                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+                std::dynamic_pointer_cast<TilerBintr>(m_components.at(name));
 
             int sourceId(-1);
             tilerBintr->GetShowSource(&sourceId, timeout);
@@ -264,13 +264,14 @@ namespace DSL
                 *source = NULL;
                 return DSL_RESULT_SUCCESS;
             }
-            if (m_sourceNamesById.find(sourceId) == m_sourceNamesById.end())
+            const std::string* pSourceName = m_sourceNamesById.Lookup(sourceId);
+            if (!pSourceName)
             {
                 *source = NULL;
                 LOG_ERROR("Tiler '" << name << "' failed to get Source name from Id");
                 return DSL_RESULT_SOURCE_NAME_NOT_FOUND;
             }
-            *source = m_sourceNamesById[sourceId].c_str();
+            *source = pSourceName->c_str();
             
             LOG_INFO("Source = " << *source 
                 << " returned successfully for Tiler '" << name << "'");
@@ -288,7 +289,7 @@ namespace DSL
         const char* source, uint timeout, bool hasPrecedence)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -335,7 +336,7 @@ namespace DSL
         uint sourceId, uint timeout, bool hasPrecedence)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -378,7 +379,7 @@ namespace DSL
         int xPos, int yPos, uint windowWidth, uint windowHeight, uint timeout)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -451,7 +452,7 @@ namespace DSL
     DslReturnType Services::TilerSourceShowAll(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -477,7 +478,7 @@ namespace DSL
     DslReturnType Services::TilerSourceShowCycle(const char* name, uint timeout)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -507,7 +508,7 @@ namespace DSL
     DslReturnType Services::TilerPphAdd(const char* name, const char* handler, uint pad)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -543,7 +544,7 @@ namespace DSL
     DslReturnType Services::TilerPphRemove(const char* name, const char* handler, uint pad) 
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
         
         try
@@ -34,7 +34,7 @@ namespace DSL
         uint width, uint height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -76,7 +76,7 @@ namespace DSL
         const char** libFile)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -85,7 +85,7 @@ namespace DSL
                 name, TrackerBintr);
             
             DSL_TRACKER_PTR pTrackerBintr = 
-                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
+                std::dynamic_pointer_cast<TrackerBintr>(m_components.at(name));
 
             *libFile = pTrackerBintr->GetLibFile();
 
@@ -106,7 +106,7 @@ namespace DSL
         const char* libFile)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -151,7 +151,7 @@ namespace DSL
         const char** configFile)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -160,7 +160,7 @@ namespace DSL
                 name, TrackerBintr);
             
             DSL_TRACKER_PTR pTrackerBintr = 
-                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
+                std::dynamic_pointer_cast<TrackerBintr>(m_components.at(name));
 
             *configFile = pTrackerBintr->GetConfigFile();
 
@@ -181,7 +181,7 @@ namespace DSL
         const char* configFile)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -225,7 +225,7 @@ namespace DSL
     DslReturnType Services::TrackerDimensionsGet(const char* name, uint* width, uint* height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -234,7 +234,7 @@ namespace DSL
                 name, TrackerBintr);
 
             DSL_TRACKER_PTR trackerBintr = 
-                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
+                std::dynamic_pointer_cast<TrackerBintr>(m_components.at(name));
 
             trackerBintr->GetDimensions(width, height);
 
@@ -253,7 +253,7 @@ namespace DSL
     DslReturnType Services::TrackerDimensionsSet(const char* name, uint width, uint height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -285,7 +285,7 @@ namespace DSL
         boolean* enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -294,7 +294,7 @@ namespace DSL
                 name, TrackerBintr);
 
             DSL_TRACKER_PTR trackerBintr = 
-                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
+                std::dynamic_pointer_cast<TrackerBintr>(m_components.at(name));
 
             *enabled = trackerBintr->GetBatchProcessingEnabled();
 
@@ -315,7 +315,7 @@ namespace DSL
         boolean enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -349,7 +349,7 @@ namespace DSL
         boolean* enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_READING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -358,7 +358,7 @@ namespace DSL
                 name, TrackerBintr);
 
             DSL_TRACKER_PTR trackerBintr = 
-                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
+                std::dynamic_pointer_cast<TrackerBintr>(m_components.at(name));
 
             *enabled = trackerBintr->GetPastFrameReportingEnabled();
 
@@ -379,7 +379,7 @@ namespace DSL
         boolean enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -412,7 +412,7 @@ namespace DSL
         const char* handler, uint pad)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         
         try
         {
@@ -453,7 +453,7 @@ namespace DSL
         const char* handler, uint pad) 
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
         DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
         
         try
@@ -0,0 +1,276 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/**
+ * @file DslShmExport.h
+ * @brief Memory layout of the shared-memory ring written by the Shared-Memory
+ * Export Pad Probe Handler, see dsl_pph_shm_export_new. This header is plain C 
+ * with no dependencies, and is all that an out-of-process reader requires. 
+ * 
+ * The ring is a single header followed by "capacity" fixed-size records, one
+ * record per object. Records are never consumed, the writer overwrites the 
+ * oldest record once the ring is full, so any number of readers can follow 
+ * the ring independently, each tracking its own next sequence number.
+ * 
+ * Reader usage:
+ * 
+ *   int fd = shm_open("/dsl-detections", O_RDONLY, 0);
+ *   struct stat st; fstat(fd, &st);
+ *   dsl_shm_export_header* header = (dsl_shm_export_header*)mmap(NULL, 
+ *       st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+ *   
+ *   uint64_t next = dsl_shm_export_write_sequence(header) + 1;
+ *   dsl_shm_export_record record;
+ *   
+ *   while (running)
+ *   {
+ *       int result = dsl_shm_export_read(header, next, &record);
+ *       if (result == DSL_SHM_EXPORT_READ_OK) 
+ *           { process(&record); next++; }
+ *       else if (result == DSL_SHM_EXPORT_READ_OVERRUN) 
+ *           { next = dsl_shm_export_oldest_sequence(header); }
+ *       else 
+ *           { usleep(1000); }
+ *   }
+ */
+
+#ifndef _DSL_SHM_EXPORT_H
+#define _DSL_SHM_EXPORT_H
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief identifies a DSL shared-memory export ring - "DSLX".
+ */
+#define DSL_SHM_EXPORT_MAGIC                                        0x44534C58
+
+/**
+ * @brief version of the ring layout defined in this header.
+ */
+#define DSL_SHM_EXPORT_VERSION                                      1
+
+/**
+ * @brief maximum number of records in the ring, a power of 2.
+ */
+#define DSL_SHM_EXPORT_MAX_CAPACITY                                 (1 << 20)
+
+/**
+ * @brief return values for dsl_shm_export_read
+ */
+#define DSL_SHM_EXPORT_READ_OK                                      0
+#define DSL_SHM_EXPORT_READ_NOT_READY                               1
+#define DSL_SHM_EXPORT_READ_OVERRUN                                 2
+
+/**
+ * @struct _dsl_shm_export_header
+ * @brief Ring header at offset 0 of the shared-memory object, 64 bytes.
+ */
+typedef struct _dsl_shm_export_header
+{
+    /**
+     * @brief always DSL_SHM_EXPORT_MAGIC.
+     */
+    uint32_t magic;
+    
+    /**
+     * @brief DSL_SHM_EXPORT_VERSION of the writer.
+     */
+    uint32_t version;
+    
+    /**
+     * @brief sizeof(dsl_shm_export_record) of the writer.
+     */
+    uint32_t record_size;
+    
+    /**
+     * @brief number of records in the ring, always a power of 2.
+     */
+    uint32_t capacity;
+    
+    /**
+     * @brief sequence number of the last record published, 0 if none. 
+     * Sequence numbers start at 1.
+     */
+    uint64_t write_sequence;
+    
+    /**
+     * @brief reserved, pads the header to 64 bytes.
+     */
+    uint64_t reserved[5];
+    
+} dsl_shm_export_header;
+
+/**
+ * @struct _dsl_shm_export_record
+ * @brief One object detection, 64 bytes. The records follow the header.
+ */
+typedef struct _dsl_shm_export_record
+{
+    /**
+     * @brief sequence number of this record, 0 while the record is 
+     * being written. Always written last.
+     */
+    uint64_t sequence;
+    
+    /**
+     * @brief presentation timestamp of the frame's buffer in nanoseconds.
+     */
+    uint64_t pts;
+    
+    /**
+     * @brief unique tracking id, or UNTRACKED_OBJECT_ID if not tracked.
+     */
+    uint64_t tracking_id;
+    
+    /**
+     * @brief unique id of the source the frame came from.
+     */
+    uint32_t source_id;
+    
+    /**
+     * @brief frame number of the frame for its source.
+     */
+    uint32_t frame_num;
+    
+    /**
+     * @brief index of the object within its frame, 0 to object_count-1.
+     */
+    uint32_t object_index;
+    
+    /**
+     * @brief number of objects exported for the frame.
+     */
+    uint32_t object_count;
+    
+    /**
+     * @brief class id of the object.
+     */
+    int32_t class_id;
+    
+    /**
+     * @brief inference confidence of the object.
+     */
+    float confidence;
+    
+    /**
+     * @brief bounding box of the object in pixels.
+     */
+    float left;
+    float top;
+    float width;
+    float height;
+    
+} dsl_shm_export_record;
+
+/**
+ * @brief Gets the first record of the ring.
+ * @param[in] header mapped ring header.
+ * @return pointer to the first of "capacity" records.
+ */
+static inline const dsl_shm_export_record* dsl_shm_export_records(
+    const dsl_shm_export_header* header)
+{
+    return (const dsl_shm_export_record*)(header + 1);
+}
+
+/**
+ * @brief Gets the total size of a ring with a given capacity.
+ * @param[in] capacity number of records in the ring.
+ * @return size of the shared-memory object in bytes.
+ */
+static inline uint64_t dsl_shm_export_size(uint32_t capacity)
+{
+    return sizeof(dsl_shm_export_header) + 
+        (uint64_t)capacity*sizeof(dsl_shm_export_record);
+}
+
+/**
+ * @brief Gets the sequence number of the last record published.
+ * @param[in] header mapped ring header.
+ * @return last sequence number, 0 if no record has been published.
+ */
+static inline uint64_t dsl_shm_export_write_sequence(
+    const dsl_shm_export_header* header)
+{
+    return __atomic_load_n(&header->write_sequence, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief Gets the sequence number of the oldest record still in the ring.
+ * @param[in] header mapped ring header.
+ * @return oldest sequence number that can be read.
+ */
+static inline uint64_t dsl_shm_export_oldest_sequence(
+    const dsl_shm_export_header* header)
+{
+    uint64_t last = dsl_shm_export_write_sequence(header);
+    
+    // leave one slot of headroom for the record being written.
+    return (last < header->capacity) ? 1 : last - header->capacity + 2;
+}
+
+/**
+ * @brief Copies a record out of the ring.
+ * @param[in] header mapped ring header.
+ * @param[in] sequence sequence number of the record to read.
+ * @param[out] record copy of the record on DSL_SHM_EXPORT_READ_OK.
+ * @return DSL_SHM_EXPORT_READ_OK on success, DSL_SHM_EXPORT_READ_NOT_READY 
+ * if the record has not been published yet, DSL_SHM_EXPORT_READ_OVERRUN if
+ * the record has been overwritten - the reader has fallen too far behind. 
+ */
+static inline int dsl_shm_export_read(const dsl_shm_export_header* header,
+    uint64_t sequence, dsl_shm_export_record* record)
+{
+    const dsl_shm_export_record* slot = dsl_shm_export_records(header) + 
+        (sequence & (header->capacity - 1));
+        
+    uint64_t before = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+    if (before != sequence)
+    {
+        return (before > sequence || 
+            dsl_shm_export_write_sequence(header) >= sequence)
+            ? DSL_SHM_EXPORT_READ_OVERRUN : DSL_SHM_EXPORT_READ_NOT_READY;
+    }
+    memcpy(record, slot, sizeof(dsl_shm_export_record));
+    
+    // the copy must complete before the sequence is checked again.
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    
+    if (__atomic_load_n(&slot->sequence, __ATOMIC_RELAXED) != sequence)
+    {
+        return DSL_SHM_EXPORT_READ_OVERRUN;
+    }
+    return DSL_SHM_EXPORT_READ_OK;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _DSL_SHM_EXPORT_H
@@ -102,6 +102,15 @@ namespace DSL
         , m_dataType(dataType)
         , m_clientHandler(clientHandler)
         , m_clientData(clientData)
+        , m_pAppSinkPad(NULL)
+        , m_queueEnabled(false)
+        , m_queueMaxSize(0)
+        , m_queuePolicy(DSL_SINK_APP_QUEUE_POLICY_DROP_OLDEST)
+        , m_queueHead(0)
+        , m_queueTail(0)
+        , m_queueHighWater(0)
+        , m_queueDropped(0)
+        , m_producerWaiting(false)
     {
         LOG_FUNC();
         
@@ -121,7 +130,24 @@ namespace DSL
         
         AddChild(m_pAppSink);
 
+        m_pAppSinkPad = gst_element_get_static_pad(
+            m_pAppSink->GetGstElement(), "sink");
+
         g_mutex_init(&m_dataHandlerMutex);
+        g_mutex_init(&m_queueWaitMutex);
+        g_cond_init(&m_queueWaitCond);
+    }
+    
+    AppSinkBintr::AppSinkBintr(const char* name, uint dataType,
+        uint maxSize, uint policy)
+        : AppSinkBintr(name, dataType, NULL, NULL)
+    {
+        LOG_FUNC();
+        
+        m_queueEnabled = true;
+        m_queueMaxSize = maxSize;
+        m_queuePolicy = policy;
+        m_queueItems.resize(m_queueMaxSize, NULL);
     }
     
     AppSinkBintr::~AppSinkBintr()
@@ -132,6 +158,11 @@ namespace DSL
         {    
             UnlinkAll();
         }
+        queueFlush();
+        gst_object_unref(m_pAppSinkPad);
+        
+        g_cond_clear(&m_queueWaitCond);
+        g_mutex_clear(&m_queueWaitMutex);
         g_mutex_clear(&m_dataHandlerMutex);
     }
 
@@ -163,6 +194,9 @@ namespace DSL
         }
         m_pQueue->UnlinkFromSink();
         m_isLinked = false;
+        
+        // release any samples the client did not pull before stopping
+        queueFlush();
     }
 
     bool AppSinkBintr::SetSyncEnabled(bool enabled)
@@ -201,6 +235,19 @@ namespace DSL
     {
         // don't log function for performance
 
+        if (m_queueEnabled)
+        {
+            GstSample* pSample = gst_app_sink_pull_sample(
+                GST_APP_SINK(m_pAppSink->GetGstElement()));
+            if (!pSample)
+            {
+                LOG_INFO("AppSinkBintr '" << GetName() 
+                    << "' pulled NULL sample. Exiting with EOS");
+                return GST_FLOW_EOS;
+            }
+            return QueueSample(pSample);
+        }
+
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dataHandlerMutex);
         
         void* pData(NULL);
@@ -271,6 +318,187 @@ namespace DSL
         return dslRetVal;
     }
     
+    bool AppSinkBintr::GetQueueEnabled()
+    {
+        LOG_FUNC();
+        
+        return m_queueEnabled;
+    }
+    
+    void AppSinkBintr::GetQueueSettings(uint* maxSize, uint* policy)
+    {
+        LOG_FUNC();
+        
+        *maxSize = m_queueMaxSize;
+        *policy = m_queuePolicy;
+    }
+    
+    bool AppSinkBintr::SetQueueSettings(uint maxSize, uint policy)
+    {
+        LOG_FUNC();
+        
+        if (maxSize != m_queueMaxSize)
+        {
+            if (IsLinked())
+            {
+                LOG_ERROR("Unable to set queue max-size for AppSinkBintr '" 
+                    << GetName() << "' as it's currently linked");
+                return false;
+            }
+            queueFlush();
+            m_queueMaxSize = maxSize;
+            m_queueItems.assign(m_queueMaxSize, NULL);
+        }
+        m_queuePolicy = policy;
+        
+        return true;
+    }
+    
+    uint AppSinkBintr::PullBatch(void** data, uint maxCount)
+    {
+        // don't log function for performance
+
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dataHandlerMutex);
+        
+        uint count(0);
+        GstSample* pSample(NULL);
+        
+        while (count < maxCount and queuePop(&pSample))
+        {
+            if (m_dataType == DSL_SINK_APP_DATA_TYPE_SAMPLE)
+            {
+                data[count++] = pSample;
+                continue;
+            }
+            // the buffer is owned by the sample - take a reference of our 
+            // own so that the sample can be released here.
+            GstBuffer* pBuffer = gst_sample_get_buffer(pSample);
+            if (pBuffer)
+            {
+                data[count++] = gst_buffer_ref(pBuffer);
+            }
+            gst_sample_unref(pSample);
+        }
+        
+        // wake the streaming thread if blocked on a full queue
+        if (count and m_producerWaiting)
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_queueWaitMutex);
+            g_cond_signal(&m_queueWaitCond);
+        }
+        return count;
+    }
+    
+    void AppSinkBintr::GetQueueStats(uint* depth, 
+        uint* highWater, uint64_t* dropped)
+    {
+        LOG_FUNC();
+        
+        *depth = m_queueTail.load(std::memory_order_acquire) - 
+            m_queueHead.load(std::memory_order_acquire);
+        *highWater = m_queueHighWater;
+        *dropped = m_queueDropped;
+    }
+    
+    void AppSinkBintr::ClearQueueStats()
+    {
+        LOG_FUNC();
+        
+        m_queueHighWater = 0;
+        m_queueDropped = 0;
+    }
+    
+    GstFlowReturn AppSinkBintr::QueueSample(GstSample* pSample)
+    {
+        // don't log function for performance
+
+        uint64_t tail = m_queueTail.load(std::memory_order_relaxed);
+        
+        while (tail - m_queueHead.load(std::memory_order_acquire) 
+            >= m_queueMaxSize)
+        {
+            uint policy = m_queuePolicy.load(std::memory_order_relaxed);
+            
+            if (policy == DSL_SINK_APP_QUEUE_POLICY_DROP_NEWEST)
+            {
+                gst_sample_unref(pSample);
+                m_queueDropped++;
+                return GST_FLOW_OK;
+            }
+            if (policy == DSL_SINK_APP_QUEUE_POLICY_DROP_OLDEST)
+            {
+                // the client may have pulled the oldest in the meantime,
+                // in which case there is nothing to drop on this pass.
+                GstSample* pOldest(NULL);
+                if (queuePop(&pOldest))
+                {
+                    gst_sample_unref(pOldest);
+                    m_queueDropped++;
+                }
+                continue;
+            }
+            // DSL_SINK_APP_QUEUE_POLICY_BLOCK - wait for the client to pull, 
+            // giving up if the sink pad is deactivated on Pipeline stop.
+            if (GST_PAD_IS_FLUSHING(m_pAppSinkPad))
+            {
+                gst_sample_unref(pSample);
+                return GST_FLOW_FLUSHING;
+            }
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_queueWaitMutex);
+            m_producerWaiting = true;
+            if (tail - m_queueHead.load(std::memory_order_acquire) 
+                >= m_queueMaxSize)
+            {
+                g_cond_wait_until(&m_queueWaitCond, &m_queueWaitMutex,
+                    g_get_monotonic_time() + 
+                    DSL_SINK_APP_QUEUE_BLOCK_POLL_INTERVAL*G_TIME_SPAN_MILLISECOND);
+            }
+            m_producerWaiting = false;
+        }
+        m_queueItems[tail % m_queueMaxSize] = pSample;
+        m_queueTail.store(tail+1, std::memory_order_release);
+        
+        uint depth = tail + 1 - m_queueHead.load(std::memory_order_acquire);
+        if (depth > m_queueHighWater)
+        {
+            m_queueHighWater = depth;
+        }
+        return GST_FLOW_OK;
+    }
+    
+    bool AppSinkBintr::queuePop(GstSample** ppSample)
+    {
+        // don't log function for performance
+
+        uint64_t head = m_queueHead.load(std::memory_order_acquire);
+        
+        while (head != m_queueTail.load(std::memory_order_acquire))
+        {
+            // The slot at head can't be overwritten by the producer until 
+            // head advances, so the read is valid if the swap succeeds.
+            GstSample* pSample = m_queueItems[head % m_queueMaxSize];
+            
+            if (m_queueHead.compare_exchange_weak(head, head+1,
+                std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                *ppSample = pSample;
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    void AppSinkBintr::queueFlush()
+    {
+        LOG_FUNC();
+        
+        GstSample* pSample(NULL);
+        while (queuePop(&pSample))
+        {
+            gst_sample_unref(pSample);
+        }
+    }
+    
     static GstFlowReturn on_new_sample_cb(GstElement sink, 
         gpointer pAppSinkBintr)
     {
@@ -40,6 +40,15 @@ namespace DSL
     #define DSL_APP_SINK_NEW(name, dataType, clientHandler, clientData) \
         std::shared_ptr<AppSinkBintr>( \
         new AppSinkBintr(name, dataType, clientHandler, clientData))
+    #define DSL_APP_SINK_QUEUED_NEW(name, dataType, maxSize, policy) \
+        std::shared_ptr<AppSinkBintr>( \
+        new AppSinkBintr(name, dataType, maxSize, policy))
+
+    /**
+     * @brief Interval in ms at which a streaming thread, blocked on a full
+     * App Sink queue, checks whether its sink pad has started flushing.
+     */
+    #define DSL_SINK_APP_QUEUE_BLOCK_POLL_INTERVAL 10
 
     #define DSL_FAKE_SINK_PTR std::shared_ptr<FakeSinkBintr>
     #define DSL_FAKE_SINK_NEW(name) \
@@ -166,6 +175,19 @@ namespace DSL
         AppSinkBintr(const char* name, uint dataType, 
             dsl_sink_app_new_data_handler_cb clientHandler, void* clientData);
 
+        /**
+         * @brief ctor for an AppSinkBintr in queued delivery mode. New samples
+         * are added to a bounded queue on the streaming thread and pulled by
+         * the client with PullBatch - the client is never called back.
+         * @param[in] name unique name for the new AppSinkBintr.
+         * @param[in] dataType either DSL_SINK_APP_DATA_TYPE_SAMPLE
+         * or DSL_SINK_APP_DATA_TYPE_BUFFER.
+         * @param[in] maxSize maximum number of samples to queue.
+         * @param[in] policy one of the DSL_SINK_APP_QUEUE_POLICY constants.
+         */
+        AppSinkBintr(const char* name, uint dataType, 
+            uint maxSize, uint policy);
+
         ~AppSinkBintr();
   
         /**
@@ -193,6 +215,15 @@ namespace DSL
          */
         GstFlowReturn HandleNewSample();
         
+        /**
+         * @brief Adds a new sample to the queue applying the current policy 
+         * if full. Called on the streaming thread only.
+         * @param[in] pSample sample to queue - ownership is transferred.
+         * @return GST_FLOW_OK, or GST_FLOW_FLUSHING if the queue was full 
+         * and the sink pad started flushing while blocked.
+         */
+        GstFlowReturn QueueSample(GstSample* pSample);
+        
         /**
          * @brief Gets the current data-type setting in use by this AppSinkBintr.
          * @return current data-type in use, either DSL_SINK_APP_DATA_TYPE_SAMPLE
@@ -207,8 +238,66 @@ namespace DSL
          */
         void SetDataType(uint dataType);
 
+        /**
+         * @brief Gets the delivery mode for this AppSinkBintr.
+         * @return true if queued, false if the client is called back.
+         */
+        bool GetQueueEnabled();
+        
+        /**
+         * @brief Gets the current queue settings for this AppSinkBintr.
+         * @param[out] maxSize maximum number of samples to queue.
+         * @param[out] policy current DSL_SINK_APP_QUEUE_POLICY in use.
+         */
+        void GetQueueSettings(uint* maxSize, uint* policy);
+        
+        /**
+         * @brief Sets the queue settings for this AppSinkBintr. The max-size
+         * can only be changed while the AppSinkBintr is unlinked. 
+         * @param[in] maxSize maximum number of samples to queue.
+         * @param[in] policy new DSL_SINK_APP_QUEUE_POLICY to use.
+         * @return true on successful update, false otherwise.
+         */
+        bool SetQueueSettings(uint maxSize, uint policy);
+        
+        /**
+         * @brief Pulls up to maxCount queued samples or buffers - depending on
+         * the current data-type - oldest first. Does not wait for new data.
+         * Ownership of each reference returned is transferred to the caller.
+         * @param[out] data array of at least maxCount pointers to fill.
+         * @param[in] maxCount maximum number of items to pull.
+         * @return number of items returned in data, 0 if the queue is empty.
+         */
+        uint PullBatch(void** data, uint maxCount);
+        
+        /**
+         * @brief Gets the current queue statistics for this AppSinkBintr.
+         * @param[out] depth current number of samples in the queue.
+         * @param[out] highWater largest queue depth since last cleared.
+         * @param[out] dropped number of samples dropped since last cleared.
+         */
+        void GetQueueStats(uint* depth, uint* highWater, uint64_t* dropped);
+        
+        /**
+         * @brief Clears the queue high-water mark and dropped count.
+         */
+        void ClearQueueStats();
+        
     private:
     
+        /**
+         * @brief Removes the oldest sample from the queue. Safe to call 
+         * from the streaming thread (drop-oldest) and client concurrently.
+         * @param[out] ppSample oldest sample - ownership is transferred.
+         * @return true if a sample was removed, false if the queue is empty.
+         */
+        bool queuePop(GstSample** ppSample);
+        
+        /**
+         * @brief Removes and unrefs all queued samples.
+         */
+        void queueFlush();
+        
         /**
          * @brief either DSL_SINK_APP_DATA_TYPE_SAMPLE or 
          * DSL_SINK_APP_DATA_TYPE_BUFFER
@@ -236,6 +325,60 @@ namespace DSL
          */
         DSL_ELEMENT_PTR m_pAppSink;
         
+        /**
+         * @brief sink pad of the App Sink element, checked for flushing 
+         * while blocked on a full queue.
+         */
+        GstPad* m_pAppSinkPad;
+        
+        /**
+         * @brief true if samples are queued for the client to pull, false
+         * if the client handler is called on the streaming thread.
+         */
+        bool m_queueEnabled;
+        
+        /**
+         * @brief maximum number of samples the queue can hold.
+         */
+        uint m_queueMaxSize;
+        
+        /**
+         * @brief current DSL_SINK_APP_QUEUE_POLICY to apply when full.
+         */
+        std::atomic<uint> m_queuePolicy;
+        
+        /**
+         * @brief bounded ring of sample references, indexed by the free 
+         * running head and tail positions modulo m_queueMaxSize.
+         */
+        std::vector<GstSample*> m_queueItems;
+        
+        /**
+         * @brief read and write positions. The tail is only written by the
+         * streaming thread. The head is advanced with compare-and-swap so
+         * that the client and a drop-oldest producer can both pop.
+         */
+        alignas(64) std::atomic<uint64_t> m_queueHead;
+        alignas(64) std::atomic<uint64_t> m_queueTail;
+        
+        /**
+         * @brief largest queue depth since the stats were last cleared.
+         */
+        std::atomic<uint> m_queueHighWater;
+        
+        /**
+         * @brief number of samples dropped since the stats were last cleared.
+         */
+        std::atomic<uint64_t> m_queueDropped;
+        
+        /**
+         * @brief mutex and condition used only by a producer blocked on a
+         * full queue - DSL_SINK_APP_QUEUE_POLICY_BLOCK - and the client
+         * waking it after a pull.
+         */
+        GMutex m_queueWaitMutex;
+        GCond m_queueWaitCond;
+        std::atomic<bool> m_producerWaiting;
     };
 
     /**
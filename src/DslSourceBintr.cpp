@@ -28,6 +28,7 @@ THE SOFTWARE.
 #include "DslSourceBintr.h"
 #include "DslPipelineBintr.h"
 #include "DslSurfaceTransform.h"
+#include "DslTimerWheel.h"
 #include <nvdsgstutils.h>
 #include <gst/app/gstappsrc.h>
 
@@ -573,6 +574,10 @@ namespace DSL
         , m_enoughDataHandler(NULL)
         , m_clientData(NULL)
         , m_maxBytes(0)
+        , m_minPercent(0)
+        , m_dataState(DSL_SOURCE_APP_DATA_STATE_NEED_DATA)
+        , m_bufferPoolSize(0)
+        , m_pBufferPool(NULL)
 // TODO support GST 1.20 properties        
 //        , m_maxBuffers(0)
 //        , m_maxTime(0)
@@ -612,6 +617,7 @@ namespace DSL
         m_pSourceElement->GetAttribute("format", &m_streamFormat);
         m_pSourceElement->GetAttribute("block", &m_blockEnabled);
         m_pSourceElement->GetAttribute("max-bytes", &m_maxBytes);
+        m_pSourceElement->GetAttribute("min-percent", &m_minPercent);
 
         // TODO support GST 1.20 properties
         // m_pSourceElement->GetAttribute("max-buffers", &m_maxBuffers);
@@ -632,6 +638,7 @@ namespace DSL
         LOG_INFO("  stream-format     : " << m_streamFormat);
         LOG_INFO("  block-enabled     : " << m_blockEnabled);
         LOG_INFO("  max-bytes         : " << m_maxBytes);
+        LOG_INFO("  min-percent       : " << m_minPercent);
         LOG_INFO("  width             : " << m_width);
         LOG_INFO("  height            : " << m_height);
         LOG_INFO("  fps-n             : " << m_fpsN);
@@ -660,6 +667,7 @@ namespace DSL
     {
         LOG_FUNC();
         
+        destroyBufferPool();
         g_mutex_clear(&m_dataHandlerMutex);
     }
     
@@ -674,8 +682,13 @@ namespace DSL
             return false;
         }
         
+        if (m_bufferPoolSize and !createBufferPool())
+        {
+            return false;
+        }
         if (!LinkToCommon(m_pSourceElement))
         {
+            destroyBufferPool();
             return false;
         }
         
@@ -696,6 +709,7 @@ namespace DSL
         }
         m_pSourceElement->UnlinkFromSink();
         UnlinkCommon();
+        destroyBufferPool();
         m_isLinked = false;
     }
 
@@ -810,6 +824,8 @@ namespace DSL
 
     void AppSourceBintr::HandleNeedData(uint length)
     {
+        m_dataState = DSL_SOURCE_APP_DATA_STATE_NEED_DATA;
+        
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dataHandlerMutex);
 
         if (m_needDataHandler)
@@ -830,6 +846,8 @@ namespace DSL
     
     void AppSourceBintr::HandleEnoughData()
     {
+        m_dataState = DSL_SOURCE_APP_DATA_STATE_ENOUGH_DATA;
+        
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dataHandlerMutex);
 
         if (m_enoughDataHandler)
@@ -956,6 +974,201 @@ namespace DSL
 
         return true;
     }
+
+    uint AppSourceBintr::GetMinLevelPercent()
+    {
+        LOG_FUNC();
+
+        return m_minPercent;
+    }
+    
+    bool AppSourceBintr::SetMinLevelPercent(uint percent)
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {
+            LOG_ERROR("Can't set min-level for AppSourceBintr '" 
+                << GetName() << "' as it's currently in a linked state");
+            return false;
+        }
+        m_minPercent = percent;
+        m_pSourceElement->SetAttribute("min-percent", m_minPercent);
+
+        return true;
+    }
+    
+    uint AppSourceBintr::GetDataState()
+    {
+        // do not log function entry/exit for performance reasons
+        
+        return m_dataState;
+    }
+    
+    uint AppSourceBintr::GetBufferPoolSize()
+    {
+        LOG_FUNC();
+
+        return m_bufferPoolSize;
+    }
+    
+    bool AppSourceBintr::SetBufferPoolSize(uint size)
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {
+            LOG_ERROR("Can't set buffer-pool size for AppSourceBintr '" 
+                << GetName() << "' as it's currently in a linked state");
+            return false;
+        }
+        m_bufferPoolSize = size;
+
+        return true;
+    }
+    
+    bool AppSourceBintr::AcquireBuffer(void** buffer, void** data, uint* size)
+    {
+        // Do not log function entry/exit for performance
+        
+        if (!m_pBufferPool)
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() 
+                << "' does not have an active buffer pool");
+            return false;
+        }
+        GstBufferPoolAcquireParams params = {GST_FORMAT_UNDEFINED, 
+            0, 0, GST_BUFFER_POOL_ACQUIRE_FLAG_DONTWAIT};
+            
+        GstBuffer* pBuffer(NULL);
+        GstFlowReturn retVal = gst_buffer_pool_acquire_buffer(m_pBufferPool,
+            &pBuffer, &params);
+        if (retVal != GST_FLOW_OK)
+        {
+            // GST_FLOW_EOS if all buffers are in use - not an error.
+            LOG_DEBUG("AppSourceBintr '" << GetName() 
+                << "' returned " << retVal << " on buffer acquire");
+            return false;
+        }
+        
+        // The pool allocates system memory, which stays at the same address
+        // for the life of the buffer, so the mapping need not be held.
+        GstMapInfo mapInfo;
+        if (!gst_buffer_map(pBuffer, &mapInfo, GST_MAP_WRITE))
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() 
+                << "' failed to map acquired buffer");
+            gst_buffer_unref(pBuffer);
+            return false;
+        }
+        *buffer = pBuffer;
+        *data = mapInfo.data;
+        *size = mapInfo.size;
+        gst_buffer_unmap(pBuffer, &mapInfo);
+
+        return true;
+    }
+    
+    void AppSourceBintr::ReleaseBuffer(void* buffer)
+    {
+        // Do not log function entry/exit for performance
+        
+        gst_buffer_unref((GstBuffer*)buffer);
+    }
+    
+    bool AppSourceBintr::PushMemory(void* data, uint size, 
+        dsl_source_app_memory_release_cb releaseHandler, void* clientData)
+    {
+        // Do not log function entry/exit for performance
+        
+        if (!m_isLinked)
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() 
+                << "' is not in a linked state");
+            return false;
+        }
+        AppSourceMemory* pMemory = 
+            new AppSourceMemory{data, releaseHandler, clientData, true};
+        
+        GstBuffer* pBuffer = gst_buffer_new_wrapped_full(
+            GST_MEMORY_FLAG_READONLY, data, size, 0, size, 
+            pMemory, on_app_source_memory_release_cb);
+
+        // Hold a reference of our own so that, on failure, the client can be
+        // excluded from the release before the buffer is freed.
+        gst_buffer_ref(pBuffer);
+        
+        GstFlowReturn retVal = gst_app_src_push_buffer(
+            (GstAppSrc*)m_pSourceElement->GetGObject(), pBuffer);
+        if (retVal != GST_FLOW_OK)
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() 
+                << "' returned " << retVal << " on push-memory");
+            pMemory->m_notifyClient = false;
+            gst_buffer_unref(pBuffer);
+            return false;
+        }
+        gst_buffer_unref(pBuffer);
+        
+        return true;
+    }
+    
+    bool AppSourceBintr::createBufferPool()
+    {
+        LOG_FUNC();
+        
+        GstCaps* pCaps = gst_app_src_get_caps(
+            (GstAppSrc*)m_pSourceElement->GetGObject());
+
+        GstVideoInfo videoInfo;
+        if (!pCaps or !gst_video_info_from_caps(&videoInfo, pCaps))
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() 
+                << "' failed to get video-info for buffer pool");
+            if (pCaps)
+            {
+                gst_caps_unref(pCaps);
+            }
+            return false;
+        }
+        uint bufferSize = GST_VIDEO_INFO_SIZE(&videoInfo);
+
+        m_pBufferPool = gst_buffer_pool_new();
+        
+        GstStructure* pConfig = gst_buffer_pool_get_config(m_pBufferPool);
+        gst_buffer_pool_config_set_params(pConfig, pCaps, bufferSize,
+            m_bufferPoolSize, m_bufferPoolSize);
+        gst_caps_unref(pCaps);
+        
+        if (!gst_buffer_pool_set_config(m_pBufferPool, pConfig) or
+            !gst_buffer_pool_set_active(m_pBufferPool, TRUE))
+        {
+            LOG_ERROR("AppSourceBintr '" << GetName() 
+                << "' failed to activate buffer pool");
+            gst_object_unref(m_pBufferPool);
+            m_pBufferPool = NULL;
+            return false;
+        }
+        LOG_INFO("AppSourceBintr '" << GetName() << "' allocated " 
+            << m_bufferPoolSize << " buffers of size = " << bufferSize);
+            
+        return true;
+    }
+    
+    void AppSourceBintr::destroyBufferPool()
+    {
+        LOG_FUNC();
+        
+        if (!m_pBufferPool)
+        {
+            return;
+        }
+        // Buffers still held by the client or downstream keep a reference
+        // to the pool and are freed on release.
+        gst_buffer_pool_set_active(m_pBufferPool, FALSE);
+        gst_object_unref(m_pBufferPool);
+        m_pBufferPool = NULL;
+    }
     
 //    uint AppSourceBintr::GetLeakyType()
 //    {
@@ -994,6 +1207,27 @@ namespace DSL
         static_cast<AppSourceBintr*>(pAppSrcBintr)->
             HandleEnoughData();
     }
+    
+    static void on_app_source_memory_release_cb(gpointer pAppSourceMemory)
+    {
+        AppSourceMemory* pMemory = 
+            static_cast<AppSourceMemory*>(pAppSourceMemory);
+            
+        if (pMemory->m_notifyClient and pMemory->m_releaseHandler)
+        {
+            try
+            {
+                pMemory->m_releaseHandler(pMemory->m_data, 
+                    pMemory->m_clientData);
+            }
+            catch(...)
+            {
+                LOG_ERROR("App Source threw exception calling client \
+                    handler function for memory release");
+            }
+        }
+        delete pMemory;
+    }
         
     //*********************************************************************************
     // Initilize the unique id list for all CsiSourceBintrs 
@@ -2501,6 +2735,7 @@ namespace DSL
         , m_latency(latency)
         , m_bufferTimeout(timeout)
         , m_streamManagerTimerId(0)
+        , m_streamManagerIdleId(0)
         , m_reconnectionManagerTimerId(0)
         , m_connectionData{0}
         , m_reconnectionFailed(false)
@@ -2585,6 +2820,17 @@ namespace DSL
     {
         LOG_FUNC();
         
+        if (m_streamManagerTimerId)
+        {
+            // Wait for a running watchdog to return - without the mutex held.
+            TimerWheel::GetTimerWheel().CancelAndWait(m_streamManagerTimerId);
+        }
+        if (m_streamManagerIdleId)
+        {
+            // Remove a hand-off from the watchdog still pending on the main-loop
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_streamManagerMutex);
+            g_source_remove(m_streamManagerIdleId);
+        }
         if (m_reconnectionManagerTimerId)
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_reconnectionManagerMutex);
@@ -2647,11 +2893,18 @@ namespace DSL
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_streamManagerMutex);
             
-            g_source_remove(m_streamManagerTimerId);
+            TimerWheel::GetTimerWheel().Cancel(m_streamManagerTimerId);
             m_streamManagerTimerId = 0;
             LOG_INFO("Stream management disabled for RTSP Source '" 
                 << GetName() << "'");
         }
+        if (m_streamManagerIdleId)
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_streamManagerMutex);
+            
+            g_source_remove(m_streamManagerIdleId);
+            m_streamManagerIdleId = 0;
+        }
         if (m_reconnectionManagerTimerId)
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_reconnectionManagerMutex);
@@ -2740,7 +2993,7 @@ namespace DSL
             if (m_streamManagerTimerId)
             {
                 // shutdown the current session
-                g_source_remove(m_streamManagerTimerId);
+                TimerWheel::GetTimerWheel().Cancel(m_streamManagerTimerId);
                 m_streamManagerTimerId = 0;
                 LOG_INFO("Stream management disabled for RTSP Source '" << GetName() << "'");
             }
@@ -2748,8 +3001,8 @@ namespace DSL
             if (timeout)
             {
                 // Start up stream mangement
-                m_streamManagerTimerId = g_timeout_add(timeout, 
-                    RtspReconnectionMangerHandler, this);
+                m_streamManagerTimerId = TimerWheel::GetTimerWheel().Schedule(
+                    timeout*1000, RtspStreamWatchdogHandler, this);
                 LOG_INFO("Stream management enabled for RTSP Source '" 
                     << GetName() << "' with timeout = " << timeout);
             }
@@ -3007,8 +3260,8 @@ namespace DSL
             // Start the Stream mangement timer, only if timeout is enable and not currently running
             if (m_bufferTimeout and !m_streamManagerTimerId)
             {
-                m_streamManagerTimerId = g_timeout_add(m_bufferTimeout, 
-                    RtspStreamManagerHandler, this);
+                m_streamManagerTimerId = TimerWheel::GetTimerWheel().Schedule(
+                    m_bufferTimeout*1000, RtspStreamWatchdogHandler, this);
                 LOG_INFO("Starting stream management for RTSP Source '" << GetName() << "'");
             }
 
@@ -3096,8 +3349,8 @@ namespace DSL
             // Start the Stream mangement timer, only if timeout is enable and not currently running
             if (m_bufferTimeout and !m_streamManagerTimerId)
             {
-                m_streamManagerTimerId = g_timeout_add(m_bufferTimeout, 
-                    RtspStreamManagerHandler, this);
+                m_streamManagerTimerId = TimerWheel::GetTimerWheel().Schedule(
+                    m_bufferTimeout*1000, RtspStreamWatchdogHandler, this);
                 LOG_INFO("Starting stream management for RTSP Source '" << GetName() << "'");
             }
 
@@ -3110,6 +3363,9 @@ namespace DSL
     int RtspSourceBintr::StreamManager()
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_streamManagerMutex);
+        
+        // Called once per hand-off from the watchdog, which is now dispatched.
+        m_streamManagerIdleId = 0;
 
         // if currently in a reset cycle then let the ResetStream handler continue to handle
         if (m_connectionData.is_in_reconnect)
@@ -3124,8 +3380,8 @@ namespace DSL
         uint stateResult = GetState(currentState, 0);
         SetCurrentState(currentState);
         
-        // Get the last buffer time. This timer callback should not be called until after the timer 
-        // is started on successful linkup - therefore the lastBufferTime should be non-zero
+        // Get the last buffer time. Called from the watchdog once the deadline has been
+        // exceeded, but recheck as a buffer may have been received since.
         struct timeval lastBufferTime;
         m_TimestampPph->GetTime(lastBufferTime);
         if (lastBufferTime.tv_sec == 0)
@@ -3164,6 +3420,61 @@ namespace DSL
         return true;
     }
     
+    uint RtspSourceBintr::StreamWatchdog()
+    {
+        // No function log - called on each deadline.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_streamManagerMutex);
+
+        uint bufferTimeoutMs = m_bufferTimeout*1000;
+        
+        // In a reconnection cycle, the Reconnection Manager maintains state.
+        if (m_connectionData.is_in_reconnect)
+        {
+            return bufferTimeoutMs;
+        }
+        
+        // Keep the current state - and connection stats - up to date while 
+        // waiting to reach PLAYING. Non-blocking, safe off the main-loop.
+        GstState currentState;
+        GetState(currentState, 0);
+        SetCurrentState(currentState);
+        
+        uint nextCheck = (currentState == GST_STATE_PLAYING) 
+            ? bufferTimeoutMs : std::min(bufferTimeoutMs, 
+                (uint)DSL_RTSP_STATE_POLL_INTERVAL);
+        
+        // While waiting for the first buffer, check back on next poll or
+        // after a full timeout period.
+        struct timeval lastBufferTime;
+        m_TimestampPph->GetTime(lastBufferTime);
+        if (lastBufferTime.tv_sec == 0)
+        {
+            return nextCheck;
+        }
+        
+        struct timeval currentTime;
+        gettimeofday(&currentTime, NULL);
+
+        double timeSinceLastBufferMs = 1000.0*(currentTime.tv_sec - lastBufferTime.tv_sec) + 
+            (currentTime.tv_usec - lastBufferTime.tv_usec) / 1000.0;
+
+        if (timeSinceLastBufferMs < bufferTimeoutMs)
+        {
+            // Timeout has not been exceeded, so sleep until the new deadline
+            return std::min(nextCheck, 
+                (uint)ceil(bufferTimeoutMs - timeSinceLastBufferMs));
+        }
+        
+        // Start the reconnection cycle on the main-loop, once only if the
+        // previous hand-off has yet to be dispatched.
+        if (!m_streamManagerIdleId)
+        {
+            m_streamManagerIdleId = g_idle_add(RtspStreamManagerHandler, this);
+        }
+        
+        return bufferTimeoutMs;
+    }
+    
     int RtspSourceBintr::ReconnectionManager()
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_reconnectionManagerMutex);
@@ -3418,9 +3729,17 @@ namespace DSL
     }
 
     static int RtspStreamManagerHandler(gpointer pSource)
+    {
+        static_cast<RtspSourceBintr*>(pSource)->StreamManager();
+        
+        // One-shot, the TimerWheel watchdog continues to check the deadline.
+        return false;
+    }
+
+    static uint RtspStreamWatchdogHandler(void* pSource)
     {
         return static_cast<RtspSourceBintr*>(pSource)->
-            StreamManager();
+            StreamWatchdog();
     }
 
     static int RtspReconnectionMangerHandler(gpointer pSource)
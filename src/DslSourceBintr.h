@@ -92,6 +92,13 @@ namespace DSL
         std::shared_ptr<RtspSourceBintr>(new RtspSourceBintr(name, uri, protocol, \
             skipFrames, dropFrameInterval, latency, timeout))
 
+    /**
+     * @brief Interval, in milliseconds, at which the RTSP stream watchdog 
+     * polls the Source's state until PLAYING. Once PLAYING, the watchdog only 
+     * wakes on the buffer timeout deadline.
+     */
+    #define DSL_RTSP_STATE_POLL_INTERVAL 100
+
     /**
      * @brief Utility function to define/set all capabilities (media, 
      * format, width, height, and frame rate) for a given element.
@@ -615,6 +622,77 @@ namespace DSL
          */
         bool SetMaxLevelBytes(uint64_t level);
         
+        /**
+         * @brief Gets the min-level of queued data, as a percentage of the
+         * max-level, for this AppSourceBintr.
+         * @return current min-level percentage.
+         */
+        uint GetMinLevelPercent();
+        
+        /**
+         * @brief Sets the min-level of queued data, as a percentage of the
+         * max-level, below which this AppSourceBintr will emit "need-data".
+         * @param[in] percent new min-level percentage, 0..100.
+         * @return true on successful set, false otherwise.
+         */
+        bool SetMinLevelPercent(uint percent);
+        
+        /**
+         * @brief Gets the current data-state for this AppSourceBintr, 
+         * updated on each "need-data" and "enough-data" signal.
+         * @return one of the DSL_SOURCE_APP_DATA_STATE constants.
+         */
+        uint GetDataState();
+        
+        /**
+         * @brief Gets the number of buffers pre-allocated by the buffer pool
+         * for this AppSourceBintr.
+         * @return current buffer-pool size, 0 if the pool is disabled.
+         */
+        uint GetBufferPoolSize();
+        
+        /**
+         * @brief Sets the number of buffers to pre-allocate for this 
+         * AppSourceBintr. The pool is created when the AppSourceBintr is
+         * linked, with buffers sized for the buffer-in format and dimensions.
+         * @param[in] size new buffer-pool size, 0 to disable the pool.
+         * @return true on successful set, false otherwise.
+         */
+        bool SetBufferPoolSize(uint size);
+        
+        /**
+         * @brief Acquires a free buffer from this AppSourceBintr's buffer 
+         * pool for the client to fill and push. Does not wait if all buffers
+         * are in use.
+         * @param[out] buffer acquired buffer.
+         * @param[out] data pointer to the buffer's system memory.
+         * @param[out] size size of the buffer's memory in bytes.
+         * @return true on successful acquire, false otherwise.
+         */
+        bool AcquireBuffer(void** buffer, void** data, uint* size);
+        
+        /**
+         * @brief Returns an acquired buffer, that will not be pushed, to 
+         * this AppSourceBintr's buffer pool.
+         * @param[in] buffer buffer previously returned by AcquireBuffer.
+         */
+        void ReleaseBuffer(void* buffer);
+        
+        /**
+         * @brief Wraps client memory in a new buffer, without copying, and
+         * pushes it to this AppSourceBintr for processing.
+         * @param[in] data pointer to the client memory to wrap.
+         * @param[in] size size of the client memory in bytes.
+         * @param[in] releaseHandler client callback to be called when the
+         * memory is no longer in use.
+         * @param[in] clientData opaque pointer to client data passed back 
+         * into the releaseHandler function.
+         * @return true on successful push, false otherwise. The client
+         * retains ownership of the memory on failure.
+         */
+        bool PushMemory(void* data, uint size, 
+            dsl_source_app_memory_release_cb releaseHandler, void* clientData);
+
 //        /**
 //         * @brief Gets the current leaky-type in use by this AppSourceBintr
 //         * @return leaky-type one of the DSL_QUEUE_LEAKY_TYPE constant values. 
@@ -630,6 +708,18 @@ namespace DSL
         
     private:
     
+        /**
+         * @brief Creates and activates the buffer pool for this AppSourceBintr.
+         * @return true on success, false otherwise.
+         */
+        bool createBufferPool();
+        
+        /**
+         * @brief Deactivates and releases the buffer pool for this 
+         * AppSourceBintr. Buffers still in use are freed when released.
+         */
+        void destroyBufferPool();
+    
         /**
          * @brief stream format for the AppSourceBintr - on of the DSL_STREAM_FORMAT constants.
          */
@@ -679,6 +769,28 @@ namespace DSL
          */
         uint64_t m_maxBytes;
         
+        /**
+         * @brief Min-level of queued data as a percentage of the max-level. 
+         * appsrc will emit the "need-data" signal when the level falls below.
+         */
+        uint m_minPercent;
+        
+        /**
+         * @brief current DSL_SOURCE_APP_DATA_STATE, written on the streaming
+         * thread and read by the client.
+         */
+        std::atomic<uint> m_dataState;
+        
+        /**
+         * @brief number of buffers to pre-allocate, 0 if disabled.
+         */
+        uint m_bufferPoolSize;
+        
+        /**
+         * @brief buffer pool, created on LinkAll if m_bufferPoolSize > 0.
+         */
+        GstBufferPool* m_pBufferPool;
+        
         /**
          * @brief The maximum amount of buffers that can be queued internally. 
          * After the maximum amount of buffers are queued, appsrc will emit 
@@ -720,6 +832,31 @@ namespace DSL
      */
     static void on_enough_data_cb(GstElement source, 
         gpointer pAppSrcBintr);
+
+    /**
+     * @struct AppSourceMemory
+     * @brief Client memory and release handler wrapped by an AppSourceBintr
+     * buffer. Freed along with the buffer.
+     */
+    struct AppSourceMemory
+    {
+        void* m_data;
+        dsl_source_app_memory_release_cb m_releaseHandler;
+        void* m_clientData;
+        
+        /**
+         * @brief false if the push failed, in which case the client 
+         * retains ownership and is not called back.
+         */
+        bool m_notifyClient;
+    };
+    
+    /**
+     * @brief Destroy-notify function for a buffer wrapping client memory.
+     * Called from whichever thread drops the last reference to the buffer.
+     * @param pAppSourceMemory pointer to the AppSourceMemory to release.
+     */
+    static void on_app_source_memory_release_cb(gpointer pAppSourceMemory);
         
     //*********************************************************************************
     /**
@@ -1561,11 +1698,19 @@ namespace DSL
         bool RemoveStateChangeListener(dsl_state_change_listener_cb listener);
 
         /**
-         * @brief Called periodically on timer experation to Check the status of the RTSP stream
-         * and to initiate a reconnection cycle when the last buffer time execeeds timeout
+         * @brief Called on the main-loop, once the buffer timeout deadline has been
+         * exceeded, to Check the status of the RTSP stream and to initiate a 
+         * reconnection cycle when the last buffer time execeeds timeout
          */
         int StreamManager();
         
+        /**
+         * @brief Called by the TimerWheel on each buffer timeout deadline. Hands off 
+         * to the StreamManager on the main-loop if the last buffer time exceeds timeout.
+         * @return time in milliseconds to the next deadline, 0 to stop the watchdog.
+         */
+        uint StreamWatchdog();
+        
         /**
          * @brief Called to manage the reconnection cycle on loss of connection
          */
@@ -1704,10 +1849,16 @@ namespace DSL
         uint m_bufferTimeout;
         
         /**
-         * @brief gnome timer Id for RTSP stream-status and reconnect management 
+         * @brief TimerWheel timer Id for RTSP stream-status and reconnect management 
          */
         uint m_streamManagerTimerId;
         
+        /**
+         * @brief gsource Id of the one-shot idle handler that hands off from
+         * the stream-management watchdog to the main-loop, 0 if not pending.
+         */
+        uint m_streamManagerIdleId;
+        
         /**
          * @brief mutux to guard the buffer timeout managment read/write attributes.
          */
@@ -1855,12 +2006,19 @@ namespace DSL
     static gboolean StreamBufferSeekCB(gpointer pSource);
     
     /**
-     * @brief Timer callback handler to invoke the RTSP Source's Stream manager.
+     * @brief Idle callback handler to invoke the RTSP Source's Stream manager.
      * @param pSource shared pointer to RTSP Source component to check/manage.
-     * @return int true to continue, 0 to self remove
+     * @return int 0 always to self remove
      */
     static int RtspStreamManagerHandler(gpointer pSource);
     
+    /**
+     * @brief TimerWheel callback handler to invoke the RTSP Source's Stream watchdog.
+     * @param pSource shared pointer to RTSP Source component to check.
+     * @return time in milliseconds to the next deadline, 0 to self remove
+     */
+    static uint RtspStreamWatchdogHandler(void* pSource);
+    
     /**
      * @brief Timer callback handler to invoke the RTSP Source's Reconnection Manager.
      * @param[in] pSource shared pointer to RTSP Source component to invoke.
@@ -26,6 +26,8 @@ THE SOFTWARE.
 #define _DSL_SOURCE_METER_H
 
 #include "Dsl.h"
+#include "DslApi.h"
+#include "DslHistogram.h"
 
 namespace DSL
 {
@@ -33,9 +35,17 @@ namespace DSL
     #define DSL_SOURCE_METER_NEW(name) \
         std::shared_ptr<SourceMeter>(new SourceMeter(name))
 
+    /**
+     * @brief default frame interval, in milliseconds, above which a 
+     * source is considered stalled.
+     */
+    #define DSL_SOURCE_METER_DEFAULT_STALL_THRESHOLD 500
+
     /**
      * @class SourceMeter
      * @brief Implements a Meter to measure FPS over two seperate epics, one session, the other interval.
+     * All times are taken from the monotonic clock in units of microseconds. Each inter-frame 
+     * interval is recorded into a fixed-memory histogram that is cleared on each interval reset.
      */
     class SourceMeter
     {
@@ -47,26 +57,83 @@ namespace DSL
          */
         SourceMeter(uint sourceId)
             : m_sourceId(sourceId)
-            , m_timeStamp{0}
-            , m_sessionStartTime{0}
-            , m_intervalStartTime{0}
+            , m_timeStamp(0)
+            , m_sessionStartTime(0)
+            , m_intervalStartTime(0)
             , m_sessionFrameCount(0)
             , m_intervalFrameCount(0)
+            , m_stallThreshold(DSL_SOURCE_METER_DEFAULT_STALL_THRESHOLD*1000)
+            , m_isStalled(false)
+            , m_lastFrameNum(0)
+            , m_intervalDroppedFrames(0)
+            , m_intervalStalls(0)
             {};
 
         /**
-         * @brief Updates the Timestamp for the Source meter
+         * @brief Updates the Timestamp for the Source meter and records the
+         * interval since the previous frame.
          */
         void Timestamp()
         {
-            gettimeofday(&m_timeStamp, NULL);
+            int64_t timeStamp = g_get_monotonic_time();
             
             // one-time initialization of start times after creation.
-            if (!m_sessionStartTime.tv_sec)
+            if (!m_sessionStartTime)
+            {
+                m_sessionStartTime = timeStamp;
+                m_intervalStartTime = timeStamp;
+            }
+            else
+            {
+                int64_t frameInterval = timeStamp - m_timeStamp;
+                m_frameIntervals.Record(frameInterval);
+
+                // count the stall once, if not already counted on timeout.
+                if (frameInterval > m_stallThreshold and !m_isStalled)
+                {
+                    m_intervalStalls++;
+                }
+            }
+            m_isStalled = false;
+            m_timeStamp = timeStamp;
+        }
+        
+        /**
+         * @brief Estimates dropped frames from gaps in the frame number. 
+         * Must be called on each frame after IncrementFrameCounts().
+         * @param[in] frameNum frame number from the frame's metadata.
+         */
+        void UpdateFrameNumber(uint frameNum)
+        {
+            // a decreasing frame number indicates a stream restart.
+            if (m_sessionFrameCount > 1 and frameNum > m_lastFrameNum + 1)
             {
-                m_sessionStartTime = m_timeStamp;
-                m_intervalStartTime = m_timeStamp;
+                m_intervalDroppedFrames += frameNum - m_lastFrameNum - 1;
             }
+            m_lastFrameNum = frameNum;
+        }
+        
+        /**
+         * @brief Checks for a stall in progress, i.e. no frame received within 
+         * the stall threshold. Called on each interval timeout.
+         */
+        void CheckForStall()
+        {
+            if (m_timeStamp and !m_isStalled and 
+                (g_get_monotonic_time() - m_timeStamp) > m_stallThreshold)
+            {
+                m_intervalStalls++;
+                m_isStalled = true;
+            }
+        }
+        
+        /**
+         * @brief Sets the frame interval above which the source is stalled.
+         * @param[in] stallThreshold new threshold in milliseconds.
+         */
+        void SetStallThreshold(uint stallThreshold)
+        {
+            m_stallThreshold = (int64_t)stallThreshold*1000;
         }
         
         /**
@@ -94,6 +161,9 @@ namespace DSL
         {
             m_intervalStartTime = m_timeStamp;
             m_intervalFrameCount = 0;
+            m_intervalDroppedFrames = 0;
+            m_intervalStalls = 0;
+            m_frameIntervals.Reset();
         };
         
         /**
@@ -102,16 +172,12 @@ namespace DSL
          */
         double GetSessionFpsAvg()
         {
-            if (!m_sessionFrameCount)
+            if (!m_sessionFrameCount or m_timeStamp <= m_sessionStartTime)
             {
                 return 0;
             }
-            // convert both secconds and micro-seconds to milli-seconds and add to greate single number
-            uint64_t sessionTime =             
-                (uint64_t)(m_timeStamp.tv_sec*1000 + m_timeStamp.tv_usec/1000) - 
-                (uint64_t)(m_sessionStartTime.tv_sec*1000 + m_sessionStartTime.tv_usec/1000);
-
-            double sessionFpsAvg = (double)m_sessionFrameCount / ((double)sessionTime/1000);        
+            double sessionFpsAvg = (double)m_sessionFrameCount / 
+                ((double)(m_timeStamp - m_sessionStartTime)/1000000);        
             
             LOG_INFO("Source '" << m_sourceId << "' session FPS avg = " << sessionFpsAvg);
             return sessionFpsAvg;
@@ -123,19 +189,36 @@ namespace DSL
          */
         double GetIntervalFpsAvg()
         {
-            if (!m_intervalFrameCount)
+            if (!m_intervalFrameCount or m_timeStamp <= m_intervalStartTime)
             {
                 return 0;
             }
-            uint64_t intervalTime =             
-                (uint64_t)(m_timeStamp.tv_sec*1000 + m_timeStamp.tv_usec/1000) - 
-                (uint64_t)(m_intervalStartTime.tv_sec*1000 + m_intervalStartTime.tv_usec/1000);
-
-            double intervalFpsAvg = (double)m_intervalFrameCount / ((double)intervalTime/1000);
+            double intervalFpsAvg = (double)m_intervalFrameCount / 
+                ((double)(m_timeStamp - m_intervalStartTime)/1000000);
 
             LOG_INFO("Source '" << m_sourceId << "' interval FPS avg = " << intervalFpsAvg);
             return intervalFpsAvg;
         }
+        
+        /**
+         * @brief Gets the frame-interval statistics for the current interval.
+         * @param[out] stats statistics structure to fill in.
+         */
+        void GetIntervalStats(dsl_meter_source_stats& stats)
+        {
+            stats.source_id = m_sourceId;
+            stats.session_fps_avg = GetSessionFpsAvg();
+            stats.interval_fps_avg = GetIntervalFpsAvg();
+            stats.frame_count = m_intervalFrameCount;
+            stats.frame_interval_mean = (uint)round(m_frameIntervals.GetMean());
+            stats.frame_interval_p50 = m_frameIntervals.GetPercentile(50);
+            stats.frame_interval_p90 = m_frameIntervals.GetPercentile(90);
+            stats.frame_interval_p99 = m_frameIntervals.GetPercentile(99);
+            stats.frame_interval_max = m_frameIntervals.GetMax();
+            stats.jitter = (uint)round(m_frameIntervals.GetStdDev());
+            stats.dropped_frames = m_intervalDroppedFrames;
+            stats.stalls = m_intervalStalls;
+        }
     
     private:
     
@@ -145,19 +228,19 @@ namespace DSL
         int m_sourceId;
         
         /**
-         * @brief timestamp updated on each buffer with frame meta for the unique source
+         * @brief monotonic timestamp updated on each buffer with frame meta for the unique source
          */
-        struct timeval m_timeStamp;
+        int64_t m_timeStamp;
         
         /**
-         * @brief timestamp for the start of the current session
+         * @brief monotonic timestamp for the start of the current session
          */
-        struct timeval m_sessionStartTime;
+        int64_t m_sessionStartTime;
 
         /**
-         * @brief timestamp for the start of the current session
+         * @brief monotonic timestamp for the start of the current interval
          */
-        struct timeval m_intervalStartTime;
+        int64_t m_intervalStartTime;
         
         /**
          * @brief Frame count since the start of the current session
@@ -168,6 +251,36 @@ namespace DSL
          * @brief Frame count since the start of the current interval
          */
         uint m_sessionFrameCount;
+        
+        /**
+         * @brief frame interval above which the source is stalled, in microseconds.
+         */
+        int64_t m_stallThreshold;
+        
+        /**
+         * @brief true if a stall in progress has already been counted.
+         */
+        bool m_isStalled;
+        
+        /**
+         * @brief frame number of the last frame received.
+         */
+        uint m_lastFrameNum;
+        
+        /**
+         * @brief estimated frames dropped since the start of the current interval.
+         */
+        uint m_intervalDroppedFrames;
+
+        /**
+         * @brief stalls since the start of the current interval.
+         */
+        uint m_intervalStalls;
+        
+        /**
+         * @brief inter-frame intervals since the start of the current interval.
+         */
+        LogLinearHistogram m_frameIntervals;
     };
 }
 #endif // _DSL_SOURCE_METER_H
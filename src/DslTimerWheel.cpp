@@ -0,0 +1,425 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslTimerWheel.h"
+
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace DSL
+{
+    TimerWheel& TimerWheel::GetTimerWheel()
+    {
+        // Function-local static - the thread is stopped at exit.
+        static TimerWheel timerWheel;
+        
+        return timerWheel;
+    }
+
+    TimerWheel::TimerWheel()
+        : m_slots{}
+        , m_occupied{}
+        , m_currentTick(now())
+        , m_armedTick(0)
+        , m_lastTimerId(0)
+        , m_runningTimerId(0)
+        , m_timerFd(-1)
+        , m_pThread(NULL)
+        , m_stop(false)
+    {
+        LOG_FUNC();
+        
+        g_mutex_init(&m_wheelMutex);
+        g_cond_init(&m_callbackCond);
+        
+        m_timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+        if (m_timerFd < 0)
+        {
+            LOG_ERROR("Failed to create timerfd for the TimerWheel, errno = " 
+                << errno);
+            throw std::runtime_error("timerfd_create failed");
+        }
+        m_pThread = g_thread_new("dsl-timer-wheel", TimerWheelThread, this);
+    }
+    
+    TimerWheel::~TimerWheel()
+    {
+        LOG_FUNC();
+        
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_wheelMutex);
+            
+            // Arm for immediate expiry to wake the thread.
+            m_stop = true;
+            struct itimerspec timerSpec{};
+            timerSpec.it_value.tv_nsec = 1;
+            timerfd_settime(m_timerFd, 0, &timerSpec, NULL);
+        }
+        g_thread_join(m_pThread);
+        close(m_timerFd);
+        
+        for (auto const& imap: m_timers)
+        {
+            delete imap.second;
+        }
+        g_cond_clear(&m_callbackCond);
+        g_mutex_clear(&m_wheelMutex);
+    }
+    
+    uint TimerWheel::Schedule(uint timeout, dsl_timer_wheel_cb callback, 
+        void* pUserData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_wheelMutex);
+        
+        // Skip 0 and any id still in use on wrap-around.
+        do
+        {
+            m_lastTimerId++;
+        } while (!m_lastTimerId or m_timers.find(m_lastTimerId) != m_timers.end());
+        
+        TimerWheelEntry* pEntry = new TimerWheelEntry{};
+        pEntry->m_timerId = m_lastTimerId;
+        pEntry->m_expiry = std::max(now(), m_currentTick) + std::max(timeout, 1U);
+        pEntry->m_callback = callback;
+        pEntry->m_pUserData = pUserData;
+        
+        m_timers[pEntry->m_timerId] = pEntry;
+        insert(pEntry);
+        rearm(false);
+        
+        return pEntry->m_timerId;
+    }
+    
+    bool TimerWheel::Cancel(uint timerId)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_wheelMutex);
+        
+        auto imap = m_timers.find(timerId);
+        if (imap == m_timers.end())
+        {
+            return false;
+        }
+        TimerWheelEntry* pEntry = imap->second;
+        m_timers.erase(imap);
+        
+        if (pEntry->m_level >= 0)
+        {
+            unlink(pEntry);
+            delete pEntry;
+        }
+        else
+        {
+            // Expired or running - the timer thread owns the entry.
+            pEntry->m_isCancelled = true;
+        }
+        return true;
+    }
+    
+    bool TimerWheel::CancelAndWait(uint timerId)
+    {
+        LOG_FUNC();
+        
+        bool result = Cancel(timerId);
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_wheelMutex);
+        
+        // A callback can cancel its own timer without waiting on itself.
+        while (m_runningTimerId == timerId and g_thread_self() != m_pThread)
+        {
+            g_cond_wait(&m_callbackCond, &m_wheelMutex);
+        }
+        return result;
+    }
+    
+    uint TimerWheel::GetTimerCount()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_wheelMutex);
+        
+        return m_timers.size();
+    }
+    
+    uint TimerWheel::GetRunningTimerId()
+    {
+        // Do not log function entry - called from timer callbacks.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_wheelMutex);
+        
+        return m_runningTimerId;
+    }
+    
+    void TimerWheel::Run()
+    {
+        LOG_FUNC();
+        
+        std::vector<TimerWheelEntry*> expired;
+        
+        while (true)
+        {
+            // Blocks until the armed deadline, indefinitely if disarmed.
+            uint64_t expirations(0);
+            if (read(m_timerFd, &expirations, sizeof(expirations)) < 0 and 
+                errno != EINTR)
+            {
+                LOG_ERROR("TimerWheel failed to read timerfd, errno = " << errno);
+            }
+            
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_wheelMutex);
+            
+            if (m_stop)
+            {
+                break;
+            }
+            m_armedTick = 0;
+            advance(now(), expired);
+            
+            for (auto const& pEntry: expired)
+            {
+                if (pEntry->m_isCancelled)
+                {
+                    delete pEntry;
+                    continue;
+                }
+                m_runningTimerId = pEntry->m_timerId;
+                
+                // Call the client without the wheel locked so that it can
+                // schedule and cancel timers, its own included.
+                g_mutex_unlock(&m_wheelMutex);
+                
+                uint next(0);
+                try
+                {
+                    next = pEntry->m_callback(pEntry->m_pUserData);
+                }
+                catch(...)
+                {
+                    LOG_ERROR("TimerWheel callback for timer " << pEntry->m_timerId 
+                        << " threw an exception - stopping timer");
+                }
+                g_mutex_lock(&m_wheelMutex);
+                m_runningTimerId = 0;
+                
+                if (next and !pEntry->m_isCancelled)
+                {
+                    pEntry->m_expiry = std::max(now(), m_currentTick) + next;
+                    insert(pEntry);
+                }
+                else
+                {
+                    if (!pEntry->m_isCancelled)
+                    {
+                        m_timers.erase(pEntry->m_timerId);
+                    }
+                    delete pEntry;
+                }
+                g_cond_broadcast(&m_callbackCond);
+            }
+            expired.clear();
+            rearm(true);
+        }
+    }
+    
+    uint64_t TimerWheel::now()
+    {
+        return g_get_monotonic_time()/1000;
+    }
+    
+    void TimerWheel::insert(TimerWheelEntry* pEntry)
+    {
+        // The highest slot-group in which the expiry and current tick
+        // differ determines the level.
+        uint64_t diff = pEntry->m_expiry ^ m_currentTick;
+        int level = (diff) 
+            ? (63 - __builtin_clzll(diff)) / DSL_TIMER_WHEEL_SLOT_BITS : 0;
+        uint slot;
+        
+        if (level >= DSL_TIMER_WHEEL_LEVELS)
+        {
+            // Beyond the span of the wheel - hold in the last slot to be 
+            // visited at the top level and cascade again from there.
+            level = DSL_TIMER_WHEEL_LEVELS - 1;
+            slot = ((m_currentTick >> (level*DSL_TIMER_WHEEL_SLOT_BITS)) - 1) 
+                & DSL_TIMER_WHEEL_SLOT_MASK;
+        }
+        else
+        {
+            slot = (pEntry->m_expiry >> (level*DSL_TIMER_WHEEL_SLOT_BITS)) 
+                & DSL_TIMER_WHEEL_SLOT_MASK;
+        }
+        pEntry->m_level = level;
+        pEntry->m_slot = slot;
+        pEntry->m_pPrev = NULL;
+        pEntry->m_pNext = m_slots[level][slot];
+        if (pEntry->m_pNext)
+        {
+            pEntry->m_pNext->m_pPrev = pEntry;
+        }
+        m_slots[level][slot] = pEntry;
+        m_occupied[level] |= (1ULL << slot);
+    }
+    
+    void TimerWheel::unlink(TimerWheelEntry* pEntry)
+    {
+        if (pEntry->m_pPrev)
+        {
+            pEntry->m_pPrev->m_pNext = pEntry->m_pNext;
+        }
+        else
+        {
+            m_slots[pEntry->m_level][pEntry->m_slot] = pEntry->m_pNext;
+        }
+        if (pEntry->m_pNext)
+        {
+            pEntry->m_pNext->m_pPrev = pEntry->m_pPrev;
+        }
+        if (!m_slots[pEntry->m_level][pEntry->m_slot])
+        {
+            m_occupied[pEntry->m_level] &= ~(1ULL << pEntry->m_slot);
+        }
+        pEntry->m_level = -1;
+        pEntry->m_pPrev = pEntry->m_pNext = NULL;
+    }
+    
+    void TimerWheel::advance(uint64_t tick, 
+        std::vector<TimerWheelEntry*>& expired)
+    {
+        if (tick <= m_currentTick)
+        {
+            return;
+        }
+        std::vector<TimerWheelEntry*> pending;
+        
+        for (uint level = 0; level < DSL_TIMER_WHEEL_LEVELS; level++)
+        {
+            uint shift = level*DSL_TIMER_WHEEL_SLOT_BITS;
+            uint64_t oldGroup = m_currentTick >> shift;
+            uint64_t newGroup = tick >> shift;
+            
+            // If unchanged at this level, unchanged at all higher levels.
+            if (newGroup == oldGroup)
+            {
+                break;
+            }
+            // Mask of all slots passed, i.e. oldGroup+1 through newGroup.
+            uint64_t passed(~0ULL);
+            if (newGroup - oldGroup < DSL_TIMER_WHEEL_SLOTS)
+            {
+                uint first = (oldGroup + 1) & DSL_TIMER_WHEEL_SLOT_MASK;
+                passed = (1ULL << (newGroup - oldGroup)) - 1;
+                passed = (first) 
+                    ? (passed << first) | (passed >> (DSL_TIMER_WHEEL_SLOTS - first)) 
+                    : passed;
+            }
+            passed &= m_occupied[level];
+            
+            while (passed)
+            {
+                uint slot = __builtin_ctzll(passed);
+                passed &= passed - 1;
+                
+                while (m_slots[level][slot])
+                {
+                    TimerWheelEntry* pEntry = m_slots[level][slot];
+                    unlink(pEntry);
+                    pending.push_back(pEntry);
+                }
+            }
+        }
+        m_currentTick = tick;
+        
+        // Expire, or cascade down to a lower level.
+        for (auto const& pEntry: pending)
+        {
+            if (pEntry->m_expiry <= tick)
+            {
+                expired.push_back(pEntry);
+            }
+            else
+            {
+                insert(pEntry);
+            }
+        }
+    }
+    
+    uint64_t TimerWheel::nextDeadline()
+    {
+        uint64_t deadline(0);
+        
+        for (uint level = 0; level < DSL_TIMER_WHEEL_LEVELS; level++)
+        {
+            if (!m_occupied[level])
+            {
+                continue;
+            }
+            uint shift = level*DSL_TIMER_WHEEL_SLOT_BITS;
+            uint64_t group = m_currentTick >> shift;
+            
+            // Distance, 1 to 64 slots, to the next occupied slot.
+            uint first = (group + 1) & DSL_TIMER_WHEEL_SLOT_MASK;
+            uint64_t rotated = (first) 
+                ? (m_occupied[level] >> first) | 
+                    (m_occupied[level] << (DSL_TIMER_WHEEL_SLOTS - first))
+                : m_occupied[level];
+            uint64_t tick = (group + __builtin_ctzll(rotated) + 1) << shift;
+            
+            if (!deadline or tick < deadline)
+            {
+                deadline = tick;
+            }
+        }
+        return deadline;
+    }
+    
+    void TimerWheel::rearm(bool force)
+    {
+        uint64_t deadline = nextDeadline();
+        
+        if (!force and m_armedTick and (!deadline or deadline >= m_armedTick))
+        {
+            return;
+        }
+        // Absolute CLOCK_MONOTONIC time - a deadline in the past expires
+        // immediately. A zero it_value disarms the timerfd.
+        struct itimerspec timerSpec{};
+        if (deadline)
+        {
+            timerSpec.it_value.tv_sec = deadline / 1000;
+            timerSpec.it_value.tv_nsec = (deadline % 1000) * 1000000;
+        }
+        if (timerfd_settime(m_timerFd, TFD_TIMER_ABSTIME, &timerSpec, NULL) < 0)
+        {
+            LOG_ERROR("TimerWheel failed to arm timerfd, errno = " << errno);
+        }
+        m_armedTick = deadline;
+    }
+    
+    static gpointer TimerWheelThread(gpointer pTimerWheel)
+    {
+        static_cast<TimerWheel*>(pTimerWheel)->Run();
+        
+        return NULL;
+    }
+}
@@ -0,0 +1,254 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_TIMER_WHEEL_H
+#define _DSL_TIMER_WHEEL_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @brief Number of wheel levels and slots per level, as a power of two.
+     * With a 1 ms tick, 4 levels of 64 slots span 2^24 ms, ~4.6 hours. 
+     * Longer timeouts are held in the last slot of the top level and 
+     * cascaded until they expire.
+     */
+    #define DSL_TIMER_WHEEL_LEVELS 4
+    #define DSL_TIMER_WHEEL_SLOT_BITS 6
+    #define DSL_TIMER_WHEEL_SLOTS (1 << DSL_TIMER_WHEEL_SLOT_BITS)
+    #define DSL_TIMER_WHEEL_SLOT_MASK (DSL_TIMER_WHEEL_SLOTS - 1)
+
+    /**
+     * @brief Timer Wheel callback typedef. 
+     * @param[in] pUserData opaque pointer provided on Schedule.
+     * @return time until the next expiry in milliseconds, 0 to stop the timer.
+     */
+    typedef uint (*dsl_timer_wheel_cb)(void* pUserData);
+
+    /**
+     * @struct TimerWheelEntry
+     * @brief Single timer, linked into one slot of the wheel while pending.
+     * m_level is -1 while the timer is expired and waiting on, or running, 
+     * its callback.
+     */
+    struct TimerWheelEntry
+    {
+        uint m_timerId;
+        uint64_t m_expiry;
+        dsl_timer_wheel_cb m_callback;
+        void* m_pUserData;
+        bool m_isCancelled;
+        int m_level;
+        uint m_slot;
+        TimerWheelEntry* m_pPrev;
+        TimerWheelEntry* m_pNext;
+    };
+
+    /**
+     * @class TimerWheel
+     * @brief Single hierarchical timer wheel shared by all DSL watchdogs and
+     * periodic timers. The wheel is driven by one thread blocked on a 
+     * CLOCK_MONOTONIC timerfd that is armed for the next deadline only, so 
+     * there are no wakeups while no timer is due. Schedule and Cancel are O(1).
+     * Callbacks are called from the timer thread, never from the main-loop, 
+     * and with no wheel lock held. Callbacks that must run on the main-loop 
+     * need to hand off with g_idle_add.
+     */
+    class TimerWheel
+    {
+    public:
+
+        /**
+         * @brief Returns the single TimerWheel instance.
+         */
+        static TimerWheel& GetTimerWheel();
+
+        /**
+         * @brief Schedules a new timer. 
+         * @param[in] timeout time until expiry in milliseconds.
+         * @param[in] callback function to call on expiry. The function returns
+         * the time to its next expiry, or 0 to stop the timer.
+         * @param[in] pUserData opaque pointer to return on callback.
+         * @return unique non-zero timer id.
+         */
+        uint Schedule(uint timeout, dsl_timer_wheel_cb callback, void* pUserData);
+        
+        /**
+         * @brief Cancels a timer. The callback will not be started once Cancel
+         * returns, but may still be running - as with g_source_remove. 
+         * Safe to call with locks held that the callback acquires.
+         * @param[in] timerId unique id of the timer to cancel.
+         * @return true if the timer was found, false otherwise.
+         */
+        bool Cancel(uint timerId);
+        
+        /**
+         * @brief Cancels a timer and, if its callback is currently running, 
+         * waits for it to return. Used on destruction of the callback's owner.
+         * Must not be called with locks held that the callback acquires.
+         * @param[in] timerId unique id of the timer to cancel.
+         * @return true if the timer was found, false otherwise.
+         */
+        bool CancelAndWait(uint timerId);
+        
+        /**
+         * @brief Gets the number of currently scheduled timers.
+         * @return current timer count.
+         */
+        uint GetTimerCount();
+        
+        /**
+         * @brief Gets the id of the timer whose callback is currently running.
+         * Called from within a callback to identify the timer that fired, as
+         * a callback can share its user data between successive timers.
+         * @return id of the running timer, 0 if no callback is running.
+         */
+        uint GetRunningTimerId();
+        
+        /**
+         * @brief Timer thread function, blocks on the timerfd until stopped.
+         */
+        void Run();
+
+    private:
+
+        TimerWheel();
+
+        ~TimerWheel();
+
+        /**
+         * @brief Returns the current time in wheel ticks (milliseconds).
+         */
+        static uint64_t now();
+        
+        /**
+         * @brief Links a timer into the slot for its expiry, relative
+         * to the current tick. The m_wheelMutex must be held by the caller.
+         * @param[in] pEntry timer to link.
+         */
+        void insert(TimerWheelEntry* pEntry);
+
+        /**
+         * @brief Unlinks a timer from its current slot. The m_wheelMutex 
+         * must be held by the caller.
+         * @param[in] pEntry timer to unlink.
+         */
+        void unlink(TimerWheelEntry* pEntry);
+
+        /**
+         * @brief Advances the wheel to a new current tick, cascading timers
+         * from all slots passed and collecting those that have expired.
+         * The m_wheelMutex must be held by the caller.
+         * @param[in] tick new current tick.
+         * @param[out] expired timers that have expired, in no specific order.
+         */
+        void advance(uint64_t tick, std::vector<TimerWheelEntry*>& expired);
+        
+        /**
+         * @brief Returns the next tick at which the wheel must be advanced,
+         * either to expire or cascade one or more timers. 
+         * The m_wheelMutex must be held by the caller.
+         * @return next deadline in ticks, 0 if the wheel is empty.
+         */
+        uint64_t nextDeadline();
+        
+        /**
+         * @brief Arms the timerfd for the next deadline, if earlier than
+         * currently armed. The m_wheelMutex must be held by the caller.
+         * @param[in] force if true, rearm even if the deadline is later.
+         */
+        void rearm(bool force);
+
+        /**
+         * @brief Mutex to protect all wheel state.
+         */
+        GMutex m_wheelMutex;
+
+        /**
+         * @brief Condition signaled each time a callback returns, used by
+         * CancelAndWait.
+         */
+        GCond m_callbackCond;
+
+        /**
+         * @brief Slot lists for all levels, each a doubly-linked list head.
+         */
+        TimerWheelEntry* m_slots[DSL_TIMER_WHEEL_LEVELS][DSL_TIMER_WHEEL_SLOTS];
+
+        /**
+         * @brief One bit per occupied slot, for each level.
+         */
+        uint64_t m_occupied[DSL_TIMER_WHEEL_LEVELS];
+
+        /**
+         * @brief Map of all scheduled timers by unique id.
+         */
+        std::unordered_map<uint, TimerWheelEntry*> m_timers;
+
+        /**
+         * @brief Current tick, i.e. the tick the wheel was last advanced to.
+         */
+        uint64_t m_currentTick;
+
+        /**
+         * @brief Tick the timerfd is currently armed for, 0 if disarmed.
+         */
+        uint64_t m_armedTick;
+
+        /**
+         * @brief Last timer id assigned.
+         */
+        uint m_lastTimerId;
+
+        /**
+         * @brief Id of the timer whose callback is currently running, 0 if none.
+         */
+        uint m_runningTimerId;
+
+        /**
+         * @brief CLOCK_MONOTONIC timerfd the timer thread blocks on.
+         */
+        int m_timerFd;
+
+        /**
+         * @brief Timer thread.
+         */
+        GThread* m_pThread;
+
+        /**
+         * @brief Set to true to signal the timer thread to exit.
+         */
+        bool m_stop;
+    };
+
+    /**
+     * @brief TimerWheel thread function.
+     * @param[in] pTimerWheel pointer to the TimerWheel that started the thread.
+     */
+    static gpointer TimerWheelThread(gpointer pTimerWheel);
+
+} // namespace
+
+#endif // _DSL_TIMER_WHEEL_H
@@ -34,7 +34,7 @@ namespace DSL
         const char* turnServer, uint codec, uint bitrate, uint interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -67,7 +67,7 @@ namespace DSL
     DslReturnType Services::SinkWebRtcConnectionClose(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -99,7 +99,7 @@ namespace DSL
         const char** stunServer, const char** turnServer)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -127,7 +127,7 @@ namespace DSL
         const char* stunServer, const char* turnServer)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -155,7 +155,7 @@ namespace DSL
         dsl_sink_webrtc_client_listener_cb listener, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -188,7 +188,7 @@ namespace DSL
         dsl_sink_webrtc_client_listener_cb listener)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -217,10 +217,83 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::SinkWebRtcFanoutNew(const char* name, 
+        const char* stunServer, const char* turnServer, uint codec, 
+        uint bitrate, uint interval, uint maxPeers)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            // ensure component name uniqueness 
+            if (m_components.find(name) != m_components.end())
+            {   
+                LOG_ERROR("Sink name '" << name << "' is not unique");
+                return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+            }
+            if (codec != DSL_CODEC_H264 and codec != DSL_CODEC_H265)
+            {   
+                LOG_ERROR("Invalid Codec value = " << codec 
+                    << " for WebRTC Fan-out Sink '" << name << "'");
+                return DSL_RESULT_SINK_CODEC_VALUE_INVALID;
+            }
+            if (!maxPeers)
+            {   
+                LOG_ERROR("Invalid max-peers value = " << maxPeers 
+                    << " for WebRTC Fan-out Sink '" << name << "'");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
+            m_components[name] = DSL_WEBRTC_FANOUT_SINK_NEW(name,
+                stunServer, turnServer, codec, bitrate, interval, maxPeers);
+
+            LOG_INFO("New WebRTC Fan-out Sink '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New WebRTC Fan-out Sink '" << name << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SinkWebRtcFanoutStatsGet(const char* name, 
+        uint* peers, uint64_t* droppedBuffers, uint64_t* keyFrameRequests)
+    {
+        LOG_FUNC();
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
+
+        try
+        {
+            DSL_RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, 
+                WebRtcFanoutSinkBintr);
+
+            DSL_WEBRTC_FANOUT_SINK_PTR pWebRtcFanoutSinkBintr = 
+                std::dynamic_pointer_cast<WebRtcFanoutSinkBintr>(m_components[name]);
+
+            pWebRtcFanoutSinkBintr->GetStats(peers, droppedBuffers, keyFrameRequests);
+
+            LOG_INFO("WebRTC Fan-out Sink '" << name << "' returned peers = " 
+                << *peers << ", dropped-buffers = " << *droppedBuffers 
+                << ", key-frame-requests = " << *keyFrameRequests 
+                << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("WebRTC Fan-out Sink '" << name 
+                << "' threw an exception getting stats");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::WebsocketServerPathAdd(const char* path)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -245,7 +318,7 @@ namespace DSL
     DslReturnType Services::WebsocketServerListeningStart(uint portNumber)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -270,7 +343,7 @@ namespace DSL
     DslReturnType Services::WebsocketServerListeningStop()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -294,7 +367,7 @@ namespace DSL
         boolean* isListening, uint* portNumber)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -315,7 +388,7 @@ namespace DSL
         dsl_websocket_server_client_listener_cb listener, void* clientData)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
@@ -339,7 +412,7 @@ namespace DSL
         dsl_websocket_server_client_listener_cb listener)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_RWLOCK_FOR_WRITING_CURRENT_SCOPE(&m_servicesLock);
 
         try
         {
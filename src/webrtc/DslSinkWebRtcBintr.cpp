@@ -29,11 +29,67 @@ THE SOFTWARE.
 
 namespace DSL
 {
+    WebRtcSignalingPeer::WebRtcSignalingPeer(const char* name)
+        : SignalingTransceiver()
+        , m_peerName(name)
+        , m_pDataChannel(NULL)
+        , m_dataChannelOnErrorSignalHandlerId(0)
+        , m_dataChannelOnOpenSignalHandlerId(0)
+        , m_dataChannelOnCloseSignalHandlerId(0)
+        , m_dataChannelOnMessageSignalHandlerId(0)
+    {
+        LOG_FUNC();
+    }
+
+    WebRtcSignalingPeer::~WebRtcSignalingPeer()
+    {
+        LOG_FUNC();
+    }
+
+    const std::string& WebRtcSignalingPeer::GetPeerName()
+    {
+        LOG_FUNC();
+
+        return m_peerName;
+    }
+
+    void WebRtcSignalingPeer::createWebRtcBin(const char* elementName,
+        const std::string& stunServer, const std::string& turnServer)
+    {
+        LOG_FUNC();
+
+        m_pWebRtcBin = DSL_ELEMENT_NEW("webrtcbin", elementName);
+
+        // Set the STUN and/or TURN server 
+        if (stunServer.size())
+        {
+            m_pWebRtcBin->SetAttribute("stun-server", stunServer.c_str());
+        }
+        if (turnServer.size())
+        {
+            m_pWebRtcBin->SetAttribute("turn-server", turnServer.c_str());
+        }
+
+        g_signal_connect(m_pWebRtcBin->GetGstObject(), "pad-added",
+            G_CALLBACK(on_pad_added_cb), (gpointer)this);
+        g_signal_connect(m_pWebRtcBin->GetGstObject(), "pad-removed",
+            G_CALLBACK(on_pad_removed_cb), (gpointer)this);
+        g_signal_connect(m_pWebRtcBin->GetGstObject(), "no-more-pads",
+            G_CALLBACK(on_no_more_pads_cb), (gpointer)this);
+        g_signal_connect(m_pWebRtcBin->GetGstObject(), "on-negotiation-needed", 
+            G_CALLBACK(on_negotiation_needed_cb), (gpointer)this);
+        g_signal_connect(m_pWebRtcBin->GetGstObject(), "on-ice-candidate",
+            G_CALLBACK(on_ice_candidate_cb), (gpointer)this);
+        g_signal_connect(m_pWebRtcBin->GetGstObject(), "on-new-transceiver",
+            G_CALLBACK(on_new_transceiver_cb), (gpointer)this);
+        g_signal_connect(m_pWebRtcBin->GetGstObject(), "on-data-channel",
+            G_CALLBACK(on_data_channel_cb), (gpointer)this);
+    }
+
     WebRtcSinkBintr::WebRtcSinkBintr(const char* name, const char* stunServer, 
         const char* turnServer, uint codec, uint bitrate, uint interval)
         : EncodeSinkBintr(name, codec, bitrate, interval)
-        , SignalingTransceiver()
-        , m_pDataChannel(NULL)
+        , WebRtcSignalingPeer(name)
         , m_stunServer(stunServer)
         , m_turnServer(turnServer)
         , m_completeClosedTimerId(0)
@@ -88,32 +144,7 @@ namespace DSL
             LOG_ERROR("WebRtcSinkBintr '" << GetName() << "' is already linked");
         }
 
-        m_pWebRtcBin = DSL_ELEMENT_NEW("webrtcbin", name);
-
-        // Set the STUN and/or TURN server 
-        if (m_stunServer.size())
-        {
-            m_pWebRtcBin->SetAttribute("stun-server", m_stunServer.c_str());
-        }
-        if (m_turnServer.size())
-        {
-            m_pWebRtcBin->SetAttribute("turn-server", m_turnServer.c_str());
-        }
-
-        g_signal_connect(m_pWebRtcBin->GetGstObject(), "pad-added",
-            G_CALLBACK(on_pad_added_cb), (gpointer)this);
-        g_signal_connect(m_pWebRtcBin->GetGstObject(), "pad-removed",
-            G_CALLBACK(on_pad_removed_cb), (gpointer)this);
-        g_signal_connect(m_pWebRtcBin->GetGstObject(), "no-more-pads",
-            G_CALLBACK(on_no_more_pads_cb), (gpointer)this);
-        g_signal_connect(m_pWebRtcBin->GetGstObject(), "on-negotiation-needed", 
-            G_CALLBACK(on_negotiation_needed_cb), (gpointer)this);
-        g_signal_connect(m_pWebRtcBin->GetGstObject(), "on-ice-candidate",
-            G_CALLBACK(on_ice_candidate_cb), (gpointer)this);
-        g_signal_connect(m_pWebRtcBin->GetGstObject(), "on-new-transceiver",
-            G_CALLBACK(on_new_transceiver_cb), (gpointer)this);
-        g_signal_connect(m_pWebRtcBin->GetGstObject(), "on-data-channel",
-            G_CALLBACK(on_data_channel_cb), (gpointer)this);
+        createWebRtcBin(GetCStrName(), m_stunServer, m_turnServer);
 
         AddChild(m_pWebRtcBin);
 
@@ -252,10 +283,7 @@ namespace DSL
         m_stunServer.assign(stunServer);
         m_turnServer.assign(turnServer);
 
-        // Set the STUN or TURN server properties
-        m_pWebRtcBin->SetAttribute("stun-server", m_stunServer.c_str());
-        m_pWebRtcBin->SetAttribute("turn-server", m_turnServer.c_str());
-
+        // The webrtcbin is created with the new servers on next LinkAll.
         return true;
     }
 
@@ -423,7 +451,7 @@ namespace DSL
     }
 
 
-    void WebRtcSinkBintr::OnMessage(SoupWebsocketConnection* pConnection, 
+    void WebRtcSignalingPeer::OnMessage(SoupWebsocketConnection* pConnection, 
         SoupWebsocketDataType dataType, GBytes* message)
     {
         LOG_FUNC();
@@ -435,7 +463,7 @@ namespace DSL
         switch (dataType)
         {
             case SOUP_WEBSOCKET_DATA_BINARY:
-                LOG_ERROR("WebRtcSinkBintr '" << GetName() << "' received unknown binary message, ignoring");
+                LOG_ERROR("WebRTC Peer '" << m_peerName << "' received unknown binary message, ignoring");
                 g_bytes_unref(message);
                 return;
 
@@ -443,14 +471,14 @@ namespace DSL
                 break;
 
             default:
-                LOG_ERROR("WebRtcSinkBintr '" << GetName() 
+                LOG_ERROR("WebRTC Peer '" << m_peerName 
                     << "' received unknown data type, ignoring");
                 g_bytes_unref(message);
                 return;
         }
 
-        LOG_INFO("message-received for WebRtcSinkBintr '" 
-            << GetName() << "'");
+        LOG_INFO("message-received for WebRTC Peer '" 
+            << m_peerName << "'");
 
         // Copy the message to a g-byte-array and unreference the message
         gsize size;
@@ -463,7 +491,7 @@ namespace DSL
         // Load the message into the JSON parser
         if (!json_parser_load_from_data(m_pJsonParser, dataString, -1, NULL))
         {
-            LOG_ERROR("WebRtcSinkBintr received unknown data type");
+            LOG_ERROR("WebRTC Peer received unknown data type");
             g_free(dataString);
             return;
         }
@@ -474,7 +502,7 @@ namespace DSL
         JsonNode* pRootJson = json_parser_get_root(m_pJsonParser);
         if (!JSON_NODE_HOLDS_OBJECT(pRootJson))
         {
-            LOG_ERROR("WebRtcSinkBintr '" << GetName() 
+            LOG_ERROR("WebRTC Peer '" << m_peerName 
                 << "' received a message a without a JSON Root");
             return;
         } 
@@ -482,7 +510,7 @@ namespace DSL
         JsonObject* pRootJsonObject = json_node_get_object(pRootJson);
         if (!json_object_has_member(pRootJsonObject, "type")) 
         {
-            LOG_ERROR("WebRtcSinkBintr '" << GetName() 
+            LOG_ERROR("WebRTC Peer '" << m_peerName 
                 << "' received a message without a type memeber");
             return;
         }
@@ -490,8 +518,8 @@ namespace DSL
         const gchar* typeString = json_object_get_string_member(pRootJsonObject, "type");
         if (!json_object_has_member(pRootJsonObject, "data")) 
         {
-            LOG_ERROR("WebRtcSinkBintr '" 
-                << GetName() << "' received a message without data");
+            LOG_ERROR("WebRTC Peer '" 
+                << m_peerName << "' received a message without data");
             return;
         }
 
@@ -502,7 +530,7 @@ namespace DSL
         {
             if (!json_object_has_member(pDataJsonObject, "type")) 
             {
-                LOG_ERROR("WebRtcSinkBintr '" << GetName() 
+                LOG_ERROR("WebRTC Peer '" << m_peerName 
                     << "' received a SDP message without type field");
                 return;
             }
@@ -511,7 +539,7 @@ namespace DSL
                     pDataJsonObject, "type");
             if (g_strcmp0 (sdpTypeString, "answer") != 0) 
             {
-                LOG_ERROR("WebRtcSinkBintr '" << GetName() 
+                LOG_ERROR("WebRTC Peer '" << m_peerName 
                     << "' expected SDP message without type 'answer' but received "
                     << sdpTypeString << "");
                 return;
@@ -519,20 +547,20 @@ namespace DSL
 
             if (!json_object_has_member(pDataJsonObject, "sdp")) 
             {
-                LOG_ERROR("WebRtcSinkBintr '" << GetName() 
+                LOG_ERROR("WebRTC Peer '" << m_peerName 
                     << "' received a SDP message without SDP string");
                 return;
             }
 
             const gchar* sdpString = json_object_get_string_member(pDataJsonObject, "sdp");
 
-            LOG_INFO("WebRtcSinkBintr '" << GetName() 
+            LOG_INFO("WebRTC Peer '" << m_peerName 
                 << "' received SDP: " << sdpString);
 
             GstSDPMessage *sdp;
             if (gst_sdp_message_new(&sdp) != GST_SDP_OK)
             {
-                LOG_ERROR("WebRtcSinkBintr '" << GetName() 
+                LOG_ERROR("WebRTC Peer '" << m_peerName 
                     << "' failed to create new SDP message");
                 return;
             }
@@ -541,7 +569,7 @@ namespace DSL
                 strlen(sdpString), sdp);
             if (ret != GST_SDP_OK) 
             {
-                LOG_ERROR("WebRtcSinkBintr '" << GetName() 
+                LOG_ERROR("WebRTC Peer '" << m_peerName 
                     << "' failed to parse SDP message");
                 return;
             }
@@ -550,13 +578,13 @@ namespace DSL
                     GST_WEBRTC_SDP_TYPE_ANSWER, sdp);
             if (!answer)
             {
-                LOG_ERROR("WebRtcSinkBintr '" << GetName() 
+                LOG_ERROR("WebRTC Peer '" << m_peerName 
                     << "' failed to create new webrtc session answer");
                 return;
             }
 
             GstPromise* pPromise = gst_promise_new_with_change_func(on_remote_desc_set_cb, 
-                m_pWebRtcBin->GetGstObject(), NULL);
+                (gpointer)this, NULL);
 
             g_signal_emit_by_name(G_OBJECT(m_pWebRtcBin->GetGObject()), 
                 "set-remote-description", answer, pPromise);    
@@ -569,7 +597,7 @@ namespace DSL
                     "channel", NULL, &m_pDataChannel);
                 if (!m_pDataChannel)
                 {
-                    LOG_ERROR("WebRtcSinkBintr '" << GetName() 
+                    LOG_ERROR("WebRTC Peer '" << m_peerName 
                         << "' failed to create data channel - returning");
                     return;
                 }
@@ -582,14 +610,14 @@ namespace DSL
         {
             if (!json_object_has_member(pDataJsonObject, "sdpMLineIndex")) 
             {
-                LOG_ERROR("WebRtcSinkBintr '" << GetName() 
+                LOG_ERROR("WebRTC Peer '" << m_peerName 
                     << "' received ICE message without mline index");
                 return;
             }
 
             if (!json_object_has_member(pDataJsonObject, "candidate")) 
             {
-                LOG_ERROR("WebRtcSinkBintr '" << GetName() 
+                LOG_ERROR("WebRTC Peer '" << m_peerName 
                     << "' received ICE message without ICE candidate string");
                 return;
             }
@@ -599,7 +627,7 @@ namespace DSL
             guint mlineIndex = json_object_get_int_member(
                 pDataJsonObject, "sdpMLineIndex");
 
-            LOG_INFO("WebRtcSinkBintr '" << GetName() 
+            LOG_INFO("WebRTC Peer '" << m_peerName 
                 << "' received ICE candidate with mline index: " << std::to_string(mlineIndex) 
                 << "; candidate: " << candidateString);
 
@@ -607,18 +635,18 @@ namespace DSL
         }
         else
         {
-            LOG_ERROR("WebRtcSinkBintr '" << GetName() << "' received unknown message type " << typeString 
+            LOG_ERROR("WebRTC Peer '" << m_peerName << "' received unknown message type " << typeString 
                 << ", returning");
         }
     }
 
-    void WebRtcSinkBintr::OnNegotiationNeeded()
+    void WebRtcSignalingPeer::OnNegotiationNeeded()
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_transceiverMutex);
 
-        LOG_INFO("on-negotiation-needed called for WebRtcSinkBintr '" 
-            << GetName() << "'");
+        LOG_INFO("on-negotiation-needed called for WebRTC Peer '" 
+            << m_peerName << "'");
 
         GstPromise* pPromise = gst_promise_new_with_change_func(
             on_offer_created_cb, (gpointer)this, NULL);
@@ -626,13 +654,13 @@ namespace DSL
             "create-offer", NULL, pPromise);
     }
 
-    void WebRtcSinkBintr::OnOfferCreated(GstPromise* pPromise)
+    void WebRtcSignalingPeer::OnOfferCreated(GstPromise* pPromise)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_transceiverMutex);
 
-        LOG_INFO("on-offer-created called for WebRtcSinkBintr '" 
-            << GetName() << "'");
+        LOG_INFO("on-offer-created called for WebRTC Peer '" 
+            << m_peerName << "'");
 
         GstStructure const* pReply = gst_promise_get_reply(pPromise);
         GstWebRTCSessionDescription *pOffer = NULL;
@@ -664,14 +692,14 @@ namespace DSL
         gst_webrtc_session_description_free(pOffer);  
     }
 
-    void WebRtcSinkBintr::OnIceCandidate(guint mLineIndex, gchar* candidate)
+    void WebRtcSignalingPeer::OnIceCandidate(guint mLineIndex, gchar* candidate)
     
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_transceiverMutex);
 
-        LOG_INFO("on-ice-candidate '" << candidate << "' received for WebRtcSinkBintr '" 
-            << GetName() << "'");
+        LOG_INFO("on-ice-candidate '" << candidate << "' received for WebRTC Peer '" 
+            << m_peerName << "'");
 
         JsonObject* iceJson = json_object_new();
         json_object_set_string_member(iceJson, "type", "ice");
@@ -688,49 +716,49 @@ namespace DSL
         g_free(jsonStr);
     }
 
-    void WebRtcSinkBintr::OnLocalDescSet(GstPromise* pPromise)
+    void WebRtcSignalingPeer::OnLocalDescSet(GstPromise* pPromise)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_transceiverMutex);
 
-        LOG_INFO("on-local-desc-set called for WebRtcSinkBintr '" 
-            << GetName() << "'");
+        LOG_INFO("on-local-desc-set called for WebRTC Peer '" 
+            << m_peerName << "'");
 
         GstStructure const *pReply = gst_promise_get_reply(pPromise);
         if (pReply != NULL)
         {
             gchar* replyStr = gst_structure_to_string(pReply);
             LOG_INFO("Reply for on-local-desc-set is '" << replyStr
-                << "' for WebRtcSinkBintr '" << GetName());
+                << "' for WebRTC Peer '" << m_peerName);
             g_free(replyStr);
         }
         gst_promise_unref(pPromise);  
     }
 
-    void WebRtcSinkBintr::OnRemoteDescSet(GstPromise* pPromise)
+    void WebRtcSignalingPeer::OnRemoteDescSet(GstPromise* pPromise)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_transceiverMutex);
 
-        LOG_INFO("on-remote-desc-set called for WebRtcSinkBintr '");
+        LOG_INFO("on-remote-desc-set called for WebRTC Peer '");
 
         GstStructure const *pReply = gst_promise_get_reply(pPromise);
         if (pReply != NULL)
         {
             gchar* replyStr = gst_structure_to_string(pReply);
             LOG_INFO("Reply for on-remote-desc-set is '" << replyStr
-                << "' for WebRtcSinkBintr '" << GetName());
+                << "' for WebRTC Peer '" << m_peerName);
             g_free(replyStr);
         }
         gst_promise_unref(pPromise);  
     }
 
-    void WebRtcSinkBintr::ConnectDataChannelSignals(GObject* dataChannel)
+    void WebRtcSignalingPeer::ConnectDataChannelSignals(GObject* dataChannel)
     {
         LOG_FUNC();
 
-        LOG_INFO("Connecting data channel signals for WebRtcSinkBintr '" 
-            << GetName() << "'");
+        LOG_INFO("Connecting data channel signals for WebRTC Peer '" 
+            << m_peerName << "'");
 
         // Setup the RTP data channel signal handlers
         m_dataChannelOnErrorSignalHandlerId = g_signal_connect(dataChannel, "on-error", 
@@ -743,16 +771,16 @@ namespace DSL
             G_CALLBACK(data_channel_on_message_string_cb), this);
     }
 
-    void WebRtcSinkBintr::DataChannelOnOpen(GObject* pDataChannel)
+    void WebRtcSignalingPeer::DataChannelOnOpen(GObject* pDataChannel)
     {
         LOG_FUNC();
 
-        LOG_INFO("data-channel-on-open called for WebRtcSinkBintr '" << GetName() << "'");
+        LOG_INFO("data-channel-on-open called for WebRTC Peer '" << m_peerName << "'");
 
         GstWebRTCDataChannel* pQualifedDataChannel = (GstWebRTCDataChannel*)pDataChannel;
 
         std::string confirmation("Data channel for WebRTC Sink '" 
-            + GetName() + "' opened successfully");
+            + m_peerName + "' opened successfully");
 
         GBytes *bytes = g_bytes_new("data", strlen("data"));
         g_signal_emit_by_name(pQualifedDataChannel, "send-string", confirmation.c_str());
@@ -760,11 +788,11 @@ namespace DSL
         g_bytes_unref(bytes);
     }
 
-    void WebRtcSinkBintr::DataChannelOnClose(GObject* pDataChannel)
+    void WebRtcSignalingPeer::DataChannelOnClose(GObject* pDataChannel)
     {
         LOG_FUNC();
 
-        LOG_INFO("data-channel-on-close called for WebRtcSinkBintr '" << GetName() << "'");
+        LOG_INFO("data-channel-on-close called for WebRTC Peer '" << m_peerName << "'");
 
         if (m_dataChannelOnErrorSignalHandlerId)
         {
@@ -819,7 +847,7 @@ namespace DSL
         }
     }
 
-    gchar* WebRtcSinkBintr::getStrFromJsonObj(JsonObject * object)
+    gchar* WebRtcSignalingPeer::getStrFromJsonObj(JsonObject * object)
     {
         LOG_FUNC();
 
@@ -835,90 +863,590 @@ namespace DSL
         return text;
     }
 
+    // -------------------------------------------------------------------------------
+
+    WebRtcPeerBintr::WebRtcPeerBintr(const char* name, 
+        WebRtcFanoutSinkBintr* pFanoutSink, const std::string& stunServer, 
+        const std::string& turnServer, uint maxQueueSize)
+        : Bintr(name)
+        , WebRtcSignalingPeer(name)
+        , m_pFanoutSink(pFanoutSink)
+        , m_isCongested(false)
+        , m_droppedBuffers(0)
+        , m_keyFrameRequests(0)
+    {
+        LOG_FUNC();
+
+        m_pQueue = DSL_ELEMENT_NEW("queue", name);
+
+        // Leak the oldest buffers when full so that a slow peer never
+        // back-pressures the Tee, and with it the encoder and all other peers.
+        m_pQueue->SetAttribute("leaky", 2);
+        m_pQueue->SetAttribute("max-size-buffers", maxQueueSize);
+        m_pQueue->SetAttribute("max-size-bytes", (uint)0);
+        m_pQueue->SetAttribute("max-size-time", (uint64_t)0);
+
+        g_signal_connect(m_pQueue->GetGObject(), "overrun",
+            G_CALLBACK(on_peer_queue_overrun_cb), (gpointer)this);
+        g_signal_connect(m_pQueue->GetGObject(), "underrun",
+            G_CALLBACK(on_peer_queue_underrun_cb), (gpointer)this);
+
+        createWebRtcBin(name, stunServer, turnServer);
+
+        AddChild(m_pQueue);
+        AddChild(m_pWebRtcBin);
+
+        m_pQueue->AddGhostPadToParent("sink");
+    }
+
+    WebRtcPeerBintr::~WebRtcPeerBintr()
+    {
+        LOG_FUNC();
+
+        if (m_pConnection)
+        {
+            // Clear the connection first so the closed signal is not handled
+            SoupWebsocketConnection* pConnection = m_pConnection;
+            ClearConnection();
+            soup_websocket_connection_close(pConnection, 
+                SOUP_WEBSOCKET_CLOSE_GOING_AWAY, NULL);
+            g_object_unref(G_OBJECT(pConnection));
+        }
+        if (IsLinked())
+        {    
+            UnlinkAll();
+        }
+    }
+
+    bool WebRtcPeerBintr::LinkAll()
+    {
+        LOG_FUNC();
+        
+        if (m_isLinked)
+        {
+            LOG_ERROR("WebRtcPeerBintr '" << GetName() << "' is already linked");
+            return false;
+        }
+        if (!m_pQueue->LinkToSink(m_pWebRtcBin))
+        {
+            return false;
+        }
+        m_isLinked = true;
+        return true;
+    }
+    
+    void WebRtcPeerBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+        
+        if (!m_isLinked)
+        {
+            LOG_ERROR("WebRtcPeerBintr '" << GetName() << "' is not linked");
+            return;
+        }
+        m_pQueue->UnlinkFromSink();
+        m_isLinked = false;
+    }
+
+    void WebRtcPeerBintr::OnClosed(SoupWebsocketConnection* pConnection)
+    {
+        LOG_FUNC();
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_transceiverMutex);
+
+            LOG_INFO("on-close called for WebRtcPeerBintr '" << GetName() <<"'");
+
+            m_pDataChannel = NULL;
+
+            // Call the base/super class to clear the connection and then
+            // release the reference added on SetConnection
+            SignalingTransceiver::OnClosed(pConnection);
+            g_object_unref(G_OBJECT(pConnection));
+        }
+        // The peer can't be removed from within its own signal handler.
+        m_pFanoutSink->QueuePeerRemoval();
+    }
+
+    void WebRtcPeerBintr::OnRemoteDescSet(GstPromise* pPromise)
+    {
+        LOG_FUNC();
+
+        WebRtcSignalingPeer::OnRemoteDescSet(pPromise);
+
+        // The peer has joined mid-stream. Request a new key frame so its 
+        // decoder doesn't have to wait for the next scheduled key frame.
+        RequestKeyFrame();
+    }
+
+    void WebRtcPeerBintr::RequestKeyFrame()
+    {
+        LOG_FUNC();
+
+        GstPad* pStaticSinkPad = gst_element_get_static_pad(
+            m_pQueue->GetGstElement(), "sink");
+
+        // Request all headers so the parameter sets are sent with the key frame.
+        GstEvent* pEvent = gst_video_event_new_upstream_force_key_unit(
+            GST_CLOCK_TIME_NONE, TRUE, (guint)m_keyFrameRequests);
+
+        if (!gst_pad_push_event(pStaticSinkPad, pEvent))
+        {
+            LOG_WARN("WebRtcPeerBintr '" << GetName() 
+                << "' failed to send force-key-unit event upstream");
+        }
+        gst_object_unref(pStaticSinkPad);
+
+        m_keyFrameRequests++;
+    }
+
+    void WebRtcPeerBintr::HandleQueueOverrun()
+    {
+        // No function log - avoid overhead.
+
+        m_droppedBuffers++;
+        if (!m_isCongested.exchange(true))
+        {
+            LOG_WARN("WebRtcPeerBintr '" << GetName() 
+                << "' is congested and dropping buffers");
+        }
+    }
+
+    void WebRtcPeerBintr::HandleQueueUnderrun()
+    {
+        // No function log - avoid overhead.
+
+        if (m_isCongested.exchange(false))
+        {
+            LOG_INFO("WebRtcPeerBintr '" << GetName() 
+                << "' has recovered from congestion");
+
+            // Buffers were dropped, the peer needs a new key frame to recover.
+            RequestKeyFrame();
+        }
+    }
+
+    void WebRtcPeerBintr::GetStats(uint64_t* droppedBuffers, 
+        uint64_t* keyFrameRequests)
+    {
+        LOG_FUNC();
+
+        *droppedBuffers = m_droppedBuffers;
+        *keyFrameRequests = m_keyFrameRequests;
+    }
+
+    // -------------------------------------------------------------------------------
+
+    WebRtcFanoutSinkBintr::WebRtcFanoutSinkBintr(const char* name, 
+        const char* stunServer, const char* turnServer, uint codec, 
+        uint bitrate, uint interval, uint maxPeers)
+        : EncodeSinkBintr(name, codec, bitrate, interval)
+        , SignalingTransceiver()
+        , m_stunServer(stunServer)
+        , m_turnServer(turnServer)
+        , m_maxPeers(maxPeers)
+        , m_peerCount(0)
+        , m_removeClosedPeersTimerId(0)
+        , m_removedPeerDroppedBuffers(0)
+        , m_removedPeerKeyFrameRequests(0)
+    {
+        LOG_FUNC();
+
+        std::string encodingName;
+        switch (codec)
+        {
+        case DSL_CODEC_H264 :
+            m_pPayloader = DSL_ELEMENT_NEW("rtph264pay", name);
+            encodingName = "H264";
+            break;
+        case DSL_CODEC_H265 :
+            m_pPayloader = DSL_ELEMENT_NEW("rtph265pay", name);
+            encodingName = "H265";
+            break;
+        default:
+            LOG_ERROR("Invalid codec = '" << codec 
+                << "' for new WebRtcFanoutSinkBintr '" << name << "'");
+            throw;
+        }
+        // Send the parameter sets with every key frame so that peers 
+        // joining mid-stream can start decoding on their first key frame.
+        m_pPayloader->SetAttribute("config-interval", -1);
+
+        m_pWebRtcCapsFilter = DSL_ELEMENT_NEW("capsfilter", name);
+
+        std::string capsString("application/x-rtp,media=video,encoding-name=" 
+            + encodingName + ",payload=96");
+        GstCaps* pCaps = gst_caps_from_string(capsString.c_str());
+        m_pWebRtcCapsFilter->SetAttribute("caps", pCaps);
+        gst_caps_unref(pCaps);
+
+        m_pTee = DSL_ELEMENT_NEW("tee", name);
+        m_pTee->SetAttribute("allow-not-linked", true);
+
+        m_pFakeSink = DSL_ELEMENT_NEW("fakesink", name);
+        m_pFakeSink->SetAttribute("async", false);
+        m_pFakeSink->SetAttribute("sync", m_sync);
+
+        AddChild(m_pPayloader);
+        AddChild(m_pWebRtcCapsFilter);
+        AddChild(m_pTee);
+        AddChild(m_pFakeSink);
+
+        SoupServerMgr::GetMgr()->AddSignalingTransceiver(this);
+    }
+
+    WebRtcFanoutSinkBintr::~WebRtcFanoutSinkBintr()
+    {
+        LOG_FUNC();
+    
+        SoupServerMgr::GetMgr()->RemoveSignalingTransceiver(this);
+
+        if (m_removeClosedPeersTimerId)
+        {
+            g_source_remove(m_removeClosedPeersTimerId);
+        }
+        if (IsLinked())
+        {    
+            UnlinkAll();
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_transceiverMutex);
+
+        // Peers close their own connections on destruction
+        for (auto const& imap: m_peers)
+        {
+            RemoveChild(imap.second);
+        }
+        m_peers.clear();
+    }
+
+    bool WebRtcFanoutSinkBintr::LinkAll()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_transceiverMutex);
+        
+        if (m_isLinked)
+        {
+            LOG_ERROR("WebRtcFanoutSinkBintr '" << GetName() 
+                << "' is already linked");
+            return false;
+        }
+        if (!m_pQueue->LinkToSink(m_pTransform) or
+            !m_pTransform->LinkToSink(m_pCapsFilter) or
+            !m_pCapsFilter->LinkToSink(m_pEncoder) or
+            !m_pEncoder->LinkToSink(m_pParser) or
+            !m_pParser->LinkToSink(m_pPayloader) or
+            !m_pPayloader->LinkToSink(m_pWebRtcCapsFilter) or
+            !m_pWebRtcCapsFilter->LinkToSink(m_pTee) or
+            !m_pFakeSink->LinkToSourceTee(m_pTee, "src_%u"))
+        {
+            return false;
+        }
+        for (auto const& imap: m_peers)
+        {
+            if (!imap.second->LinkAll() or 
+                !imap.second->LinkToSourceTee(m_pTee, "src_%u"))
+            {
+                LOG_ERROR("WebRtcFanoutSinkBintr '" << GetName() 
+                    << "' failed to link peer '" << imap.first << "'");
+                return false;
+            }
+        }
+        m_isLinked = true;
+        return true;
+    }
+    
+    void WebRtcFanoutSinkBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_transceiverMutex);
+        
+        if (!m_isLinked)
+        {
+            LOG_ERROR("WebRtcFanoutSinkBintr '" << GetName() << "' is not linked");
+            return;
+        }
+        for (auto const& imap: m_peers)
+        {
+            unlinkPeer(imap.second);
+        }
+        m_pFakeSink->UnlinkFromSourceTee();
+        m_pWebRtcCapsFilter->UnlinkFromSink();
+        m_pPayloader->UnlinkFromSink();
+        m_pParser->UnlinkFromSink();
+        m_pEncoder->UnlinkFromSink();
+        m_pCapsFilter->UnlinkFromSink();
+        m_pTransform->UnlinkFromSink();
+        m_pQueue->UnlinkFromSink();
+
+        m_isLinked = false;
+    }
+
+    bool WebRtcFanoutSinkBintr::SetSyncEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            LOG_ERROR("Unable to set Sync enabled setting for WebRtcFanoutSinkBintr '" 
+                << GetName() << "' as it's currently linked");
+            return false;
+        }
+        m_sync = enabled;
+        m_pFakeSink->SetAttribute("sync", m_sync);
+        
+        return true;
+    }
+
+    bool WebRtcFanoutSinkBintr::IsConnected()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_transceiverMutex);
+
+        uint connectedPeers(0);
+        for (auto const& imap: m_peers)
+        {
+            if (imap.second->IsConnected())
+            {
+                connectedPeers++;
+            }
+        }
+        return (connectedPeers >= m_maxPeers);
+    }
+
+    void WebRtcFanoutSinkBintr::SetConnection(SoupWebsocketConnection* pConnection)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_transceiverMutex);
+
+        std::string peerName = GetName() + "-peer-" + std::to_string(m_peerCount++);
+
+        DSL_WEBRTC_PEER_PTR pPeer = DSL_WEBRTC_PEER_NEW(peerName.c_str(), this,
+            m_stunServer, m_turnServer, DSL_WEBRTC_PEER_DEFAULT_MAX_QUEUE_SIZE);
+
+        // The connection is only handed to the peer once it has been added and
+        // linked. Until then the connection has no handler and must be closed
+        // here on failure.
+        if (!AddChild(pPeer))
+        {
+            LOG_ERROR("WebRtcFanoutSinkBintr '" << GetName() 
+                << "' failed to add new peer '" << peerName << "'");
+            soup_websocket_connection_close(pConnection, 
+                SOUP_WEBSOCKET_CLOSE_SERVER_ERROR, NULL);
+            return;
+        }
+        m_peers[peerName] = pPeer;
+
+        // If not linked, the peer will be linked to the Tee on next LinkAll
+        if (m_isLinked)
+        {
+            if (!pPeer->LinkAll() or 
+                !pPeer->LinkToSourceTee(m_pTee, "src_%u"))
+            {
+                LOG_ERROR("WebRtcFanoutSinkBintr '" << GetName() 
+                    << "' failed to link new peer '" << peerName << "'");
+
+                unlinkPeer(pPeer);
+                m_peers.erase(peerName);
+                RemoveChild(pPeer);
+                soup_websocket_connection_close(pConnection, 
+                    SOUP_WEBSOCKET_CLOSE_SERVER_ERROR, NULL);
+                return;
+            }
+        }
+
+        // The new peer handles all signaling for the connection from here on.
+        // The connection must be set before the peer's state changes so the
+        // offer created on negotiation can be sent.
+        pPeer->SetConnection(pConnection);
+
+        if (m_isLinked)
+        {
+            GstState parentState;
+            pPeer->SyncStateWithParent(parentState, 
+                DSL_DEFAULT_STATE_CHANGE_TIMEOUT_IN_SEC * GST_SECOND);
+        }
+        LOG_INFO("WebRtcFanoutSinkBintr '" << GetName() 
+            << "' added new peer '" << peerName << "' successfully");
+    }
+
+    void WebRtcFanoutSinkBintr::QueuePeerRemoval()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_transceiverMutex);
+
+        if (!m_removeClosedPeersTimerId)
+        {
+            m_removeClosedPeersTimerId = g_timeout_add(1, 
+                remove_closed_peers_cb, this);
+        }
+    }
+
+    int WebRtcFanoutSinkBintr::RemoveClosedPeers()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_transceiverMutex);
+
+        for (auto imap = m_peers.begin(); imap != m_peers.end();)
+        {
+            if (imap->second->IsConnected())
+            {
+                imap++;
+                continue;
+            }
+            if (imap->second->IsLinked())
+            {
+                unlinkPeer(imap->second);
+            }
+            imap->second->SetState(GST_STATE_NULL, 
+                DSL_DEFAULT_STATE_CHANGE_TIMEOUT_IN_SEC * GST_SECOND);
+
+            uint64_t droppedBuffers(0), keyFrameRequests(0);
+            imap->second->GetStats(&droppedBuffers, &keyFrameRequests);
+            m_removedPeerDroppedBuffers += droppedBuffers;
+            m_removedPeerKeyFrameRequests += keyFrameRequests;
+
+            RemoveChild(imap->second);
+
+            LOG_INFO("WebRtcFanoutSinkBintr '" << GetName() 
+                << "' removed closed peer '" << imap->first << "'");
+
+            imap = m_peers.erase(imap);
+        }
+        m_removeClosedPeersTimerId = 0;
+
+        // return false to destroy/unref the timer.
+        return false;
+    }
+
+    void WebRtcFanoutSinkBintr::GetStats(uint* peers, 
+        uint64_t* droppedBuffers, uint64_t* keyFrameRequests)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_transceiverMutex);
+
+        *peers = 0;
+        *droppedBuffers = m_removedPeerDroppedBuffers;
+        *keyFrameRequests = m_removedPeerKeyFrameRequests;
+
+        for (auto const& imap: m_peers)
+        {
+            uint64_t peerDroppedBuffers(0), peerKeyFrameRequests(0);
+            imap.second->GetStats(&peerDroppedBuffers, &peerKeyFrameRequests);
+
+            *droppedBuffers += peerDroppedBuffers;
+            *keyFrameRequests += peerKeyFrameRequests;
+            if (imap.second->IsConnected())
+            {
+                (*peers)++;
+            }
+        }
+    }
+
+    uint WebRtcFanoutSinkBintr::GetMaxPeers()
+    {
+        LOG_FUNC();
+
+        return m_maxPeers;
+    }
+
+    void WebRtcFanoutSinkBintr::unlinkPeer(DSL_WEBRTC_PEER_PTR pPeer)
+    {
+        LOG_FUNC();
+
+        // A peer may be only partially linked if linking failed.
+        if (pPeer->IsLinkedToSource())
+        {
+            pPeer->UnlinkFromSourceTee();
+        }
+        if (pPeer->IsLinked())
+        {
+            pPeer->UnlinkAll();
+        }
+    }
+
     // -------------------------------------------------------------------------------
     // Signal Callback Functions
 
     static void on_pad_added_cb(GstElement* pWebrtcbin, GstPad* pad, gpointer pWebRtcSink)
     {
-        LOG_INFO("on-pad-added called for WebRtcSinkBintr '"
-            << static_cast<WebRtcSinkBintr*>(pWebRtcSink)->GetName() << "'");
+        LOG_INFO("on-pad-added called for WebRTC Peer '"
+            << static_cast<WebRtcSignalingPeer*>(pWebRtcSink)->GetPeerName() << "'");
     }
 
     static void on_pad_removed_cb(GstElement* pWebrtcbin, GstPad* pad, gpointer pWebRtcSink)
     {
-        LOG_INFO("on-pad-removed called for WebRtcSinkBintr '" 
-            << static_cast<WebRtcSinkBintr*>(pWebRtcSink)->GetName() << "'");
+        LOG_INFO("on-pad-removed called for WebRTC Peer '" 
+            << static_cast<WebRtcSignalingPeer*>(pWebRtcSink)->GetPeerName() << "'");
     }
  
     static void on_no_more_pads_cb(GstElement* pWebrtcbin, gpointer pWebRtcSink)
     {
-        LOG_WARN("on-no-more-pads called for WebRtcSinkBintr '" 
-            << static_cast<WebRtcSinkBintr*>(pWebRtcSink)->GetName() << "'");
+        LOG_WARN("on-no-more-pads called for WebRTC Peer '" 
+            << static_cast<WebRtcSignalingPeer*>(pWebRtcSink)->GetPeerName() << "'");
     }
 
     static void on_new_transceiver_cb(G_GNUC_UNUSED GstElement* pWebrtcbin, 
         GstWebRTCRTPTransceiver* pTransceiver, gpointer pWebRtcSink)
     {
-        LOG_INFO("on-new-transceiver called for WebRtcSinkBintr '" 
-            << static_cast<WebRtcSinkBintr*>(pWebRtcSink)->GetName() << "'");
+        LOG_INFO("on-new-transceiver called for WebRTC Peer '" 
+            << static_cast<WebRtcSignalingPeer*>(pWebRtcSink)->GetPeerName() << "'");
     }
 
     static void on_negotiation_needed_cb(GstElement* pWebrtcbin, gpointer pWebRtcSink)
     {
-        static_cast<WebRtcSinkBintr*>(pWebRtcSink)->OnNegotiationNeeded();
+        static_cast<WebRtcSignalingPeer*>(pWebRtcSink)->OnNegotiationNeeded();
     }
 
     static void on_offer_created_cb(GstPromise* pPromise, gpointer pWebRtcSink)
     {
-        static_cast<WebRtcSinkBintr*>(pWebRtcSink)->OnOfferCreated(pPromise);
+        static_cast<WebRtcSignalingPeer*>(pWebRtcSink)->OnOfferCreated(pPromise);
     }
 
     static void on_local_desc_set_cb(GstPromise* pPromise, gpointer pWebRtcSink)
     {
-        static_cast<WebRtcSinkBintr*>(pWebRtcSink)->OnLocalDescSet(pPromise);
+        static_cast<WebRtcSignalingPeer*>(pWebRtcSink)->OnLocalDescSet(pPromise);
     }
 
     static void on_remote_desc_set_cb(GstPromise* pPromise, gpointer pWebRtcSink)
     {
-        static_cast<WebRtcSinkBintr*>(pWebRtcSink)->OnRemoteDescSet(pPromise);
+        static_cast<WebRtcSignalingPeer*>(pWebRtcSink)->OnRemoteDescSet(pPromise);
     }
 
     static void on_ice_candidate_cb(G_GNUC_UNUSED GstElement* pWebrtcbin, 
         guint mlineIndex, gchar * candidateStr, gpointer pWebRtcSink)
     {
-        static_cast<WebRtcSinkBintr*>(pWebRtcSink)->
+        static_cast<WebRtcSignalingPeer*>(pWebRtcSink)->
             OnIceCandidate(mlineIndex, candidateStr);
     }
 
     static void on_data_channel_cb(G_GNUC_UNUSED GstElement* pWebrtcbin, 
         GObject* pDataChannel, gpointer pWebRtcSink)
     {
-        static_cast<WebRtcSinkBintr*>(pWebRtcSink)->ConnectDataChannelSignals(pDataChannel);
+        static_cast<WebRtcSignalingPeer*>(pWebRtcSink)->ConnectDataChannelSignals(pDataChannel);
     }
 
     static void data_channel_on_error_cb(GObject* pDataChannel, gpointer pWebRtcSink)
     {
-        LOG_ERROR("on-data-channel-errror called for WebRtcSinkBintr '" 
-            << static_cast<WebRtcSinkBintr*>(pWebRtcSink)->GetName() << "'");
+        LOG_ERROR("on-data-channel-errror called for WebRTC Peer '" 
+            << static_cast<WebRtcSignalingPeer*>(pWebRtcSink)->GetPeerName() << "'");
 
         // TODO: define and implement proper behavior
     }
 
     static void data_channel_on_open_cb(GObject* pDataChannel, gpointer pWebRtcSink)
     {
-        static_cast<WebRtcSinkBintr*>(pWebRtcSink)->DataChannelOnOpen(pDataChannel);
+        static_cast<WebRtcSignalingPeer*>(pWebRtcSink)->DataChannelOnOpen(pDataChannel);
     }
 
     static void data_channel_on_close_cb(GObject* pDataChannel, gpointer pWebRtcSink)
     {
-        static_cast<WebRtcSinkBintr*>(pWebRtcSink)->DataChannelOnClose(pDataChannel);
+        static_cast<WebRtcSignalingPeer*>(pWebRtcSink)->DataChannelOnClose(pDataChannel);
     }
 
     static void data_channel_on_message_string_cb(GObject* pDataChannel, 
         gchar* messageStr, gpointer pWebRtcSink)
     {
-        LOG_INFO("data-channel-on-message-string called for WebRtcSinkBintr '" 
-            << static_cast<WebRtcSinkBintr*>(pWebRtcSink)->GetName() << "'");
+        LOG_INFO("data-channel-on-message-string called for WebRTC Peer '" 
+            << static_cast<WebRtcSignalingPeer*>(pWebRtcSink)->GetPeerName() << "'");
         LOG_INFO("recieved message '" << messageStr << "'");
     }
 
@@ -927,4 +1455,20 @@ namespace DSL
         return static_cast<WebRtcSinkBintr*>(pWebRtcSink)->CompleteOnClosed();
     }
 
+    static void on_peer_queue_overrun_cb(GstElement* pQueue, gpointer pWebRtcPeer)
+    {
+        static_cast<WebRtcPeerBintr*>(pWebRtcPeer)->HandleQueueOverrun();
+    }
+
+    static void on_peer_queue_underrun_cb(GstElement* pQueue, gpointer pWebRtcPeer)
+    {
+        static_cast<WebRtcPeerBintr*>(pWebRtcPeer)->HandleQueueUnderrun();
+    }
+
+    static int remove_closed_peers_cb(gpointer pWebRtcFanoutSink)
+    {
+        return static_cast<WebRtcFanoutSinkBintr*>(pWebRtcFanoutSink)->
+            RemoveClosedPeers();
+    }
+
 } // DSL
\ No newline at end of file
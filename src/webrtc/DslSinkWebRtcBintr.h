@@ -27,6 +27,7 @@ THE SOFTWARE.
 
 #include "Dsl.h"
 #include <gst/sdp/sdp.h>
+#include <gst/video/video.h>
 #include <libsoup/soup.h>
 #include <json-glib/json-glib.h>
 
@@ -45,12 +46,179 @@ namespace DSL
         std::shared_ptr<WebRtcSinkBintr>(new WebRtcSinkBintr(name, \
             stunServer, turnServer, codec, bitrate, interval))
 
+    /**
+     * @brief maximum number of RTP buffers queued for each peer of a
+     * WebRtcFanoutSinkBintr before the oldest buffers are dropped.
+     */
+    #define DSL_WEBRTC_PEER_DEFAULT_MAX_QUEUE_SIZE 200
+
+    #define DSL_WEBRTC_PEER_PTR std::shared_ptr<WebRtcPeerBintr>
+    #define DSL_WEBRTC_PEER_NEW(name, pFanoutSink, stunServer, turnServer, \
+        maxQueueSize) \
+        std::shared_ptr<WebRtcPeerBintr>(new WebRtcPeerBintr(name, \
+            pFanoutSink, stunServer, turnServer, maxQueueSize))
+
+    #define DSL_WEBRTC_FANOUT_SINK_PTR std::shared_ptr<WebRtcFanoutSinkBintr>
+    #define DSL_WEBRTC_FANOUT_SINK_NEW(name, stunServer, turnServer, \
+        codec, bitrate, interval, maxPeers) \
+        std::shared_ptr<WebRtcFanoutSinkBintr>(new WebRtcFanoutSinkBintr(name, \
+            stunServer, turnServer, codec, bitrate, interval, maxPeers))
+
+    class WebRtcFanoutSinkBintr;
+
+    /**
+     * @class WebRtcSignalingPeer
+     * @file DslWebRtcSinkBintr.h
+     * @brief Implements the SDP/ICE signaling and data channel handling
+     * for a single webrtcbin and its Websocket connection. Used by both the
+     * single client WebRtcSinkBintr and the per-client WebRtcPeerBintr.
+     */
+    class WebRtcSignalingPeer : public SignalingTransceiver
+    {
+    public:
+
+        /**
+         * @brief Ctor for the WebRtcSignalingPeer class
+         * @param[in] name name of the owning Bintr, used for logging.
+         */
+        WebRtcSignalingPeer(const char* name);
+
+        /**
+         * @brief Dtor for the WebRtcSignalingPeer class
+         */
+        ~WebRtcSignalingPeer();
+
+        /**
+         * @brief Gets the name of the Bintr that owns this WebRtcSignalingPeer.
+         * @return name of the owning Bintr.
+         */
+        const std::string& GetPeerName();
+
+        /**
+         * @brief Handles an incoming Websocket message
+         * @param[in] pConnection pointer to the Websocket connection object.
+         * @param[in] dataType type of the message received.
+         * @param[in] message incoming message to handle.
+         */
+        void OnMessage(SoupWebsocketConnection* pConnection, 
+            SoupWebsocketDataType dataType, GBytes* message);
+
+        /**
+         * @brief Handles the on-negotiation-needed by emitting a create-offer signal
+         */
+        void OnNegotiationNeeded();
+
+        /**
+         * @brief Handles the on-offer-created callback by emitting a "set-local-description"
+         * signal and replying to he remote client
+         * @param[in] promise 
+         */
+        void OnOfferCreated(GstPromise* pPromise);
+
+        /**
+         * @brief Handles the on-ice-candidate callback by
+         * @param[in] mLineIndex 
+         * @param[in] candidate
+         */
+        void OnIceCandidate(guint mLineIndex, gchar* candidate);
+
+        /**
+         * @brief Handles the on-local-desc-set callback by logging the reply
+         * as INFO
+         * @param[in] promise the promise from the initial offer.
+         */
+        void OnLocalDescSet(GstPromise* pPromise);
+
+        /**
+         * @brief Handles the on-remote-desc-set callback by logging the reply
+         * as INFO
+         * @param[in] pPromise the promise from the initial offer.
+         */
+        virtual void OnRemoteDescSet(GstPromise* pPromise);
+
+        /**
+         * @brief Common function to connect the Data Channel Signals
+         * of channel setup
+         */
+        void ConnectDataChannelSignals(GObject* pDataChannel);
+
+        /**
+         * @brief Handles the data-channel-on-open signal by emitting a
+         * signals to inform the remote client that the channel is ready. 
+         */
+        void DataChannelOnOpen(GObject* pDataChannel);
+
+        /**
+         * @brief Handles the data-channel-on-close signal by disconnecting
+         * all data channel signal handlers. 
+         */
+        void DataChannelOnClose(GObject* pDataChannel);
+
+    protected:
+
+        /**
+         * @brief Creates a new webrtcbin for this WebRtcSignalingPeer with
+         * the given STUN and TURN servers and connects all signal handlers.
+         * @param[in] elementName name for the new webrtcbin element.
+         * @param[in] stunServer STUN server to use, empty string if none.
+         * @param[in] turnServer TURN server to use, empty string if none.
+         */
+        void createWebRtcBin(const char* elementName, 
+            const std::string& stunServer, const std::string& turnServer);
+
+        /**
+         * @brief Helper function to convert a json object to string
+         * @return json string.
+         */
+        gchar* getStrFromJsonObj(JsonObject * object);
+
+        /**
+         * @brief name of the Bintr that owns this WebRtcSignalingPeer.
+         */
+        std::string m_peerName;
+
+        /**
+         * @brief webrtcbin element for this WebRtcSignalingPeer.
+         */
+        DSL_ELEMENT_PTR m_pWebRtcBin;
+
+        /** 
+         * @brief WebRTC data channel for this WebRtcSignalingPeer, 
+         * NULL until channel has been setup.
+         */
+        GstWebRTCDataChannel* m_pDataChannel;
+
+        /** 
+         * @brief Handler Id for the RTP data chanel on-error signal handler,
+         * 0 when not set
+         */
+        gulong m_dataChannelOnErrorSignalHandlerId;
+
+        /** 
+         * @brief Handler Id for the RTP data chanel on-open signal handler,
+         * 0 when not set
+         */
+        gulong m_dataChannelOnOpenSignalHandlerId;
+
+        /** 
+         * @brief Handler Id for the RTP data chanel on-close signal handler,
+         * 0 when not set
+         */
+        gulong m_dataChannelOnCloseSignalHandlerId;
+
+        /** 
+         * @brief Handler Id for the RTP data chanel on-message signal handler,
+         * 0 when not set
+         */
+        gulong m_dataChannelOnMessageSignalHandlerId;
+    };
+
     /**
      * @class WebRtcSinkBintr 
      * @file DslWebRtcSinkBintr.h
      * @brief Implements a WebRTC Sink Bin Container Class (Bintr)
      */
-    class WebRtcSinkBintr : public EncodeSinkBintr, public SignalingTransceiver
+    class WebRtcSinkBintr : public EncodeSinkBintr, public WebRtcSignalingPeer
     {
     public: 
     
@@ -146,159 +314,323 @@ namespace DSL
 
         int CompleteOnClosed();
 
+    private:
+
         /**
-         * @brief Handles an incoming Websocket message
-         * @param[in] pConnection pointer to the Websocket connection object.
-         * @param[in] dataType type of the message received.
-         * @param[in] message incoming message to handle.
+         * @brief gnome timer Id for the RTSP reconnection manager
          */
-        void OnMessage(SoupWebsocketConnection* pConnection, 
-            SoupWebsocketDataType dataType, GBytes* message);
+        uint m_completeClosedTimerId;
 
         /**
-         * @brief Handles the on-negotiation-needed by emitting a create-offer signal
+         * @brief Private function to iterate through the map of client listners
+         * notifying each of the new/current state on change of state. 
          */
-        void OnNegotiationNeeded();
+        void notifyClientListeners();
 
         /**
-         * @brief Handles the on-offer-created callback by emitting a "set-local-description"
-         * signal and replying to he remote client
-         * @param[in] promise 
+         * @brief Client provided STUN server for this WebRtcSinkBintr 
+         * of the form stun://hostname:port
          */
-        void OnOfferCreated(GstPromise* pPromise);
+        std::string m_stunServer;
 
         /**
-         * @brief Handles the on-ice-candidate callback by
-         * @param[in] mLineIndex 
-         * @param[in] candidate
+         * @brief [optional] Client provided TURN server for this WebRtcSinkBintr 
+         * of the form turn(s)://username:password@host:port. 
          */
-        void OnIceCandidate(guint mLineIndex, gchar* candidate);
+        std::string m_turnServer;
 
         /**
-         * @brief Handles the on-local-desc-set callback by logging the reply
-         * as INFO
-         * @param[in] promise the promise from the initial offer.
+         * @brief shared pointer to parent BranchBintr or PipelineBintr. nullptr if none.
          */
-        void OnLocalDescSet(GstPromise* pPromise);
+        DSL_BASE_PTR m_pParentBintr;
 
         /**
-         * @brief Handles the on-remote-desc-set callback by logging the reply
-         * as INFO
+         * @brief FakeSinkBintr to add to the Pipline so that it can play prior
+         * to adding this WebRtcSinkBintr
+         */
+        DSL_FAKE_SINK_PTR m_pFakeSinkBintr;
+
+        /**
+         * @brief Payloader element for this WebRtcSinkBintr.
+         */
+        DSL_ELEMENT_PTR m_pPayloader;
+
+        /**
+         * @brief webrtcbin sink-pad caps element for this WebRtcSinkBintr.
+         */
+        DSL_ELEMENT_PTR m_pWebRtcCapsFilter;
+
+        /**
+         * @brief map of all currently registered client listeners
+         * callback functions mapped with the user provided data
+         */
+        std::map<dsl_sink_webrtc_client_listener_cb, void*> m_clientListeners;
+    };
+
+    /**
+     * @class WebRtcPeerBintr 
+     * @file DslWebRtcSinkBintr.h
+     * @brief Implements a single remote client (peer) of a WebRtcFanoutSinkBintr.
+     * Each peer owns a leaky queue and webrtcbin, linked to the encoded RTP 
+     * stream of its parent through a requested Tee Src Pad. The leaky queue 
+     * gives each peer its own congestion state so that a slow client drops 
+     * its own buffers rather than stalling the shared encoder and other peers.
+     */
+    class WebRtcPeerBintr : public Bintr, public WebRtcSignalingPeer
+    {
+    public: 
+    
+        /**
+         * @brief Ctor for the WebRtcPeerBintr class
+         * @param[in] name unique name for the new WebRtcPeerBintr
+         * @param[in] pFanoutSink parent WebRtcFanoutSinkBintr that owns this peer.
+         * @param[in] stunServer STUN server for the peer's webrtcbin
+         * @param[in] turnServer TURN server for the peer's webrtcbin
+         * @param[in] maxQueueSize maximum number of RTP buffers to queue
+         * for the peer before dropping the oldest.
+         */
+        WebRtcPeerBintr(const char* name, WebRtcFanoutSinkBintr* pFanoutSink,
+            const std::string& stunServer, const std::string& turnServer, 
+            uint maxQueueSize);
+
+        /**
+         * @brief Dtor for the WebRtcPeerBintr class
+         */
+        ~WebRtcPeerBintr();
+  
+        /**
+         * @brief Links all Child Elementrs owned by this WebRtcPeerBintr
+         * @return true if all links were succesful, false otherwise
+         */
+        bool LinkAll();
+        
+        /**
+         * @brief Unlinks all Child Elemntrs owned by this WebRtcPeerBintr
+         */
+        void UnlinkAll();
+
+        /**
+         * @brief Called when the peer's Websocket is closed. Clears the
+         * connection and schedules the peer for removal by its parent.
+         * @param[in] pConnection unique connection that closed 
+         */
+        void OnClosed(SoupWebsocketConnection* pConnection);
+
+        /**
+         * @brief Handles the on-remote-desc-set callback by requesting a
+         * new key frame from the shared encoder so the joining peer can
+         * start decoding immediately.
          * @param[in] pPromise the promise from the initial offer.
          */
         void OnRemoteDescSet(GstPromise* pPromise);
 
         /**
-         * @brief Common function to connect the Data Channel Signals
-         * of channel setup
+         * @brief Sends an upstream force-key-unit event to the shared encoder.
          */
-        void ConnectDataChannelSignals(GObject* pDataChannel);
+        void RequestKeyFrame();
 
         /**
-         * @brief Handles the data-channel-on-open signal by emitting a
-         * signals to inform the remote client that the channel is ready. 
+         * @brief Handles the peer queue's "overrun" signal by updating
+         * the peer's congestion state and dropped buffer count.
          */
-        void DataChannelOnOpen(GObject* pDataChannel);
+        void HandleQueueOverrun();
 
         /**
-         * @brief Handles the data-channel-on-close signal by disconnecting
-         * all data channel signal handlers. 
+         * @brief Handles the peer queue's "underrun" signal. A peer recovering
+         * from congestion has lost buffers, so a new key frame is requested.
          */
-        void DataChannelOnClose(GObject* pDataChannel);
+        void HandleQueueUnderrun();
+
+        /**
+         * @brief Gets the congestion statistics for this WebRtcPeerBintr.
+         * @param[out] droppedBuffers number of RTP buffers dropped by the 
+         * peer's queue since creation.
+         * @param[out] keyFrameRequests number of key frames requested 
+         * by this peer since creation.
+         */
+        void GetStats(uint64_t* droppedBuffers, uint64_t* keyFrameRequests);
 
     private:
 
-        /** 
-         * @brief WebRTC data channel for this WebRtcSinkBintr, 
-         * NULL until channel has been setup.
+        /**
+         * @brief parent WebRtcFanoutSinkBintr that owns this peer.
          */
-        GstWebRTCDataChannel* m_pDataChannel;
+        WebRtcFanoutSinkBintr* m_pFanoutSink;
 
         /**
-         * @brief gnome timer Id for the RTSP reconnection manager
+         * @brief leaky queue element for this WebRtcPeerBintr.
          */
-        uint m_completeClosedTimerId;
+        DSL_ELEMENT_PTR m_pQueue;
 
+        /**
+         * @brief true while the peer's queue is dropping buffers.
+         */
+        std::atomic<bool> m_isCongested;
 
         /**
-         * @brief Private function to iterate through the map of client listners
-         * notifying each of the new/current state on change of state. 
+         * @brief number of queue overruns (dropped buffers) since creation.
          */
-        void notifyClientListeners();
+        std::atomic<uint64_t> m_droppedBuffers;
 
         /**
-         * @brief Helper function to convert a json object to string
-         * @return json string.
+         * @brief number of key frames requested since creation.
          */
-        gchar* getStrFromJsonObj(JsonObject * object);
+        std::atomic<uint64_t> m_keyFrameRequests;
+    };
 
-        /** 
-         * @brief Handler Id for the RTP data chanel on-error signal handler,
-         * 0 when not set
+    /**
+     * @class WebRtcFanoutSinkBintr 
+     * @file DslWebRtcSinkBintr.h
+     * @brief Implements a WebRTC Sink that serves many remote clients from
+     * a single encoder. The encoded and payloaded stream is fanned-out 
+     * with a Tee to a pool of WebRtcPeerBintrs, one per Websocket 
+     * connection, that are created and removed as clients come and go.
+     */
+    class WebRtcFanoutSinkBintr : public EncodeSinkBintr, public SignalingTransceiver
+    {
+    public: 
+    
+        /**
+         * @brief Ctor for the WebRtcFanoutSinkBintr class
          */
-        gulong m_dataChannelOnErrorSignalHandlerId;
+        WebRtcFanoutSinkBintr(const char* name, const char* stunServer, 
+            const char* turnServer, uint codec, uint bitrate, uint interval,
+            uint maxPeers);
 
-        /** 
-         * @brief Handler Id for the RTP data chanel on-open signal handler,
-         * 0 when not set
+        /**
+         * @brief Dtor for the WebRtcFanoutSinkBintr class
          */
-        gulong m_dataChannelOnOpenSignalHandlerId;
+        ~WebRtcFanoutSinkBintr();
+  
+        /**
+         * @brief Links all Child Elementrs and Peers owned by this 
+         * WebRtcFanoutSinkBintr
+         * @return true if all links were succesful, false otherwise
+         */
+        bool LinkAll();
+        
+        /**
+         * @brief Unlinks all Child Elemntrs and Peers owned by this 
+         * WebRtcFanoutSinkBintr
+         */
+        void UnlinkAll();
 
-        /** 
-         * @brief Handler Id for the RTP data chanel on-close signal handler,
-         * 0 when not set
+        /**
+         * @brief sets the sync enabled setting for the SinkBintr
+         * @param[in] enabled current sync setting.
          */
-        gulong m_dataChannelOnCloseSignalHandlerId;
+        bool SetSyncEnabled(bool enabled);
 
-        /** 
-         * @brief Handler Id for the RTP data chanel on-message signal handler,
-         * 0 when not set
+        /**
+         * @brief The WebRtcFanoutSinkBintr is available for a new connection 
+         * until its maximum number of peers has been reached.
+         * @return true if the maximum number of peers are connected.
          */
-        gulong m_dataChannelOnMessageSignalHandlerId;
+        bool IsConnected();
 
         /**
-         * @brief Client provided STUN server for this WebRtcSinkBintr 
-         * of the form stun://hostname:port
+         * @brief Creates a new WebRtcPeerBintr for a new Websocket connection
+         * and links it to the encoded stream if currently linked.
+         * @param[in] pConnection pointer to the new Websocket Connection.
+         */
+        void SetConnection(SoupWebsocketConnection* pConnection);
+
+        /**
+         * @brief Called by a WebRtcPeerBintr when its Websocket is closed.
+         * Schedules the removal of all closed peers on the main-loop.
+         */
+        void QueuePeerRemoval();
+
+        /**
+         * @brief Unlinks and removes all WebRtcPeerBintrs with closed connections.
+         * @return false always to destroy/unref the timer.
+         */
+        int RemoveClosedPeers();
+
+        /**
+         * @brief Gets the current peer count and the aggregate congestion 
+         * statistics for all current and previous peers.
+         * @param[out] peers current number of connected peers.
+         * @param[out] droppedBuffers total RTP buffers dropped by peer queues.
+         * @param[out] keyFrameRequests total key frames requested by peers.
+         */
+        void GetStats(uint* peers, uint64_t* droppedBuffers, 
+            uint64_t* keyFrameRequests);
+
+        /**
+         * @brief Gets the maximum number of peers for this WebRtcFanoutSinkBintr.
+         * @return maximum number of concurrent peers.
+         */
+        uint GetMaxPeers();
+
+    private:
+
+        /**
+         * @brief unlinks a single WebRtcPeerBintr from the Tee.
+         * @param[in] pPeer peer to unlink
+         */
+        void unlinkPeer(DSL_WEBRTC_PEER_PTR pPeer);
+
+        /**
+         * @brief Client provided STUN server for all peers.
          */
         std::string m_stunServer;
 
         /**
-         * @brief [optional] Client provided TURN server for this WebRtcSinkBintr 
-         * of the form turn(s)://username:password@host:port. 
+         * @brief [optional] Client provided TURN server for all peers.
          */
         std::string m_turnServer;
 
         /**
-         * @brief shared pointer to parent BranchBintr or PipelineBintr. nullptr if none.
+         * @brief maximum number of concurrent peers.
          */
-        DSL_BASE_PTR m_pParentBintr;
+        uint m_maxPeers;
 
         /**
-         * @brief FakeSinkBintr to add to the Pipline so that it can play prior
-         * to adding this WebRtcSinkBintr
+         * @brief running count used to give each new peer a unique name.
          */
-        DSL_FAKE_SINK_PTR m_pFakeSinkBintr;
+        uint m_peerCount;
 
         /**
-         * @brief Payloader element for this WebRtcSinkBintr.
+         * @brief gnome timer Id for the closed peer removal, 0 when not set.
+         */
+        uint m_removeClosedPeersTimerId;
+
+        /**
+         * @brief dropped buffer count accumulated from removed peers.
+         */
+        uint64_t m_removedPeerDroppedBuffers;
+
+        /**
+         * @brief key frame request count accumulated from removed peers.
+         */
+        uint64_t m_removedPeerKeyFrameRequests;
+
+        /**
+         * @brief Payloader element for this WebRtcFanoutSinkBintr.
          */
         DSL_ELEMENT_PTR m_pPayloader;
 
         /**
-         * @brief webrtcbin sink-pad caps element for this WebRtcSinkBintr.
+         * @brief RTP caps element for this WebRtcFanoutSinkBintr.
          */
         DSL_ELEMENT_PTR m_pWebRtcCapsFilter;
 
         /**
-         * @brief webrtcbin element for this WebRtcSinkBintr.
+         * @brief Tee element to fan-out the RTP stream to all peers.
          */
-        DSL_ELEMENT_PTR m_pWebRtcBin;
+        DSL_ELEMENT_PTR m_pTee;
 
         /**
-         * @brief map of all currently registered client listeners
-         * callback functions mapped with the user provided data
+         * @brief Fake Sink element, always linked to the Tee, so that the 
+         * Pipeline can preroll and play with no connected peers.
          */
-        std::map<dsl_sink_webrtc_client_listener_cb, void*> m_clientListeners;
+        DSL_ELEMENT_PTR m_pFakeSink;
+
+        /**
+         * @brief map of all current peers mapped by their unique name.
+         */
+        std::map<std::string, DSL_WEBRTC_PEER_PTR> m_peers;
     };
 
     /**
@@ -329,7 +661,7 @@ namespace DSL
      * @brief Callback function called on new WebRTC RTP Transciever.
      * @param[in] pWebrtcbin pointer to the webrtcbin element connected to the Transciever.
      * @param[in] pTransceiver pointer to the new RTP Transciever.
-     * @param[in] pWebRtcSink pointer to the WebRtcSinkBintr that owns the webrtcbin.
+     * @param[in] pWebRtcSink pointer to the WebRtcSignalingPeer that owns the webrtcbin.
      */
     static void on_new_transceiver_cb(G_GNUC_UNUSED GstElement* pWebrtcbin, 
         GstWebRTCRTPTransceiver* pTransceiver, gpointer pWebRtcSink);
@@ -337,28 +669,28 @@ namespace DSL
     /**
      * @brief Callback function called on negotion needed.
      * @param[in] pWebrtcbin pointer to the webrtcbin element connected to the Transciever.
-     * @param[in] pWebRtcSink pointer to the WebRtcSinkBintr that owns the webrtcbin.
+     * @param[in] pWebRtcSink pointer to the WebRtcSignalingPeer that owns the webrtcbin.
      */
     static void on_negotiation_needed_cb(GstElement* pWebrtcbin, gpointer pWebRtcSink);
 
     /**
      * @brief Callback function called on offer created 
      * @param[in] pPromise pointer to the promise ??
-     * @param[in] pWebRtcSink pointer to the WebRtcSinkBintr that owns the webrtcbin.
+     * @param[in] pWebRtcSink pointer to the WebRtcSignalingPeer that owns the webrtcbin.
      */
     static void on_offer_created_cb(GstPromise* pPromise, gpointer pWebRtcSink);
 
     /**
      * @brief Callback function called on local description set
      * @param[in] pPromise pointer to the promise ??.
-     * @param[in] pWebRtcSink pointer to the WebRtcSinkBintr that owns the webrtcbin.
+     * @param[in] pWebRtcSink pointer to the WebRtcSignalingPeer that owns the webrtcbin.
      */
     static void on_local_desc_set_cb(GstPromise* pPromise, gpointer pWebRtcSink);
 
     /**
      * @brief Callback function called on remote description set
      * @param[in] pPromise pointer to the promise with the reply to the offer created??
-     * @param[in] pWebRtcSink pointer to the WebRtcSinkBintr that owns the webrtcbin.
+     * @param[in] pWebRtcSink pointer to the WebRtcSignalingPeer that owns the webrtcbin.
      */
     static void on_remote_desc_set_cb(GstPromise* pPromise, gpointer pWebRtcSink);
 
@@ -367,7 +699,7 @@ namespace DSL
      * @param[in] pWebrtcbin pointer to the webrtcbin element connected to the RTP Transciever.
      * @param[in] mlineIndex line index for the candidate string.
      * @param[in] candidateStr the ICE candidate info string.
-     * @param[in] pWebRtcSink pointer to the WebRtcSinkBintr that owns the webrtcbin.
+     * @param[in] pWebRtcSink pointer to the WebRtcSignalingPeer that owns the webrtcbin.
      */
     static void on_ice_candidate_cb(G_GNUC_UNUSED GstElement* pWebrtcbin, 
         guint mlineIndex, gchar * candidateStr, gpointer pWebRtcSink);
@@ -376,7 +708,7 @@ namespace DSL
      * @brief Callback function called on new data channel.
      * @param[in] pWebrtcbin pointer to the webrtcbin element connected to the data channel.
      * @param[in] pDataChannel pointer to the data channel created.
-     * @param[in] pWebRtcSink pointer to the WebRtcSinkBintr that owns the webrtcbin.
+     * @param[in] pWebRtcSink pointer to the WebRtcSignalingPeer that owns the webrtcbin.
      */
     static void on_data_channel_cb(G_GNUC_UNUSED GstElement* pWebrtcbin, 
         GObject* pDataChannel, gpointer pWebRtcSink);
@@ -384,21 +716,21 @@ namespace DSL
     /**
      * @brief Callback function called on data channel error.
      * @param[in] pDataChannel pointer to the data channel in error.
-     * @param[in] pWebRtcSink pointer to the WebRtcSinkBintr that owns the data channel.
+     * @param[in] pWebRtcSink pointer to the WebRtcSignalingPeer that owns the data channel.
      */
     static void data_channel_on_error_cb(GObject* pDataChannel, gpointer pWebRtcSink);
 
     /**
      * @brief Callback function called on data channel opened.
      * @param[in] pDataChannel pointer to the data channel that closed.
-     * @param[in] pWebRtcSink pointer to the WebRtcSinkBintr that owns the data channel.
+     * @param[in] pWebRtcSink pointer to the WebRtcSignalingPeer that owns the data channel.
      */
     static void data_channel_on_open_cb(GObject* pDataChannel, gpointer pWebRtcSink);
 
     /**
      * @brief Callback function called on data channel closed.
      * @param[in] pDataChannel pointer to the data channel that closed.
-     * @param[in] pWebRtcSink pointer to the WebRtcSinkBintr that owns the data channel.
+     * @param[in] pWebRtcSink pointer to the WebRtcSignalingPeer that owns the data channel.
      */
     static void data_channel_on_close_cb(GObject* pDataChannel, gpointer pWebRtcSink);
 
@@ -406,12 +738,32 @@ namespace DSL
      * @brief Callback function called on new incomming message string.
      * @param[in] pDataChannel pointer to the data channel the message was received on.
      * @param[in] messageStr the recieved message string.
-     * @param[in] pWebRtcSink pointer to the WebRtcSinkBintr that owns the data channel.
+     * @param[in] pWebRtcSink pointer to the WebRtcSignalingPeer that owns the data channel.
      */
     static void data_channel_on_message_string_cb(GObject* dataChannel, 
         gchar* messageStr, gpointer pWebRtcSink);
 
     static int complete_on_closed_cb(gpointer pWebRtcSink);
 
+    /**
+     * @brief Callback function called when a peer's queue is full.
+     * @param[in] pQueue pointer to the queue element.
+     * @param[in] pWebRtcPeer pointer to the WebRtcPeerBintr that owns the queue.
+     */
+    static void on_peer_queue_overrun_cb(GstElement* pQueue, gpointer pWebRtcPeer);
+
+    /**
+     * @brief Callback function called when a peer's queue is empty.
+     * @param[in] pQueue pointer to the queue element.
+     * @param[in] pWebRtcPeer pointer to the WebRtcPeerBintr that owns the queue.
+     */
+    static void on_peer_queue_underrun_cb(GstElement* pQueue, gpointer pWebRtcPeer);
+
+    /**
+     * @brief Timer callback function to remove all closed peers.
+     * @param[in] pWebRtcFanoutSink pointer to the WebRtcFanoutSinkBintr.
+     */
+    static int remove_closed_peers_cb(gpointer pWebRtcFanoutSink);
+
 }
 #endif //_DSL_SINK_BINTR_H
@@ -0,0 +1,184 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslSyntheticBatchMeta.h"
+
+#define SYNTHETIC_FRAME_WIDTH 1920
+#define SYNTHETIC_FRAME_HEIGHT 1080
+#define SYNTHETIC_OBJECT_WIDTH 80
+#define SYNTHETIC_OBJECT_HEIGHT 160
+
+namespace DSL
+{
+    SyntheticBatchMeta::SyntheticBatchMeta(uint numSources, uint objectsPerFrame, 
+        const std::vector<uint>& classMix, uint motionModel, 
+        uint objectLifetime, uint seed)
+        : m_motionModel(motionModel)
+        , m_objectLifetime(objectLifetime)
+        , m_frameNumber(0)
+        , m_nextTrackingId(1)
+        , m_generator(seed)
+        , m_classDistribution(classMix.begin(), classMix.end())
+    {
+        LOG_FUNC();
+        
+        m_pBatchMeta = nvds_create_batch_meta(numSources);
+        m_pBuffer = gst_buffer_new();
+        
+        // attach the batch meta as nvstreammux does, the buffer takes ownership.
+        NvDsMeta* pMeta = gst_buffer_add_nvds_meta(m_pBuffer, m_pBatchMeta, NULL,
+            nvds_batch_meta_copy_func, nvds_batch_meta_release_func);
+        pMeta->meta_type = NVDS_BATCH_GST_META;
+        m_pBatchMeta->base_meta.batch_meta = m_pBatchMeta;
+        
+        for (uint i = 0; i < numSources; i++)
+        {
+            NvDsFrameMeta* pFrameMeta = nvds_acquire_frame_meta_from_pool(m_pBatchMeta);
+            pFrameMeta->source_id = i;
+            pFrameMeta->pad_index = i;
+            pFrameMeta->batch_id = i;
+            pFrameMeta->frame_num = 0;
+            pFrameMeta->source_frame_width = SYNTHETIC_FRAME_WIDTH;
+            pFrameMeta->source_frame_height = SYNTHETIC_FRAME_HEIGHT;
+            pFrameMeta->bInferDone = true;
+            nvds_add_frame_meta_to_batch(m_pBatchMeta, pFrameMeta);
+            m_frames.push_back(pFrameMeta);
+            
+            for (uint j = 0; j < objectsPerFrame; j++)
+            {
+                SyntheticObject object{pFrameMeta, 
+                    nvds_acquire_obj_meta_from_pool(m_pBatchMeta)};
+                nvds_add_obj_meta_to_frame(pFrameMeta, object.m_pObjectMeta, NULL);
+                    
+                spawnObject(object);
+                m_objects.push_back(object);
+            }
+        }
+    }
+    
+    SyntheticBatchMeta::~SyntheticBatchMeta()
+    {
+        LOG_FUNC();
+        
+        // releases the batch meta as well
+        gst_buffer_unref(m_pBuffer);
+    }
+    
+    void SyntheticBatchMeta::NextBatch()
+    {
+        // Do not log function entry - called for every batch
+        
+        m_frameNumber++;
+        
+        for (auto const& pFrameMeta: m_frames)
+        {
+            pFrameMeta->frame_num = m_frameNumber;
+            pFrameMeta->buf_pts = m_frameNumber*GST_SECOND/30;
+            pFrameMeta->ntp_timestamp = pFrameMeta->buf_pts;
+            
+            if (pFrameMeta->display_meta_list)
+            {
+                nvds_clear_display_meta_list(pFrameMeta, 
+                    pFrameMeta->display_meta_list);
+                pFrameMeta->display_meta_list = NULL;
+                pFrameMeta->num_display_meta = 0;
+            }
+        }
+        std::uniform_real_distribution<float> step(-4.0, 4.0);
+        
+        for (auto& object: m_objects)
+        {
+            if (m_objectLifetime and ++object.m_age >= m_objectLifetime)
+            {
+                spawnObject(object);
+                continue;
+            }
+            if (m_motionModel == MOTION_RANDOM_WALK)
+            {
+                object.m_dx = step(m_generator);
+                object.m_dy = step(m_generator);
+            }
+            object.m_left += object.m_dx;
+            object.m_top += object.m_dy;
+
+            // bounce off the frame edges
+            if (object.m_left < 0 or 
+                object.m_left > SYNTHETIC_FRAME_WIDTH - SYNTHETIC_OBJECT_WIDTH)
+            {
+                object.m_dx = -object.m_dx;
+                object.m_left += 2*object.m_dx;
+            }
+            if (object.m_top < 0 or 
+                object.m_top > SYNTHETIC_FRAME_HEIGHT - SYNTHETIC_OBJECT_HEIGHT)
+            {
+                object.m_dy = -object.m_dy;
+                object.m_top += 2*object.m_dy;
+            }
+            updateObjectMeta(object);
+        }
+    }
+    
+    void SyntheticBatchMeta::spawnObject(SyntheticObject& object)
+    {
+        std::uniform_real_distribution<float> left(0, 
+            SYNTHETIC_FRAME_WIDTH - SYNTHETIC_OBJECT_WIDTH);
+        std::uniform_real_distribution<float> top(0, 
+            SYNTHETIC_FRAME_HEIGHT - SYNTHETIC_OBJECT_HEIGHT);
+        std::uniform_real_distribution<float> velocity(-8.0, 8.0);
+        std::uniform_real_distribution<float> confidence(0.3, 1.0);
+        
+        object.m_left = left(m_generator);
+        object.m_top = top(m_generator);
+        object.m_dx = (m_motionModel == MOTION_LINEAR) ? velocity(m_generator) : 0;
+        object.m_dy = (m_motionModel == MOTION_LINEAR) ? velocity(m_generator) : 0;
+        object.m_age = 0;
+        
+        NvDsObjectMeta* pObjectMeta = object.m_pObjectMeta;
+        pObjectMeta->unique_component_id = 1;
+        pObjectMeta->class_id = m_classDistribution(m_generator);
+        pObjectMeta->object_id = m_nextTrackingId++;
+        pObjectMeta->confidence = confidence(m_generator);
+        pObjectMeta->tracker_confidence = pObjectMeta->confidence;
+        snprintf(pObjectMeta->obj_label, MAX_LABEL_SIZE, "class-%d", 
+            pObjectMeta->class_id);
+            
+        updateObjectMeta(object);
+    }
+    
+    void SyntheticBatchMeta::updateObjectMeta(SyntheticObject& object)
+    {
+        NvOSD_RectParams& rectParams = object.m_pObjectMeta->rect_params;
+        rectParams.left = object.m_left;
+        rectParams.top = object.m_top;
+        rectParams.width = SYNTHETIC_OBJECT_WIDTH;
+        rectParams.height = SYNTHETIC_OBJECT_HEIGHT;
+        rectParams.border_width = 1;
+        rectParams.has_bg_color = false;
+        
+        // label actions allocate the display text - free to start each batch clean.
+        g_free(object.m_pObjectMeta->text_params.display_text);
+        object.m_pObjectMeta->text_params.display_text = NULL;
+    }
+}
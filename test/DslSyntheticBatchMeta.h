@@ -0,0 +1,138 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_SYNTHETIC_BATCH_META_H
+#define _DSL_SYNTHETIC_BATCH_META_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @class SyntheticBatchMeta
+     * @file DslSyntheticBatchMeta.h
+     * @brief Generates a GstBuffer with synthetic NvDsBatchMeta - one frame per 
+     * source with a fixed number of objects per frame - for testing and 
+     * benchmarking Pad Probe Handlers without a GPU pipeline. The batch meta is
+     * acquired once and updated in place on each call to NextBatch.
+     */
+    class SyntheticBatchMeta
+    {
+    public:
+    
+        /**
+         * @brief Motion models for the synthetic tracked objects.
+         */
+        enum {MOTION_STATIC=0, MOTION_LINEAR, MOTION_RANDOM_WALK};
+    
+        /**
+         * @brief ctor for the SyntheticBatchMeta class
+         * @param[in] numSources number of sources/frames in each batch.
+         * @param[in] objectsPerFrame number of objects in each frame.
+         * @param[in] classMix relative weight for each class id, i.e. 
+         * {3, 1} = 75% class 0 and 25% class 1.
+         * @param[in] motionModel one of the MOTION_* constants.
+         * @param[in] objectLifetime number of frames an object is tracked before 
+         * it is replaced with a new object/tracking id. 0 = never replaced.
+         * @param[in] seed seed for the random number generator.
+         */
+        SyntheticBatchMeta(uint numSources, uint objectsPerFrame, 
+            const std::vector<uint>& classMix, uint motionModel, 
+            uint objectLifetime, uint seed = 1);
+            
+        ~SyntheticBatchMeta();
+        
+        /**
+         * @brief Gets the GstBuffer with the batch meta attached.
+         * @return buffer owned by this SyntheticBatchMeta.
+         */
+        GstBuffer* GetBuffer(){return m_pBuffer;};
+        
+        /**
+         * @brief Gets the batch meta attached to the buffer.
+         */
+        NvDsBatchMeta* GetBatchMeta(){return m_pBatchMeta;};
+        
+        /**
+         * @brief Gets the total number of objects in each batch.
+         */
+        uint GetObjectsPerBatch(){return m_objects.size();};
+        
+        /**
+         * @brief Advances the batch to the next frame number. All objects are 
+         * moved, expired objects are replaced, and all display meta added by
+         * the previous call to HandlePadData is removed.
+         */
+        void NextBatch();
+        
+    private:
+    
+        /**
+         * @brief state for a synthetic object, the position is kept here so 
+         * that updates to the object meta by ODE Actions do not accumulate.
+         */
+        struct SyntheticObject
+        {
+            NvDsFrameMeta* m_pFrameMeta;
+            NvDsObjectMeta* m_pObjectMeta;
+            float m_left;
+            float m_top;
+            float m_dx;
+            float m_dy;
+            uint m_age;
+        };
+        
+        /**
+         * @brief initializes a new object with a new tracking id.
+         */
+        void spawnObject(SyntheticObject& object);
+        
+        /**
+         * @brief copies the object state to its object meta
+         */
+        void updateObjectMeta(SyntheticObject& object);
+
+        uint m_motionModel;
+        
+        uint m_objectLifetime;
+        
+        uint64_t m_frameNumber;
+        
+        uint64_t m_nextTrackingId;
+        
+        std::mt19937 m_generator;
+        
+        std::discrete_distribution<uint> m_classDistribution;
+        
+        GstBuffer* m_pBuffer;
+        
+        NvDsBatchMeta* m_pBatchMeta;
+        
+        std::vector<NvDsFrameMeta*> m_frames;
+        
+        std::vector<SyntheticObject> m_objects;
+    };
+}
+
+#endif // _DSL_SYNTHETIC_BATCH_META_H
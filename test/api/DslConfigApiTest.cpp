@@ -0,0 +1,261 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslApi.h"
+
+static std::wstring polygon_name(L"polygon");
+static std::wstring color_name(L"light-white");
+static std::wstring existing_trigger_name(L"existing-trigger");
+static std::wstring existing_sink_name(L"existing-sink");
+static std::wstring existing_pipeline_name(L"existing-pipeline");
+static std::wstring existing_pph_name(L"existing-handler");
+
+static std::wstring config(
+    L"{"
+    L"  \"actions\": ["
+    L"    {\"name\": \"print-action\", \"type\": \"print\", \"force-flush\": true},"
+    L"    {\"name\": \"log-action\", \"type\": \"log\"}"
+    L"  ],"
+    L"  \"areas\": ["
+    L"    {\"name\": \"lane-area\", \"type\": \"inclusion\", \"polygon\": \"polygon\"}"
+    L"  ],"
+    L"  \"triggers\": ["
+    L"    {\"name\": \"person-trigger\", \"type\": \"occurrence\", \"class-id\": 2,"
+    L"      \"limit\": 10, \"interval\": 5, \"enabled\": false,"
+    L"      \"actions\": [\"print-action\", \"log-action\"], \"areas\": [\"lane-area\"]},"
+    L"    {\"name\": \"vehicle-trigger\", \"type\": \"absence\", \"class-id\": 0}"
+    L"  ],"
+    L"  \"pphs\": ["
+    L"    {\"name\": \"ode-handler\", \"type\": \"ode\","
+    L"      \"triggers\": [\"person-trigger\", \"vehicle-trigger\"]}"
+    L"  ],"
+    L"  \"components\": ["
+    L"    {\"name\": \"tiler\", \"type\": \"tiler\", \"width\": 1280, \"height\": 720,"
+    L"      \"src-pphs\": [\"ode-handler\"]},"
+    L"    {\"name\": \"fake-sink\", \"type\": \"fake-sink\"}"
+    L"  ],"
+    L"  \"pipelines\": ["
+    L"    {\"name\": \"pipeline\", \"components\": [\"tiler\", \"fake-sink\"]}"
+    L"  ]"
+    L"}");
+
+static void create_polygon()
+{
+    dsl_coordinate coordinates[4] = {{100,100},{210,110},{220, 300},{110,330}};
+
+    REQUIRE( dsl_display_type_rgba_color_custom_new(color_name.c_str(), 
+        1.0, 1.0, 1.0, 0.25) == DSL_RESULT_SUCCESS );
+    REQUIRE( dsl_display_type_rgba_polygon_new(polygon_name.c_str(), 
+        coordinates, 4, 3, color_name.c_str())== DSL_RESULT_SUCCESS );
+}
+
+static void delete_all()
+{
+    REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+    REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+    REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+    REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+    REQUIRE( dsl_ode_area_delete_all() == DSL_RESULT_SUCCESS );
+    REQUIRE( dsl_ode_action_delete_all() == DSL_RESULT_SUCCESS );
+    REQUIRE( dsl_display_type_delete_all() == DSL_RESULT_SUCCESS );
+}
+
+SCENARIO( "A configuration string creates all of its objects", "[config-api]" )
+{
+    GIVEN( "An RGBA Polygon for the configuration's ODE Area" ) 
+    {
+        create_polygon();
+        
+        REQUIRE( dsl_ode_action_list_size() == 0 );
+        REQUIRE( dsl_ode_trigger_list_size() == 0 );
+
+        WHEN( "The configuration is loaded" ) 
+        {
+            REQUIRE( dsl_config_string_load(config.c_str()) == DSL_RESULT_SUCCESS );
+
+            THEN( "All objects are created with their settings and relationships" ) 
+            {
+                REQUIRE( dsl_ode_action_list_size() == 2 );
+                REQUIRE( dsl_ode_area_list_size() == 1 );
+                REQUIRE( dsl_ode_trigger_list_size() == 2 );
+                REQUIRE( dsl_pph_list_size() == 1 );
+                REQUIRE( dsl_component_list_size() == 2 );
+                REQUIRE( dsl_pipeline_list_size() == 1 );
+                
+                boolean enabled(true);
+                uint limit(0), interval(0), classId(0);
+                REQUIRE( dsl_ode_trigger_enabled_get(L"person-trigger", 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == false );
+                REQUIRE( dsl_ode_trigger_limit_event_get(L"person-trigger", 
+                    &limit) == DSL_RESULT_SUCCESS );
+                REQUIRE( limit == 10 );
+                REQUIRE( dsl_ode_trigger_interval_get(L"person-trigger", 
+                    &interval) == DSL_RESULT_SUCCESS );
+                REQUIRE( interval == 5 );
+                REQUIRE( dsl_ode_trigger_class_id_get(L"person-trigger", 
+                    &classId) == DSL_RESULT_SUCCESS );
+                REQUIRE( classId == 2 );
+                
+                // relationships are already in place
+                REQUIRE( dsl_ode_trigger_action_add(L"person-trigger", 
+                    L"print-action") == DSL_RESULT_ODE_TRIGGER_ACTION_ADD_FAILED );
+                REQUIRE( dsl_pph_ode_trigger_add(L"ode-handler", 
+                    L"vehicle-trigger") == DSL_RESULT_ODE_TRIGGER_IN_USE );
+                REQUIRE( dsl_pipeline_component_add(L"pipeline", 
+                    L"fake-sink") == DSL_RESULT_COMPONENT_IN_USE );
+
+                delete_all();
+            }
+        }
+    }
+}
+
+SCENARIO( "A configuration with a conflicting name creates no objects", "[config-api]" )
+{
+    GIVEN( "An existing ODE Trigger with the same name as a configured Trigger" ) 
+    {
+        create_polygon();
+        
+        REQUIRE( dsl_ode_trigger_occurrence_new(L"vehicle-trigger", 
+            NULL, DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The configuration is loaded" ) 
+        {
+            REQUIRE( dsl_config_string_load(config.c_str()) == 
+                DSL_RESULT_CONFIG_NAME_NOT_UNIQUE );
+
+            THEN( "No objects are created" ) 
+            {
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+                REQUIRE( dsl_ode_area_list_size() == 0 );
+                REQUIRE( dsl_ode_trigger_list_size() == 1 );
+                REQUIRE( dsl_pph_list_size() == 0 );
+                REQUIRE( dsl_component_list_size() == 0 );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+
+                delete_all();
+            }
+        }
+    }
+}
+
+SCENARIO( "A configuration that fails to create is rolled back", "[config-api]" )
+{
+    GIVEN( "An existing ODE Trigger and a Sink in use by an existing Pipeline" ) 
+    {
+        REQUIRE( dsl_ode_trigger_occurrence_new(existing_trigger_name.c_str(), 
+            NULL, DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(existing_sink_name.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_new(existing_pipeline_name.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_component_add(existing_pipeline_name.c_str(), 
+            existing_sink_name.c_str()) == DSL_RESULT_SUCCESS );
+
+        std::wstring failingConfig(
+            L"{"
+            L"  \"pphs\": ["
+            L"    {\"name\": \"ode-handler\", \"type\": \"ode\","
+            L"      \"triggers\": [\"existing-trigger\"]}"
+            L"  ],"
+            L"  \"components\": ["
+            L"    {\"name\": \"fake-sink\", \"type\": \"fake-sink\","
+            L"      \"sink-pphs\": [\"ode-handler\"]}"
+            L"  ],"
+            L"  \"pipelines\": ["
+            L"    {\"name\": \"pipeline\", \"components\": [\"fake-sink\", \"existing-sink\"]}"
+            L"  ]"
+            L"}");
+
+        WHEN( "A configuration that adds the in-use Sink to a new Pipeline is loaded" ) 
+        {
+            REQUIRE( dsl_config_string_load(failingConfig.c_str()) == 
+                DSL_RESULT_CONFIG_CREATE_FAILED );
+
+            THEN( "No objects are created and the existing Trigger is not in use" ) 
+            {
+                REQUIRE( dsl_ode_trigger_list_size() == 1 );
+                REQUIRE( dsl_pph_list_size() == 0 );
+                REQUIRE( dsl_component_list_size() == 1 );
+                REQUIRE( dsl_pipeline_list_size() == 1 );
+                
+                REQUIRE( dsl_pph_ode_new(existing_pph_name.c_str()) == 
+                    DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pph_ode_trigger_add(existing_pph_name.c_str(), 
+                    existing_trigger_name.c_str()) == DSL_RESULT_SUCCESS );
+
+                delete_all();
+            }
+        }
+    }
+}
+
+SCENARIO( "An invalid configuration fails with the correct result", "[config-api]" )
+{
+    GIVEN( "An empty set of Services" ) 
+    {
+        REQUIRE( dsl_ode_action_list_size() == 0 );
+
+        WHEN( "Invalid configurations are loaded" ) 
+        {
+            THEN( "The correct result codes are returned" ) 
+            {
+                REQUIRE( dsl_config_file_load(L"./bad/path/config.json") == 
+                    DSL_RESULT_CONFIG_FILE_NOT_FOUND );
+                REQUIRE( dsl_config_string_load(L"{\"actions\": [") == 
+                    DSL_RESULT_CONFIG_PARSE_FAILED );
+                REQUIRE( dsl_config_string_load(L"{\"unknown\": []}") == 
+                    DSL_RESULT_CONFIG_PARSE_FAILED );
+                REQUIRE( dsl_config_string_load(
+                    L"{\"actions\": [{\"name\": \"a\", \"type\": \"unknown\"}]}") == 
+                    DSL_RESULT_CONFIG_ITEM_INVALID );
+                REQUIRE( dsl_config_string_load(
+                    L"{\"actions\": [{\"name\": \"a\", \"type\": \"log\", \"x\": 1}]}") == 
+                    DSL_RESULT_CONFIG_ITEM_INVALID );
+                REQUIRE( dsl_config_string_load(
+                    L"{\"triggers\": [{\"name\": \"t\", \"type\": \"occurrence\","
+                    L" \"actions\": [\"missing\"]}]}") == 
+                    DSL_RESULT_CONFIG_NAME_NOT_FOUND );
+                    
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+                REQUIRE( dsl_ode_trigger_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Configuration API checks for NULL input parameters", "[config-api]" )
+{
+    GIVEN( "An empty set of Services" ) 
+    {
+        WHEN( "When NULL pointers are used as input" ) 
+        {
+            THEN( "The API returns DSL_RESULT_INVALID_INPUT_PARAM in all cases" ) 
+            {
+                REQUIRE( dsl_config_file_load(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_config_string_load(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+            }
+        }
+    }
+}
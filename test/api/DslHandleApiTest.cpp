@@ -0,0 +1,613 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslApi.h"
+
+static std::wstring trigger_name(L"occurrence");
+static std::wstring action_name(L"print-action");
+static std::wstring pph_name(L"ode-handler");
+static std::wstring source_name(L"csi-source");
+static std::wstring sink_name(L"fake-sink");
+
+static uint width(1280);
+static uint height(720);
+static uint fps_n(30);
+static uint fps_d(1);
+
+static boolean meter_client_handler(double* session_fps_averages, 
+    double* interval_fps_averages, uint source_count, void* client_data)
+{
+    return true;
+}
+
+SCENARIO( "An ODE Trigger can be updated and queried by handle", "[handle-api]" )
+{
+    GIVEN( "A new ODE Trigger and its handle" ) 
+    {
+        REQUIRE( dsl_ode_trigger_occurrence_new(trigger_name.c_str(), 
+            NULL, DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE) == DSL_RESULT_SUCCESS );
+
+        DslHandle handle(DSL_HANDLE_INVALID);
+        REQUIRE( dsl_ode_trigger_handle_get(trigger_name.c_str(), 
+            &handle) == DSL_RESULT_SUCCESS );
+        REQUIRE( handle != DSL_HANDLE_INVALID );
+        REQUIRE( dsl_handle_list_size() == 1 );
+
+        WHEN( "The Trigger's settings are updated by handle" ) 
+        {
+            REQUIRE( dsl_ode_trigger_enabled_set_h(handle, 
+                false) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_trigger_limit_event_set_h(handle, 
+                10) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_trigger_interval_set_h(handle, 
+                5) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_trigger_reset_h(handle) == DSL_RESULT_SUCCESS );
+
+            THEN( "The same values are returned by name and by handle" ) 
+            {
+                boolean enabled(true);
+                uint limit(0), interval(0);
+                REQUIRE( dsl_ode_trigger_enabled_get(trigger_name.c_str(), 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == false );
+                enabled = true;
+                REQUIRE( dsl_ode_trigger_enabled_get_h(handle, 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == false );
+                
+                REQUIRE( dsl_ode_trigger_limit_event_get_h(handle, 
+                    &limit) == DSL_RESULT_SUCCESS );
+                REQUIRE( limit == 10 );
+                REQUIRE( dsl_ode_trigger_interval_get_h(handle, 
+                    &interval) == DSL_RESULT_SUCCESS );
+                REQUIRE( interval == 5 );
+
+                REQUIRE( dsl_handle_release(handle) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_handle_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "The same handle is returned for the same object until released", "[handle-api]" )
+{
+    GIVEN( "A new ODE Trigger and its handle" ) 
+    {
+        REQUIRE( dsl_ode_trigger_occurrence_new(trigger_name.c_str(), 
+            NULL, DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE) == DSL_RESULT_SUCCESS );
+
+        DslHandle handle(DSL_HANDLE_INVALID);
+        REQUIRE( dsl_ode_trigger_handle_get(trigger_name.c_str(), 
+            &handle) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The handle is requested again" ) 
+        {
+            DslHandle retHandle(DSL_HANDLE_INVALID);
+            REQUIRE( dsl_ode_trigger_handle_get(trigger_name.c_str(), 
+                &retHandle) == DSL_RESULT_SUCCESS );
+
+            THEN( "The same handle is returned" ) 
+            {
+                REQUIRE( retHandle == handle );
+                REQUIRE( dsl_handle_list_size() == 1 );
+
+                REQUIRE( dsl_handle_release(handle) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The handle is released" ) 
+        {
+            REQUIRE( dsl_handle_release(handle) == DSL_RESULT_SUCCESS );
+
+            THEN( "The handle no longer resolves and a new handle is issued" ) 
+            {
+                boolean enabled(false);
+                REQUIRE( dsl_ode_trigger_enabled_get_h(handle, 
+                    &enabled) == DSL_RESULT_HANDLE_INVALID );
+                REQUIRE( dsl_handle_release(handle) == DSL_RESULT_HANDLE_INVALID );
+                
+                DslHandle newHandle(DSL_HANDLE_INVALID);
+                REQUIRE( dsl_ode_trigger_handle_get(trigger_name.c_str(), 
+                    &newHandle) == DSL_RESULT_SUCCESS );
+                REQUIRE( newHandle != handle );
+                REQUIRE( dsl_ode_trigger_enabled_get_h(newHandle, 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_handle_release(newHandle) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A handle is invalidated when its object is deleted", "[handle-api]" )
+{
+    GIVEN( "A new ODE Trigger and its handle" ) 
+    {
+        REQUIRE( dsl_ode_trigger_occurrence_new(trigger_name.c_str(), 
+            NULL, DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE) == DSL_RESULT_SUCCESS );
+
+        DslHandle handle(DSL_HANDLE_INVALID);
+        REQUIRE( dsl_ode_trigger_handle_get(trigger_name.c_str(), 
+            &handle) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Trigger is deleted and re-created with the same name" ) 
+        {
+            REQUIRE( dsl_ode_trigger_delete(trigger_name.c_str()) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_trigger_occurrence_new(trigger_name.c_str(), 
+                NULL, DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE) == DSL_RESULT_SUCCESS );
+
+            THEN( "The old handle fails and a new handle is issued" ) 
+            {
+                REQUIRE( dsl_ode_trigger_enabled_set_h(handle, 
+                    false) == DSL_RESULT_HANDLE_INVALID );
+                
+                DslHandle newHandle(DSL_HANDLE_INVALID);
+                REQUIRE( dsl_ode_trigger_handle_get(trigger_name.c_str(), 
+                    &newHandle) == DSL_RESULT_SUCCESS );
+                REQUIRE( newHandle != handle );
+                REQUIRE( dsl_ode_trigger_enabled_set_h(newHandle, 
+                    false) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_handle_release(newHandle) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "An ODE Action and a Pad Probe Handler can be updated by handle", "[handle-api]" )
+{
+    GIVEN( "A new ODE Action and ODE Pad Probe Handler" ) 
+    {
+        REQUIRE( dsl_ode_action_print_new(action_name.c_str(), 
+            false) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pph_ode_new(pph_name.c_str()) == DSL_RESULT_SUCCESS );
+
+        DslHandle actionHandle(DSL_HANDLE_INVALID), pphHandle(DSL_HANDLE_INVALID);
+        REQUIRE( dsl_ode_action_handle_get(action_name.c_str(), 
+            &actionHandle) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pph_handle_get(pph_name.c_str(), 
+            &pphHandle) == DSL_RESULT_SUCCESS );
+
+        WHEN( "Both are disabled by handle" ) 
+        {
+            REQUIRE( dsl_ode_action_enabled_set_h(actionHandle, 
+                false) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pph_enabled_set_h(pphHandle, 
+                false) == DSL_RESULT_SUCCESS );
+
+            THEN( "Both report disabled by name and by handle" ) 
+            {
+                boolean enabled(true);
+                REQUIRE( dsl_ode_action_enabled_get(action_name.c_str(), 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == false );
+                enabled = true;
+                REQUIRE( dsl_ode_action_enabled_get_h(actionHandle, 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == false );
+                enabled = true;
+                REQUIRE( dsl_pph_enabled_get(pph_name.c_str(), 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == false );
+                enabled = true;
+                REQUIRE( dsl_pph_enabled_get_h(pphHandle, 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == false );
+
+                REQUIRE( dsl_handle_release(actionHandle) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_handle_release(pphHandle) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "An ODE Trigger's filters can be updated and queried by handle", "[handle-api]" )
+{
+    GIVEN( "A new ODE Trigger and its handle" ) 
+    {
+        REQUIRE( dsl_ode_trigger_occurrence_new(trigger_name.c_str(), 
+            NULL, DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE) == DSL_RESULT_SUCCESS );
+
+        DslHandle handle(DSL_HANDLE_INVALID);
+        REQUIRE( dsl_ode_trigger_handle_get(trigger_name.c_str(), 
+            &handle) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Trigger's filters are updated by handle" ) 
+        {
+            REQUIRE( dsl_ode_trigger_source_set_h(handle, 
+                source_name.c_str()) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_trigger_infer_set_h(handle, 
+                L"primary-gie") == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_trigger_class_id_set_h(handle, 
+                2) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_trigger_limit_frame_set_h(handle, 
+                100) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_trigger_reset_timeout_set_h(handle, 
+                30) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_trigger_infer_confidence_min_set_h(handle, 
+                0.25) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_trigger_infer_confidence_max_set_h(handle, 
+                0.75) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_trigger_tracker_confidence_min_set_h(handle, 
+                0.5) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_trigger_tracker_confidence_max_set_h(handle, 
+                1.0) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_trigger_dimensions_min_set_h(handle, 
+                40, 80) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_trigger_dimensions_max_set_h(handle, 
+                600, 800) == DSL_RESULT_SUCCESS );
+
+            THEN( "The same values are returned by name and by handle" ) 
+            {
+                const wchar_t* cRetSource(NULL);
+                REQUIRE( dsl_ode_trigger_source_get(trigger_name.c_str(), 
+                    &cRetSource) == DSL_RESULT_SUCCESS );
+                REQUIRE( std::wstring(cRetSource) == source_name );
+                cRetSource = NULL;
+                REQUIRE( dsl_ode_trigger_source_get_h(handle, 
+                    &cRetSource) == DSL_RESULT_SUCCESS );
+                REQUIRE( std::wstring(cRetSource) == source_name );
+
+                const wchar_t* cRetInfer(NULL);
+                REQUIRE( dsl_ode_trigger_infer_get_h(handle, 
+                    &cRetInfer) == DSL_RESULT_SUCCESS );
+                REQUIRE( std::wstring(cRetInfer) == L"primary-gie" );
+
+                uint classId(0), limit(0), timeout(0);
+                REQUIRE( dsl_ode_trigger_class_id_get(trigger_name.c_str(), 
+                    &classId) == DSL_RESULT_SUCCESS );
+                REQUIRE( classId == 2 );
+                classId = 0;
+                REQUIRE( dsl_ode_trigger_class_id_get_h(handle, 
+                    &classId) == DSL_RESULT_SUCCESS );
+                REQUIRE( classId == 2 );
+                REQUIRE( dsl_ode_trigger_limit_frame_get_h(handle, 
+                    &limit) == DSL_RESULT_SUCCESS );
+                REQUIRE( limit == 100 );
+                REQUIRE( dsl_ode_trigger_reset_timeout_get_h(handle, 
+                    &timeout) == DSL_RESULT_SUCCESS );
+                REQUIRE( timeout == 30 );
+
+                float minConfidence(0), maxConfidence(0);
+                REQUIRE( dsl_ode_trigger_infer_confidence_min_get_h(handle, 
+                    &minConfidence) == DSL_RESULT_SUCCESS );
+                REQUIRE( minConfidence == 0.25 );
+                REQUIRE( dsl_ode_trigger_infer_confidence_max_get_h(handle, 
+                    &maxConfidence) == DSL_RESULT_SUCCESS );
+                REQUIRE( maxConfidence == 0.75 );
+                REQUIRE( dsl_ode_trigger_tracker_confidence_min_get_h(handle, 
+                    &minConfidence) == DSL_RESULT_SUCCESS );
+                REQUIRE( minConfidence == 0.5 );
+                REQUIRE( dsl_ode_trigger_tracker_confidence_max_get_h(handle, 
+                    &maxConfidence) == DSL_RESULT_SUCCESS );
+                REQUIRE( maxConfidence == 1.0 );
+
+                float minWidth(0), minHeight(0), maxWidth(0), maxHeight(0);
+                REQUIRE( dsl_ode_trigger_dimensions_min_get(trigger_name.c_str(), 
+                    &minWidth, &minHeight) == DSL_RESULT_SUCCESS );
+                REQUIRE( minWidth == 40 );
+                REQUIRE( minHeight == 80 );
+                REQUIRE( dsl_ode_trigger_dimensions_max_get_h(handle, 
+                    &maxWidth, &maxHeight) == DSL_RESULT_SUCCESS );
+                REQUIRE( maxWidth == 600 );
+                REQUIRE( maxHeight == 800 );
+
+                // a NULL filter disables the Source filter
+                REQUIRE( dsl_ode_trigger_source_set_h(handle, 
+                    NULL) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_source_get_h(handle, 
+                    &cRetSource) == DSL_RESULT_SUCCESS );
+                REQUIRE( cRetSource == NULL );
+
+                REQUIRE( dsl_handle_release(handle) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "Meter and Latency Pad Probe Handlers can be queried by handle", "[handle-api]" )
+{
+    GIVEN( "A new Meter PPH, Latency PPH, and ODE PPH" ) 
+    {
+        std::wstring meter_name(L"meter-pph");
+        std::wstring latency_name(L"latency-pph");
+
+        REQUIRE( dsl_pph_meter_new(meter_name.c_str(), 1, 
+            meter_client_handler, NULL) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pph_latency_new(latency_name.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pph_ode_new(pph_name.c_str()) == DSL_RESULT_SUCCESS );
+
+        DslHandle meterHandle(DSL_HANDLE_INVALID), latencyHandle(DSL_HANDLE_INVALID),
+            odeHandle(DSL_HANDLE_INVALID);
+        REQUIRE( dsl_pph_handle_get(meter_name.c_str(), 
+            &meterHandle) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pph_handle_get(latency_name.c_str(), 
+            &latencyHandle) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pph_handle_get(pph_name.c_str(), 
+            &odeHandle) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Meter's interval is updated by handle" ) 
+        {
+            REQUIRE( dsl_pph_meter_interval_set_h(meterHandle, 
+                5) == DSL_RESULT_SUCCESS );
+
+            THEN( "The type-specific services behave as their name-based versions" ) 
+            {
+                uint interval(0);
+                REQUIRE( dsl_pph_meter_interval_get(meter_name.c_str(), 
+                    &interval) == DSL_RESULT_SUCCESS );
+                REQUIRE( interval == 5 );
+                interval = 0;
+                REQUIRE( dsl_pph_meter_interval_get_h(meterHandle, 
+                    &interval) == DSL_RESULT_SUCCESS );
+                REQUIRE( interval == 5 );
+                REQUIRE( dsl_pph_meter_interval_set_h(meterHandle, 
+                    0) == DSL_RESULT_PPH_METER_INVALID_INTERVAL );
+
+                // the Latency PPH has no segments until added to components
+                dsl_latency_stats stats{0};
+                REQUIRE( dsl_pph_latency_segment_stats_get_h(latencyHandle, 
+                    0, &stats) == DSL_RESULT_PPH_LATENCY_SEGMENT_INVALID );
+
+                // a PPH handle of the wrong PPH type
+                REQUIRE( dsl_pph_meter_interval_get_h(odeHandle, 
+                    &interval) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_pph_latency_segment_stats_get_h(meterHandle, 
+                    0, &stats) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+
+                REQUIRE( dsl_handle_release(meterHandle) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_handle_release(latencyHandle) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_handle_release(odeHandle) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Source and a Sink can be queried and updated by handle", "[handle-api]" )
+{
+    GIVEN( "A new CSI Source and Fake Sink" ) 
+    {
+        REQUIRE( dsl_source_csi_new(source_name.c_str(), 
+            width, height, fps_n, fps_d) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(sink_name.c_str()) == DSL_RESULT_SUCCESS );
+
+        DslHandle sourceHandle(DSL_HANDLE_INVALID), sinkHandle(DSL_HANDLE_INVALID);
+        REQUIRE( dsl_source_handle_get(source_name.c_str(), 
+            &sourceHandle) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_handle_get(sink_name.c_str(), 
+            &sinkHandle) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Sink's sync setting is updated by handle" ) 
+        {
+            REQUIRE( dsl_sink_sync_enabled_set_h(sinkHandle, 
+                false) == DSL_RESULT_SUCCESS );
+
+            THEN( "The same values are returned by name and by handle" ) 
+            {
+                uint retWidth(0), retHeight(0), retFpsN(0), retFpsD(0);
+                uint retWidthH(0), retHeightH(0), retFpsNH(0), retFpsDH(0);
+                REQUIRE( dsl_source_video_dimensions_get(source_name.c_str(), 
+                    &retWidth, &retHeight) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_source_video_dimensions_get_h(sourceHandle, 
+                    &retWidthH, &retHeightH) == DSL_RESULT_SUCCESS );
+                REQUIRE( retWidthH == retWidth );
+                REQUIRE( retHeightH == retHeight );
+                REQUIRE( dsl_source_frame_rate_get(source_name.c_str(), 
+                    &retFpsN, &retFpsD) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_source_frame_rate_get_h(sourceHandle, 
+                    &retFpsNH, &retFpsDH) == DSL_RESULT_SUCCESS );
+                REQUIRE( retFpsNH == retFpsN );
+                REQUIRE( retFpsDH == retFpsD );
+
+                boolean sync(true);
+                REQUIRE( dsl_sink_sync_enabled_get(sink_name.c_str(), 
+                    &sync) == DSL_RESULT_SUCCESS );
+                REQUIRE( sync == false );
+                sync = true;
+                REQUIRE( dsl_sink_sync_enabled_get_h(sinkHandle, 
+                    &sync) == DSL_RESULT_SUCCESS );
+                REQUIRE( sync == false );
+
+                boolean isLive(false);
+                REQUIRE( dsl_source_is_live_h(sourceHandle, 
+                    &isLive) == DSL_RESULT_SUCCESS );
+                REQUIRE( isLive == dsl_source_is_live(source_name.c_str()) );
+
+                // the Fake Sink is not an App Sink
+                uint depth(0), highWater(0);
+                uint64_t dropped(0);
+                REQUIRE( dsl_sink_app_queue_stats_get_h(sinkHandle, &depth, 
+                    &highWater, &dropped) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+
+                REQUIRE( dsl_handle_release(sourceHandle) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_handle_release(sinkHandle) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A queued App Sink's queue stats can be queried by handle", "[handle-api]" )
+{
+    GIVEN( "A new queued App Sink and its handle" ) 
+    {
+        std::wstring app_sink_name(L"app-sink");
+
+        REQUIRE( dsl_sink_app_queued_new(app_sink_name.c_str(), 
+            DSL_SINK_APP_DATA_TYPE_BUFFER, 8, 
+            DSL_SINK_APP_QUEUE_POLICY_DROP_OLDEST) == DSL_RESULT_SUCCESS );
+
+        DslHandle handle(DSL_HANDLE_INVALID);
+        REQUIRE( dsl_sink_handle_get(app_sink_name.c_str(), 
+            &handle) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The queue stats are queried by handle" ) 
+        {
+            uint depth(99), highWater(99);
+            uint64_t dropped(99);
+            REQUIRE( dsl_sink_app_queue_stats_get_h(handle, &depth, 
+                &highWater, &dropped) == DSL_RESULT_SUCCESS );
+
+            THEN( "The empty queue's stats are returned" ) 
+            {
+                REQUIRE( depth == 0 );
+                REQUIRE( highWater == 0 );
+                REQUIRE( dropped == 0 );
+
+                REQUIRE( dsl_handle_release(handle) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A handle fails when used with a service for a different type", "[handle-api]" )
+{
+    GIVEN( "A new ODE Trigger and Fake Sink" ) 
+    {
+        REQUIRE( dsl_ode_trigger_occurrence_new(trigger_name.c_str(), 
+            NULL, DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(sink_name.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "Handles are acquired for each" ) 
+        {
+            DslHandle triggerHandle(DSL_HANDLE_INVALID), sinkHandle(DSL_HANDLE_INVALID);
+            REQUIRE( dsl_ode_trigger_handle_get(trigger_name.c_str(), 
+                &triggerHandle) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_sink_handle_get(sink_name.c_str(), 
+                &sinkHandle) == DSL_RESULT_SUCCESS );
+
+            THEN( "Each handle fails with the other type's services" ) 
+            {
+                boolean enabled(false);
+                REQUIRE( dsl_sink_sync_enabled_get_h(triggerHandle, 
+                    &enabled) == DSL_RESULT_HANDLE_TYPE_MISMATCH );
+                REQUIRE( dsl_ode_trigger_enabled_get_h(sinkHandle, 
+                    &enabled) == DSL_RESULT_HANDLE_TYPE_MISMATCH );
+                
+                // a Sink is not a Source
+                DslHandle sourceHandle(DSL_HANDLE_INVALID);
+                REQUIRE( dsl_source_handle_get(sink_name.c_str(), 
+                    &sourceHandle) == DSL_RESULT_SOURCE_COMPONENT_IS_NOT_SOURCE );
+
+                REQUIRE( dsl_handle_release(triggerHandle) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_handle_release(sinkHandle) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Handle API checks for NULL input parameters", "[handle-api]" )
+{
+    GIVEN( "An empty list of Handles" ) 
+    {
+        REQUIRE( dsl_handle_list_size() == 0 );
+
+        WHEN( "When NULL pointers are used as input" ) 
+        {
+            THEN( "The API returns DSL_RESULT_INVALID_INPUT_PARAM in all cases" ) 
+            {
+                DslHandle handle(DSL_HANDLE_INVALID);
+                
+                REQUIRE( dsl_ode_trigger_handle_get(NULL, 
+                    &handle) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_handle_get(trigger_name.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_handle_get(NULL, 
+                    &handle) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_handle_get(action_name.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_handle_get(NULL, 
+                    &handle) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_handle_get(pph_name.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_handle_get(NULL, 
+                    &handle) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_handle_get(source_name.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_handle_get(NULL, 
+                    &handle) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_handle_get(sink_name.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_ode_trigger_enabled_get_h(handle, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_limit_event_get_h(handle, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_interval_get_h(handle, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_enabled_get_h(handle, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_enabled_get_h(handle, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_video_dimensions_get_h(handle, 
+                    NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_frame_rate_get_h(handle, 
+                    NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_sync_enabled_get_h(handle, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_ode_trigger_source_get_h(handle, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_infer_get_h(handle, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_class_id_get_h(handle, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_limit_frame_get_h(handle, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_reset_timeout_get_h(handle, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_infer_confidence_min_get_h(handle, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_infer_confidence_max_get_h(handle, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_tracker_confidence_min_get_h(handle, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_tracker_confidence_max_get_h(handle, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_dimensions_min_get_h(handle, 
+                    NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_dimensions_max_get_h(handle, 
+                    NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meter_interval_get_h(handle, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_latency_segment_stats_get_h(handle, 
+                    0, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_is_live_h(handle, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_queue_stats_get_h(handle, 
+                    NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+            }
+        }
+    }
+}
@@ -0,0 +1,71 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslApi.h"
+
+SCENARIO( "The Info API set and get Async Logging Enabled correctly", "[info-api]" )
+{
+    GIVEN( "The default async logging setting" ) 
+    {
+        boolean initial_enabled(true), ret_enabled(true);
+
+        REQUIRE( dsl_info_log_async_enabled_get(&initial_enabled) == 
+            DSL_RESULT_SUCCESS );
+        
+        WHEN( "When async logging is enabled" ) 
+        {
+            REQUIRE( dsl_info_log_async_enabled_set(true) == 
+                DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct setting is returned on get" ) 
+            {
+                REQUIRE( dsl_info_log_async_enabled_get(&ret_enabled) == 
+                    DSL_RESULT_SUCCESS );
+                REQUIRE( ret_enabled == true );
+
+                REQUIRE( dsl_info_log_async_enabled_set(initial_enabled) == 
+                    DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_info_log_async_enabled_get(&ret_enabled) == 
+                    DSL_RESULT_SUCCESS );
+                REQUIRE( ret_enabled == initial_enabled );
+            }
+        }
+    }
+}
+
+SCENARIO( "The Info Async Logging API checks for NULL input parameters", "[info-api]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        WHEN( "When NULL pointers are used as input" ) 
+        {
+            THEN( "The API returns DSL_RESULT_INVALID_INPUT_PARAM in all cases" ) 
+            {
+                REQUIRE( dsl_info_log_async_enabled_get(NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+            }
+        }
+    }
+}
@@ -135,6 +135,78 @@ SCENARIO( "A SMTP Test Message can be Queued", "[mailer-api]" )
     }
 }    
 
+SCENARIO( "A Mailer's queue, rate-limit, and digest settings can be updated", "[mailer-api]" )
+{
+    GIVEN( "A new Mailer" ) 
+    {
+        std::wstring mailer_name(L"mailer");
+
+        REQUIRE( dsl_mailer_new(mailer_name.c_str()) == DSL_RESULT_SUCCESS );
+
+        uint max_size(0), policy(99), max_per_minute(99);
+        uint window(99), max_messages(99);
+        uint64_t sent(99), failed(99), dropped(99);
+        
+        REQUIRE( dsl_mailer_queue_settings_get(mailer_name.c_str(),
+            &max_size, &policy) == DSL_RESULT_SUCCESS );
+        REQUIRE( max_size == 100 );
+        REQUIRE( policy == DSL_MAILER_QUEUE_POLICY_DROP_OLDEST );
+        REQUIRE( dsl_mailer_rate_limit_get(mailer_name.c_str(),
+            &max_per_minute) == DSL_RESULT_SUCCESS );
+        REQUIRE( max_per_minute == 0 );
+        REQUIRE( dsl_mailer_digest_settings_get(mailer_name.c_str(),
+            &window, &max_messages) == DSL_RESULT_SUCCESS );
+        REQUIRE( window == 0 );
+        REQUIRE( max_messages == 0 );
+        REQUIRE( dsl_mailer_stats_get(mailer_name.c_str(),
+            &sent, &failed, &dropped) == DSL_RESULT_SUCCESS );
+        REQUIRE( sent == 0 );
+        REQUIRE( failed == 0 );
+        REQUIRE( dropped == 0 );
+        
+        WHEN( "New settings are set" ) 
+        {
+            REQUIRE( dsl_mailer_queue_settings_set(mailer_name.c_str(),
+                10, DSL_MAILER_QUEUE_POLICY_DROP_NEWEST) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_mailer_rate_limit_set(mailer_name.c_str(),
+                6) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_mailer_digest_settings_set(mailer_name.c_str(),
+                30, 20) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct values are returned on get" ) 
+            {
+                REQUIRE( dsl_mailer_queue_settings_get(mailer_name.c_str(),
+                    &max_size, &policy) == DSL_RESULT_SUCCESS );
+                REQUIRE( max_size == 10 );
+                REQUIRE( policy == DSL_MAILER_QUEUE_POLICY_DROP_NEWEST );
+                REQUIRE( dsl_mailer_rate_limit_get(mailer_name.c_str(),
+                    &max_per_minute) == DSL_RESULT_SUCCESS );
+                REQUIRE( max_per_minute == 6 );
+                REQUIRE( dsl_mailer_digest_settings_get(mailer_name.c_str(),
+                    &window, &max_messages) == DSL_RESULT_SUCCESS );
+                REQUIRE( window == 30 );
+                REQUIRE( max_messages == 20 );
+                
+                REQUIRE( dsl_mailer_delete(mailer_name.c_str()) == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "Invalid queue settings are used" ) 
+        {
+            THEN( "The settings are rejected" ) 
+            {
+                REQUIRE( dsl_mailer_queue_settings_set(mailer_name.c_str(),
+                    0, DSL_MAILER_QUEUE_POLICY_DROP_NEWEST) == 
+                        DSL_RESULT_MAILER_PARAMETER_INVALID );
+                REQUIRE( dsl_mailer_queue_settings_set(mailer_name.c_str(),
+                    10, DSL_MAILER_QUEUE_POLICY_DROP_NEWEST+1) == 
+                        DSL_RESULT_MAILER_PARAMETER_INVALID );
+                
+                REQUIRE( dsl_mailer_delete(mailer_name.c_str()) == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
 SCENARIO( "The SMTP API checks for NULL input parameters", "[mailer-api]" )
 {
     GIVEN( "An empty list of Components" ) 
@@ -154,6 +226,29 @@ SCENARIO( "The SMTP API checks for NULL input parameters", "[mailer-api]" )
                     NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_mailer_credentials_set(mailer_name.c_str(),username.c_str(), 
                     NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_mailer_queue_settings_get(NULL, NULL,
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_mailer_queue_settings_get(mailer_name.c_str(), NULL,
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_mailer_queue_settings_set(NULL, 1,
+                    1) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_mailer_rate_limit_get(NULL, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_mailer_rate_limit_get(mailer_name.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_mailer_rate_limit_set(NULL, 
+                    1) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_mailer_digest_settings_get(NULL, NULL,
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_mailer_digest_settings_get(mailer_name.c_str(), NULL,
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_mailer_digest_settings_set(NULL, 1,
+                    1) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_mailer_stats_get(NULL, NULL, NULL,
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_mailer_stats_get(mailer_name.c_str(), NULL, NULL,
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
             }
         }
     }
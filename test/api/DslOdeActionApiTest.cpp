@@ -1122,6 +1122,87 @@ SCENARIO( "A new MOT Challenge File ODE Action can be created and deleted", "[od
     }
 }
 
+SCENARIO( "A new Binary File ODE Action can be created and deleted", "[ode-action-api]" )
+{
+    GIVEN( "Attributes for a new File ODE Action" ) 
+    {
+        std::wstring action_name(L"file-action");
+        std::wstring file_path(L"./file-action.bin");
+        uint mode(DSL_WRITE_MODE_TRUNCATE);
+        uint format(DSL_EVENT_FILE_FORMAT_BINARY);
+        boolean force_flush(false);
+
+        WHEN( "A new File Action is created" ) 
+        {
+            REQUIRE( dsl_ode_action_file_new(action_name.c_str(),
+                file_path.c_str(), mode, format, force_flush) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The File Action can be deleted" ) 
+            {
+                REQUIRE( dsl_ode_action_delete(action_name.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A File ODE Action's rotation settings can be updated", "[ode-action-api]" )
+{
+    GIVEN( "A new File ODE Action" ) 
+    {
+        std::wstring action_name(L"file-action");
+        std::wstring file_path(L"./file-action.csv");
+        uint mode(DSL_WRITE_MODE_TRUNCATE);
+        uint format(DSL_EVENT_FILE_FORMAT_CSV);
+        boolean force_flush(false);
+
+        REQUIRE( dsl_ode_action_file_new(action_name.c_str(),
+            file_path.c_str(), mode, format, force_flush) == DSL_RESULT_SUCCESS );
+
+        uint ret_max_size(99), ret_max_duration(99);
+        REQUIRE( dsl_ode_action_file_rotation_get(action_name.c_str(),
+            &ret_max_size, &ret_max_duration) == DSL_RESULT_SUCCESS );
+        REQUIRE( ret_max_size == 0 );
+        REQUIRE( ret_max_duration == 0 );
+
+        WHEN( "The File Action's rotation settings are set" ) 
+        {
+            uint new_max_size(1024*1024), new_max_duration(3600);
+            
+            REQUIRE( dsl_ode_action_file_rotation_set(action_name.c_str(),
+                new_max_size, new_max_duration) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct values are returned on get" ) 
+            {
+                REQUIRE( dsl_ode_action_file_rotation_get(action_name.c_str(),
+                    &ret_max_size, &ret_max_duration) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_max_size == new_max_size );
+                REQUIRE( ret_max_duration == new_max_duration );
+
+                REQUIRE( dsl_ode_action_delete(action_name.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+            }
+        }
+        WHEN( "The rotation services are called with a non File Action" ) 
+        {
+            std::wstring log_action_name(L"log-action");
+            REQUIRE( dsl_ode_action_log_new(log_action_name.c_str()) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The services fail with the correct result" ) 
+            {
+                REQUIRE( dsl_ode_action_file_rotation_get(log_action_name.c_str(),
+                    &ret_max_size, &ret_max_duration) == 
+                        DSL_RESULT_ODE_ACTION_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_ode_action_file_rotation_set(log_action_name.c_str(),
+                    0, 0) == DSL_RESULT_ODE_ACTION_NOT_THE_CORRECT_TYPE );
+
+                REQUIRE( dsl_ode_action_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+            }
+        }
+    }
+}
+
 SCENARIO( "Parameters for a new File ODE Action are checked on construction", "[ode-action-api]" )
 {
     GIVEN( "Attributes for a new File ODE Action" ) 
@@ -1146,7 +1227,7 @@ SCENARIO( "Parameters for a new File ODE Action are checked on construction", "[
         WHEN( "The format parameter is out of range" ) 
         {
             uint mode(DSL_WRITE_MODE_TRUNCATE);
-            uint format(DSL_EVENT_FILE_FORMAT_MOTC+1);
+            uint format(DSL_EVENT_FILE_FORMAT_BINARY+1);
             
             THEN( "The File Action fails to create" ) 
             {
@@ -1998,6 +2079,12 @@ SCENARIO( "The ODE Action API checks for NULL input parameters", "[ode-action-ap
                     DSL_EVENT_FILE_FORMAT_TEXT, false) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_action_file_new(action_name.c_str(), NULL, DSL_WRITE_MODE_APPEND,
                     DSL_EVENT_FILE_FORMAT_TEXT, false) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_file_rotation_get(NULL, 
+                    NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_file_rotation_get(action_name.c_str(), 
+                    NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_file_rotation_set(NULL, 
+                    0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_ode_action_fill_frame_new(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_action_fill_frame_new(action_name.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
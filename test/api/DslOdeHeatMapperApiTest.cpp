@@ -144,6 +144,46 @@ SCENARIO( "A new Heat-Mapper can handle calls to its Metrics services",
     }
 }    
 
+SCENARIO( "A new Heat-Mapper can update its Decay Half-Life correctly", 
+    "[ode-heat-mapper-api]" )
+{
+    GIVEN( "A new Heat-Mapper" ) 
+    {
+        REQUIRE( dsl_display_type_rgba_color_palette_predefined_new(
+            color_palette_name.c_str(), DSL_COLOR_PREDEFINED_PALETTE_SPECTRAL, 
+            0.5) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_ode_heat_mapper_new(ode_heat_mapper_name.c_str(),
+            16, 9, DSL_BBOX_POINT_SOUTH, color_palette_name.c_str()) == 
+                DSL_RESULT_SUCCESS );
+
+        uint retHalfLife(99);
+        REQUIRE( dsl_ode_heat_mapper_decay_half_life_get(
+            ode_heat_mapper_name.c_str(), &retHalfLife) == DSL_RESULT_SUCCESS );
+        REQUIRE( retHalfLife == 0 );
+
+        WHEN( "When the Heat-Mapper's Decay Half-Life is set" )
+        {
+            uint newHalfLife(300);
+            
+            REQUIRE( dsl_ode_heat_mapper_decay_half_life_set(
+                ode_heat_mapper_name.c_str(), newHalfLife) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct value is returned on get" ) 
+            {
+                REQUIRE( dsl_ode_heat_mapper_decay_half_life_get(
+                    ode_heat_mapper_name.c_str(), &retHalfLife) == DSL_RESULT_SUCCESS );
+                REQUIRE( retHalfLife == newHalfLife );
+                
+                REQUIRE( dsl_ode_heat_mapper_delete(ode_heat_mapper_name.c_str()) == 
+                    DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_display_type_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_heat_mapper_list_size() == 0 );
+            }
+        }
+    }
+}    
+
 SCENARIO( "The ODE Heat-Mapper API checks for NULL input parameters", "[ode-heat-mapper-api]" )
 {
     GIVEN( "An empty list of Components" ) 
@@ -176,6 +216,13 @@ SCENARIO( "The ODE Heat-Mapper API checks for NULL input parameters", "[ode-heat
                 REQUIRE( dsl_ode_heat_mapper_legend_settings_get(NULL, 
                     0, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
                     
+                REQUIRE( dsl_ode_heat_mapper_decay_half_life_get(NULL, 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_heat_mapper_decay_half_life_get(
+                    ode_heat_mapper_name.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_heat_mapper_decay_half_life_set(NULL, 
+                    0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                    
                 REQUIRE( dsl_ode_heat_mapper_metrics_get(ode_heat_mapper_name.c_str(), 
                     NULL, NULL ) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_heat_mapper_metrics_get(NULL,
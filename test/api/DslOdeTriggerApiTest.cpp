@@ -381,6 +381,95 @@ SCENARIO( "An ODE Trigger's classId can be set/get", "[ode-trigger-api]" )
     }
 }    
 
+SCENARIO( "An ODE Trigger's source-set can be updated", "[ode-trigger-api]" )
+{
+    GIVEN( "An ODE Trigger" ) 
+    {
+        std::wstring odeTriggerName(L"occurrence");
+        
+        uint class_id(9);
+        uint limit(0);
+
+        REQUIRE( dsl_ode_trigger_occurrence_new(odeTriggerName.c_str(), 
+            NULL, class_id, limit) == DSL_RESULT_SUCCESS );
+
+        WHEN( "When Sources are added to the Trigger's source-set" )         
+        {
+            const wchar_t* sources[] = {L"source-1", L"source-2", NULL};
+            REQUIRE( dsl_ode_trigger_sources_add_many(odeTriggerName.c_str(), 
+                sources) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The Sources can be removed" ) 
+            {
+                // second call must fail
+                REQUIRE( dsl_ode_trigger_sources_add(odeTriggerName.c_str(), 
+                    L"source-1") == DSL_RESULT_ODE_TRIGGER_SET_FAILED );
+                REQUIRE( dsl_ode_trigger_sources_remove(odeTriggerName.c_str(), 
+                    L"source-1") == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_sources_remove(odeTriggerName.c_str(), 
+                    L"source-1") == DSL_RESULT_ODE_TRIGGER_SET_FAILED );
+                REQUIRE( dsl_ode_trigger_sources_remove_all(
+                    odeTriggerName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
+SCENARIO( "An ODE Trigger's class-set can be set/get", "[ode-trigger-api]" )
+{
+    GIVEN( "An ODE Trigger" ) 
+    {
+        std::wstring odeTriggerName(L"occurrence");
+        
+        uint limit(0);
+
+        REQUIRE( dsl_ode_trigger_occurrence_new(odeTriggerName.c_str(), 
+            NULL, DSL_ODE_ANY_CLASS, limit) == DSL_RESULT_SUCCESS );
+
+        uint ret_class_ids[4] = {0};
+        uint ret_size(4);
+        REQUIRE( dsl_ode_trigger_class_ids_get(odeTriggerName.c_str(), 
+            ret_class_ids, &ret_size) == DSL_RESULT_SUCCESS );
+        REQUIRE( ret_size == 0 );
+
+        WHEN( "When the Trigger's class-set is updated" )         
+        {
+            uint class_ids[] = {5, 1, 3};
+            REQUIRE( dsl_ode_trigger_class_ids_set(odeTriggerName.c_str(), 
+                class_ids, 3) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct values are returned on get" ) 
+            {
+                ret_size = 4;
+                REQUIRE( dsl_ode_trigger_class_ids_get(odeTriggerName.c_str(), 
+                    ret_class_ids, &ret_size) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_size == 3 );
+                REQUIRE( ret_class_ids[0] == 1 );
+                REQUIRE( ret_class_ids[1] == 3 );
+                REQUIRE( ret_class_ids[2] == 5 );
+                
+                ret_size = 2;
+                REQUIRE( dsl_ode_trigger_class_ids_get(odeTriggerName.c_str(), 
+                    ret_class_ids, &ret_size) == 
+                    DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "When a class_id is out of range" )         
+        {
+            uint class_ids[] = {1, 1024};
+            
+            THEN( "The class-set update fails" ) 
+            {
+                REQUIRE( dsl_ode_trigger_class_ids_set(odeTriggerName.c_str(), 
+                    class_ids, 2) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
 SCENARIO( "An ODE Trigger's event limit can be set/get", "[ode-trigger-api]" )
 {
     GIVEN( "An ODE Trigger" ) 
@@ -1927,6 +2016,17 @@ SCENARIO( "The ODE Trigger API checks for NULL input parameters", "[ode-trigger-
                 REQUIRE( dsl_ode_trigger_infer_done_only_get(NULL, &infer_done) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_infer_done_only_set(NULL, infer_done) == DSL_RESULT_INVALID_INPUT_PARAM );
 
+                REQUIRE( dsl_ode_trigger_sources_add(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_sources_add(triggerName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_sources_add_many(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_sources_add_many(triggerName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_sources_remove(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_sources_remove(triggerName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_sources_remove_all(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_class_ids_get(NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_class_ids_set(NULL, NULL, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_class_ids_set(triggerName.c_str(), NULL, 1) == DSL_RESULT_INVALID_INPUT_PARAM );
+
                 REQUIRE( dsl_ode_trigger_action_add(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_action_add(triggerName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_action_add_many(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
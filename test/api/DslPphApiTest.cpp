@@ -24,6 +24,7 @@ THE SOFTWARE.
 
 #include "catch.hpp"
 #include "DslApi.h"
+#include "DslShmExport.h"
 
 SCENARIO( "The PPH container is updated correctly on new PPH", "[pph-api]" )
 {
@@ -182,6 +183,39 @@ void buffer_timeout_handler_cb(uint timeout, void* client_data)
     
 }
 
+SCENARIO( "A new ODE Handler's Parallel Frames setting can be updated", "[pph-api]" )
+{
+    GIVEN( "A new ODE Handler with parallel frames disabled by default" ) 
+    {
+        std::wstring odePphName(L"pph");
+
+        REQUIRE( dsl_pph_ode_new(odePphName.c_str()) == DSL_RESULT_SUCCESS );
+
+        uint workers(99);
+        REQUIRE( dsl_pph_ode_parallel_frames_get(odePphName.c_str(), 
+            &workers) == DSL_RESULT_SUCCESS );
+        REQUIRE( workers == 0 );
+
+        WHEN( "The number of workers is updated" ) 
+        {
+            REQUIRE( dsl_pph_ode_parallel_frames_set(odePphName.c_str(), 
+                4) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct value is returned on get" ) 
+            {
+                REQUIRE( dsl_pph_ode_parallel_frames_get(odePphName.c_str(), 
+                    &workers) == DSL_RESULT_SUCCESS );
+                REQUIRE( workers == 4 );
+
+                // disable again
+                REQUIRE( dsl_pph_ode_parallel_frames_set(odePphName.c_str(), 
+                    0) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
 SCENARIO( "A Buffer Timeout Pad Probe Handler can be created and deleted", "[pph-api]" )
 {
     GIVEN( "Atributes for a new Buffer Timeout Pad Probe Handler" ) 
@@ -302,6 +336,251 @@ SCENARIO( "A Buffer Timeout Handler's Enabled Setting can be disabled and re-ena
     }
 }
 
+SCENARIO( "A Latency Pad Probe Handler can add trace-points to multiple components", "[pph-api]" )
+{
+    GIVEN( "A new Latency Pad Probe Handler, Tiler, and OSD" ) 
+    {
+        std::wstring latency_pph_name(L"latency-pph");
+        std::wstring tiler_name(L"tiler");
+        std::wstring osd_name(L"osd");
+
+        REQUIRE( dsl_pph_latency_new(latency_pph_name.c_str()) == DSL_RESULT_SUCCESS );
+        
+        // second call must fail
+        REQUIRE( dsl_pph_latency_new(latency_pph_name.c_str()) == 
+            DSL_RESULT_PPH_NAME_NOT_UNIQUE );
+
+        REQUIRE( dsl_tiler_new(tiler_name.c_str(), 1280, 720) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_osd_new(osd_name.c_str(), 
+            true, true, true, false) == DSL_RESULT_SUCCESS );
+        
+        uint count(99);
+        REQUIRE( dsl_pph_latency_segment_count_get(latency_pph_name.c_str(), 
+            &count) == DSL_RESULT_SUCCESS );
+        REQUIRE( count == 0 );
+
+        WHEN( "The Handler is added to the Tiler and OSD" ) 
+        {
+            REQUIRE( dsl_tiler_pph_add(tiler_name.c_str(), 
+                latency_pph_name.c_str(), DSL_PAD_SINK) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_osd_pph_add(osd_name.c_str(), 
+                latency_pph_name.c_str(), DSL_PAD_SRC) == DSL_RESULT_SUCCESS );
+            
+            THEN( "One segment is created and can be queried" )
+            {
+                REQUIRE( dsl_pph_latency_segment_count_get(latency_pph_name.c_str(), 
+                    &count) == DSL_RESULT_SUCCESS );
+                REQUIRE( count == 1 );
+                
+                const wchar_t* c_segment_name;
+                REQUIRE( dsl_pph_latency_segment_name_get(latency_pph_name.c_str(), 
+                    0, &c_segment_name) == DSL_RESULT_SUCCESS );
+                std::wstring segment_name(c_segment_name);
+                REQUIRE( segment_name == L"tiler:sink -> osd:src" );
+                
+                dsl_latency_stats stats{0};
+                REQUIRE( dsl_pph_latency_segment_stats_get(latency_pph_name.c_str(), 
+                    0, &stats) == DSL_RESULT_SUCCESS );
+                REQUIRE( stats.count == 0 );
+                REQUIRE( dsl_pph_latency_segment_stats_get(latency_pph_name.c_str(), 
+                    1, &stats) == DSL_RESULT_PPH_LATENCY_SEGMENT_INVALID );
+                REQUIRE( dsl_pph_latency_segment_name_get(latency_pph_name.c_str(), 
+                    1, &c_segment_name) == DSL_RESULT_PPH_LATENCY_SEGMENT_INVALID );
+                REQUIRE( dsl_pph_latency_stats_clear(latency_pph_name.c_str()) == 
+                    DSL_RESULT_SUCCESS );
+
+                // can't delete while in use
+                REQUIRE( dsl_pph_delete(latency_pph_name.c_str()) == 
+                    DSL_RESULT_PPH_IS_IN_USE );
+                
+                REQUIRE( dsl_tiler_pph_remove(tiler_name.c_str(), 
+                    latency_pph_name.c_str(), DSL_PAD_SINK) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_osd_pph_remove(osd_name.c_str(), 
+                    latency_pph_name.c_str(), DSL_PAD_SRC) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pph_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new Shm Export Pad Probe Handler can be created and deleted", "[pph-api]" )
+{
+    GIVEN( "Attributes for a new Shm Export Pad Probe Handler" ) 
+    {
+        std::wstring shm_export_pph_name(L"shm-export-pph");
+        std::wstring shm_name(L"/dsl-pph-api-test");
+
+        REQUIRE( dsl_pph_list_size() == 0 );
+
+        WHEN( "A new Shm Export Pad Probe Handler is created" ) 
+        {
+            REQUIRE( dsl_pph_shm_export_new(shm_export_pph_name.c_str(), 
+                shm_name.c_str(), 1000) == DSL_RESULT_SUCCESS );
+
+            // second call must fail
+            REQUIRE( dsl_pph_shm_export_new(shm_export_pph_name.c_str(), 
+                shm_name.c_str(), 1000) == DSL_RESULT_PPH_NAME_NOT_UNIQUE );
+
+            THEN( "The stats are zero and the Handler can be deleted" )
+            {
+                uint64_t frames(99), records(99);
+                REQUIRE( dsl_pph_shm_export_stats_get(shm_export_pph_name.c_str(), 
+                    &frames, &records) == DSL_RESULT_SUCCESS );
+                REQUIRE( frames == 0 );
+                REQUIRE( records == 0 );
+                
+                REQUIRE( dsl_pph_delete(shm_export_pph_name.c_str()) == 
+                    DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pph_list_size() == 0 );
+            }
+        }
+        WHEN( "The shared-memory name is invalid" ) 
+        {
+            THEN( "The Shm Export Pad Probe Handler fails to create" )
+            {
+                REQUIRE( dsl_pph_shm_export_new(shm_export_pph_name.c_str(), 
+                    L"/invalid/name", 1000) == DSL_RESULT_PPH_SHM_EXPORT_PARAMS_INVALID );
+                REQUIRE( dsl_pph_shm_export_new(shm_export_pph_name.c_str(), 
+                    L"no-leading-slash", 1000) == DSL_RESULT_PPH_SHM_EXPORT_PARAMS_INVALID );
+                REQUIRE( dsl_pph_shm_export_new(shm_export_pph_name.c_str(), 
+                    L"/", 1000) == DSL_RESULT_PPH_SHM_EXPORT_PARAMS_INVALID );
+                REQUIRE( dsl_pph_list_size() == 0 );
+            }
+        }
+        WHEN( "The capacity is out of range" ) 
+        {
+            THEN( "The Shm Export Pad Probe Handler fails to create" )
+            {
+                REQUIRE( dsl_pph_shm_export_new(shm_export_pph_name.c_str(), 
+                    shm_name.c_str(), 0) == DSL_RESULT_PPH_SHM_EXPORT_PARAMS_INVALID );
+                REQUIRE( dsl_pph_shm_export_new(shm_export_pph_name.c_str(), 
+                    shm_name.c_str(), DSL_SHM_EXPORT_MAX_CAPACITY+1) == 
+                    DSL_RESULT_PPH_SHM_EXPORT_PARAMS_INVALID );
+                REQUIRE( dsl_pph_shm_export_new(shm_export_pph_name.c_str(), 
+                    shm_name.c_str(), 0xFFFFFFFF) == 
+                    DSL_RESULT_PPH_SHM_EXPORT_PARAMS_INVALID );
+                REQUIRE( dsl_pph_list_size() == 0 );
+            }
+        }
+        WHEN( "The shared-memory name is in use by another Handler" ) 
+        {
+            REQUIRE( dsl_pph_shm_export_new(shm_export_pph_name.c_str(), 
+                shm_name.c_str(), 1000) == DSL_RESULT_SUCCESS );
+
+            THEN( "A second Shm Export Pad Probe Handler fails to create" )
+            {
+                REQUIRE( dsl_pph_shm_export_new(L"second-shm-export-pph", 
+                    shm_name.c_str(), 1000) == DSL_RESULT_PPH_SHM_EXPORT_NAME_IN_USE );
+                REQUIRE( dsl_pph_list_size() == 1 );
+
+                REQUIRE( dsl_pph_delete(shm_export_pph_name.c_str()) == 
+                    DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pph_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Meta Recorder Pad Probe Handler recording can be replayed by an ODE Handler", 
+    "[pph-api]" )
+{
+    GIVEN( "A new Meta Recorder and ODE Pad Probe Handler" ) 
+    {
+        std::wstring meta_recorder_pph_name(L"meta-recorder-pph");
+        std::wstring ode_pph_name(L"ode-pph");
+        std::wstring file_path(L"./meta-recorder-api-test.dslmeta");
+
+        REQUIRE( dsl_pph_meta_recorder_new(meta_recorder_pph_name.c_str(), 
+            file_path.c_str()) == DSL_RESULT_SUCCESS );
+
+        // second call must fail
+        REQUIRE( dsl_pph_meta_recorder_new(meta_recorder_pph_name.c_str(), 
+            file_path.c_str()) == DSL_RESULT_PPH_NAME_NOT_UNIQUE );
+
+        REQUIRE( dsl_pph_ode_new(ode_pph_name.c_str()) == DSL_RESULT_SUCCESS );
+
+        uint64_t batches(99), dropped(99);
+        REQUIRE( dsl_pph_meta_recorder_stats_get(meta_recorder_pph_name.c_str(), 
+            &batches, &dropped) == DSL_RESULT_SUCCESS );
+        REQUIRE( batches == 0 );
+        REQUIRE( dropped == 0 );
+
+        WHEN( "The Meta Recorder is deleted" ) 
+        {
+            REQUIRE( dsl_pph_delete(meta_recorder_pph_name.c_str()) == 
+                DSL_RESULT_SUCCESS );
+            
+            THEN( "The empty recording can be replayed" )
+            {
+                uint64_t frames(99);
+                REQUIRE( dsl_pph_ode_meta_replay(ode_pph_name.c_str(), 
+                    file_path.c_str(), &frames) == DSL_RESULT_SUCCESS );
+                REQUIRE( frames == 0 );
+                
+                REQUIRE( dsl_pph_ode_meta_replay(ode_pph_name.c_str(), 
+                    L"./does-not-exist.dslmeta", &frames) == 
+                        DSL_RESULT_PPH_META_FILE_INVALID );
+                        
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pph_list_size() == 0 );
+            }
+        }
+    }
+}
+
+static boolean meter_stats_handler_cb(dsl_meter_source_stats* stats, 
+    uint source_count, void* client_data)
+{
+    return true;
+}
+
+SCENARIO( "A Meter PPH's Stall Threshold can be updated", "[pph-api]" )
+{
+    GIVEN( "A new Stats Meter PPH" ) 
+    {
+        std::wstring meterPphName(L"meter-pph");
+
+        REQUIRE( dsl_pph_meter_stats_new(meterPphName.c_str(), 1, 
+            meter_stats_handler_cb, NULL) == DSL_RESULT_SUCCESS );
+
+        uint threshold(0);
+        REQUIRE( dsl_pph_meter_stall_threshold_get(meterPphName.c_str(), 
+            &threshold) == DSL_RESULT_SUCCESS );
+        REQUIRE( threshold == 500 );
+
+        WHEN( "The Stall Threshold is updated" ) 
+        {
+            uint newThreshold(2000);
+            REQUIRE( dsl_pph_meter_stall_threshold_set(meterPphName.c_str(), 
+                newThreshold) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct value is returned on get" )
+            {
+                REQUIRE( dsl_pph_meter_stall_threshold_get(meterPphName.c_str(), 
+                    &threshold) == DSL_RESULT_SUCCESS );
+                REQUIRE( threshold == newThreshold );
+                
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pph_list_size() == 0 );
+            }
+        }
+        WHEN( "A Stats Meter PPH is created with an interval of 0" ) 
+        {
+            THEN( "The create fails" )
+            {
+                REQUIRE( dsl_pph_meter_stats_new(L"other-meter", 0, 
+                    meter_stats_handler_cb, NULL) == DSL_RESULT_PPH_METER_INVALID_INTERVAL );
+                
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pph_list_size() == 0 );
+            }
+        }
+    }
+}
+
 SCENARIO( "The Pad Probe Handler API checks for NULL input parameters", "[pph-api]" )
 {
     GIVEN( "An empty list of Components" ) 
@@ -329,6 +608,9 @@ SCENARIO( "The Pad Probe Handler API checks for NULL input parameters", "[pph-ap
                 REQUIRE( dsl_pph_ode_trigger_remove_many(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_pph_ode_trigger_remove_many(pphName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_pph_ode_trigger_remove_all(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_parallel_frames_get(NULL, &interval) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_parallel_frames_get(pphName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_parallel_frames_set(NULL, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_pph_custom_new(NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_pph_custom_new(pphName.c_str(), NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
@@ -337,6 +619,52 @@ SCENARIO( "The Pad Probe Handler API checks for NULL input parameters", "[pph-ap
 
                 REQUIRE( dsl_pph_meter_interval_get(NULL, &interval) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_pph_meter_interval_set(NULL, interval) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meter_stats_new(NULL, 1, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meter_stats_new(pphName.c_str(), 1, NULL, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meter_stall_threshold_get(NULL, &interval) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meter_stall_threshold_get(pphName.c_str(), NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meter_stall_threshold_set(NULL, interval) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_pph_latency_new(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_latency_segment_count_get(NULL, &interval) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_latency_segment_count_get(pphName.c_str(), NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_latency_segment_name_get(NULL, 0, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_latency_segment_name_get(pphName.c_str(), 0, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_latency_segment_stats_get(NULL, 0, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_latency_segment_stats_get(pphName.c_str(), 0, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_latency_stats_clear(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_pph_shm_export_new(NULL, NULL, 0) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_shm_export_new(pphName.c_str(), NULL, 0) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_shm_export_stats_get(NULL, NULL, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_shm_export_stats_get(pphName.c_str(), NULL, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_pph_meta_recorder_new(NULL, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meta_recorder_new(pphName.c_str(), NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meta_recorder_stats_get(NULL, NULL, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_meta_recorder_stats_get(pphName.c_str(), NULL, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_meta_replay(NULL, NULL, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_meta_replay(pphName.c_str(), NULL, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_pph_buffer_timeout_new(NULL, 1, NULL, NULL) == 
                     DSL_RESULT_INVALID_INPUT_PARAM );
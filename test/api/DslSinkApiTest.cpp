@@ -160,6 +160,113 @@ SCENARIO( "An App Sink can update its data-type setting correctly", "[sink-api]"
     }
 }    
     
+SCENARIO( "A queued App Sink can update its queue settings correctly", "[sink-api]" )
+{
+    GIVEN( "A new queued App Sink Component" ) 
+    {
+        std::wstring sinkName = L"app-sink";
+        
+        REQUIRE( dsl_sink_app_queued_new(sinkName.c_str(), 
+            DSL_SINK_APP_DATA_TYPE_BUFFER, 8, 
+            DSL_SINK_APP_QUEUE_POLICY_DROP_OLDEST) == DSL_RESULT_SUCCESS );
+
+        uint ret_max_size(0), ret_policy(99);
+        REQUIRE( dsl_sink_app_queue_settings_get(sinkName.c_str(), 
+            &ret_max_size, &ret_policy) == DSL_RESULT_SUCCESS );
+        REQUIRE( ret_max_size == 8 );
+        REQUIRE( ret_policy == DSL_SINK_APP_QUEUE_POLICY_DROP_OLDEST );
+
+        WHEN( "The App Sink's queue settings are updated" ) 
+        {
+            REQUIRE( dsl_sink_app_queue_settings_set(sinkName.c_str(), 
+                32, DSL_SINK_APP_QUEUE_POLICY_BLOCK) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct values are returned on get" ) 
+            {
+                REQUIRE( dsl_sink_app_queue_settings_get(sinkName.c_str(), 
+                    &ret_max_size, &ret_policy) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_max_size == 32 );
+                REQUIRE( ret_policy == DSL_SINK_APP_QUEUE_POLICY_BLOCK );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "Invalid queue settings are provided" ) 
+        {
+            THEN( "The set queue settings service must fail" ) 
+            {
+                REQUIRE( dsl_sink_app_queue_settings_set(sinkName.c_str(), 
+                    0, DSL_SINK_APP_QUEUE_POLICY_BLOCK) 
+                        == DSL_RESULT_SINK_SET_FAILED );
+                REQUIRE( dsl_sink_app_queue_settings_set(sinkName.c_str(), 
+                    8, DSL_SINK_APP_QUEUE_POLICY_BLOCK+1) 
+                        == DSL_RESULT_SINK_SET_FAILED );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The empty queue is pulled and the stats are queried" ) 
+        {
+            void* data[4] = {0};
+            uint count(99), depth(99), high_water(99);
+            uint64_t dropped(99);
+            
+            REQUIRE( dsl_sink_app_pull_batch(sinkName.c_str(), 
+                data, 4, &count) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_sink_app_queue_stats_get(sinkName.c_str(), 
+                &depth, &high_water, &dropped) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_sink_app_queue_stats_clear(sinkName.c_str()) 
+                == DSL_RESULT_SUCCESS );
+
+            THEN( "No data and zero counters are returned" ) 
+            {
+                REQUIRE( count == 0 );
+                REQUIRE( depth == 0 );
+                REQUIRE( high_water == 0 );
+                REQUIRE( dropped == 0 );
+                REQUIRE( dsl_sink_app_batch_release(data, count) 
+                    == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
+SCENARIO( "The queue services fail for an App Sink in callback mode", "[sink-api]" )
+{
+    GIVEN( "A new App Sink Component with a client handler" ) 
+    {
+        std::wstring sinkName = L"app-sink";
+        
+        REQUIRE( dsl_sink_app_new(sinkName.c_str(), 
+            DSL_SINK_APP_DATA_TYPE_BUFFER, new_buffer_cb, NULL) 
+                == DSL_RESULT_SUCCESS );
+
+        WHEN( "The queue services are called" ) 
+        {
+            void* data[4] = {0};
+            uint max_size(0), policy(0), count(0), depth(0), high_water(0);
+            uint64_t dropped(0);
+
+            THEN( "All services return DSL_RESULT_SINK_APP_QUEUE_NOT_ENABLED" ) 
+            {
+                REQUIRE( dsl_sink_app_queue_settings_get(sinkName.c_str(), 
+                    &max_size, &policy) 
+                        == DSL_RESULT_SINK_APP_QUEUE_NOT_ENABLED );
+                REQUIRE( dsl_sink_app_queue_settings_set(sinkName.c_str(), 
+                    8, DSL_SINK_APP_QUEUE_POLICY_BLOCK) 
+                        == DSL_RESULT_SINK_APP_QUEUE_NOT_ENABLED );
+                REQUIRE( dsl_sink_app_pull_batch(sinkName.c_str(), 
+                    data, 4, &count) == DSL_RESULT_SINK_APP_QUEUE_NOT_ENABLED );
+                REQUIRE( dsl_sink_app_queue_stats_get(sinkName.c_str(), 
+                    &depth, &high_water, &dropped) 
+                        == DSL_RESULT_SINK_APP_QUEUE_NOT_ENABLED );
+                REQUIRE( dsl_sink_app_queue_stats_clear(sinkName.c_str()) 
+                    == DSL_RESULT_SINK_APP_QUEUE_NOT_ENABLED );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+    
 SCENARIO( "The Components container is updated correctly on new Fake Sink", "[sink-api]" )
 {
     GIVEN( "An empty list of Components" ) 
@@ -1493,6 +1600,26 @@ SCENARIO( "The Sink API checks for NULL input parameters", "[sink-api]" )
                     == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_sink_app_new(sinkName.c_str(), 0, NULL, NULL) 
                     == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_queued_new(NULL, 0, 0, 0) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_queue_settings_get(NULL, NULL, NULL) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_queue_settings_get(sinkName.c_str(), 
+                    NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_queue_settings_set(NULL, 0, 0) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_pull_batch(NULL, NULL, 0, NULL) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_pull_batch(sinkName.c_str(), 
+                    NULL, 0, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_batch_release(NULL, 0) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_queue_stats_get(NULL, 
+                    NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_queue_stats_get(sinkName.c_str(), 
+                    NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_app_queue_stats_clear(NULL) 
+                    == DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_sink_fake_new(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 
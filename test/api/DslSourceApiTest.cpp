@@ -337,12 +337,57 @@ SCENARIO( "An App Source can update its settings correctly", "[source-api]" )
                     &ret_max_bytes) == DSL_RESULT_SUCCESS );
                 REQUIRE( ret_max_bytes == max_bytes ); 
 
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The App Source's min-level-percent setting is set" ) 
+        {
+            uint min_percent(50);
+            REQUIRE( dsl_source_app_min_level_percent_set(source_name.c_str(),
+                min_percent) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct value is returned on get" ) 
+            {
+                uint ret_min_percent(0);
+                REQUIRE( dsl_source_app_min_level_percent_get(source_name.c_str(),
+                    &ret_min_percent) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_min_percent == min_percent ); 
+
+                // percentage must be <= 100
+                REQUIRE( dsl_source_app_min_level_percent_set(source_name.c_str(),
+                    101) == DSL_RESULT_SOURCE_SET_FAILED );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The App Source's buffer-pool-size setting is set" ) 
+        {
+            uint ret_pool_size(99);
+            REQUIRE( dsl_source_app_buffer_pool_size_get(source_name.c_str(),
+                &ret_pool_size) == DSL_RESULT_SUCCESS );
+            REQUIRE( ret_pool_size == 0 ); 
+
+            uint pool_size(8);
+            REQUIRE( dsl_source_app_buffer_pool_size_set(source_name.c_str(),
+                pool_size) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct value is returned on get" ) 
+            {
+                REQUIRE( dsl_source_app_buffer_pool_size_get(source_name.c_str(),
+                    &ret_pool_size) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_pool_size == pool_size ); 
+
                 REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
             }
         }
     }
 }
 
+static void memory_release_cb(void* data, void* client_data)
+{
+    *(uint*)client_data += 1;
+}
+
 SCENARIO( "An App Source can update its buffer-out settings correctly",
     "[source-api]" )
 {
@@ -501,6 +546,27 @@ SCENARIO( "A new App Source fails to push-buffer and EOS when in a unlinked stat
                 REQUIRE( dsl_source_app_buffer_push(source_name.c_str(),
                     (void*)fake_buffer.c_str()) == DSL_RESULT_SOURCE_SET_FAILED );
 
+                // client retains ownership on failure - no release callback
+                uint release_count(0);
+                REQUIRE( dsl_source_app_memory_push(source_name.c_str(),
+                    (void*)fake_buffer.c_str(), fake_buffer.size(), 
+                    memory_release_cb, &release_count) 
+                        == DSL_RESULT_SOURCE_SET_FAILED );
+                REQUIRE( release_count == 0 );
+                
+                // no buffer pool until linked
+                void* buffer(NULL);
+                void* data(NULL);
+                uint size(0);
+                REQUIRE( dsl_source_app_buffer_acquire(source_name.c_str(),
+                    &buffer, &data, &size) 
+                        == DSL_RESULT_SOURCE_BUFFER_ACQUIRE_FAILED );
+                        
+                uint state(99);
+                REQUIRE( dsl_source_app_data_state_get(source_name.c_str(),
+                    &state) == DSL_RESULT_SUCCESS );
+                REQUIRE( state == DSL_SOURCE_APP_DATA_STATE_NEED_DATA );
+
                 // second call must fail
                 REQUIRE( dsl_source_app_eos(source_name.c_str()) 
                     == DSL_RESULT_SOURCE_SET_FAILED );
@@ -1217,6 +1283,34 @@ SCENARIO( "The Source API checks for NULL input parameters", "[source-api]" )
                     NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_source_app_max_level_bytes_set(NULL,
                     0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_min_level_percent_get(NULL,
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_min_level_percent_get(source_name.c_str(),
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_min_level_percent_set(NULL,
+                    0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_data_state_get(NULL,
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_data_state_get(source_name.c_str(),
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_memory_push(NULL,
+                    NULL, 0, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_memory_push(source_name.c_str(),
+                    NULL, 0, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffer_pool_size_get(NULL,
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffer_pool_size_get(source_name.c_str(),
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffer_pool_size_set(NULL,
+                    0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffer_acquire(NULL,
+                    NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffer_acquire(source_name.c_str(),
+                    NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffer_release(NULL,
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_source_app_buffer_release(source_name.c_str(),
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                     
                     
                 REQUIRE( dsl_source_csi_new(NULL, 0, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
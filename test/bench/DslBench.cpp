@@ -0,0 +1,568 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/**
+ * dsl-bench - ODE micro-benchmark driven by synthetic batch meta.
+ *
+ * Runs every metadata-only Trigger, Area, and Action type through an ODE Pad 
+ * Probe Handler and reports the per-object cost, the number of C++ heap 
+ * allocations per frame, and the p50/p99 batch latency. Also drives the 
+ * read-only Services from many threads to measure lock contention, and 
+ * compares a JSON configuration load with the equivalent service calls. Build 
+ * with "make dsl-bench" and run with "./dsl-bench [--sources N] [--objects N] 
+ * [--frames N] [--warmup N] [--threads N] [--filter substring]".
+ */
+
+#include "Dsl.h"
+#include "DslServices.h"
+#include "DslPadProbeHandler.h"
+#include "DslOdeTrigger.h"
+#include "DslOdeArea.h"
+#include "DslOdeAction.h"
+#include "DslSyntheticBatchMeta.h"
+
+using namespace DSL;
+
+// Counts all allocations made with C++ operator new - allocations made by
+// glib/GStreamer (g_malloc) are not included.
+static std::atomic<uint64_t> s_allocationCount(0);
+
+void* operator new(std::size_t size)
+{
+    s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+struct BenchOptions
+{
+    uint sources = 4;
+    uint objects = 20;
+    uint frames = 2000;
+    uint warmup = 100;
+    uint threads = 8;
+    std::string filter;
+};
+
+/**
+ * @brief Runs a single ODE Handler over the synthetic batch meta and prints
+ * one row of results.
+ */
+static void runBenchmark(const BenchOptions& options, const std::string& label,
+    DSL_PPH_ODE_PTR pOdeHandler)
+{
+    if (options.filter.size() and label.find(options.filter) == std::string::npos)
+    {
+        return;
+    }
+    SyntheticBatchMeta batch(options.sources, options.objects, {3, 1, 1},
+        SyntheticBatchMeta::MOTION_LINEAR, 300);
+    
+    GstPadProbeInfo info{};
+    info.data = batch.GetBuffer();
+    
+    for (uint i = 0; i < options.warmup; i++)
+    {
+        batch.NextBatch();
+        pOdeHandler->HandlePadData(&info);
+    }
+    
+    std::vector<double> latencies;
+    latencies.reserve(options.frames);
+    
+    uint64_t allocations(0);
+    for (uint i = 0; i < options.frames; i++)
+    {
+        batch.NextBatch();
+        
+        uint64_t startCount = s_allocationCount.load(std::memory_order_relaxed);
+        auto start = std::chrono::steady_clock::now();
+        
+        pOdeHandler->HandlePadData(&info);
+        
+        std::chrono::duration<double, std::nano> elapsed = 
+            std::chrono::steady_clock::now() - start;
+        allocations += s_allocationCount.load(std::memory_order_relaxed) - startCount;
+        latencies.push_back(elapsed.count());
+    }
+    double total = std::accumulate(latencies.begin(), latencies.end(), 0.0);
+    std::sort(latencies.begin(), latencies.end());
+    
+    double nsPerObject = total / ((double)options.frames*batch.GetObjectsPerBatch());
+    double allocsPerFrame = (double)allocations / 
+        ((double)options.frames*options.sources);
+    
+    std::cout << std::left << std::setw(32) << label << std::right 
+        << std::fixed << std::setprecision(1)
+        << std::setw(12) << nsPerObject
+        << std::setw(12) << allocsPerFrame
+        << std::setw(12) << latencies[latencies.size()/2]/1000
+        << std::setw(12) << latencies[(latencies.size()*99)/100]/1000 << std::endl;
+}
+
+/**
+ * @brief Creates a new ODE Handler with a single Trigger.
+ */
+static DSL_PPH_ODE_PTR newHandler(DSL_ODE_TRIGGER_PTR pTrigger)
+{
+    DSL_PPH_ODE_PTR pOdeHandler = DSL_PPH_ODE_NEW("ode-handler");
+    pOdeHandler->AddChild(pTrigger);
+    return pOdeHandler;
+}
+
+static void runTriggerBenchmarks(const BenchOptions& options)
+{
+    DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW("color", 1.0, 0.0, 0.0, 1.0);
+    DSL_RGBA_LINE_PTR pLine = DSL_RGBA_LINE_NEW("line", 
+        960, 0, 960, 1080, 4, pColor);
+    DSL_ODE_AREA_LINE_PTR pLineArea = DSL_ODE_AREA_LINE_NEW("line-area",
+        pLine, false, DSL_BBOX_POINT_SOUTH);
+    
+    std::vector<std::pair<std::string, DSL_ODE_TRIGGER_PTR>> triggers = {
+        {"trigger-always", DSL_ODE_TRIGGER_ALWAYS_NEW("always", "", 
+            DSL_ODE_PRE_OCCURRENCE_CHECK)},
+        {"trigger-absence", DSL_ODE_TRIGGER_ABSENCE_NEW("absence", "", 
+            0, DSL_ODE_TRIGGER_LIMIT_NONE)},
+        {"trigger-instance", DSL_ODE_TRIGGER_INSTANCE_NEW("instance", "", 
+            0, DSL_ODE_TRIGGER_LIMIT_NONE)},
+        {"trigger-occurrence", DSL_ODE_TRIGGER_OCCURRENCE_NEW("occurrence", "", 
+            0, DSL_ODE_TRIGGER_LIMIT_NONE)},
+        {"trigger-summation", DSL_ODE_TRIGGER_SUMMATION_NEW("summation", "", 
+            0, DSL_ODE_TRIGGER_LIMIT_NONE)},
+        {"trigger-count", DSL_ODE_TRIGGER_COUNT_NEW("count", "", 
+            0, DSL_ODE_TRIGGER_LIMIT_NONE, 1, 100)},
+        {"trigger-smallest", DSL_ODE_TRIGGER_SMALLEST_NEW("smallest", "", 
+            0, DSL_ODE_TRIGGER_LIMIT_NONE)},
+        {"trigger-largest", DSL_ODE_TRIGGER_LARGEST_NEW("largest", "", 
+            0, DSL_ODE_TRIGGER_LIMIT_NONE)},
+        {"trigger-new-low", DSL_ODE_TRIGGER_NEW_LOW_NEW("new-low", "", 
+            0, DSL_ODE_TRIGGER_LIMIT_NONE, 0)},
+        {"trigger-new-high", DSL_ODE_TRIGGER_NEW_HIGH_NEW("new-high", "", 
+            0, DSL_ODE_TRIGGER_LIMIT_NONE, 0)},
+        {"trigger-persistence", DSL_ODE_TRIGGER_PERSISTENCE_NEW("persistence", "", 
+            0, DSL_ODE_TRIGGER_LIMIT_NONE, 1, 100)},
+        {"trigger-latest", DSL_ODE_TRIGGER_LATEST_NEW("latest", "", 
+            0, DSL_ODE_TRIGGER_LIMIT_NONE)},
+        {"trigger-earliest", DSL_ODE_TRIGGER_EARLIEST_NEW("earliest", "", 
+            0, DSL_ODE_TRIGGER_LIMIT_NONE)},
+        {"trigger-distance", DSL_ODE_TRIGGER_DISTANCE_NEW("distance", "", 
+            0, 1, DSL_ODE_TRIGGER_LIMIT_NONE, 0, 200, DSL_BBOX_POINT_SOUTH,
+            DSL_DISTANCE_METHOD_FIXED_PIXELS)},
+        {"trigger-intersection", DSL_ODE_TRIGGER_INTERSECTION_NEW("intersection", "", 
+            0, 1, DSL_ODE_TRIGGER_LIMIT_NONE)}
+    };
+    
+    DSL_ODE_TRIGGER_CROSS_PTR pCrossTrigger = DSL_ODE_TRIGGER_CROSS_NEW("cross", 
+        "", 0, DSL_ODE_TRIGGER_LIMIT_NONE, 2, 30, 
+        DSL_OBJECT_TRACE_TEST_METHOD_END_POINTS, pColor);
+    pCrossTrigger->AddArea(pLineArea);
+    triggers.push_back({"trigger-cross", pCrossTrigger});
+    
+    for (auto const& imap: triggers)
+    {
+        runBenchmark(options, imap.first, newHandler(imap.second));
+    }
+}
+
+static void runAreaBenchmarks(const BenchOptions& options)
+{
+    DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW("color", 1.0, 0.0, 0.0, 1.0);
+    
+    dsl_coordinate polygonCoordinates[] = 
+        {{200,200},{1200,150},{1500,600},{900,1000},{300,800}};
+    DSL_RGBA_POLYGON_PTR pPolygon = DSL_RGBA_POLYGON_NEW("polygon", 
+        polygonCoordinates, 5, 4, pColor);
+    
+    dsl_coordinate multiLineCoordinates[] = 
+        {{100,500},{500,400},{900,600},{1300,400},{1800,500}};
+    DSL_RGBA_MULTI_LINE_PTR pMultiLine = DSL_RGBA_MULTI_LINE_NEW("multi-line", 
+        multiLineCoordinates, 5, 4, pColor);
+        
+    DSL_RGBA_LINE_PTR pLine = DSL_RGBA_LINE_NEW("line", 
+        960, 0, 960, 1080, 4, pColor);
+    
+    std::vector<std::pair<std::string, DSL_ODE_AREA_PTR>> areas = {
+        {"area-inclusion-center", DSL_ODE_AREA_INCLUSION_NEW("inclusion", 
+            pPolygon, false, DSL_BBOX_POINT_CENTER)},
+        {"area-inclusion-any", DSL_ODE_AREA_INCLUSION_NEW("inclusion", 
+            pPolygon, false, DSL_BBOX_POINT_ANY)},
+        {"area-exclusion-center", DSL_ODE_AREA_EXCLUSION_NEW("exclusion", 
+            pPolygon, false, DSL_BBOX_POINT_CENTER)},
+        {"area-line", DSL_ODE_AREA_LINE_NEW("line-area", 
+            pLine, false, DSL_BBOX_POINT_SOUTH)},
+        {"area-multi-line", DSL_ODE_AREA_MULTI_LINE_NEW("multi-line-area", 
+            pMultiLine, false, DSL_BBOX_POINT_SOUTH)}
+    };
+    for (auto const& imap: areas)
+    {
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger = DSL_ODE_TRIGGER_OCCURRENCE_NEW(
+            "occurrence", "", DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE);
+        pTrigger->AddArea(imap.second);
+        runBenchmark(options, imap.first, newHandler(pTrigger));
+    }
+}
+
+static void customHandler(uint64_t event_id, const wchar_t* trigger,
+    void* buffer, void* display_meta, void* frame_meta, void* object_meta, 
+    void* client_data)
+{
+}
+
+static void runActionBenchmarks(const BenchOptions& options)
+{
+    DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW("color", 1.0, 0.0, 0.0, 0.5);
+    DSL_RGBA_FONT_PTR pFont = DSL_RGBA_FONT_NEW("font", "arial", 14, pColor);
+    
+    dsl_coordinate polygonCoordinates[] = 
+        {{200,200},{1200,150},{1500,600},{900,1000},{300,800}};
+    DSL_RGBA_POLYGON_PTR pPolygon = DSL_RGBA_POLYGON_NEW("polygon", 
+        polygonCoordinates, 5, 4, pColor);
+    DSL_ODE_AREA_INCLUSION_PTR pArea = DSL_ODE_AREA_INCLUSION_NEW("inclusion", 
+        pPolygon, false, DSL_BBOX_POINT_CENTER);
+        
+    std::vector<uint> labelContent = {DSL_METRIC_OBJECT_CLASS, 
+        DSL_METRIC_OBJECT_TRACKING_ID, DSL_METRIC_OBJECT_CONFIDENCE_INFERENCE};
+    
+    // File, Capture, Email, and Pipeline/Component actions are excluded - their
+    // cost is dominated by I/O and state changes rather than metadata handling.
+    std::vector<std::pair<std::string, DSL_ODE_ACTION_PTR>> actions = {
+        {"action-fill-frame", DSL_ODE_ACTION_FILL_FRAME_NEW("fill-frame", pColor)},
+        {"action-fill-surroundings", DSL_ODE_ACTION_FILL_SURROUNDINGS_NEW(
+            "fill-surroundings", pColor)},
+        {"action-fill-area", DSL_ODE_ACTION_FILL_AREA_NEW("fill-area", 
+            pArea, pColor)},
+        {"action-bbox-format", DSL_ODE_ACTION_BBOX_FORMAT_NEW("bbox-format",
+            4, pColor, true, pColor)},
+        {"action-bbox-scale", DSL_ODE_ACTION_BBOX_SCALE_NEW("bbox-scale", 120)},
+        {"action-label-customize", DSL_ODE_ACTION_LABEL_CUSTOMIZE_NEW(
+            "label-customize", labelContent)},
+        {"action-label-format", DSL_ODE_ACTION_LABEL_FORMAT_NEW("label-format",
+            pFont, true, pColor)},
+        {"action-label-offset", DSL_ODE_ACTION_LABEL_OFFSET_NEW("label-offset",
+            0, -20)},
+        {"action-display", DSL_ODE_ACTION_DISPLAY_NEW("display", 
+            "Frame: %0  Count: %1", 10, 10, pFont, true, pColor)},
+        {"action-log", DSL_ODE_ACTION_LOG_NEW("log")},
+        {"action-custom", DSL_ODE_ACTION_CUSTOM_NEW("custom", customHandler, NULL)}
+    };
+    for (auto const& imap: actions)
+    {
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger = DSL_ODE_TRIGGER_OCCURRENCE_NEW(
+            "occurrence", "", DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE);
+        pTrigger->AddAction(imap.second);
+        runBenchmark(options, imap.first, newHandler(pTrigger));
+    }
+}
+
+/**
+ * @brief Calls read-only Services from the given number of reader threads,
+ * optionally while a writer thread creates, updates, and deletes Triggers, 
+ * and prints one row of results. Triggers are queried by handle rather than
+ * by name if byHandle is set.
+ */
+static void runContentionBenchmark(const BenchOptions& options, 
+    const std::string& label, bool withWriter, bool byHandle=false)
+{
+    if (options.filter.size() and label.find(options.filter) == std::string::npos)
+    {
+        return;
+    }
+    const uint triggerCount(64);
+    const uint callsPerThread(options.frames*10);
+    
+    std::vector<std::wstring> names;
+    std::vector<DslHandle> handles(triggerCount, DSL_HANDLE_INVALID);
+    for (uint i = 0; i < triggerCount; i++)
+    {
+        names.push_back(L"contention-" + std::to_wstring(i));
+        dsl_ode_trigger_occurrence_new(names.back().c_str(), NULL, 
+            DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE);
+        dsl_ode_trigger_handle_get(names.back().c_str(), &handles[i]);
+    }
+    
+    std::atomic<bool> stopWriter(false);
+    std::thread writer;
+    if (withWriter)
+    {
+        writer = std::thread([&]()
+        {
+            std::wstring churnName(L"contention-churn");
+            while (!stopWriter)
+            {
+                dsl_ode_trigger_occurrence_new(churnName.c_str(), NULL, 
+                    DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE);
+                dsl_ode_trigger_enabled_set(names[0].c_str(), true);
+                dsl_ode_trigger_delete(churnName.c_str());
+            }
+        });
+    }
+    
+    std::vector<std::vector<double>> latencies(options.threads);
+    std::vector<std::thread> readers;
+    
+    auto start = std::chrono::steady_clock::now();
+    for (uint t = 0; t < options.threads; t++)
+    {
+        readers.push_back(std::thread([&, t]()
+        {
+            latencies[t].reserve(callsPerThread);
+            boolean enabled(false);
+            uint limit(0);
+            int sourceId(0);
+            
+            for (uint i = 0; i < callsPerThread; i++)
+            {
+                const wchar_t* name = names[(i + t) % triggerCount].c_str();
+                DslHandle handle = handles[(i + t) % triggerCount];
+                auto callStart = std::chrono::steady_clock::now();
+                
+                switch (i % 3)
+                {
+                case 0 :
+                    if (byHandle)
+                    {
+                        dsl_ode_trigger_enabled_get_h(handle, &enabled);
+                        break;
+                    }
+                    dsl_ode_trigger_enabled_get(name, &enabled);
+                    break;
+                case 1 :
+                    if (byHandle)
+                    {
+                        dsl_ode_trigger_limit_event_get_h(handle, &limit);
+                        break;
+                    }
+                    dsl_ode_trigger_limit_event_get(name, &limit);
+                    break;
+                default :
+                    Services::GetServices()->SourceIdGet(
+                        "contention-source", &sourceId);
+                    break;
+                }
+                std::chrono::duration<double, std::nano> elapsed = 
+                    std::chrono::steady_clock::now() - callStart;
+                latencies[t].push_back(elapsed.count());
+            }
+        }));
+    }
+    for (auto& reader: readers)
+    {
+        reader.join();
+    }
+    std::chrono::duration<double> total = std::chrono::steady_clock::now() - start;
+    
+    if (withWriter)
+    {
+        stopWriter = true;
+        writer.join();
+    }
+    for (uint i = 0; i < triggerCount; i++)
+    {
+        dsl_handle_release(handles[i]);
+        dsl_ode_trigger_delete(names[i].c_str());
+    }
+    
+    std::vector<double> all;
+    for (auto& threadLatencies: latencies)
+    {
+        all.insert(all.end(), threadLatencies.begin(), threadLatencies.end());
+    }
+    std::sort(all.begin(), all.end());
+    
+    std::cout << std::left << std::setw(32) << label << std::right 
+        << std::fixed << std::setprecision(1)
+        << std::setw(12) << all.size()/total.count()/1000
+        << std::setw(12) << options.threads
+        << std::setw(12) << all[all.size()/2]/1000
+        << std::setw(12) << all[(all.size()*99)/100]/1000 << std::endl;
+}
+
+static void runContentionBenchmarks(const BenchOptions& options)
+{
+    std::cout << std::endl << std::left << std::setw(32) << "contention" 
+        << std::right << std::setw(12) << "kcalls/s" << std::setw(12) << "threads"
+        << std::setw(12) << "p50 (us)" << std::setw(12) << "p99 (us)" << std::endl;
+        
+    runContentionBenchmark(options, "services-readers", false);
+    runContentionBenchmark(options, "services-readers-with-writer", true);
+    runContentionBenchmark(options, "services-readers-by-handle", false, true);
+}
+
+/**
+ * @brief Creates the same set of Actions, Triggers, ODE Handler, Sink and 
+ * Pipeline either with one JSON configuration document, or with the 
+ * equivalent sequence of service calls, and prints one row of results.
+ */
+static void runStartupBenchmark(const BenchOptions& options, 
+    const std::string& label, bool byConfig)
+{
+    if (options.filter.size() and label.find(options.filter) == std::string::npos)
+    {
+        return;
+    }
+    const uint triggerCount(1000);
+    const uint iterations(5);
+    
+    std::vector<std::wstring> actionNames, triggerNames;
+    std::wstring actions(L"\"actions\": ["), triggers(L"\"triggers\": [");
+    std::wstring handlerTriggers;
+    for (uint i = 0; i < triggerCount; i++)
+    {
+        actionNames.push_back(L"startup-action-" + std::to_wstring(i));
+        triggerNames.push_back(L"startup-trigger-" + std::to_wstring(i));
+        
+        std::wstring separator((i) ? L"," : L"");
+        actions += separator + L"{\"name\": \"" + actionNames[i] + 
+            L"\", \"type\": \"log\"}";
+        triggers += separator + L"{\"name\": \"" + triggerNames[i] + 
+            L"\", \"type\": \"occurrence\", \"actions\": [\"" + 
+            actionNames[i] + L"\"]}";
+        handlerTriggers += separator + L"\"" + triggerNames[i] + L"\"";
+    }
+    std::wstring config = L"{" + actions + L"], " + triggers + L"], "
+        L"\"pphs\": [{\"name\": \"startup-handler\", \"type\": \"ode\", "
+        L"\"triggers\": [" + handlerTriggers + L"]}], "
+        L"\"components\": [{\"name\": \"startup-sink\", \"type\": \"fake-sink\", "
+        L"\"sink-pphs\": [\"startup-handler\"]}], "
+        L"\"pipelines\": [{\"name\": \"startup-pipeline\", "
+        L"\"components\": [\"startup-sink\"]}]}";
+    
+    std::vector<double> durations;
+    uint calls(0);
+    for (uint n = 0; n < iterations; n++)
+    {
+        calls = 0;
+        auto start = std::chrono::steady_clock::now();
+        
+        if (byConfig)
+        {
+            dsl_config_string_load(config.c_str());
+            calls++;
+        }
+        else
+        {
+            for (uint i = 0; i < triggerCount; i++)
+            {
+                dsl_ode_action_log_new(actionNames[i].c_str());
+                dsl_ode_trigger_occurrence_new(triggerNames[i].c_str(), NULL, 
+                    DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE);
+                dsl_ode_trigger_action_add(triggerNames[i].c_str(), 
+                    actionNames[i].c_str());
+            }
+            dsl_pph_ode_new(L"startup-handler");
+            for (uint i = 0; i < triggerCount; i++)
+            {
+                dsl_pph_ode_trigger_add(L"startup-handler", triggerNames[i].c_str());
+            }
+            dsl_sink_fake_new(L"startup-sink");
+            dsl_sink_pph_add(L"startup-sink", L"startup-handler");
+            dsl_pipeline_new(L"startup-pipeline");
+            dsl_pipeline_component_add(L"startup-pipeline", L"startup-sink");
+            calls += triggerCount*4 + 5;
+        }
+        std::chrono::duration<double, std::milli> elapsed = 
+            std::chrono::steady_clock::now() - start;
+        durations.push_back(elapsed.count());
+        
+        dsl_pipeline_delete_all();
+        dsl_component_delete_all();
+        dsl_pph_delete_all();
+        dsl_ode_trigger_delete_all();
+        dsl_ode_action_delete_all();
+    }
+    std::sort(durations.begin(), durations.end());
+    
+    std::cout << std::left << std::setw(32) << label << std::right 
+        << std::fixed << std::setprecision(1)
+        << std::setw(12) << durations[durations.size()/2]
+        << std::setw(12) << calls
+        << std::setw(12) << triggerCount*2 + 3 << std::endl;
+}
+
+static void runStartupBenchmarks(const BenchOptions& options)
+{
+    std::cout << std::endl << std::left << std::setw(32) << "startup" 
+        << std::right << std::setw(12) << "p50 (ms)" << std::setw(12) << "calls"
+        << std::setw(12) << "objects" << std::endl;
+        
+    runStartupBenchmark(options, "startup-service-calls", false);
+    runStartupBenchmark(options, "startup-config-string", true);
+}
+
+int main(int argc, char** argv)
+{
+    BenchOptions options;
+    
+    for (int i = 1; i < argc-1; i += 2)
+    {
+        std::string option(argv[i]);
+        
+        if (option == "--filter")
+        {
+            options.filter = argv[i+1];
+            continue;
+        }
+        uint value = std::stoul(argv[i+1]);
+        if (option == "--sources") options.sources = std::max(value, 1U);
+        else if (option == "--objects") options.objects = value;
+        else if (option == "--frames") options.frames = std::max(value, 1U);
+        else if (option == "--warmup") options.warmup = value;
+        else if (option == "--threads") options.threads = std::max(value, 1U);
+        else
+        {
+            std::cerr << "unknown option: " << option << std::endl;
+            return 1;
+        }
+    }
+    
+    // initializes GStreamer and the GST Debug category used by all DSL code.
+    Services::GetServices();
+    
+    std::cout << "sources=" << options.sources << " objects/frame=" 
+        << options.objects << " frames=" << options.frames << std::endl << std::endl;
+    std::cout << std::left << std::setw(32) << "benchmark" << std::right
+        << std::setw(12) << "ns/object" << std::setw(12) << "allocs/frame"
+        << std::setw(12) << "p50 (us)" << std::setw(12) << "p99 (us)" << std::endl;
+        
+    runTriggerBenchmarks(options);
+    runAreaBenchmarks(options);
+    runActionBenchmarks(options);
+    runContentionBenchmarks(options);
+    runStartupBenchmarks(options);
+    
+    return 0;
+}
@@ -0,0 +1,146 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslApi.h"
+#include "DslConfigDocument.h"
+
+using namespace DSL;
+
+SCENARIO( "A ConfigDocument parses all sections and member kinds", "[ConfigDocument]" )
+{
+    GIVEN( "A new ConfigDocument" ) 
+    {
+        ConfigDocument document;
+        
+        std::string config(
+            "{"
+            "  \"triggers\": ["
+            "    {\"name\": \"trigger-1\", \"type\": \"occurrence\", \"source\": \"src-1\","
+            "      \"class-id\": 2, \"enabled\": false, \"actions\": [\"a-1\", \"a-2\"]}"
+            "  ],"
+            "  \"pipelines\": ["
+            "    {\"name\": \"pipeline\", \"components\": []}"
+            "  ]"
+            "}");
+
+        WHEN( "A well formed document is parsed" )
+        {
+            REQUIRE( document.Parse(config) == true );
+            
+            THEN( "All items and members are parsed correctly" )
+            {
+                REQUIRE( document.GetItemCount() == 2 );
+                REQUIRE( document.GetSection("actions").size() == 0 );
+                
+                ConfigItem& item = document.GetSection("triggers").front();
+                REQUIRE( item.m_name == "trigger-1" );
+                REQUIRE( item.m_type == "occurrence" );
+                REQUIRE( item.GetString("source") == "src-1" );
+                REQUIRE( item.GetUint("class-id") == 2 );
+                REQUIRE( item.GetBool("enabled", true) == false );
+                REQUIRE( item.GetList("actions").size() == 2 );
+                REQUIRE( item.GetList("actions")[1] == "a-2" );
+                
+                // defaults are returned for members that are not present
+                REQUIRE( item.GetUint("limit", 99) == 99 );
+                REQUIRE( item.GetList("areas").size() == 0 );
+                
+                // pipelines are the only items without a type
+                REQUIRE( document.GetSection("pipelines").front().m_type == "" );
+            }
+        }
+    }
+}
+
+SCENARIO( "A ConfigDocument rejects malformed documents", "[ConfigDocument]" )
+{
+    GIVEN( "A new ConfigDocument" ) 
+    {
+        ConfigDocument document;
+
+        WHEN( "Malformed documents are parsed" )
+        {
+            THEN( "Parse fails in all cases" )
+            {
+                REQUIRE( document.Parse("") == false );
+                REQUIRE( document.Parse("[]") == false );
+                REQUIRE( document.Parse("{\"unknown\": []}") == false );
+                REQUIRE( document.Parse("{\"actions\": {}}") == false );
+                REQUIRE( document.Parse("{\"actions\": [1]}") == false );
+                REQUIRE( document.Parse(
+                    "{\"actions\": [{\"type\": \"log\"}]}") == false );
+                REQUIRE( document.Parse(
+                    "{\"actions\": [{\"name\": \"a\"}]}") == false );
+                REQUIRE( document.Parse(
+                    "{\"actions\": [{\"name\": \"a\", \"type\": \"log\"},"
+                    " {\"name\": \"a\", \"type\": \"log\"}]}") == false );
+                REQUIRE( document.Parse(
+                    "{\"triggers\": [{\"name\": \"t\", \"type\": \"occurrence\","
+                    " \"class-id\": -1}]}") == false );
+                REQUIRE( document.Parse(
+                    "{\"triggers\": [{\"name\": \"t\", \"type\": \"occurrence\","
+                    " \"actions\": [1]}]}") == false );
+                REQUIRE( document.GetItemCount() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A ConfigItem checks its members correctly", "[ConfigDocument]" )
+{
+    GIVEN( "A parsed ConfigItem" ) 
+    {
+        ConfigDocument document;
+        REQUIRE( document.Parse(
+            "{\"areas\": [{\"name\": \"area\", \"type\": \"inclusion\","
+            " \"polygon\": \"p\", \"show\": true}]}") == true );
+        ConfigItem& item = document.GetSection("areas").front();
+
+        WHEN( "The item is checked against sets of allowed members" )
+        {
+            std::vector<ConfigMember> valid = {
+                {"polygon", DSL_CONFIG_MEMBER_STRING, true},
+                {"show", DSL_CONFIG_MEMBER_BOOL, false},
+                {"bbox-test-point", DSL_CONFIG_MEMBER_UINT, false}};
+            std::vector<ConfigMember> wrongKind = {
+                {"polygon", DSL_CONFIG_MEMBER_STRING, true},
+                {"show", DSL_CONFIG_MEMBER_UINT, false}};
+            std::vector<ConfigMember> unknownMember = {
+                {"polygon", DSL_CONFIG_MEMBER_STRING, true}};
+            std::vector<ConfigMember> missingRequired = {
+                {"polygon", DSL_CONFIG_MEMBER_STRING, true},
+                {"show", DSL_CONFIG_MEMBER_BOOL, false},
+                {"color", DSL_CONFIG_MEMBER_STRING, true}};
+            
+            THEN( "Only the valid set of members passes" )
+            {
+                REQUIRE( item.CheckMembers(valid) == true );
+                REQUIRE( item.CheckMembers(wrongKind) == false );
+                REQUIRE( item.CheckMembers(unknownMember) == false );
+                REQUIRE( item.CheckMembers(missingRequired) == false );
+            }
+        }
+    }
+}
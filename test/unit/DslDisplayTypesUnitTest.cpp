@@ -146,7 +146,8 @@ SCENARIO( "A RGBA Font is constructed correctly", "[DisplayTypes]" )
             THEN( "Its member variables are initialized correctly" )
             {
                 REQUIRE( pFont->GetName() == fontName );
-                REQUIRE( pFont->font_name == NULL );
+                REQUIRE( DisplayStringPool::IsPooled(pFont->font_name) == true );
+                REQUIRE( std::string(pFont->font_name) == font );
                 REQUIRE( pFont->m_fontName == font );
                 REQUIRE( pFont->font_size == size );
                 REQUIRE( pFont->font_color.red == red );
@@ -545,3 +546,199 @@ SCENARIO( "A Source Frame Rate Display is constructed correctly", "[DisplayTypes
         }
     }
 }
+
+SCENARIO( "The DisplayMetaAllocator returns an existing Display Meta with free slots", "[DisplayTypes]" )
+{
+    GIVEN( "A Display Meta vector with one partially filled structure" )
+    {
+        NvDsDisplayMeta displayMeta{0};
+        NvDsFrameMeta frameMeta{0};
+        std::vector<NvDsDisplayMeta*> displayMetaData;
+        
+        DisplayMetaAllocator::Reset(displayMetaData, 1);
+        REQUIRE( DisplayMetaAllocator::IsEnabled(displayMetaData) == true );
+        
+        displayMetaData[0] = &displayMeta;
+        displayMeta.num_rects = MAX_ELEMENTS_IN_DISPLAY_META-1;
+        
+        WHEN( "A single rectangle slot is requested" )
+        {
+            THEN( "The existing Display Meta is returned" )
+            {
+                REQUIRE( DisplayMetaAllocator::Get(displayMetaData, &frameMeta,
+                    DisplayMetaAllocator::DISPLAY_META_RECTS) == &displayMeta );
+            }
+        }
+        WHEN( "Two rectangle slots are requested with the maximum size reached" )
+        {
+            THEN( "NULL is returned" )
+            {
+                REQUIRE( DisplayMetaAllocator::Get(displayMetaData, &frameMeta,
+                    DisplayMetaAllocator::DISPLAY_META_RECTS, 2) == NULL );
+            }
+        }
+    }
+    GIVEN( "A Display Meta vector reset with a maximum size of 2" )
+    {
+        std::vector<NvDsDisplayMeta*> displayMetaData;
+        
+        DisplayMetaAllocator::Reset(displayMetaData, 2);
+
+        THEN( "The vector holds one NULL entry for each structure allowed" )
+        {
+            REQUIRE( DisplayMetaAllocator::IsEnabled(displayMetaData) == true );
+            REQUIRE( displayMetaData.size() == 2 );
+            REQUIRE( displayMetaData[0] == NULL );
+            REQUIRE( displayMetaData[1] == NULL );
+        }
+    }
+    GIVEN( "A Display Meta vector reset with a maximum size of 0" )
+    {
+        std::vector<NvDsDisplayMeta*> displayMetaData;
+        
+        DisplayMetaAllocator::Reset(displayMetaData, 0);
+
+        THEN( "Adding display meta is disabled" )
+        {
+            REQUIRE( DisplayMetaAllocator::IsEnabled(displayMetaData) == false );
+        }
+    }
+}
+
+SCENARIO( "The DisplayStringPool interns each unique string once", "[DisplayTypes]" )
+{
+    GIVEN( "A string interned in the pool" )
+    {
+        std::string font("interned-font");
+        
+        const gchar* pInterned = DisplayStringPool::Intern(font);
+        REQUIRE( pInterned != NULL );
+        REQUIRE( DisplayStringPool::IsPooled(pInterned) == true );
+
+        WHEN( "The same string is interned again" )
+        {
+            const gchar* pSecond = DisplayStringPool::Intern(font);
+            
+            THEN( "The same copy is returned" )
+            {
+                REQUIRE( pSecond == pInterned );
+                REQUIRE( std::string(pSecond) == font );
+            }
+        }
+        WHEN( "A string not in the pool is checked" )
+        {
+            THEN( "It is not reported as pooled" )
+            {
+                REQUIRE( DisplayStringPool::IsPooled(font.c_str()) == false );
+            }
+        }
+    }
+}
+
+static uint releaseCount(0);
+static bool releasedTextCleared(false);
+
+// Stands in for the release function DeepStream installs in Display Meta
+static void display_meta_release_cb(gpointer data, gpointer user_data)
+{
+    NvDsDisplayMeta* pDisplayMeta = (NvDsDisplayMeta*)data;
+    
+    releaseCount++;
+    releasedTextCleared = true;
+    for (uint i = 0; i < pDisplayMeta->num_labels; i++)
+    {
+        if (pDisplayMeta->text_params[i].display_text)
+        {
+            releasedTextCleared = false;
+            g_free(pDisplayMeta->text_params[i].display_text);
+        }
+    }
+}
+
+SCENARIO( "The DisplayTextArena reclaims label text when Display Meta is released", 
+    "[DisplayTypes]" )
+{
+    GIVEN( "A Display Meta with a release function" )
+    {
+        NvDsDisplayMeta displayMeta{0};
+        displayMeta.base_meta.release_func = display_meta_release_cb;
+        
+        releaseCount = 0;
+        uint slotsInUse = DisplayTextArena::GetSlotsInUse();
+        
+        WHEN( "Dynamic and interned labels are added" )
+        {
+            std::string longText(MAX_DISPLAY_LEN*2, 'x');
+            const gchar* pInterned = DisplayStringPool::Intern("static-text");
+            
+            displayMeta.text_params[displayMeta.num_labels++].display_text = 
+                DisplayTextArena::Assign(&displayMeta, longText.c_str());
+            displayMeta.text_params[displayMeta.num_labels++].display_text = 
+                DisplayTextArena::Assign(&displayMeta, "static-text", pInterned);
+
+            THEN( "The dynamic text is truncated in an arena slot" )
+            {
+                REQUIRE( DisplayTextArena::GetSlotsInUse() == slotsInUse+1 );
+                REQUIRE( DisplayTextArena::IsArenaOwned(
+                    displayMeta.text_params[0].display_text) == true );
+                REQUIRE( strlen(displayMeta.text_params[0].display_text) == 
+                    MAX_DISPLAY_LEN-1 );
+                REQUIRE( displayMeta.text_params[1].display_text == pInterned );
+                
+                // release the meta as DeepStream would with the batch
+                displayMeta.base_meta.release_func(&displayMeta, NULL);
+                
+                REQUIRE( releaseCount == 1 );
+                REQUIRE( releasedTextCleared == true );
+                REQUIRE( DisplayTextArena::GetSlotsInUse() == slotsInUse );
+            }
+        }
+        WHEN( "A copy of the Display Meta is released after the original" )
+        {
+            displayMeta.text_params[displayMeta.num_labels++].display_text = 
+                DisplayTextArena::Assign(&displayMeta, "dynamic-text");
+                
+            NvDsDisplayMeta copiedMeta = displayMeta;
+            
+            displayMeta.base_meta.release_func(&displayMeta, NULL);
+            copiedMeta.base_meta.release_func(&copiedMeta, NULL);
+
+            THEN( "The second release of the slot is ignored" )
+            {
+                REQUIRE( releaseCount == 2 );
+                REQUIRE( DisplayTextArena::GetSlotsInUse() == slotsInUse );
+                
+                NvDsDisplayMeta nextMeta{0};
+                nextMeta.base_meta.release_func = display_meta_release_cb;
+                
+                gchar* pFirst = DisplayTextArena::Assign(&nextMeta, "first");
+                gchar* pSecond = DisplayTextArena::Assign(&nextMeta, "second");
+                REQUIRE( pFirst != pSecond );
+                REQUIRE( DisplayTextArena::GetSlotsInUse() == slotsInUse+2 );
+                
+                nextMeta.text_params[nextMeta.num_labels++].display_text = pFirst;
+                nextMeta.text_params[nextMeta.num_labels++].display_text = pSecond;
+                nextMeta.base_meta.release_func(&nextMeta, NULL);
+                REQUIRE( DisplayTextArena::GetSlotsInUse() == slotsInUse );
+            }
+        }
+    }
+    GIVEN( "A Display Meta without a release function" )
+    {
+        NvDsDisplayMeta displayMeta{0};
+        uint64_t heapFallbacks = DisplayTextArena::GetHeapFallbacks();
+        
+        WHEN( "A label is added" )
+        {
+            gchar* pText = DisplayTextArena::Assign(&displayMeta, "heap-text");
+            
+            THEN( "The text is copied to the heap" )
+            {
+                REQUIRE( DisplayTextArena::IsArenaOwned(pText) == false );
+                REQUIRE( std::string(pText) == "heap-text" );
+                REQUIRE( DisplayTextArena::GetHeapFallbacks() == heapFallbacks+1 );
+                g_free(pText);
+            }
+        }
+    }
+}
@@ -0,0 +1,124 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslApi.h"
+#include "DslHandleTable.h"
+
+using namespace DSL;
+
+SCENARIO( "A HandleTable acquires and resolves handles correctly", "[HandleTable]" )
+{
+    GIVEN( "A new HandleTable and object" ) 
+    {
+        HandleTable handles;
+        DSL_BASE_PTR pObject = std::shared_ptr<Base>(new Base("object"));
+        
+        REQUIRE( handles.Size() == 0 );
+        
+        WHEN( "A handle is acquired for the object" )
+        {
+            uint64_t handle = handles.Acquire(pObject, DSL_HANDLE_TYPE_ODE_TRIGGER);
+            
+            THEN( "The handle resolves to the object and type" )
+            {
+                uint type(0);
+                REQUIRE( handle != DSL_HANDLE_INVALID );
+                REQUIRE( handles.Resolve(handle, type) == pObject );
+                REQUIRE( type == DSL_HANDLE_TYPE_ODE_TRIGGER );
+                REQUIRE( handles.Size() == 1 );
+                
+                // The same handle is returned for the same object
+                REQUIRE( handles.Acquire(pObject, 
+                    DSL_HANDLE_TYPE_ODE_TRIGGER) == handle );
+                REQUIRE( handles.Size() == 1 );
+                
+                // Unknown handles never resolve
+                REQUIRE( handles.Resolve(DSL_HANDLE_INVALID, type) == nullptr );
+                REQUIRE( handles.Resolve(handle + 1, type) == nullptr );
+            }
+        }
+    }
+}
+
+SCENARIO( "A released handle is never resolved again", "[HandleTable]" )
+{
+    GIVEN( "A HandleTable with a handle for an object" ) 
+    {
+        HandleTable handles;
+        DSL_BASE_PTR pObject = std::shared_ptr<Base>(new Base("object"));
+        
+        uint64_t handle = handles.Acquire(pObject, DSL_HANDLE_TYPE_SINK);
+        
+        WHEN( "The handle is released and the slot is reused" )
+        {
+            REQUIRE( handles.Release(handle) == true );
+            
+            DSL_BASE_PTR pNewObject = std::shared_ptr<Base>(new Base("new-object"));
+            uint64_t newHandle = handles.Acquire(pNewObject, DSL_HANDLE_TYPE_SINK);
+            
+            THEN( "The slot is reused with a new generation" )
+            {
+                uint type(0);
+                REQUIRE( (newHandle & 0xFFFFFFFF) == (handle & 0xFFFFFFFF) );
+                REQUIRE( newHandle != handle );
+                REQUIRE( handles.Resolve(handle, type) == nullptr );
+                REQUIRE( handles.Release(handle) == false );
+                REQUIRE( handles.Resolve(newHandle, type) == pNewObject );
+                REQUIRE( handles.Size() == 1 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A handle is invalidated when its object is deleted", "[HandleTable]" )
+{
+    GIVEN( "A HandleTable with a handle for an object" ) 
+    {
+        HandleTable handles;
+        DSL_BASE_PTR pObject = std::shared_ptr<Base>(new Base("object"));
+        
+        uint64_t handle = handles.Acquire(pObject, DSL_HANDLE_TYPE_PPH);
+        
+        WHEN( "The object is deleted" )
+        {
+            pObject = nullptr;
+            
+            THEN( "The handle no longer resolves and its slot is reclaimed" )
+            {
+                uint type(0);
+                REQUIRE( handles.Resolve(handle, type) == nullptr );
+                REQUIRE( handles.Size() == 0 );
+                
+                DSL_BASE_PTR pNewObject = std::shared_ptr<Base>(new Base("object"));
+                uint64_t newHandle = handles.Acquire(pNewObject, DSL_HANDLE_TYPE_PPH);
+                
+                REQUIRE( newHandle != handle );
+                REQUIRE( (newHandle & 0xFFFFFFFF) == (handle & 0xFFFFFFFF) );
+                REQUIRE( handles.Resolve(handle, type) == nullptr );
+                REQUIRE( handles.Resolve(newHandle, type) == pNewObject );
+            }
+        }
+    }
+}
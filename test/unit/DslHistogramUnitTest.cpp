@@ -0,0 +1,104 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslHistogram.h"
+
+using namespace DSL;
+
+SCENARIO( "A new LogLinearHistogram is empty", "[Histogram]" )
+{
+    GIVEN( "A new LogLinearHistogram" ) 
+    {
+        LogLinearHistogram histogram;
+
+        WHEN( "No values have been recorded" )
+        {
+            THEN( "All statistics are 0" )
+            {
+                REQUIRE( histogram.GetCount() == 0 );
+                REQUIRE( histogram.GetMin() == 0 );
+                REQUIRE( histogram.GetMax() == 0 );
+                REQUIRE( histogram.GetMean() == 0 );
+                REQUIRE( histogram.GetStdDev() == 0 );
+                REQUIRE( histogram.GetPercentile(50) == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A LogLinearHistogram maps values to buckets within 1/16 precision", "[Histogram]" )
+{
+    GIVEN( "A range of values" ) 
+    {
+        WHEN( "Each value is mapped to a bucket and back" )
+        {
+            THEN( "The bucket value is within the expected precision" )
+            {
+                for (uint64_t value = 0; value < 1000000; value += 7)
+                {
+                    uint index = LogLinearHistogram::BucketIndex(value);
+                    uint64_t bucketValue = LogLinearHistogram::BucketValue(index);
+                    
+                    REQUIRE( LogLinearHistogram::BucketIndex(bucketValue) == index );
+                    REQUIRE( std::abs((double)bucketValue - (double)value) 
+                        <= value/16.0 + 1 );
+                }
+                REQUIRE( LogLinearHistogram::BucketIndex(UINT64_MAX) == 
+                    DSL_HISTOGRAM_BUCKET_COUNT - 1 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A LogLinearHistogram calculates statistics correctly", "[Histogram]" )
+{
+    GIVEN( "A new LogLinearHistogram" ) 
+    {
+        LogLinearHistogram histogram;
+
+        WHEN( "The values 1 to 1000 are recorded" )
+        {
+            for (uint64_t value = 1; value <= 1000; value++)
+            {
+                histogram.Record(value);
+            }
+            THEN( "The statistics are within the expected precision" )
+            {
+                REQUIRE( histogram.GetCount() == 1000 );
+                REQUIRE( histogram.GetMin() == 1 );
+                REQUIRE( histogram.GetMax() == 1000 );
+                REQUIRE( histogram.GetMean() == 500.5 );
+                REQUIRE( std::abs(histogram.GetStdDev() - 288.675) < 0.01 );
+                REQUIRE( std::abs((double)histogram.GetPercentile(50) - 500) <= 500/16.0 );
+                REQUIRE( std::abs((double)histogram.GetPercentile(90) - 900) <= 900/16.0 );
+                REQUIRE( histogram.GetPercentile(100) == 1000 );
+                
+                histogram.Reset();
+                REQUIRE( histogram.GetCount() == 0 );
+                REQUIRE( histogram.GetMax() == 0 );
+            }
+        }
+    }
+}
@@ -0,0 +1,243 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslServices.h"
+#include "DslLogSink.h"
+
+using namespace DSL;
+
+/**
+ * @brief Test log function which captures all DSL category messages.
+ */
+struct CapturedLogs
+{
+    GMutex m_mutex;
+    std::vector<std::string> m_messages;
+    std::vector<GThread*> m_threads;
+};
+
+static void captureLogFunction(GstDebugCategory* category, GstDebugLevel level,
+    const gchar* file, const gchar* function, gint line,
+    GObject* object, GstDebugMessage* message, gpointer pCapturedLogs)
+{
+    if (category != GST_CAT_DSL)
+    {
+        return;
+    }
+    CapturedLogs* pLogs = (CapturedLogs*)pCapturedLogs;
+    g_mutex_lock(&pLogs->m_mutex);
+    pLogs->m_messages.push_back(gst_debug_message_get(message));
+    pLogs->m_threads.push_back(g_thread_self());
+    g_mutex_unlock(&pLogs->m_mutex);
+}
+
+SCENARIO( "The LogSink writes queued messages in order when async is enabled", "[LogSink]" )
+{
+    GIVEN( "The DSL category with the INFO level enabled" ) 
+    {
+        // Ensure the DSL category has been initialized.
+        Services::GetServices();
+
+        const wchar_t* cInitialLevel;
+        REQUIRE( dsl_info_log_level_get(&cInitialLevel) == DSL_RESULT_SUCCESS );
+        std::wstring initialLevel(cInitialLevel);
+
+        CapturedLogs capturedLogs;
+        g_mutex_init(&capturedLogs.m_mutex);
+        
+        REQUIRE( dsl_info_log_level_set(L"DSL:4") == DSL_RESULT_SUCCESS );
+        gst_debug_add_log_function(captureLogFunction, &capturedLogs, NULL);
+        
+        WHEN( "Messages are logged with async enabled" ) 
+        {
+            LogSink::GetSink().SetAsyncEnabled(true);
+            REQUIRE( LogSink::GetSink().GetAsyncEnabled() == true );
+            
+            for (uint i = 0; i < 100; i++)
+            {
+                LOG_INFO("async-message-" << i);
+            }
+            LogSink::GetSink().SetAsyncEnabled(false);
+            REQUIRE( LogSink::GetSink().GetAsyncEnabled() == false );
+
+            THEN( "All messages are written, in order, by the writer-thread" )
+            {
+                gst_debug_remove_log_function(captureLogFunction);
+                
+                uint count(0);
+                for (uint i = 0; i < capturedLogs.m_messages.size(); i++)
+                {
+                    std::ostringstream expected;
+                    expected << " : async-message-" << count;
+                    if (capturedLogs.m_messages[i] == expected.str())
+                    {
+                        REQUIRE( capturedLogs.m_threads[i] != g_thread_self() );
+                        count++;
+                    }
+                }
+                REQUIRE( count == 100 );
+                
+                REQUIRE( dsl_info_log_level_set(initialLevel.c_str()) == 
+                    DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "A message is logged for a disabled level" ) 
+        {
+            bool evaluated(false);
+            auto evaluate = [&]() {evaluated = true; return "evaluated";};
+            
+            LOG_DEBUG(evaluate());
+
+            THEN( "The message expression is never evaluated" )
+            {
+                gst_debug_remove_log_function(captureLogFunction);
+                
+                REQUIRE( evaluated == false );
+                
+                REQUIRE( dsl_info_log_level_set(initialLevel.c_str()) == 
+                    DSL_RESULT_SUCCESS );
+            }
+        }
+        g_mutex_clear(&capturedLogs.m_mutex);
+    }
+}
+
+SCENARIO( "The LogSink maintains order when the queue is full or a message is too long", 
+    "[LogSink]" )
+{
+    GIVEN( "The DSL category with the INFO level enabled" ) 
+    {
+        // Ensure the DSL category has been initialized.
+        Services::GetServices();
+
+        const wchar_t* cInitialLevel;
+        REQUIRE( dsl_info_log_level_get(&cInitialLevel) == DSL_RESULT_SUCCESS );
+        std::wstring initialLevel(cInitialLevel);
+
+        CapturedLogs capturedLogs;
+        g_mutex_init(&capturedLogs.m_mutex);
+        
+        REQUIRE( dsl_info_log_level_set(L"DSL:4") == DSL_RESULT_SUCCESS );
+        gst_debug_add_log_function(captureLogFunction, &capturedLogs, NULL);
+        
+        WHEN( "More messages than queue records, some too long, are logged" ) 
+        {
+            uint numMessages(DSL_LOG_SINK_QUEUE_SIZE*4);
+            std::string longSuffix(DSL_LOG_RECORD_MESSAGE_SIZE, 'x');
+            
+            LogSink::GetSink().SetAsyncEnabled(true);
+            for (uint i = 0; i < numMessages; i++)
+            {
+                LOG_INFO("overflow-message-" << i << ((i%100) ? "" : longSuffix));
+            }
+            LogSink::GetSink().SetAsyncEnabled(false);
+
+            THEN( "All messages are written in order" )
+            {
+                gst_debug_remove_log_function(captureLogFunction);
+                
+                uint count(0);
+                for (uint i = 0; i < capturedLogs.m_messages.size(); i++)
+                {
+                    std::ostringstream expected;
+                    expected << " : overflow-message-" << count 
+                        << ((count%100) ? "" : longSuffix);
+                    if (capturedLogs.m_messages[i] == expected.str())
+                    {
+                        count++;
+                    }
+                }
+                REQUIRE( count == numMessages );
+                
+                REQUIRE( dsl_info_log_level_set(initialLevel.c_str()) == 
+                    DSL_RESULT_SUCCESS );
+            }
+        }
+        g_mutex_clear(&capturedLogs.m_mutex);
+    }
+}
+
+// Benchmarks are hidden by default. Run with: ./dsl-test-app.exe "[benchmark]"
+
+static const uint logBenchmarkIterations(100000);
+
+/**
+ * @brief Times a cheap API call, with LOG_FUNC and LOG_INFO statements,
+ * and prints the mean overhead per call.
+ */
+static void runLogBenchmark(const std::string& label)
+{
+    boolean enabled(false);
+    
+    auto start = std::chrono::steady_clock::now();
+    for (uint i = 0; i < logBenchmarkIterations; i++)
+    {
+        dsl_info_log_async_enabled_get(&enabled);
+    }
+    std::chrono::duration<double, std::nano> elapsed = 
+        std::chrono::steady_clock::now() - start;
+        
+    std::cout << std::left << std::setw(40) << label 
+        << std::right << std::setw(10) << std::fixed << std::setprecision(1)
+        << elapsed.count()/logBenchmarkIterations << " ns/call" << std::endl;
+}
+
+SCENARIO( "API call overhead with logging off, on, and async", "[.][benchmark][LogSink]" )
+{
+    GIVEN( "The current log level and a log file" ) 
+    {
+        const wchar_t* cInitialLevel;
+        REQUIRE( dsl_info_log_level_get(&cInitialLevel) == DSL_RESULT_SUCCESS );
+        std::wstring initialLevel(cInitialLevel);
+        
+        WHEN( "The API is called with each log setting" )
+        {
+            THEN( "The overhead for each is reported" )
+            {
+                std::cout << std::endl;
+                REQUIRE( dsl_info_log_level_set(L"0") == DSL_RESULT_SUCCESS );
+                runLogBenchmark("logging off");
+
+                REQUIRE( dsl_info_log_level_set(L"DSL:2") == DSL_RESULT_SUCCESS );
+                runLogBenchmark("logging on, level disabled");
+                
+                REQUIRE( dsl_info_log_file_set(L"/tmp/.dsl/log-benchmark",
+                    DSL_WRITE_MODE_TRUNCATE) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_info_log_level_set(L"DSL:5") == DSL_RESULT_SUCCESS );
+                runLogBenchmark("logging on, synchronous");
+
+                REQUIRE( dsl_info_log_async_enabled_set(true) == DSL_RESULT_SUCCESS );
+                runLogBenchmark("logging on, async");
+                REQUIRE( dsl_info_log_async_enabled_set(false) == DSL_RESULT_SUCCESS );
+                
+                REQUIRE( dsl_info_log_level_set(initialLevel.c_str()) == 
+                    DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_info_log_function_restore() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
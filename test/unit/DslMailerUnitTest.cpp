@@ -134,6 +134,79 @@ SCENARIO( "A new SMTP Message Queue is created correctly", "[Mailer]" )
     }
 }
 
+SCENARIO( "A SMTP Message Queue applies its policy when full", "[Mailer]" )
+{
+    GIVEN( "A new SMTP Message Queue and three messages" ) 
+    {
+        EmailAddress fromAddress("John Henry", "john.henry@example.org");
+        EmailAddresses toAddresses{EmailAddress("Joe Blow", "joe.blow@example.org")};
+        EmailAddresses ccAddresses;
+        std::vector<std::string> body{"this is unique content for line 1 \r\n"};
+        
+        std::shared_ptr<SmtpMessage> pMessage1 = 
+            std::shared_ptr<SmtpMessage>(new SmtpMessage(toAddresses, 
+                fromAddress, ccAddresses, "subject", body, ""));
+        std::shared_ptr<SmtpMessage> pMessage2 = 
+            std::shared_ptr<SmtpMessage>(new SmtpMessage(toAddresses, 
+                fromAddress, ccAddresses, "subject", body, ""));
+        std::shared_ptr<SmtpMessage> pMessage3 = 
+            std::shared_ptr<SmtpMessage>(new SmtpMessage(toAddresses, 
+                fromAddress, ccAddresses, "subject", body, ""));
+
+        SmtpMessageQueue queue(2);
+
+        uint maxSize(0), policy(99);
+        queue.GetSettings(&maxSize, &policy);
+        REQUIRE( maxSize == 2 );
+        REQUIRE( policy == DSL_MAILER_QUEUE_POLICY_DROP_OLDEST );
+        
+        WHEN( "The queue is set to drop the oldest message" )
+        {
+            REQUIRE( queue.Push(pMessage1) == true );
+            REQUIRE( queue.Push(pMessage2) == true );
+            REQUIRE( queue.Push(pMessage3) == true );
+
+            THEN( "The oldest message is dropped" )
+            {
+                REQUIRE( queue.Size() == 2 );
+                REQUIRE( queue.GetDroppedCount() == 1 );
+                REQUIRE( queue.PopFront() == pMessage2 );
+                REQUIRE( queue.PopFront() == pMessage3 );
+            }
+        }
+        WHEN( "The queue is set to drop the newest message" )
+        {
+            queue.SetSettings(2, DSL_MAILER_QUEUE_POLICY_DROP_NEWEST);
+            
+            REQUIRE( queue.Push(pMessage1) == true );
+            REQUIRE( queue.Push(pMessage2) == true );
+            REQUIRE( queue.Push(pMessage3) == false );
+
+            THEN( "The newest message is dropped" )
+            {
+                REQUIRE( queue.Size() == 2 );
+                REQUIRE( queue.GetDroppedCount() == 1 );
+                REQUIRE( queue.PopFront() == pMessage1 );
+                REQUIRE( queue.PopFront() == pMessage2 );
+            }
+        }
+        WHEN( "The queue size is reduced below the number of queued messages" )
+        {
+            REQUIRE( queue.Push(pMessage1) == true );
+            REQUIRE( queue.Push(pMessage2) == true );
+            
+            queue.SetSettings(1, DSL_MAILER_QUEUE_POLICY_DROP_OLDEST);
+
+            THEN( "The oldest messages are dropped" )
+            {
+                REQUIRE( queue.Size() == 1 );
+                REQUIRE( queue.GetDroppedCount() == 1 );
+                REQUIRE( queue.PopFront() == pMessage2 );
+            }
+        }
+    }
+}
+
 
 SCENARIO( "A Mailer Object can set and get all SMTP properties", "[Mailer]" )
 {
@@ -338,8 +411,70 @@ SCENARIO( "A Mailer Object handles a failed SMTP Send because of an invalid serv
             
             THEN( "The Mailer object handles the failure correctly" )
             {
-                REQUIRE( pMailer->SendMessage() == false );
+                uint64_t sent(0), failed(0), dropped(0);
+                
+                // wait for the send thread to complete the transfer
+                for (uint i=0; i<700 and !(sent or failed); i++)
+                {
+                    g_usleep(100000);
+                    pMailer->GetStats(&sent, &failed, &dropped);
+                }
+                REQUIRE( sent == 0 );
+                REQUIRE( failed == 1 );
+                REQUIRE( dropped == 0 );
             }
         }
     }
-}           
\ No newline at end of file
+}           
+
+SCENARIO( "A Mailer Object merges messages with the same subject into a digest", "[Mailer]" )
+{
+    GIVEN( "A new Mailer Object with digests enabled" ) 
+    {
+        std::string userName("john.henry");
+        std::string password("3littlepigs");
+        std::string senderName("John Henry");
+        std::string senderAddress("john.henry@example.org");
+        std::string mailServer("smtp://mail.example.com");
+        std::string toName1("Joe Blow");
+        std::string toAddress1("joe.blow@example.org");
+        
+        std::string subject("this is the subject of the message");
+        std::vector<std::string> body{"this is unique content for line 1 \r\n"};
+        
+        std::string mailerName("mailer");
+
+        DSL_MAILER_PTR pMailer = DSL_MAILER_NEW(mailerName.c_str());
+
+        pMailer->SetCredentials(userName.c_str(), password.c_str());
+        pMailer->SetServerUrl(mailServer.c_str()); 
+        pMailer->SetFromAddress(senderName.c_str(), senderAddress.c_str());
+        pMailer->AddToAddress(toName1.c_str(), toAddress1.c_str());
+        
+        // Limit the queue to one message so that any message queued in
+        // addition to the single digest is counted as dropped.
+        pMailer->SetQueueSettings(1, DSL_MAILER_QUEUE_POLICY_DROP_NEWEST);
+        pMailer->SetRateLimit(1);
+        pMailer->SetDigestSettings(60, 3);
+        
+        uint window(0), maxMessages(0);
+        pMailer->GetDigestSettings(&window, &maxMessages);
+        REQUIRE( window == 60 );
+        REQUIRE( maxMessages == 3 );
+        
+        WHEN( "A burst of messages with the same subject are queued" )
+        {
+            for (uint i=0; i<3; i++)
+            {
+                REQUIRE( pMailer->QueueMessage(subject, body) == true );
+            }
+            
+            THEN( "The messages are merged into a single message" )
+            {
+                uint64_t sent(0), failed(0), dropped(0);
+                pMailer->GetStats(&sent, &failed, &dropped);
+                REQUIRE( dropped == 0 );
+            }
+        }
+    }
+}
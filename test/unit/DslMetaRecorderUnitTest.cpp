@@ -0,0 +1,204 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslMetaRecorder.h"
+#include "DslPadProbeHandler.h"
+#include "DslOdeAction.h"
+#include "DslSyntheticBatchMeta.h"
+
+using namespace DSL;
+
+static uint64_t occurrenceCount(0);
+
+static void ode_occurrence_cb(uint64_t event_id, const wchar_t* trigger,
+    void* buffer, void* display_meta, void* frame_meta, void* object_meta, 
+    void* client_data)
+{
+    occurrenceCount++;
+}
+
+SCENARIO( "A MetaRecordReader reads all batches written by a MetaRecordWriter", 
+    "[MetaRecorder]" )
+{
+    GIVEN( "A synthetic batch with two sources and five objects per frame" ) 
+    {
+        std::string writerName("writer");
+        std::string filePath("./meta-recorder.dslmeta");
+        uint numBatches(100);
+
+        SyntheticBatchMeta syntheticBatch(2, 5, {3, 1}, 
+            SyntheticBatchMeta::MOTION_LINEAR, 10);
+
+        WHEN( "The batches are written before the MetaRecordWriter is deleted" )
+        {
+            {
+                DSL_META_RECORD_WRITER_PTR pWriter = DSL_META_RECORD_WRITER_NEW(
+                    writerName.c_str(), filePath.c_str());
+                    
+                for (uint i = 0; i < numBatches; i++)
+                {
+                    syntheticBatch.NextBatch();
+                    REQUIRE( pWriter->WriteBatch(syntheticBatch.GetBatchMeta()) == true );
+                }
+                uint64_t batches(0), dropped(99);
+                pWriter->GetStats(&batches, &dropped);
+                REQUIRE( batches == numBatches );
+                REQUIRE( dropped == 0 );
+            }
+            THEN( "The MetaRecordReader reads back the same metadata" )
+            {
+                DSL_META_RECORD_READER_PTR pReader = 
+                    DSL_META_RECORD_READER_NEW(filePath.c_str());
+                    
+                uint batchCount(0);
+                while (pReader->ReadBatch())
+                {
+                    batchCount++;
+                }
+                REQUIRE( batchCount == numBatches );
+                REQUIRE( pReader->GetFrameCount() == numBatches*2 );
+                
+                // the last batch read must match the last batch written.
+                NvDsBatchMeta* pBatchMeta = 
+                    gst_buffer_get_nvds_batch_meta(pReader->GetBuffer());
+                REQUIRE( pBatchMeta->num_frames_in_batch == 2 );
+                
+                NvDsMetaList* pReadFrameList = pBatchMeta->frame_meta_list;
+                for (NvDsMetaList* pFrameMetaList = 
+                    syntheticBatch.GetBatchMeta()->frame_meta_list; 
+                    pFrameMetaList; pFrameMetaList = pFrameMetaList->next,
+                    pReadFrameList = pReadFrameList->next)
+                {
+                    NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+                    NvDsFrameMeta* pReadFrameMeta = (NvDsFrameMeta*)(pReadFrameList->data);
+                    
+                    REQUIRE( pReadFrameMeta->source_id == pFrameMeta->source_id );
+                    REQUIRE( pReadFrameMeta->frame_num == pFrameMeta->frame_num );
+                    REQUIRE( pReadFrameMeta->buf_pts == pFrameMeta->buf_pts );
+                    REQUIRE( pReadFrameMeta->source_frame_width == 
+                        pFrameMeta->source_frame_width );
+                    REQUIRE( pReadFrameMeta->num_obj_meta == pFrameMeta->num_obj_meta );
+                    
+                    NvDsMetaList* pReadObjectList = pReadFrameMeta->obj_meta_list;
+                    for (NvDsMetaList* pObjectMetaList = pFrameMeta->obj_meta_list; 
+                        pObjectMetaList; pObjectMetaList = pObjectMetaList->next,
+                        pReadObjectList = pReadObjectList->next)
+                    {
+                        NvDsObjectMeta* pObjectMeta = 
+                            (NvDsObjectMeta*)(pObjectMetaList->data);
+                        NvDsObjectMeta* pReadObjectMeta = 
+                            (NvDsObjectMeta*)(pReadObjectList->data);
+                        REQUIRE( pReadObjectMeta->object_id == pObjectMeta->object_id );
+                        REQUIRE( pReadObjectMeta->class_id == pObjectMeta->class_id );
+                        REQUIRE( pReadObjectMeta->confidence == pObjectMeta->confidence );
+                        REQUIRE( pReadObjectMeta->rect_params.left == 
+                            pObjectMeta->rect_params.left );
+                        REQUIRE( pReadObjectMeta->rect_params.height == 
+                            pObjectMeta->rect_params.height );
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "A MetaRecordReader fails to open an invalid file", "[MetaRecorder]" )
+{
+    GIVEN( "A file that is not a Meta Record file" ) 
+    {
+        std::string filePath("./meta-recorder-invalid.dslmeta");
+        {
+            std::ofstream ostream(filePath);
+            ostream << "not a meta record file\n";
+        }
+        WHEN( "A MetaRecordReader is created for the file" )
+        {
+            THEN( "The constructor throws" )
+            {
+                REQUIRE_THROWS( DSL_META_RECORD_READER_NEW(filePath.c_str()) );
+                REQUIRE_THROWS( DSL_META_RECORD_READER_NEW("./does-not-exist.dslmeta") );
+            }
+        }
+    }
+}
+
+SCENARIO( "A recorded Meta Record file can be replayed through an OdePadProbeHandler", 
+    "[MetaRecorder]" )
+{
+    GIVEN( "A Meta Record file recorded with a MetaRecorderPadProbeHandler" ) 
+    {
+        std::string filePath("./meta-recorder-replay.dslmeta");
+        uint numBatches(50);
+
+        // two sources, five objects per frame, all class 0
+        SyntheticBatchMeta syntheticBatch(2, 5, {1}, 
+            SyntheticBatchMeta::MOTION_LINEAR, 10);
+        
+        GstPadProbeInfo info{};
+        info.data = syntheticBatch.GetBuffer();
+        {
+            DSL_PPH_META_RECORDER_PTR pRecorder = 
+                DSL_PPH_META_RECORDER_NEW("meta-recorder", filePath.c_str());
+                
+            for (uint i = 0; i < numBatches; i++)
+            {
+                syntheticBatch.NextBatch();
+                REQUIRE( pRecorder->HandlePadData(&info) == GST_PAD_PROBE_OK );
+            }
+        }
+        
+        DSL_PPH_ODE_PTR pOdeHandler = DSL_PPH_ODE_NEW("ode-handler");
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOccurrenceTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("occurrence", "", 
+                0, DSL_ODE_TRIGGER_LIMIT_NONE);
+        DSL_ODE_ACTION_CUSTOM_PTR pOdeAction = 
+            DSL_ODE_ACTION_CUSTOM_NEW("custom", ode_occurrence_cb, NULL);
+
+        REQUIRE( pOccurrenceTrigger->AddAction(pOdeAction) == true );
+        REQUIRE( pOdeHandler->AddChild(pOccurrenceTrigger) == true );
+
+        WHEN( "The file is replayed through the OdePadProbeHandler" )
+        {
+            occurrenceCount = 0;
+            
+            DSL_META_RECORD_READER_PTR pReader = 
+                DSL_META_RECORD_READER_NEW(filePath.c_str());
+                
+            GstPadProbeInfo replayInfo{};
+            while (pReader->ReadBatch())
+            {
+                replayInfo.data = pReader->GetBuffer();
+                REQUIRE( pOdeHandler->HandlePadData(&replayInfo) == GST_PAD_PROBE_OK );
+            }
+            
+            THEN( "The Action is invoked for every recorded object" )
+            {
+                REQUIRE( pReader->GetFrameCount() == numBatches*2 );
+                REQUIRE( occurrenceCount == numBatches*10 );
+            }
+        }
+    }
+}
@@ -1168,6 +1168,65 @@ SCENARIO( "A FileOdeAction handles an ODE Occurence correctly", "[OdeAction]" )
     }
 }
 
+SCENARIO( "A Binary FileOdeAction writes Frame events without Object data", "[OdeAction]" )
+{
+    GIVEN( "A new Binary FileOdeAction" ) 
+    {
+        std::string triggerName("first-occurence");
+        std::string source;
+        uint classId(1);
+        uint limit(0);
+        
+        std::string actionName("action");
+        std::string filePath("./event-file.bin");
+        uint mode(DSL_WRITE_MODE_TRUNCATE);
+        bool forceFlush(true);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(triggerName.c_str(), source.c_str(), classId, limit);
+
+        WHEN( "An Object event is followed by a Frame event" )
+        {
+            NvDsFrameMeta frameMeta = {0};
+            NvDsObjectMeta objectMeta = {0};
+            objectMeta.class_id = classId;
+            objectMeta.object_id = 123;
+            objectMeta.rect_params.width = 100;
+            
+            {
+                DSL_ODE_ACTION_FILE_BINARY_PTR pAction = DSL_ODE_ACTION_FILE_BINARY_NEW(
+                    actionName.c_str(), filePath.c_str(), mode, forceFlush);
+                    
+                pAction->HandleOccurrence(pTrigger, NULL, 
+                    displayMetaData, &frameMeta, &objectMeta);
+                pAction->HandleOccurrence(pTrigger, NULL, 
+                    displayMetaData, &frameMeta, NULL);
+            }
+            THEN( "The Frame event record has no Object data" )
+            {
+                std::ifstream istream(filePath, std::ios::binary);
+                
+                char magic[sizeof(DSL_ODE_EVENT_BINARY_MAGIC)];
+                uint32_t version(0), recordSize(0);
+                istream.read(magic, sizeof(magic));
+                istream.read((char*)&version, sizeof(version));
+                istream.read((char*)&recordSize, sizeof(recordSize));
+                
+                OdeEventRecord record;
+                istream.read((char*)&record, sizeof(record));
+                REQUIRE( record.m_hasObject == true );
+                REQUIRE( record.m_trackingId == 123 );
+                
+                istream.read((char*)&record, sizeof(record));
+                REQUIRE( istream.good() );
+                REQUIRE( record.m_hasObject == false );
+                REQUIRE( record.m_trackingId == 0 );
+                REQUIRE( record.m_width == 0 );
+            }
+        }
+    }
+}
+
 SCENARIO( "A MotcOdeAction handles an ODE Occurence correctly", "[OdeAction]" )
 {
     GIVEN( "A new FileOdeAction" ) 
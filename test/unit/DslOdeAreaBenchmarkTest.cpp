@@ -0,0 +1,145 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslOdeArea.h"
+
+using namespace DSL;
+
+// Benchmarks are hidden by default. Run with: ./dsl-test-app.exe "[benchmark]"
+
+static const uint benchmarkIterations(200000);
+
+/**
+ * @brief Emulates the original OdePolygonArea::IsBboxInside implementation,
+ * which built both GEOS Polygons on every call, for a baseline comparison.
+ */
+static bool unpreparedIsBboxInside(DSL_RGBA_POLYGON_PTR pPolygon,
+    const NvOSD_RectParams& bbox, uint bboxTestPoint)
+{
+    if (bboxTestPoint == DSL_BBOX_POINT_ANY)
+    {
+        GeosPolygon testPolygon(bbox);
+        return (((GeosPolygon)*pPolygon).Overlaps(testPolygon) or
+            ((GeosPolygon)*pPolygon).Contains(testPolygon) or
+            testPolygon.Contains((GeosPolygon)*pPolygon));
+    }
+    GeosPoint testPoint(round(bbox.left + bbox.width/2), 
+        round(bbox.top + bbox.height/2));
+    return ((GeosPolygon)*pPolygon).Contains(testPoint);
+}
+
+/**
+ * @brief Runs the test function over a sliding bbox and prints the rate.
+ */
+template <typename T>
+static void runAreaBenchmark(const std::string& label, T testFunction)
+{
+    NvOSD_RectParams bbox{0};
+    bbox.width = 40;
+    bbox.height = 80;
+    
+    uint inside(0);
+    auto start = std::chrono::steady_clock::now();
+    
+    for (uint i = 0; i < benchmarkIterations; i++)
+    {
+        bbox.left = (i*13) % 1880;
+        bbox.top = (i*7) % 1000;
+        if (testFunction(bbox))
+        {
+            inside++;
+        }
+    }
+    std::chrono::duration<double> elapsed = 
+        std::chrono::steady_clock::now() - start;
+        
+    std::cout << std::left << std::setw(48) << label 
+        << std::right << std::setw(14) << std::fixed << std::setprecision(0)
+        << benchmarkIterations/elapsed.count() << " tests/sec  (" 
+        << inside << " inside)" << std::endl;
+}
+
+SCENARIO( "OdePolygonArea IsBboxInside tests per second", "[.][benchmark][OdeArea]" )
+{
+    GIVEN( "A large Polygon typical of a camera's region of interest" ) 
+    {
+        std::string polygonName  = "my-polygon";
+        uint numCoordinates(8);
+        dsl_coordinate coordinates[] = {{120,140},{900,100},{1700,180},
+            {1800,700},{1300,980},{900,640},{500,1000},{100,760}};
+        uint lineWidth(4);
+
+        DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW("custom-color", 
+            0.12, 0.34, 0.56, 0.78);
+        DSL_RGBA_POLYGON_PTR pPolygon = DSL_RGBA_POLYGON_NEW(polygonName.c_str(), 
+            coordinates, numCoordinates, lineWidth, pColor);
+
+        WHEN( "The Polygon is tested with each implementation" )
+        {
+            DSL_ODE_AREA_INCLUSION_PTR pCenterArea = DSL_ODE_AREA_INCLUSION_NEW(
+                "center-area", pPolygon, true, DSL_BBOX_POINT_CENTER);
+            DSL_ODE_AREA_INCLUSION_PTR pAnyArea = DSL_ODE_AREA_INCLUSION_NEW(
+                "any-area", pPolygon, true, DSL_BBOX_POINT_ANY);
+            
+            THEN( "The rates for each are reported" )
+            {
+                std::cout << std::endl;
+                runAreaBenchmark("center-point: unprepared (before)",
+                    [&](const NvOSD_RectParams& bbox)
+                    {return unpreparedIsBboxInside(pPolygon, bbox, 
+                        DSL_BBOX_POINT_CENTER);});
+
+                pCenterArea->SetOccupancyMaskCellSize(0);
+                runAreaBenchmark("center-point: prepared",
+                    [&](const NvOSD_RectParams& bbox)
+                    {return pCenterArea->IsBboxInside(bbox);});
+
+                pCenterArea->SetOccupancyMaskCellSize(
+                    DSL_ODE_AREA_DEFAULT_MASK_CELL_SIZE);
+                runAreaBenchmark("center-point: prepared + mask (after)",
+                    [&](const NvOSD_RectParams& bbox)
+                    {return pCenterArea->IsBboxInside(bbox);});
+
+                runAreaBenchmark("any-point: unprepared (before)",
+                    [&](const NvOSD_RectParams& bbox)
+                    {return unpreparedIsBboxInside(pPolygon, bbox, 
+                        DSL_BBOX_POINT_ANY);});
+
+                pAnyArea->SetOccupancyMaskCellSize(0);
+                runAreaBenchmark("any-point: prepared",
+                    [&](const NvOSD_RectParams& bbox)
+                    {return pAnyArea->IsBboxInside(bbox);});
+
+                pAnyArea->SetOccupancyMaskCellSize(
+                    DSL_ODE_AREA_DEFAULT_MASK_CELL_SIZE);
+                runAreaBenchmark("any-point: prepared + mask (after)",
+                    [&](const NvOSD_RectParams& bbox)
+                    {return pAnyArea->IsBboxInside(bbox);});
+                
+                REQUIRE( true );
+            }
+        }
+    }
+}
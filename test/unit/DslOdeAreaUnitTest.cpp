@@ -1053,3 +1053,65 @@ SCENARIO( "A new OdeExclusionArea is created correctly", "[OdeArea]" )
     }
 }
 
+
+SCENARIO( "An OdeInclusionArea's occupancy mask gives the same results as the Polygon", 
+    "[OdeArea]" )
+{
+    GIVEN( "A new OdeInclusionArea with a concave Polygon" ) 
+    {
+        std::string odeAreaName("ode-inclusion-area");
+        bool show(true);
+
+        std::string polygonName  = "my-polygon";
+        uint numCoordinates(6);
+        dsl_coordinate coordinates[] = {{100,100},{500,120},{520,400},
+            {300,250},{260,450},{110,330}};
+        uint lineWidth(4);
+
+        std::string colorName  = "custom-color";
+        double red(0.12), green(0.34), blue(0.56), alpha(0.78);
+        
+        DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW(colorName.c_str(), 
+            red, green, blue, alpha);
+        DSL_RGBA_POLYGON_PTR pPolygon = DSL_RGBA_POLYGON_NEW(polygonName.c_str(), 
+            coordinates, numCoordinates, lineWidth, pColor);
+
+        WHEN( "The bboxes are tested with and without the occupancy mask" )
+        {
+            DSL_ODE_AREA_INCLUSION_PTR pMaskedArea = DSL_ODE_AREA_INCLUSION_NEW(
+                odeAreaName.c_str(), pPolygon, show, DSL_BBOX_POINT_CENTER);
+            DSL_ODE_AREA_INCLUSION_PTR pUnmaskedArea = DSL_ODE_AREA_INCLUSION_NEW(
+                odeAreaName.c_str(), pPolygon, show, DSL_BBOX_POINT_CENTER);
+            DSL_ODE_AREA_INCLUSION_PTR pMaskedAnyArea = DSL_ODE_AREA_INCLUSION_NEW(
+                odeAreaName.c_str(), pPolygon, show, DSL_BBOX_POINT_ANY);
+            DSL_ODE_AREA_INCLUSION_PTR pUnmaskedAnyArea = DSL_ODE_AREA_INCLUSION_NEW(
+                odeAreaName.c_str(), pPolygon, show, DSL_BBOX_POINT_ANY);
+                
+            REQUIRE( pMaskedArea->GetOccupancyMaskCellSize() == 
+                DSL_ODE_AREA_DEFAULT_MASK_CELL_SIZE );
+            
+            pUnmaskedArea->SetOccupancyMaskCellSize(0);
+            pUnmaskedAnyArea->SetOccupancyMaskCellSize(0);
+
+            THEN( "The results are identical for every bbox" )
+            {
+                NvOSD_RectParams bbox{0};
+                bbox.width = 40;
+                bbox.height = 60;
+                
+                for (uint y = 0; y < 560; y += 7)
+                {
+                    for (uint x = 0; x < 640; x += 7)
+                    {
+                        bbox.left = x;
+                        bbox.top = y;
+                        REQUIRE( pMaskedArea->IsBboxInside(bbox) == 
+                            pUnmaskedArea->IsBboxInside(bbox) );
+                        REQUIRE( pMaskedAnyArea->IsBboxInside(bbox) == 
+                            pUnmaskedAnyArea->IsBboxInside(bbox) );
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,191 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslOdeEventWriter.h"
+
+using namespace DSL;
+
+static uint countLines(const std::string& filePath)
+{
+    std::ifstream istream(filePath);
+    std::string line;
+    uint count(0);
+    while (std::getline(istream, line))
+    {
+        count++;
+    }
+    return count;
+}
+
+static OdeEventRecord newObjectRecord(uint frameNum)
+{
+    OdeEventRecord record{0};
+    g_strlcpy(record.m_triggerName, "trigger", DSL_ODE_EVENT_RECORD_NAME_SIZE);
+    record.m_frameNum = frameNum;
+    record.m_hasObject = true;
+    record.m_classId = 1;
+    record.m_trackingId = 123;
+    record.m_left = 10;
+    record.m_top = 20;
+    record.m_width = 100;
+    record.m_height = 200;
+    return record;
+}
+
+SCENARIO( "An OdeEventWriter writes all queued records on close", "[OdeEventWriter]" )
+{
+    GIVEN( "A new OdeEventWriter in CSV format" ) 
+    {
+        std::string writerName("writer");
+        std::string filePath("./event-writer.csv");
+        uint numRecords(100);
+
+        WHEN( "Records are written before the OdeEventWriter is deleted" )
+        {
+            {
+                DSL_ODE_EVENT_WRITER_PTR pWriter = DSL_ODE_EVENT_WRITER_NEW(
+                    writerName.c_str(), filePath.c_str(), DSL_WRITE_MODE_TRUNCATE, 
+                    DSL_EVENT_FILE_FORMAT_CSV, false);
+                    
+                for (uint i = 0; i < numRecords; i++)
+                {
+                    REQUIRE( pWriter->Write(newObjectRecord(i)) == true );
+                }
+                REQUIRE( pWriter->GetDroppedCount() == 0 );
+            }
+            THEN( "The file contains the header and all records" )
+            {
+                REQUIRE( countLines(filePath) == numRecords+1 );
+            }
+        }
+        WHEN( "The OdeEventWriter is created a second time in APPEND mode" )
+        {
+            {
+                DSL_ODE_EVENT_WRITER_PTR pWriter = DSL_ODE_EVENT_WRITER_NEW(
+                    writerName.c_str(), filePath.c_str(), DSL_WRITE_MODE_TRUNCATE, 
+                    DSL_EVENT_FILE_FORMAT_CSV, false);
+                REQUIRE( pWriter->Write(newObjectRecord(1)) == true );
+            }
+            {
+                DSL_ODE_EVENT_WRITER_PTR pWriter = DSL_ODE_EVENT_WRITER_NEW(
+                    writerName.c_str(), filePath.c_str(), DSL_WRITE_MODE_APPEND, 
+                    DSL_EVENT_FILE_FORMAT_CSV, false);
+                REQUIRE( pWriter->Write(newObjectRecord(2)) == true );
+            }
+            THEN( "The header is only written once" )
+            {
+                REQUIRE( countLines(filePath) == 3 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeEventWriter writes fixed size records in Binary format", "[OdeEventWriter]" )
+{
+    GIVEN( "A new OdeEventWriter in Binary format" ) 
+    {
+        std::string writerName("writer");
+        std::string filePath("./event-writer.bin");
+        uint numRecords(10);
+
+        WHEN( "Records are written before the OdeEventWriter is deleted" )
+        {
+            {
+                DSL_ODE_EVENT_WRITER_PTR pWriter = DSL_ODE_EVENT_WRITER_NEW(
+                    writerName.c_str(), filePath.c_str(), DSL_WRITE_MODE_TRUNCATE, 
+                    DSL_EVENT_FILE_FORMAT_BINARY, true);
+                    
+                for (uint i = 0; i < numRecords; i++)
+                {
+                    REQUIRE( pWriter->Write(newObjectRecord(i)) == true );
+                }
+            }
+            THEN( "The file contains the header and all records" )
+            {
+                std::ifstream istream(filePath, std::ios::binary);
+                
+                char magic[sizeof(DSL_ODE_EVENT_BINARY_MAGIC)];
+                uint32_t version(0), recordSize(0);
+                istream.read(magic, sizeof(magic));
+                istream.read((char*)&version, sizeof(version));
+                istream.read((char*)&recordSize, sizeof(recordSize));
+                
+                REQUIRE( std::string(magic) == DSL_ODE_EVENT_BINARY_MAGIC );
+                REQUIRE( version == DSL_ODE_EVENT_BINARY_VERSION );
+                REQUIRE( recordSize == sizeof(OdeEventRecord) );
+                
+                OdeEventRecord record;
+                for (uint i = 0; i < numRecords; i++)
+                {
+                    istream.read((char*)&record, sizeof(record));
+                    REQUIRE( istream.good() );
+                    REQUIRE( record.m_frameNum == i );
+                    REQUIRE( record.m_trackingId == 123 );
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeEventWriter rotates its file when the max size is reached", "[OdeEventWriter]" )
+{
+    GIVEN( "A new OdeEventWriter with a max file size" ) 
+    {
+        std::string writerName("writer");
+        std::string filePath("./event-writer-rotate.txt");
+        uint maxSize(1024), maxDuration(0);
+
+        DSL_ODE_EVENT_WRITER_PTR pWriter = DSL_ODE_EVENT_WRITER_NEW(
+            writerName.c_str(), filePath.c_str(), DSL_WRITE_MODE_TRUNCATE, 
+            DSL_EVENT_FILE_FORMAT_MOTC, true);
+            
+        uint retMaxSize(99), retMaxDuration(99);
+        pWriter->GetRotation(&retMaxSize, &retMaxDuration);
+        REQUIRE( retMaxSize == 0 );
+        REQUIRE( retMaxDuration == 0 );
+        
+        pWriter->SetRotation(maxSize, maxDuration);
+        pWriter->GetRotation(&retMaxSize, &retMaxDuration);
+        REQUIRE( retMaxSize == maxSize );
+        REQUIRE( retMaxDuration == maxDuration );
+
+        WHEN( "More than the max size is written" )
+        {
+            // MOT Challenge lines are ~40 bytes each
+            for (uint i = 0; i < 100; i++)
+            {
+                REQUIRE( pWriter->Write(newObjectRecord(i)) == true );
+            }
+            // allow the writer thread to wake, write, and rotate.
+            std::this_thread::sleep_for(std::chrono::milliseconds(
+                DSL_ODE_EVENT_WRITER_WAKE_INTERVAL_MS*4));
+
+            THEN( "The current file is smaller than the total written" )
+            {
+                REQUIRE( countLines(filePath) < 100 );
+            }
+        }
+    }
+}
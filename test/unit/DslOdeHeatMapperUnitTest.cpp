@@ -333,3 +333,210 @@ SCENARIO( "A new OdeHeatMapper can File metrics correctly", "[OdeHeatMapper]" )
     }
 }
 
+
+SCENARIO( "A new OdeHeatMapper merges adjacent locations into a single rectangle", 
+    "[OdeHeatMapper]" )
+{
+    GIVEN( "A new HeatMapper with two adjacent occurrences" ) 
+    {
+        std::string colorPaletteName("color-palette");
+        std::string odeHeatMapperName("accumulator");
+        uint cols(16), rows(9);
+        
+        std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>> pColorPalette = 
+            std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>>{
+                new std::vector<DSL_RGBA_COLOR_PTR>};
+        
+        for (auto const& ivec: RgbaPredefinedColor::s_predefinedColorPalettes[
+            DSL_COLOR_PREDEFINED_PALETTE_SPECTRAL])
+        {
+            pColorPalette->push_back(std::shared_ptr<RgbaColor>
+                (new RgbaColor("", ivec)));
+        }
+        
+        DSL_RGBA_COLOR_PALETTE_PTR pPredefinedColorPalette = 
+            DSL_RGBA_COLOR_PALETTE_NEW(colorPaletteName.c_str(), pColorPalette);
+
+        DSL_ODE_HEAT_MAPPER_PTR pOdeHeatMapper = 
+            DSL_ODE_HEAT_MAPPER_NEW(odeHeatMapperName.c_str(), 
+                cols, rows, DSL_BBOX_POINT_SOUTH, pPredefinedColorPalette);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.source_frame_width = DSL_STREAMMUX_DEFAULT_WIDTH;
+        frameMeta.source_frame_height = DSL_STREAMMUX_DEFAULT_HEIGHT;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.rect_params.left = 10;
+        objectMeta.rect_params.top = 10;
+        objectMeta.rect_params.width = 20;
+        objectMeta.rect_params.height = 20;
+        
+        pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta);
+
+        objectMeta.rect_params.left += DSL_STREAMMUX_DEFAULT_WIDTH/cols;
+        
+        pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta);
+        
+        NvDsDisplayMeta displayMeta = {0};
+        std::vector<NvDsDisplayMeta*> displayMetaData;
+        DisplayMetaAllocator::Reset(displayMetaData, 1);
+        displayMetaData[0] = &displayMeta;
+
+        WHEN( "The OdeHeatMapper is called to AddDisplayMeta" )
+        {
+            pOdeHeatMapper->AddDisplayMeta(displayMetaData, &frameMeta);
+
+            THEN( "A single rectangle spanning both locations is added" )
+            {
+                REQUIRE( displayMeta.num_rects == 1 );
+                REQUIRE( displayMeta.rect_params[0].left == 0 );
+                REQUIRE( displayMeta.rect_params[0].width == 
+                    2*(DSL_STREAMMUX_DEFAULT_WIDTH/cols) );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new OdeHeatMapper with decay enabled clears decayed locations", 
+    "[OdeHeatMapper]" )
+{
+    GIVEN( "A new HeatMapper with a Decay Half-Life of one frame" ) 
+    {
+        std::string colorPaletteName("color-palette");
+        std::string odeHeatMapperName("accumulator");
+        uint cols(16), rows(9);
+        
+        std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>> pColorPalette = 
+            std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>>{
+                new std::vector<DSL_RGBA_COLOR_PTR>};
+        
+        for (auto const& ivec: RgbaPredefinedColor::s_predefinedColorPalettes[
+            DSL_COLOR_PREDEFINED_PALETTE_SPECTRAL])
+        {
+            pColorPalette->push_back(std::shared_ptr<RgbaColor>
+                (new RgbaColor("", ivec)));
+        }
+        
+        DSL_RGBA_COLOR_PALETTE_PTR pPredefinedColorPalette = 
+            DSL_RGBA_COLOR_PALETTE_NEW(colorPaletteName.c_str(), pColorPalette);
+
+        DSL_ODE_HEAT_MAPPER_PTR pOdeHeatMapper = 
+            DSL_ODE_HEAT_MAPPER_NEW(odeHeatMapperName.c_str(), 
+                cols, rows, DSL_BBOX_POINT_SOUTH, pPredefinedColorPalette);
+                
+        pOdeHeatMapper->SetDecayHalfLife(1);
+        REQUIRE( pOdeHeatMapper->GetDecayHalfLife() == 1 );
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.source_frame_width = DSL_STREAMMUX_DEFAULT_WIDTH;
+        frameMeta.source_frame_height = DSL_STREAMMUX_DEFAULT_HEIGHT;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.rect_params.left = 10;
+        objectMeta.rect_params.top = 10;
+        objectMeta.rect_params.width = 20;
+        objectMeta.rect_params.height = 20;
+        
+        pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta);
+        
+        NvDsDisplayMeta displayMeta = {0};
+        std::vector<NvDsDisplayMeta*> displayMetaData;
+        DisplayMetaAllocator::Reset(displayMetaData, 1);
+        displayMetaData[0] = &displayMeta;
+
+        WHEN( "Two frames are processed without new occurrences" )
+        {
+            const uint64_t* outBuffer;
+            uint size;
+            
+            pOdeHeatMapper->AddDisplayMeta(displayMetaData, &frameMeta);
+            pOdeHeatMapper->GetMetrics(&outBuffer, &size);
+            REQUIRE( outBuffer[0] == 1 );
+            REQUIRE( displayMeta.num_rects == 1 );
+            
+            displayMeta.num_rects = 0;
+            pOdeHeatMapper->AddDisplayMeta(displayMetaData, &frameMeta);
+            pOdeHeatMapper->GetMetrics(&outBuffer, &size);
+
+            THEN( "The decayed location is cleared" )
+            {
+                REQUIRE( outBuffer[0] == 0 );
+                REQUIRE( displayMeta.num_rects == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeHeatMapper with decay enabled decays once per batch for multiple Sources", 
+    "[OdeHeatMapper]" )
+{
+    GIVEN( "A new HeatMapper with a Decay Half-Life of one frame" ) 
+    {
+        std::string colorPaletteName("color-palette");
+        std::string odeHeatMapperName("accumulator");
+        uint cols(16), rows(9);
+        
+        std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>> pColorPalette = 
+            std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>>{
+                new std::vector<DSL_RGBA_COLOR_PTR>};
+        
+        for (auto const& ivec: RgbaPredefinedColor::s_predefinedColorPalettes[
+            DSL_COLOR_PREDEFINED_PALETTE_SPECTRAL])
+        {
+            pColorPalette->push_back(std::shared_ptr<RgbaColor>
+                (new RgbaColor("", ivec)));
+        }
+        
+        DSL_RGBA_COLOR_PALETTE_PTR pPredefinedColorPalette = 
+            DSL_RGBA_COLOR_PALETTE_NEW(colorPaletteName.c_str(), pColorPalette);
+
+        DSL_ODE_HEAT_MAPPER_PTR pOdeHeatMapper = 
+            DSL_ODE_HEAT_MAPPER_NEW(odeHeatMapperName.c_str(), 
+                cols, rows, DSL_BBOX_POINT_SOUTH, pPredefinedColorPalette);
+                
+        pOdeHeatMapper->SetDecayHalfLife(1);
+
+        NvDsFrameMeta frameMeta0 =  {0};
+        frameMeta0.source_id = 0;
+        frameMeta0.source_frame_width = DSL_STREAMMUX_DEFAULT_WIDTH;
+        frameMeta0.source_frame_height = DSL_STREAMMUX_DEFAULT_HEIGHT;
+
+        NvDsFrameMeta frameMeta1 = frameMeta0;
+        frameMeta1.source_id = 1;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.rect_params.left = 10;
+        objectMeta.rect_params.top = 10;
+        objectMeta.rect_params.width = 20;
+        objectMeta.rect_params.height = 20;
+        
+        NvDsDisplayMeta displayMeta = {0};
+        std::vector<NvDsDisplayMeta*> displayMetaData;
+        DisplayMetaAllocator::Reset(displayMetaData, 1);
+        displayMetaData[0] = &displayMeta;
+
+        // First batch of two Sources, with no occurrences
+        pOdeHeatMapper->AddDisplayMeta(displayMetaData, &frameMeta0);
+        pOdeHeatMapper->AddDisplayMeta(displayMetaData, &frameMeta1);
+        
+        // Two occurrences at the same location
+        pOdeHeatMapper->HandleOccurrence(&frameMeta0, &objectMeta);
+        pOdeHeatMapper->HandleOccurrence(&frameMeta0, &objectMeta);
+
+        WHEN( "One batch of two Sources is processed without new occurrences" )
+        {
+            const uint64_t* outBuffer;
+            uint size;
+            
+            displayMeta.num_rects = 0;
+            pOdeHeatMapper->AddDisplayMeta(displayMetaData, &frameMeta0);
+            pOdeHeatMapper->AddDisplayMeta(displayMetaData, &frameMeta1);
+            pOdeHeatMapper->GetMetrics(&outBuffer, &size);
+
+            THEN( "The location has decayed by one half-life only" )
+            {
+                REQUIRE( outBuffer[0] == 1 );
+            }
+        }
+    }
+}
@@ -352,3 +352,119 @@ SCENARIO( "A TrackedObjects Container manages multiple Tracked Object correctly"
     }
 }
 
+
+SCENARIO( "A TrackedObject's trace is limited to its max history", "[TrackedObject]" )
+{
+    GIVEN( "A new TrackedObject with a small max history" ) 
+    {
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.object_id = 1234; 
+        objectMeta.rect_params.left = 10;
+        objectMeta.rect_params.top = 10;
+
+        uint maxHistory(3);
+        
+        std::shared_ptr<TrackedObject> pTrackedObject = std::shared_ptr<TrackedObject>
+            (new TrackedObject(objectMeta.object_id, 0, 
+                (NvBbox_Coords*)&objectMeta.rect_params, nullptr, maxHistory));
+        
+        WHEN( "The TrackedObject is updated past its max history" )
+        {
+            for (uint i = 2; i <= 5; i++)
+            {
+                objectMeta.rect_params.left = i*10;
+                objectMeta.rect_params.top = i*10;
+                pTrackedObject->Update(i, (NvBbox_Coords*)&objectMeta.rect_params);
+            }
+            THEN( "Only the most recent coordinates are traced" )
+            {
+                REQUIRE( pTrackedObject->BboxTraceSize() == maxHistory );
+                
+                DSL_RGBA_MULTI_LINE_PTR pTrace = 
+                    pTrackedObject->GetTrace(DSL_BBOX_POINT_NORTH_WEST,
+                        DSL_OBJECT_TRACE_TEST_METHOD_ALL_POINTS, 5);
+                    
+                std::vector<dsl_coordinate> expectedTrace = 
+                    {{30,30},{40,40},{50,50}};
+
+                REQUIRE( pTrace->num_coordinates == expectedTrace.size() );
+                for (auto i = 0; i < pTrace->num_coordinates; i++)
+                {
+                    REQUIRE( pTrace->coordinates[i].x == expectedTrace.at(i).x );
+                    REQUIRE( pTrace->coordinates[i].y == expectedTrace.at(i).y );
+                }
+            }
+        }
+        WHEN( "An occurrence is handled" )
+        {
+            objectMeta.rect_params.left = 20;
+            objectMeta.rect_params.top = 20;
+            pTrackedObject->Update(2, (NvBbox_Coords*)&objectMeta.rect_params);
+            
+            pTrackedObject->HandleOccurrence();
+            
+            THEN( "The current trace becomes the previous trace" )
+            {
+                REQUIRE( pTrackedObject->HasPreviousTrace() == true );
+                REQUIRE( pTrackedObject->BboxTraceSize() == 1 );
+                
+                dsl_coordinate coordinate = 
+                    pTrackedObject->GetFirstCoordinate(DSL_BBOX_POINT_NORTH_WEST);
+                REQUIRE( coordinate.x == 20 );
+                REQUIRE( coordinate.y == 20 );
+                
+                DSL_RGBA_MULTI_LINE_PTR pTrace = 
+                    pTrackedObject->GetPreviousTrace(DSL_BBOX_POINT_NORTH_WEST,
+                        DSL_OBJECT_TRACE_TEST_METHOD_ALL_POINTS, 5);
+                REQUIRE( pTrace->num_coordinates == 2 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A TrackedObjects Container grows and purges many Tracked Objects correctly", 
+    "[TrackedObject]" )
+{
+    GIVEN( "A new TrackedObjects container" ) 
+    {
+        NvDsFrameMeta frameMeta =  {0};
+        NvDsObjectMeta objectMeta = {0};
+        
+        uint maxTracePoints(10), numSources(4), numObjects(100);
+
+        std::shared_ptr<TrackedObjects>pTrackedObjectsPerSource = 
+            std::shared_ptr<TrackedObjects>(new TrackedObjects(
+                maxTracePoints));
+
+        for (uint source = 0; source < numSources; source++)
+        {
+            frameMeta.source_id = source;
+            for (uint object = 0; object < numObjects; object++)
+            {
+                frameMeta.frame_num = object % 2;
+                objectMeta.object_id = object;
+                REQUIRE( pTrackedObjectsPerSource->Track(&frameMeta, 
+                    &objectMeta, nullptr) != nullptr );
+            }
+        }
+
+        WHEN( "The objects not in the current frame are purged" )
+        {
+            pTrackedObjectsPerSource->Purge(1);
+            
+            THEN( "Only the objects in the current frame remain tracked" )
+            {
+                for (uint source = 0; source < numSources; source++)
+                {
+                    for (uint object = 0; object < numObjects; object++)
+                    {
+                        REQUIRE( pTrackedObjectsPerSource->IsTracked(source,
+                            object) == (bool)(object % 2) );
+                    }
+                }
+                pTrackedObjectsPerSource->Purge(2);
+                REQUIRE( pTrackedObjectsPerSource->IsEmpty() == true );
+            }
+        }
+    }
+}
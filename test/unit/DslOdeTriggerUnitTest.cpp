@@ -28,6 +28,9 @@ THE SOFTWARE.
 #include "DslOdeArea.h"
 #include "DslServices.h"
 
+#include <thread>
+#include <atomic>
+
 using namespace DSL;
 
 static std::vector<NvDsDisplayMeta*> displayMetaData;
@@ -935,6 +938,280 @@ SCENARIO( "An OdeOccurrenceTrigger checks for Source Name correctly", "[OdeTrigg
     }
 }
 
+SCENARIO( "An OdeOccurrenceTrigger resolves a Source Name registered after first use", 
+    "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger filtering on an unregistered Source name" ) 
+    {
+        std::string odeTriggerName("occurence");
+        uint classId(1);
+        uint limit(0);
+        
+        std::string source("source-late");
+        
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), 
+                source.c_str(), classId, limit);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;  
+        frameMeta.frame_num = 444;
+        frameMeta.ntp_timestamp = INT64_MAX;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId; // must match ODE Trigger's classId
+        objectMeta.object_id = INT64_MAX; 
+        objectMeta.rect_params.width = 200;
+        objectMeta.rect_params.height = 100;
+        objectMeta.confidence = 0.9999; 
+        
+        // first use with the name unresolved
+        REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+            displayMetaData, &frameMeta, &objectMeta) == false );
+        
+        WHEN( "The Source name is registered" )
+        {
+            uint sourceId = Services::GetServices()->_sourceNameSet(source.c_str());
+            frameMeta.source_id = sourceId;
+            
+            THEN( "The Source name is resolved and the ODE is triggered" )
+            {
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == true );
+                Services::GetServices()->_sourceNameErase(source.c_str());
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeOccurrenceTrigger checks for a Source-Set correctly", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger with a source-set of two Sources" ) 
+    {
+        std::string odeTriggerName("occurence");
+        uint classId(1);
+        uint limit(0);
+        
+        std::string source1("source-1"), source2("source-2"), source3("source-3");
+        
+        uint sourceId1 = Services::GetServices()->_sourceNameSet(source1.c_str());
+        uint sourceId2 = Services::GetServices()->_sourceNameSet(source2.c_str());
+        uint sourceId3 = Services::GetServices()->_sourceNameSet(source3.c_str());
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), "", classId, limit);
+            
+        REQUIRE( pOdeTrigger->AddSourceToSet(source1.c_str()) == true );
+        REQUIRE( pOdeTrigger->AddSourceToSet(source2.c_str()) == true );
+        
+        // second call must fail
+        REQUIRE( pOdeTrigger->AddSourceToSet(source2.c_str()) == false );
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;  
+        frameMeta.frame_num = 444;
+        frameMeta.ntp_timestamp = INT64_MAX;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId; // must match ODE Trigger's classId
+        objectMeta.object_id = INT64_MAX; 
+        objectMeta.rect_params.left = 10;
+        objectMeta.rect_params.top = 10;
+        objectMeta.rect_params.width = 200;
+        objectMeta.rect_params.height = 100;
+        
+        objectMeta.confidence = 0.9999; 
+        
+        WHEN( "The Source ID is in the set" )
+        {
+            THEN( "The ODE is triggered for each Source in the set" )
+            {
+                frameMeta.source_id = sourceId1;
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == true );
+                frameMeta.source_id = sourceId2;
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == true );
+                REQUIRE( pOdeTrigger->CheckForFilterSets(sourceId1, classId) == true );
+            }
+        }
+        WHEN( "The Source ID is not in the set" )
+        {
+            frameMeta.source_id = sourceId3;
+            
+            THEN( "The ODE is NOT triggered" )
+            {
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == false );
+                REQUIRE( pOdeTrigger->CheckForFilterSets(sourceId3, classId) == false );
+            }
+        }
+        WHEN( "A Source is removed from the set" )
+        {
+            REQUIRE( pOdeTrigger->RemoveSourceFromSet(source1.c_str()) == true );
+            REQUIRE( pOdeTrigger->RemoveSourceFromSet(source1.c_str()) == false );
+            
+            THEN( "The ODE is only triggered for the remaining Source" )
+            {
+                frameMeta.source_id = sourceId1;
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == false );
+                frameMeta.source_id = sourceId2;
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == true );
+            }
+        }
+        WHEN( "All Sources are removed from the set" )
+        {
+            pOdeTrigger->RemoveAllSourcesFromSet();
+            frameMeta.source_id = sourceId3;
+            
+            THEN( "The ODE is triggered for any Source" )
+            {
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == true );
+            }
+        }
+        Services::GetServices()->_sourceNameErase(source1.c_str());
+        Services::GetServices()->_sourceNameErase(source2.c_str());
+        Services::GetServices()->_sourceNameErase(source3.c_str());
+    }
+}
+
+SCENARIO( "An OdeOccurrenceTrigger with a Source-Set counts its interval per Source", 
+    "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger with a source-set and skip-frame interval" ) 
+    {
+        std::string odeTriggerName("occurence");
+        uint classId(1);
+        uint limit(0);
+        
+        std::string source1("source-1"), source2("source-2");
+        
+        uint sourceId1 = Services::GetServices()->_sourceNameSet(source1.c_str());
+        uint sourceId2 = Services::GetServices()->_sourceNameSet(source2.c_str());
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), "", classId, limit);
+            
+        REQUIRE( pOdeTrigger->AddSourceToSet(source1.c_str()) == true );
+        REQUIRE( pOdeTrigger->AddSourceToSet(source2.c_str()) == true );
+        pOdeTrigger->SetInterval(2);
+
+        NvDsFrameMeta frameMeta1 =  {0}, frameMeta2 = {0};
+        frameMeta1.bInferDone = frameMeta2.bInferDone = true;  
+        frameMeta1.source_id = sourceId1;
+        frameMeta2.source_id = sourceId2;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId; // must match ODE Trigger's classId
+        objectMeta.object_id = INT64_MAX; 
+        objectMeta.rect_params.left = 10;
+        objectMeta.rect_params.top = 10;
+        objectMeta.rect_params.width = 200;
+        objectMeta.rect_params.height = 100;
+        
+        WHEN( "Frames from both Sources are interleaved" )
+        {
+            THEN( "Each Source skips its own frames" )
+            {
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta1);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta1, &objectMeta) == false );
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta2);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta2, &objectMeta) == false );
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta1);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta1, &objectMeta) == true );
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta2);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta2, &objectMeta) == true );
+            }
+        }
+        Services::GetServices()->_sourceNameErase(source1.c_str());
+        Services::GetServices()->_sourceNameErase(source2.c_str());
+    }
+}
+
+SCENARIO( "An OdeOccurrenceTrigger checks for a Class-Set correctly", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger with a class-set of two Class Ids" ) 
+    {
+        std::string odeTriggerName("occurence");
+        uint limit(0);
+        
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), "", 
+                DSL_ODE_ANY_CLASS, limit);
+        
+        uint classIds[] = {0, 2};
+        REQUIRE( pOdeTrigger->SetClassIds(classIds, 2) == true );
+        
+        std::vector<uint> retClassIds = pOdeTrigger->GetClassIds();
+        REQUIRE( retClassIds.size() == 2 );
+        REQUIRE( retClassIds[0] == 0 );
+        REQUIRE( retClassIds[1] == 2 );
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;  
+        frameMeta.source_id = 2;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.object_id = INT64_MAX; 
+        objectMeta.rect_params.left = 10;
+        objectMeta.rect_params.top = 10;
+        objectMeta.rect_params.width = 200;
+        objectMeta.rect_params.height = 100;
+        
+        WHEN( "The Class ID is in the set" )
+        {
+            objectMeta.class_id = 2;
+            
+            THEN( "The ODE is triggered" )
+            {
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == true );
+                REQUIRE( pOdeTrigger->CheckForFilterSets(2, 2) == true );
+            }
+        }
+        WHEN( "The Class ID is not in the set" )
+        {
+            objectMeta.class_id = 1;
+            
+            THEN( "The ODE is NOT triggered" )
+            {
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == false );
+                REQUIRE( pOdeTrigger->CheckForFilterSets(2, 1) == false );
+            }
+        }
+        WHEN( "A Class ID out of range is set" )
+        {
+            uint badClassIds[] = {1, DSL_ODE_CLASS_SET_SIZE};
+            
+            THEN( "The class-set is unchanged" )
+            {
+                REQUIRE( pOdeTrigger->SetClassIds(badClassIds, 2) == false );
+                REQUIRE( pOdeTrigger->GetClassIds().size() == 2 );
+            }
+        }
+        WHEN( "The class-set is cleared" )
+        {
+            REQUIRE( pOdeTrigger->SetClassIds(NULL, 0) == true );
+            objectMeta.class_id = 1;
+            
+            THEN( "The ODE is triggered for any Class" )
+            {
+                REQUIRE( pOdeTrigger->GetClassIds().size() == 0 );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == true );
+            }
+        }
+    }
+}
+
 SCENARIO( "An OdeOccurrenceTrigger checks for Infer Name/Id correctly", "[OdeTrigger]" )
 {
     GIVEN( "A new OdeTrigger with default criteria" ) 
@@ -1329,6 +1606,74 @@ SCENARIO( "An OdeOccurrenceTrigger checks its interval setting ", "[OdeTrigger]"
     }
 }
 
+SCENARIO( "An OdeOccurrenceTrigger's interval can be set while processing frames", 
+    "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger and a client thread that toggles the interval" ) 
+    {
+        std::string odeTriggerName("occurence");
+        uint classId(1);
+        uint limit(0); // not limit
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), "", classId, limit);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;  
+        frameMeta.source_id = 2;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId; // must match ODE Trigger's classId
+        objectMeta.rect_params.width = 200;
+        objectMeta.rect_params.height = 100;
+        
+        std::atomic<bool> done(false);
+        
+        WHEN( "Frames are processed while the interval is set to and from 0" )
+        {
+            std::thread client([&]()
+            {
+                uint interval(0);
+                while (!done)
+                {
+                    pOdeTrigger->SetInterval(interval);
+                    interval = (interval + 1) % 3;
+                }
+            });
+            for (uint i = 0; i < 100000; i++)
+            {
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta);
+                pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta);
+                pOdeTrigger->PostProcessFrame(NULL, displayMetaData, &frameMeta);
+            }
+            done = true;
+            client.join();
+            
+            THEN( "No frame divides by a zero interval and a new interval applies" )
+            {
+                // Counting restarts on the first frame for a new interval.
+                pOdeTrigger->SetInterval(0);
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == true );
+                pOdeTrigger->PostProcessFrame(NULL, displayMetaData, &frameMeta);
+                
+                pOdeTrigger->SetInterval(2);
+                
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == false );
+                pOdeTrigger->PostProcessFrame(NULL, displayMetaData, &frameMeta);
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == true );
+                pOdeTrigger->PostProcessFrame(NULL, displayMetaData, &frameMeta);
+            }
+        }
+    }
+}
+
 SCENARIO( "An OdeOccurrenceTrigger checks for Area overlap correctly", "[OdeTrigger]" )
 {
     GIVEN( "A new OdeOccurenceTrigger with criteria" ) 
@@ -4249,4 +4594,199 @@ SCENARIO( "A new Ralational OdeDistanceTrigger handles occurrence correctly", "[
             }
         }
     }
-}    
\ No newline at end of file
+}    
+SCENARIO( "An OdeOccurrenceTrigger returns its Dispatch Filter correctly", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger with a Source and Class filter" ) 
+    {
+        std::string odeTriggerName("occurence");
+        uint classId(1);
+        uint limit(0);
+        uint inferId(12345);
+        
+        std::string source("source-1");
+        std::string inferName("infer-1");
+        
+        uint sourceId = Services::GetServices()->_sourceNameSet(source.c_str());
+        Services::GetServices()->_inferNameSet(inferId, inferName.c_str());
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), 
+                source.c_str(), classId, limit);
+            
+        int retSourceId(0), retClassId(0), retInferId(0);
+
+        WHEN( "The Infer filter is not set" )
+        {
+            THEN( "The Infer Id is returned as any" )
+            {
+                REQUIRE( pOdeTrigger->GetDispatchFilter(&retSourceId, 
+                    &retClassId, &retInferId) == true );
+                REQUIRE( retSourceId == sourceId );
+                REQUIRE( retClassId == classId );
+                REQUIRE( retInferId == -1 );
+            }
+        }
+        WHEN( "The Infer and Class filters are updated" )
+        {
+            uint64_t generation = OdeTrigger::s_dispatchGeneration;
+            
+            pOdeTrigger->SetInfer(inferName.c_str());
+            pOdeTrigger->SetClassId(DSL_ODE_ANY_CLASS);
+            
+            THEN( "The dispatch generation is updated and the new filters returned" )
+            {
+                REQUIRE( OdeTrigger::s_dispatchGeneration > generation );
+                REQUIRE( pOdeTrigger->GetDispatchFilter(&retSourceId, 
+                    &retClassId, &retInferId) == true );
+                REQUIRE( retSourceId == sourceId );
+                REQUIRE( retClassId == -1 );
+                REQUIRE( retInferId == inferId );
+            }
+        }
+        WHEN( "The Source filter is set to an unknown Source" )
+        {
+            pOdeTrigger->SetSource("unknown-source");
+            
+            THEN( "The Source Id is returned as any and unresolved" )
+            {
+                REQUIRE( pOdeTrigger->GetDispatchFilter(&retSourceId, 
+                    &retClassId, &retInferId) == false );
+                REQUIRE( retSourceId == -1 );
+            }
+        }
+        Services::GetServices()->_sourceNameErase(source.c_str());
+        Services::GetServices()->_inferNameErase(inferId);
+    }
+}
+
+SCENARIO( "An OdeTrigger publishes a new Config snapshot on update", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger with a Source filter" ) 
+    {
+        std::string odeTriggerName("occurence");
+        uint classId(1);
+        uint limit(0);
+        
+        std::string source("source-1");
+        
+        uint sourceId = Services::GetServices()->_sourceNameSet(source.c_str());
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), 
+                source.c_str(), classId, limit);
+            
+        DSL_ODE_TRIGGER_CONFIG_PTR pConfig = pOdeTrigger->GetConfig();
+        
+        REQUIRE( pConfig->m_classId == classId );
+        REQUIRE( pConfig->m_sourceId == -1 );
+
+        WHEN( "The criteria are updated while a snapshot is held" )
+        {
+            pOdeTrigger->SetClassId(2);
+            pOdeTrigger->SetMinConfidence(0.5);
+            pOdeTrigger->SetMinDimensions(10, 20);
+            
+            THEN( "The held snapshot is unchanged and the new one is current" )
+            {
+                REQUIRE( pConfig->m_classId == classId );
+                REQUIRE( pConfig->m_minConfidence == 0 );
+                REQUIRE( pConfig->m_minWidth == 0 );
+                
+                DSL_ODE_TRIGGER_CONFIG_PTR pNewConfig = pOdeTrigger->GetConfig();
+                REQUIRE( pNewConfig != pConfig );
+                REQUIRE( pNewConfig->m_classId == 2 );
+                REQUIRE( pNewConfig->m_minConfidence == 0.5 );
+                REQUIRE( pNewConfig->m_minWidth == 10 );
+                REQUIRE( pNewConfig->m_minHeight == 20 );
+                REQUIRE( pNewConfig->m_source == source );
+            }
+        }
+        WHEN( "The Source Id is resolved on first use" )
+        {
+            int retSourceId(0), retClassId(0), retInferId(0);
+            
+            REQUIRE( pOdeTrigger->GetDispatchFilter(&retSourceId, 
+                &retClassId, &retInferId) == true );
+            
+            THEN( "The resolved snapshot is published" )
+            {
+                REQUIRE( pConfig->m_sourceId == -1 );
+                REQUIRE( pOdeTrigger->GetConfig()->m_sourceId == sourceId );
+                REQUIRE( std::string(pOdeTrigger->GetSource()) == source );
+            }
+        }
+        Services::GetServices()->_sourceNameErase(source.c_str());
+    }
+}
+
+SCENARIO( "Only opted-in OdeTriggers are Source Partitionable", "[OdeTrigger]" )
+{
+    GIVEN( "A new Occurrence Trigger and a new Custom Trigger" ) 
+    {
+        std::string source("source-1");
+        uint classId(1);
+        uint limit(0);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOccurrenceTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("occurrence", 
+                source.c_str(), classId, limit);
+
+        DSL_ODE_TRIGGER_CUSTOM_PTR pCustomTrigger = 
+            DSL_ODE_TRIGGER_CUSTOM_NEW("custom", 
+                source.c_str(), classId, limit, NULL, NULL, NULL);
+            
+        WHEN( "Both Triggers are queried" )
+        {
+            THEN( "The correct values are returned" )
+            {
+                REQUIRE( pOccurrenceTrigger->IsSourcePartitionable() == true );
+                REQUIRE( pCustomTrigger->IsSourcePartitionable() == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeTrigger is Source Partitionable only if all of its Actions are", 
+    "[OdeTrigger]" )
+{
+    GIVEN( "A new Occurrence Trigger and two ODE Actions" ) 
+    {
+        std::string source("source-1");
+        uint classId(1);
+        uint limit(0);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOccurrenceTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("occurrence", 
+                source.c_str(), classId, limit);
+
+        DSL_ODE_ACTION_BBOX_SCALE_PTR pScaleAction = 
+            DSL_ODE_ACTION_BBOX_SCALE_NEW("scale-action", 110);
+
+        DSL_ODE_ACTION_PRINT_PTR pPrintAction = 
+            DSL_ODE_ACTION_PRINT_NEW("print-action", false);
+            
+        REQUIRE( pOccurrenceTrigger->AddAction(pScaleAction) == true );
+        REQUIRE( pOccurrenceTrigger->IsSourcePartitionable() == true );
+            
+        WHEN( "An Action that must be called serially is added" )
+        {
+            REQUIRE( pOccurrenceTrigger->AddAction(pPrintAction) == true );
+            
+            THEN( "The Trigger is no longer Source Partitionable" )
+            {
+                REQUIRE( pOccurrenceTrigger->IsSourcePartitionable() == false );
+            }
+        }
+        WHEN( "The Action that must be called serially is removed" )
+        {
+            REQUIRE( pOccurrenceTrigger->AddAction(pPrintAction) == true );
+            REQUIRE( pOccurrenceTrigger->RemoveAction(pPrintAction) == true );
+            
+            THEN( "The Trigger is Source Partitionable again" )
+            {
+                REQUIRE( pOccurrenceTrigger->IsSourcePartitionable() == true );
+            }
+        }
+    }
+}
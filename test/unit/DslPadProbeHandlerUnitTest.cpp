@@ -25,6 +25,12 @@ THE SOFTWARE.
 #include "catch.hpp"
 #include "DslPadProbeHandler.h"
 #include "DslTrackerBintr.h"
+#include "DslOdeAction.h"
+#include "DslSyntheticBatchMeta.h"
+
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 using namespace DSL;
 
@@ -115,6 +121,70 @@ SCENARIO( "A OdePadProbeHandler can add and remove an OdeTrigger", "[PadProbeHan
     }
 }
 
+SCENARIO( "A OdePadProbeHandler handles synthetic batch meta correctly", "[PadProbeHandler]" )
+{
+    GIVEN( "A new OdePadProbeHandler with an OdeTrigger and Format BBox Action" ) 
+    {
+        std::string odeHandlerName = "ode-handler";
+        std::string odeTriggerName = "occurence";
+        std::string odeActionName = "bbox-format";
+        uint classId(0);
+        uint borderWidth(7);
+
+        DSL_PPH_ODE_PTR pPadProbeHandler = 
+            DSL_PPH_ODE_NEW(odeHandlerName.c_str());
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOccurrenceTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), "", 
+                classId, DSL_ODE_TRIGGER_LIMIT_NONE);
+
+        DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW("color", 1.0, 0.0, 0.0, 1.0);
+        DSL_ODE_ACTION_BBOX_FORMAT_PTR pOdeAction = 
+            DSL_ODE_ACTION_BBOX_FORMAT_NEW(odeActionName.c_str(), 
+                borderWidth, pColor, false, pColor);
+
+        REQUIRE( pOccurrenceTrigger->AddAction(pOdeAction) == true );
+        REQUIRE( pPadProbeHandler->AddChild(pOccurrenceTrigger) == true );
+
+        // two sources, five objects per frame, all class 0
+        SyntheticBatchMeta syntheticBatch(2, 5, {1}, 
+            SyntheticBatchMeta::MOTION_LINEAR, 10);
+        
+        GstPadProbeInfo info{};
+        info.data = syntheticBatch.GetBuffer();
+
+        WHEN( "The OdePadProbeHandler handles a new batch" )
+        {
+            syntheticBatch.NextBatch();
+            REQUIRE( pPadProbeHandler->HandlePadData(&info) == GST_PAD_PROBE_OK );
+            
+            THEN( "The Action is invoked for every object in the batch" )
+            {
+                uint objectCount(0);
+                
+                for (NvDsMetaList* pFrameMetaList = 
+                    syntheticBatch.GetBatchMeta()->frame_meta_list; 
+                    pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+                {
+                    NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+                    REQUIRE( pFrameMeta->frame_num == 1 );
+                    
+                    for (NvDsMetaList* pObjectMetaList = pFrameMeta->obj_meta_list; 
+                        pObjectMetaList; pObjectMetaList = pObjectMetaList->next)
+                    {
+                        NvDsObjectMeta* pObjectMeta = 
+                            (NvDsObjectMeta*)(pObjectMetaList->data);
+                        REQUIRE( pObjectMeta->rect_params.border_width == borderWidth );
+                        objectCount++;
+                    }
+                }
+                REQUIRE( objectCount == syntheticBatch.GetObjectsPerBatch() );
+                REQUIRE( objectCount == 10 );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new MeterPadProbeHandler is created correctly", "[PadProbeHandler]" )
 {
     GIVEN( "Attributes for a new MeterPadProbeHandler" ) 
@@ -169,6 +239,82 @@ SCENARIO( "A new MeterPadProbeHandler can Get/Set attributes correctly", "[PadPr
     }
 }
 
+static std::vector<dsl_meter_source_stats> meterSourceStats;
+
+static boolean meter_stats_handler_cb(dsl_meter_source_stats* stats, 
+    uint source_count, void* client_data)
+{
+    meterSourceStats.assign(stats, stats+source_count);
+    return true;
+}
+
+SCENARIO( "A new Stats MeterPadProbeHandler reports frame-interval statistics correctly", 
+    "[PadProbeHandler]" )
+{
+    GIVEN( "A new Stats MeterPadProbeHandler and synthetic batch-meta for two sources" ) 
+    {
+        std::string meterHandlerName("meter-handler");
+
+        DSL_PPH_METER_PTR pPadProbeHandler = 
+            DSL_PPH_METER_STATS_NEW(meterHandlerName.c_str(), 1, 
+                meter_stats_handler_cb, NULL);
+
+        REQUIRE( pPadProbeHandler->GetStallThreshold() == 
+            DSL_SOURCE_METER_DEFAULT_STALL_THRESHOLD );
+            
+        SyntheticBatchMeta syntheticBatch(2, 0, {1}, 
+            SyntheticBatchMeta::MOTION_LINEAR, 10);
+        
+        GstPadProbeInfo info{};
+        info.data = syntheticBatch.GetBuffer();
+
+        WHEN( "Frames are received with a gap in frame number and a stall" )
+        {
+            pPadProbeHandler->SetStallThreshold(10);
+            REQUIRE( pPadProbeHandler->GetStallThreshold() == 10 );
+            
+            for (uint i = 0; i < 4; i++)
+            {
+                syntheticBatch.NextBatch();
+                
+                // skip two frame numbers on the third batch
+                if (i >= 2)
+                {
+                    for (NvDsMetaList* pFrameMetaList = 
+                        syntheticBatch.GetBatchMeta()->frame_meta_list; 
+                        pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+                    {
+                        ((NvDsFrameMeta*)(pFrameMetaList->data))->frame_num += 2;
+                    }
+                }
+                // stall before the last batch
+                if (i == 3)
+                {
+                    g_usleep(20000);
+                }
+                REQUIRE( pPadProbeHandler->HandlePadData(&info) == GST_PAD_PROBE_OK );
+            }
+            REQUIRE( pPadProbeHandler->HandleIntervalTimeout() == true );
+            
+            THEN( "The correct statistics are reported for each source" )
+            {
+                REQUIRE( meterSourceStats.size() == 2 );
+                for (uint i = 0; i < 2; i++)
+                {
+                    REQUIRE( meterSourceStats[i].source_id == i );
+                    REQUIRE( meterSourceStats[i].frame_count == 4 );
+                    REQUIRE( meterSourceStats[i].dropped_frames == 2 );
+                    REQUIRE( meterSourceStats[i].stalls == 1 );
+                    REQUIRE( meterSourceStats[i].frame_interval_max >= 20000 );
+                    REQUIRE( meterSourceStats[i].frame_interval_p50 <= 
+                        meterSourceStats[i].frame_interval_max );
+                    REQUIRE( meterSourceStats[i].interval_fps_avg > 0 );
+                }
+            }
+        }
+    }
+}
+
 SCENARIO( "A new EosConsumerPadProbeEventHandler is created correctly", "[PadProbeHandler]" )
 {
     GIVEN( "Attributes for a new EosConsumerPadProbeEventHandler" ) 
@@ -421,6 +567,350 @@ SCENARIO( "Multiple PadProbeHandlers can be added to the Source Pad of a Bintr",
     }
 }
 
+static std::vector<uint> handlerOrder;
+
+static uint order_handler_1(void* buffer, void* client_data)
+{
+    handlerOrder.push_back(1);
+    return GST_PAD_PROBE_OK;
+}
+
+static uint order_handler_2(void* buffer, void* client_data)
+{
+    handlerOrder.push_back(2);
+    return GST_PAD_PROBE_REMOVE;
+}
+
+static uint order_handler_3(void* buffer, void* client_data)
+{
+    handlerOrder.push_back(3);
+    return GST_PAD_PROBE_OK;
+}
+
+static uint count_handler(void* buffer, void* client_data)
+{
+    (*(std::atomic<uint>*)client_data)++;
+    return GST_PAD_PROBE_OK;
+}
+
+SCENARIO( "A PadBufferProbetr calls its PadProbeHandlers in the order added", "[PadProbeHandler]" )
+{
+    GIVEN( "A new PadBufferProbetr and three new Custom PadProbeHandlers" ) 
+    {
+        DSL_ELEMENT_PTR pElement = DSL_ELEMENT_NEW("identity", "test-element");
+        DSL_PAD_BUFFER_PROBE_PTR pPadProbetr = 
+            DSL_PAD_BUFFER_PROBE_NEW("src-buffer-probe", "src", pElement);
+        
+        DSL_PPH_CUSTOM_PTR pHandler1 = 
+            DSL_PPH_CUSTOM_NEW("custom-handler-1", order_handler_1, NULL);
+        DSL_PPH_CUSTOM_PTR pHandler2 = 
+            DSL_PPH_CUSTOM_NEW("custom-handler-2", order_handler_2, NULL);
+        DSL_PPH_CUSTOM_PTR pHandler3 = 
+            DSL_PPH_CUSTOM_NEW("custom-handler-3", order_handler_3, NULL);
+
+        REQUIRE( pPadProbetr->AddPadProbeHandler(pHandler1) == true );
+        REQUIRE( pPadProbetr->AddPadProbeHandler(pHandler2) == true );
+        REQUIRE( pPadProbetr->AddPadProbeHandler(pHandler3) == true );
+        
+        GstBuffer* pBuffer = gst_buffer_new();
+        GstPadProbeInfo info{};
+        info.type = GST_PAD_PROBE_TYPE_BUFFER;
+        info.data = pBuffer;
+        
+        handlerOrder.clear();
+
+        WHEN( "The PadBufferProbetr handles two buffers" )
+        {
+            REQUIRE( pPadProbetr->HandlePadProbe(NULL, &info) == GST_PAD_PROBE_OK );
+            REQUIRE( pPadProbetr->HandlePadProbe(NULL, &info) == GST_PAD_PROBE_OK );
+            
+            THEN( "The handlers are called in order and the removed handler once only" )
+            {
+                std::vector<uint> expectedOrder{1,2,3,1,3};
+                REQUIRE( handlerOrder == expectedOrder );
+                REQUIRE( pPadProbetr->IsChild(pHandler2) == false );
+                REQUIRE( pPadProbetr->RemovePadProbeHandler(pHandler1) == true );
+                REQUIRE( pPadProbetr->RemovePadProbeHandler(pHandler3) == true );
+            }
+        }
+        gst_buffer_unref(pBuffer);
+    }
+}
+
+SCENARIO( "PadProbeHandlers can be added and removed while a PadBufferProbetr is handling buffers", 
+    "[PadProbeHandler]" )
+{
+    GIVEN( "A new PadBufferProbetr with a Custom PadProbeHandler" ) 
+    {
+        DSL_ELEMENT_PTR pElement = DSL_ELEMENT_NEW("identity", "test-element");
+        DSL_PAD_BUFFER_PROBE_PTR pPadProbetr = 
+            DSL_PAD_BUFFER_PROBE_NEW("src-buffer-probe", "src", pElement);
+        
+        std::atomic<uint> fixedCount(0);
+        std::atomic<uint> dynamicCount(0);
+        
+        DSL_PPH_CUSTOM_PTR pFixedHandler = 
+            DSL_PPH_CUSTOM_NEW("fixed-handler", count_handler, &fixedCount);
+
+        REQUIRE( pPadProbetr->AddPadProbeHandler(pFixedHandler) == true );
+        
+        GstBuffer* pBuffer = gst_buffer_new();
+        GstPadProbeInfo info{};
+        info.type = GST_PAD_PROBE_TYPE_BUFFER;
+        info.data = pBuffer;
+        
+        uint bufferCount(10000);
+
+        WHEN( "A second handler is repeatedly added and removed from another thread" )
+        {
+            std::atomic<bool> done(false);
+            std::thread writer([&]()
+            {
+                while (!done)
+                {
+                    DSL_PPH_CUSTOM_PTR pDynamicHandler = 
+                        DSL_PPH_CUSTOM_NEW("dynamic-handler", count_handler, &dynamicCount);
+                    pPadProbetr->AddPadProbeHandler(pDynamicHandler);
+                    pPadProbetr->RemovePadProbeHandler(pDynamicHandler);
+                }
+            });
+            for (uint i = 0; i < bufferCount; i++)
+            {
+                REQUIRE( pPadProbetr->HandlePadProbe(NULL, &info) == GST_PAD_PROBE_OK );
+            }
+            done = true;
+            writer.join();
+            
+            THEN( "The fixed handler is called for every buffer" )
+            {
+                REQUIRE( fixedCount == bufferCount );
+                REQUIRE( dynamicCount <= bufferCount );
+                REQUIRE( pPadProbetr->RemovePadProbeHandler(pFixedHandler) == true );
+            }
+        }
+        gst_buffer_unref(pBuffer);
+    }
+}
+
+SCENARIO( "A LatencyPadProbeHandler can add and remove trace-points", "[PadProbeHandler]" )
+{
+    GIVEN( "A new Tracker and LatencyPadProbeHandler in memory" ) 
+    {
+        std::string trackerName("iou-tracker");
+        uint initWidth(200);
+        uint initHeight(100);
+        
+        std::string latencyHandlerName("latency-handler");
+
+        DSL_PPH_LATENCY_PTR pLatencyHandler = 
+            DSL_PPH_LATENCY_NEW(latencyHandlerName.c_str());
+
+        DSL_TRACKER_PTR pTrackerBintr = 
+            DSL_TRACKER_NEW(trackerName.c_str(), "", initWidth, initHeight);
+
+        REQUIRE( pLatencyHandler->GetSegmentCount() == 0 );
+        REQUIRE( pLatencyHandler->IsInUse() == false );
+
+        WHEN( "Trace-points are added to the Sink and Source Pads of a Bintr" )
+        {
+            REQUIRE( pLatencyHandler->AddToParent(pTrackerBintr, DSL_PAD_SINK) == true );
+            REQUIRE( pLatencyHandler->AddToParent(pTrackerBintr, DSL_PAD_SRC) == true );
+
+            // same pad twice must fail
+            REQUIRE( pLatencyHandler->AddToParent(pTrackerBintr, DSL_PAD_SRC) == false );
+
+            THEN( "A single segment is created with the correct name" )
+            {
+                REQUIRE( pLatencyHandler->IsInUse() == true );
+                REQUIRE( pLatencyHandler->GetSegmentCount() == 1 );
+                REQUIRE( std::string(pLatencyHandler->GetSegmentName(0)) == 
+                    "iou-tracker:sink -> iou-tracker:src" );
+                
+                REQUIRE( pLatencyHandler->RemoveFromParent(pTrackerBintr, DSL_PAD_SINK) == true );
+                REQUIRE( pLatencyHandler->GetSegmentCount() == 0 );
+                REQUIRE( pLatencyHandler->RemoveFromParent(pTrackerBintr, DSL_PAD_SINK) == false );
+                REQUIRE( pLatencyHandler->RemoveFromParent(pTrackerBintr, DSL_PAD_SRC) == true );
+                REQUIRE( pLatencyHandler->IsInUse() == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A LatencyPadProbeHandler records segment latency correctly", "[PadProbeHandler]" )
+{
+    GIVEN( "A LatencyPadProbeHandler with two trace-points" ) 
+    {
+        std::string trackerName("iou-tracker");
+        uint initWidth(200);
+        uint initHeight(100);
+        
+        std::string latencyHandlerName("latency-handler");
+
+        DSL_PPH_LATENCY_PTR pLatencyHandler = 
+            DSL_PPH_LATENCY_NEW(latencyHandlerName.c_str());
+
+        DSL_TRACKER_PTR pTrackerBintr = 
+            DSL_TRACKER_NEW(trackerName.c_str(), "", initWidth, initHeight);
+
+        REQUIRE( pLatencyHandler->AddToParent(pTrackerBintr, DSL_PAD_SINK) == true );
+        REQUIRE( pLatencyHandler->AddToParent(pTrackerBintr, DSL_PAD_SRC) == true );
+
+        WHEN( "Frames from two sources are stamped at both trace-points" )
+        {
+            for (uint i = 0; i < 100; i++)
+            {
+                uint64_t pts(i*33333333);
+                pLatencyHandler->Stamp(0, 0, pts, 1000000 + i*100);
+                pLatencyHandler->Stamp(0, 1, pts, 1000000 + i*100);
+                pLatencyHandler->Stamp(1, 0, pts, 1001000 + i*100);
+                pLatencyHandler->Stamp(1, 1, pts, 1003000 + i*100);
+            }
+            // frame never stamped at the first trace-point must be ignored
+            pLatencyHandler->Stamp(1, 2, 0, 2000000);
+            
+            THEN( "The correct statistics are returned" )
+            {
+                dsl_latency_stats stats{0};
+                REQUIRE( pLatencyHandler->GetSegmentStats(0, &stats) == true );
+                REQUIRE( stats.count == 200 );
+                REQUIRE( stats.min == 1000 );
+                REQUIRE( stats.max == 3000 );
+                REQUIRE( stats.mean == 2000 );
+                REQUIRE( stats.p99 == 3000 );
+                
+                // out of range segment must fail
+                REQUIRE( pLatencyHandler->GetSegmentStats(1, &stats) == false );
+
+                pLatencyHandler->ClearStats();
+                REQUIRE( pLatencyHandler->GetSegmentStats(0, &stats) == true );
+                REQUIRE( stats.count == 0 );
+            }
+        }
+        WHEN( "The LatencyPadProbeHandler is disabled" )
+        {
+            REQUIRE( pLatencyHandler->SetEnabled(false) == true );
+            
+            pLatencyHandler->Stamp(0, 0, 0, 1000000);
+            pLatencyHandler->Stamp(1, 0, 0, 1001000);
+            
+            THEN( "No latency is recorded" )
+            {
+                dsl_latency_stats stats{0};
+                REQUIRE( pLatencyHandler->GetSegmentStats(0, &stats) == true );
+                REQUIRE( stats.count == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A ShmExportPadProbeHandler exports object metadata to shared memory", 
+    "[PadProbeHandler]" )
+{
+    GIVEN( "A new ShmExportPadProbeHandler and a reader mapping of the ring" ) 
+    {
+        std::string shmExportHandlerName("shm-export-handler");
+        std::string shmName("/dsl-pph-unit-test");
+
+        // capacity is rounded up to a power of 2
+        DSL_PPH_SHM_EXPORT_PTR pPadProbeHandler = 
+            DSL_PPH_SHM_EXPORT_NEW(shmExportHandlerName.c_str(), 
+                shmName.c_str(), 12);
+        REQUIRE( pPadProbeHandler->GetCapacity() == 16 );
+        
+        int fd = shm_open(shmName.c_str(), O_RDONLY, 0);
+        REQUIRE( fd >= 0 );
+        const dsl_shm_export_header* pHeader = (const dsl_shm_export_header*)
+            mmap(NULL, dsl_shm_export_size(16), PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        REQUIRE( pHeader != MAP_FAILED );
+        
+        REQUIRE( pHeader->magic == DSL_SHM_EXPORT_MAGIC );
+        REQUIRE( pHeader->version == DSL_SHM_EXPORT_VERSION );
+        REQUIRE( pHeader->record_size == sizeof(dsl_shm_export_record) );
+        REQUIRE( pHeader->capacity == 16 );
+        REQUIRE( dsl_shm_export_write_sequence(pHeader) == 0 );
+
+        // two sources, five objects per frame
+        SyntheticBatchMeta syntheticBatch(2, 5, {1}, 
+            SyntheticBatchMeta::MOTION_LINEAR, 10);
+        
+        GstPadProbeInfo info{};
+        info.data = syntheticBatch.GetBuffer();
+        
+        dsl_shm_export_record record;
+
+        WHEN( "The ShmExportPadProbeHandler handles a new batch" )
+        {
+            syntheticBatch.NextBatch();
+            REQUIRE( pPadProbeHandler->HandlePadData(&info) == GST_PAD_PROBE_OK );
+            
+            THEN( "One record is readable for every object in the batch" )
+            {
+                REQUIRE( dsl_shm_export_write_sequence(pHeader) == 10 );
+                
+                uint64_t sequence(1);
+                for (NvDsMetaList* pFrameMetaList = 
+                    syntheticBatch.GetBatchMeta()->frame_meta_list; 
+                    pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+                {
+                    NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+                    uint objectIndex(0);
+                    
+                    for (NvDsMetaList* pObjectMetaList = pFrameMeta->obj_meta_list; 
+                        pObjectMetaList; pObjectMetaList = pObjectMetaList->next)
+                    {
+                        NvDsObjectMeta* pObjectMeta = 
+                            (NvDsObjectMeta*)(pObjectMetaList->data);
+                        REQUIRE( dsl_shm_export_read(pHeader, sequence, &record) ==
+                            DSL_SHM_EXPORT_READ_OK );
+                        REQUIRE( record.sequence == sequence );
+                        REQUIRE( record.source_id == pFrameMeta->source_id );
+                        REQUIRE( record.frame_num == pFrameMeta->frame_num );
+                        REQUIRE( record.object_index == objectIndex++ );
+                        REQUIRE( record.object_count == 5 );
+                        REQUIRE( record.tracking_id == pObjectMeta->object_id );
+                        REQUIRE( record.class_id == pObjectMeta->class_id );
+                        REQUIRE( record.confidence == pObjectMeta->confidence );
+                        REQUIRE( record.left == pObjectMeta->rect_params.left );
+                        REQUIRE( record.height == pObjectMeta->rect_params.height );
+                        sequence++;
+                    }
+                }
+                REQUIRE( dsl_shm_export_read(pHeader, sequence, &record) ==
+                    DSL_SHM_EXPORT_READ_NOT_READY );
+                    
+                uint64_t frames(0), records(0);
+                pPadProbeHandler->GetStats(&frames, &records);
+                REQUIRE( frames == 2 );
+                REQUIRE( records == 10 );
+            }
+        }
+        WHEN( "The ShmExportPadProbeHandler handles more records than its capacity" )
+        {
+            syntheticBatch.NextBatch();
+            REQUIRE( pPadProbeHandler->HandlePadData(&info) == GST_PAD_PROBE_OK );
+            syntheticBatch.NextBatch();
+            REQUIRE( pPadProbeHandler->HandlePadData(&info) == GST_PAD_PROBE_OK );
+            
+            THEN( "The overwritten records are reported as overrun" )
+            {
+                REQUIRE( dsl_shm_export_write_sequence(pHeader) == 20 );
+                REQUIRE( dsl_shm_export_read(pHeader, 1, &record) ==
+                    DSL_SHM_EXPORT_READ_OVERRUN );
+                    
+                uint64_t oldest = dsl_shm_export_oldest_sequence(pHeader);
+                REQUIRE( oldest == 6 );
+                for (uint64_t sequence = oldest; sequence <= 20; sequence++)
+                {
+                    REQUIRE( dsl_shm_export_read(pHeader, sequence, &record) ==
+                        DSL_SHM_EXPORT_READ_OK );
+                }
+            }
+        }
+        munmap((void*)pHeader, dsl_shm_export_size(16));
+    }
+}
+
 SCENARIO( "A new FrameNumberAdderPadProbeHandler is created correctly", "[PadProbeHandler]" )
 {
     GIVEN( "Attributes for a new FrameNumberAdderPadProbeHandler" ) 
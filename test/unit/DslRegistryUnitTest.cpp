@@ -0,0 +1,164 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslRegistry.h"
+
+using namespace DSL;
+
+SCENARIO( "A new ShardedRegistry is created correctly", "[Registry]" )
+{
+    GIVEN( "Attributes for a new ShardedRegistry" ) 
+    {
+        uint shardCount(4);
+        
+        WHEN( "The ShardedRegistry is created" )
+        {
+            ShardedRegistry<std::string, uint> registry(shardCount);
+            
+            THEN( "The registry is empty" )
+            {
+                uint value(99);
+                REQUIRE( registry.Size() == 0 );
+                REQUIRE( registry.Exists("key") == false );
+                REQUIRE( registry.Find("key", value) == false );
+                REQUIRE( value == 99 );
+                REQUIRE( registry.Lookup("key") == nullptr );
+            }
+        }
+    }
+}
+
+SCENARIO( "A ShardedRegistry can set, find, and erase values", "[Registry]" )
+{
+    GIVEN( "A new ShardedRegistry" ) 
+    {
+        ShardedRegistry<uint, std::string> registry;
+        
+        WHEN( "Values are set for many keys" )
+        {
+            for (uint i = 0; i < 100; i++)
+            {
+                registry.Set(i, "source-" + std::to_string(i));
+            }
+            
+            THEN( "All values can be found" )
+            {
+                REQUIRE( registry.Size() == 100 );
+                
+                std::string value;
+                REQUIRE( registry.Find(42, value) == true );
+                REQUIRE( value == "source-42" );
+                
+                const std::string* pValue = registry.Lookup(99);
+                REQUIRE( pValue != nullptr );
+                REQUIRE( *pValue == "source-99" );
+                
+                // pointers remain valid while other keys are inserted.
+                for (uint i = 100; i < 1000; i++)
+                {
+                    registry.Set(i, "source-" + std::to_string(i));
+                }
+                REQUIRE( *pValue == "source-99" );
+            }
+        }
+        WHEN( "A value is replaced and another is erased" )
+        {
+            registry.Set(1, "source-1");
+            registry.Set(2, "source-2");
+            registry.Set(1, "source-one");
+            
+            REQUIRE( registry.Erase(2) == true );
+            REQUIRE( registry.Erase(2) == false );
+            
+            THEN( "The correct values are found" )
+            {
+                std::string value;
+                REQUIRE( registry.Size() == 1 );
+                REQUIRE( registry.Find(1, value) == true );
+                REQUIRE( value == "source-one" );
+                REQUIRE( registry.Exists(2) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A ShardedRegistry can be read while being updated", "[Registry]" )
+{
+    GIVEN( "A ShardedRegistry with a fixed set of keys" ) 
+    {
+        ShardedRegistry<std::string, uint> registry;
+        
+        for (uint i = 0; i < 64; i++)
+        {
+            registry.Set("fixed-" + std::to_string(i), i);
+        }
+        
+        WHEN( "Readers find the fixed keys while a writer churns other keys" )
+        {
+            std::atomic<bool> stop(false);
+            std::atomic<uint> misses(0);
+            
+            std::thread writer([&]()
+            {
+                uint i(0);
+                while (!stop)
+                {
+                    std::string key("churn-" + std::to_string(i++ % 256));
+                    registry.Set(key, i);
+                    registry.Erase(key);
+                }
+            });
+            
+            std::vector<std::thread> readers;
+            for (uint t = 0; t < 4; t++)
+            {
+                readers.push_back(std::thread([&]()
+                {
+                    for (uint i = 0; i < 100000; i++)
+                    {
+                        uint value(0);
+                        if (!registry.Find("fixed-" + std::to_string(i % 64), value)
+                            or value != i % 64)
+                        {
+                            misses++;
+                        }
+                    }
+                }));
+            }
+            for (auto& reader: readers)
+            {
+                reader.join();
+            }
+            stop = true;
+            writer.join();
+            
+            THEN( "All fixed keys are always found with the correct value" )
+            {
+                REQUIRE( misses == 0 );
+                REQUIRE( registry.Size() == 64 );
+            }
+        }
+    }
+}
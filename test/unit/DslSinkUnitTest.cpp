@@ -78,6 +78,232 @@ SCENARIO( "A new AppSinkBintr can LinkAll Child Elementrs", "[SinkBintr]" )
     }
 }
 
+static GstSample* new_test_sample(uint64_t offset)
+{
+    GstBuffer* pBuffer = gst_buffer_new();
+    GST_BUFFER_OFFSET(pBuffer) = offset;
+    GstSample* pSample = gst_sample_new(pBuffer, NULL, NULL, NULL);
+    gst_buffer_unref(pBuffer);
+    return pSample;
+}
+
+SCENARIO( "A queued AppSinkBintr returns samples in order with PullBatch",
+    "[SinkBintr]" )
+{
+    GIVEN( "A new queued AppSinkBintr" ) 
+    {
+        std::string sinkName("app-sink");
+
+        DSL_APP_SINK_PTR pSinkBintr = DSL_APP_SINK_QUEUED_NEW(sinkName.c_str(), 
+            DSL_SINK_APP_DATA_TYPE_BUFFER, 4, 
+            DSL_SINK_APP_QUEUE_POLICY_DROP_OLDEST);
+
+        REQUIRE( pSinkBintr->GetQueueEnabled() == true );
+        
+        uint maxSize(0), policy(99);
+        pSinkBintr->GetQueueSettings(&maxSize, &policy);
+        REQUIRE( maxSize == 4 );
+        REQUIRE( policy == DSL_SINK_APP_QUEUE_POLICY_DROP_OLDEST );
+
+        WHEN( "Fewer samples than the max-size are queued" )
+        {
+            for (uint64_t i = 0; i < 3; i++)
+            {
+                REQUIRE( pSinkBintr->QueueSample(new_test_sample(i)) 
+                    == GST_FLOW_OK );
+            }
+            THEN( "All samples are returned in order" )
+            {
+                void* data[8] = {0};
+                REQUIRE( pSinkBintr->PullBatch(data, 2) == 2 );
+                REQUIRE( GST_BUFFER_OFFSET((GstBuffer*)data[0]) == 0 );
+                REQUIRE( GST_BUFFER_OFFSET((GstBuffer*)data[1]) == 1 );
+                REQUIRE( pSinkBintr->PullBatch(&data[2], 6) == 1 );
+                REQUIRE( GST_BUFFER_OFFSET((GstBuffer*)data[2]) == 2 );
+                REQUIRE( pSinkBintr->PullBatch(data, 8) == 0 );
+                
+                uint depth(99), highWater(0);
+                uint64_t dropped(99);
+                pSinkBintr->GetQueueStats(&depth, &highWater, &dropped);
+                REQUIRE( depth == 0 );
+                REQUIRE( highWater == 3 );
+                REQUIRE( dropped == 0 );
+                
+                for (uint i = 0; i < 3; i++)
+                {
+                    gst_buffer_unref((GstBuffer*)data[i]);
+                }
+            }
+        }
+        WHEN( "More samples than the max-size are queued with drop-oldest" )
+        {
+            for (uint64_t i = 0; i < 7; i++)
+            {
+                REQUIRE( pSinkBintr->QueueSample(new_test_sample(i)) 
+                    == GST_FLOW_OK );
+            }
+            THEN( "The newest samples are returned and the drops counted" )
+            {
+                void* data[8] = {0};
+                REQUIRE( pSinkBintr->PullBatch(data, 8) == 4 );
+                for (uint i = 0; i < 4; i++)
+                {
+                    REQUIRE( GST_BUFFER_OFFSET((GstBuffer*)data[i]) == i+3 );
+                    gst_buffer_unref((GstBuffer*)data[i]);
+                }
+                uint depth(99), highWater(0);
+                uint64_t dropped(0);
+                pSinkBintr->GetQueueStats(&depth, &highWater, &dropped);
+                REQUIRE( depth == 0 );
+                REQUIRE( highWater == 4 );
+                REQUIRE( dropped == 3 );
+                
+                pSinkBintr->ClearQueueStats();
+                pSinkBintr->GetQueueStats(&depth, &highWater, &dropped);
+                REQUIRE( highWater == 0 );
+                REQUIRE( dropped == 0 );
+            }
+        }
+        WHEN( "More samples than the max-size are queued with drop-newest" )
+        {
+            REQUIRE( pSinkBintr->SetQueueSettings(4, 
+                DSL_SINK_APP_QUEUE_POLICY_DROP_NEWEST) == true );
+            pSinkBintr->SetDataType(DSL_SINK_APP_DATA_TYPE_SAMPLE);
+            
+            for (uint64_t i = 0; i < 7; i++)
+            {
+                REQUIRE( pSinkBintr->QueueSample(new_test_sample(i)) 
+                    == GST_FLOW_OK );
+            }
+            THEN( "The oldest samples are returned and the drops counted" )
+            {
+                void* data[8] = {0};
+                REQUIRE( pSinkBintr->PullBatch(data, 8) == 4 );
+                for (uint i = 0; i < 4; i++)
+                {
+                    REQUIRE( GST_BUFFER_OFFSET(gst_sample_get_buffer(
+                        (GstSample*)data[i])) == i );
+                    gst_sample_unref((GstSample*)data[i]);
+                }
+                uint depth(99), highWater(0);
+                uint64_t dropped(0);
+                pSinkBintr->GetQueueStats(&depth, &highWater, &dropped);
+                REQUIRE( dropped == 3 );
+            }
+        }
+        WHEN( "Samples are left in the queue" )
+        {
+            for (uint64_t i = 0; i < 3; i++)
+            {
+                REQUIRE( pSinkBintr->QueueSample(new_test_sample(i)) 
+                    == GST_FLOW_OK );
+            }
+            THEN( "The max-size can be updated while unlinked" )
+            {
+                REQUIRE( pSinkBintr->SetQueueSettings(8, 
+                    DSL_SINK_APP_QUEUE_POLICY_BLOCK) == true );
+                    
+                uint depth(99), highWater(0);
+                uint64_t dropped(0);
+                pSinkBintr->GetQueueStats(&depth, &highWater, &dropped);
+                REQUIRE( depth == 0 );
+                
+                REQUIRE( pSinkBintr->LinkAll() == true );
+                REQUIRE( pSinkBintr->SetQueueSettings(16, 
+                    DSL_SINK_APP_QUEUE_POLICY_BLOCK) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A queued AppSinkBintr with the block policy waits for the client",
+    "[SinkBintr]" )
+{
+    GIVEN( "A new queued AppSinkBintr with a full queue" ) 
+    {
+        std::string sinkName("app-sink");
+
+        DSL_APP_SINK_PTR pSinkBintr = DSL_APP_SINK_QUEUED_NEW(sinkName.c_str(), 
+            DSL_SINK_APP_DATA_TYPE_SAMPLE, 2, 
+            DSL_SINK_APP_QUEUE_POLICY_BLOCK);
+
+        // the appsink's sink pad is flushing until activated on play
+        GstIterator* pIterator = gst_bin_iterate_sinks(
+            GST_BIN(pSinkBintr->GetGstElement()));
+        GValue item = G_VALUE_INIT;
+        REQUIRE( gst_iterator_next(pIterator, &item) == GST_ITERATOR_OK );
+        GstPad* pSinkPad = gst_element_get_static_pad(
+            GST_ELEMENT(g_value_get_object(&item)), "sink");
+        g_value_unset(&item);
+        gst_iterator_free(pIterator);
+        
+        REQUIRE( gst_pad_set_active(pSinkPad, TRUE) == TRUE );
+
+        REQUIRE( pSinkBintr->QueueSample(new_test_sample(0)) == GST_FLOW_OK );
+        REQUIRE( pSinkBintr->QueueSample(new_test_sample(1)) == GST_FLOW_OK );
+
+        std::atomic<bool> queued(false);
+        GstFlowReturn producerRetVal(GST_FLOW_ERROR);
+        
+        WHEN( "A third sample is queued on another thread" )
+        {
+            std::thread producer([&]()
+            {
+                producerRetVal = pSinkBintr->QueueSample(new_test_sample(2));
+                queued = true;
+            });
+            g_usleep(50000);
+            REQUIRE( queued == false );
+            
+            THEN( "The producer is released once the client pulls" )
+            {
+                void* data[2] = {0};
+                REQUIRE( pSinkBintr->PullBatch(data, 1) == 1 );
+                producer.join();
+                REQUIRE( queued == true );
+                REQUIRE( producerRetVal == GST_FLOW_OK );
+                REQUIRE( pSinkBintr->PullBatch(&data[1], 1) == 1 );
+                REQUIRE( GST_BUFFER_OFFSET(gst_sample_get_buffer(
+                    (GstSample*)data[1])) == 1 );
+                    
+                gst_sample_unref((GstSample*)data[0]);
+                gst_sample_unref((GstSample*)data[1]);
+                
+                uint depth(0), highWater(0);
+                uint64_t dropped(99);
+                pSinkBintr->GetQueueStats(&depth, &highWater, &dropped);
+                REQUIRE( depth == 1 );
+                REQUIRE( dropped == 0 );
+            }
+        }
+        WHEN( "The sink pad starts flushing while the producer is blocked" )
+        {
+            std::thread producer([&]()
+            {
+                producerRetVal = pSinkBintr->QueueSample(new_test_sample(2));
+                queued = true;
+            });
+            g_usleep(50000);
+            REQUIRE( queued == false );
+            
+            REQUIRE( gst_pad_set_active(pSinkPad, FALSE) == TRUE );
+            
+            THEN( "The producer gives up and the new sample is dropped" )
+            {
+                producer.join();
+                REQUIRE( producerRetVal == GST_FLOW_FLUSHING );
+                
+                uint depth(0), highWater(0);
+                uint64_t dropped(0);
+                pSinkBintr->GetQueueStats(&depth, &highWater, &dropped);
+                REQUIRE( depth == 2 );
+            }
+        }
+        gst_pad_set_active(pSinkPad, FALSE);
+        gst_object_unref(pSinkPad);
+    }
+}
+
 SCENARIO( "A new FakeSinkBintr is created correctly",  "[SinkBintr]" )
 {
     GIVEN( "Attributes for a new Fake Sink" ) 
@@ -150,6 +150,102 @@ SCENARIO( "A AppSourceBintr can UnlinkAll all child Elementrs correctly",  "[Sou
     }
 }
 
+SCENARIO( "An AppSourceBintr allocates its buffer pool on LinkAll",  
+    "[SourceBintr]" )
+{
+    GIVEN( "A new AppSourceBintr with a buffer-pool size" ) 
+    {
+        boolean isLive(true);
+        uint poolSize(2);
+
+        DSL_APP_SOURCE_PTR pSourceBintr = DSL_APP_SOURCE_NEW(
+            sourceName.c_str(), isLive, "I420", width, height, fps_n, fps_d);
+
+        REQUIRE( pSourceBintr->SetBufferPoolSize(poolSize) == true );
+        REQUIRE( pSourceBintr->GetBufferPoolSize() == poolSize );
+        
+        void* buffers[3] = {0};
+        void* data(NULL);
+        uint size(0);
+
+        // no pool until linked
+        REQUIRE( pSourceBintr->AcquireBuffer(&buffers[0], &data, &size) 
+            == false );
+
+        WHEN( "The AppSourceBintr is Linked" )
+        {
+            REQUIRE( pSourceBintr->LinkAll() == true );
+            
+            // pool size can't be changed while linked
+            REQUIRE( pSourceBintr->SetBufferPoolSize(4) == false );
+
+            THEN( "The pre-allocated buffers can be acquired and released" )
+            {
+                for (uint i = 0; i < poolSize; i++)
+                {
+                    REQUIRE( pSourceBintr->AcquireBuffer(&buffers[i], 
+                        &data, &size) == true );
+                    REQUIRE( data != NULL );
+                    
+                    // I420 = 1.5 bytes per pixel
+                    REQUIRE( size == width*height*3/2 );
+                }
+                
+                // all buffers in use - acquire must not wait
+                REQUIRE( pSourceBintr->AcquireBuffer(&buffers[2], 
+                    &data, &size) == false );
+                    
+                pSourceBintr->ReleaseBuffer(buffers[0]);
+                REQUIRE( pSourceBintr->AcquireBuffer(&buffers[2], 
+                    &data, &size) == true );
+
+                pSourceBintr->ReleaseBuffer(buffers[1]);
+                pSourceBintr->ReleaseBuffer(buffers[2]);
+                pSourceBintr->UnlinkAll();
+            }
+        }
+    }
+}
+
+SCENARIO( "An AppSourceBintr can update its min-level-percent correctly",  
+    "[SourceBintr]" )
+{
+    GIVEN( "A new AppSourceBintr" ) 
+    {
+        boolean isLive(true);
+
+        DSL_APP_SOURCE_PTR pSourceBintr = DSL_APP_SOURCE_NEW(
+            sourceName.c_str(), isLive, "I420", width, height, fps_n, fps_d);
+
+        REQUIRE( pSourceBintr->GetMinLevelPercent() == 0 );
+        REQUIRE( pSourceBintr->GetDataState() == 
+            DSL_SOURCE_APP_DATA_STATE_NEED_DATA );
+
+        WHEN( "The min-level-percent is updated" )
+        {
+            REQUIRE( pSourceBintr->SetMinLevelPercent(25) == true );
+
+            THEN( "The correct value is returned on get" )
+            {
+                REQUIRE( pSourceBintr->GetMinLevelPercent() == 25 );
+            }
+        }
+        WHEN( "The AppSourceBintr signals enough-data and need-data" )
+        {
+            pSourceBintr->HandleEnoughData();
+            REQUIRE( pSourceBintr->GetDataState() == 
+                DSL_SOURCE_APP_DATA_STATE_ENOUGH_DATA );
+            pSourceBintr->HandleNeedData(0);
+
+            THEN( "The data-state is updated correctly" )
+            {
+                REQUIRE( pSourceBintr->GetDataState() == 
+                    DSL_SOURCE_APP_DATA_STATE_NEED_DATA );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new CsiSourceBintr is created correctly",  "[SourceBintr]" )
 {
     GIVEN( "A name for a new CsiSourceBintr" ) 
@@ -0,0 +1,176 @@
+/*
+The MIT License
+
+Copyright (c) 2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslTimerWheel.h"
+
+using namespace DSL;
+
+struct TimerWheelTestData
+{
+    int64_t m_scheduled;
+    std::atomic<int64_t> m_fired;
+    std::atomic<uint> m_count;
+    uint m_period;
+    uint m_maxCount;
+};
+
+static uint timer_wheel_test_cb(void* pUserData)
+{
+    TimerWheelTestData* pData = (TimerWheelTestData*)pUserData;
+    
+    if (!pData->m_fired)
+    {
+        pData->m_fired = g_get_monotonic_time();
+    }
+    return (++pData->m_count < pData->m_maxCount) ? pData->m_period : 0;
+}
+
+SCENARIO( "The TimerWheel expires one-shot timers at their deadline", "[TimerWheel]" )
+{
+    GIVEN( "A set of one-shot timers with random timeouts" ) 
+    {
+        TimerWheel& timerWheel = TimerWheel::GetTimerWheel();
+        uint initialCount = timerWheel.GetTimerCount();
+        
+        const uint numTimers(100);
+        std::vector<uint> timeouts(numTimers);
+        TimerWheelTestData data[numTimers];
+        
+        std::mt19937 generator(1);
+        std::uniform_int_distribution<uint> distribution(1, 1500);
+        
+        WHEN( "The timers are scheduled" )
+        {
+            for (uint i = 0; i < numTimers; i++)
+            {
+                timeouts[i] = distribution(generator);
+                data[i].m_fired = 0;
+                data[i].m_count = 0;
+                data[i].m_period = 0;
+                data[i].m_maxCount = 1;
+                data[i].m_scheduled = g_get_monotonic_time();
+                REQUIRE( timerWheel.Schedule(timeouts[i], 
+                    timer_wheel_test_cb, &data[i]) != 0 );
+            }
+            REQUIRE( timerWheel.GetTimerCount() == initialCount + numTimers );
+            
+            g_usleep(2000000);
+            
+            THEN( "Each timer has fired once, no earlier than its timeout" )
+            {
+                for (uint i = 0; i < numTimers; i++)
+                {
+                    REQUIRE( data[i].m_count == 1 );
+                    
+                    // Ticks are whole milliseconds - allow 1 ms for truncation.
+                    int64_t elapsedMs = 
+                        (data[i].m_fired - data[i].m_scheduled)/1000;
+                    REQUIRE( elapsedMs >= (int64_t)timeouts[i] - 1 );
+                    REQUIRE( elapsedMs <= (int64_t)timeouts[i] + 50 );
+                }
+                REQUIRE( timerWheel.GetTimerCount() == initialCount );
+            }
+        }
+    }
+}
+
+SCENARIO( "The TimerWheel reschedules and cancels timers correctly", "[TimerWheel]" )
+{
+    GIVEN( "The TimerWheel and test data" ) 
+    {
+        TimerWheel& timerWheel = TimerWheel::GetTimerWheel();
+        uint initialCount = timerWheel.GetTimerCount();
+
+        TimerWheelTestData periodic{};
+        periodic.m_period = 20;
+        periodic.m_maxCount = 5;
+
+        TimerWheelTestData cancelled{};
+        cancelled.m_maxCount = 1;
+
+        TimerWheelTestData distant{};
+        distant.m_maxCount = 1;
+
+        WHEN( "A periodic timer is scheduled and others are cancelled" )
+        {
+            REQUIRE( timerWheel.Schedule(20, 
+                timer_wheel_test_cb, &periodic) != 0 );
+            
+            uint cancelledId = timerWheel.Schedule(50, 
+                timer_wheel_test_cb, &cancelled);
+                
+            // Beyond the span of the wheel.
+            uint distantId = timerWheel.Schedule(24*3600*1000, 
+                timer_wheel_test_cb, &distant);
+                
+            REQUIRE( timerWheel.Cancel(cancelledId) == true );
+            REQUIRE( timerWheel.Cancel(cancelledId) == false );
+            
+            g_usleep(300000);
+            
+            REQUIRE( timerWheel.CancelAndWait(distantId) == true );
+
+            THEN( "Only the periodic timer fires, for the number of periods" )
+            {
+                REQUIRE( periodic.m_count == 5 );
+                REQUIRE( cancelled.m_count == 0 );
+                REQUIRE( distant.m_count == 0 );
+                REQUIRE( timerWheel.GetTimerCount() == initialCount );
+            }
+        }
+    }
+}
+
+static uint timer_wheel_running_id_cb(void* pUserData)
+{
+    *(uint*)pUserData = TimerWheel::GetTimerWheel().GetRunningTimerId();
+    
+    return 0;
+}
+
+SCENARIO( "The TimerWheel identifies the timer whose callback is running", "[TimerWheel]" )
+{
+    GIVEN( "The TimerWheel and storage for the running timer id" ) 
+    {
+        TimerWheel& timerWheel = TimerWheel::GetTimerWheel();
+        
+        uint runningTimerId(0);
+
+        WHEN( "A one-shot timer is scheduled" )
+        {
+            uint timerId = timerWheel.Schedule(10, 
+                timer_wheel_running_id_cb, &runningTimerId);
+            REQUIRE( timerId != 0 );
+            
+            g_usleep(100000);
+
+            THEN( "The callback sees its own id, and no callback is running after" )
+            {
+                REQUIRE( runningTimerId == timerId );
+                REQUIRE( timerWheel.GetRunningTimerId() == 0 );
+            }
+        }
+    }
+}
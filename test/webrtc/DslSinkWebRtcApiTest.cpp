@@ -152,3 +152,90 @@ SCENARIO( "A Client Listener can be added and removed from a WebRTC Sink", "[web
         }
     }
 }    
+
+SCENARIO( "A new WebRTC Fan-out Sink can be created and queried successfully", "[webrtc-sink-api]" )
+{
+    GIVEN( "An empty list of components" ) 
+    {
+        std::wstring webrtc_fanout_sink_name(L"webrtc-fanout-sink");
+        uint max_peers(8);
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "When a new WebRTC Fan-out Sink is created" ) 
+        {
+            REQUIRE( dsl_sink_webrtc_fanout_new(webrtc_fanout_sink_name.c_str(),
+                stun_server.c_str(), NULL, codec, bitrate, interval, 
+                max_peers) == DSL_RESULT_SUCCESS );
+
+            // Second call with the same name must fail
+            REQUIRE( dsl_sink_webrtc_fanout_new(webrtc_fanout_sink_name.c_str(),
+                stun_server.c_str(), NULL, codec, bitrate, interval, 
+                max_peers) == DSL_RESULT_SINK_NAME_NOT_UNIQUE );
+
+            THEN( "The Sink's stats are returned correctly" )
+            {
+                uint peers(99);
+                uint64_t dropped_buffers(99), key_frame_requests(99);
+                REQUIRE( dsl_sink_webrtc_fanout_stats_get(
+                    webrtc_fanout_sink_name.c_str(), &peers, &dropped_buffers,
+                    &key_frame_requests) == DSL_RESULT_SUCCESS );
+                REQUIRE( peers == 0 );
+                REQUIRE( dropped_buffers == 0 );
+                REQUIRE( key_frame_requests == 0 );
+
+                // Stats must fail for the single client WebRTC Sink
+                REQUIRE( dsl_sink_webrtc_new(webrtc_sink_name.c_str(),
+                    stun_server.c_str(), NULL, codec, bitrate, 
+                    interval) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_sink_webrtc_fanout_stats_get(
+                    webrtc_sink_name.c_str(), &peers, &dropped_buffers,
+                    &key_frame_requests) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+        WHEN( "When a new WebRTC Fan-out Sink is created with max-peers = 0" ) 
+        {
+            THEN( "The create must fail" )
+            {
+                REQUIRE( dsl_sink_webrtc_fanout_new(webrtc_fanout_sink_name.c_str(),
+                    stun_server.c_str(), NULL, codec, bitrate, interval, 
+                    0) == DSL_RESULT_SINK_SET_FAILED );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "The WebRTC Fan-out Sink API checks for NULL input parameters", "[webrtc-sink-api]" )
+{
+    GIVEN( "An empty list of Components" ) 
+    {
+        std::wstring webrtc_fanout_sink_name(L"webrtc-fanout-sink");
+        uint peers(0);
+        uint64_t dropped_buffers(0), key_frame_requests(0);
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "When NULL pointers are used as input" ) 
+        {
+            THEN( "The API returns DSL_RESULT_INVALID_INPUT_PARAM in all cases" ) 
+            {
+                REQUIRE( dsl_sink_webrtc_fanout_new(NULL, NULL, NULL, 
+                    codec, bitrate, interval, 1) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_webrtc_fanout_stats_get(NULL, 
+                    &peers, &dropped_buffers, &key_frame_requests) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_webrtc_fanout_stats_get(webrtc_fanout_sink_name.c_str(), 
+                    NULL, &dropped_buffers, &key_frame_requests) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_webrtc_fanout_stats_get(webrtc_fanout_sink_name.c_str(), 
+                    &peers, NULL, &key_frame_requests) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_sink_webrtc_fanout_stats_get(webrtc_fanout_sink_name.c_str(), 
+                    &peers, &dropped_buffers, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
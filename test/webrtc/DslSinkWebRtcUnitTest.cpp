@@ -137,3 +137,66 @@ SCENARIO( "A new WebRtcSinkBintr can be added to and removed from a parent Pipel
         }
     }
 }
+
+SCENARIO( "A new WebRtcFanoutSinkBintr is created correctly",  "[WebRtcFanoutSinkBintr]" )
+{
+    GIVEN( "Attributes for a new WebRtcFanoutSinkBintr" ) 
+    {
+        uint maxPeers(8);
+
+        WHEN( "The WebRtcFanoutSinkBintr is created " )
+        {
+            DSL_WEBRTC_FANOUT_SINK_PTR pSinkBintr = 
+                DSL_WEBRTC_FANOUT_SINK_NEW(sinkName.c_str(), stunServer.c_str(), 
+                    turnServer.c_str(), codec, bitrate, interval, maxPeers);
+            
+            THEN( "The correct attribute values are returned" )
+            {
+                REQUIRE( pSinkBintr->GetMaxPeers() == maxPeers );
+
+                // Available for new connections until max-peers is reached
+                REQUIRE( pSinkBintr->IsConnected() == false );
+
+                uint retPeers(99);
+                uint64_t retDroppedBuffers(99), retKeyFrameRequests(99);
+                pSinkBintr->GetStats(&retPeers, 
+                    &retDroppedBuffers, &retKeyFrameRequests);
+                REQUIRE( retPeers == 0 );
+                REQUIRE( retDroppedBuffers == 0 );
+                REQUIRE( retKeyFrameRequests == 0 );
+
+                uint retCodec(99), retBitrate(99), retInterval(99);
+                pSinkBintr->GetEncoderSettings(&retCodec, &retBitrate, &retInterval);
+                REQUIRE( retCodec == codec );
+                REQUIRE( retBitrate == bitrate );
+                REQUIRE( retInterval == interval );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new WebRtcFanoutSinkBintr can LinkAll and UnlinkAll Child Elementrs successfully", "[WebRtcFanoutSinkBintr]" )
+{
+    GIVEN( "A new WebRtcFanoutSinkBintr in an Unlinked state" ) 
+    {
+        DSL_WEBRTC_FANOUT_SINK_PTR pSinkBintr = 
+            DSL_WEBRTC_FANOUT_SINK_NEW(sinkName.c_str(), stunServer.c_str(), 
+                turnServer.c_str(), DSL_CODEC_H264, 4000000, 0, 4);
+
+        REQUIRE( pSinkBintr->IsLinked() == false );
+
+        WHEN( "A new WebRtcFanoutSinkBintr is Linked" )
+        {
+            REQUIRE( pSinkBintr->LinkAll() == true );
+
+            THEN( "The WebRtcFanoutSinkBintr's IsLinked state is updated correctly" )
+            {
+                REQUIRE( pSinkBintr->IsLinked() == true );
+
+                // Unlink must set linked state
+                pSinkBintr->UnlinkAll();
+                REQUIRE( pSinkBintr->IsLinked() == false );
+            }
+        }
+    }
+}